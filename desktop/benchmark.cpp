@@ -0,0 +1,359 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "common.h"
+#include "loader.h"
+#include "math3d.h"
+#include "offline.h"
+#include "pipeline.h"
+#include "render.h"
+
+// Renders every scene of a directory at several sizes and camera angles on
+// one thread and writes the timings of each stage as JSON. Every stage runs
+// repeats times and the fastest run is kept, which filters out most of the
+// noise of a shared machine. polygons is all of scene_to_polygons, the plane
+// fit is also timed on its own over the same faces. Rendering into a
+// null_sink measures the Warnock classification alone, the pixel fill is
+// timed by replaying the writes of a recorded render into the frame, and the
+// full render is timed as well.
+
+struct benchmark_options {
+    std::string scenes = "models";
+    std::vector<std::pair<int16_t, int16_t>> sizes;
+    size_t angles = 8;
+    size_t repeats = 5;
+    std::string output;
+    std::string label;
+};
+
+struct stage_times {
+    double transform;
+    double shading;
+    double polygons;
+    double plane_fitting;
+    double classification;
+    double fill;
+    double render;
+};
+
+struct benchmark_result {
+    std::string scene;
+    int16_t width;
+    int16_t height;
+    float angle;
+    size_t polygons;
+    stage_times times;
+};
+
+static void print_usage() {
+    std::cout << "usage: benchmark [options]\n"
+                 "  --scenes DIR      directory of the .scene files, models "
+                 "by default\n"
+                 "  --size WxH        frame size, may be repeated, 240x240 "
+                 "to 1920x1080 by default\n"
+                 "  --angles N        camera angles of the orbit, 8 by "
+                 "default\n"
+                 "  --repeats N       runs of every stage, 5 by default\n"
+                 "  --label TEXT      label of the run, a commit for example\n"
+                 "  --output FILE     JSON file, stdout by default\n"
+                 "  --help            print this text\n";
+}
+
+static bool parse_count(const char *text, size_t &value) {
+    char *end;
+    unsigned long count = strtoul(text, &end, 10);
+    if (end == text || *end != '\0' || count == 0)
+        return false;
+
+    value = count;
+    return true;
+}
+
+static bool parse_options(int argc, char **argv,
+                          benchmark_options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+            return false;
+        if (i + 1 >= argc) {
+            std::cout << "missing value of " << arg << std::endl;
+            return false;
+        }
+
+        const char *value = argv[++i];
+        if (arg == "--scenes") {
+            options.scenes = value;
+        } else if (arg == "--size") {
+            int width, height;
+            if (sscanf(value, "%dx%d", &width, &height) != 2 || width < 2 ||
+                height < 2 || width > GUARD_BAND || height > GUARD_BAND) {
+                std::cout << "invalid size " << value << std::endl;
+                return false;
+            }
+            // windows are centered on the screen, sizes are kept even
+            options.sizes.push_back({static_cast<int16_t>(width & ~1),
+                                     static_cast<int16_t>(height & ~1)});
+        } else if (arg == "--angles" || arg == "--repeats") {
+            size_t &count =
+                arg == "--angles" ? options.angles : options.repeats;
+            if (!parse_count(value, count)) {
+                std::cout << "invalid number " << value << std::endl;
+                return false;
+            }
+        } else if (arg == "--label") {
+            options.label = value;
+        } else if (arg == "--output") {
+            options.output = value;
+        } else {
+            std::cout << "unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (options.sizes.empty())
+        options.sizes = {{240, 240}, {320, 240}, {640, 480}, {1280, 720},
+                         {1920, 1080}};
+    return true;
+}
+
+static double to_ms(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+template <typename Function>
+static double fastest_ms(size_t repeats, Function &&function) {
+    double best = 0;
+    for (size_t i = 0; i < repeats; ++i) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        double ms = to_ms(std::chrono::steady_clock::now() - begin);
+        best = i == 0 ? ms : std::min(best, ms);
+    }
+
+    return best;
+}
+
+// the serial renderer reorders the index list, it is reset outside of the
+// timed region
+template <typename Sink>
+static double render_ms(size_t repeats, Sink &sink,
+                        const polygon_store &polygons, const window &screen,
+                        std::vector<polygon_index> &indices) {
+    double best = 0;
+    for (size_t i = 0; i < repeats; ++i) {
+        indices.resize(polygons.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        window window = {screen.begin, screen.end,
+                         {indices.data(), indices.size()}};
+
+        auto begin = std::chrono::steady_clock::now();
+        warnock_render(sink, polygons.view(), window, WHITE);
+        double ms = to_ms(std::chrono::steady_clock::now() - begin);
+        best = i == 0 ? ms : std::min(best, ms);
+    }
+
+    return best;
+}
+
+// the projected vertices of the faces the plane fit sees, faces cut by the
+// near plane are left out
+static void gather_faces(const scene &scene, const vertex_buffer &projected,
+                         std::vector<std::vector<m3::vec3>> &faces) {
+    float near_distance = pipeline_options{}.near_distance;
+    faces.clear();
+    for (size_t i = 0; i < scene.objects.size; ++i) {
+        if (!projected.visible[i])
+            continue;
+
+        const object &object = scene.objects[i];
+        size_t offset = projected.offsets[i];
+        for (auto &face : object.faces) {
+            const vertex_index *indices =
+                object.indices.data + face.first_index;
+            std::vector<m3::vec3> vertices;
+            for (size_t j = 0; j < face.vertices_count; ++j) {
+                size_t index = offset + indices[j];
+                if (-projected.w[index] < near_distance)
+                    break;
+                vertices.push_back(projected.at(index));
+            }
+            if (vertices.size() == face.vertices_count)
+                faces.push_back(std::move(vertices));
+        }
+    }
+}
+
+static bool run_scene(const std::string &name, const std::string &path,
+                      const benchmark_options &options,
+                      std::vector<benchmark_result> &results) {
+    scene_storage storage;
+    scene scene;
+    std::ifstream ifs(path, std::ios::in);
+    if (!ifs.is_open() || !load_scene(ifs, storage, scene)) {
+        std::cout << "failed to load scene " << path << std::endl;
+        return false;
+    }
+
+    vertex_buffer projected;
+    shading_cache shading;
+    face_scratch scratch;
+    polygon_store polygons;
+    std::vector<polygon_index> indices;
+    std::vector<uint16_t> pixels;
+    std::vector<std::vector<m3::vec3>> faces;
+    std::vector<sink_write> writes;
+    for (auto [width, height] : options.sizes) {
+        pixels.resize(static_cast<size_t>(width) * height);
+        rgb565_sink sink = {pixels.data(), width, height};
+        null_sink discard;
+        window screen = {{static_cast<int16_t>(-width / 2),
+                          static_cast<int16_t>(-height / 2)},
+                         {static_cast<int16_t>(width / 2),
+                          static_cast<int16_t>(height / 2)}};
+
+        for (size_t i = 0; i < options.angles; ++i) {
+            float angle = 360.0f * static_cast<float>(i) /
+                          static_cast<float>(options.angles);
+            m3::mat4 transform = orbit_transform(scene, angle);
+
+            stage_times times;
+            times.transform = fastest_ms(options.repeats, [&] {
+                project_scene(scene, transform, screen, projected);
+            });
+            times.shading = fastest_ms(options.repeats, [&] {
+                shading.invalidate();
+                update_shading(scene, shading);
+            });
+            // the cache is valid, so this is scene_to_polygons without the
+            // shading: clipping, plane fits, fan splits and polygon rings
+            bool built = true;
+            times.polygons = fastest_ms(options.repeats, [&] {
+                built &= scene_to_polygons(scene, projected, shading,
+                                           scratch, polygons);
+            });
+            if (!built) {
+                std::cout << "failed to preprocess objects of " << path
+                          << std::endl;
+                return false;
+            }
+
+            gather_faces(scene, projected, faces);
+            times.plane_fitting = fastest_ms(options.repeats, [&] {
+                plane plane;
+                for (auto &face : faces)
+                    compute_plane_equation(face, plane);
+            });
+
+            times.classification =
+                render_ms(options.repeats, discard, polygons, screen, indices);
+
+            writes.clear();
+            recording_sink recorder = {&writes};
+            render_ms(1, recorder, polygons, screen, indices);
+            times.fill = fastest_ms(options.repeats,
+                                    [&] { replay_writes(sink, writes); });
+
+            times.render =
+                render_ms(options.repeats, sink, polygons, screen, indices);
+
+            results.push_back(
+                {name, width, height, angle, polygons.size(), times});
+            std::cerr << name << " " << width << "x" << height << " " << angle
+                      << " " << times.render << " ms" << std::endl;
+        }
+    }
+
+    return true;
+}
+
+static std::string json_string(const std::string &text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+            quoted += c;
+    }
+
+    return quoted + "\"";
+}
+
+static void write_json(std::ostream &out, const benchmark_options &options,
+                       const std::vector<benchmark_result> &results) {
+    out << "{\n"
+        << "  \"label\": " << json_string(options.label) << ",\n"
+        << "  \"compiler\": " << json_string(__VERSION__) << ",\n"
+        << "  \"repeats\": " << options.repeats << ",\n"
+        << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const benchmark_result &result = results[i];
+        const stage_times &times = result.times;
+        double total =
+            times.transform + times.shading + times.polygons + times.render;
+        out << (i == 0 ? "\n" : ",\n") << "    {\"scene\": "
+            << json_string(result.scene) << ", \"width\": " << result.width
+            << ", \"height\": " << result.height
+            << ", \"angle\": " << result.angle
+            << ", \"polygons\": " << result.polygons
+            << ", \"transform_ms\": " << times.transform
+            << ", \"shading_ms\": " << times.shading
+            << ", \"polygons_ms\": " << times.polygons
+            << ", \"plane_fitting_ms\": " << times.plane_fitting
+            << ", \"classification_ms\": " << times.classification
+            << ", \"fill_ms\": " << times.fill
+            << ", \"render_ms\": " << times.render
+            << ", \"total_ms\": " << total
+            << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+int main(int argc, char **argv) {
+    benchmark_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return -1;
+    }
+
+    // sorted, so runs of different commits line up
+    std::vector<std::filesystem::path> paths;
+    std::error_code error;
+    for (auto &entry :
+         std::filesystem::directory_iterator(options.scenes, error)) {
+        if (entry.path().extension() == ".scene")
+            paths.push_back(entry.path());
+    }
+    if (error || paths.empty()) {
+        std::cout << "no scenes found in " << options.scenes << std::endl;
+        return -1;
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<benchmark_result> results;
+    for (auto &path : paths) {
+        if (!run_scene(path.stem().string(), path.string(), options, results))
+            return -1;
+    }
+
+    if (options.output.empty()) {
+        write_json(std::cout, options, results);
+        return 0;
+    }
+
+    std::ofstream ofs(options.output);
+    write_json(ofs, options, results);
+    if (!ofs.good()) {
+        std::cout << "failed to write " << options.output << std::endl;
+        return -1;
+    }
+
+    return 0;
+}
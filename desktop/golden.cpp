@@ -0,0 +1,347 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "binning.h"
+#include "common.h"
+#include "depth.h"
+#include "loader.h"
+#include "math3d.h"
+#include "offline.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "render.h"
+
+// Golden image check of the renderer. Every scene of a directory is rendered
+// at fixed camera poses through the serial warnock_render, the reference, and
+// through the alternative paths, which must produce the same frames. With
+// --references the reference frames are also compared with frames stored by
+// an earlier run with --update, so changes of the pipeline are caught too. A
+// frame passes if at most --budget pixels differ, failed frames are dumped
+// with a diff image, red where pixels differ. golden_scalar is the same check
+// built with the scalar depth kernels, run against references of golden it
+// checks them against the SSE2 ones.
+
+struct golden_options {
+    std::string scenes = "models";
+    int16_t width = 240;
+    int16_t height = 240;
+    size_t angles = 8;
+    size_t budget = 0;
+    std::string references;
+    bool update = false;
+    std::string diffs = ".";
+};
+
+// a frame to compare: the frame buffer and its window
+struct frame {
+    std::vector<uint16_t> pixels;
+    int16_t width;
+    int16_t height;
+
+    window screen() const {
+        return {{static_cast<int16_t>(-width / 2),
+                 static_cast<int16_t>(-height / 2)},
+                {static_cast<int16_t>(width / 2),
+                 static_cast<int16_t>(height / 2)}};
+    }
+};
+
+static void render_serial(const polygon_store &polygons, frame &frame) {
+    std::vector<polygon_index> indices(polygons.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    window screen = frame.screen();
+    rgb565_sink sink = {frame.pixels.data(), frame.width, frame.height};
+    warnock_render(sink, polygons.view(),
+                   {screen.begin, screen.end, {indices.data(), indices.size()}},
+                   WHITE);
+}
+
+// more threads than cores still exercises the work stealing
+static void render_parallel(const polygon_store &polygons, frame &frame) {
+    std::vector<polygon_index> indices(polygons.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    window screen = frame.screen();
+    rgb565_sink sink = {frame.pixels.data(), frame.width, frame.height};
+    warnock_render_parallel(
+        sink, polygons.view(),
+        {screen.begin, screen.end, {indices.data(), indices.size()}}, WHITE, 4);
+}
+
+// the path of the Pico: binned tiles rendered into a tile buffer and copied
+// to the screen
+static void render_binned(const polygon_store &polygons, frame &frame) {
+    int16_t tile_width = std::max<int16_t>(1, frame.width / 3);
+    int16_t tile_height = std::max<int16_t>(1, frame.height / 2);
+    tile_bins bins;
+    // a frame the bins do not fit is left unwritten and fails
+    if (!bin_polygons(polygons.view(), frame.screen(), tile_width,
+                      tile_height, bins)) {
+        std::cout << "too many polygons to bin" << std::endl;
+        return;
+    }
+
+    std::vector<uint16_t> tile(static_cast<size_t>(tile_width) * tile_height);
+    for (size_t i = 0; i < bins.size(); ++i) {
+        window window = bins.tile(i);
+        tile_sink sink = {tile.data(), window.begin, tile_width};
+        warnock_render(sink, polygons.view(), window, WHITE);
+
+        for (int16_t y = window.begin.y; y < window.end.y; ++y) {
+            uint16_t *row = frame.pixels.data() +
+                            (y + frame.height / 2) * frame.width +
+                            (window.begin.x + frame.width / 2);
+            std::copy_n(sink.at({window.begin.x, y}),
+                        window.end.x - window.begin.x, row);
+        }
+    }
+}
+
+struct variant {
+    const char *name;
+    void (*render)(const polygon_store &polygons, frame &frame);
+};
+
+static const variant variants[] = {{"parallel", render_parallel},
+                                   {"binned", render_binned}};
+
+static void print_usage() {
+    std::cout << "usage: golden [options]\n"
+                 "  --scenes DIR       directory of the .scene files, models "
+                 "by default\n"
+                 "  --size WxH         frame size, 240x240 by default\n"
+                 "  --angles N         camera poses of the orbit, 8 by "
+                 "default\n"
+                 "  --budget N         pixels allowed to differ per frame, 0 "
+                 "by default\n"
+                 "  --references DIR   reference frames of an earlier run\n"
+                 "  --update           write the reference frames instead of "
+                 "comparing them\n"
+                 "  --diffs DIR        directory of the failed frames, . by "
+                 "default\n";
+}
+
+static bool parse_options(int argc, char **argv, golden_options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            options.update = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cout << "missing value of " << arg << std::endl;
+            return false;
+        }
+
+        const char *value = argv[++i];
+        if (arg == "--scenes") {
+            options.scenes = value;
+        } else if (arg == "--size") {
+            int width, height;
+            if (sscanf(value, "%dx%d", &width, &height) != 2 || width < 2 ||
+                height < 2 || width > GUARD_BAND || height > GUARD_BAND) {
+                std::cout << "invalid size " << value << std::endl;
+                return false;
+            }
+            // windows are centered on the screen, sizes are kept even
+            options.width = static_cast<int16_t>(width & ~1);
+            options.height = static_cast<int16_t>(height & ~1);
+        } else if (arg == "--angles" || arg == "--budget") {
+            char *end;
+            unsigned long count = strtoul(value, &end, 10);
+            if (end == value || *end != '\0') {
+                std::cout << "invalid number " << value << std::endl;
+                return false;
+            }
+            (arg == "--angles" ? options.angles : options.budget) = count;
+        } else if (arg == "--references") {
+            options.references = value;
+        } else if (arg == "--diffs") {
+            options.diffs = value;
+        } else {
+            std::cout << "unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (options.update && options.references.empty()) {
+        std::cout << "--update needs --references" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// a color the reference frame does not use. Frames are cleared to it before
+// they are rendered or read, so pixels left unwritten always differ.
+static uint16_t unused_color(const frame &reference) {
+    std::vector<bool> used(1 << 16);
+    for (uint16_t pixel : reference.pixels)
+        used[pixel] = true;
+
+    uint16_t color = MAGENTA;
+    for (size_t i = 0; i < used.size() && used[color]; ++i)
+        ++color;
+    return color;
+}
+
+static size_t count_differences(const frame &expected, const frame &actual) {
+    size_t differences = 0;
+    for (size_t i = 0; i < expected.pixels.size(); ++i)
+        differences += expected.pixels[i] != actual.pixels[i];
+    return differences;
+}
+
+// differing pixels are red, the others a dimmed copy of the expected frame
+static bool write_diff(const std::string &path, const frame &expected,
+                       const frame &actual) {
+    std::vector<uint16_t> diff(expected.pixels.size());
+    for (size_t i = 0; i < diff.size(); ++i) {
+        if (expected.pixels[i] != actual.pixels[i]) {
+            diff[i] = RED;
+            continue;
+        }
+
+        color color = rgb565_to_rgb(expected.pixels[i]);
+        diff[i] = rgb_to_rgb565({static_cast<uint8_t>(color.r / 4 + 96),
+                                 static_cast<uint8_t>(color.g / 4 + 96),
+                                 static_cast<uint8_t>(color.b / 4 + 96)});
+    }
+
+    return write_ppm(path, diff.data(), expected.width, expected.height);
+}
+
+// compares the frame with the expected one, a failed frame is dumped next to
+// the expected frame and the diff
+static bool check_frame(const std::string &name, const frame &expected,
+                        const frame &actual, const golden_options &options) {
+    size_t differences = count_differences(expected, actual);
+    bool passed = differences <= options.budget;
+    std::cout << (passed ? "ok     " : "FAILED ") << name << ": "
+              << differences << " pixels differ" << std::endl;
+    if (passed)
+        return true;
+
+    std::string prefix = options.diffs + "/" + name;
+    if (!write_ppm(prefix + "_expected.ppm", expected.pixels.data(),
+                   expected.width, expected.height) ||
+        !write_ppm(prefix + "_actual.ppm", actual.pixels.data(), actual.width,
+                   actual.height) ||
+        !write_diff(prefix + "_diff.ppm", expected, actual))
+        std::cout << "failed to dump " << prefix << std::endl;
+
+    return false;
+}
+
+// number of failed frames of the scene, or -1 if it could not be checked
+static int check_scene(const std::string &name, const std::string &path,
+                       const golden_options &options) {
+    scene_storage storage;
+    scene scene;
+    std::ifstream ifs(path, std::ios::in);
+    if (!ifs.is_open() || !load_scene(ifs, storage, scene)) {
+        std::cout << "failed to load scene " << path << std::endl;
+        return -1;
+    }
+
+    frame reference = {{}, options.width, options.height};
+    reference.pixels.resize(static_cast<size_t>(options.width) *
+                            options.height);
+    frame actual = reference;
+
+    vertex_buffer projected;
+    shading_cache shading;
+    face_scratch scratch;
+    polygon_store polygons;
+    int failed = 0;
+    for (size_t i = 0; i < options.angles; ++i) {
+        int angle = static_cast<int>(360 * i / options.angles);
+        project_scene(scene, orbit_transform(scene, static_cast<float>(angle)),
+                      reference.screen(), projected);
+        if (!scene_to_polygons(scene, projected, shading, scratch, polygons)) {
+            std::cout << "failed to preprocess objects of " << path
+                      << std::endl;
+            return -1;
+        }
+
+        char pose[64];
+        snprintf(pose, sizeof(pose), "%s_%dx%d_%d", name.c_str(),
+                 options.width, options.height, angle);
+        render_serial(polygons, reference);
+        uint16_t sentinel = unused_color(reference);
+
+        if (!options.references.empty()) {
+            std::fill(actual.pixels.begin(), actual.pixels.end(), sentinel);
+            std::string stored = options.references + "/" + pose + ".rgb565";
+            if (options.update) {
+                if (!write_rgb565(stored, reference.pixels.data(),
+                                  reference.width, reference.height)) {
+                    std::cout << "failed to write " << stored << std::endl;
+                    return -1;
+                }
+            } else if (!read_rgb565(stored, actual.pixels.data(),
+                                    actual.width, actual.height)) {
+                std::cout << "FAILED " << pose << ": no reference " << stored
+                          << std::endl;
+                ++failed;
+            } else {
+                failed += !check_frame(std::string(pose) + "_stored", actual,
+                                       reference, options);
+            }
+        }
+
+        for (auto &variant : variants) {
+            std::fill(actual.pixels.begin(), actual.pixels.end(), sentinel);
+            variant.render(polygons, actual);
+            failed += !check_frame(std::string(pose) + "_" + variant.name,
+                                   reference, actual, options);
+        }
+    }
+
+    return failed;
+}
+
+int main(int argc, char **argv) {
+    golden_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return -1;
+    }
+
+    std::vector<std::filesystem::path> paths;
+    std::error_code error;
+    for (auto &entry :
+         std::filesystem::directory_iterator(options.scenes, error)) {
+        if (entry.path().extension() == ".scene")
+            paths.push_back(entry.path());
+    }
+    if (error || paths.empty()) {
+        std::cout << "no scenes found in " << options.scenes << std::endl;
+        return -1;
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::cout << "depth kernels: " << DEPTH_KERNELS << std::endl;
+    int failed = 0;
+    for (auto &path : paths) {
+        int scene_failed =
+            check_scene(path.stem().string(), path.string(), options);
+        if (scene_failed < 0)
+            return -1;
+        failed += scene_failed;
+    }
+
+    if (failed != 0) {
+        std::cout << failed << " frames failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "all frames passed" << std::endl;
+    return 0;
+}
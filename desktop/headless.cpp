@@ -0,0 +1,255 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common.h"
+#include "debug.h"
+#include "loader.h"
+#include "math3d.h"
+#include "offline.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "render.h"
+
+// Renders a scene without a display: the camera orbits the target by step
+// degrees per frame, frames are written as PPM or raw rgb565 files or
+// dropped, and the timings of every frame are printed.
+
+enum class frame_format { none, ppm, rgb565 };
+
+struct headless_options {
+    std::string scene_path;
+    int16_t width = 240;
+    int16_t height = 240;
+    size_t frames = 8;
+    float step = 45;
+    size_t threads = 1;
+    frame_format format = frame_format::none;
+    std::string output = ".";
+    bool cull_back_faces = false;
+    bool stats = false;
+};
+
+static void print_usage() {
+    std::cout
+        << "usage: headless <scene> [options]\n"
+           "  --size WxH        frame size, 240x240 by default\n"
+           "  --frames N        frames of the camera orbit, 8 by default\n"
+           "  --step DEGREES    camera turn between frames, 45 by default\n"
+           "  --threads N       render threads, 1 by default\n"
+           "  --format FORMAT   none, ppm or rgb565, frames are dropped by "
+           "default\n"
+           "  --output DIR      directory of the frames, . by default\n"
+           "  --cull            drop the faces turned away from the camera\n"
+           "  --stats           print the Warnock counters of every frame, "
+           "needs\n"
+           "                    a WARNOCK_STATS build and one thread\n";
+}
+
+static bool parse_size(const char *text, int16_t &width, int16_t &height) {
+    int w, h;
+    if (sscanf(text, "%dx%d", &w, &h) != 2 || w <= 0 || h <= 0 ||
+        w > GUARD_BAND || h > GUARD_BAND)
+        return false;
+
+    // windows are centered on the screen, odd sizes would lose a column
+    width = static_cast<int16_t>(w & ~1);
+    height = static_cast<int16_t>(h & ~1);
+    return width != 0 && height != 0;
+}
+
+static bool parse_count(const char *text, size_t &value) {
+    char *end;
+    unsigned long count = strtoul(text, &end, 10);
+    if (end == text || *end != '\0')
+        return false;
+
+    value = count;
+    return true;
+}
+
+static bool takes_value(const std::string &arg) {
+    return arg == "--size" || arg == "--frames" || arg == "--threads" ||
+           arg == "--step" || arg == "--format" || arg == "--output";
+}
+
+static bool parse_options(int argc, char **argv,
+                          headless_options &options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        } else if (arg == "--cull") {
+            options.cull_back_faces = true;
+        } else if (arg == "--stats") {
+            options.stats = true;
+        } else if (arg.rfind("--", 0) != 0) {
+            if (!options.scene_path.empty())
+                return false;
+            options.scene_path = arg;
+        } else if (takes_value(arg) && i + 1 >= argc) {
+            std::cout << "missing value of " << arg << std::endl;
+            return false;
+        } else if (arg == "--size") {
+            if (!parse_size(argv[++i], options.width, options.height)) {
+                std::cout << "invalid size " << argv[i] << std::endl;
+                return false;
+            }
+        } else if (arg == "--frames" || arg == "--threads") {
+            size_t &count =
+                arg == "--frames" ? options.frames : options.threads;
+            if (!parse_count(argv[++i], count)) {
+                std::cout << "invalid number " << argv[i] << std::endl;
+                return false;
+            }
+        } else if (arg == "--step") {
+            char *end;
+            options.step = strtof(argv[++i], &end);
+            if (end == argv[i] || *end != '\0') {
+                std::cout << "invalid angle " << argv[i] << std::endl;
+                return false;
+            }
+        } else if (arg == "--format") {
+            std::string format = argv[++i];
+            if (format == "none") {
+                options.format = frame_format::none;
+            } else if (format == "ppm") {
+                options.format = frame_format::ppm;
+            } else if (format == "rgb565") {
+                options.format = frame_format::rgb565;
+            } else {
+                std::cout << "unknown format " << format << std::endl;
+                return false;
+            }
+        } else if (arg == "--output") {
+            options.output = argv[++i];
+        } else {
+            std::cout << "unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+
+#ifndef WARNOCK_STATS
+    if (options.stats) {
+        std::cout << "built without WARNOCK_STATS" << std::endl;
+        return false;
+    }
+#endif
+    if (options.stats && options.threads >= 2) {
+        std::cout << "--stats counts the serial renderer only" << std::endl;
+        return false;
+    }
+
+    return !options.scene_path.empty();
+}
+
+static double to_ms(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+int main(int argc, char **argv) {
+    headless_options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage();
+        return -1;
+    }
+
+    scene_storage storage;
+    scene scene;
+    std::ifstream ifs(options.scene_path, std::ios::in);
+    if (!ifs.is_open()) {
+        std::cout << "failed to open scene file " << options.scene_path
+                  << std::endl;
+        return -1;
+    }
+
+    if (!load_scene(ifs, storage, scene)) {
+        std::cout << "failed to load scene " << options.scene_path
+                  << std::endl;
+        return -1;
+    }
+
+    int16_t width = options.width, height = options.height;
+    std::vector<uint16_t> pixels(static_cast<size_t>(width) * height);
+    rgb565_sink sink = {pixels.data(), width, height};
+    window screen = {{static_cast<int16_t>(-width / 2),
+                      static_cast<int16_t>(-height / 2)},
+                     {static_cast<int16_t>(width / 2),
+                      static_cast<int16_t>(height / 2)}};
+
+    vertex_buffer projected;
+    shading_cache shading;
+    face_scratch scratch;
+    polygon_store polygons;
+    pipeline_options pipeline;
+    pipeline.cull_back_faces = options.cull_back_faces;
+    std::vector<polygon_index> indices;
+
+    std::cout << "frame,angle,polygons,project_ms,polygons_ms,render_ms,"
+                 "total_ms"
+              << std::endl;
+    for (size_t frame = 0; frame < options.frames; ++frame) {
+        float angle = options.step * static_cast<float>(frame);
+
+        auto begin = std::chrono::steady_clock::now();
+        project_scene(scene, orbit_transform(scene, angle), screen, projected);
+        auto projected_time = std::chrono::steady_clock::now();
+        if (!scene_to_polygons(scene, projected, shading, scratch,
+                               polygons, pipeline)) {
+            std::cout << "failed to preprocess objects" << std::endl;
+            return -1;
+        }
+        auto polygons_time = std::chrono::steady_clock::now();
+
+        // the serial renderer reorders the index list, so it is reset
+        // every frame
+        indices.resize(polygons.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        window window = {screen.begin, screen.end,
+                         {indices.data(), indices.size()}};
+        if (options.threads >= 2)
+            warnock_render_parallel(sink, polygons.view(), window, WHITE,
+                                    options.threads);
+        else
+            warnock_render(sink, polygons.view(), window, WHITE);
+        auto end = std::chrono::steady_clock::now();
+
+        std::cout << frame << "," << angle << "," << polygons.size() << ","
+                  << to_ms(projected_time - begin) << ","
+                  << to_ms(polygons_time - projected_time) << ","
+                  << to_ms(end - polygons_time) << "," << to_ms(end - begin)
+                  << std::endl;
+
+#ifdef WARNOCK_STATS
+        if (options.stats) {
+            std::cout << get_warnock_stats() << std::endl;
+            reset_warnock_stats();
+        }
+#endif
+
+        if (options.format == frame_format::none)
+            continue;
+
+        std::string number = std::to_string(frame);
+        std::string path =
+            options.output + "/frame_" +
+            std::string(number.size() < 4 ? 4 - number.size() : 0, '0') +
+            number +
+            (options.format == frame_format::ppm ? ".ppm" : ".rgb565");
+        bool written = options.format == frame_format::ppm
+                           ? write_ppm(path, pixels.data(), width, height)
+                           : write_rgb565(path, pixels.data(), width, height);
+        if (!written) {
+            std::cout << "failed to write frame " << path << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
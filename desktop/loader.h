@@ -8,9 +8,5 @@
 #include <map>
 #include <vector>
 
-bool load_materials(std::ifstream &ifs, std::vector<material> &materials,
-                    std::map<std::string, size_t> &material_names);
-bool load_objects(std::ifstream &ifs,
-                  const std::map<std::string, size_t> &material_names,
-                  std::vector<object> &objects);
-bool load_scene(std::ifstream &ifs, scene &scene);
+// the scene references the data parsed into the storage
+bool load_scene(std::ifstream &ifs, scene_storage &storage, scene &scene);
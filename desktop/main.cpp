@@ -2,11 +2,15 @@
 #include <chrono>
 #include <fstream>
 #include <map>
+#include <numeric>
+#include <thread>
 
 #include "common.h"
 #include "debug.h"
 #include "loader.h"
 #include "math3d.h"
+#include "offline.h"
+#include "parallel.h"
 #include "pipeline.h"
 #include "render.h"
 #include "display.h"
@@ -16,27 +20,10 @@ struct display {
     int16_t height;
 };
 
-static uint32_t sdl_color_to_uint32(SDL_Color color) {
-    uint32_t num = color.r;
-    num |= (color.g << 8);
-    num |= (color.b << 16);
-    num |= (color.a << 24);
-
-    return num;
-}
-
-static uint32_t *pixels;
-
-static void set_pixel(display_t *display, point2 point, uint16_t rgb565_color) {
-    color rgb_color = rgb565_to_rgb(rgb565_color);
-    SDL_Color sdl_color = {rgb_color.r, rgb_color.g, rgb_color.b, 255};
-    pixels[(point.y + display->height / 2) * display->width +
-           (point.x + display->width / 2)] = sdl_color_to_uint32(sdl_color);
-}
-
 int main() {
     display_t display = {1080, 720};
 
+    scene_storage storage;
     scene scene;
     std::string scene_path = "models/sphere.scene";
     std::ifstream ifs(scene_path, std::ios::in);
@@ -45,7 +32,7 @@ int main() {
         return -1;
     }
 
-    if (!load_scene(ifs, scene)) {
+    if (!load_scene(ifs, storage, scene)) {
         std::cout << "failed to load scene " << scene_path << std::endl;
         return -1;
     }
@@ -82,16 +69,30 @@ int main() {
         return -1;
     }
 
-    pixels = new uint32_t[display.height * display.width];
+    auto *pixels = new uint32_t[display.height * display.width];
+    abgr8888_sink sink = {pixels, display.width, display.height};
 
-    size_t polygons_size = 0;
-    for (auto &object : scene.objects)
-        polygons_size += object.faces.size();
+    size_t polygons_size = count_polygons(scene);
 
-    array<polygon> polygons = {new polygon[polygons_size], polygons_size};
+    vertex_buffer projected;
+    // the scene is loaded once, before the cache exists, a reload would
+    // have to invalidate it
+    shading_cache shading;
+    face_scratch scratch;
+    polygon_store polygons;
+    std::vector<polygon_index> indices;
     std::cout << "polygons count = " << polygons_size << std::endl;
 
+    struct window screen = {{static_cast<short>(-display.width / 2),
+                             static_cast<short>(-display.height / 2)},
+                            {static_cast<short>(display.width / 2),
+                             static_cast<short>(display.height / 2)}};
+
     float angle = 0;
+    pipeline_options options;
+    pipeline_stats stats{};
+    bool report_stats = false;
+    bool dump_warnock_stats = false;
 
     bool quit = false;
     while (!quit) {
@@ -111,56 +112,72 @@ int main() {
                 case SDLK_UP:
                     angle += 0.5;
                     break;
+                case SDLK_c:
+                    options.cull_back_faces = !options.cull_back_faces;
+                    report_stats = true;
+                    break;
+                case SDLK_s:
+                    dump_warnock_stats = true;
+                    break;
                 }
             }
         }
 
         auto begin = std::chrono::steady_clock::now();
 
-        m3::mat4 camara_rotate =
-            m3::rotate_y(m3::deg2rad(angle)) * m3::rotate_x(m3::deg2rad(angle));
-        m3::mat4 scale = m3::scale({2000, 2000, 2000});
-        m3::mat4 view = m3::look_at(
-            m3::transform_vector(camara_rotate, scene.camera.position),
-            scene.camera.target,
-            m3::transform_vector(camara_rotate, scene.camera.up));
-        m3::mat4 perspective = m3::perspective(80, 1, 1.1f, 10.0f);
-        m3::mat4 transform = scale * perspective * view;
-
-        for (auto &object : scene.objects) {
-            for (auto &vertice : object.vertices) {
-                vertice = m3::transform_vector(transform, vertice);
-            }
-        }
+        m3::mat4 transform = orbit_transform(scene, angle);
 
-        if (!scene_to_polygons(scene, polygons)) {
+        project_scene(scene, transform, screen, projected);
+        if (!scene_to_polygons(scene, projected, shading, scratch, polygons,
+                               options, &stats)) {
             printf("failed to preprocess objects\n");
             return -1;
         }
 
-        transform = m3::inverse(transform);
-        for (auto &object : scene.objects) {
-            for (auto &vertice : object.vertices) {
-                vertice = m3::transform_vector(transform, vertice);
-            }
+        if (report_stats) {
+            std::cout << "back-face culling "
+                      << (options.cull_back_faces ? "on" : "off")
+                      << ", culled objects = " << stats.culled_objects
+                      << ", culled faces = " << stats.culled_faces
+                      << ", clipped faces = " << stats.clipped_faces
+                      << std::endl;
+            report_stats = false;
         }
 
         auto end = std::chrono::steady_clock::now();
 
-        warnock_render(&display,
-                       {{static_cast<short>(-display.width / 2),
-                         static_cast<short>(-display.height / 2)},
-                        {static_cast<short>(display.width / 2),
-                         static_cast<short>(display.height / 2)},
-                        polygons},
-                       WHITE, set_pixel);
+        // the count changes with culling and clipping, and the serial
+        // stats pass reorders the list, so it is reset every frame
+        indices.resize(polygons.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        warnock_render_parallel(
+            sink, polygons.view(),
+            {screen.begin, screen.end, {indices.data(), indices.size()}},
+            WHITE, std::thread::hardware_concurrency());
+
+        if (dump_warnock_stats) {
+#ifdef WARNOCK_STATS
+            // the parallel renderer does not count, the frame is classified
+            // once more by the serial one
+            null_sink discard;
+            reset_warnock_stats();
+            warnock_render(
+                discard, polygons.view(),
+                {screen.begin, screen.end, {indices.data(), indices.size()}},
+                WHITE);
+            std::cout << get_warnock_stats() << std::endl;
+#else
+            std::cout << "built without WARNOCK_STATS" << std::endl;
+#endif
+            dump_warnock_stats = false;
+        }
 
         SDL_UpdateTexture(texture, nullptr, pixels, display.width * 4);
         SDL_RenderCopy(renderer, texture, nullptr, nullptr);
         SDL_RenderPresent(renderer);
     }
 
-    delete[] polygons.data;
     delete[] pixels;
     SDL_DestroyWindow(window);
     SDL_Quit();
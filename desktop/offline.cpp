@@ -0,0 +1,60 @@
+#include "offline.h"
+#include "color.h"
+
+#include <fstream>
+#include <vector>
+
+m3::mat4 orbit_transform(const scene &scene, float angle) {
+    m3::mat4 camera_rotate =
+        m3::rotate_y(m3::deg2rad(angle)) * m3::rotate_x(m3::deg2rad(angle));
+    m3::mat4 scale = m3::scale({2000, 2000, 2000});
+    m3::mat4 view =
+        m3::look_at(m3::transform_vector(camera_rotate, scene.camera.position),
+                    scene.camera.target,
+                    m3::transform_vector(camera_rotate, scene.camera.up));
+    m3::mat4 perspective = m3::perspective(80, 1, 1.1f, 10.0f);
+    return scale * perspective * view;
+}
+
+bool write_ppm(const std::string &path, const uint16_t *pixels, int16_t width,
+               int16_t height) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open())
+        return false;
+
+    std::vector<uint8_t> rgb(static_cast<size_t>(width) * height * 3);
+    for (size_t i = 0; i < static_cast<size_t>(width) * height; ++i) {
+        color color = rgb565_to_rgb(pixels[i]);
+        rgb[i * 3] = color.r;
+        rgb[i * 3 + 1] = color.g;
+        rgb[i * 3 + 2] = color.b;
+    }
+
+    ofs << "P6\n" << width << " " << height << "\n255\n";
+    ofs.write(reinterpret_cast<const char *>(rgb.data()), rgb.size());
+    return ofs.good();
+}
+
+bool write_rgb565(const std::string &path, const uint16_t *pixels,
+                  int16_t width, int16_t height) {
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs.is_open())
+        return false;
+
+    ofs.write(reinterpret_cast<const char *>(pixels),
+              static_cast<std::streamsize>(width) * height * sizeof(uint16_t));
+    return ofs.good();
+}
+
+bool read_rgb565(const std::string &path, uint16_t *pixels, int16_t width,
+                 int16_t height) {
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    std::streamsize size =
+        static_cast<std::streamsize>(width) * height * sizeof(uint16_t);
+    if (!ifs.is_open() || ifs.tellg() != size)
+        return false;
+
+    ifs.seekg(0);
+    ifs.read(reinterpret_cast<char *>(pixels), size);
+    return ifs.good();
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "math3d.h"
+#include "scene.h"
+
+#include <cstdint>
+#include <string>
+
+// Helpers of the offline tools, which render without a display, the camera
+// and the projection are shared with the interactive build.
+
+// transform of the scene camera orbiting the target by angle degrees around
+// the x and y axes, the way the arrow key of the interactive build turns it
+m3::mat4 orbit_transform(const scene &scene, float angle);
+
+// writes a row-major rgb565 frame as a binary PPM or as the raw 16-bit
+// pixels in the host byte order
+bool write_ppm(const std::string &path, const uint16_t *pixels, int16_t width,
+               int16_t height);
+bool write_rgb565(const std::string &path, const uint16_t *pixels,
+                  int16_t width, int16_t height);
+
+// reads a frame written by write_rgb565, fails unless the file holds exactly
+// width * height pixels
+bool read_rgb565(const std::string &path, uint16_t *pixels, int16_t width,
+                 int16_t height);
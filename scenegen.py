@@ -1,15 +1,233 @@
 #!/usr/bin/env python3
 
+# Converts the scenes in models/ into src/dataset.cpp. Scenes are emitted as
+# constexpr tables the renderer uses in place from flash: vertices quantized
+# to 16 bits per axis with a per-object scale and offset, flat 16-bit face
+# indices, normals, material colors and object bounds. Every scene is checked
+# by is_valid at compile time. Bump DATASET_VERSION in src/loader.h together
+# with VERSION when the layout changes.
+
 import os
 import re
+import struct
+
+VERSION = 2
+INT16_MAX = 32767
+UINT16_MAX = 65535
 
 models_dir = "models"
 regex = re.compile('(.*scene)')
 
+
+def f32(value):
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def float_literal(value):
+    text = repr(f32(value))
+    if text in ('inf', '-inf', 'nan'):
+        raise ValueError(f'{text} in dataset')
+    return text + 'f'
+
+
+def vec3_literal(vec):
+    return '{' + ', '.join(float_literal(v) for v in vec) + '}'
+
+
+def lines_of(text):
+    for line in text.split('\n'):
+        tokens = line.split()
+        if len(tokens) != 0 and tokens[0][0] != '#':
+            yield tokens
+
+
+def parse_vec3(tokens):
+    if len(tokens) != 4:
+        raise ValueError(f'invalid line {" ".join(tokens)}')
+    return [f32(float(token)) for token in tokens[1:]]
+
+
+def parse_scene(text):
+    scene = {'lights': [], 'camera': [[0, 0, 0], [0, 0, 0], [0, 0, 0]]}
+    for tokens in lines_of(text):
+        if tokens[0] == 'o':
+            scene['obj'] = tokens[1]
+        elif tokens[0] == 'm':
+            scene['mtl'] = tokens[1]
+        elif tokens[0] == 'l':
+            scene['lights'].append(parse_vec3(tokens))
+        elif tokens[0] == 'cp':
+            scene['camera'][0] = parse_vec3(tokens)
+        elif tokens[0] == 'ct':
+            scene['camera'][1] = parse_vec3(tokens)
+        elif tokens[0] == 'cu':
+            scene['camera'][2] = parse_vec3(tokens)
+    return scene
+
+
+# the same rules as parse_materials: the color is Kd scaled by Ns
+def parse_materials(text):
+    materials = []
+    names = {}
+    name = None
+    kd = [0, 0, 0]
+    ns = 0
+    for tokens in lines_of(text):
+        if tokens[0] == 'newmtl':
+            if name is not None:
+                names[name] = len(materials)
+                materials.append([f32(c * ns) for c in kd])
+            name = tokens[1]
+        elif tokens[0] == 'Ns':
+            ns = f32(float(tokens[1]))
+        elif tokens[0] == 'Kd':
+            kd = parse_vec3(tokens)
+
+    if name is not None:
+        names[name] = len(materials)
+        materials.append([f32(c * ns) for c in kd])
+    return materials, names
+
+
+# the same rules as parse_objects: indices are relative to the object and
+# only v/vt/vn face vertices are taken
+def parse_objects(text, material_names):
+    objects = []
+    obj = None
+    material_index = 0
+    vertices_first = vertices_count = 0
+    normals_first = normals_count = 0
+    for tokens in lines_of(text):
+        if tokens[0] == 'o':
+            obj = {'vertices': [], 'normals': [], 'faces': [], 'indices': []}
+            objects.append(obj)
+            vertices_first = vertices_count
+            normals_first = normals_count
+        elif tokens[0] == 'v':
+            vertices_count += 1
+            if obj is not None:
+                obj['vertices'].append(parse_vec3(tokens))
+        elif tokens[0] == 'vn':
+            normals_count += 1
+            if obj is not None:
+                obj['normals'].append(parse_vec3(tokens))
+        elif tokens[0] == 'f' and len(tokens) >= 4 and obj is not None:
+            first_index = len(obj['indices'])
+            normal_index = 0
+            for token in tokens[1:]:
+                parts = token.split('/')
+                if len(parts) == 1:
+                    continue
+                if len(parts) != 3:
+                    raise ValueError(f'invalid face vertex {token}')
+                obj['indices'].append(int(parts[0]) - 1 - vertices_first)
+                normal_index = int(parts[2]) - 1 - normals_first
+            obj['faces'].append([first_index,
+                                 len(obj['indices']) - first_index,
+                                 material_index, normal_index])
+        elif tokens[0] == 'usemtl':
+            material_index = material_names[tokens[1]]
+    return objects
+
+
+# vertex = q * scale + offset, q spans [-INT16_MAX, INT16_MAX] on each axis
+def quantize(vertices):
+    scale = []
+    offset = []
+    for axis in range(3):
+        values = [v[axis] for v in vertices] or [0]
+        low, high = min(values), max(values)
+        offset.append(f32((low + high) / 2))
+        scale.append(f32((high - low) / (2 * INT16_MAX)) or 1.0)
+
+    quantized = []
+    for vertex in vertices:
+        q = [round((vertex[axis] - offset[axis]) / scale[axis])
+             for axis in range(3)]
+        quantized.append([max(-INT16_MAX, min(INT16_MAX, v)) for v in q])
+    return quantized, scale, offset
+
+
+# the same bounds as compute_bounds of the dequantized vertices, the box is
+# padded by a quantum and the radius rounded up, so float dequantization
+# never ends outside
+def bounds(quantized, scale, offset):
+    if len(quantized) == 0:
+        return [[0, 0, 0], [0, 0, 0], [0, 0, 0], 0]
+
+    vertices = [[q[axis] * scale[axis] + offset[axis] for axis in range(3)]
+                for q in quantized]
+    low = [min(v[axis] for v in vertices) - scale[axis] for axis in range(3)]
+    high = [max(v[axis] for v in vertices) + scale[axis] for axis in range(3)]
+    center = [f32((low[axis] + high[axis]) / 2) for axis in range(3)]
+    radius = max(sum((v[axis] - center[axis]) ** 2 for axis in range(3))
+                 for v in vertices) ** 0.5
+    radius += sum(s * s for s in scale) ** 0.5
+    return [low, high, center, radius]
+
+
+def bounds_literal(volume):
+    low, high, center, radius = volume
+    return (f'{{{vec3_literal(low)}, {vec3_literal(high)}, '
+            f'{vec3_literal(center)}, {float_literal(radius)}}}')
+
+
+def write_array(file, type, name, items):
+    if len(items) == 0:
+        return '{nullptr, 0}'
+
+    file.write(f'constexpr {type} {name}[] = {{\n')
+    for item in items:
+        file.write(f'    {item},\n')
+    file.write('};\n')
+    return f'{{{name}, {len(items)}}}'
+
+
+def write_scene(file, name, scene, materials, objects):
+    object_literals = []
+    for i, obj in enumerate(objects):
+        prefix = f'{name}_{i}'
+        for index in obj['indices']:
+            if not 0 <= index <= UINT16_MAX:
+                raise ValueError(f'{prefix}: vertex index {index} out of range')
+        if len(obj['normals']) > UINT16_MAX + 1:
+            raise ValueError(f'{prefix}: too many normals')
+
+        quantized, scale, offset = quantize(obj['vertices'])
+        vertices = write_array(file, 'quantized_vertex', f'{prefix}_vertices',
+                               ['{' + ', '.join(map(str, q)) + '}'
+                                for q in quantized])
+        normals = write_array(file, 'm3::vec3', f'{prefix}_normals',
+                              [vec3_literal(n) for n in obj['normals']])
+        faces = write_array(file, 'face', f'{prefix}_faces',
+                            ['{' + ', '.join(map(str, f)) + '}'
+                             for f in obj['faces']])
+        indices = write_array(file, 'vertex_index', f'{prefix}_indices',
+                              [str(index) for index in obj['indices']])
+        volume = bounds_literal(bounds(quantized, scale, offset))
+        object_literals.append(
+            f'{{{{nullptr, 0}}, {vertices}, {vec3_literal(scale)}, '
+            f'{vec3_literal(offset)}, {normals}, {faces}, {indices}, '
+            f'{volume}}}')
+
+    objects = write_array(file, 'object', f'{name}_objects', object_literals)
+    materials = write_array(file, 'material', f'{name}_materials',
+                            ['{' + vec3_literal(m) + '}' for m in materials])
+    lights = write_array(file, 'm3::vec3', f'{name}_lights',
+                         [vec3_literal(l) for l in scene['lights']])
+    camera = ', '.join(vec3_literal(v) for v in scene['camera'])
+    file.write(f'constexpr scene {name}_scene = '
+               f'{{{objects}, {materials}, {lights}, {{{camera}}}}};\n')
+    file.write(f'static_assert(is_valid({name}_scene));\n\n')
+    return f'{name}_scene'
+
+
 scenes = []
 names = []
+# sorted, so the generated files do not depend on the filesystem order
 for root, dirs, files in os.walk(models_dir):
-    for file in files:
+    dirs.sort()
+    for file in sorted(files):
         if regex.match(file):
             f = open(os.path.join("models", file), 'r')
             scenes.append(f.read())
@@ -23,46 +241,41 @@ h_file = open('src/dataset.h', 'w')
 
 h_declaration = '''#pragma once
 
+#include "scene.h"
+
+// generated by scenegen.py, the scene references const data in flash
 struct dataset {
+    uint32_t version;
     const char *name;
-    const char *scene;
-    const char *obj;
-    const char *mtl;
+    struct scene scene;
 };
 '''
 h_file.write(h_declaration)
 h_file.write(f'#define DATASETS_SIZE {len(scenes)}\n')
 h_file.write('extern const dataset datasets[];\n')
 
-cpp_file.write('#include \"dataset.h\"\n')
-cpp_file.write('const dataset datasets[] = {\n')
+cpp_file.write('#include \"dataset.h\"\n\n')
 
+datasets = []
 for i in range(len(scenes)):
-    scene = scenes[i]
+    scene = parse_scene(scenes[i])
     name = names[i]
 
-    lines = scene.split('\n')
-    obj_path = None
-    mtl_path = None
-    for line in lines:
-        line = line.strip()
-        if len(line) != 0:
-            if line[0] == 'o':
-                obj_path = line.split(' ')[1]
-            if line[0] == 'm':
-                mtl_path = line.split(' ')[1]
-
-    if obj_path is None or mtl_path is None:
+    if 'obj' not in scene or 'mtl' not in scene:
         print('.obj or .mtl files not found in scene description')
+        continue
 
-    obj_file = open(obj_path, 'r')
-    obj = obj_file.read()
-    obj_file.close()
-    mtl_file = open(mtl_path, 'r')
-    mtl = mtl_file.read()
+    mtl_file = open(scene['mtl'], 'r')
+    materials, material_names = parse_materials(mtl_file.read())
     mtl_file.close()
+    obj_file = open(scene['obj'], 'r')
+    objects = parse_objects(obj_file.read(), material_names)
+    obj_file.close()
 
-    cpp_file.write(f'{{.name = \"{name}\", .scene = R\"X({scene})X\",'
-                   f'.obj = R\"X({obj})X\", .mtl = R\"X({mtl})X\"}},')
+    scene_literal = write_scene(cpp_file, name, scene, materials, objects)
+    datasets.append(f'{{{VERSION}, \"{name}\", {scene_literal}}}')
 
+cpp_file.write('constexpr dataset datasets[] = {\n')
+for literal in datasets:
+    cpp_file.write(f'    {literal},\n')
 cpp_file.write('};\n')
@@ -1,10041 +1,17324 @@
 #include "dataset.h"
-const dataset datasets[] = {
-{.name = "cube", .scene = R"X(# path to .obj file
-o models/cube.obj
 
-# path to .mtl file
-m models/cube.mtl
+constexpr quantized_vertex cone_0_vertices[] = {
+    {0, -32767, -32767},
+    {6393, -32767, -32137},
+    {12539, -32767, -30273},
+    {18204, -32767, -27245},
+    {23170, -32767, -23170},
+    {27245, -32767, -18204},
+    {30273, -32767, -12539},
+    {32137, -32767, -6393},
+    {32767, -32767, 0},
+    {32137, -32767, 6393},
+    {30273, -32767, 12539},
+    {27245, -32767, 18204},
+    {23170, -32767, 23170},
+    {18204, -32767, 27245},
+    {12539, -32767, 30273},
+    {6393, -32767, 32137},
+    {0, -32767, 32767},
+    {-6393, -32767, 32137},
+    {-12539, -32767, 30273},
+    {-18204, -32767, 27245},
+    {-23170, -32767, 23170},
+    {-27245, -32767, 18204},
+    {-30273, -32767, 12539},
+    {-32137, -32767, 6393},
+    {-32767, -32767, 0},
+    {-32137, -32767, -6393},
+    {-30273, -32767, -12539},
+    {-27245, -32767, -18204},
+    {-23170, -32767, -23170},
+    {-18204, -32767, -27245},
+    {-12539, -32767, -30273},
+    {-6393, -32767, -32137},
+    {0, 32767, 0},
+};
+constexpr m3::vec3 cone_0_normals[] = {
+    {0.08780000358819962f, 0.445499986410141f, -0.890999972820282f},
+    {0.2599000036716461f, 0.445499986410141f, -0.8567000031471252f},
+    {0.421999990940094f, 0.445499986410141f, -0.7896000146865845f},
+    {0.5680000185966492f, 0.445499986410141f, -0.6920999884605408f},
+    {0.6920999884605408f, 0.445499986410141f, -0.5680000185966492f},
+    {0.7896000146865845f, 0.445499986410141f, -0.421999990940094f},
+    {0.8567000031471252f, 0.445499986410141f, -0.2599000036716461f},
+    {0.890999972820282f, 0.445499986410141f, -0.08780000358819962f},
+    {0.890999972820282f, 0.445499986410141f, 0.08780000358819962f},
+    {0.8567000031471252f, 0.445499986410141f, 0.2599000036716461f},
+    {0.7896000146865845f, 0.445499986410141f, 0.421999990940094f},
+    {0.6920999884605408f, 0.445499986410141f, 0.5680000185966492f},
+    {0.5680000185966492f, 0.445499986410141f, 0.6920999884605408f},
+    {0.421999990940094f, 0.445499986410141f, 0.7896000146865845f},
+    {0.2599000036716461f, 0.445499986410141f, 0.8567000031471252f},
+    {0.08780000358819962f, 0.445499986410141f, 0.890999972820282f},
+    {-0.08780000358819962f, 0.445499986410141f, 0.890999972820282f},
+    {-0.2599000036716461f, 0.445499986410141f, 0.8567000031471252f},
+    {-0.421999990940094f, 0.445499986410141f, 0.7896000146865845f},
+    {-0.5680000185966492f, 0.445499986410141f, 0.6920999884605408f},
+    {-0.6920999884605408f, 0.445499986410141f, 0.5680000185966492f},
+    {-0.7896000146865845f, 0.445499986410141f, 0.421999990940094f},
+    {-0.8567000031471252f, 0.445499986410141f, 0.2599000036716461f},
+    {-0.890999972820282f, 0.445499986410141f, 0.08780000358819962f},
+    {-0.890999972820282f, 0.445499986410141f, -0.08780000358819962f},
+    {-0.8567000031471252f, 0.445499986410141f, -0.2599000036716461f},
+    {-0.7896000146865845f, 0.445499986410141f, -0.421999990940094f},
+    {-0.6920999884605408f, 0.445499986410141f, -0.5680000185966492f},
+    {-0.5680000185966492f, 0.445499986410141f, -0.6920999884605408f},
+    {-0.421999990940094f, 0.445499986410141f, -0.7896000146865845f},
+    {-0.0f, -1.0f, -0.0f},
+    {-0.2599000036716461f, 0.445499986410141f, -0.8567000031471252f},
+    {-0.08780000358819962f, 0.445499986410141f, -0.890999972820282f},
+};
+constexpr face cone_0_faces[] = {
+    {0, 3, 0, 0},
+    {3, 3, 0, 1},
+    {6, 3, 0, 2},
+    {9, 3, 0, 3},
+    {12, 3, 0, 4},
+    {15, 3, 0, 5},
+    {18, 3, 0, 6},
+    {21, 3, 0, 7},
+    {24, 3, 0, 8},
+    {27, 3, 0, 9},
+    {30, 3, 0, 10},
+    {33, 3, 0, 11},
+    {36, 3, 0, 12},
+    {39, 3, 0, 13},
+    {42, 3, 0, 14},
+    {45, 3, 0, 15},
+    {48, 3, 0, 16},
+    {51, 3, 0, 17},
+    {54, 3, 0, 18},
+    {57, 3, 0, 19},
+    {60, 3, 0, 20},
+    {63, 3, 0, 21},
+    {66, 3, 0, 22},
+    {69, 3, 0, 23},
+    {72, 3, 0, 24},
+    {75, 3, 0, 25},
+    {78, 3, 0, 26},
+    {81, 3, 0, 27},
+    {84, 3, 0, 28},
+    {87, 3, 0, 29},
+    {90, 32, 0, 30},
+    {122, 3, 0, 31},
+    {125, 3, 0, 32},
+};
+constexpr vertex_index cone_0_indices[] = {
+    0,
+    32,
+    1,
+    1,
+    32,
+    2,
+    2,
+    32,
+    3,
+    3,
+    32,
+    4,
+    4,
+    32,
+    5,
+    5,
+    32,
+    6,
+    6,
+    32,
+    7,
+    7,
+    32,
+    8,
+    8,
+    32,
+    9,
+    9,
+    32,
+    10,
+    10,
+    32,
+    11,
+    11,
+    32,
+    12,
+    12,
+    32,
+    13,
+    13,
+    32,
+    14,
+    14,
+    32,
+    15,
+    15,
+    32,
+    16,
+    16,
+    32,
+    17,
+    17,
+    32,
+    18,
+    18,
+    32,
+    19,
+    19,
+    32,
+    20,
+    20,
+    32,
+    21,
+    21,
+    32,
+    22,
+    22,
+    32,
+    23,
+    23,
+    32,
+    24,
+    24,
+    32,
+    25,
+    25,
+    32,
+    26,
+    26,
+    32,
+    27,
+    27,
+    32,
+    28,
+    28,
+    32,
+    29,
+    29,
+    32,
+    30,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    10,
+    11,
+    12,
+    13,
+    14,
+    15,
+    16,
+    17,
+    18,
+    19,
+    20,
+    21,
+    22,
+    23,
+    24,
+    25,
+    26,
+    27,
+    28,
+    29,
+    30,
+    31,
+    30,
+    32,
+    31,
+    31,
+    32,
+    0,
+};
+constexpr object cone_objects[] = {
+    {{nullptr, 0}, {cone_0_vertices, 33}, {3.0518509447574615e-05f, 3.0518509447574615e-05f, 3.0518509447574615e-05f}, {0.0f, 0.6344269514083862f, 0.0f}, {cone_0_normals, 33}, {cone_0_faces, 33}, {cone_0_indices, 128}, {{-1.000030517578125f, -0.36560356616973877f, -1.000030517578125f}, {1.000030517578125f, 1.6344574689865112f, 1.000030517578125f}, {0.0f, 0.6344269514083862f, 0.0f}, 1.4142735004425049f}},
+};
+constexpr material cone_materials[] = {
+    {{200.0f, 165.41075134277344f, 27.953250885009766f}},
+};
+constexpr m3::vec3 cone_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+constexpr scene cone_scene = {{cone_objects, 1}, {cone_materials, 1}, {cone_lights, 3}, {{-10.0f, 10.0f, -35.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(cone_scene));
 
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
+constexpr quantized_vertex cube_0_vertices[] = {
+    {32767, 32767, -32767},
+    {32767, -32767, -32767},
+    {32767, 32767, 32767},
+    {32767, -32767, 32767},
+    {-32767, 32767, -32767},
+    {-32767, -32767, -32767},
+    {-32767, 32767, 32767},
+    {-32767, -32767, 32767},
+};
+constexpr m3::vec3 cube_0_normals[] = {
+    {-0.0f, 1.0f, -0.0f},
+    {-0.0f, -0.0f, 1.0f},
+    {-1.0f, -0.0f, -0.0f},
+    {-0.0f, -1.0f, -0.0f},
+    {1.0f, -0.0f, -0.0f},
+    {-0.0f, -0.0f, -1.0f},
+};
+constexpr face cube_0_faces[] = {
+    {0, 4, 0, 0},
+    {4, 4, 0, 1},
+    {8, 4, 0, 2},
+    {12, 4, 0, 3},
+    {16, 4, 0, 4},
+    {20, 4, 0, 5},
+};
+constexpr vertex_index cube_0_indices[] = {
+    0,
+    4,
+    6,
+    2,
+    3,
+    2,
+    6,
+    7,
+    7,
+    6,
+    4,
+    5,
+    5,
+    1,
+    3,
+    7,
+    1,
+    0,
+    2,
+    3,
+    5,
+    4,
+    0,
+    1,
+};
+constexpr quantized_vertex cube_1_vertices[] = {
+    {32767, 32767, -32767},
+    {32767, -32767, -32767},
+    {32767, 32767, 32767},
+    {32767, -32767, 32767},
+    {-32767, 32767, -32767},
+    {-32767, -32767, -32767},
+    {-32767, 32767, 32767},
+    {-32767, -32767, 32767},
+};
+constexpr m3::vec3 cube_1_normals[] = {
+    {-0.0f, 1.0f, -0.0f},
+    {-0.0f, -0.0f, 1.0f},
+    {-1.0f, -0.0f, -0.0f},
+    {-0.0f, -1.0f, -0.0f},
+    {1.0f, -0.0f, -0.0f},
+    {-0.0f, -0.0f, -1.0f},
+};
+constexpr face cube_1_faces[] = {
+    {0, 4, 1, 0},
+    {4, 4, 1, 1},
+    {8, 4, 1, 2},
+    {12, 4, 1, 3},
+    {16, 4, 1, 4},
+    {20, 4, 1, 5},
+};
+constexpr vertex_index cube_1_indices[] = {
+    0,
+    4,
+    6,
+    2,
+    3,
+    2,
+    6,
+    7,
+    7,
+    6,
+    4,
+    5,
+    5,
+    1,
+    3,
+    7,
+    1,
+    0,
+    2,
+    3,
+    5,
+    4,
+    0,
+    1,
+};
+constexpr object cube_objects[] = {
+    {{nullptr, 0}, {cube_0_vertices, 8}, {3.0518509447574615e-05f, 3.0518509447574615e-05f, 3.0518509447574615e-05f}, {0.0f, 0.0f, 0.0f}, {cube_0_normals, 6}, {cube_0_faces, 6}, {cube_0_indices, 24}, {{-1.000030517578125f, -1.000030517578125f, -1.000030517578125f}, {1.000030517578125f, 1.000030517578125f, 1.000030517578125f}, {0.0f, 0.0f, 0.0f}, 1.732103705406189f}},
+    {{nullptr, 0}, {cube_1_vertices, 8}, {3.0518509447574615e-05f, 3.0518509447574615e-05f, 3.0518509447574615e-05f}, {3.2332839965820312f, 0.0f, 0.0f}, {cube_1_normals, 6}, {cube_1_faces, 6}, {cube_1_indices, 24}, {{2.2332534790039062f, -1.000030517578125f, -1.000030517578125f}, {4.233314514160156f, 1.000030517578125f, 1.000030517578125f}, {3.2332839965820312f, 0.0f, 0.0f}, 1.732103705406189f}},
+};
+constexpr material cube_materials[] = {
+    {{200.0f, 11.288749694824219f, 13.5652494430542f}},
+    {{200.0f, 11.288749694824219f, 13.5652494430542f}},
+};
+constexpr m3::vec3 cube_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+constexpr scene cube_scene = {{cube_objects, 2}, {cube_materials, 2}, {cube_lights, 3}, {{0.0f, 0.0f, -60.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(cube_scene));
 
-# camera position vector
-cp 0 0 -60.0
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib cube.mtl
-o Cube
-v 1.000000 1.000000 -1.000000
-v 1.000000 -1.000000 -1.000000
-v 1.000000 1.000000 1.000000
-v 1.000000 -1.000000 1.000000
-v -1.000000 1.000000 -1.000000
-v -1.000000 -1.000000 -1.000000
-v -1.000000 1.000000 1.000000
-v -1.000000 -1.000000 1.000000
-vn -0.0000 1.0000 -0.0000
-vn -0.0000 -0.0000 1.0000
-vn -1.0000 -0.0000 -0.0000
-vn -0.0000 -1.0000 -0.0000
-vn 1.0000 -0.0000 -0.0000
-vn -0.0000 -0.0000 -1.0000
-vt 0.625000 0.500000
-vt 0.875000 0.500000
-vt 0.875000 0.750000
-vt 0.625000 0.750000
-vt 0.375000 0.750000
-vt 0.625000 1.000000
-vt 0.375000 1.000000
-vt 0.375000 0.000000
-vt 0.625000 0.000000
-vt 0.625000 0.250000
-vt 0.375000 0.250000
-vt 0.125000 0.500000
-vt 0.375000 0.500000
-vt 0.125000 0.750000
-s 0
-usemtl Material
-f 1/1/1 5/2/1 7/3/1 3/4/1
-f 4/5/2 3/4/2 7/6/2 8/7/2
-f 8/8/3 7/9/3 5/10/3 6/11/3
-f 6/12/4 2/13/4 4/5/4 8/14/4
-f 2/13/5 1/1/5 3/4/5 4/5/5
-f 6/11/6 5/10/6 1/1/6 2/13/6
-o Cube.001
-v 4.233284 1.000000 -1.000000
-v 4.233284 -1.000000 -1.000000
-v 4.233284 1.000000 1.000000
-v 4.233284 -1.000000 1.000000
-v 2.233284 1.000000 -1.000000
-v 2.233284 -1.000000 -1.000000
-v 2.233284 1.000000 1.000000
-v 2.233284 -1.000000 1.000000
-vn -0.0000 1.0000 -0.0000
-vn -0.0000 -0.0000 1.0000
-vn -1.0000 -0.0000 -0.0000
-vn -0.0000 -1.0000 -0.0000
-vn 1.0000 -0.0000 -0.0000
-vn -0.0000 -0.0000 -1.0000
-vt 0.625000 0.500000
-vt 0.875000 0.500000
-vt 0.875000 0.750000
-vt 0.625000 0.750000
-vt 0.375000 0.750000
-vt 0.625000 1.000000
-vt 0.375000 1.000000
-vt 0.375000 0.000000
-vt 0.625000 0.000000
-vt 0.625000 0.250000
-vt 0.375000 0.250000
-vt 0.125000 0.500000
-vt 0.375000 0.500000
-vt 0.125000 0.750000
-s 0
-usemtl Material.001
-f 9/15/7 13/16/7 15/17/7 11/18/7
-f 12/19/8 11/18/8 15/20/8 16/21/8
-f 16/22/9 15/23/9 13/24/9 14/25/9
-f 14/26/10 10/27/10 12/19/10 16/28/10
-f 10/27/11 9/15/11 11/18/11 12/19/11
-f 14/25/12 13/24/12 9/15/12 10/27/12
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'cube.blend'
-# www.blender.org
+constexpr quantized_vertex monkey_0_vertices[] = {
+    {-6399, 5461, 29589},
+    {-25881, 5461, 14985},
+    {-3868, 3121, 28643},
+    {-26133, 3121, 11952},
+    {-1228, 1820, 26639},
+    {-25581, 1820, 8384},
+    {-6147, -780, 24374},
+    {-21802, -780, 12639},
+    {-7629, 1040, 26961},
+    {-23284, 1040, 15226},
+    {-8541, 4421, 28553},
+    {-24196, 4421, 16817},
+    {-10508, 5461, 27647},
+    {-22685, 5461, 18519},
+    {-11276, 3121, 25081},
+    {-20321, 3121, 18300},
+    {-10952, 1820, 21910},
+    {-17909, 1820, 16695},
+    {-12805, 8062, 20805},
+    {-16284, 8062, 18198},
+    {-12667, 8062, 24037},
+    {-18929, 8062, 19343},
+    {-11204, 8062, 27125},
+    {-21989, 8062, 19041},
+    {-10508, 10922, 27647},
+    {-22685, 10922, 18519},
+    {-11276, 13003, 25081},
+    {-20321, 13003, 18300},
+    {-10952, 14563, 21910},
+    {-17909, 14563, 16695},
+    {-6147, 17164, 24374},
+    {-21802, 17164, 12639},
+    {-7629, 15083, 26961},
+    {-23284, 15083, 15226},
+    {-8541, 11963, 28553},
+    {-24196, 11963, 16817},
+    {-6399, 10922, 29589},
+    {-25881, 10922, 14985},
+    {-3868, 13003, 28643},
+    {-26133, 13003, 11952},
+    {-1228, 14563, 26639},
+    {-25581, 14563, 8384},
+    {739, 8062, 27545},
+    {-27093, 8062, 6682},
+    {-2248, 8062, 29288},
+    {-27297, 8062, 10511},
+    {-5589, 8062, 29912},
+    {-26463, 8062, 14265},
+    {-5643, 8062, 30440},
+    {-26865, 8062, 14532},
+    {-6453, 11182, 30118},
+    {-26283, 11182, 15253},
+    {-8883, 12483, 29150},
+    {-24538, 12483, 17414},
+    {-11024, 11182, 28114},
+    {-22853, 11182, 19247},
+    {-11894, 8062, 27462},
+    {-21983, 8062, 19899},
+    {-11024, 5201, 28114},
+    {-22853, 5201, 19247},
+    {-9225, 8062, 29747},
+    {-24880, 8062, 18011},
+    {-8883, 3901, 29150},
+    {-24538, 3901, 17414},
+    {-6453, 5201, 30118},
+    {-26283, 5201, 15253},
+    {-15798, 14303, 21690},
+    {-16938, 11702, 23680},
+    {-15684, -22625, 21491},
+    {-16368, -10662, 22685},
+    {-16596, -6241, 23083},
+    {-15456, -25746, 21093},
+    {-13747, 13523, 18109},
+    {-13291, 18984, 17313},
+    {3010, 29906, -11142},
+    {7455, 18724, -18902},
+    {7113, 2340, -18305},
+    {160, -12743, -6167},
+    {-8654, -6241, 20504},
+    {-17699, -6241, 13723},
+    {-6333, -14563, 22528},
+    {-20249, -14563, 12097},
+    {-5463, -23145, 23180},
+    {-21118, -23145, 11445},
+    {-4545, -29646, 22446},
+    {-20896, -29646, 10189},
+    {-5301, -31467, 21595},
+    {-19913, -31467, 10642},
+    {-9062, -32247, 19914},
+    {-17063, -32247, 13916},
+    {-13405, -32767, 17512},
+    {-2980, -4681, 23620},
+    {-22462, -4681, 9016},
+    {1255, -1300, 27079},
+    {-26925, -1300, 5955},
+    {6972, 4941, 27951},
+    {-29905, 4941, 307},
+    {5502, 14303, 32253},
+    {-32767, 14303, 3566},
+    {1741, 16123, 30571},
+    {-29918, 16123, 6840},
+    {-4042, 20024, 28512},
+    {-25959, 20024, 12083},
+    {-8552, 25225, 26837},
+    {-22816, 25225, 16145},
+    {-12547, 23925, 24696},
+    {-19505, 23925, 19480},
+    {-14521, 16384, 22932},
+    {-17304, 16384, 20846},
+    {-12601, 13783, 25225},
+    {-19907, 13783, 19748},
+    {-13357, 10142, 24374},
+    {-18924, 10142, 20201},
+    {-11276, 3121, 25081},
+    {-20321, 3121, 18300},
+    {-6879, 520, 26954},
+    {-23578, 520, 14436},
+    {-3814, 2080, 28114},
+    {-25731, 2080, 11685},
+    {-515, 6241, 29734},
+    {-28346, 6241, 8871},
+    {-167, 9882, 29995},
+    {-28694, 9882, 8610},
+    {-1264, 12483, 29741},
+    {-28053, 12483, 9660},
+    {-5889, 14563, 28265},
+    {-25024, 14563, 13922},
+    {-10460, 15603, 26261},
+    {-21593, 15603, 17916},
+    {-15684, -25485, 21491},
+    {-13249, -23925, 23317},
+    {-18120, -23925, 19666},
+    {-12733, -27826, 22850},
+    {-17952, -27826, 18938},
+    {-13723, -29386, 21540},
+    {-16506, -29386, 19453},
+    {-15000, -29646, 20297},
+    {-15912, -6501, 21889},
+    {-15798, -4681, 21690},
+    {-13537, -4941, 23385},
+    {-18060, -4941, 19995},
+    {-13129, -7542, 23976},
+    {-18696, -7542, 19803},
+    {-13885, -9622, 23125},
+    {-17712, -9622, 20256},
+    {-5901, -1560, 26550},
+    {-23644, -1560, 13249},
+    {-347, 1820, 29007},
+    {-27831, 1820, 8404},
+    {2431, 6761, 30235},
+    {-29924, 6761, 5982},
+    {1981, 12483, 31889},
+    {-31070, 12483, 7114},
+    {-263, 13783, 32767},
+    {-30878, 13783, 9818},
+    {-6855, 18204, 30385},
+    {-26337, 18204, 15781},
+    {-10208, 21325, 29294},
+    {-24124, 21325, 18862},
+    {-12872, 20544, 27866},
+    {-21917, 20544, 21086},
+    {-15019, 14303, 25972},
+    {-19542, 14303, 22582},
+    {-14041, -3381, 25567},
+    {-19607, -3381, 21395},
+    {-10646, -14823, 24415},
+    {-20039, -14823, 17374},
+    {-9434, -23405, 24470},
+    {-20567, -23405, 16125},
+    {-8744, -27306, 24134},
+    {-20573, -27306, 15267},
+    {-8984, -30426, 22816},
+    {-19421, -30426, 14993},
+    {-10550, -30947, 21643},
+    {-17855, -30947, 16166},
+    {-14317, -31467, 19104},
+    {-15570, 1560, 21292},
+    {-16140, 7022, 22287},
+    {-8492, 15863, 27167},
+    {-23104, 15863, 16214},
+    {-12259, 4681, 24628},
+    {-19565, 4681, 19151},
+    {-13069, 7022, 24305},
+    {-18983, 7022, 19872},
+    {-13075, -22885, 23447},
+    {-18294, -22885, 19535},
+    {-14173, -14823, 23193},
+    {-17652, -14823, 20585},
+    {-15912, -14823, 21889},
+    {-15798, -10922, 21690},
+    {-14281, -9102, 24250},
+    {-18456, -9102, 21120},
+    {-13639, -7542, 25300},
+    {-19553, -7542, 20866},
+    {-13933, -4421, 24511},
+    {-18804, -4421, 20860},
+    {-15499, -4161, 23337},
+    {-17238, -4161, 22033},
+    {-17052, -6761, 23879},
+    {-15781, -4941, 24264},
+    {-17868, -4941, 22699},
+    {-14737, -5201, 25046},
+    {-18912, -5201, 21916},
+    {-14617, -7542, 25705},
+    {-19488, -7542, 22054},
+    {-14971, -8322, 24586},
+    {-18450, -8322, 21978},
+    {-16710, -9622, 23282},
+    {-7322, -10402, 21218},
+    {-18803, -10402, 12612},
+    {-11689, -8062, 23633},
+    {-18995, -8062, 18156},
+    {-11342, -10402, 23893},
+    {-19343, -10402, 17895},
+    {-7844, -8322, 20827},
+    {-18281, -8322, 13003},
+    {-15000, -29126, 20297},
+    {-13957, -28866, 21080},
+    {-16044, -28866, 19515},
+    {-13255, -27306, 22459},
+    {-17430, -27306, 19330},
+    {-13483, -24705, 22857},
+    {-17658, -24705, 19728},
+    {-14545, -26006, 19501},
+    {-12571, -24965, 21265},
+    {-16746, -24965, 18136},
+    {-12229, -27046, 20668},
+    {-16404, -27046, 17539},
+    {-13159, -28346, 19687},
+    {-15246, -28346, 18122},
+    {-14203, -28606, 18905},
+    {-12541, 7282, 25554},
+    {-20195, 7282, 19817},
+    {-12080, 5201, 25616},
+    {-20429, 5201, 19357},
+    {-8547, 14303, 27695},
+    {-23506, 14303, 16481},
+    {-10166, 14043, 27050},
+    {-22343, 14043, 17922},
+    {-6861, 13263, 29528},
+    {-25648, 13263, 15445},
+    {-2590, 11702, 29885},
+    {-27639, 11702, 11108},
+    {-1954, 9622, 30077},
+    {-28047, 9622, 10518},
+    {-2014, 6501, 29748},
+    {-27759, 6501, 10449},
+    {-4845, 3381, 29047},
+    {-26067, 3381, 13139},
+    {-7449, 2080, 27949},
+    {-24148, 2080, 15431},
+    {-11324, 3641, 26467},
+    {-21413, 3641, 18904},
+    {-12367, 9882, 25684},
+    {-20369, 9882, 19686},
+    {-11672, 12483, 26206},
+    {-21065, 12483, 19165},
+    {-10808, 11963, 26000},
+    {-21245, 11963, 18176},
+    {-11678, 9882, 25348},
+    {-20375, 9882, 18828},
+    {-10634, 4161, 26130},
+    {-21419, 4161, 18046},
+    {-7221, 2861, 27551},
+    {-23920, 2861, 15033},
+    {-4965, 3901, 28389},
+    {-25491, 3901, 13002},
+    {-2596, 7022, 29027},
+    {-26949, 7022, 10772},
+    {-2422, 9362, 29157},
+    {-27123, 9362, 10641},
+    {-3058, 11182, 28965},
+    {-26715, 11182, 11232},
+    {-6693, 13003, 28800},
+    {-25132, 13003, 14978},
+    {-9878, 13263, 26981},
+    {-22403, 13263, 17593},
+    {-8433, 13523, 27496},
+    {-23392, 13523, 16282},
+    {-11390, 5721, 25280},
+    {-20435, 5721, 18499},
+    {-11564, 7542, 25149},
+    {-20261, 7542, 18629},
+    {-11425, 15343, 20133},
+    {-16296, 15343, 16482},
+    {-9626, 22105, 21766},
+    {-18323, 22105, 15247},
+    {-6153, 22885, 23517},
+    {-21112, 22885, 12303},
+    {-2278, 18464, 24999},
+    {-23847, 18464, 8830},
+    {2983, 15083, 26667},
+    {-27284, 15083, 3979},
+    {6048, 13523, 27827},
+    {-29438, 13523, 1227},
+    {6780, 5461, 25247},
+    {-27662, 5461, -571},
+    {2383, 0, 23373},
+    {-24405, 0, 3293},
+    {-2068, -3121, 22028},
+    {-21550, -3121, 7424},
+    {-9187, 29906, 10149},
+    {-3830, 32767, 797},
+    {4834, -6501, -14326},
+    {-7705, -15343, 7562},
+    {-11695, -32507, 14527},
+    {-9985, -26786, 11542},
+    {-9643, -18984, 10945},
+    {-9073, -16123, 9950},
+    {13193, 7802, 18393},
+    {-24728, 7802, -10033},
+    {14849, 10662, 15936},
+    {-23420, 10662, -12750},
+    {18635, 8842, 4553},
+    {-15807, 8842, -21265},
+    {15553, 14563, -7428},
+    {-4973, 14563, -22815},
+    {10356, -1560, 16835},
+    {-22347, -1560, -7679},
+    {10644, -4161, 8518},
+    {-15796, -4161, -11302},
+    {15564, -260, 2535},
+    {-12964, -260, -18850},
+    {12199, 1820, -8520},
+    {-2760, 1820, -19734},
+    {-5678, -11702, 17046},
+    {-16115, -11702, 9222},
+    {-4730, -13783, 12352},
+    {-12732, -13783, 6354},
+    {-4119, -23665, 17362},
+    {-16991, -23665, 7712},
+    {-5102, -16644, 16909},
+    {-16235, -16644, 8563},
+    {-3477, -30426, 18412},
+    {-18089, -30426, 7458},
+    {-7196, -25225, 14486},
+    {-13458, -25225, 9792},
+    {-7430, -17944, 14026},
+    {-12996, -17944, 9854},
+    {-7700, -31467, 16668},
+    {-15006, -31467, 11192},
+    {-6368, -9362, 17382},
+    {-16109, -9362, 10080},
+    {-7112, -7542, 18247},
+    {-16505, -7542, 11205},
+    {-7742, -5721, 18912},
+    {-16787, -5721, 12132},
+    {-2667, -13003, 10486},
+    {-12060, -13003, 3445},
+    {5516, -10402, 976},
+    {-7704, -10402, -8934},
+    {10550, -4941, -5206},
+    {-4758, -4941, -16680},
+    {10705, 28866, 600},
+    {-9473, 28866, -14526},
+    {6146, 30947, 8559},
+    {-14033, 30947, -6567},
+    {1700, 28346, 16319},
+    {-18478, 28346, 1194},
+    {-976, 17424, 21424},
+    {-21502, 17424, 6038},
+    {6306, 13523, 23470},
+    {-26048, 13523, -783},
+    {5017, 15083, 20512},
+    {-23163, 15083, -612},
+    {8496, 23405, 14872},
+    {-20031, 23405, -6513},
+    {10950, 18724, 19271},
+    {-24536, 18724, -7330},
+    {14483, 20544, 13102},
+    {-21002, 20544, -13498},
+    {12144, 24965, 8505},
+    {-16384, 24965, -12880},
+    {15792, 22625, 2137},
+    {-12736, 22625, -19247},
+    {18017, 17944, 6934},
+    {-17469, 17944, -19667},
+    {17322, 10922, -1836},
+    {-10162, 10922, -22438},
+    {13795, 780, -3058},
+    {-7775, 780, -19226},
+    {16259, 10922, 11305},
+    {-20270, 10922, -16078},
+    {1910, -5721, 13348},
+    {-16181, -5721, -213},
+    {7675, -6501, 4586},
+    {-11459, -6501, -9757},
+    {18280, 13523, 11682},
+    {-21380, 13523, -18048},
+    {14075, -4681, 12512},
+    {-20367, -4681, -13306},
+    {22953, -3381, 11772},
+    {-23317, -3381, -22913},
+    {29828, 1820, 13227},
+    {-27228, 1820, -29542},
+    {31279, 10662, 14600},
+    {-28907, 10662, -30516},
+    {28670, 16904, 12644},
+    {-26298, 16904, -28560},
+    {22377, 15863, 11909},
+    {-23197, 15863, -22254},
+    {21862, 13783, 12376},
+    {-23365, 13783, -21527},
+    {27170, 14563, 12658},
+    {-25710, 14563, -26982},
+    {29138, 9622, 13564},
+    {-27222, 9622, -28684},
+    {27920, 2601, 12651},
+    {-26004, 2601, -27771},
+    {22437, -1300, 12239},
+    {-23485, -1300, -22185},
+    {15407, -2340, 13226},
+    {-21470, -2340, -14418},
+    {18748, 11963, 12602},
+    {-22304, 11963, -18171},
+    {20296, 10142, 11202},
+    {-21800, 10142, -20353},
+    {17765, -780, 12149},
+    {-21548, -780, -17320},
+    {23523, 0, 10777},
+    {-22747, 0, -23908},
+    {27968, 3121, 11265},
+    {-24912, 3121, -28375},
+    {29012, 8322, 12047},
+    {-25956, 8322, -29157},
+    {27506, 11963, 11203},
+    {-24678, 11963, -27915},
+    {23061, 11442, 10715},
+    {-22513, 11442, -23448},
+    {16895, 9622, 11497},
+    {-20678, 9622, -16668},
+    {17633, 5721, 9775},
+    {-19592, 5721, -18130},
+    {15893, 3121, 8471},
+    {-17853, 3121, -16826},
+    {17285, 2861, 9514},
+    {-19244, 2861, -17869},
+    {17807, 520, 9905},
+    {-19766, 520, -18260},
+    {17111, -520, 9383},
+    {-19071, -520, -17739},
+    {12234, 0, 13123},
+    {-20121, 0, -11131},
+    {13542, -780, 10406},
+    {-18465, -780, -13587},
+    {13770, 1300, 10008},
+    {-18237, 1300, -13985},
+    {15851, 6761, 10715},
+    {-19635, 6761, -15886},
+    {18736, 8062, 10886},
+    {-20924, 8062, -18843},
+    {19534, 7802, 9493},
+    {-20126, 7802, -20236},
+    {17795, -520, 8190},
+    {-18387, -520, -18932},
+    {18665, 520, 8841},
+    {-19256, 520, -19584},
+    {18143, 2601, 8450},
+    {-18734, 2601, -19193},
+    {16751, 3121, 7407},
+    {-17343, 3121, -18150},
+    {18491, 5721, 8711},
+    {-19082, 5721, -19454},
+    {24207, 10922, 9583},
+    {-22063, 10922, -25102},
+    {28538, 11442, 10270},
+    {-24342, 11442, -29370},
+    {30218, 8062, 11244},
+    {-25794, 8062, -30743},
+    {29060, 2861, 10661},
+    {-24864, 2861, -29761},
+    {24495, 0, 9515},
+    {-22123, 0, -25431},
+    {18562, -520, 10756},
+    {-20750, -520, -18713},
+    {21268, 9622, 9940},
+    {-21176, 9622, -21876},
+    {19648, 3641, 9294},
+    {-20012, 3641, -20435},
+    {20806, 2080, 9878},
+    {-20942, 2080, -21417},
+    {22654, 4161, 10125},
+    {-21877, 4161, -23256},
+    {21556, 5721, 9871},
+    {-21236, 5721, -22206},
+    {23115, 7802, 10187},
+    {-22111, 7802, -23716},
+    {24099, 6241, 10640},
+    {-22867, 6241, -24567},
+    {25431, 7022, 11354},
+    {-23971, 7022, -25678},
+    {24909, 9102, 10962},
+    {-23449, 9102, -25287},
+    {24885, 14563, 7532},
+    {-20689, 14563, -26632},
+    {30842, 15603, 9721},
+    {-24822, 15603, -32005},
+    {32767, 9882, 12871},
+    {-28115, 9882, -32767},
+    {32005, 1820, 11162},
+    {-26442, 1820, -32650},
+    {25347, -2861, 7593},
+    {-20923, -2861, -27091},
+    {17387, -4161, 7599},
+    {-17751, -4161, -18740},
+    {19750, 12743, 7380},
+    {-18518, 12743, -21307},
+};
+constexpr m3::vec3 monkey_0_normals[] = {
+    {0.15780000388622284f, -0.20260000228881836f, 0.9664999842643738f},
+    {-0.9491000175476074f, -0.20260000228881836f, 0.2410999983549118f},
+    {0.4325999915599823f, -0.3050999939441681f, 0.8483999967575073f},
+    {-0.9505000114440918f, -0.3050999939441681f, -0.057999998331069946f},
+    {0.09040000289678574f, -0.7904999852180481f, 0.6057000160217285f},
+    {-0.5914000272750854f, -0.7904999852180481f, 0.15880000591278076f},
+    {-0.1039000004529953f, -0.5163000226020813f, 0.8500999808311462f},
+    {-0.7379999756813049f, -0.5163000226020813f, 0.4345000088214874f},
+    {-0.536899983882904f, -0.5221999883651733f, 0.6625999808311462f},
+    {-0.39320001006126404f, -0.5221999883651733f, 0.7567999958992004f},
+    {-0.4731999933719635f, -0.8486999869346619f, 0.2362000048160553f},
+    {-0.027699999511241913f, -0.8486999869346619f, 0.5281999707221985f},
+    {-0.9416000247001648f, -0.3352000117301941f, 0.030899999663233757f},
+    {0.3474999964237213f, -0.3352000117301941f, 0.8756999969482422f},
+    {-0.8648999929428101f, -0.1981000006198883f, 0.4611999988555908f},
+    {-0.07769999653100967f, -0.1981000006198883f, 0.9771000146865845f},
+    {-0.8621000051498413f, 0.19580000638961792f, 0.4674000144004822f},
+    {-0.0843999981880188f, 0.19580000638961792f, 0.9769999980926514f},
+    {-0.9442999958992004f, 0.3264000117778778f, 0.04129999876022339f},
+    {0.3391000032424927f, 0.3264000117778778f, 0.8823000192642212f},
+    {-0.49470001459121704f, 0.817300021648407f, 0.2953000068664551f},
+    {-0.07329999655485153f, 0.817300021648407f, 0.5715000033378601f},
+    {-0.5038999915122986f, 0.6022999882698059f, 0.6190999746322632f},
+    {-0.3686999976634979f, 0.551800012588501f, 0.7480000257492065f},
+    {-0.15160000324249268f, 0.5231000185012817f, 0.838699996471405f},
+    {-0.7310000061988831f, 0.5446000099182129f, 0.41110000014305115f},
+    {0.07779999822378159f, 0.7671999931335449f, 0.6366000175476074f},
+    {-0.614799976348877f, 0.7671999931335449f, 0.18279999494552612f},
+    {0.42660000920295715f, 0.29679998755455017f, 0.8543999791145325f},
+    {-0.9539999961853027f, 0.2939999997615814f, -0.05820000171661377f},
+    {0.19220000505447388f, 0.1868000030517578f, 0.9634000062942505f},
+    {-0.9491000175476074f, 0.20260000228881836f, 0.2410999983549118f},
+    {0.932699978351593f, 0.34360000491142273f, 0.10909999907016754f},
+    {-0.35569998621940613f, 0.3057999908924103f, -0.8830999732017517f},
+    {0.4575999975204468f, 0.8295999765396118f, -0.3199999928474426f},
+    {0.12729999423027039f, 0.8145999908447266f, -0.5659000277519226f},
+    {-0.061400000005960464f, 0.7605000138282776f, -0.646399974822998f},
+    {0.5924000144004822f, 0.798799991607666f, -0.1046999990940094f},
+    {-0.5074999928474426f, 0.314300000667572f, -0.802299976348877f},
+    {0.9448000192642212f, 0.32760000228881836f, -0.007499999832361937f},
+    {-0.36660000681877136f, -0.3537999987602234f, -0.8604999780654907f},
+    {0.9352999925613403f, -0.3537999987602234f, -0.007400000002235174f},
+    {-0.1404000073671341f, -0.798799991607666f, -0.5849999785423279f},
+    {0.6057000160217285f, -0.7806000113487244f, -0.15389999747276306f},
+    {0.46389999985694885f, -0.8205999732017517f, -0.3337000012397766f},
+    {0.12080000340938568f, -0.8205999732017517f, -0.5586000084877014f},
+    {0.9434999823570251f, -0.3292999863624573f, -0.03790000081062317f},
+    {-0.3418000042438507f, -0.3292999863624573f, -0.8802000284194946f},
+    {-0.16660000383853912f, -0.062300000339746475f, 0.9840999841690063f},
+    {-0.8357999920845032f, -0.062300000339746475f, 0.5454999804496765f},
+    {-0.25600001215934753f, -0.1754000037908554f, 0.9506000280380249f},
+    {-0.7694000005722046f, -0.1754000037908554f, 0.6141999959945679f},
+    {-0.45730000734329224f, -0.1835000067949295f, 0.870199978351593f},
+    {-0.6154000163078308f, -0.1835000067949295f, 0.7666000127792358f},
+    {-0.5989999771118164f, -0.028300000354647636f, 0.8003000020980835f},
+    {-0.49470001459121704f, -0.028300000354647636f, 0.8686000108718872f},
+    {-0.5989999771118164f, 0.026000000536441803f, 0.8003000020980835f},
+    {-0.49470001459121704f, 0.026000000536441803f, 0.8687000274658203f},
+    {-0.4537999927997589f, 0.1729000061750412f, 0.8741999864578247f},
+    {-0.6204000115394592f, 0.1729000061750412f, 0.7649999856948853f},
+    {-0.2603999972343445f, 0.1656000018119812f, 0.951200008392334f},
+    {-0.7681999802589417f, 0.1656000018119812f, 0.618399977684021f},
+    {-0.16660000383853912f, 0.05719999969005585f, 0.9843999743461609f},
+    {-0.8360000252723694f, 0.05719999969005585f, 0.5457000136375427f},
+    {-0.1404000073671341f, -0.8748000264167786f, 0.4636000096797943f},
+    {-0.37700000405311584f, -0.8432999849319458f, 0.3831000030040741f},
+    {-0.051100000739097595f, -0.8655999898910522f, 0.498199999332428f},
+    {-0.41749998927116394f, -0.8619999885559082f, 0.2874999940395355f},
+    {0.1331000030040741f, -0.5048999786376953f, 0.8528000116348267f},
+    {-0.835099995136261f, -0.5048999786376953f, 0.2184000015258789f},
+    {0.30559998750686646f, -0.0632999986410141f, 0.9501000046730042f},
+    {-0.9930999875068665f, -0.0632999986410141f, 0.09910000115633011f},
+    {0.26589998602867126f, 0.11320000141859055f, 0.9573000073432922f},
+    {-0.9839000105857849f, 0.11320000141859055f, 0.13840000331401825f},
+    {0.09200000017881393f, -0.8345000147819519f, 0.5432000160217285f},
+    {-0.5347999930381775f, -0.8345000147819519f, 0.13249999284744263f},
+    {-0.023000000044703484f, -0.7289999723434448f, 0.6840999722480774f},
+    {-0.7348999977111816f, -0.5751000046730042f, 0.35929998755455017f},
+    {0.26089999079704285f, -0.4196999967098236f, 0.8694000244140625f},
+    {-0.9013000130653381f, -0.4196999967098236f, 0.10779999941587448f},
+    {0.2624000012874603f, -0.39149999618530273f, 0.8820000290870667f},
+    {-0.8894000053405762f, -0.2978000044822693f, 0.34689998626708984f},
+    {-0.2240999937057495f, 0.3425000011920929f, 0.9124000072479248f},
+    {-0.9290000200271606f, 0.36059999465942383f, -0.08330000191926956f},
+    {0.11540000140666962f, 0.6481999754905701f, 0.7526000142097473f},
+    {-0.7365000247955322f, 0.6448000073432922f, 0.20419999957084656f},
+    {0.18359999358654022f, 0.5565000176429749f, 0.8102999925613403f},
+    {-0.8162000179290771f, 0.5565000176429749f, 0.1551000028848648f},
+    {-0.45350000262260437f, 0.656000018119812f, 0.6032999753952026f},
+    {-0.37610000371932983f, 0.6685000061988831f, 0.6416000127792358f},
+    {-0.9501000046730042f, 0.27149999141693115f, 0.15379999577999115f},
+    {0.31139999628067017f, 0.376800000667572f, 0.8723999857902527f},
+    {-0.8324999809265137f, 0.526199996471405f, 0.17339999973773956f},
+    {0.1665000021457672f, 0.5774000287055969f, 0.7993000149726868f},
+    {0.1005999967455864f, -0.6280999779701233f, 0.7716000080108643f},
+    {-0.8759999871253967f, -0.3230000138282776f, 0.3580999970436096f},
+    {-0.28209999203681946f, -0.46939998865127563f, 0.8367000222206116f},
+    {-0.6546000242233276f, -0.46939998865127563f, 0.5927000045776367f},
+    {-0.4754999876022339f, -0.579200029373169f, 0.6621000170707703f},
+    {-0.38089999556541443f, -0.5009999871253967f, 0.7771000266075134f},
+    {-0.4115999937057495f, -0.7843000292778015f, 0.4641000032424927f},
+    {-0.3817000091075897f, -0.5759000182151794f, 0.7229999899864197f},
+    {-0.4936000108718872f, -0.16949999332427979f, 0.8529999852180481f},
+    {-0.29840001463890076f, -0.8644999861717224f, 0.40450000762939453f},
+    {-0.13850000500679016f, -0.0608999989926815f, 0.9884999990463257f},
+    {-0.6534000039100647f, -0.31279999017715454f, 0.6894000172615051f},
+    {-0.22619999945163727f, -0.18279999494552612f, 0.9567999839782715f},
+    {-0.8471999764442444f, -0.18119999766349792f, 0.4993000030517578f},
+    {-0.18400000035762787f, -0.3068000078201294f, 0.9337999820709229f},
+    {-0.7657999992370605f, -0.27619999647140503f, 0.5806999802589417f},
+    {-0.25189998745918274f, 0.21130000054836273f, 0.9444000124931335f},
+    {-0.8647000193595886f, -0.24079999327659607f, 0.4408999979496002f},
+    {-0.6305999755859375f, 0.3903000056743622f, 0.670799970626831f},
+    {-0.36329999566078186f, 0.3903000056743622f, 0.8460000157356262f},
+    {0.20260000228881836f, -0.2915000021457672f, 0.9348999857902527f},
+    {-0.620199978351593f, -0.49559998512268066f, 0.6080999970436096f},
+    {-0.4964999854564667f, -0.07810000330209732f, 0.8644999861717224f},
+    {-0.5945000052452087f, -0.07810000330209732f, 0.8003000020980835f},
+    {-0.5386999845504761f, -0.23160000145435333f, 0.8100000023841858f},
+    {-0.5940999984741211f, -0.08449999988079071f, 0.7998999953269958f},
+    {-0.29750001430511475f, -0.7103000283241272f, 0.6378999948501587f},
+    {-0.4661000072956085f, -0.7103000283241272f, 0.527400016784668f},
+    {-0.32409998774528503f, -0.5946999788284302f, 0.7357000112533569f},
+    {-0.545199990272522f, -0.5946999788284302f, 0.5907999873161316f},
+    {-0.250900000333786f, -0.16619999706745148f, 0.9535999894142151f},
+    {-0.7365999817848206f, -0.3928000032901764f, 0.550599992275238f},
+    {-0.24220000207424164f, -0.035999998450279236f, 0.9696000218391418f},
+    {-0.7922999858856201f, -0.035999998450279236f, 0.6090999841690063f},
+    {-0.24639999866485596f, -0.08079999685287476f, 0.9657999873161316f},
+    {-0.7871999740600586f, -0.08079999685287476f, 0.6114000082015991f},
+    {-0.5666999816894531f, 0.051100000739097595f, 0.8223999738693237f},
+    {-0.5468999743461609f, 0.06650000065565109f, 0.8345999717712402f},
+    {-0.550599992275238f, -0.06509999930858612f, 0.8323000073432922f},
+    {-0.5468999743461609f, -0.06650000065565109f, 0.8345999717712402f},
+    {-0.5480999946594238f, -0.0f, 0.8363999724388123f},
+    {0.6820999979972839f, -0.5335000157356262f, 0.5001000165939331f},
+    {-0.7307999730110168f, -0.5335000157356262f, -0.42579999566078186f},
+    {0.8813999891281128f, 0.26919999718666077f, 0.38830000162124634f},
+    {-0.7077999711036682f, 0.26919999718666077f, -0.6531000137329102f},
+    {0.29330000281333923f, 0.9003999829292297f, -0.32120001316070557f},
+    {0.12690000236034393f, 0.9164999723434448f, -0.37950000166893005f},
+    {-0.8363999724388123f, -0.0f, -0.5480999946594238f},
+    {0.31949999928474426f, 0.5491999983787537f, 0.7721999883651733f},
+    {0.24230000376701355f, -0.8956000208854675f, 0.37299999594688416f},
+    {-0.5033000111579895f, -0.8639000058174133f, -0.019999999552965164f},
+    {-0.17960000038146973f, -0.5746999979019165f, 0.7983999848365784f},
+    {-0.6603000164031982f, -0.5746999979019165f, 0.48339998722076416f},
+    {-0.8359000086784363f, 0.5353000164031982f, 0.12129999697208405f},
+    {0.2223999947309494f, 0.5353000164031982f, 0.8148000240325928f},
+    {-0.2705000042915344f, 0.7759000062942505f, 0.5699999928474426f},
+    {-0.4147000014781952f, 0.7759000062942505f, 0.4754999876022339f},
+    {0.30559998750686646f, 0.28700000047683716f, 0.9078999757766724f},
+    {-0.9528999924659729f, 0.2971000075340271f, 0.060499999672174454f},
+    {-0.1356000006198883f, -0.5408999919891357f, 0.8300999999046326f},
+    {-0.7070000171661377f, -0.5408999919891357f, 0.45559999346733093f},
+    {-0.4900999963283539f, 0.23430000245571136f, 0.8396000266075134f},
+    {-0.5649999976158142f, 0.22470000386238098f, 0.7939000129699707f},
+    {-0.5379999876022339f, -0.6086999773979187f, 0.5831000208854675f},
+    {-0.3199000060558319f, -0.6086999773979187f, 0.7261000275611877f},
+    {-0.8942999839782715f, 0.07159999758005142f, 0.4417000114917755f},
+    {-0.04800000041723251f, 0.07159999758005142f, 0.9962999820709229f},
+    {-0.7993000149726868f, -0.5774000287055969f, 0.1665000021457672f},
+    {0.1665000021457672f, -0.5774000287055969f, 0.7993000149726868f},
+    {0.06289999932050705f, -0.4309999942779541f, 0.9000999927520752f},
+    {-0.7930999994277954f, 0.0737999975681305f, 0.6047000288963318f},
+    {-0.24819999933242798f, 0.031099999323487282f, 0.9682000279426575f},
+    {-0.760200023651123f, 0.06620000302791595f, 0.6463000178337097f},
+    {0.31220000982284546f, 0.39100000262260437f, 0.8658000230789185f},
+    {-0.9718999862670898f, 0.20589999854564667f, -0.1137000024318695f},
+    {0.47690001130104065f, 0.3179999887943268f, 0.8194000124931335f},
+    {-0.9664000272750854f, 0.19939999282360077f, -0.1624000072479248f},
+    {0.5120000243186951f, 0.3797999918460846f, 0.7703999876976013f},
+    {-0.9107999801635742f, 0.3797999918460846f, -0.16189999878406525f},
+    {-0.33959999680519104f, -0.41609999537467957f, 0.843500018119812f},
+    {-0.44830000400543213f, -0.8654999732971191f, 0.22360000014305115f},
+    {-0.6413999795913696f, -0.19449999928474426f, 0.7422000169754028f},
+    {-0.4244999885559082f, -0.19449999928474426f, 0.8842999935150146f},
+    {-0.864300012588501f, -0.0f, 0.503000020980835f},
+    {-0.11620000004768372f, -0.0f, 0.9932000041007996f},
+    {-0.2809999883174896f, 0.949400007724762f, 0.14020000398159027f},
+    {-0.016300000250339508f, 0.949400007724762f, 0.31360000371932983f},
+    {-0.6554999947547913f, 0.7336999773979187f, -0.17890000343322754f},
+    {0.42570000886917114f, 0.7336999773979187f, 0.5296000242233276f},
+    {0.8363999724388123f, -0.0f, 0.5480999946594238f},
+    {0.19050000607967377f, -0.9449999928474426f, 0.26600000262260437f},
+    {-0.3199999928474426f, -0.9449999928474426f, -0.06849999725818634f},
+    {-0.5041000247001648f, -0.30309998989105225f, 0.8087000250816345f},
+    {-0.5403000116348267f, -0.30309998989105225f, 0.7850000262260437f},
+    {-0.3953000009059906f, -0.34790000319480896f, 0.8500999808311462f},
+    {-0.6215999722480774f, -0.34790000319480896f, 0.7017999887466431f},
+    {-0.8600999712944031f, -0.22390000522136688f, 0.45840001106262207f},
+    {-0.07699999958276749f, -0.22390000522136688f, 0.9715999960899353f},
+    {-0.7541000247001648f, 0.02710000053048134f, 0.6561999917030334f},
+    {-0.30070000886917114f, 0.02710000053048134f, 0.9532999992370605f},
+    {-0.6836000084877014f, -0.008999999612569809f, 0.7297999858856201f},
+    {-0.3091999888420105f, 0.10379999876022339f, 0.9452999830245972f},
+    {-0.777899980545044f, -0.48739999532699585f, 0.396699994802475f},
+    {0.23849999904632568f, -0.4595000147819519f, 0.8554999828338623f},
+    {-0.3792000114917755f, -0.8797000050544739f, 0.28690001368522644f},
+    {-0.11169999837875366f, -0.8797000050544739f, 0.46219998598098755f},
+    {-0.061500001698732376f, -0.5895000100135803f, 0.805400013923645f},
+    {-0.7139000296592712f, -0.5895000100135803f, 0.37790000438690186f},
+    {0.218299999833107f, -0.45890000462532043f, 0.8611999750137329f},
+    {-0.876800000667572f, -0.45890000462532043f, 0.1436000019311905f},
+    {-0.00800000037997961f, -0.1143999993801117f, 0.993399977684021f},
+    {-0.9075999855995178f, -0.1143999993801117f, 0.40389999747276306f},
+    {0.026000000536441803f, 0.11969999969005585f, 0.9925000071525574f},
+    {-0.9258999824523926f, 0.11550000309944153f, 0.3596000075340271f},
+    {-0.10610000044107437f, 0.4081999957561493f, 0.9067000150680542f},
+    {-0.7343000173568726f, 0.6574000120162964f, 0.16930000483989716f},
+    {-0.17239999771118164f, 0.7882000207901001f, 0.5907999873161316f},
+    {-0.47279998660087585f, 0.7882000207901001f, 0.3939000070095062f},
+    {-0.34790000319480896f, 0.33869999647140503f, 0.8741999864578247f},
+    {-0.6626999974250793f, 0.33869999647140503f, 0.6679999828338623f},
+    {-0.5975000262260437f, 0.27559998631477356f, 0.753000020980835f},
+    {-0.45190000534057617f, 0.27559998631477356f, 0.8483999967575073f},
+    {-0.2777999937534332f, -0.21809999644756317f, 0.9355999827384949f},
+    {-0.7016000151634216f, -0.5738999843597412f, 0.42239999771118164f},
+    {-0.243599995970726f, -0.30149999260902405f, 0.9218000173568726f},
+    {-0.7480000257492065f, -0.30149999260902405f, 0.5913000106811523f},
+    {-0.5360999703407288f, -0.833899974822998f, 0.13109999895095825f},
+    {-0.4661000072956085f, -0.3156000077724457f, 0.8264999985694885f},
+    {-0.2696000039577484f, -0.7821999788284302f, 0.5616000294685364f},
+    {-0.03400000184774399f, -0.9071000218391418f, 0.4196000099182129f},
+    {-0.7944999933242798f, -0.2851000130176544f, 0.5360999703407288f},
+    {-0.17440000176429749f, -0.2851000130176544f, 0.9424999952316284f},
+    {-0.7520999908447266f, -0.05770000070333481f, 0.6565999984741211f},
+    {-0.10480000078678131f, 0.05079999938607216f, 0.9932000041007996f},
+    {-0.6747000217437744f, 0.5245000123977661f, 0.5192999839782715f},
+    {-0.20679999887943268f, 0.5245000123977661f, 0.8259000182151794f},
+    {-0.47380000352859497f, 0.5546000003814697f, 0.6840999722480774f},
+    {-0.359499990940094f, 0.6815000176429749f, 0.6373999714851379f},
+    {-0.05380000174045563f, 0.6341999769210815f, 0.7713000178337097f},
+    {-0.7117999792098999f, 0.5220999717712402f, 0.4699000120162964f},
+    {0.04129999876022339f, 0.5299999713897705f, 0.847000002861023f},
+    {-0.7930999994277954f, 0.5299999713897705f, 0.3003000020980835f},
+    {0.032499998807907104f, -0.3391000032424927f, 0.9401999711990356f},
+    {-0.875f, -0.3391000032424927f, 0.34549999237060547f},
+    {0.3912000060081482f, -0.061500001698732376f, 0.9182999730110168f},
+    {-0.9980999827384949f, -0.061500001698732376f, 0.007899999618530273f},
+    {0.31709998846054077f, 0.11159999668598175f, 0.9417999982833862f},
+    {-0.9901000261306763f, 0.11159999668598175f, 0.0851999968290329f},
+    {-0.2815999984741211f, 0.8888000249862671f, -0.36169999837875366f},
+    {0.4440000057220459f, 0.8888000249862671f, 0.11389999836683273f},
+    {-0.5110999941825867f, 0.37439998984336853f, -0.7736999988555908f},
+    {0.9133999943733215f, 0.37439998984336853f, 0.15970000624656677f},
+    {0.0034000000450760126f, 0.8709999918937683f, -0.4912000000476837f},
+    {0.4334999918937683f, 0.8626000285148621f, -0.260699987411499f},
+    {0.6640999913215637f, 0.7444999814033508f, 0.0689999982714653f},
+    {-0.33070001006126404f, 0.7488999962806702f, -0.5742999911308289f},
+    {0.49059998989105225f, 0.8684999942779541f, -0.07109999656677246f},
+    {-0.1445000022649765f, 0.8833000063896179f, -0.44600000977516174f},
+    {0.3978999853134155f, 0.9140999913215637f, -0.07800000160932541f},
+    {-0.08730000257492065f, 0.9140999913215637f, -0.3959999978542328f},
+    {0.984000027179718f, 0.13429999351501465f, 0.11729999631643295f},
+    {-0.3427000045776367f, 0.13230000436306f, -0.9301000237464905f},
+    {0.7260000109672546f, -0.664900004863739f, -0.17589999735355377f},
+    {-0.12849999964237213f, -0.664900004863739f, -0.73580002784729f},
+    {0.5063999891281128f, -0.8565999865531921f, -0.09870000183582306f},
+    {-0.11169999837875366f, -0.8565999865531921f, -0.5037000179290771f},
+    {0.7677000164985657f, -0.38580000400543213f, -0.5116999745368958f},
+    {0.26159998774528503f, -0.6643999814987183f, -0.7001000046730042f},
+    {0.6980999708175659f, -0.09759999811649323f, -0.7092999815940857f},
+    {0.27079999446868896f, -0.012500000186264515f, -0.9625999927520752f},
+    {0.4438999891281128f, -0.5633000135421753f, -0.6969000101089478f},
+    {0.2872999906539917f, -0.31119999289512634f, -0.9059000015258789f},
+    {0.2451999932527542f, -0.964900016784668f, -0.09449999779462814f},
+    {-0.01119999960064888f, -0.964900016784668f, -0.26249998807907104f},
+    {0.23729999363422394f, -0.9624000191688538f, -0.13220000267028809f},
+    {0.026499999687075615f, -0.9624000191688538f, -0.2703000009059906f},
+    {0.9524999856948853f, 0.15729999542236328f, 0.2606000006198883f},
+    {-0.6191999912261963f, 0.15729999542236328f, -0.7692999839782715f},
+    {0.9538999795913696f, 0.18379999697208405f, 0.2370000034570694f},
+    {-0.5981000065803528f, 0.18379999697208405f, -0.7799999713897705f},
+    {0.7164999842643738f, 0.07660000026226044f, -0.6934000253677368f},
+    {0.3497999906539917f, 0.07660000026226044f, -0.9337000250816345f},
+    {0.644599974155426f, -0.05299999937415123f, -0.7627000212669373f},
+    {0.6291999816894531f, -0.3634999990463257f, -0.6869999766349792f},
+    {0.9758999943733215f, 0.1370999962091446f, 0.16990000009536743f},
+    {0.03799999877810478f, -0.6779999732971191f, -0.7340999841690063f},
+    {0.9708999991416931f, 0.1354999989271164f, 0.1972000002861023f},
+    {-0.5684000253677368f, 0.1354999989271164f, -0.8115000128746033f},
+    {0.8772000074386597f, 0.3440000116825104f, 0.33489999175071716f},
+    {-0.6895999908447266f, 0.267300009727478f, -0.6730999946594238f},
+    {0.8835999965667725f, 0.36419999599456787f, 0.29440000653266907f},
+    {-0.659600019454956f, 0.28130000829696655f, -0.6970000267028809f},
+    {0.6887999773025513f, 0.43369999527931213f, 0.5809999704360962f},
+    {-0.6894000172615051f, 0.24549999833106995f, -0.6815000176429749f},
+    {0.2646999955177307f, -0.9577000141143799f, -0.1128000020980835f},
+    {0.16979999840259552f, -0.7864000201225281f, -0.5939000248908997f},
+    {0.7479000091552734f, -0.47119998931884766f, -0.4675999879837036f},
+    {0.12489999830722809f, -0.47589999437332153f, -0.8705999851226807f},
+    {0.5139999985694885f, -0.8235999941825867f, -0.23960000276565552f},
+    {-0.029200000688433647f, -0.8342000246047974f, -0.5507000088691711f},
+    {0.3255000114440918f, -0.9441999793052673f, 0.04969999939203262f},
+    {-0.17550000548362732f, -0.9441999793052673f, -0.2786000072956085f},
+    {0.4004000127315521f, -0.9162999987602234f, -0.011500000022351742f},
+    {-0.1492999941110611f, -0.9162999987602234f, -0.3716999888420105f},
+    {0.939300000667572f, 0.33329999446868896f, 0.08190000057220459f},
+    {-0.8158000111579895f, -0.47369998693466187f, -0.33180001378059387f},
+    {0.6891000270843506f, -0.37400001287460327f, 0.6207000017166138f},
+    {-0.8440999984741211f, -0.37400001287460327f, -0.3840999901294708f},
+    {0.7699000239372253f, -0.04540000110864639f, -0.6366000175476074f},
+    {0.1316000074148178f, -0.226500004529953f, -0.9650999903678894f},
+    {-0.017500000074505806f, 0.9657999873161316f, 0.2587999999523163f},
+    {-0.2289000004529953f, 0.9625999927520752f, 0.14509999752044678f},
+    {0.20829999446868896f, 0.9750000238418579f, -0.07720000296831131f},
+    {-0.012400000356137753f, 0.9750000238418579f, -0.22179999947547913f},
+    {0.6985999941825867f, 0.6191999912261963f, -0.35850000381469727f},
+    {0.04989999905228615f, 0.6191999912261963f, -0.7835999727249146f},
+    {0.47440001368522644f, 0.8618000149726868f, 0.179299995303154f},
+    {-0.3537999987602234f, 0.8618000149726868f, -0.36340001225471497f},
+    {-0.18050000071525574f, 0.6446999907493591f, 0.7427999973297119f},
+    {-0.609000027179718f, 0.6446999907493591f, 0.4620000123977661f},
+    {0.4178999960422516f, 0.7888000011444092f, 0.4507000148296356f},
+    {-0.5799999833106995f, 0.7888000011444092f, -0.20329999923706055f},
+    {0.699999988079071f, 0.6754999756813049f, 0.23160000145435333f},
+    {-0.4918000102043152f, 0.6754999756813049f, -0.5493999719619751f},
+    {0.972599983215332f, 0.1363999992609024f, -0.18809999525547028f},
+    {-0.12479999661445618f, 0.2517000138759613f, -0.9596999883651733f},
+    {0.9506999850273132f, 0.23180000483989716f, -0.20589999854564667f},
+    {-0.1906999945640564f, 0.23180000483989716f, -0.9538999795913696f},
+    {0.6617000102996826f, 0.7253999710083008f, 0.18970000743865967f},
+    {-0.43799999356269836f, 0.7253999710083008f, -0.531000018119812f},
+    {0.5404999852180481f, 0.6729000210762024f, 0.5051000118255615f},
+    {-0.6787999868392944f, 0.6729000210762024f, -0.2939999997615814f},
+    {0.390500009059906f, 0.4074000120162964f, 0.8255000114440918f},
+    {-0.9128000140190125f, 0.4074000120162964f, -0.02850000001490116f},
+    {0.4657000005245209f, 0.8840000033378601f, -0.04129999876022339f},
+    {-0.2313999980688095f, 0.9434000253677368f, -0.23770000040531158f},
+    {-0.16009999811649323f, 0.6237000226974487f, 0.7651000022888184f},
+    {-0.5939000248908997f, 0.5080000162124634f, 0.6237999796867371f},
+    {0.3968999981880188f, 0.10050000250339508f, -0.9124000072479248f},
+    {0.6780999898910522f, 0.10050000250339508f, -0.7281000018119812f},
+    {-0.17720000445842743f, 0.5673999786376953f, 0.804099977016449f},
+    {-0.6665999889373779f, 0.5673999786376953f, 0.48350000381469727f},
+    {-0.6664999723434448f, 0.18469999730587006f, 0.7222999930381775f},
+    {-0.3962000012397766f, 0.18469999730587006f, 0.899399995803833f},
+    {0.9937000274658203f, 0.0892999991774559f, 0.0674000009894371f},
+    {-0.9332000017166138f, 0.22550000250339508f, -0.2800000011920929f},
+    {0.5753999948501587f, 0.07620000094175339f, 0.814300000667572f},
+    {-0.9763000011444092f, 0.07620000094175339f, -0.20260000228881836f},
+    {0.7886000275611877f, 0.21690000593662262f, 0.5752999782562256f},
+    {-0.8422999978065491f, 0.21690000593662262f, -0.4934000074863434f},
+    {0.9241999983787537f, -0.030400000512599945f, 0.3806000053882599f},
+    {-0.8169000148773193f, 0.0892999991774559f, -0.5698000192642212f},
+    {0.6089000105857849f, -0.6646000146865845f, 0.43309998512268066f},
+    {-0.583299994468689f, -0.7651000022888184f, -0.2728999853134155f},
+    {0.26489999890327454f, -0.9243000149726868f, 0.27489998936653137f},
+    {-0.35749998688697815f, -0.9243999719619751f, -0.133200004696846f},
+    {0.1835000067949295f, -0.8754000067710876f, 0.4471000134944916f},
+    {-0.4832000136375427f, -0.8754000067710876f, 0.010200000368058681f},
+    {0.4609000086784363f, -0.76419997215271f, 0.4510999917984009f},
+    {-0.597599983215332f, -0.76419997215271f, -0.2425999939441681f},
+    {0.48069998621940613f, -0.6367999911308289f, 0.6028000116348267f},
+    {-0.7445999979972839f, -0.6367999911308289f, -0.20020000636577606f},
+    {-0.24709999561309814f, -0.4499000012874603f, 0.8582000136375427f},
+    {-0.6883000135421753f, -0.4499000012874603f, 0.569100022315979f},
+    {0.9020000100135803f, -0.3070000112056732f, -0.303600013256073f},
+    {-0.007199999876320362f, -0.32899999618530273f, -0.9442999958992004f},
+    {0.858299970626831f, -0.23999999463558197f, -0.45350000262260437f},
+    {-0.027799999341368675f, -0.3343000113964081f, -0.9420999884605408f},
+    {0.534500002861023f, -0.8452000021934509f, -0.00139999995008111f},
+    {0.09929999709129333f, -0.8341000080108643f, -0.5425999760627747f},
+    {0.7350999712944031f, -0.6610000133514404f, 0.15049999952316284f},
+    {-0.46209999918937683f, -0.6154000163078308f, -0.6385999917984009f},
+    {0.8255000114440918f, -0.4408000111579895f, -0.35260000824928284f},
+    {-0.006300000008195639f, -0.4408000111579895f, -0.897599995136261f},
+    {-0.17599999904632568f, 0.2854999899864197f, 0.9420999884605408f},
+    {-0.7159000039100647f, 0.48669999837875366f, 0.5005999803543091f},
+    {-0.11379999667406082f, 0.09749999642372131f, 0.9886999726295471f},
+    {-0.8611000180244446f, 0.09749999642372131f, 0.49900001287460327f},
+    {-0.24120000004768372f, 0.19930000603199005f, 0.9498000144958496f},
+    {-0.6909000277519226f, -0.007899999618530273f, 0.7228999733924866f},
+    {-0.3605000078678131f, -0.0835999995470047f, 0.9290000200271606f},
+    {-0.7670999765396118f, -0.07580000162124634f, 0.6370000243186951f},
+    {-0.22930000722408295f, 0.08240000158548355f, 0.9699000120162964f},
+    {-0.9171000123023987f, -0.21979999542236328f, 0.3327000141143799f},
+    {0.11190000176429749f, -0.38499999046325684f, 0.916100025177002f},
+    {-0.8845999836921692f, -0.38499999046325684f, 0.2630999982357025f},
+    {0.03579999879002571f, 0.5580000281333923f, 0.8291000127792358f},
+    {-0.774399995803833f, 0.5580000281333923f, 0.29809999465942383f},
+    {-0.4903999865055084f, 0.8317999839782715f, 0.26019999384880066f},
+    {-0.04280000180006027f, 0.8317999839782715f, 0.5534999966621399f},
+    {-0.9714999794960022f, 0.2222999930381775f, -0.08219999819993973f},
+    {0.3483000099658966f, 0.23659999668598175f, 0.9070000052452087f},
+    {-0.8626999855041504f, -0.3578999936580658f, 0.35740000009536743f},
+    {0.014100000262260437f, -0.3547999858856201f, 0.9348000288009644f},
+    {0.0333000011742115f, -0.5990999937057495f, 0.800000011920929f},
+    {-0.766700029373169f, -0.5252000093460083f, 0.3691999912261963f},
+    {0.30059999227523804f, -0.45669999718666077f, 0.8373000025749207f},
+    {-0.8877000212669373f, -0.45669999718666077f, 0.05860000103712082f},
+    {0.7627999782562256f, -0.613099992275238f, 0.20569999516010284f},
+    {-0.5974000096321106f, -0.7657999992370605f, -0.23819999396800995f},
+    {-0.6644999980926514f, 0.2922999858856201f, 0.6877999901771545f},
+    {-0.33160001039505005f, 0.2732999920845032f, 0.902999997138977f},
+    {0.8841000199317932f, -0.3578000068664551f, 0.3005000054836273f},
+    {-0.6284000277519226f, -0.3578000068664551f, -0.6906999945640564f},
+    {-0.48159998655319214f, 0.3398999869823456f, 0.8077999949455261f},
+    {-0.5485000014305115f, 0.3398999869823456f, 0.7639999985694885f},
+    {0.05209999904036522f, 0.9064000248908997f, 0.41929998993873596f},
+    {-0.4052000045776367f, 0.9064000248908997f, 0.11959999799728394f},
+    {-0.049400001764297485f, -0.4480000138282776f, 0.8927000164985657f},
+    {-0.9706000089645386f, 0.1688999980688095f, 0.17159999907016754f},
+    {0.12160000205039978f, -0.5533999800682068f, 0.8240000009536743f},
+    {-0.8356999754905701f, -0.4074999988079071f, -0.36809998750686646f},
+    {0.06319999694824219f, -0.31220000982284546f, 0.9478999972343445f},
+    {-0.8285999894142151f, -0.5217000246047974f, 0.20340000092983246f},
+    {0.12999999523162842f, -0.5533000230789185f, 0.8227999806404114f},
+    {-0.9225000143051147f, -0.257099986076355f, 0.28790000081062317f},
+    {0.7906000018119812f, 0.5322999954223633f, 0.302700012922287f},
+    {-0.5931000113487244f, 0.5322999954223633f, -0.6040999889373779f},
+    {0.8169999718666077f, -0.3765000104904175f, 0.4366999864578247f},
+    {-0.6159999966621399f, -0.444599986076355f, -0.6503000259399414f},
+    {0.8737999796867371f, -0.01810000091791153f, 0.48590001463890076f},
+    {-0.7943000197410583f, -0.01810000091791153f, -0.607200026512146f},
+    {0.4187000095844269f, -0.6643999814987183f, 0.6190999746322632f},
+    {-0.7347000241279602f, -0.6643999814987183f, -0.13670000433921814f},
+    {0.6053000092506409f, -0.6176000237464905f, 0.5020999908447266f},
+    {-0.7357000112533569f, -0.5946999788284302f, -0.32409998774528503f},
+    {0.5231999754905701f, -0.7021999955177307f, 0.4828000068664551f},
+    {-0.6514999866485596f, -0.7021999955177307f, -0.28700000047683716f},
+    {0.09239999949932098f, 0.9921000003814697f, 0.08529999852180481f},
+    {-0.13539999723434448f, 0.963100016117096f, -0.23270000517368317f},
+    {0.7317000031471252f, 0.31450000405311584f, 0.6047999858856201f},
+    {-0.858299970626831f, 0.34689998626708984f, -0.3781000077724457f},
+    {0.4629000127315521f, -0.7767000198364258f, 0.42719998955726624f},
+    {-0.5764999985694885f, -0.7767000198364258f, -0.2538999915122986f},
+    {-0.0f, 1.0f, -0.0f},
+    {0.3133000135421753f, -0.6898999810218811f, 0.6525999903678894f},
+    {-0.7233999967575073f, -0.6898999810218811f, -0.02669999934732914f},
+    {0.01899999938905239f, -0.8808000087738037f, 0.4731999933719635f},
+    {-0.4413999915122986f, -0.8808000087738037f, 0.17139999568462372f},
+    {-0.49390000104904175f, -0.5252000093460083f, -0.6930000185966492f},
+    {0.8170999884605408f, -0.5080000162124634f, 0.27250000834465027f},
+    {-0.38429999351501465f, 0.24289999902248383f, -0.8906999826431274f},
+    {0.9704999923706055f, 0.23770000040531158f, 0.04050000011920929f},
+    {-0.33379998803138733f, 0.7846999764442444f, -0.5223000049591064f},
+    {0.6121000051498413f, 0.7846999764442444f, 0.09759999811649323f},
+    {-0.08340000361204147f, 0.9898999929428101f, 0.1143999993801117f},
+    {0.10019999742507935f, 0.9939000010490417f, 0.04699999839067459f},
+    {-0.45719999074935913f, 0.03920000046491623f, 0.8884999752044678f},
+    {-0.6851000189781189f, 0.009700000286102295f, 0.7283999919891357f},
+    {-0.32330000400543213f, 0.0851999968290329f, 0.9423999786376953f},
+    {-0.8443999886512756f, 0.04129999876022339f, 0.5342000126838684f},
+    {-0.2685000002384186f, 0.09260000288486481f, 0.9588000178337097f},
+    {-0.7718999981880188f, 0.09260000288486481f, 0.6288999915122986f},
+    {-0.3598000109195709f, 0.012400000356137753f, 0.9329000115394592f},
+    {-0.6455000042915344f, 0.04580000042915344f, 0.7623999714851379f},
+    {-0.513700008392334f, 0.38670000433921814f, 0.7659000158309937f},
+    {-0.49709999561309814f, 0.38670000433921814f, 0.7767000198364258f},
+    {-0.19020000100135803f, -0.036400001496076584f, 0.9811000227928162f},
+    {-0.8510000109672546f, -0.03200000151991844f, 0.5242000222206116f},
+    {-0.3084000051021576f, -0.18970000743865967f, 0.9320999979972839f},
+    {-0.7432000041007996f, 0.0723000019788742f, 0.6651999950408936f},
+    {-0.7505999803543091f, 0.6087999939918518f, 0.25679999589920044f},
+    {-0.07750000059604645f, 0.7454000115394592f, 0.6621999740600586f},
+    {0.1648000031709671f, 0.18019999563694f, 0.9696999788284302f},
+    {-0.9549000263214111f, 0.18019999563694f, 0.23600000143051147f},
+    {-0.11299999803304672f, -0.20080000162124634f, 0.9731000065803528f},
+    {-0.8657000064849854f, -0.19859999418258667f, 0.4593999981880188f},
+    {0.042899999767541885f, -0.13339999318122864f, 0.9901000261306763f},
+    {-0.7224000096321106f, -0.40619999170303345f, 0.5595999956130981f},
+    {-0.03009999915957451f, 0.2833000123500824f, 0.9585000276565552f},
+    {-0.8668000102043152f, 0.2833000123500824f, 0.41019999980926514f},
+    {-0.16619999706745148f, 0.5802000164985657f, 0.7972999811172485f},
+    {-0.6646999716758728f, 0.5802000164985657f, 0.4706999957561493f},
+    {0.12950000166893005f, -0.9911999702453613f, -0.02800000086426735f},
+    {-0.026000000536441803f, -0.9911999702453613f, -0.1298999935388565f},
+    {0.31299999356269836f, -0.8715000152587891f, 0.3776000142097473f},
+    {-0.47119998931884766f, -0.8715000152587891f, -0.1362999975681305f},
+    {0.6348000168800354f, -0.2540999948978424f, 0.7297000288963318f},
+    {-0.9311000108718872f, -0.2460000067949295f, -0.26930001378059387f},
+    {0.7405999898910522f, 0.5291000008583069f, 0.4142000079154968f},
+    {-0.6894999742507935f, 0.5626999735832214f, -0.4560000002384186f},
+    {-0.09239999949932098f, 0.9438999891281128f, -0.31700000166893005f},
+    {0.35249999165534973f, 0.9243000149726868f, -0.14640000462532043f},
+    {-0.38510000705718994f, 0.8743000030517578f, -0.2955999970436096f},
+    {0.4611999988555908f, 0.8851000070571899f, 0.0617000013589859f},
+    {0.026599999517202377f, -0.003000000026077032f, -0.9995999932289124f},
+    {0.9162999987602234f, -0.014399999752640724f, -0.4002000093460083f},
+    {0.4194999933242798f, 0.010400000028312206f, -0.9077000021934509f},
+    {0.6647999882698059f, 0.010400000028312206f, -0.7469000220298767f},
+    {0.8395000100135803f, 0.026599999517202377f, -0.5428000092506409f},
+    {0.16259999573230743f, 0.026599999517202377f, -0.986299991607666f},
+    {-0.6775000095367432f, 0.5900999903678894f, -0.4390999972820282f},
+    {0.5871999859809875f, 0.678600013256073f, 0.44119998812675476f},
+    {0.8325999975204468f, -0.22910000383853912f, -0.5042999982833862f},
+    {0.12999999523162842f, -0.22910000383853912f, -0.9646999835968018f},
+    {-0.012600000016391277f, -0.9943000078201294f, -0.10599999874830246f},
+    {0.1023000031709671f, -0.9943000078201294f, -0.030700000002980232f},
+    {0.16990000009536743f, -0.19709999859333038f, 0.965499997138977f},
+    {-0.9531000256538391f, -0.19709999859333038f, 0.2295999974012375f},
+    {0.44179999828338623f, -0.30169999599456787f, 0.8449000120162964f},
+    {-0.9509999752044678f, -0.30169999599456787f, -0.06780000030994415f},
+    {0.12099999934434891f, -0.7967000007629395f, 0.592199981212616f},
+    {-0.5911999940872192f, -0.7967000007629395f, 0.12540000677108765f},
+    {-0.1680999994277954f, -0.49540001153945923f, 0.8522999882698059f},
+    {-0.7142999768257141f, -0.49540001153945923f, 0.4943000078201294f},
+    {-0.5026999711990356f, -0.571399986743927f, 0.6486999988555908f},
+    {-0.39410001039505005f, -0.571399986743927f, 0.7199000120162964f},
+    {-0.49390000104904175f, -0.8314999938011169f, 0.2542000114917755f},
+    {-0.03590000048279762f, -0.8314999938011169f, 0.5543000102043152f},
+    {-0.8636999726295471f, -0.18629999458789825f, 0.4681999981403351f},
+    {-0.08449999988079071f, -0.18629999458789825f, 0.9787999987602234f},
+    {-0.8815000057220459f, 0.18119999766349792f, 0.4359999895095825f},
+    {-0.0478999987244606f, 0.18119999766349792f, 0.9822999835014343f},
+    {-0.5386999845504761f, 0.551800012588501f, 0.6366000175476074f},
+    {-0.36649999022483826f, 0.6022999882698059f, 0.7091000080108643f},
+    {-0.0851999968290329f, 0.5446000099182129f, 0.8342999815940857f},
+    {-0.7085000276565552f, 0.5231000185012817f, 0.47380000352859497f},
+    {0.4341999888420105f, 0.2939999997615814f, 0.8514999747276306f},
+    {-0.9535999894142151f, 0.29679998755455017f, -0.05009999871253967f},
+    {0.15780000388622284f, 0.20260000228881836f, 0.9664999842643738f},
+    {-0.960099995136261f, 0.1868000030517578f, 0.20839999616146088f},
+    {0.95169997215271f, 0.3057999908924103f, -0.026399999856948853f},
+    {-0.4724000096321106f, 0.34360000491142273f, -0.8116999864578247f},
+    {0.46799999475479126f, 0.8145999908447266f, -0.3425999879837036f},
+    {0.11069999635219574f, 0.8295999765396118f, -0.5472999811172485f},
+    {-0.1404000073671341f, 0.798799991607666f, -0.5849999785423279f},
+    {0.6172000169754028f, 0.7605000138282776f, -0.20180000364780426f},
+    {-0.3702999949455261f, 0.32760000228881836f, -0.8691999912261963f},
+    {0.9381999969482422f, 0.314300000667572f, 0.14509999752044678f},
+    {-0.49470001459121704f, -0.3407999873161316f, -0.7994999885559082f},
+    {0.9304999709129333f, -0.3407999873161316f, 0.13439999520778656f},
+    {-0.061400000005960464f, -0.7605000138282776f, -0.646399974822998f},
+    {0.9214000105857849f, -0.3734000027179718f, 0.10779999941587448f},
+    {-0.4666000008583069f, -0.3734000027179718f, -0.801800012588501f},
+    {-0.20069999992847443f, -0.8432999849319458f, 0.4986000061035156f},
+    {-0.36910000443458557f, -0.8748000264167786f, 0.31380000710487366f},
+    {-0.09700000286102295f, -0.8619999885559082f, 0.4975000023841858f},
+    {-0.43639999628067017f, -0.8655999898910522f, 0.24570000171661377f},
+    {0.1251000016927719f, -0.42559999227523804f, 0.8962000012397766f},
+    {-0.8716999888420105f, -0.42559999227523804f, 0.24300000071525574f},
+    {0.274399995803833f, -0.029899999499320984f, 0.9610999822616577f},
+    {-0.9908000230789185f, -0.029899999499320984f, 0.13199999928474426f},
+    {0.35339999198913574f, 0.06889999657869339f, 0.9329000115394592f},
+    {-0.996399998664856f, 0.06889999657869339f, 0.04839999973773956f},
+    {-0.12460000067949295f, -0.777899980545044f, 0.6158999800682068f},
+    {-0.5149999856948853f, -0.777899980545044f, 0.36010000109672546f},
+    {-0.03610000014305115f, -0.5751000046730042f, 0.817300021648407f},
+    {-0.6179999709129333f, -0.7289999723434448f, 0.29420000314712524f},
+    {0.24950000643730164f, -0.41909998655319214f, 0.8730000257492065f},
+    {-0.8999999761581421f, -0.41909998655319214f, 0.11969999969005585f},
+    {0.03689999878406525f, -0.2978000044822693f, 0.9538999795913696f},
+    {-0.9133999943733215f, -0.39149999618530273f, 0.11150000244379044f},
+    {0.4472000002861023f, 0.36059999465942383f, 0.8184999823570251f},
+    {-0.7470999956130981f, 0.3425000011920929f, 0.569599986076355f},
+    {0.10679999738931656f, 0.6448000073432922f, 0.7567999958992004f},
+    {-0.7361000180244446f, 0.6481999754905701f, 0.19460000097751617f},
+    {0.17739999294281006f, 0.49239999055862427f, 0.8521000146865845f},
+    {-0.8521000146865845f, 0.49239999055862427f, 0.17739999294281006f},
+    {-0.4381999969482422f, 0.6685000061988831f, 0.6008999943733215f},
+    {-0.37220001220703125f, 0.656000018119812f, 0.6565999984741211f},
+    {-0.9241999983787537f, 0.376800000667572f, 0.06270000338554382f},
+    {0.23819999396800995f, 0.27149999141693115f, 0.9325000047683716f},
+    {-0.7993000149726868f, 0.5774000287055969f, 0.1665000021457672f},
+    {0.17339999973773956f, 0.526199996471405f, 0.8324999809265137f},
+    {0.021299999207258224f, -0.3230000138282776f, 0.9460999965667725f},
+    {-0.7476000189781189f, -0.6280999779701233f, 0.21580000221729279f},
+    {-0.28690001368522644f, -0.4684999883174896f, 0.8356000185012817f},
+    {-0.6517000198364258f, -0.4684999883174896f, 0.5965999960899353f},
+    {-0.5605000257492065f, -0.5009999871253967f, 0.659500002861023f},
+    {-0.4171999990940094f, -0.579200029373169f, 0.7002999782562256f},
+    {-0.5105000138282776f, -0.5759000182151794f, 0.6385999917984009f},
+    {-0.2612000107765198f, -0.7843000292778015f, 0.5626999735832214f},
+    {-0.251800000667572f, -0.8644999861717224f, 0.4350999891757965f},
+    {-0.585099995136261f, -0.16949999332427979f, 0.7930999994277954f},
+    {-0.37119999527931213f, -0.31279999017715454f, 0.8743000030517578f},
+    {-0.8511000275611877f, -0.0608999989926815f, 0.5214999914169312f},
+    {-0.11959999799728394f, -0.18119999766349792f, 0.9761000275611877f},
+    {-0.786899983882904f, -0.18279999494552612f, 0.5892999768257141f},
+    {-0.22669999301433563f, -0.27619999647140503f, 0.9340000152587891f},
+    {-0.7827000021934509f, -0.3068000078201294f, 0.5414999723434448f},
+    {-0.05909999832510948f, -0.24079999327659607f, 0.9688000082969666f},
+    {-0.7653999924659729f, 0.21130000054836273f, 0.6079000234603882f},
+    {-0.564300000667572f, -0.1898999959230423f, 0.8033999800682068f},
+    {-0.5113999843597412f, -0.1898999959230423f, 0.838100016117096f},
+    {-0.3100000023841858f, -0.49559998512268066f, 0.8112999796867371f},
+    {-0.9380999803543091f, -0.2915000021457672f, 0.1873999983072281f},
+    {-0.273499995470047f, -0.3497999906539917f, 0.8960000276565552f},
+    {-0.7123000025749207f, -0.3497999906539917f, 0.6085000038146973f},
+    {-0.49630001187324524f, -0.08449999988079071f, 0.8640999794006348f},
+    {-0.5275999903678894f, -0.23160000145435333f, 0.817300021648407f},
+    {-0.42750000953674316f, -0.6506999731063843f, 0.6276000142097473f},
+    {-0.4047999978065491f, -0.6506999731063843f, 0.6424000263214111f},
+    {-0.23819999396800995f, -0.5475999712944031f, 0.8021000027656555f},
+    {-0.6403999924659729f, -0.5475999712944031f, 0.5385000109672546f},
+    {-0.21080000698566437f, -0.3928000032901764f, 0.8950999975204468f},
+    {-0.7742000222206116f, -0.16619999706745148f, 0.6107000112533569f},
+    {-0.2897999882698059f, -0.01640000008046627f, 0.9570000171661377f},
+    {-0.7616999745368958f, -0.01640000008046627f, 0.6477000117301941f},
+    {-0.23819999396800995f, -0.14319999516010284f, 0.9606000185012817f},
+    {-0.7857000231742859f, -0.14319999516010284f, 0.6018999814987183f},
+    {-0.5278000235557556f, 0.051100000739097595f, 0.8478000164031982f},
+    {-0.5432999730110168f, -0.06509999930858612f, 0.8370000123977661f},
+    {0.7261000275611877f, -0.6086999773979187f, 0.3199000060558319f},
+    {-0.5831000208854675f, -0.6086999773979187f, -0.5379999876022339f},
+    {0.9358000159263611f, 0.19189999997615814f, 0.2955999970436096f},
+    {-0.644599974155426f, 0.19189999997615814f, -0.7401000261306763f},
+    {0.2973000109195709f, 0.9164999723434448f, -0.2678000032901764f},
+    {0.17739999294281006f, 0.9003999829292297f, -0.39719998836517334f},
+    {-0.8355000019073486f, 0.5491999983787537f, 0.015300000086426735f},
+    {0.219200000166893f, -0.8639000058174133f, 0.45350000262260437f},
+    {-0.43869999051094055f, -0.8956000208854675f, -0.07329999655485153f},
+    {-0.7402999997138977f, 0.666700005531311f, -0.08659999817609787f},
+    {0.3749000132083893f, 0.666700005531311f, 0.6442000269889832f},
+    {-0.2011999934911728f, 0.8086000084877014f, 0.5529000163078308f},
+    {-0.42660000920295715f, 0.8086000084877014f, 0.4052000045776367f},
+    {0.3249000012874603f, 0.2971000075340271f, 0.8978999853134155f},
+    {-0.9544000029563904f, 0.28700000047683716f, 0.08219999819993973f},
+    {0.17509999871253967f, -0.8575000166893005f, 0.4837999939918518f},
+    {-0.5134999752044678f, -0.8575000166893005f, 0.032600000500679016f},
+    {-0.5023999810218811f, 0.22470000386238098f, 0.8349000215530396f},
+    {-0.5741000175476074f, 0.23430000245571136f, 0.784500002861023f},
+    {-0.41519999504089355f, -0.26089999079704285f, 0.8715000152587891f},
+    {-0.633400022983551f, -0.26089999079704285f, 0.728600025177002f},
+    {-0.36419999599456787f, -0.8205999732017517f, 0.4404999911785126f},
+    {-0.25859999656677246f, -0.8205999732017517f, 0.5097000002861023f},
+    {0.2728999853134155f, 0.2816999852657318f, 0.9199000000953674f},
+    {-0.9523000121116638f, 0.2816999852657318f, 0.1168999969959259f},
+    {-0.2378000020980835f, 0.0737999975681305f, 0.968500018119812f},
+    {-0.8503999710083008f, -0.4309999942779541f, 0.30160000920295715f},
+    {-0.2892000079154968f, 0.06620000302791595f, 0.9549999833106995f},
+    {-0.7886000275611877f, 0.031099999323487282f, 0.6140999794006348f},
+    {0.49219998717308044f, 0.20589999854564667f, 0.84579998254776f},
+    {-0.9185000061988831f, 0.39100000262260437f, 0.059300001710653305f},
+    {0.5346999764442444f, 0.19939999282360077f, 0.8212000131607056f},
+    {-0.9416999816894531f, 0.3179999887943268f, -0.11020000278949738f},
+    {0.6500999927520752f, 0.06639999896287918f, 0.7569000124931335f},
+    {-0.953499972820282f, 0.06639999896287918f, -0.2939999997615814f},
+    {-0.026000000536441803f, -0.8654999732971191f, 0.5002999901771545f},
+    {-0.6378999948501587f, -0.41609999537467957f, 0.6480000019073486f},
+    {-0.6743999719619751f, -0.20430000126361847f, 0.7095999717712402f},
+    {-0.3813999891281128f, -0.20430000126361847f, 0.9014999866485596f},
+    {-0.6366999745368958f, -0.18289999663829803f, 0.7491000294685364f},
+    {-0.4327000081539154f, -0.18289999663829803f, 0.8827999830245972f},
+    {-0.6442000269889832f, 0.3122999966144562f, 0.698199987411499f},
+    {-0.382999986410141f, 0.3122999966144562f, 0.8694000244140625f},
+    {-0.6471999883651733f, 0.685699999332428f, -0.3330000042915344f},
+    {0.5637000203132629f, 0.685699999332428f, 0.46050000190734863f},
+    {-0.4844000041484833f, -0.28700000047683716f, 0.8263999819755554f},
+    {-0.5644000172615051f, -0.28700000047683716f, 0.7739999890327454f},
+    {-0.8802000284194946f, -0.3292999863624573f, 0.3418000042438507f},
+    {0.03790000081062317f, -0.3292999863624573f, 0.9434999823570251f},
+    {-0.8859000205993652f, -0.11299999803304672f, 0.4498000144958496f},
+    {-0.058800000697374344f, -0.11299999803304672f, 0.9919000267982483f},
+    {-0.7433000206947327f, 0.10379999876022339f, 0.6607999801635742f},
+    {-0.39629998803138733f, -0.008999999612569809f, 0.9180999994277954f},
+    {-0.8795999884605408f, -0.4595000147819519f, 0.12280000001192093f},
+    {-0.053199999034404755f, -0.48739999532699585f, 0.8715999722480774f},
+    {-0.5149000287055969f, -0.6359000205993652f, 0.5748999714851379f},
+    {-0.3215000033378601f, -0.6359000205993652f, 0.7016000151634216f},
+    {-0.006399999838322401f, -0.6211000084877014f, 0.7836999893188477f},
+    {-0.7160000205039978f, -0.6211000084877014f, 0.31869998574256897f},
+    {-0.04190000146627426f, -0.35569998621940613f, 0.9337000250816345f},
+    {-0.8392999768257141f, -0.35569998621940613f, 0.41110000014305115f},
+    {0.04969999939203262f, -0.08389999717473984f, 0.995199978351593f},
+    {-0.9323999881744385f, -0.08389999717473984f, 0.3517000079154968f},
+    {0.039900001138448715f, 0.11550000309944153f, 0.9925000071525574f},
+    {-0.9203000068664551f, 0.11969999969005585f, 0.3723999857902527f},
+    {0.1378999948501587f, 0.6574000120162964f, 0.7408000230789185f},
+    {-0.7889999747276306f, 0.4081999957561493f, 0.459199994802475f},
+    {-0.19900000095367432f, 0.34779998660087585f, 0.9161999821662903f},
+    {-0.7605999708175659f, 0.34779998660087585f, 0.5482000112533569f},
+    {-0.3799000084400177f, 0.3774000108242035f, 0.8445000052452087f},
+    {-0.6226999759674072f, 0.3774000108242035f, 0.6854000091552734f},
+    {-0.5078999996185303f, 0.2305999994277954f, 0.8299999833106995f},
+    {-0.5582000017166138f, 0.2305999994277954f, 0.796999990940094f},
+    {-0.10729999840259552f, -0.5738999843597412f, 0.8119000196456909f},
+    {-0.7469000220298767f, -0.21809999644756317f, 0.6280999779701233f},
+    {-0.2944999933242798f, -0.22519999742507935f, 0.9286999702453613f},
+    {-0.734000027179718f, -0.22519999742507935f, 0.6407999992370605f},
+    {-0.5716999769210815f, -0.3156000077724457f, 0.7573000192642212f},
+    {0.09380000084638596f, -0.833899974822998f, 0.5439000129699707f},
+    {-0.37119999527931213f, -0.9071000218391418f, 0.19859999418258667f},
+    {-0.4072999954223633f, -0.7821999788284302f, 0.4713999927043915f},
+    {-0.7799999713897705f, -0.23970000445842743f, 0.578000009059906f},
+    {-0.21860000491142273f, -0.23970000445842743f, 0.945900022983551f},
+    {-0.8687999844551086f, 0.05079999938607216f, 0.4925000071525574f},
+    {-0.301800012588501f, -0.05770000070333481f, 0.9516000151634216f},
+    {-0.5210999846458435f, 0.40720000863075256f, 0.7501000165939331f},
+    {-0.4797999858856201f, 0.40720000863075256f, 0.7771999835968018f},
+    {-0.4408999979496002f, 0.6815000176429749f, 0.5841000080108643f},
+    {-0.43810001015663147f, 0.5546000003814697f, 0.7074999809265137f},
+    {-0.14669999480247498f, 0.5220999717712402f, 0.8402000069618225f},
+    {-0.6858000159263611f, 0.6341999769210815f, 0.3571999967098236f},
+    {0.3718999922275543f, -0.3158000111579895f, 0.8729000091552734f},
+    {-0.9488000273704529f, -0.3158000111579895f, 0.007499999832361937f},
+    {0.35429999232292175f, -0.08070000261068344f, 0.9315999746322632f},
+    {-0.9955999851226807f, -0.08070000261068344f, 0.04699999839067459f},
+    {0.3264000117778778f, 0.12099999934434891f, 0.9375f},
+    {-0.989799976348877f, 0.12099999934434891f, 0.07500000298023224f},
+    {-0.3325999975204468f, 0.6811000108718872f, -0.6523000001907349f},
+    {0.7307999730110168f, 0.6811000108718872f, 0.044599998742341995f},
+    {-0.5041999816894531f, 0.36500000953674316f, -0.7825999855995178f},
+    {0.9187999963760376f, 0.36500000953674316f, 0.14990000426769257f},
+    {0.06599999964237213f, 0.8626000285148621f, -0.5016000270843506f},
+    {0.4490000009536743f, 0.8709999918937683f, -0.19920000433921814f},
+    {0.6585999727249146f, 0.7488999962806702f, 0.0738999992609024f},
+    {-0.32829999923706055f, 0.7444999814033508f, -0.5813999772071838f},
+    {0.4666000008583069f, 0.8833000063896179f, -0.045499999076128006f},
+    {-0.1307000070810318f, 0.8684999942779541f, -0.4781999886035919f},
+    {0.39070001244544983f, 0.9158999919891357f, -0.0925000011920929f},
+    {-0.07109999656677246f, 0.9158999919891357f, -0.3950999975204468f},
+    {0.9896000027656555f, 0.13230000436306f, -0.05700000002980232f},
+    {-0.5002999901771545f, 0.13429999351501465f, -0.855400025844574f},
+    {0.6585999727249146f, -0.7523999810218811f, -0.012199999764561653f},
+    {-0.2517000138759613f, -0.7523999810218811f, -0.6086999773979187f},
+    {0.6378999948501587f, -0.7322999835014343f, -0.2386000007390976f},
+    {-0.03579999879002571f, -0.7322999835014343f, -0.6801000237464905f},
+    {0.5375000238418579f, -0.6643999814987183f, -0.5192999839782715f},
+    {0.16269999742507935f, -0.38580000400543213f, -0.9081000089645386f},
+    {0.7745000123977661f, -0.012500000186264515f, -0.6324999928474426f},
+    {0.3716000020503998f, -0.09759999811649323f, -0.9232000112533569f},
+    {0.7159000039100647f, -0.31119999289512634f, -0.625f},
+    {0.4618000090122223f, -0.5633000135421753f, -0.6851000189781189f},
+    {0.1014999970793724f, -0.9947999715805054f, -0.012799999676644802f},
+    {-0.02879999950528145f, -0.9947999715805054f, -0.09809999912977219f},
+    {0.2061000019311905f, -0.9718000292778015f, -0.11479999870061874f},
+    {0.023000000044703484f, -0.9718000292778015f, -0.23479999601840973f},
+    {0.7587000131607056f, -0.5620999932289124f, 0.32919999957084656f},
+    {-0.6047000288963318f, -0.5620999932289124f, -0.564300000667572f},
+    {0.960099995136261f, 0.1395999938249588f, 0.24230000376701355f},
+    {-0.605400025844574f, 0.1395999938249588f, -0.7835999727249146f},
+    {0.6389999985694885f, -0.027400000020861626f, -0.7687000036239624f},
+    {0.4496999979019165f, -0.027400000020861626f, -0.892799973487854f},
+    {0.37880000472068787f, -0.3634999990463257f, -0.8511000275611877f},
+    {0.44200000166893005f, -0.05299999937415123f, -0.8953999876976013f},
+    {0.6578999757766724f, -0.6779999732971191f, -0.3278999924659729f},
+    {-0.5453000068664551f, 0.1370999962091446f, -0.8269000053405762f},
+    {0.9707000255584717f, 0.13930000364780426f, 0.19589999318122864f},
+    {-0.5670999884605408f, 0.13930000364780426f, -0.8118000030517578f},
+    {0.8924000263214111f, 0.267300009727478f, 0.3635999858379364f},
+    {-0.6571999788284302f, 0.3440000116825104f, -0.6705999970436096f},
+    {0.902400016784668f, 0.28130000829696655f, 0.3264999985694885f},
+    {-0.6226999759674072f, 0.36419999599456787f, -0.6926000118255615f},
+    {0.8999999761581421f, 0.24549999833106995f, 0.36000001430511475f},
+    {-0.8076000213623047f, 0.43369999527931213f, -0.39959999918937683f},
+    {0.47679999470710754f, -0.7864000201225281f, -0.3928000032901764f},
+    {-0.002300000051036477f, -0.9577000141143799f, -0.28769999742507935f},
+    {0.7483999729156494f, -0.47589999437332153f, -0.4620000123977661f},
+    {0.13019999861717224f, -0.47119998931884766f, -0.8723999857902527f},
+    {0.5166000127792358f, -0.8342000246047974f, -0.19300000369548798f},
+    {0.014499999582767487f, -0.8235999941825867f, -0.5669000148773193f},
+    {0.2858000099658966f, -0.9574000239372253f, 0.04179999977350235f},
+    {-0.15240000188350677f, -0.9574000239372253f, -0.24539999663829803f},
+    {0.325300008058548f, -0.9442999958992004f, 0.0502999983727932f},
+    {-0.17599999904632568f, -0.9442999958992004f, -0.27810001373291016f},
+    {0.629800021648407f, -0.47369998693466187f, 0.6155999898910522f},
+    {-0.44999998807907104f, 0.33329999446868896f, -0.828499972820282f},
+    {0.3815000057220459f, -0.6358000040054321f, 0.6710000038146973f},
+    {-0.7674999833106995f, -0.6358000040054321f, -0.0820000022649765f},
+    {0.8323000073432922f, -0.226500004529953f, -0.5059000253677368f},
+    {0.27630001306533813f, -0.04540000110864639f, -0.9599999785423279f},
+    {-0.04170000180602074f, 0.9625999927520752f, 0.2678000032901764f},
+    {-0.23029999434947968f, 0.9657999873161316f, 0.1193000003695488f},
+    {0.2078000009059906f, 0.9733999967575073f, -0.0966000035405159f},
+    {0.00559999980032444f, 0.9733999967575073f, -0.22910000383853912f},
+    {0.6783000230789185f, 0.5710999965667725f, -0.46230000257492065f},
+    {0.15309999883174896f, 0.5710999965667725f, -0.8065000176429749f},
+    {0.36980000138282776f, 0.9287999868392944f, 0.025100000202655792f},
+    {-0.17059999704360962f, 0.9287999868392944f, -0.32910001277923584f},
+    {-0.29339998960494995f, 0.7954999804496765f, 0.5302000045776367f},
+    {-0.36899998784065247f, 0.7954999804496765f, 0.48069998621940613f},
+    {0.4187000095844269f, 0.769599974155426f, 0.4821000099182129f},
+    {-0.6092000007629395f, 0.769599974155426f, -0.19140000641345978f},
+    {0.701200008392334f, 0.685699999332428f, 0.19509999454021454f},
+    {-0.45879998803138733f, 0.685699999332428f, -0.5651000142097473f},
+    {0.9297999739646912f, 0.2517000138759613f, -0.2687000036239624f},
+    {-0.21580000221729279f, 0.1363999992609024f, -0.9668999910354614f},
+    {0.6809999942779541f, 0.5703999996185303f, -0.459199994802475f},
+    {0.14920000731945038f, 0.5703999996185303f, -0.807699978351593f},
+    {0.6096000075340271f, 0.7623999714851379f, 0.21719999611377716f},
+    {-0.4424999952316284f, 0.7623999714851379f, -0.4722999930381775f},
+    {0.4968000054359436f, 0.6833000183105469f, 0.5350000262260437f},
+    {-0.6888999938964844f, 0.6833000183105469f, -0.24199999868869781f},
+    {0.23839999735355377f, 0.382999986410141f, 0.8924999833106995f},
+    {-0.9133999943733215f, 0.382999986410141f, 0.13770000636577606f},
+    {0.31029999256134033f, 0.9434000253677368f, 0.11729999631643295f},
+    {-0.14810000360012054f, 0.8840000033378601f, -0.44350001215934753f},
+    {-0.33489999175071716f, 0.5080000162124634f, 0.7936000227928162f},
+    {-0.6376000046730042f, 0.6237000226974487f, 0.4521999955177307f},
+    {0.3831999897956848f, 0.1145000010728836f, -0.9164999723434448f},
+    {0.6873999834060669f, 0.1145000010728836f, -0.717199981212616f},
+    {-0.11810000240802765f, 0.9462000131607056f, -0.3010999858379364f},
+    {0.323199987411499f, 0.9462000131607056f, -0.011900000274181366f},
+    {0.6291999816894531f, 0.22550000250339508f, 0.7437999844551086f},
+    {-0.45840001106262207f, 0.0892999991774559f, -0.8841999769210815f},
+    {0.7174999713897705f, 0.12409999966621399f, 0.6854000091552734f},
+    {-0.914900004863739f, 0.12409999966621399f, -0.38429999351501465f},
+    {0.9316999912261963f, 0.14720000326633453f, 0.3319999873638153f},
+    {-0.6762999892234802f, 0.14720000326633453f, -0.7217000126838684f},
+    {0.8485000133514404f, 0.0892999991774559f, 0.5216000080108643f},
+    {-0.7178999781608582f, -0.030400000512599945f, -0.6955000162124634f},
+    {0.4830000102519989f, -0.7651000022888184f, 0.42590001225471497f},
+    {-0.6401000022888184f, -0.6646000146865845f, -0.3853999972343445f},
+    {0.2648000121116638f, -0.9243999719619751f, 0.27459999918937683f},
+    {-0.3578000068664551f, -0.9243000149726868f, -0.133200004696846f},
+    {0.35830000042915344f, -0.8353999853134155f, 0.41679999232292175f},
+    {-0.5252000093460083f, -0.8353999853134155f, -0.16210000216960907f},
+    {-0.17870000004768372f, -0.5236999988555908f, 0.8328999876976013f},
+    {-0.692300021648407f, -0.5236999988555908f, 0.49639999866485596f},
+    {0.8687000274658203f, -0.32899999618530273f, -0.3702999949455261f},
+    {-0.08169999718666077f, -0.3070000112056732f, -0.948199987411499f},
+    {0.8748999834060669f, -0.3343000113964081f, -0.3504999876022339f},
+    {0.07320000231266022f, -0.23999999463558197f, -0.9679999947547913f},
+    {0.4578999876976013f, -0.8341000080108643f, -0.3075999915599823f},
+    {-0.21199999749660492f, -0.8452000021934509f, -0.49059998989105225f},
+    {0.7699000239372253f, -0.6154000163078308f, 0.1687999963760376f},
+    {-0.43140000104904175f, -0.6610000133514404f, -0.6140000224113464f},
+    {-0.17319999635219574f, 0.48669999837875366f, 0.8561999797821045f},
+    {-0.7935000061988831f, 0.2854999899864197f, 0.5375000238418579f},
+    {-0.07519999891519547f, 0.25929999351501465f, 0.9628999829292297f},
+    {-0.8528000116348267f, 0.25929999351501465f, 0.45329999923706055f},
+    {-0.3869999945163727f, -0.007899999618530273f, 0.921999990940094f},
+    {-0.7746000289916992f, 0.19930000603199005f, 0.6003000140190125f},
+    {-0.27790001034736633f, -0.07580000162124634f, 0.9575999975204468f},
+    {-0.7077999711036682f, -0.0835999995470047f, 0.7013999819755554f},
+    {0.061000000685453415f, -0.21979999542236328f, 0.9735999703407288f},
+    {-0.7976999878883362f, 0.08240000158548355f, 0.5974000096321106f},
+    {0.1421000063419342f, -0.193900004029274f, 0.9707000255584717f},
+    {-0.9466999769210815f, -0.193900004029274f, 0.2572000026702881f},
+    {0.055799998342990875f, 0.7505999803543091f, 0.6583999991416931f},
+    {-0.6258999705314636f, 0.7505999803543091f, 0.21170000731945038f},
+    {-0.49129998683929443f, 0.8295999765396118f, 0.2653000056743622f},
+    {-0.0471000000834465f, 0.8295999765396118f, 0.5562999844551086f},
+    {-0.9707000255584717f, 0.23659999668598175f, 0.04270000010728836f},
+    {0.46309998631477356f, 0.2222999930381775f, 0.8579000234603882f},
+    {-0.8628000020980835f, -0.3547999858856201f, 0.3601999878883362f},
+    {0.016699999570846558f, -0.3578999936580658f, 0.9336000084877014f},
+    {-0.03240000084042549f, -0.5252000093460083f, 0.8503999710083008f},
+    {-0.7468000054359436f, -0.5990999937057495f, 0.2888000011444092f},
+    {0.2615000009536743f, -0.44279998540878296f, 0.8575999736785889f},
+    {-0.8906999826431274f, -0.44279998540878296f, 0.10260000079870224f},
+    {0.45680001378059387f, -0.7657999992370605f, 0.4526999890804291f},
+    {-0.49300000071525574f, -0.613099992275238f, -0.6172999739646912f},
+    {-0.6955000162124634f, 0.2732999920845032f, 0.6644999980926514f},
+    {-0.3653999865055084f, 0.2922999858856201f, 0.8838000297546387f},
+    {0.8547999858856201f, -0.38690000772476196f, 0.3458999991416931f},
+    {-0.6583999991416931f, -0.38690000772476196f, -0.6456999778747559f},
+    {-0.3880999982357025f, -0.08910000324249268f, 0.9172999858856201f},
+    {-0.6861000061035156f, -0.08910000324249268f, 0.722000002861023f},
+    {-0.4007999897003174f, 0.8971999883651733f, 0.18549999594688416f},
+    {-0.010099999606609344f, 0.8971999883651733f, 0.4415000081062317f},
+    {0.23010000586509705f, 0.1688999980688095f, 0.9584000110626221f},
+    {-0.798799991607666f, -0.4480000138282776f, 0.4016000032424927f},
+    {0.10819999873638153f, 0.5843999981880188f, 0.8041999936103821f},
+    {-0.7806000113487244f, 0.5843999981880188f, 0.22179999947547913f},
+    {0.6711000204086304f, -0.4074999988079071f, 0.6193000078201294f},
+    {-0.804099977016449f, -0.5533999800682068f, 0.21739999949932098f},
+    {0.14419999718666077f, -0.5217000246047974f, 0.8409000039100647f},
+    {-0.8942999839782715f, -0.31220000982284546f, 0.320499986410141f},
+    {0.10419999808073044f, -0.257099986076355f, 0.9606999754905701f},
+    {-0.8062999844551086f, -0.5533000230789185f, 0.20919999480247498f},
+    {0.7300999760627747f, -0.4787999987602234f, 0.48750001192092896f},
+    {-0.7383999824523926f, -0.4787999987602234f, -0.4747999906539917f},
+    {0.8421000242233276f, -0.444599986076355f, 0.3052000105381012f},
+    {-0.7264999747276306f, -0.3765000104904175f, -0.5748000144958496f},
+    {0.5910000205039978f, -0.6363000273704529f, 0.4959000051021576f},
+    {-0.6905999779701233f, -0.6363000273704529f, -0.34389999508857727f},
+    {0.5907999873161316f, -0.5946999788284302f, 0.545199990272522f},
+    {-0.7020000219345093f, -0.6176000237464905f, -0.3544999957084656f},
+    {0.26739999651908875f, 0.963100016117096f, 0.031300000846385956f},
+    {-0.11509999632835388f, 0.9921000003814697f, -0.050700001418590546f},
+    {0.689300000667572f, 0.34689998626708984f, 0.6359999775886536f},
+    {-0.8465999960899353f, 0.31450000405311584f, -0.4293999969959259f},
+    {0.5914000272750854f, -0.707099974155426f, 0.38760000467300415f},
+    {-0.5914000272750854f, -0.707099974155426f, -0.38760000467300415f},
+    {-0.09059999883174896f, 0.989799976348877f, 0.10970000177621841f},
+    {-0.06440000236034393f, 0.989799976348877f, 0.12690000236034393f},
+    {0.3621000051498413f, -0.7210999727249146f, 0.5906000137329102f},
+    {-0.6861000061035156f, -0.7210999727249146f, -0.09619999676942825f},
+    {0.043299999088048935f, -0.9021999835968018f, 0.4291999936103821f},
+    {-0.4108000099658966f, -0.9021999835968018f, 0.13169999420642853f},
+    {-0.65420001745224f, -0.4853000044822693f, -0.5800999999046326f},
+    {-0.45890000462532043f, 0.23280000686645508f, -0.8575000166893005f},
+    {-0.08309999853372574f, 0.9939000010490417f, -0.0731000006198883f},
+    {-0.07159999758005142f, 0.9898999929428101f, 0.12219999730587006f},
+    {-0.3944000005722046f, 0.009700000286102295f, 0.9189000129699707f},
+    {-0.6322000026702881f, 0.03920000046491623f, 0.7738000154495239f},
+    {-0.1527000069618225f, 0.04129999876022339f, 0.9873999953269958f},
+    {-0.7350000143051147f, 0.0851999968290329f, 0.6726999878883362f},
+    {-0.24819999933242798f, -0.04610000178217888f, 0.9675999879837036f},
+    {-0.788100004196167f, -0.04610000178217888f, 0.6137999892234802f},
+    {-0.4413999915122986f, 0.04580000042915344f, 0.8962000012397766f},
+    {-0.7117000222206116f, 0.012400000356137753f, 0.7023000121116638f},
+    {0.03620000183582306f, 0.1915999948978424f, 0.9807999730110168f},
+    {-0.9136999845504761f, 0.1915999948978424f, 0.35830000042915344f},
+    {-0.14100000262260437f, -0.03200000151991844f, 0.9894999861717224f},
+    {-0.8235999941825867f, -0.036400001496076584f, 0.5659999847412109f},
+    {-0.3133000135421753f, 0.0723000019788742f, 0.9469000101089478f},
+    {-0.7315999865531921f, -0.18970000743865967f, 0.6547999978065491f},
+    {-0.4300000071525574f, -0.02250000089406967f, 0.9025999903678894f},
+    {-0.6559000015258789f, -0.02250000089406967f, 0.7544999718666077f},
+    {-0.576200008392334f, 0.7454000115394592f, 0.3352999985218048f},
+    {0.0640999972820282f, 0.6087999939918518f, 0.7907000184059143f},
+    {0.01810000091791153f, -0.1485999971628189f, 0.9886999726295471f},
+    {-0.9138000011444092f, -0.1485999971628189f, 0.3781000077724457f},
+    {-0.07559999823570251f, -0.19859999418258667f, 0.9771999716758728f},
+    {-0.847100019454956f, -0.20080000162124634f, 0.4921000003814697f},
+    {-0.22470000386238098f, -0.40619999170303345f, 0.885699987411499f},
+    {-0.925000011920929f, -0.13339999318122864f, 0.35589998960494995f},
+    {0.051100000739097595f, 0.21639999747276306f, 0.9750000238418579f},
+    {-0.9143000245094299f, 0.21639999747276306f, 0.3424000144004822f},
+    {0.11580000072717667f, -0.9932000041007996f, -0.006899999920278788f},
+    {-0.039900001138448715f, -0.9932000041007996f, -0.10899999737739563f},
+    {0.47620001435279846f, -0.8526999950408936f, 0.21490000188350677f},
+    {-0.3871000111103058f, -0.8526999950408936f, -0.3508000075817108f},
+    {0.6186000108718872f, -0.2460000067949295f, 0.7462000250816345f},
+    {-0.9223999977111816f, -0.2540999948978424f, -0.2906999886035919f},
+    {0.6933000087738037f, 0.5626999735832214f, 0.45019999146461487f},
+    {-0.6754000186920166f, 0.5291000008583069f, -0.513700008392334f},
+    {-0.006500000134110451f, 0.9243000149726868f, -0.3815999925136566f},
+    {0.32760000228881836f, 0.9438999891281128f, -0.04179999977350235f},
+    {-0.24070000648498535f, 0.8851000070571899f, -0.39820000529289246f},
+    {0.424699991941452f, 0.8743000030517578f, 0.23510000109672546f},
+    {0.0012000000569969416f, -0.014399999752640724f, -0.9998999834060669f},
+    {0.9059000015258789f, -0.003000000026077032f, -0.42340001463890076f},
+    {0.31459999084472656f, -0.07490000128746033f, -0.9463000297546387f},
+    {0.7421000003814697f, -0.07490000128746033f, -0.666100025177002f},
+    {-0.6389999985694885f, 0.678600013256073f, -0.36230000853538513f},
+    {0.6729999780654907f, 0.5900999903678894f, 0.44589999318122864f},
+    {0.9609000086784363f, -0.17110000550746918f, -0.21770000457763672f},
+    {-0.18389999866485596f, -0.17110000550746918f, -0.9678999781608582f},
+    {-0.06629999727010727f, -0.8282999992370605f, -0.5564000010490417f},
+    {0.5365999937057495f, -0.8282999992370605f, -0.16130000352859497f},
+};
+constexpr face monkey_0_faces[] = {
+    {0, 3, 0, 0},
+    {3, 3, 0, 1},
+    {6, 3, 0, 2},
+    {9, 3, 0, 3},
+    {12, 3, 0, 4},
+    {15, 3, 0, 5},
+    {18, 3, 0, 6},
+    {21, 3, 0, 7},
+    {24, 3, 0, 8},
+    {27, 3, 0, 9},
+    {30, 3, 0, 10},
+    {33, 3, 0, 11},
+    {36, 4, 0, 12},
+    {40, 4, 0, 13},
+    {44, 3, 0, 14},
+    {47, 3, 0, 15},
+    {50, 3, 0, 16},
+    {53, 3, 0, 17},
+    {56, 4, 0, 18},
+    {60, 4, 0, 19},
+    {64, 4, 0, 20},
+    {68, 4, 0, 21},
+    {72, 3, 0, 22},
+    {75, 3, 0, 23},
+    {78, 3, 0, 24},
+    {81, 3, 0, 25},
+    {84, 4, 0, 26},
+    {88, 4, 0, 27},
+    {92, 3, 0, 28},
+    {95, 3, 0, 29},
+    {98, 3, 0, 30},
+    {101, 3, 0, 31},
+    {104, 3, 0, 32},
+    {107, 3, 0, 33},
+    {110, 3, 0, 34},
+    {113, 3, 0, 35},
+    {116, 3, 0, 36},
+    {119, 3, 0, 37},
+    {122, 3, 0, 38},
+    {125, 3, 0, 39},
+    {128, 3, 0, 40},
+    {131, 3, 0, 41},
+    {134, 3, 0, 42},
+    {137, 4, 0, 43},
+    {141, 4, 0, 44},
+    {145, 4, 0, 45},
+    {149, 3, 0, 46},
+    {152, 3, 0, 47},
+    {155, 3, 0, 48},
+    {158, 3, 0, 49},
+    {161, 3, 0, 50},
+    {164, 3, 0, 51},
+    {167, 3, 0, 52},
+    {170, 3, 0, 53},
+    {173, 3, 0, 54},
+    {176, 3, 0, 55},
+    {179, 3, 0, 56},
+    {182, 3, 0, 57},
+    {185, 3, 0, 58},
+    {188, 3, 0, 59},
+    {191, 3, 0, 60},
+    {194, 3, 0, 61},
+    {197, 3, 0, 62},
+    {200, 3, 0, 63},
+    {203, 3, 0, 64},
+    {206, 3, 0, 65},
+    {209, 3, 0, 66},
+    {212, 3, 0, 67},
+    {215, 3, 0, 68},
+    {218, 3, 0, 69},
+    {221, 3, 0, 70},
+    {224, 3, 0, 71},
+    {227, 3, 0, 72},
+    {230, 3, 0, 73},
+    {233, 3, 0, 74},
+    {236, 3, 0, 75},
+    {239, 3, 0, 76},
+    {242, 3, 0, 77},
+    {245, 3, 0, 78},
+    {248, 3, 0, 79},
+    {251, 3, 0, 80},
+    {254, 3, 0, 81},
+    {257, 3, 0, 82},
+    {260, 3, 0, 83},
+    {263, 3, 0, 84},
+    {266, 3, 0, 85},
+    {269, 3, 0, 86},
+    {272, 3, 0, 87},
+    {275, 3, 0, 88},
+    {278, 3, 0, 89},
+    {281, 3, 0, 90},
+    {284, 3, 0, 91},
+    {287, 3, 0, 92},
+    {290, 3, 0, 93},
+    {293, 3, 0, 94},
+    {296, 3, 0, 95},
+    {299, 3, 0, 96},
+    {302, 3, 0, 97},
+    {305, 3, 0, 98},
+    {308, 3, 0, 99},
+    {311, 3, 0, 100},
+    {314, 3, 0, 101},
+    {317, 3, 0, 102},
+    {320, 3, 0, 103},
+    {323, 3, 0, 104},
+    {326, 3, 0, 105},
+    {329, 3, 0, 106},
+    {332, 3, 0, 107},
+    {335, 3, 0, 108},
+    {338, 3, 0, 109},
+    {341, 3, 0, 110},
+    {344, 3, 0, 111},
+    {347, 3, 0, 112},
+    {350, 3, 0, 113},
+    {353, 3, 0, 114},
+    {356, 3, 0, 115},
+    {359, 3, 0, 116},
+    {362, 3, 0, 117},
+    {365, 3, 0, 118},
+    {368, 3, 0, 119},
+    {371, 3, 0, 120},
+    {374, 3, 0, 121},
+    {377, 3, 0, 122},
+    {380, 3, 0, 123},
+    {383, 3, 0, 124},
+    {386, 3, 0, 125},
+    {389, 3, 0, 126},
+    {392, 3, 0, 127},
+    {395, 3, 0, 128},
+    {398, 3, 0, 129},
+    {401, 3, 0, 130},
+    {404, 3, 0, 131},
+    {407, 3, 0, 132},
+    {410, 3, 0, 133},
+    {413, 3, 0, 134},
+    {416, 3, 0, 134},
+    {419, 3, 0, 135},
+    {422, 3, 0, 136},
+    {425, 3, 0, 137},
+    {428, 3, 0, 138},
+    {431, 3, 0, 139},
+    {434, 3, 0, 140},
+    {437, 3, 0, 141},
+    {440, 3, 0, 142},
+    {443, 3, 0, 143},
+    {446, 3, 0, 144},
+    {449, 3, 0, 145},
+    {452, 3, 0, 146},
+    {455, 3, 0, 147},
+    {458, 3, 0, 148},
+    {461, 3, 0, 149},
+    {464, 3, 0, 150},
+    {467, 3, 0, 151},
+    {470, 3, 0, 152},
+    {473, 3, 0, 153},
+    {476, 3, 0, 154},
+    {479, 3, 0, 155},
+    {482, 3, 0, 156},
+    {485, 3, 0, 157},
+    {488, 3, 0, 158},
+    {491, 3, 0, 159},
+    {494, 3, 0, 160},
+    {497, 3, 0, 161},
+    {500, 3, 0, 162},
+    {503, 3, 0, 163},
+    {506, 3, 0, 164},
+    {509, 3, 0, 165},
+    {512, 3, 0, 166},
+    {515, 3, 0, 167},
+    {518, 3, 0, 168},
+    {521, 3, 0, 169},
+    {524, 3, 0, 170},
+    {527, 3, 0, 171},
+    {530, 3, 0, 172},
+    {533, 3, 0, 173},
+    {536, 3, 0, 174},
+    {539, 3, 0, 175},
+    {542, 3, 0, 176},
+    {545, 3, 0, 177},
+    {548, 3, 0, 178},
+    {551, 3, 0, 134},
+    {554, 3, 0, 134},
+    {557, 3, 0, 179},
+    {560, 3, 0, 180},
+    {563, 3, 0, 181},
+    {566, 3, 0, 182},
+    {569, 3, 0, 141},
+    {572, 3, 0, 183},
+    {575, 3, 0, 184},
+    {578, 3, 0, 185},
+    {581, 3, 0, 186},
+    {584, 3, 0, 187},
+    {587, 3, 0, 188},
+    {590, 3, 0, 189},
+    {593, 3, 0, 190},
+    {596, 3, 0, 191},
+    {599, 3, 0, 192},
+    {602, 3, 0, 193},
+    {605, 3, 0, 194},
+    {608, 3, 0, 195},
+    {611, 3, 0, 196},
+    {614, 3, 0, 197},
+    {617, 3, 0, 198},
+    {620, 3, 0, 199},
+    {623, 3, 0, 200},
+    {626, 3, 0, 201},
+    {629, 3, 0, 202},
+    {632, 3, 0, 203},
+    {635, 3, 0, 204},
+    {638, 3, 0, 205},
+    {641, 3, 0, 206},
+    {644, 3, 0, 207},
+    {647, 3, 0, 208},
+    {650, 3, 0, 209},
+    {653, 3, 0, 210},
+    {656, 3, 0, 211},
+    {659, 3, 0, 212},
+    {662, 3, 0, 213},
+    {665, 3, 0, 214},
+    {668, 3, 0, 215},
+    {671, 3, 0, 216},
+    {674, 3, 0, 217},
+    {677, 3, 0, 218},
+    {680, 3, 0, 219},
+    {683, 3, 0, 220},
+    {686, 3, 0, 221},
+    {689, 3, 0, 222},
+    {692, 3, 0, 223},
+    {695, 3, 0, 224},
+    {698, 3, 0, 225},
+    {701, 3, 0, 226},
+    {704, 3, 0, 227},
+    {707, 3, 0, 228},
+    {710, 3, 0, 229},
+    {713, 3, 0, 230},
+    {716, 3, 0, 231},
+    {719, 3, 0, 232},
+    {722, 3, 0, 233},
+    {725, 3, 0, 234},
+    {728, 3, 0, 235},
+    {731, 3, 0, 236},
+    {734, 3, 0, 237},
+    {737, 3, 0, 238},
+    {740, 3, 0, 239},
+    {743, 3, 0, 240},
+    {746, 3, 0, 241},
+    {749, 3, 0, 242},
+    {752, 3, 0, 243},
+    {755, 3, 0, 244},
+    {758, 3, 0, 245},
+    {761, 3, 0, 246},
+    {764, 3, 0, 247},
+    {767, 3, 0, 248},
+    {770, 3, 0, 249},
+    {773, 3, 0, 250},
+    {776, 3, 0, 251},
+    {779, 3, 0, 252},
+    {782, 3, 0, 253},
+    {785, 3, 0, 254},
+    {788, 3, 0, 255},
+    {791, 3, 0, 256},
+    {794, 3, 0, 257},
+    {797, 3, 0, 258},
+    {800, 3, 0, 259},
+    {803, 3, 0, 260},
+    {806, 3, 0, 261},
+    {809, 3, 0, 262},
+    {812, 3, 0, 263},
+    {815, 3, 0, 264},
+    {818, 3, 0, 265},
+    {821, 3, 0, 266},
+    {824, 3, 0, 267},
+    {827, 3, 0, 268},
+    {830, 3, 0, 269},
+    {833, 3, 0, 270},
+    {836, 3, 0, 271},
+    {839, 3, 0, 272},
+    {842, 3, 0, 273},
+    {845, 3, 0, 274},
+    {848, 3, 0, 275},
+    {851, 3, 0, 276},
+    {854, 3, 0, 277},
+    {857, 3, 0, 278},
+    {860, 3, 0, 279},
+    {863, 3, 0, 280},
+    {866, 3, 0, 281},
+    {869, 3, 0, 282},
+    {872, 3, 0, 283},
+    {875, 3, 0, 284},
+    {878, 3, 0, 285},
+    {881, 3, 0, 286},
+    {884, 3, 0, 287},
+    {887, 3, 0, 288},
+    {890, 3, 0, 289},
+    {893, 3, 0, 290},
+    {896, 3, 0, 291},
+    {899, 3, 0, 292},
+    {902, 3, 0, 293},
+    {905, 3, 0, 294},
+    {908, 3, 0, 295},
+    {911, 3, 0, 296},
+    {914, 3, 0, 297},
+    {917, 3, 0, 298},
+    {920, 3, 0, 299},
+    {923, 3, 0, 300},
+    {926, 3, 0, 301},
+    {929, 3, 0, 302},
+    {932, 3, 0, 303},
+    {935, 3, 0, 304},
+    {938, 3, 0, 305},
+    {941, 3, 0, 306},
+    {944, 3, 0, 307},
+    {947, 3, 0, 308},
+    {950, 3, 0, 309},
+    {953, 3, 0, 310},
+    {956, 3, 0, 311},
+    {959, 3, 0, 312},
+    {962, 3, 0, 313},
+    {965, 3, 0, 314},
+    {968, 3, 0, 315},
+    {971, 3, 0, 316},
+    {974, 3, 0, 317},
+    {977, 3, 0, 318},
+    {980, 3, 0, 319},
+    {983, 3, 0, 320},
+    {986, 3, 0, 321},
+    {989, 3, 0, 322},
+    {992, 3, 0, 323},
+    {995, 3, 0, 324},
+    {998, 3, 0, 325},
+    {1001, 3, 0, 326},
+    {1004, 3, 0, 327},
+    {1007, 3, 0, 328},
+    {1010, 3, 0, 329},
+    {1013, 3, 0, 330},
+    {1016, 3, 0, 331},
+    {1019, 3, 0, 332},
+    {1022, 3, 0, 333},
+    {1025, 3, 0, 334},
+    {1028, 3, 0, 335},
+    {1031, 3, 0, 336},
+    {1034, 3, 0, 337},
+    {1037, 3, 0, 338},
+    {1040, 3, 0, 339},
+    {1043, 3, 0, 340},
+    {1046, 3, 0, 341},
+    {1049, 3, 0, 342},
+    {1052, 3, 0, 343},
+    {1055, 3, 0, 344},
+    {1058, 3, 0, 345},
+    {1061, 3, 0, 346},
+    {1064, 3, 0, 347},
+    {1067, 3, 0, 348},
+    {1070, 3, 0, 349},
+    {1073, 3, 0, 350},
+    {1076, 3, 0, 351},
+    {1079, 3, 0, 352},
+    {1082, 3, 0, 353},
+    {1085, 3, 0, 354},
+    {1088, 3, 0, 355},
+    {1091, 3, 0, 356},
+    {1094, 3, 0, 357},
+    {1097, 3, 0, 358},
+    {1100, 3, 0, 359},
+    {1103, 3, 0, 360},
+    {1106, 3, 0, 361},
+    {1109, 3, 0, 362},
+    {1112, 3, 0, 363},
+    {1115, 3, 0, 364},
+    {1118, 3, 0, 365},
+    {1121, 3, 0, 366},
+    {1124, 3, 0, 367},
+    {1127, 3, 0, 368},
+    {1130, 3, 0, 369},
+    {1133, 3, 0, 370},
+    {1136, 3, 0, 371},
+    {1139, 3, 0, 372},
+    {1142, 3, 0, 373},
+    {1145, 3, 0, 374},
+    {1148, 3, 0, 375},
+    {1151, 3, 0, 376},
+    {1154, 3, 0, 377},
+    {1157, 3, 0, 378},
+    {1160, 3, 0, 379},
+    {1163, 3, 0, 380},
+    {1166, 3, 0, 381},
+    {1169, 3, 0, 382},
+    {1172, 3, 0, 383},
+    {1175, 3, 0, 384},
+    {1178, 3, 0, 385},
+    {1181, 3, 0, 386},
+    {1184, 3, 0, 387},
+    {1187, 3, 0, 388},
+    {1190, 3, 0, 389},
+    {1193, 3, 0, 390},
+    {1196, 3, 0, 391},
+    {1199, 3, 0, 392},
+    {1202, 3, 0, 393},
+    {1205, 3, 0, 394},
+    {1208, 3, 0, 395},
+    {1211, 3, 0, 396},
+    {1214, 3, 0, 397},
+    {1217, 3, 0, 398},
+    {1220, 3, 0, 399},
+    {1223, 3, 0, 400},
+    {1226, 3, 0, 401},
+    {1229, 3, 0, 402},
+    {1232, 3, 0, 403},
+    {1235, 3, 0, 134},
+    {1238, 3, 0, 134},
+    {1241, 3, 0, 404},
+    {1244, 3, 0, 405},
+    {1247, 3, 0, 406},
+    {1250, 3, 0, 407},
+    {1253, 3, 0, 408},
+    {1256, 3, 0, 409},
+    {1259, 3, 0, 410},
+    {1262, 3, 0, 411},
+    {1265, 3, 0, 412},
+    {1268, 3, 0, 413},
+    {1271, 3, 0, 414},
+    {1274, 3, 0, 415},
+    {1277, 3, 0, 416},
+    {1280, 3, 0, 417},
+    {1283, 3, 0, 418},
+    {1286, 3, 0, 419},
+    {1289, 3, 0, 420},
+    {1292, 3, 0, 421},
+    {1295, 3, 0, 422},
+    {1298, 3, 0, 423},
+    {1301, 3, 0, 424},
+    {1304, 3, 0, 425},
+    {1307, 3, 0, 426},
+    {1310, 3, 0, 427},
+    {1313, 3, 0, 428},
+    {1316, 3, 0, 428},
+    {1319, 3, 0, 429},
+    {1322, 3, 0, 430},
+    {1325, 3, 0, 431},
+    {1328, 3, 0, 432},
+    {1331, 3, 0, 433},
+    {1334, 4, 0, 434},
+    {1338, 3, 0, 435},
+    {1341, 4, 0, 436},
+    {1345, 4, 0, 437},
+    {1349, 4, 0, 438},
+    {1353, 3, 0, 439},
+    {1356, 3, 0, 440},
+    {1359, 3, 0, 441},
+    {1362, 3, 0, 442},
+    {1365, 3, 0, 443},
+    {1368, 3, 0, 444},
+    {1371, 3, 0, 445},
+    {1374, 3, 0, 446},
+    {1377, 3, 0, 447},
+    {1380, 3, 0, 448},
+    {1383, 3, 0, 449},
+    {1386, 3, 0, 450},
+    {1389, 3, 0, 451},
+    {1392, 3, 0, 452},
+    {1395, 3, 0, 453},
+    {1398, 3, 0, 454},
+    {1401, 3, 0, 134},
+    {1404, 3, 0, 134},
+    {1407, 3, 0, 455},
+    {1410, 3, 0, 456},
+    {1413, 3, 0, 457},
+    {1416, 3, 0, 458},
+    {1419, 3, 0, 459},
+    {1422, 3, 0, 460},
+    {1425, 3, 0, 461},
+    {1428, 3, 0, 462},
+    {1431, 3, 0, 463},
+    {1434, 3, 0, 464},
+    {1437, 3, 0, 465},
+    {1440, 3, 0, 466},
+    {1443, 3, 0, 467},
+    {1446, 3, 0, 468},
+    {1449, 3, 0, 469},
+    {1452, 3, 0, 470},
+    {1455, 3, 0, 471},
+    {1458, 3, 0, 472},
+    {1461, 3, 0, 473},
+    {1464, 3, 0, 474},
+    {1467, 3, 0, 475},
+    {1470, 3, 0, 476},
+    {1473, 3, 0, 477},
+    {1476, 3, 0, 478},
+    {1479, 3, 0, 479},
+    {1482, 3, 0, 480},
+    {1485, 3, 0, 481},
+    {1488, 3, 0, 482},
+    {1491, 3, 0, 483},
+    {1494, 3, 0, 484},
+    {1497, 3, 0, 485},
+    {1500, 3, 0, 486},
+    {1503, 3, 0, 487},
+    {1506, 3, 0, 488},
+    {1509, 3, 0, 489},
+    {1512, 3, 0, 490},
+    {1515, 3, 0, 491},
+    {1518, 3, 0, 492},
+    {1521, 3, 0, 493},
+    {1524, 3, 0, 494},
+    {1527, 3, 0, 495},
+    {1530, 3, 0, 496},
+    {1533, 3, 0, 497},
+    {1536, 3, 0, 498},
+    {1539, 3, 0, 499},
+    {1542, 3, 0, 500},
+    {1545, 3, 0, 501},
+    {1548, 3, 0, 502},
+    {1551, 3, 0, 503},
+    {1554, 3, 0, 504},
+    {1557, 3, 0, 505},
+    {1560, 3, 0, 506},
+    {1563, 3, 0, 507},
+    {1566, 3, 0, 508},
+    {1569, 3, 0, 509},
+    {1572, 3, 0, 510},
+    {1575, 3, 0, 511},
+    {1578, 3, 0, 512},
+    {1581, 3, 0, 513},
+    {1584, 3, 0, 514},
+    {1587, 3, 0, 515},
+    {1590, 3, 0, 516},
+    {1593, 3, 0, 517},
+    {1596, 3, 0, 518},
+    {1599, 3, 0, 519},
+    {1602, 3, 0, 520},
+    {1605, 3, 0, 521},
+    {1608, 3, 0, 522},
+    {1611, 3, 0, 523},
+    {1614, 3, 0, 524},
+    {1617, 3, 0, 525},
+    {1620, 3, 0, 526},
+    {1623, 3, 0, 527},
+    {1626, 3, 0, 528},
+    {1629, 3, 0, 529},
+    {1632, 3, 0, 530},
+    {1635, 3, 0, 531},
+    {1638, 3, 0, 532},
+    {1641, 3, 0, 533},
+    {1644, 3, 0, 534},
+    {1647, 3, 0, 535},
+    {1650, 3, 0, 536},
+    {1653, 3, 0, 537},
+    {1656, 3, 0, 538},
+    {1659, 3, 0, 539},
+    {1662, 3, 0, 540},
+    {1665, 3, 0, 541},
+    {1668, 3, 0, 542},
+    {1671, 3, 0, 543},
+    {1674, 3, 0, 544},
+    {1677, 3, 0, 545},
+    {1680, 3, 0, 546},
+    {1683, 3, 0, 547},
+    {1686, 3, 0, 548},
+    {1689, 3, 0, 549},
+    {1692, 3, 0, 550},
+    {1695, 3, 0, 551},
+    {1698, 3, 0, 552},
+    {1701, 3, 0, 553},
+    {1704, 3, 0, 554},
+    {1707, 3, 0, 555},
+    {1710, 3, 0, 556},
+    {1713, 3, 0, 557},
+    {1716, 3, 0, 558},
+    {1719, 3, 0, 559},
+    {1722, 3, 0, 560},
+    {1725, 3, 0, 561},
+    {1728, 3, 0, 562},
+    {1731, 3, 0, 563},
+    {1734, 3, 0, 564},
+    {1737, 3, 0, 565},
+    {1740, 3, 0, 566},
+    {1743, 3, 0, 567},
+    {1746, 3, 0, 568},
+    {1749, 3, 0, 569},
+    {1752, 3, 0, 570},
+    {1755, 3, 0, 571},
+    {1758, 3, 0, 572},
+    {1761, 3, 0, 573},
+    {1764, 3, 0, 574},
+    {1767, 3, 0, 575},
+    {1770, 3, 0, 576},
+    {1773, 3, 0, 577},
+    {1776, 3, 0, 578},
+    {1779, 3, 0, 579},
+    {1782, 3, 0, 580},
+    {1785, 3, 0, 581},
+    {1788, 3, 0, 582},
+    {1791, 3, 0, 583},
+    {1794, 3, 0, 584},
+    {1797, 3, 0, 585},
+    {1800, 3, 0, 586},
+    {1803, 3, 0, 587},
+    {1806, 3, 0, 588},
+    {1809, 3, 0, 589},
+    {1812, 3, 0, 590},
+    {1815, 3, 0, 591},
+    {1818, 3, 0, 592},
+    {1821, 3, 0, 593},
+    {1824, 3, 0, 131},
+    {1827, 3, 0, 594},
+    {1830, 3, 0, 133},
+    {1833, 3, 0, 595},
+    {1836, 3, 0, 134},
+    {1839, 3, 0, 134},
+    {1842, 3, 0, 596},
+    {1845, 3, 0, 597},
+    {1848, 3, 0, 598},
+    {1851, 3, 0, 599},
+    {1854, 3, 0, 600},
+    {1857, 3, 0, 601},
+    {1860, 3, 0, 602},
+    {1863, 3, 0, 603},
+    {1866, 3, 0, 604},
+    {1869, 3, 0, 145},
+    {1872, 3, 0, 146},
+    {1875, 3, 0, 605},
+    {1878, 3, 0, 606},
+    {1881, 3, 0, 607},
+    {1884, 3, 0, 608},
+    {1887, 3, 0, 609},
+    {1890, 3, 0, 610},
+    {1893, 3, 0, 611},
+    {1896, 3, 0, 612},
+    {1899, 3, 0, 613},
+    {1902, 3, 0, 614},
+    {1905, 3, 0, 615},
+    {1908, 3, 0, 616},
+    {1911, 3, 0, 617},
+    {1914, 3, 0, 618},
+    {1917, 3, 0, 619},
+    {1920, 3, 0, 620},
+    {1923, 3, 0, 621},
+    {1926, 3, 0, 622},
+    {1929, 3, 0, 623},
+    {1932, 3, 0, 624},
+    {1935, 3, 0, 625},
+    {1938, 3, 0, 626},
+    {1941, 3, 0, 627},
+    {1944, 3, 0, 628},
+    {1947, 3, 0, 629},
+    {1950, 3, 0, 630},
+    {1953, 3, 0, 631},
+    {1956, 3, 0, 632},
+    {1959, 3, 0, 633},
+    {1962, 3, 0, 634},
+    {1965, 3, 0, 635},
+    {1968, 3, 0, 636},
+    {1971, 3, 0, 637},
+    {1974, 3, 0, 638},
+    {1977, 3, 0, 179},
+    {1980, 3, 0, 180},
+    {1983, 3, 0, 639},
+    {1986, 3, 0, 640},
+    {1989, 3, 0, 141},
+    {1992, 3, 0, 183},
+    {1995, 3, 0, 184},
+    {1998, 3, 0, 185},
+    {2001, 3, 0, 641},
+    {2004, 3, 0, 642},
+    {2007, 3, 0, 643},
+    {2010, 3, 0, 644},
+    {2013, 3, 0, 645},
+    {2016, 3, 0, 646},
+    {2019, 3, 0, 647},
+    {2022, 3, 0, 648},
+    {2025, 3, 0, 649},
+    {2028, 3, 0, 650},
+    {2031, 3, 0, 651},
+    {2034, 3, 0, 652},
+    {2037, 3, 0, 653},
+    {2040, 3, 0, 654},
+    {2043, 3, 0, 655},
+    {2046, 3, 0, 656},
+    {2049, 3, 0, 657},
+    {2052, 3, 0, 658},
+    {2055, 3, 0, 659},
+    {2058, 3, 0, 660},
+    {2061, 3, 0, 661},
+    {2064, 3, 0, 662},
+    {2067, 3, 0, 663},
+    {2070, 3, 0, 664},
+    {2073, 3, 0, 665},
+    {2076, 3, 0, 666},
+    {2079, 3, 0, 667},
+    {2082, 3, 0, 668},
+    {2085, 3, 0, 669},
+    {2088, 3, 0, 670},
+    {2091, 3, 0, 671},
+    {2094, 3, 0, 672},
+    {2097, 3, 0, 673},
+    {2100, 3, 0, 674},
+    {2103, 3, 0, 675},
+    {2106, 3, 0, 676},
+    {2109, 3, 0, 677},
+    {2112, 3, 0, 678},
+    {2115, 3, 0, 679},
+    {2118, 3, 0, 680},
+    {2121, 3, 0, 681},
+    {2124, 3, 0, 682},
+    {2127, 3, 0, 683},
+    {2130, 3, 0, 684},
+    {2133, 3, 0, 685},
+    {2136, 3, 0, 686},
+    {2139, 3, 0, 234},
+    {2142, 3, 0, 235},
+    {2145, 3, 0, 687},
+    {2148, 3, 0, 688},
+    {2151, 3, 0, 689},
+    {2154, 3, 0, 690},
+    {2157, 3, 0, 691},
+    {2160, 3, 0, 692},
+    {2163, 3, 0, 693},
+    {2166, 3, 0, 694},
+    {2169, 3, 0, 695},
+    {2172, 3, 0, 696},
+    {2175, 3, 0, 697},
+    {2178, 3, 0, 698},
+    {2181, 3, 0, 699},
+    {2184, 3, 0, 700},
+    {2187, 3, 0, 701},
+    {2190, 3, 0, 702},
+    {2193, 3, 0, 703},
+    {2196, 3, 0, 704},
+    {2199, 3, 0, 705},
+    {2202, 3, 0, 706},
+    {2205, 3, 0, 707},
+    {2208, 3, 0, 708},
+    {2211, 3, 0, 709},
+    {2214, 3, 0, 710},
+    {2217, 3, 0, 711},
+    {2220, 3, 0, 712},
+    {2223, 3, 0, 713},
+    {2226, 3, 0, 714},
+    {2229, 3, 0, 715},
+    {2232, 3, 0, 716},
+    {2235, 3, 0, 717},
+    {2238, 3, 0, 718},
+    {2241, 3, 0, 719},
+    {2244, 3, 0, 720},
+    {2247, 3, 0, 721},
+    {2250, 3, 0, 722},
+    {2253, 3, 0, 723},
+    {2256, 3, 0, 724},
+    {2259, 3, 0, 725},
+    {2262, 3, 0, 726},
+    {2265, 3, 0, 727},
+    {2268, 3, 0, 728},
+    {2271, 3, 0, 729},
+    {2274, 3, 0, 730},
+    {2277, 3, 0, 731},
+    {2280, 3, 0, 732},
+    {2283, 3, 0, 733},
+    {2286, 3, 0, 734},
+    {2289, 3, 0, 735},
+    {2292, 3, 0, 736},
+    {2295, 3, 0, 737},
+    {2298, 3, 0, 738},
+    {2301, 3, 0, 739},
+    {2304, 3, 0, 740},
+    {2307, 3, 0, 741},
+    {2310, 3, 0, 742},
+    {2313, 3, 0, 743},
+    {2316, 3, 0, 744},
+    {2319, 3, 0, 745},
+    {2322, 3, 0, 746},
+    {2325, 3, 0, 747},
+    {2328, 3, 0, 748},
+    {2331, 3, 0, 749},
+    {2334, 3, 0, 750},
+    {2337, 3, 0, 751},
+    {2340, 3, 0, 752},
+    {2343, 3, 0, 753},
+    {2346, 3, 0, 754},
+    {2349, 3, 0, 755},
+    {2352, 3, 0, 756},
+    {2355, 3, 0, 757},
+    {2358, 3, 0, 758},
+    {2361, 3, 0, 759},
+    {2364, 3, 0, 760},
+    {2367, 3, 0, 761},
+    {2370, 3, 0, 762},
+    {2373, 3, 0, 763},
+    {2376, 3, 0, 764},
+    {2379, 3, 0, 765},
+    {2382, 3, 0, 766},
+    {2385, 3, 0, 767},
+    {2388, 3, 0, 768},
+    {2391, 3, 0, 769},
+    {2394, 3, 0, 770},
+    {2397, 3, 0, 771},
+    {2400, 3, 0, 772},
+    {2403, 3, 0, 773},
+    {2406, 3, 0, 774},
+    {2409, 3, 0, 775},
+    {2412, 3, 0, 776},
+    {2415, 3, 0, 777},
+    {2418, 3, 0, 778},
+    {2421, 3, 0, 779},
+    {2424, 3, 0, 780},
+    {2427, 3, 0, 781},
+    {2430, 3, 0, 782},
+    {2433, 3, 0, 783},
+    {2436, 3, 0, 784},
+    {2439, 3, 0, 785},
+    {2442, 3, 0, 786},
+    {2445, 3, 0, 787},
+    {2448, 3, 0, 788},
+    {2451, 3, 0, 789},
+    {2454, 3, 0, 790},
+    {2457, 3, 0, 791},
+    {2460, 3, 0, 792},
+    {2463, 3, 0, 793},
+    {2466, 3, 0, 794},
+    {2469, 3, 0, 795},
+    {2472, 3, 0, 796},
+    {2475, 3, 0, 797},
+    {2478, 3, 0, 798},
+    {2481, 3, 0, 799},
+    {2484, 3, 0, 800},
+    {2487, 3, 0, 801},
+    {2490, 3, 0, 802},
+    {2493, 3, 0, 803},
+    {2496, 3, 0, 804},
+    {2499, 3, 0, 805},
+    {2502, 3, 0, 806},
+    {2505, 3, 0, 807},
+    {2508, 3, 0, 808},
+    {2511, 3, 0, 809},
+    {2514, 3, 0, 810},
+    {2517, 3, 0, 811},
+    {2520, 3, 0, 812},
+    {2523, 3, 0, 813},
+    {2526, 3, 0, 814},
+    {2529, 3, 0, 815},
+    {2532, 3, 0, 816},
+    {2535, 3, 0, 817},
+    {2538, 3, 0, 818},
+    {2541, 3, 0, 819},
+    {2544, 3, 0, 820},
+    {2547, 3, 0, 821},
+    {2550, 3, 0, 822},
+    {2553, 3, 0, 823},
+    {2556, 3, 0, 824},
+    {2559, 3, 0, 825},
+    {2562, 3, 0, 826},
+    {2565, 3, 0, 827},
+    {2568, 3, 0, 828},
+    {2571, 3, 0, 829},
+    {2574, 3, 0, 830},
+    {2577, 3, 0, 831},
+    {2580, 3, 0, 832},
+    {2583, 3, 0, 833},
+    {2586, 3, 0, 834},
+    {2589, 3, 0, 835},
+    {2592, 3, 0, 836},
+    {2595, 3, 0, 837},
+    {2598, 3, 0, 838},
+    {2601, 3, 0, 839},
+    {2604, 3, 0, 840},
+    {2607, 3, 0, 841},
+    {2610, 3, 0, 842},
+    {2613, 3, 0, 843},
+    {2616, 3, 0, 844},
+    {2619, 3, 0, 845},
+    {2622, 3, 0, 846},
+    {2625, 3, 0, 847},
+    {2628, 3, 0, 848},
+    {2631, 3, 0, 849},
+    {2634, 3, 0, 850},
+    {2637, 3, 0, 851},
+    {2640, 3, 0, 852},
+    {2643, 3, 0, 853},
+    {2646, 3, 0, 854},
+    {2649, 3, 0, 855},
+    {2652, 3, 0, 856},
+    {2655, 3, 0, 857},
+    {2658, 3, 0, 858},
+    {2661, 3, 0, 859},
+    {2664, 3, 0, 860},
+    {2667, 3, 0, 861},
+    {2670, 3, 0, 862},
+    {2673, 3, 0, 420},
+    {2676, 3, 0, 421},
+    {2679, 3, 0, 863},
+    {2682, 3, 0, 864},
+    {2685, 3, 0, 865},
+    {2688, 3, 0, 866},
+    {2691, 3, 0, 867},
+    {2694, 3, 0, 868},
+    {2697, 3, 0, 869},
+    {2700, 3, 0, 870},
+    {2703, 3, 0, 871},
+    {2706, 3, 0, 872},
+    {2709, 3, 0, 873},
+    {2712, 3, 0, 874},
+    {2715, 3, 0, 875},
+    {2718, 3, 0, 876},
+    {2721, 3, 0, 877},
+    {2724, 3, 0, 878},
+    {2727, 3, 0, 879},
+    {2730, 3, 0, 880},
+    {2733, 3, 0, 881},
+    {2736, 3, 0, 882},
+    {2739, 3, 0, 883},
+    {2742, 3, 0, 884},
+    {2745, 3, 0, 885},
+    {2748, 3, 0, 886},
+    {2751, 3, 0, 887},
+    {2754, 3, 0, 888},
+    {2757, 3, 0, 889},
+    {2760, 3, 0, 890},
+    {2763, 3, 0, 891},
+    {2766, 3, 0, 892},
+    {2769, 3, 0, 893},
+    {2772, 3, 0, 894},
+    {2775, 3, 0, 895},
+    {2778, 3, 0, 896},
+    {2781, 3, 0, 897},
+    {2784, 3, 0, 898},
+    {2787, 3, 0, 899},
+    {2790, 3, 0, 900},
+    {2793, 3, 0, 901},
+    {2796, 3, 0, 902},
+    {2799, 3, 0, 903},
+    {2802, 3, 0, 904},
+    {2805, 3, 0, 905},
+    {2808, 3, 0, 906},
+    {2811, 3, 0, 907},
+    {2814, 3, 0, 908},
+    {2817, 3, 0, 909},
+    {2820, 3, 0, 910},
+    {2823, 3, 0, 911},
+    {2826, 3, 0, 912},
+    {2829, 3, 0, 913},
+    {2832, 3, 0, 914},
+    {2835, 3, 0, 915},
+    {2838, 3, 0, 916},
+    {2841, 3, 0, 917},
+    {2844, 3, 0, 918},
+    {2847, 3, 0, 919},
+    {2850, 3, 0, 920},
+    {2853, 3, 0, 921},
+    {2856, 3, 0, 922},
+    {2859, 3, 0, 923},
+    {2862, 3, 0, 924},
+    {2865, 3, 0, 925},
+    {2868, 3, 0, 926},
+};
+constexpr vertex_index monkey_0_indices[] = {
+    46,
+    2,
+    44,
+    3,
+    47,
+    45,
+    44,
+    4,
+    42,
+    5,
+    45,
+    43,
+    2,
+    6,
+    4,
+    7,
+    3,
+    5,
+    0,
+    8,
+    2,
+    9,
+    1,
+    3,
+    10,
+    14,
+    8,
+    15,
+    11,
+    9,
+    8,
+    16,
+    6,
+    17,
+    9,
+    7,
+    14,
+    20,
+    18,
+    16,
+    19,
+    21,
+    15,
+    17,
+    12,
+    20,
+    14,
+    21,
+    13,
+    15,
+    22,
+    26,
+    20,
+    27,
+    23,
+    21,
+    20,
+    26,
+    28,
+    18,
+    29,
+    27,
+    21,
+    19,
+    26,
+    32,
+    30,
+    28,
+    31,
+    33,
+    27,
+    29,
+    34,
+    26,
+    24,
+    35,
+    27,
+    33,
+    36,
+    32,
+    34,
+    37,
+    33,
+    39,
+    32,
+    38,
+    40,
+    30,
+    41,
+    39,
+    33,
+    31,
+    44,
+    40,
+    38,
+    45,
+    41,
+    43,
+    46,
+    38,
+    36,
+    47,
+    39,
+    45,
+    36,
+    48,
+    46,
+    37,
+    49,
+    51,
+    34,
+    50,
+    36,
+    35,
+    51,
+    53,
+    24,
+    52,
+    34,
+    25,
+    53,
+    55,
+    22,
+    54,
+    24,
+    23,
+    55,
+    57,
+    22,
+    58,
+    56,
+    59,
+    23,
+    57,
+    12,
+    62,
+    58,
+    63,
+    11,
+    13,
+    59,
+    10,
+    0,
+    64,
+    62,
+    65,
+    1,
+    11,
+    63,
+    0,
+    48,
+    64,
+    49,
+    1,
+    65,
+    60,
+    64,
+    48,
+    49,
+    65,
+    61,
+    62,
+    64,
+    60,
+    61,
+    65,
+    63,
+    60,
+    58,
+    62,
+    63,
+    59,
+    61,
+    60,
+    56,
+    58,
+    59,
+    57,
+    61,
+    60,
+    54,
+    56,
+    57,
+    55,
+    61,
+    60,
+    52,
+    54,
+    55,
+    53,
+    61,
+    60,
+    50,
+    52,
+    53,
+    51,
+    61,
+    60,
+    48,
+    50,
+    51,
+    49,
+    61,
+    173,
+    90,
+    88,
+    174,
+    90,
+    175,
+    171,
+    88,
+    86,
+    172,
+    89,
+    174,
+    84,
+    171,
+    86,
+    172,
+    85,
+    87,
+    82,
+    169,
+    84,
+    170,
+    83,
+    85,
+    80,
+    167,
+    82,
+    168,
+    81,
+    83,
+    78,
+    145,
+    163,
+    146,
+    79,
+    164,
+    93,
+    145,
+    91,
+    94,
+    146,
+    148,
+    93,
+    149,
+    147,
+    150,
+    94,
+    148,
+    97,
+    149,
+    95,
+    98,
+    150,
+    152,
+    99,
+    151,
+    97,
+    100,
+    152,
+    154,
+    101,
+    153,
+    99,
+    102,
+    154,
+    156,
+    101,
+    157,
+    155,
+    158,
+    102,
+    156,
+    105,
+    157,
+    103,
+    106,
+    158,
+    160,
+    107,
+    159,
+    105,
+    108,
+    160,
+    162,
+    66,
+    161,
+    107,
+    66,
+    162,
+    67,
+    127,
+    161,
+    109,
+    128,
+    162,
+    160,
+    127,
+    157,
+    159,
+    158,
+    128,
+    160,
+    155,
+    178,
+    125,
+    156,
+    179,
+    158,
+    153,
+    125,
+    123,
+    154,
+    126,
+    156,
+    151,
+    123,
+    121,
+    152,
+    124,
+    154,
+    149,
+    121,
+    119,
+    150,
+    122,
+    152,
+    147,
+    119,
+    117,
+    148,
+    120,
+    150,
+    145,
+    117,
+    115,
+    146,
+    118,
+    148,
+    163,
+    115,
+    113,
+    164,
+    116,
+    146,
+    113,
+    176,
+    163,
+    176,
+    114,
+    164,
+    161,
+    111,
+    109,
+    162,
+    112,
+    67,
+    111,
+    177,
+    182,
+    177,
+    112,
+    183,
+    180,
+    177,
+    176,
+    181,
+    177,
+    183,
+    134,
+    175,
+    173,
+    175,
+    135,
+    174,
+    132,
+    173,
+    171,
+    174,
+    133,
+    172,
+    132,
+    169,
+    130,
+    133,
+    170,
+    172,
+    165,
+    184,
+    167,
+    185,
+    166,
+    168,
+    130,
+    167,
+    184,
+    168,
+    131,
+    185,
+    189,
+    186,
+    143,
+    189,
+    187,
+    188,
+    186,
+    68,
+    184,
+    187,
+    68,
+    188,
+    130,
+    68,
+    129,
+    131,
+    68,
+    185,
+    141,
+    190,
+    143,
+    191,
+    142,
+    144,
+    139,
+    192,
+    141,
+    193,
+    140,
+    142,
+    196,
+    139,
+    138,
+    197,
+    140,
+    195,
+    70,
+    138,
+    137,
+    70,
+    138,
+    197,
+    143,
+    69,
+    189,
+    144,
+    69,
+    191,
+    190,
+    207,
+    69,
+    191,
+    207,
+    206,
+    70,
+    199,
+    196,
+    200,
+    70,
+    197,
+    196,
+    201,
+    194,
+    202,
+    197,
+    195,
+    201,
+    192,
+    194,
+    202,
+    193,
+    204,
+    192,
+    205,
+    190,
+    206,
+    193,
+    191,
+    203,
+    199,
+    198,
+    204,
+    200,
+    202,
+    198,
+    205,
+    203,
+    206,
+    198,
+    204,
+    138,
+    163,
+    176,
+    164,
+    138,
+    176,
+    139,
+    210,
+    163,
+    211,
+    140,
+    164,
+    143,
+    210,
+    141,
+    144,
+    211,
+    213,
+    186,
+    212,
+    143,
+    187,
+    213,
+    166,
+    208,
+    165,
+    80,
+    209,
+    166,
+    213,
+    214,
+    212,
+    208,
+    215,
+    213,
+    211,
+    78,
+    210,
+    214,
+    211,
+    79,
+    215,
+    129,
+    221,
+    130,
+    129,
+    222,
+    71,
+    132,
+    221,
+    219,
+    222,
+    133,
+    220,
+    134,
+    219,
+    217,
+    220,
+    135,
+    218,
+    136,
+    217,
+    216,
+    218,
+    136,
+    216,
+    217,
+    230,
+    216,
+    218,
+    230,
+    229,
+    217,
+    226,
+    228,
+    227,
+    218,
+    229,
+    219,
+    224,
+    226,
+    225,
+    220,
+    227,
+    71,
+    224,
+    221,
+    71,
+    225,
+    223,
+    223,
+    228,
+    224,
+    229,
+    223,
+    225,
+    224,
+    228,
+    226,
+    227,
+    229,
+    225,
+    182,
+    233,
+    231,
+    234,
+    183,
+    232,
+    111,
+    231,
+    253,
+    232,
+    112,
+    254,
+    111,
+    255,
+    109,
+    112,
+    256,
+    254,
+    113,
+    233,
+    180,
+    114,
+    234,
+    252,
+    113,
+    249,
+    251,
+    250,
+    114,
+    252,
+    115,
+    247,
+    249,
+    248,
+    116,
+    250,
+    117,
+    245,
+    247,
+    246,
+    118,
+    248,
+    119,
+    243,
+    245,
+    244,
+    120,
+    246,
+    123,
+    243,
+    121,
+    124,
+    244,
+    242,
+    125,
+    241,
+    123,
+    126,
+    242,
+    240,
+    125,
+    235,
+    239,
+    236,
+    126,
+    240,
+    178,
+    237,
+    235,
+    238,
+    179,
+    236,
+    127,
+    255,
+    237,
+    256,
+    128,
+    238,
+    255,
+    275,
+    237,
+    256,
+    276,
+    258,
+    235,
+    275,
+    277,
+    276,
+    236,
+    278,
+    235,
+    273,
+    239,
+    236,
+    274,
+    278,
+    239,
+    271,
+    241,
+    240,
+    272,
+    274,
+    243,
+    271,
+    269,
+    272,
+    244,
+    270,
+    243,
+    267,
+    245,
+    244,
+    268,
+    270,
+    247,
+    267,
+    265,
+    268,
+    248,
+    266,
+    247,
+    263,
+    249,
+    248,
+    264,
+    266,
+    249,
+    261,
+    251,
+    250,
+    262,
+    264,
+    233,
+    261,
+    279,
+    262,
+    234,
+    280,
+    255,
+    259,
+    257,
+    260,
+    256,
+    258,
+    253,
+    281,
+    259,
+    282,
+    254,
+    260,
+    231,
+    279,
+    281,
+    280,
+    232,
+    282,
+    66,
+    283,
+    72,
+    284,
+    66,
+    72,
+    107,
+    285,
+    283,
+    286,
+    108,
+    284,
+    103,
+    285,
+    105,
+    104,
+    286,
+    288,
+    101,
+    287,
+    103,
+    102,
+    288,
+    290,
+    99,
+    289,
+    101,
+    100,
+    290,
+    292,
+    99,
+    293,
+    291,
+    294,
+    100,
+    292,
+    95,
+    293,
+    97,
+    96,
+    294,
+    296,
+    95,
+    297,
+    295,
+    298,
+    96,
+    296,
+    93,
+    299,
+    297,
+    300,
+    94,
+    298,
+    308,
+    337,
+    307,
+    308,
+    338,
+    328,
+    307,
+    335,
+    306,
+    307,
+    336,
+    338,
+    306,
+    339,
+    305,
+    306,
+    340,
+    336,
+    88,
+    305,
+    339,
+    305,
+    89,
+    340,
+    86,
+    339,
+    333,
+    340,
+    87,
+    334,
+    84,
+    333,
+    329,
+    334,
+    85,
+    330,
+    82,
+    329,
+    331,
+    330,
+    83,
+    332,
+    329,
+    337,
+    331,
+    338,
+    330,
+    332,
+    333,
+    335,
+    329,
+    334,
+    336,
+    340,
+    331,
+    327,
+    325,
+    332,
+    328,
+    338,
+    80,
+    331,
+    325,
+    332,
+    81,
+    326,
+    341,
+    214,
+    208,
+    342,
+    215,
+    344,
+    325,
+    208,
+    80,
+    326,
+    209,
+    342,
+    214,
+    345,
+    78,
+    215,
+    346,
+    344,
+    345,
+    91,
+    78,
+    346,
+    92,
+    300,
+    323,
+    303,
+    76,
+    324,
+    303,
+    352,
+    351,
+    77,
+    303,
+    352,
+    77,
+    350,
+    77,
+    347,
+    304,
+    348,
+    77,
+    304,
+    304,
+    327,
+    308,
+    328,
+    304,
+    308,
+    327,
+    341,
+    325,
+    328,
+    342,
+    348,
+    295,
+    317,
+    309,
+    318,
+    296,
+    310,
+    315,
+    76,
+    75,
+    316,
+    76,
+    324,
+    357,
+    302,
+    301,
+    358,
+    302,
+    356,
+    302,
+    353,
+    74,
+    354,
+    302,
+    74,
+    74,
+    315,
+    75,
+    316,
+    74,
+    75,
+    291,
+    361,
+    363,
+    362,
+    292,
+    364,
+    363,
+    367,
+    365,
+    368,
+    364,
+    366,
+    365,
+    369,
+    371,
+    370,
+    366,
+    372,
+    371,
+    375,
+    373,
+    376,
+    372,
+    374,
+    377,
+    375,
+    313,
+    378,
+    376,
+    374,
+    315,
+    373,
+    377,
+    374,
+    316,
+    378,
+    353,
+    371,
+    373,
+    372,
+    354,
+    374,
+    355,
+    365,
+    371,
+    366,
+    356,
+    372,
+    357,
+    363,
+    365,
+    364,
+    358,
+    366,
+    291,
+    359,
+    289,
+    292,
+    360,
+    364,
+    359,
+    301,
+    73,
+    360,
+    301,
+    358,
+    283,
+    287,
+    289,
+    288,
+    284,
+    290,
+    283,
+    359,
+    73,
+    360,
+    284,
+    73,
+    72,
+    283,
+    73,
+    73,
+    284,
+    72,
+    295,
+    361,
+    293,
+    296,
+    362,
+    310,
+    309,
+    367,
+    361,
+    368,
+    310,
+    362,
+    311,
+    369,
+    367,
+    370,
+    312,
+    368,
+    375,
+    381,
+    313,
+    376,
+    382,
+    370,
+    349,
+    383,
+    347,
+    350,
+    384,
+    386,
+    383,
+    319,
+    317,
+    384,
+    320,
+    386,
+    297,
+    383,
+    317,
+    384,
+    298,
+    318,
+    299,
+    341,
+    383,
+    342,
+    300,
+    384,
+    341,
+    347,
+    383,
+    384,
+    348,
+    342,
+    299,
+    345,
+    343,
+    344,
+    346,
+    300,
+    321,
+    377,
+    313,
+    322,
+    378,
+    380,
+    377,
+    323,
+    315,
+    378,
+    324,
+    380,
+    385,
+    321,
+    319,
+    386,
+    322,
+    380,
+    351,
+    385,
+    349,
+    352,
+    386,
+    380,
+    323,
+    379,
+    351,
+    352,
+    380,
+    324,
+    387,
+    401,
+    399,
+    388,
+    402,
+    414,
+    399,
+    403,
+    397,
+    404,
+    400,
+    398,
+    403,
+    395,
+    397,
+    404,
+    396,
+    406,
+    405,
+    393,
+    395,
+    406,
+    394,
+    408,
+    407,
+    391,
+    393,
+    408,
+    392,
+    410,
+    391,
+    411,
+    389,
+    412,
+    392,
+    390,
+    409,
+    417,
+    411,
+    418,
+    410,
+    412,
+    407,
+    419,
+    409,
+    420,
+    408,
+    410,
+    423,
+    407,
+    405,
+    424,
+    408,
+    422,
+    425,
+    405,
+    403,
+    426,
+    406,
+    424,
+    427,
+    403,
+    401,
+    428,
+    404,
+    426,
+    401,
+    415,
+    427,
+    416,
+    402,
+    428,
+    319,
+    441,
+    317,
+    320,
+    442,
+    444,
+    389,
+    443,
+    319,
+    390,
+    444,
+    412,
+    309,
+    441,
+    311,
+    442,
+    310,
+    312,
+    381,
+    413,
+    387,
+    414,
+    382,
+    388,
+    411,
+    439,
+    443,
+    440,
+    412,
+    444,
+    445,
+    439,
+    437,
+    446,
+    440,
+    444,
+    433,
+    437,
+    435,
+    438,
+    434,
+    436,
+    447,
+    433,
+    431,
+    448,
+    434,
+    446,
+    447,
+    449,
+    429,
+    448,
+    450,
+    432,
+    429,
+    415,
+    413,
+    430,
+    416,
+    450,
+    311,
+    429,
+    381,
+    430,
+    312,
+    382,
+    441,
+    447,
+    311,
+    442,
+    448,
+    446,
+    441,
+    443,
+    445,
+    446,
+    444,
+    442,
+    415,
+    451,
+    475,
+    452,
+    416,
+    476,
+    431,
+    451,
+    449,
+    432,
+    452,
+    462,
+    431,
+    459,
+    461,
+    460,
+    432,
+    462,
+    435,
+    459,
+    433,
+    436,
+    460,
+    458,
+    437,
+    457,
+    435,
+    438,
+    458,
+    456,
+    437,
+    453,
+    455,
+    454,
+    438,
+    456,
+    439,
+    473,
+    453,
+    474,
+    440,
+    454,
+    427,
+    475,
+    463,
+    476,
+    428,
+    464,
+    425,
+    463,
+    465,
+    464,
+    426,
+    466,
+    423,
+    465,
+    467,
+    466,
+    426,
+    424,
+    468,
+    423,
+    469,
+    421,
+    468,
+    424,
+    422,
+    470,
+    419,
+    421,
+    469,
+    471,
+    470,
+    422,
+    420,
+    472,
+    419,
+    473,
+    417,
+    420,
+    474,
+    472,
+    455,
+    477,
+    457,
+    456,
+    478,
+    480,
+    479,
+    483,
+    477,
+    480,
+    484,
+    482,
+    483,
+    487,
+    485,
+    488,
+    484,
+    486,
+    487,
+    491,
+    485,
+    488,
+    492,
+    490,
+    463,
+    485,
+    491,
+    486,
+    464,
+    492,
+    483,
+    475,
+    451,
+    484,
+    476,
+    486,
+    461,
+    483,
+    451,
+    462,
+    484,
+    478,
+    457,
+    461,
+    459,
+    462,
+    458,
+    460,
+    473,
+    455,
+    453,
+    474,
+    456,
+    480,
+    471,
+    479,
+    473,
+    480,
+    472,
+    474,
+    487,
+    471,
+    469,
+    488,
+    472,
+    482,
+    489,
+    469,
+    467,
+    490,
+    470,
+    488,
+    465,
+    489,
+    467,
+    490,
+    466,
+    468,
+    463,
+    491,
+    465,
+    466,
+    492,
+    464,
+    391,
+    503,
+    501,
+    504,
+    392,
+    502,
+    393,
+    501,
+    499,
+    502,
+    394,
+    500,
+    393,
+    497,
+    395,
+    394,
+    498,
+    500,
+    395,
+    495,
+    397,
+    396,
+    496,
+    498,
+    397,
+    493,
+    399,
+    398,
+    494,
+    496,
+    399,
+    505,
+    387,
+    400,
+    506,
+    494,
+    501,
+    505,
+    493,
+    502,
+    506,
+    504,
+    493,
+    499,
+    501,
+    500,
+    494,
+    502,
+    495,
+    497,
+    499,
+    500,
+    498,
+    496,
+    381,
+    505,
+    313,
+    382,
+    506,
+    388,
+    313,
+    503,
+    321,
+    504,
+    314,
+    322,
+    319,
+    503,
+    389,
+    504,
+    320,
+    390,
+    46,
+    0,
+    2,
+    3,
+    1,
+    47,
+    44,
+    2,
+    4,
+    5,
+    3,
+    45,
+    2,
+    8,
+    6,
+    7,
+    9,
+    3,
+    0,
+    10,
+    8,
+    9,
+    11,
+    1,
+    10,
+    12,
+    14,
+    15,
+    13,
+    11,
+    8,
+    14,
+    16,
+    17,
+    15,
+    9,
+    12,
+    22,
+    20,
+    21,
+    23,
+    13,
+    22,
+    24,
+    26,
+    27,
+    25,
+    23,
+    34,
+    32,
+    26,
+    35,
+    25,
+    27,
+    36,
+    38,
+    32,
+    37,
+    35,
+    33,
+    44,
+    42,
+    40,
+    45,
+    39,
+    41,
+    46,
+    44,
+    38,
+    47,
+    37,
+    39,
+    36,
+    50,
+    48,
+    37,
+    47,
+    49,
+    34,
+    52,
+    50,
+    35,
+    37,
+    51,
+    24,
+    54,
+    52,
+    25,
+    35,
+    53,
+    22,
+    56,
+    54,
+    23,
+    25,
+    55,
+    22,
+    12,
+    58,
+    59,
+    13,
+    23,
+    12,
+    10,
+    62,
+    0,
+    46,
+    48,
+    49,
+    47,
+    1,
+    173,
+    175,
+    90,
+    174,
+    89,
+    90,
+    171,
+    173,
+    88,
+    172,
+    87,
+    89,
+    84,
+    169,
+    171,
+    172,
+    170,
+    85,
+    82,
+    167,
+    169,
+    170,
+    168,
+    83,
+    80,
+    165,
+    167,
+    168,
+    166,
+    81,
+    78,
+    91,
+    145,
+    146,
+    92,
+    79,
+    93,
+    147,
+    145,
+    94,
+    92,
+    146,
+    93,
+    95,
+    149,
+    150,
+    96,
+    94,
+    97,
+    151,
+    149,
+    98,
+    96,
+    150,
+    99,
+    153,
+    151,
+    100,
+    98,
+    152,
+    101,
+    155,
+    153,
+    102,
+    100,
+    154,
+    101,
+    103,
+    157,
+    158,
+    104,
+    102,
+    105,
+    159,
+    157,
+    106,
+    104,
+    158,
+    107,
+    161,
+    159,
+    108,
+    106,
+    160,
+    66,
+    67,
+    161,
+    66,
+    108,
+    162,
+    127,
+    159,
+    161,
+    128,
+    110,
+    162,
+    127,
+    178,
+    157,
+    158,
+    179,
+    128,
+    155,
+    157,
+    178,
+    156,
+    126,
+    179,
+    153,
+    155,
+    125,
+    154,
+    124,
+    126,
+    151,
+    153,
+    123,
+    152,
+    122,
+    124,
+    149,
+    151,
+    121,
+    150,
+    120,
+    122,
+    147,
+    149,
+    119,
+    148,
+    118,
+    120,
+    145,
+    147,
+    117,
+    146,
+    116,
+    118,
+    163,
+    145,
+    115,
+    164,
+    114,
+    116,
+    113,
+    180,
+    176,
+    176,
+    181,
+    114,
+    161,
+    67,
+    111,
+    162,
+    110,
+    112,
+    111,
+    67,
+    177,
+    177,
+    67,
+    112,
+    180,
+    182,
+    177,
+    181,
+    176,
+    177,
+    134,
+    136,
+    175,
+    175,
+    136,
+    135,
+    132,
+    134,
+    173,
+    174,
+    135,
+    133,
+    132,
+    171,
+    169,
+    133,
+    131,
+    170,
+    165,
+    186,
+    184,
+    185,
+    187,
+    166,
+    130,
+    169,
+    167,
+    168,
+    170,
+    131,
+    189,
+    188,
+    186,
+    189,
+    144,
+    187,
+    186,
+    188,
+    68,
+    187,
+    185,
+    68,
+    130,
+    184,
+    68,
+    131,
+    129,
+    68,
+    141,
+    192,
+    190,
+    191,
+    193,
+    142,
+    139,
+    194,
+    192,
+    193,
+    195,
+    140,
+    196,
+    194,
+    139,
+    197,
+    138,
+    140,
+    70,
+    196,
+    138,
+    143,
+    190,
+    69,
+    144,
+    189,
+    69,
+    190,
+    205,
+    207,
+    191,
+    69,
+    207,
+    70,
+    198,
+    199,
+    200,
+    198,
+    70,
+    196,
+    199,
+    201,
+    202,
+    200,
+    197,
+    201,
+    203,
+    192,
+    202,
+    195,
+    193,
+    192,
+    203,
+    205,
+    206,
+    204,
+    193,
+    203,
+    201,
+    199,
+    204,
+    198,
+    200,
+    198,
+    207,
+    205,
+    206,
+    207,
+    198,
+    138,
+    139,
+    163,
+    164,
+    140,
+    138,
+    139,
+    141,
+    210,
+    211,
+    142,
+    140,
+    143,
+    212,
+    210,
+    144,
+    142,
+    211,
+    186,
+    165,
+    212,
+    187,
+    144,
+    213,
+    208,
+    212,
+    165,
+    209,
+    81,
+    166,
+    214,
+    210,
+    212,
+    215,
+    209,
+    213,
+    78,
+    163,
+    210,
+    211,
+    164,
+    79,
+    129,
+    71,
+    221,
+    129,
+    131,
+    222,
+    132,
+    130,
+    221,
+    222,
+    131,
+    133,
+    134,
+    132,
+    219,
+    220,
+    133,
+    135,
+    136,
+    134,
+    217,
+    218,
+    135,
+    136,
+    217,
+    228,
+    230,
+    218,
+    216,
+    230,
+    217,
+    219,
+    226,
+    227,
+    220,
+    218,
+    219,
+    221,
+    224,
+    225,
+    222,
+    220,
+    71,
+    223,
+    224,
+    71,
+    222,
+    225,
+    223,
+    230,
+    228,
+    229,
+    230,
+    223,
+    182,
+    180,
+    233,
+    234,
+    181,
+    183,
+    111,
+    182,
+    231,
+    232,
+    183,
+    112,
+    111,
+    253,
+    255,
+    112,
+    110,
+    256,
+    113,
+    251,
+    233,
+    114,
+    181,
+    234,
+    113,
+    115,
+    249,
+    250,
+    116,
+    114,
+    115,
+    117,
+    247,
+    248,
+    118,
+    116,
+    117,
+    119,
+    245,
+    246,
+    120,
+    118,
+    119,
+    121,
+    243,
+    244,
+    122,
+    120,
+    123,
+    241,
+    243,
+    124,
+    122,
+    244,
+    125,
+    239,
+    241,
+    126,
+    124,
+    242,
+    125,
+    178,
+    235,
+    236,
+    179,
+    126,
+    178,
+    127,
+    237,
+    238,
+    128,
+    179,
+    127,
+    109,
+    255,
+    256,
+    110,
+    128,
+    255,
+    257,
+    275,
+    256,
+    238,
+    276,
+    235,
+    237,
+    275,
+    276,
+    238,
+    236,
+    235,
+    277,
+    273,
+    236,
+    240,
+    274,
+    239,
+    273,
+    271,
+    240,
+    242,
+    272,
+    243,
+    241,
+    271,
+    272,
+    242,
+    244,
+    243,
+    269,
+    267,
+    244,
+    246,
+    268,
+    247,
+    245,
+    267,
+    268,
+    246,
+    248,
+    247,
+    265,
+    263,
+    248,
+    250,
+    264,
+    249,
+    263,
+    261,
+    250,
+    252,
+    262,
+    233,
+    251,
+    261,
+    262,
+    252,
+    234,
+    255,
+    253,
+    259,
+    260,
+    254,
+    256,
+    253,
+    231,
+    281,
+    282,
+    232,
+    254,
+    231,
+    233,
+    279,
+    280,
+    234,
+    232,
+    66,
+    107,
+    283,
+    284,
+    108,
+    66,
+    107,
+    105,
+    285,
+    286,
+    106,
+    108,
+    103,
+    287,
+    285,
+    104,
+    106,
+    286,
+    101,
+    289,
+    287,
+    102,
+    104,
+    288,
+    99,
+    291,
+    289,
+    100,
+    102,
+    290,
+    99,
+    97,
+    293,
+    294,
+    98,
+    100,
+    95,
+    295,
+    293,
+    96,
+    98,
+    294,
+    95,
+    93,
+    297,
+    298,
+    94,
+    96,
+    93,
+    91,
+    299,
+    300,
+    92,
+    94,
+    308,
+    327,
+    337,
+    308,
+    307,
+    338,
+    307,
+    337,
+    335,
+    307,
+    306,
+    336,
+    306,
+    335,
+    339,
+    306,
+    305,
+    340,
+    88,
+    90,
+    305,
+    305,
+    90,
+    89,
+    86,
+    88,
+    339,
+    340,
+    89,
+    87,
+    84,
+    86,
+    333,
+    334,
+    87,
+    85,
+    82,
+    84,
+    329,
+    330,
+    85,
+    83,
+    329,
+    335,
+    337,
+    338,
+    336,
+    330,
+    333,
+    339,
+    335,
+    334,
+    330,
+    336,
+    331,
+    337,
+    327,
+    332,
+    326,
+    328,
+    80,
+    82,
+    331,
+    332,
+    83,
+    81,
+    341,
+    343,
+    214,
+    342,
+    209,
+    215,
+    325,
+    341,
+    208,
+    326,
+    81,
+    209,
+    214,
+    343,
+    345,
+    215,
+    79,
+    346,
+    345,
+    299,
+    91,
+    346,
+    79,
+    92,
+    323,
+    351,
+    303,
+    324,
+    76,
+    303,
+    351,
+    349,
+    77,
+    352,
+    303,
+    77,
+    77,
+    349,
+    347,
+    348,
+    350,
+    77,
+    304,
+    347,
+    327,
+    328,
+    348,
+    304,
+    327,
+    347,
+    341,
+    328,
+    326,
+    342,
+    295,
+    297,
+    317,
+    318,
+    298,
+    296,
+    315,
+    323,
+    76,
+    316,
+    75,
+    76,
+    357,
+    355,
+    302,
+    358,
+    301,
+    302,
+    302,
+    355,
+    353,
+    354,
+    356,
+    302,
+    74,
+    353,
+    315,
+    316,
+    354,
+    74,
+    291,
+    293,
+    361,
+    362,
+    294,
+    292,
+    363,
+    361,
+    367,
+    368,
+    362,
+    364,
+    365,
+    367,
+    369,
+    370,
+    368,
+    366,
+    371,
+    369,
+    375,
+    376,
+    370,
+    372,
+    377,
+    373,
+    375,
+    378,
+    314,
+    376,
+    315,
+    353,
+    373,
+    374,
+    354,
+    316,
+    353,
+    355,
+    371,
+    372,
+    356,
+    354,
+    355,
+    357,
+    365,
+    366,
+    358,
+    356,
+    357,
+    359,
+    363,
+    364,
+    360,
+    358,
+    291,
+    363,
+    359,
+    292,
+    290,
+    360,
+    359,
+    357,
+    301,
+    360,
+    73,
+    301,
+    283,
+    285,
+    287,
+    288,
+    286,
+    284,
+    283,
+    289,
+    359,
+    360,
+    290,
+    284,
+    295,
+    309,
+    361,
+    296,
+    294,
+    362,
+    309,
+    311,
+    367,
+    368,
+    312,
+    310,
+    311,
+    381,
+    369,
+    370,
+    382,
+    312,
+    375,
+    369,
+    381,
+    376,
+    314,
+    382,
+    349,
+    385,
+    383,
+    350,
+    348,
+    384,
+    383,
+    385,
+    319,
+    384,
+    318,
+    320,
+    297,
+    299,
+    383,
+    384,
+    300,
+    298,
+    299,
+    343,
+    341,
+    342,
+    344,
+    300,
+    321,
+    379,
+    377,
+    322,
+    314,
+    378,
+    377,
+    379,
+    323,
+    378,
+    316,
+    324,
+    385,
+    379,
+    321,
+    386,
+    320,
+    322,
+    351,
+    379,
+    385,
+    352,
+    350,
+    386,
+    387,
+    413,
+    401,
+    388,
+    400,
+    402,
+    399,
+    401,
+    403,
+    404,
+    402,
+    400,
+    403,
+    405,
+    395,
+    404,
+    398,
+    396,
+    405,
+    407,
+    393,
+    406,
+    396,
+    394,
+    407,
+    409,
+    391,
+    408,
+    394,
+    392,
+    391,
+    409,
+    411,
+    412,
+    410,
+    392,
+    409,
+    419,
+    417,
+    418,
+    420,
+    410,
+    407,
+    421,
+    419,
+    420,
+    422,
+    408,
+    423,
+    421,
+    407,
+    424,
+    406,
+    408,
+    425,
+    423,
+    405,
+    426,
+    404,
+    406,
+    427,
+    425,
+    403,
+    428,
+    402,
+    404,
+    401,
+    413,
+    415,
+    416,
+    414,
+    402,
+    319,
+    443,
+    441,
+    320,
+    318,
+    442,
+    389,
+    411,
+    443,
+    390,
+    320,
+    444,
+    309,
+    317,
+    441,
+    442,
+    318,
+    310,
+    381,
+    429,
+    413,
+    414,
+    430,
+    382,
+    411,
+    417,
+    439,
+    440,
+    418,
+    412,
+    445,
+    443,
+    439,
+    446,
+    438,
+    440,
+    433,
+    445,
+    437,
+    438,
+    446,
+    434,
+    447,
+    445,
+    433,
+    448,
+    432,
+    434,
+    447,
+    431,
+    449,
+    448,
+    430,
+    450,
+    429,
+    449,
+    415,
+    430,
+    414,
+    416,
+    311,
+    447,
+    429,
+    430,
+    448,
+    312,
+    441,
+    445,
+    447,
+    442,
+    312,
+    448,
+    415,
+    449,
+    451,
+    452,
+    450,
+    416,
+    431,
+    461,
+    451,
+    432,
+    450,
+    452,
+    431,
+    433,
+    459,
+    460,
+    434,
+    432,
+    435,
+    457,
+    459,
+    436,
+    434,
+    460,
+    437,
+    455,
+    457,
+    438,
+    436,
+    458,
+    437,
+    439,
+    453,
+    454,
+    440,
+    438,
+    439,
+    417,
+    473,
+    474,
+    418,
+    440,
+    427,
+    415,
+    475,
+    476,
+    416,
+    428,
+    425,
+    427,
+    463,
+    464,
+    428,
+    426,
+    423,
+    425,
+    465,
+    423,
+    467,
+    469,
+    419,
+    471,
+    473,
+    420,
+    418,
+    474,
+    455,
+    479,
+    477,
+    456,
+    458,
+    478,
+    479,
+    481,
+    483,
+    480,
+    478,
+    484,
+    483,
+    481,
+    487,
+    488,
+    482,
+    484,
+    487,
+    489,
+    491,
+    488,
+    486,
+    492,
+    463,
+    475,
+    485,
+    486,
+    476,
+    464,
+    483,
+    485,
+    475,
+    484,
+    452,
+    476,
+    461,
+    477,
+    483,
+    462,
+    452,
+    484,
+    457,
+    477,
+    461,
+    462,
+    478,
+    458,
+    473,
+    479,
+    455,
+    474,
+    454,
+    456,
+    471,
+    481,
+    479,
+    480,
+    482,
+    472,
+    487,
+    481,
+    471,
+    488,
+    470,
+    472,
+    489,
+    487,
+    469,
+    490,
+    468,
+    470,
+    465,
+    491,
+    489,
+    490,
+    492,
+    466,
+    391,
+    389,
+    503,
+    504,
+    390,
+    392,
+    393,
+    391,
+    501,
+    502,
+    392,
+    394,
+    393,
+    499,
+    497,
+    394,
+    396,
+    498,
+    395,
+    497,
+    495,
+    396,
+    398,
+    496,
+    397,
+    495,
+    493,
+    398,
+    400,
+    494,
+    399,
+    493,
+    505,
+    400,
+    388,
+    506,
+    501,
+    503,
+    505,
+    502,
+    494,
+    506,
+    493,
+    495,
+    499,
+    500,
+    496,
+    494,
+    381,
+    387,
+    505,
+    382,
+    314,
+    506,
+    313,
+    505,
+    503,
+    504,
+    506,
+    314,
+    319,
+    321,
+    503,
+    504,
+    322,
+    320,
+};
+constexpr quantized_vertex monkey_1_vertices[] = {
+    {0, 27245, -18204},
+    {0, 18204, -27245},
+    {0, 6393, -32137},
+    {0, 0, -32767},
+    {0, -6393, -32137},
+    {0, -18204, -27245},
+    {1247, 32137, -6270},
+    {2446, 30273, -12298},
+    {3552, 27245, -17855},
+    {4520, 23170, -22725},
+    {5315, 18204, -26721},
+    {5906, 12539, -29691},
+    {6270, 6393, -31520},
+    {6393, 0, -32137},
+    {6270, -6393, -31520},
+    {5906, -12539, -29691},
+    {5315, -18204, -26721},
+    {4520, -23170, -22725},
+    {3552, -27245, -17855},
+    {2446, -30273, -12298},
+    {1247, -32137, -6270},
+    {2446, 32137, -5906},
+    {4799, 30273, -11585},
+    {6967, 27245, -16819},
+    {8867, 23170, -21406},
+    {10426, 18204, -25171},
+    {11585, 12539, -27968},
+    {12298, 6393, -29691},
+    {12539, 0, -30273},
+    {12298, -6393, -29691},
+    {11585, -12539, -27968},
+    {10426, -18204, -25171},
+    {8867, -23170, -21406},
+    {6967, -27245, -16819},
+    {4799, -30273, -11585},
+    {2446, -32137, -5906},
+    {3552, 32137, -5315},
+    {6967, 30273, -10426},
+    {10114, 27245, -15136},
+    {12872, 23170, -19265},
+    {15136, 18204, -22653},
+    {16819, 12539, -25171},
+    {17855, 6393, -26721},
+    {18204, 0, -27245},
+    {17855, -6393, -26721},
+    {16819, -12539, -25171},
+    {15136, -18204, -22653},
+    {12872, -23170, -19265},
+    {10114, -27245, -15136},
+    {6967, -30273, -10426},
+    {3552, -32137, -5315},
+    {4520, 32137, -4520},
+    {8867, 30273, -8867},
+    {12872, 27245, -12872},
+    {16384, 23170, -16383},
+    {19265, 18204, -19265},
+    {21406, 12539, -21406},
+    {22725, 6393, -22725},
+    {23170, 0, -23170},
+    {22725, -6393, -22725},
+    {21406, -12539, -21406},
+    {19265, -18204, -19265},
+    {16384, -23170, -16383},
+    {12872, -27245, -12872},
+    {8867, -30273, -8867},
+    {4520, -32137, -4520},
+    {5315, 32137, -3551},
+    {10426, 30273, -6967},
+    {15136, 27245, -10114},
+    {19265, 23170, -12872},
+    {22653, 18204, -15136},
+    {25171, 12539, -16819},
+    {26721, 6393, -17855},
+    {27245, 0, -18204},
+    {26721, -6393, -17855},
+    {25171, -12539, -16819},
+    {22653, -18204, -15136},
+    {19265, -23170, -12872},
+    {15136, -27245, -10114},
+    {10426, -30273, -6967},
+    {5315, -32137, -3551},
+    {0, 32767, 0},
+    {5906, 32137, -2446},
+    {11585, 30273, -4799},
+    {16819, 27245, -6966},
+    {21406, 23170, -8867},
+    {25171, 18204, -10426},
+    {27968, 12539, -11585},
+    {29691, 6393, -12298},
+    {30273, 0, -12539},
+    {29691, -6393, -12298},
+    {27968, -12539, -11585},
+    {25171, -18204, -10426},
+    {21406, -23170, -8867},
+    {16819, -27245, -6966},
+    {11585, -30273, -4799},
+    {5906, -32137, -2446},
+    {6270, 32137, -1247},
+    {12298, 30273, -2446},
+    {17855, 27245, -3551},
+    {22725, 23170, -4520},
+    {26721, 18204, -5315},
+    {29691, 12539, -5906},
+    {31520, 6393, -6270},
+    {32137, 0, -6393},
+    {31520, -6393, -6270},
+    {29691, -12539, -5906},
+    {26721, -18204, -5315},
+    {22725, -23170, -4520},
+    {17855, -27245, -3551},
+    {12298, -30273, -2446},
+    {6270, -32137, -1247},
+    {6393, 32137, 0},
+    {12539, 30273, 0},
+    {18204, 27245, 0},
+    {23170, 23170, 0},
+    {27245, 18204, 0},
+    {30273, 12539, 0},
+    {32137, 6393, 0},
+    {32767, 0, 0},
+    {32137, -6393, 0},
+    {30273, -12539, 0},
+    {27245, -18204, 0},
+    {23170, -23170, 0},
+    {18204, -27245, 0},
+    {12539, -30273, 0},
+    {6393, -32137, 0},
+    {6270, 32137, 1247},
+    {12298, 30273, 2446},
+    {17855, 27245, 3552},
+    {22725, 23170, 4520},
+    {26721, 18204, 5315},
+    {29691, 12539, 5906},
+    {31520, 6393, 6270},
+    {32137, 0, 6393},
+    {31520, -6393, 6270},
+    {29691, -12539, 5906},
+    {26721, -18204, 5315},
+    {22725, -23170, 4520},
+    {17855, -27245, 3552},
+    {12298, -30273, 2446},
+    {6270, -32137, 1247},
+    {5906, 32137, 2446},
+    {11585, 30273, 4799},
+    {16819, 27245, 6967},
+    {21406, 23170, 8867},
+    {25171, 18204, 10426},
+    {27968, 12539, 11585},
+    {29691, 6393, 12298},
+    {30273, 0, 12539},
+    {29691, -6393, 12298},
+    {27968, -12539, 11585},
+    {25171, -18204, 10426},
+    {21406, -23170, 8867},
+    {16819, -27245, 6967},
+    {11585, -30273, 4799},
+    {5906, -32137, 2446},
+    {5315, 32137, 3552},
+    {10426, 30273, 6967},
+    {15136, 27245, 10114},
+    {19265, 23170, 12872},
+    {22653, 18204, 15136},
+    {25171, 12539, 16819},
+    {26721, 6393, 17855},
+    {27245, 0, 18204},
+    {26721, -6393, 17855},
+    {25171, -12539, 16819},
+    {22653, -18204, 15136},
+    {19265, -23170, 12872},
+    {15136, -27245, 10114},
+    {10426, -30273, 6967},
+    {5315, -32137, 3552},
+    {4520, 32137, 4520},
+    {8867, 30273, 8867},
+    {12872, 27245, 12872},
+    {16384, 23170, 16384},
+    {19265, 18204, 19265},
+    {21406, 12539, 21406},
+    {22725, 6393, 22725},
+    {23170, 0, 23170},
+    {22725, -6393, 22725},
+    {21406, -12539, 21406},
+    {19265, -18204, 19265},
+    {16384, -23170, 16384},
+    {12872, -27245, 12872},
+    {8867, -30273, 8867},
+    {4520, -32137, 4520},
+    {3552, 32137, 5315},
+    {6967, 30273, 10426},
+    {10114, 27245, 15136},
+    {12872, 23170, 19265},
+    {15136, 18204, 22653},
+    {16819, 12539, 25171},
+    {17855, 6393, 26721},
+    {18204, 0, 27245},
+    {17855, -6393, 26721},
+    {16819, -12539, 25171},
+    {15136, -18204, 22653},
+    {12872, -23170, 19265},
+    {10114, -27245, 15136},
+    {6967, -30273, 10426},
+    {3552, -32137, 5315},
+    {2446, 32137, 5906},
+    {4799, 30273, 11585},
+    {6967, 27245, 16819},
+    {8867, 23170, 21406},
+    {10426, 18204, 25171},
+    {11585, 12539, 27968},
+    {12298, 6393, 29691},
+    {12539, 0, 30273},
+    {12298, -6393, 29691},
+    {11585, -12539, 27968},
+    {10426, -18204, 25171},
+    {8867, -23170, 21406},
+    {6967, -27245, 16819},
+    {4799, -30273, 11585},
+    {2446, -32137, 5906},
+    {1247, 32137, 6270},
+    {2446, 30273, 12298},
+    {3552, 27245, 17855},
+    {4520, 23170, 22725},
+    {5315, 18204, 26721},
+    {5906, 12539, 29691},
+    {6270, 6393, 31520},
+    {6393, 0, 32137},
+    {6270, -6393, 31520},
+    {5906, -12539, 29691},
+    {5315, -18204, 26721},
+    {4520, -23170, 22725},
+    {3552, -27245, 17855},
+    {2446, -30273, 12298},
+    {1247, -32137, 6270},
+    {0, 32137, 6393},
+    {0, 30273, 12539},
+    {0, 27245, 18204},
+    {0, 23170, 23170},
+    {0, 18204, 27245},
+    {0, 12539, 30273},
+    {0, 6393, 32137},
+    {0, 0, 32767},
+    {0, -6393, 32137},
+    {0, -12539, 30273},
+    {0, -18204, 27245},
+    {0, -23170, 23170},
+    {0, -27245, 18204},
+    {0, -30273, 12539},
+    {0, -32137, 6393},
+    {-1247, 32137, 6270},
+    {-2446, 30273, 12298},
+    {-3552, 27245, 17855},
+    {-4520, 23170, 22725},
+    {-5315, 18204, 26721},
+    {-5906, 12539, 29691},
+    {-6270, 6393, 31520},
+    {-6392, 0, 32137},
+    {-6270, -6393, 31520},
+    {-5906, -12539, 29691},
+    {-5315, -18204, 26721},
+    {-4520, -23170, 22725},
+    {-3552, -27245, 17855},
+    {-2446, -30273, 12298},
+    {-1247, -32137, 6270},
+    {-2446, 32137, 5906},
+    {-4799, 30273, 11585},
+    {-6966, 27245, 16819},
+    {-8867, 23170, 21406},
+    {-10426, 18204, 25171},
+    {-11585, 12539, 27968},
+    {-12298, 6393, 29691},
+    {-12539, 0, 30273},
+    {-12298, -6393, 29691},
+    {-11585, -12539, 27968},
+    {-10426, -18204, 25171},
+    {-8867, -23170, 21406},
+    {-6966, -27245, 16819},
+    {-4799, -30273, 11585},
+    {-2446, -32137, 5906},
+    {-3552, 32137, 5315},
+    {-6966, 30273, 10426},
+    {-10114, 27245, 15136},
+    {-12872, 23170, 19265},
+    {-15136, 18204, 22653},
+    {-16819, 12539, 25171},
+    {-17855, 6393, 26721},
+    {-18204, 0, 27245},
+    {-17855, -6393, 26721},
+    {-16819, -12539, 25171},
+    {-15136, -18204, 22653},
+    {-12872, -23170, 19265},
+    {-10114, -27245, 15136},
+    {-6966, -30273, 10426},
+    {-3552, -32137, 5315},
+    {-4520, 32137, 4520},
+    {-8867, 30273, 8867},
+    {-12872, 27245, 12872},
+    {-16383, 23170, 16384},
+    {-19265, 18204, 19265},
+    {-21406, 12539, 21406},
+    {-22725, 6393, 22725},
+    {-23170, 0, 23170},
+    {-22725, -6393, 22725},
+    {-21406, -12539, 21406},
+    {-19265, -18204, 19265},
+    {-16383, -23170, 16384},
+    {-12872, -27245, 12872},
+    {-8867, -30273, 8867},
+    {-4520, -32137, 4520},
+    {0, -32767, 0},
+    {-5315, 32137, 3552},
+    {-10426, 30273, 6967},
+    {-15136, 27245, 10114},
+    {-19265, 23170, 12872},
+    {-22653, 18204, 15136},
+    {-25171, 12539, 16819},
+    {-26721, 6393, 17855},
+    {-27245, 0, 18204},
+    {-26721, -6393, 17855},
+    {-25171, -12539, 16819},
+    {-22653, -18204, 15136},
+    {-19265, -23170, 12872},
+    {-15136, -27245, 10114},
+    {-10426, -30273, 6967},
+    {-5315, -32137, 3552},
+    {-5906, 32137, 2446},
+    {-11585, 30273, 4799},
+    {-16819, 27245, 6967},
+    {-21406, 23170, 8867},
+    {-25171, 18204, 10426},
+    {-27968, 12539, 11585},
+    {-29691, 6393, 12298},
+    {-30273, 0, 12539},
+    {-29691, -6393, 12298},
+    {-27968, -12539, 11585},
+    {-25171, -18204, 10426},
+    {-21406, -23170, 8867},
+    {-16819, -27245, 6967},
+    {-11585, -30273, 4799},
+    {-5906, -32137, 2446},
+    {-6270, 32137, 1247},
+    {-12298, 30273, 2446},
+    {-17855, 27245, 3552},
+    {-22725, 23170, 4520},
+    {-26721, 18204, 5315},
+    {-29691, 12539, 5906},
+    {-31520, 6393, 6270},
+    {-32137, 0, 6393},
+    {-31520, -6393, 6270},
+    {-29691, -12539, 5906},
+    {-26721, -18204, 5315},
+    {-22725, -23170, 4520},
+    {-17855, -27245, 3552},
+    {-12298, -30273, 2446},
+    {-6270, -32137, 1247},
+    {-6392, 32137, 0},
+    {-12539, 30273, 0},
+    {-18204, 27245, 0},
+    {-23170, 23170, 0},
+    {-27245, 18204, 0},
+    {-30273, 12539, 0},
+    {-32137, 6393, 0},
+    {-32767, 0, 0},
+    {-32137, -6393, 0},
+    {-30273, -12539, 0},
+    {-27245, -18204, 0},
+    {-23170, -23170, 0},
+    {-18204, -27245, 0},
+    {-12539, -30273, 0},
+    {-6392, -32137, 0},
+    {-6270, 32137, -1247},
+    {-12298, 30273, -2446},
+    {-17855, 27245, -3551},
+    {-22725, 23170, -4520},
+    {-26721, 18204, -5315},
+    {-29691, 12539, -5906},
+    {-31520, 6393, -6270},
+    {-32137, 0, -6393},
+    {-31520, -6393, -6270},
+    {-29691, -12539, -5906},
+    {-26721, -18204, -5315},
+    {-22725, -23170, -4520},
+    {-17855, -27245, -3551},
+    {-12298, -30273, -2446},
+    {-6270, -32137, -1247},
+    {-5906, 32137, -2446},
+    {-11585, 30273, -4799},
+    {-16819, 27245, -6966},
+    {-21406, 23170, -8867},
+    {-25171, 18204, -10426},
+    {-27968, 12539, -11585},
+    {-29691, 6393, -12298},
+    {-30273, 0, -12539},
+    {-29691, -6393, -12298},
+    {-27968, -12539, -11585},
+    {-25171, -18204, -10426},
+    {-21406, -23170, -8867},
+    {-16819, -27245, -6966},
+    {-11585, -30273, -4799},
+    {-5906, -32137, -2446},
+    {-5315, 32137, -3551},
+    {-10426, 30273, -6966},
+    {-15136, 27245, -10114},
+    {-19265, 23170, -12872},
+    {-22653, 18204, -15136},
+    {-25171, 12539, -16819},
+    {-26721, 6393, -17855},
+    {-27245, 0, -18204},
+    {-26721, -6393, -17855},
+    {-25171, -12539, -16819},
+    {-22653, -18204, -15136},
+    {-19265, -23170, -12872},
+    {-15136, -27245, -10114},
+    {-10426, -30273, -6966},
+    {-5315, -32137, -3551},
+    {-4520, 32137, -4520},
+    {-8867, 30273, -8867},
+    {-12872, 27245, -12872},
+    {-16383, 23170, -16383},
+    {-19265, 18204, -19265},
+    {-21406, 12539, -21406},
+    {-22725, 6393, -22725},
+    {-23170, 0, -23170},
+    {-22725, -6393, -22725},
+    {-21406, -12539, -21406},
+    {-19265, -18204, -19265},
+    {-16383, -23170, -16383},
+    {-12872, -27245, -12872},
+    {-8867, -30273, -8867},
+    {-4520, -32137, -4520},
+    {-3551, 32137, -5315},
+    {-6966, 30273, -10426},
+    {-10114, 27245, -15136},
+    {-12872, 23170, -19265},
+    {-15136, 18204, -22653},
+    {-16819, 12539, -25171},
+    {-17855, 6393, -26721},
+    {-18204, 0, -27245},
+    {-17855, -6393, -26721},
+    {-16819, -12539, -25171},
+    {-15136, -18204, -22653},
+    {-12872, -23170, -19265},
+    {-10114, -27245, -15136},
+    {-6966, -30273, -10426},
+    {-3551, -32137, -5315},
+    {-2446, 32137, -5906},
+    {-4799, 30273, -11585},
+    {-6966, 27245, -16819},
+    {-8867, 23170, -21406},
+    {-10426, 18204, -25171},
+    {-11585, 12539, -27968},
+    {-12298, 6393, -29691},
+    {-12539, 0, -30273},
+    {-12298, -6393, -29691},
+    {-11585, -12539, -27968},
+    {-10426, -18204, -25171},
+    {-8867, -23170, -21406},
+    {-6966, -27245, -16819},
+    {-4799, -30273, -11585},
+    {-2446, -32137, -5906},
+    {-1247, 32137, -6270},
+    {-2446, 30273, -12298},
+    {-3551, 27245, -17855},
+    {-4520, 23170, -22725},
+    {-5315, 18204, -26721},
+    {-5906, 12539, -29691},
+    {-6270, 6393, -31520},
+    {-6392, 0, -32137},
+    {-6270, -6393, -31520},
+    {-5906, -12539, -29691},
+    {-5315, -18204, -26721},
+    {-4520, -23170, -22725},
+    {-3551, -27245, -17855},
+    {-2446, -30273, -12298},
+    {-1247, -32137, -6270},
+    {0, 32137, -6393},
+    {0, 30273, -12539},
+    {0, 23170, -23170},
+    {0, 12539, -30273},
+    {0, -12539, -30273},
+    {0, -23170, -23170},
+    {0, -27245, -18204},
+    {0, -30273, -12539},
+    {0, -32137, -6393},
+};
+constexpr m3::vec3 monkey_1_normals[] = {
+    {0.28690001368522644f, -0.413100004196167f, -0.864300012588501f},
+    {0.10610000044107437f, 0.9416999816894531f, -0.31940001249313354f},
+    {0.24609999358654022f, -0.6244000196456909f, -0.7414000034332275f},
+    {0.15160000324249268f, 0.8766999840736389f, -0.45660001039505005f},
+    {0.19900000095367432f, -0.7752000093460083f, -0.5995000004768372f},
+    {0.19900000095367432f, 0.7752000093460083f, -0.5995000004768372f},
+    {0.15160000324249268f, -0.8766999840736389f, -0.45660001039505005f},
+    {0.24609999358654022f, 0.6244000196456909f, -0.7414000034332275f},
+    {0.10599999874830246f, -0.9416999816894531f, -0.31940001249313354f},
+    {0.28690001368522644f, 0.413100004196167f, -0.864300012588501f},
+    {0.06260000169277191f, -0.9800000190734863f, -0.18870000541210175f},
+    {0.3116999864578247f, 0.14569999277591705f, -0.9388999938964844f},
+    {0.02070000022649765f, 0.9977999925613403f, -0.06239999830722809f},
+    {0.02070000022649765f, -0.9977999925613403f, -0.06239999830722809f},
+    {0.3116999864578247f, -0.14569999277591705f, -0.9388999938964844f},
+    {0.06260000169277191f, 0.9800000190734863f, -0.18870000541210175f},
+    {0.06120000034570694f, -0.9962999820709229f, -0.05990000069141388f},
+    {0.7103999853134155f, -0.11209999769926071f, -0.6948000192642212f},
+    {0.18299999833106995f, 0.96670001745224f, -0.17900000512599945f},
+    {0.6753000020980835f, -0.32829999923706055f, -0.6604999899864197f},
+    {0.30230000615119934f, 0.9061999917030334f, -0.2955999970436096f},
+    {0.6097000241279602f, -0.5221999883651733f, -0.5963000059127808f},
+    {0.4162999987602234f, 0.8130000233650208f, -0.40720000863075256f},
+    {0.5209000110626221f, -0.6850000023841858f, -0.5094000101089478f},
+    {0.5209000110626221f, 0.6850000023841858f, -0.5094000101089478f},
+    {0.4162999987602234f, -0.8130000233650208f, -0.40720000863075256f},
+    {0.6097000241279602f, 0.5221999883651733f, -0.5963000059127808f},
+    {0.30230000615119934f, -0.9061999917030334f, -0.2955999970436096f},
+    {0.6753000020980835f, 0.32829999923706055f, -0.6604999899864197f},
+    {0.18299999833106995f, -0.96670001745224f, -0.17900000512599945f},
+    {0.7103999853134155f, 0.11209999769926071f, -0.6948000192642212f},
+    {0.06120000034570694f, 0.9962999820709229f, -0.05990000069141388f},
+    {0.6025999784469604f, -0.7246000170707703f, -0.3345000147819519f},
+    {0.7940000295639038f, 0.4187999963760376f, -0.4406999945640564f},
+    {0.46050000190734863f, -0.8500999808311462f, -0.2556000053882599f},
+    {0.8458999991416931f, 0.2531999945640564f, -0.46950000524520874f},
+    {0.28999999165534973f, -0.9434000253677368f, -0.16099999845027924f},
+    {0.8712000250816345f, 0.08470000326633453f, -0.483599990606308f},
+    {0.09920000284910202f, 0.9934999942779541f, -0.054999999701976776f},
+    {0.09920000284910202f, -0.9934999942779541f, -0.054999999701976776f},
+    {0.8712000250816345f, -0.08470000326633453f, -0.483599990606308f},
+    {0.28999999165534973f, 0.9434000253677368f, -0.16099999845027924f},
+    {0.8458999991416931f, -0.2531999945640564f, -0.46950000524520874f},
+    {0.46050000190734863f, 0.8500999808311462f, -0.2556000053882599f},
+    {0.7940000295639038f, -0.4187999963760376f, -0.4406999945640564f},
+    {0.6025999784469604f, 0.7246000170707703f, -0.3345000147819519f},
+    {0.7135999798774719f, -0.5778999924659729f, -0.3961000144481659f},
+    {0.7135999798774719f, 0.5778999924659729f, -0.3961000144481659f},
+    {0.37869998812675476f, 0.9154000282287598f, -0.13689999282360077f},
+    {0.9204999804496765f, -0.20479999482631683f, -0.3328000009059906f},
+    {0.5760999917984009f, 0.7904000282287598f, -0.20829999446868896f},
+    {0.8823999762535095f, -0.3458999991416931f, -0.3190000057220459f},
+    {0.7200000286102295f, 0.6432999968528748f, -0.26030001044273376f},
+    {0.8184999823570251f, -0.4925000071525574f, -0.29589998722076416f},
+    {0.8184999823570251f, 0.4925000071525574f, -0.29589998722076416f},
+    {0.7200000286102295f, -0.6432999968528748f, -0.26030001044273376f},
+    {0.8823999762535095f, 0.3458999991416931f, -0.3190000057220459f},
+    {0.5760999917984009f, -0.7904000282287598f, -0.20829999446868896f},
+    {0.9204999804496765f, 0.20479999482631683f, -0.3328000009059906f},
+    {0.37869998812675476f, -0.9154000282287598f, -0.13689999282360077f},
+    {0.9383000135421753f, 0.06780000030994415f, -0.3391999900341034f},
+    {0.13300000131130219f, 0.9900000095367432f, -0.04809999838471413f},
+    {0.13300000131130219f, -0.9900000095367432f, -0.04809999838471413f},
+    {0.9383000135421753f, -0.06780000030994415f, -0.3391999900341034f},
+    {0.9273999929428101f, 0.29829999804496765f, -0.22579999268054962f},
+    {0.6556000113487244f, -0.738099992275238f, -0.15960000455379486f},
+    {0.9567000269889832f, 0.1746000051498413f, -0.2328999936580658f},
+    {0.4474000036716461f, -0.8877000212669373f, -0.10890000313520432f},
+    {0.9700000286102295f, 0.057500001043081284f, -0.2362000048160553f},
+    {0.16140000522136688f, 0.9861000180244446f, -0.03929999843239784f},
+    {0.16140000522136688f, -0.9861000180244446f, -0.03929999843239784f},
+    {0.9700000286102295f, -0.057500001043081284f, -0.2362000048160553f},
+    {0.4474000036716461f, 0.8877000212669373f, -0.10890000313520432f},
+    {0.9567000269889832f, -0.1746000051498413f, -0.2328999936580658f},
+    {0.6556000113487244f, 0.738099992275238f, -0.15960000455379486f},
+    {0.9273999929428101f, -0.29829999804496765f, -0.22579999268054962f},
+    {0.7912999987602234f, 0.580299973487854f, -0.19269999861717224f},
+    {0.8759999871253967f, -0.4325999915599823f, -0.21330000460147858f},
+    {0.8759999871253967f, 0.4325999915599823f, -0.21330000460147858f},
+    {0.7912999987602234f, -0.580299973487854f, -0.19269999861717224f},
+    {0.975600004196167f, -0.15610000491142273f, -0.15469999611377716f},
+    {0.7073000073432922f, 0.6980000138282776f, -0.11219999939203262f},
+    {0.9514999985694885f, -0.26829999685287476f, -0.1509000062942505f},
+    {0.8338000178337097f, 0.5358999967575073f, -0.13220000267028809f},
+    {0.9081000089645386f, -0.39309999346733093f, -0.14399999380111694f},
+    {0.9081000089645386f, 0.39309999346733093f, -0.14399999380111694f},
+    {0.8338000178337097f, -0.5358999967575073f, -0.13220000267028809f},
+    {0.9514999985694885f, 0.26829999685287476f, -0.1509000062942505f},
+    {0.7073000073432922f, -0.6980000138282776f, -0.11219999939203262f},
+    {0.975600004196167f, 0.15610000491142273f, -0.15469999611377716f},
+    {0.4970000088214874f, -0.8641999959945679f, -0.07880000025033951f},
+    {0.9864000082015991f, 0.05119999870657921f, -0.15639999508857727f},
+    {0.1835000067949295f, 0.9825999736785889f, -0.029100000858306885f},
+    {0.1835000067949295f, -0.9825999736785889f, -0.029100000858306885f},
+    {0.9864000082015991f, -0.05119999870657921f, -0.15639999508857727f},
+    {0.4970000088214874f, 0.8641999959945679f, -0.07880000025033951f},
+    {0.7382000088691711f, -0.6712999939918518f, -0.06639999896287918f},
+    {0.9854000210762024f, 0.1453000009059906f, -0.08869999647140503f},
+    {0.5288000106811523f, -0.8474000096321106f, -0.047600001096725464f},
+    {0.9947999715805054f, 0.047600001096725464f, -0.08950000256299973f},
+    {0.19850000739097595f, 0.9799000024795532f, -0.017899999395012856f},
+    {0.19850000739097595f, -0.9799000024795532f, -0.017899999395012856f},
+    {0.9947999715805054f, -0.047600001096725464f, -0.08950000256299973f},
+    {0.5288000106811523f, 0.8474000096321106f, -0.047600001096725464f},
+    {0.9854000210762024f, -0.1453000009059906f, -0.08869999647140503f},
+    {0.7382000088691711f, 0.6712999939918518f, -0.06639999896287918f},
+    {0.9642000198364258f, -0.25049999356269836f, -0.0868000015616417f},
+    {0.8578000068664551f, 0.5080999732017517f, -0.07720000296831131f},
+    {0.925599992275238f, -0.3693000078201294f, -0.08330000191926956f},
+    {0.925599992275238f, 0.3693000078201294f, -0.08330000191926956f},
+    {0.8578000068664551f, -0.5080999732017517f, -0.07720000296831131f},
+    {0.9642000198364258f, 0.25049999356269836f, -0.0868000015616417f},
+    {0.7526000142097473f, 0.6581000089645386f, -0.02199999988079071f},
+    {0.9697999954223633f, -0.24230000376701355f, -0.028300000354647636f},
+    {0.8687000274658203f, 0.49480000138282776f, -0.02539999969303608f},
+    {0.9333000183105469f, -0.3580000102519989f, -0.027300000190734863f},
+    {0.9333000183105469f, 0.3580000102519989f, -0.027300000190734863f},
+    {0.8687000274658203f, -0.49480000138282776f, -0.02539999969303608f},
+    {0.9697999954223633f, 0.24230000376701355f, -0.028300000354647636f},
+    {0.7526000142097473f, -0.6581000089645386f, -0.02199999988079071f},
+    {0.9897000193595886f, 0.14030000567436218f, -0.02889999933540821f},
+    {0.5443000197410583f, -0.838699996471405f, -0.01590000092983246f},
+    {0.9984999895095825f, 0.04600000008940697f, -0.029200000688433647f},
+    {0.2062000036239624f, 0.9785000085830688f, -0.006000000052154064f},
+    {0.2062000036239624f, -0.9785000085830688f, -0.006000000052154064f},
+    {0.9984999895095825f, -0.04600000008940697f, -0.029200000688433647f},
+    {0.5443000197410583f, 0.838699996471405f, -0.01590000092983246f},
+    {0.9897000193595886f, -0.14030000567436218f, -0.02889999933540821f},
+    {0.9897000193595886f, 0.14030000567436218f, 0.02889999933540821f},
+    {0.5443000197410583f, -0.838699996471405f, 0.01590000092983246f},
+    {0.9984999895095825f, 0.04600000008940697f, 0.029200000688433647f},
+    {0.2062000036239624f, 0.9785000085830688f, 0.006000000052154064f},
+    {0.2062000036239624f, -0.9785000085830688f, 0.006000000052154064f},
+    {0.9984999895095825f, -0.04600000008940697f, 0.029200000688433647f},
+    {0.5443000197410583f, 0.838699996471405f, 0.01590000092983246f},
+    {0.9897000193595886f, -0.14030000567436218f, 0.02889999933540821f},
+    {0.7526000142097473f, 0.6581000089645386f, 0.02199999988079071f},
+    {0.9697999954223633f, -0.24230000376701355f, 0.028300000354647636f},
+    {0.8687000274658203f, 0.49480000138282776f, 0.02539999969303608f},
+    {0.9333000183105469f, -0.3580000102519989f, 0.027300000190734863f},
+    {0.9333000183105469f, 0.3580000102519989f, 0.027300000190734863f},
+    {0.8687000274658203f, -0.49480000138282776f, 0.02539999969303608f},
+    {0.9697999954223633f, 0.24230000376701355f, 0.028300000354647636f},
+    {0.7526000142097473f, -0.6581000089645386f, 0.02199999988079071f},
+    {0.9642000198364258f, -0.25049999356269836f, 0.0868000015616417f},
+    {0.8578000068664551f, 0.5080999732017517f, 0.07720000296831131f},
+    {0.925599992275238f, -0.3693000078201294f, 0.08330000191926956f},
+    {0.925599992275238f, 0.3693000078201294f, 0.08330000191926956f},
+    {0.8578000068664551f, -0.5080999732017517f, 0.07720000296831131f},
+    {0.9642000198364258f, 0.25049999356269836f, 0.0868000015616417f},
+    {0.7382000088691711f, -0.6712999939918518f, 0.06639999896287918f},
+    {0.9854000210762024f, 0.1453000009059906f, 0.08869999647140503f},
+    {0.5288000106811523f, -0.8474000096321106f, 0.047600001096725464f},
+    {0.9947999715805054f, 0.047600001096725464f, 0.08950000256299973f},
+    {0.19850000739097595f, 0.9799000024795532f, 0.017899999395012856f},
+    {0.19850000739097595f, -0.9799000024795532f, 0.017899999395012856f},
+    {0.9947999715805054f, -0.047600001096725464f, 0.08950000256299973f},
+    {0.5288000106811523f, 0.8474000096321106f, 0.047600001096725464f},
+    {0.9854000210762024f, -0.1453000009059906f, 0.08869999647140503f},
+    {0.7382000088691711f, 0.6712999939918518f, 0.06639999896287918f},
+    {0.4970000088214874f, -0.8641999959945679f, 0.07880000025033951f},
+    {0.9864000082015991f, 0.05119999870657921f, 0.15639999508857727f},
+    {0.1835000067949295f, 0.9825999736785889f, 0.029100000858306885f},
+    {0.1835000067949295f, -0.9825999736785889f, 0.029100000858306885f},
+    {0.9864000082015991f, -0.05119999870657921f, 0.15639999508857727f},
+    {0.4970000088214874f, 0.8641999959945679f, 0.07880000025033951f},
+    {0.975600004196167f, -0.15610000491142273f, 0.15469999611377716f},
+    {0.7073000073432922f, 0.6980000138282776f, 0.11219999939203262f},
+    {0.9514999985694885f, -0.26829999685287476f, 0.1509000062942505f},
+    {0.8338000178337097f, 0.5358999967575073f, 0.13220000267028809f},
+    {0.9081000089645386f, -0.39309999346733093f, 0.14399999380111694f},
+    {0.9081000089645386f, 0.39309999346733093f, 0.14399999380111694f},
+    {0.8338000178337097f, -0.5358999967575073f, 0.13220000267028809f},
+    {0.9514999985694885f, 0.26829999685287476f, 0.1509000062942505f},
+    {0.7073000073432922f, -0.6980000138282776f, 0.11219999939203262f},
+    {0.975600004196167f, 0.15610000491142273f, 0.15469999611377716f},
+    {0.8759999871253967f, -0.4325999915599823f, 0.21330000460147858f},
+    {0.8759999871253967f, 0.4325999915599823f, 0.21330000460147858f},
+    {0.7912999987602234f, -0.580299973487854f, 0.19269999861717224f},
+    {0.9273999929428101f, 0.29829999804496765f, 0.22579999268054962f},
+    {0.6556000113487244f, -0.738099992275238f, 0.15960000455379486f},
+    {0.9567000269889832f, 0.1746000051498413f, 0.2328999936580658f},
+    {0.4474000036716461f, -0.8877000212669373f, 0.10890000313520432f},
+    {0.9700000286102295f, 0.057500001043081284f, 0.2362000048160553f},
+    {0.16140000522136688f, 0.9861000180244446f, 0.03929999843239784f},
+    {0.16140000522136688f, -0.9861000180244446f, 0.03929999843239784f},
+    {0.9700000286102295f, -0.057500001043081284f, 0.2362000048160553f},
+    {0.4474000036716461f, 0.8877000212669373f, 0.10890000313520432f},
+    {0.9567000269889832f, -0.1746000051498413f, 0.2328999936580658f},
+    {0.6556000113487244f, 0.738099992275238f, 0.15960000455379486f},
+    {0.9273999929428101f, -0.29829999804496765f, 0.22579999268054962f},
+    {0.7912999987602234f, 0.580299973487854f, 0.19269999861717224f},
+    {0.13300000131130219f, 0.9900000095367432f, 0.04809999838471413f},
+    {0.13300000131130219f, -0.9900000095367432f, 0.04809999838471413f},
+    {0.9383000135421753f, -0.06780000030994415f, 0.3391999900341034f},
+    {0.37869998812675476f, 0.9154000282287598f, 0.13689999282360077f},
+    {0.9204999804496765f, -0.20479999482631683f, 0.3328000009059906f},
+    {0.5760999917984009f, 0.7904000282287598f, 0.20829999446868896f},
+    {0.8823999762535095f, -0.3458999991416931f, 0.3190000057220459f},
+    {0.7200000286102295f, 0.6432999968528748f, 0.26030001044273376f},
+    {0.8184999823570251f, -0.4925000071525574f, 0.29589998722076416f},
+    {0.8184999823570251f, 0.4925000071525574f, 0.29589998722076416f},
+    {0.7200000286102295f, -0.6432999968528748f, 0.26030001044273376f},
+    {0.8823999762535095f, 0.3458999991416931f, 0.3190000057220459f},
+    {0.5760999917984009f, -0.7904000282287598f, 0.20829999446868896f},
+    {0.9204999804496765f, 0.20479999482631683f, 0.3328000009059906f},
+    {0.37869998812675476f, -0.9154000282287598f, 0.13689999282360077f},
+    {0.9383000135421753f, 0.06780000030994415f, 0.3391999900341034f},
+    {0.7135999798774719f, 0.5778999924659729f, 0.3961000144481659f},
+    {0.6025999784469604f, -0.7246000170707703f, 0.3345000147819519f},
+    {0.7940000295639038f, 0.4187999963760376f, 0.4406999945640564f},
+    {0.4603999853134155f, -0.8500999808311462f, 0.2556000053882599f},
+    {0.8458999991416931f, 0.2531999945640564f, 0.46950000524520874f},
+    {0.28999999165534973f, -0.9434000253677368f, 0.16099999845027924f},
+    {0.8712000250816345f, 0.08470000326633453f, 0.483599990606308f},
+    {0.09920000284910202f, 0.9934999942779541f, 0.054999999701976776f},
+    {0.09920000284910202f, -0.9934999942779541f, 0.054999999701976776f},
+    {0.8712000250816345f, -0.08470000326633453f, 0.483599990606308f},
+    {0.28999999165534973f, 0.9434000253677368f, 0.16099999845027924f},
+    {0.8458999991416931f, -0.2531999945640564f, 0.46950000524520874f},
+    {0.4603999853134155f, 0.8500999808311462f, 0.2556000053882599f},
+    {0.7940000295639038f, -0.4187999963760376f, 0.4406999945640564f},
+    {0.6025999784469604f, 0.7246000170707703f, 0.3345000147819519f},
+    {0.7135999798774719f, -0.5778999924659729f, 0.3961000144481659f},
+    {0.7103999853134155f, -0.11209999769926071f, 0.6948000192642212f},
+    {0.18299999833106995f, 0.96670001745224f, 0.17900000512599945f},
+    {0.6753000020980835f, -0.32829999923706055f, 0.6604999899864197f},
+    {0.30230000615119934f, 0.9061999917030334f, 0.2955999970436096f},
+    {0.6097000241279602f, -0.5221999883651733f, 0.5963000059127808f},
+    {0.4162999987602234f, 0.8130000233650208f, 0.40720000863075256f},
+    {0.5209000110626221f, -0.6850000023841858f, 0.5094000101089478f},
+    {0.5209000110626221f, 0.6850000023841858f, 0.5094000101089478f},
+    {0.4162999987602234f, -0.8130000233650208f, 0.40720000863075256f},
+    {0.6097000241279602f, 0.5221999883651733f, 0.5963000059127808f},
+    {0.30230000615119934f, -0.9061999917030334f, 0.2955999970436096f},
+    {0.6753000020980835f, 0.32829999923706055f, 0.6604999899864197f},
+    {0.18299999833106995f, -0.96670001745224f, 0.17900000512599945f},
+    {0.7103999853134155f, 0.11209999769926071f, 0.6948000192642212f},
+    {0.06120000034570694f, 0.9962999820709229f, 0.05990000069141388f},
+    {0.06120000034570694f, -0.9962999820709229f, 0.05990000069141388f},
+    {0.15160000324249268f, -0.8766999840736389f, 0.45660001039505005f},
+    {0.24609999358654022f, 0.6244000196456909f, 0.7414000034332275f},
+    {0.10610000044107437f, -0.9416999816894531f, 0.31940001249313354f},
+    {0.28690001368522644f, 0.413100004196167f, 0.864300012588501f},
+    {0.06260000169277191f, -0.9800000190734863f, 0.18870000541210175f},
+    {0.3116999864578247f, 0.14569999277591705f, 0.9388999938964844f},
+    {0.02070000022649765f, 0.9977999925613403f, 0.06239999830722809f},
+    {0.02070000022649765f, -0.9977999925613403f, 0.06239999830722809f},
+    {0.3116999864578247f, -0.14569999277591705f, 0.9388999938964844f},
+    {0.06260000169277191f, 0.9800000190734863f, 0.18870000541210175f},
+    {0.28690001368522644f, -0.413100004196167f, 0.864300012588501f},
+    {0.10610000044107437f, 0.9416999816894531f, 0.31940001249313354f},
+    {0.24609999358654022f, -0.6244000196456909f, 0.7414000034332275f},
+    {0.15160000324249268f, 0.8766999840736389f, 0.45660001039505005f},
+    {0.19900000095367432f, -0.7752000093460083f, 0.5995000004768372f},
+    {0.19900000095367432f, 0.7752000093460083f, 0.5995000004768372f},
+    {-0.06260000169277191f, 0.9800000190734863f, 0.18870000541210175f},
+    {-0.28690001368522644f, -0.413100004196167f, 0.864300012588501f},
+    {-0.10610000044107437f, 0.9416999816894531f, 0.31940001249313354f},
+    {-0.24609999358654022f, -0.6244000196456909f, 0.7414000034332275f},
+    {-0.15160000324249268f, 0.8766999840736389f, 0.45660001039505005f},
+    {-0.19900000095367432f, -0.7752000093460083f, 0.5995000004768372f},
+    {-0.19900000095367432f, 0.7752000093460083f, 0.5995000004768372f},
+    {-0.15160000324249268f, -0.8766999840736389f, 0.45660001039505005f},
+    {-0.24609999358654022f, 0.6244000196456909f, 0.7414000034332275f},
+    {-0.10610000044107437f, -0.9416999816894531f, 0.31940001249313354f},
+    {-0.28690001368522644f, 0.413100004196167f, 0.864300012588501f},
+    {-0.06260000169277191f, -0.9800000190734863f, 0.18870000541210175f},
+    {-0.3116999864578247f, 0.14569999277591705f, 0.9388999938964844f},
+    {-0.02070000022649765f, 0.9977999925613403f, 0.06239999830722809f},
+    {-0.02070000022649765f, -0.9977999925613403f, 0.06239999830722809f},
+    {-0.3116999864578247f, -0.14569999277591705f, 0.9388999938964844f},
+    {-0.6097000241279602f, 0.5221999883651733f, 0.5963000059127808f},
+    {-0.30230000615119934f, -0.9061999917030334f, 0.2955999970436096f},
+    {-0.6753000020980835f, 0.32829999923706055f, 0.6603999733924866f},
+    {-0.18299999833106995f, -0.96670001745224f, 0.17900000512599945f},
+    {-0.7103999853134155f, 0.11209999769926071f, 0.6948000192642212f},
+    {-0.06120000034570694f, 0.9962999820709229f, 0.05990000069141388f},
+    {-0.06120000034570694f, -0.9962999820709229f, 0.05990000069141388f},
+    {-0.7103999853134155f, -0.11209999769926071f, 0.6948000192642212f},
+    {-0.18299999833106995f, 0.96670001745224f, 0.17900000512599945f},
+    {-0.6753000020980835f, -0.32829999923706055f, 0.6604999899864197f},
+    {-0.30230000615119934f, 0.9061999917030334f, 0.2955999970436096f},
+    {-0.6097000241279602f, -0.5221999883651733f, 0.5963000059127808f},
+    {-0.4162999987602234f, 0.8130000233650208f, 0.40720000863075256f},
+    {-0.5209000110626221f, -0.6850000023841858f, 0.5094000101089478f},
+    {-0.5209000110626221f, 0.6850000023841858f, 0.5094000101089478f},
+    {-0.4162999987602234f, -0.8130000233650208f, 0.40720000863075256f},
+    {-0.8458999991416931f, -0.2531999945640564f, 0.46950000524520874f},
+    {-0.46050000190734863f, 0.8500999808311462f, 0.2556000053882599f},
+    {-0.7940000295639038f, -0.4187999963760376f, 0.4406999945640564f},
+    {-0.6025999784469604f, 0.7246000170707703f, 0.3345000147819519f},
+    {-0.7135999798774719f, -0.5778999924659729f, 0.3961000144481659f},
+    {-0.7135999798774719f, 0.5778999924659729f, 0.3961000144481659f},
+    {-0.6025999784469604f, -0.7246000170707703f, 0.3345000147819519f},
+    {-0.7940000295639038f, 0.4187999963760376f, 0.4406999945640564f},
+    {-0.46050000190734863f, -0.8500999808311462f, 0.2556000053882599f},
+    {-0.8458999991416931f, 0.2531999945640564f, 0.46950000524520874f},
+    {-0.28999999165534973f, -0.9434000253677368f, 0.16099999845027924f},
+    {-0.8712000250816345f, 0.08470000326633453f, 0.483599990606308f},
+    {-0.09920000284910202f, 0.9934999942779541f, 0.054999999701976776f},
+    {-0.09920000284910202f, -0.9934999942779541f, 0.054999999701976776f},
+    {-0.8712000250816345f, -0.08470000326633453f, 0.483599990606308f},
+    {-0.28999999165534973f, 0.9434000253677368f, 0.16099999845027924f},
+    {-0.5760999917984009f, -0.7904000282287598f, 0.20829999446868896f},
+    {-0.9204999804496765f, 0.20479999482631683f, 0.3328000009059906f},
+    {-0.37869998812675476f, -0.9154000282287598f, 0.13689999282360077f},
+    {-0.9383000135421753f, 0.06780000030994415f, 0.3391999900341034f},
+    {-0.13300000131130219f, 0.9900000095367432f, 0.04809999838471413f},
+    {-0.13300000131130219f, -0.9900000095367432f, 0.04809999838471413f},
+    {-0.9383000135421753f, -0.06780000030994415f, 0.3391999900341034f},
+    {-0.37869998812675476f, 0.9154000282287598f, 0.13689999282360077f},
+    {-0.9204999804496765f, -0.20479999482631683f, 0.3328000009059906f},
+    {-0.5760999917984009f, 0.7904000282287598f, 0.20829999446868896f},
+    {-0.8823999762535095f, -0.3458999991416931f, 0.3190000057220459f},
+    {-0.7200000286102295f, 0.6432999968528748f, 0.26030001044273376f},
+    {-0.8184999823570251f, -0.4925000071525574f, 0.29589998722076416f},
+    {-0.8184999823570251f, 0.4925000071525574f, 0.29589998722076416f},
+    {-0.7200000286102295f, -0.6432999968528748f, 0.26030001044273376f},
+    {-0.8823999762535095f, 0.3458999991416931f, 0.3190000057220459f},
+    {-0.9273999929428101f, -0.29829999804496765f, 0.22579999268054962f},
+    {-0.7912999987602234f, 0.580299973487854f, 0.19269999861717224f},
+    {-0.8759999871253967f, -0.4325999915599823f, 0.21330000460147858f},
+    {-0.8759999871253967f, 0.4325999915599823f, 0.21330000460147858f},
+    {-0.7912999987602234f, -0.580299973487854f, 0.19269999861717224f},
+    {-0.9273999929428101f, 0.29829999804496765f, 0.22579999268054962f},
+    {-0.6556000113487244f, -0.738099992275238f, 0.15960000455379486f},
+    {-0.9567000269889832f, 0.1746000051498413f, 0.2328999936580658f},
+    {-0.4474000036716461f, -0.8877000212669373f, 0.10890000313520432f},
+    {-0.9700000286102295f, 0.057500001043081284f, 0.2362000048160553f},
+    {-0.16140000522136688f, 0.9861000180244446f, 0.03929999843239784f},
+    {-0.16140000522136688f, -0.9861000180244446f, 0.03929999843239784f},
+    {-0.9700000286102295f, -0.057500001043081284f, 0.2362000048160553f},
+    {-0.4474000036716461f, 0.8877000212669373f, 0.10890000313520432f},
+    {-0.9567000269889832f, -0.1746000051498413f, 0.2328999936580658f},
+    {-0.6556000113487244f, 0.738099992275238f, 0.15960000455379486f},
+    {-0.4970000088214874f, -0.8641999959945679f, 0.07880000025033951f},
+    {-0.9864000082015991f, 0.05119999870657921f, 0.15639999508857727f},
+    {-0.1835000067949295f, 0.9825999736785889f, 0.029100000858306885f},
+    {-0.1835000067949295f, -0.9825999736785889f, 0.029100000858306885f},
+    {-0.9864000082015991f, -0.05119999870657921f, 0.15639999508857727f},
+    {-0.4970000088214874f, 0.8641999959945679f, 0.07880000025033951f},
+    {-0.975600004196167f, -0.15610000491142273f, 0.15469999611377716f},
+    {-0.7073000073432922f, 0.6980000138282776f, 0.11219999939203262f},
+    {-0.9514999985694885f, -0.26829999685287476f, 0.1509000062942505f},
+    {-0.8338000178337097f, 0.5358999967575073f, 0.13220000267028809f},
+    {-0.9081000089645386f, -0.39309999346733093f, 0.14399999380111694f},
+    {-0.9081000089645386f, 0.39309999346733093f, 0.14399999380111694f},
+    {-0.8338000178337097f, -0.5358999967575073f, 0.13220000267028809f},
+    {-0.9514999985694885f, 0.26829999685287476f, 0.1509000062942505f},
+    {-0.7073000073432922f, -0.6980000138282776f, 0.11219999939203262f},
+    {-0.975600004196167f, 0.15610000491142273f, 0.15469999611377716f},
+    {-0.8578000068664551f, 0.5080999732017517f, 0.07720000296831131f},
+    {-0.925599992275238f, -0.3693000078201294f, 0.08330000191926956f},
+    {-0.925599992275238f, 0.3693000078201294f, 0.08330000191926956f},
+    {-0.8578000068664551f, -0.5080999732017517f, 0.07720000296831131f},
+    {-0.9642000198364258f, 0.25049999356269836f, 0.0868000015616417f},
+    {-0.7382000088691711f, -0.6712999939918518f, 0.06639999896287918f},
+    {-0.9854000210762024f, 0.1453000009059906f, 0.08869999647140503f},
+    {-0.5288000106811523f, -0.8474000096321106f, 0.047600001096725464f},
+    {-0.9947999715805054f, 0.047600001096725464f, 0.08950000256299973f},
+    {-0.19850000739097595f, 0.9799000024795532f, 0.017899999395012856f},
+    {-0.19850000739097595f, -0.9799000024795532f, 0.017899999395012856f},
+    {-0.9947999715805054f, -0.047600001096725464f, 0.08950000256299973f},
+    {-0.5288000106811523f, 0.8474000096321106f, 0.047600001096725464f},
+    {-0.9854000210762024f, -0.1453000009059906f, 0.08869999647140503f},
+    {-0.7382000088691711f, 0.6712999939918518f, 0.06639999896287918f},
+    {-0.9642000198364258f, -0.25049999356269836f, 0.0868000015616417f},
+    {-0.9984999895095825f, 0.04600000008940697f, 0.029200000688433647f},
+    {-0.2062000036239624f, 0.9785000085830688f, 0.006000000052154064f},
+    {-0.2062000036239624f, -0.9785000085830688f, 0.006000000052154064f},
+    {-0.9984999895095825f, -0.04600000008940697f, 0.029200000688433647f},
+    {-0.5443000197410583f, 0.838699996471405f, 0.01590000092983246f},
+    {-0.9897000193595886f, -0.14030000567436218f, 0.02889999933540821f},
+    {-0.7526000142097473f, 0.6581000089645386f, 0.02199999988079071f},
+    {-0.9697999954223633f, -0.24230000376701355f, 0.028300000354647636f},
+    {-0.8687000274658203f, 0.49480000138282776f, 0.02539999969303608f},
+    {-0.9333000183105469f, -0.3580000102519989f, 0.027300000190734863f},
+    {-0.9333000183105469f, 0.3580000102519989f, 0.027300000190734863f},
+    {-0.8687000274658203f, -0.49480000138282776f, 0.02539999969303608f},
+    {-0.9697999954223633f, 0.24230000376701355f, 0.028300000354647636f},
+    {-0.7526000142097473f, -0.6581000089645386f, 0.02199999988079071f},
+    {-0.9897000193595886f, 0.14030000567436218f, 0.02889999933540821f},
+    {-0.5443000197410583f, -0.838699996471405f, 0.01590000092983246f},
+    {-0.9333000183105469f, -0.3580000102519989f, -0.027300000190734863f},
+    {-0.9333000183105469f, 0.3580000102519989f, -0.027300000190734863f},
+    {-0.8687000274658203f, -0.49480000138282776f, -0.02539999969303608f},
+    {-0.9697999954223633f, 0.24230000376701355f, -0.028300000354647636f},
+    {-0.7526000142097473f, -0.6581000089645386f, -0.02199999988079071f},
+    {-0.9897000193595886f, 0.14030000567436218f, -0.02889999933540821f},
+    {-0.5443000197410583f, -0.838699996471405f, -0.01590000092983246f},
+    {-0.9984999895095825f, 0.04600000008940697f, -0.029200000688433647f},
+    {-0.2062000036239624f, 0.9785000085830688f, -0.006000000052154064f},
+    {-0.2062000036239624f, -0.9785000085830688f, -0.006000000052154064f},
+    {-0.9984999895095825f, -0.04600000008940697f, -0.029200000688433647f},
+    {-0.5443000197410583f, 0.838699996471405f, -0.01590000092983246f},
+    {-0.9897000193595886f, -0.14030000567436218f, -0.02889999933540821f},
+    {-0.7526000142097473f, 0.6581000089645386f, -0.02199999988079071f},
+    {-0.9697999954223633f, -0.24230000376701355f, -0.028300000354647636f},
+    {-0.8687000274658203f, 0.49480000138282776f, -0.02539999969303608f},
+    {-0.19850000739097595f, 0.9799000024795532f, -0.017899999395012856f},
+    {-0.19850000739097595f, -0.9799000024795532f, -0.017899999395012856f},
+    {-0.9947999715805054f, -0.047600001096725464f, -0.08950000256299973f},
+    {-0.5288000106811523f, 0.8474000096321106f, -0.047600001096725464f},
+    {-0.9854000210762024f, -0.1453000009059906f, -0.08869999647140503f},
+    {-0.7382000088691711f, 0.6712999939918518f, -0.06639999896287918f},
+    {-0.9642000198364258f, -0.25049999356269836f, -0.0868000015616417f},
+    {-0.8578000068664551f, 0.5080999732017517f, -0.07720000296831131f},
+    {-0.925599992275238f, -0.3693000078201294f, -0.08330000191926956f},
+    {-0.925599992275238f, 0.3693000078201294f, -0.08330000191926956f},
+    {-0.8578000068664551f, -0.5080999732017517f, -0.07720000296831131f},
+    {-0.9642000198364258f, 0.25049999356269836f, -0.0868000015616417f},
+    {-0.7382000088691711f, -0.6712999939918518f, -0.06639999896287918f},
+    {-0.9854000210762024f, 0.1453000009059906f, -0.08869999647140503f},
+    {-0.5288000106811523f, -0.8474000096321106f, -0.047600001096725464f},
+    {-0.9947999715805054f, 0.047600001096725464f, -0.08950000256299973f},
+    {-0.9081000089645386f, 0.39309999346733093f, -0.14399999380111694f},
+    {-0.8338000178337097f, -0.5358999967575073f, -0.13220000267028809f},
+    {-0.9514999985694885f, 0.26829999685287476f, -0.1509000062942505f},
+    {-0.7073000073432922f, -0.6980000138282776f, -0.11219999939203262f},
+    {-0.975600004196167f, 0.15610000491142273f, -0.15469999611377716f},
+    {-0.4970000088214874f, -0.8641999959945679f, -0.07880000025033951f},
+    {-0.9864000082015991f, 0.05119999870657921f, -0.15639999508857727f},
+    {-0.1835000067949295f, 0.9825999736785889f, -0.029100000858306885f},
+    {-0.1835000067949295f, -0.9825999736785889f, -0.029100000858306885f},
+    {-0.9864000082015991f, -0.05119999870657921f, -0.15639999508857727f},
+    {-0.4970000088214874f, 0.8641999959945679f, -0.07880000025033951f},
+    {-0.975600004196167f, -0.15610000491142273f, -0.15469999611377716f},
+    {-0.7073000073432922f, 0.6980000138282776f, -0.11219999939203262f},
+    {-0.9514999985694885f, -0.26829999685287476f, -0.1509000062942505f},
+    {-0.8338000178337097f, 0.5358999967575073f, -0.13220000267028809f},
+    {-0.9081000089645386f, -0.39309999346733093f, -0.14399999380111694f},
+    {-0.9700000286102295f, -0.057500001043081284f, -0.2362000048160553f},
+    {-0.4474000036716461f, 0.8877000212669373f, -0.10890000313520432f},
+    {-0.9567000269889832f, -0.1746000051498413f, -0.2328999936580658f},
+    {-0.6556000113487244f, 0.738099992275238f, -0.15960000455379486f},
+    {-0.9273999929428101f, -0.29829999804496765f, -0.22579999268054962f},
+    {-0.7912999987602234f, 0.580299973487854f, -0.19269999861717224f},
+    {-0.8759999871253967f, -0.4325999915599823f, -0.21330000460147858f},
+    {-0.8759999871253967f, 0.4325999915599823f, -0.21330000460147858f},
+    {-0.7912999987602234f, -0.580299973487854f, -0.19269999861717224f},
+    {-0.9273999929428101f, 0.29829999804496765f, -0.22579999268054962f},
+    {-0.6556000113487244f, -0.738099992275238f, -0.15960000455379486f},
+    {-0.9567000269889832f, 0.1746000051498413f, -0.2328999936580658f},
+    {-0.4474000036716461f, -0.8877000212669373f, -0.10890000313520432f},
+    {-0.9700000286102295f, 0.057500001043081284f, -0.2362000048160553f},
+    {-0.16140000522136688f, 0.9861000180244446f, -0.03929999843239784f},
+    {-0.16140000522136688f, -0.9861000180244446f, -0.03929999843239784f},
+    {-0.7200000286102295f, -0.6432999968528748f, -0.26030001044273376f},
+    {-0.8823999762535095f, 0.3458999991416931f, -0.3190000057220459f},
+    {-0.5760999917984009f, -0.7904000282287598f, -0.20829999446868896f},
+    {-0.9204999804496765f, 0.20479999482631683f, -0.3328000009059906f},
+    {-0.37869998812675476f, -0.9154000282287598f, -0.13689999282360077f},
+    {-0.9383000135421753f, 0.06780000030994415f, -0.3391999900341034f},
+    {-0.13300000131130219f, 0.9900000095367432f, -0.04809999838471413f},
+    {-0.13300000131130219f, -0.9900000095367432f, -0.04809999838471413f},
+    {-0.9383000135421753f, -0.06780000030994415f, -0.3391999900341034f},
+    {-0.37869998812675476f, 0.9154000282287598f, -0.13689999282360077f},
+    {-0.9204999804496765f, -0.20479999482631683f, -0.3328000009059906f},
+    {-0.5760999917984009f, 0.7904000282287598f, -0.20829999446868896f},
+    {-0.8823999762535095f, -0.3458999991416931f, -0.3190000057220459f},
+    {-0.7200000286102295f, 0.6432999968528748f, -0.26030001044273376f},
+    {-0.8184999823570251f, -0.4925000071525574f, -0.29589998722076416f},
+    {-0.8184999823570251f, 0.4925000071525574f, -0.29589998722076416f},
+    {-0.8458999991416931f, -0.2531999945640564f, -0.46950000524520874f},
+    {-0.46050000190734863f, 0.8500999808311462f, -0.2556000053882599f},
+    {-0.7940000295639038f, -0.4187999963760376f, -0.4406999945640564f},
+    {-0.6025999784469604f, 0.7246000170707703f, -0.3345000147819519f},
+    {-0.7135999798774719f, -0.5778999924659729f, -0.3961000144481659f},
+    {-0.7135999798774719f, 0.5778999924659729f, -0.3961000144481659f},
+    {-0.6025999784469604f, -0.7246000170707703f, -0.3345000147819519f},
+    {-0.7940000295639038f, 0.4187999963760376f, -0.4406999945640564f},
+    {-0.46050000190734863f, -0.8500999808311462f, -0.2556000053882599f},
+    {-0.8458999991416931f, 0.2531999945640564f, -0.46950000524520874f},
+    {-0.28999999165534973f, -0.9434000253677368f, -0.16099999845027924f},
+    {-0.8712000250816345f, 0.08470000326633453f, -0.483599990606308f},
+    {-0.09920000284910202f, 0.9934999942779541f, -0.054999999701976776f},
+    {-0.09920000284910202f, -0.9934999942779541f, -0.054999999701976776f},
+    {-0.8712000250816345f, -0.08470000326633453f, -0.483599990606308f},
+    {-0.28999999165534973f, 0.9434000253677368f, -0.16099999845027924f},
+    {-0.30230000615119934f, -0.9061999917030334f, -0.2955999970436096f},
+    {-0.6753000020980835f, 0.32829999923706055f, -0.6604999899864197f},
+    {-0.18299999833106995f, -0.96670001745224f, -0.17900000512599945f},
+    {-0.7103999853134155f, 0.11209999769926071f, -0.6948000192642212f},
+    {-0.06120000034570694f, 0.9962999820709229f, -0.05990000069141388f},
+    {-0.06120000034570694f, -0.9962999820709229f, -0.05990000069141388f},
+    {-0.7103999853134155f, -0.11209999769926071f, -0.6948000192642212f},
+    {-0.18299999833106995f, 0.96670001745224f, -0.17900000512599945f},
+    {-0.6753000020980835f, -0.32829999923706055f, -0.6604999899864197f},
+    {-0.30230000615119934f, 0.9061999917030334f, -0.2955999970436096f},
+    {-0.6097000241279602f, -0.5221999883651733f, -0.5963000059127808f},
+    {-0.4162999987602234f, 0.8130000233650208f, -0.40720000863075256f},
+    {-0.5209000110626221f, -0.6850000023841858f, -0.5094000101089478f},
+    {-0.5209000110626221f, 0.6850000023841858f, -0.5094000101089478f},
+    {-0.4162999987602234f, -0.8130000233650208f, -0.40720000863075256f},
+    {-0.6097000241279602f, 0.5221999883651733f, -0.5963000059127808f},
+    {-0.10610000044107437f, 0.9416999816894531f, -0.31940001249313354f},
+    {-0.24609999358654022f, -0.6244000196456909f, -0.7414000034332275f},
+    {-0.15160000324249268f, 0.8766999840736389f, -0.45660001039505005f},
+    {-0.19900000095367432f, -0.7752000093460083f, -0.5995000004768372f},
+    {-0.19900000095367432f, 0.7752000093460083f, -0.5995000004768372f},
+    {-0.15160000324249268f, -0.8766999840736389f, -0.45660001039505005f},
+    {-0.24609999358654022f, 0.6244000196456909f, -0.7414000034332275f},
+    {-0.10610000044107437f, -0.9416999816894531f, -0.31940001249313354f},
+    {-0.28690001368522644f, 0.413100004196167f, -0.864300012588501f},
+    {-0.06260000169277191f, -0.9800000190734863f, -0.18870000541210175f},
+    {-0.3116999864578247f, 0.14569999277591705f, -0.9388999938964844f},
+    {-0.02070000022649765f, 0.9977999925613403f, -0.06239999830722809f},
+    {-0.02070000022649765f, -0.9977999925613403f, -0.06239999830722809f},
+    {-0.3116999864578247f, -0.14569999277591705f, -0.9388999938964844f},
+    {-0.06260000169277191f, 0.9800000190734863f, -0.18870000541210175f},
+    {-0.28690001368522644f, -0.413100004196167f, -0.864300012588501f},
+    {0.10599999874830246f, 0.9416999816894531f, -0.31940001249313354f},
+    {0.4603999853134155f, 0.8500999808311462f, -0.2556000053882599f},
+    {0.46050000190734863f, -0.8500999808311462f, 0.2556000053882599f},
+    {-0.10599999874830246f, -0.9416999816894531f, 0.31940001249313354f},
+    {-0.6753000020980835f, 0.32829999923706055f, 0.6604999899864197f},
+    {-0.6753000020980835f, -0.32829999923706055f, 0.6603999733924866f},
+};
+constexpr face monkey_1_faces[] = {
+    {0, 3, 1, 0},
+    {3, 3, 1, 1},
+    {6, 3, 1, 2},
+    {9, 3, 1, 3},
+    {12, 3, 1, 4},
+    {15, 3, 1, 5},
+    {18, 3, 1, 6},
+    {21, 3, 1, 7},
+    {24, 3, 1, 8},
+    {27, 3, 1, 9},
+    {30, 3, 1, 10},
+    {33, 3, 1, 11},
+    {36, 3, 1, 12},
+    {39, 3, 1, 13},
+    {42, 3, 1, 14},
+    {45, 3, 1, 15},
+    {48, 3, 1, 16},
+    {51, 3, 1, 17},
+    {54, 3, 1, 18},
+    {57, 3, 1, 19},
+    {60, 3, 1, 20},
+    {63, 3, 1, 21},
+    {66, 3, 1, 22},
+    {69, 3, 1, 23},
+    {72, 3, 1, 24},
+    {75, 3, 1, 25},
+    {78, 3, 1, 26},
+    {81, 3, 1, 27},
+    {84, 3, 1, 28},
+    {87, 3, 1, 29},
+    {90, 3, 1, 30},
+    {93, 3, 1, 31},
+    {96, 3, 1, 32},
+    {99, 3, 1, 33},
+    {102, 3, 1, 34},
+    {105, 3, 1, 35},
+    {108, 3, 1, 36},
+    {111, 3, 1, 37},
+    {114, 3, 1, 38},
+    {117, 3, 1, 39},
+    {120, 3, 1, 40},
+    {123, 3, 1, 41},
+    {126, 3, 1, 42},
+    {129, 3, 1, 43},
+    {132, 3, 1, 44},
+    {135, 3, 1, 45},
+    {138, 3, 1, 46},
+    {141, 3, 1, 47},
+    {144, 3, 1, 48},
+    {147, 3, 1, 49},
+    {150, 3, 1, 50},
+    {153, 3, 1, 51},
+    {156, 3, 1, 52},
+    {159, 3, 1, 53},
+    {162, 3, 1, 54},
+    {165, 3, 1, 55},
+    {168, 3, 1, 56},
+    {171, 3, 1, 57},
+    {174, 3, 1, 58},
+    {177, 3, 1, 59},
+    {180, 3, 1, 60},
+    {183, 3, 1, 61},
+    {186, 3, 1, 62},
+    {189, 3, 1, 63},
+    {192, 3, 1, 64},
+    {195, 3, 1, 65},
+    {198, 3, 1, 66},
+    {201, 3, 1, 67},
+    {204, 3, 1, 68},
+    {207, 3, 1, 69},
+    {210, 3, 1, 70},
+    {213, 3, 1, 71},
+    {216, 3, 1, 72},
+    {219, 3, 1, 73},
+    {222, 3, 1, 74},
+    {225, 3, 1, 75},
+    {228, 3, 1, 76},
+    {231, 3, 1, 77},
+    {234, 3, 1, 78},
+    {237, 3, 1, 79},
+    {240, 3, 1, 80},
+    {243, 3, 1, 81},
+    {246, 3, 1, 82},
+    {249, 3, 1, 83},
+    {252, 3, 1, 84},
+    {255, 3, 1, 85},
+    {258, 3, 1, 86},
+    {261, 3, 1, 87},
+    {264, 3, 1, 88},
+    {267, 3, 1, 89},
+    {270, 3, 1, 90},
+    {273, 3, 1, 91},
+    {276, 3, 1, 92},
+    {279, 3, 1, 93},
+    {282, 3, 1, 94},
+    {285, 3, 1, 95},
+    {288, 3, 1, 96},
+    {291, 3, 1, 97},
+    {294, 3, 1, 98},
+    {297, 3, 1, 99},
+    {300, 3, 1, 100},
+    {303, 3, 1, 101},
+    {306, 3, 1, 102},
+    {309, 3, 1, 103},
+    {312, 3, 1, 104},
+    {315, 3, 1, 105},
+    {318, 3, 1, 106},
+    {321, 3, 1, 107},
+    {324, 3, 1, 108},
+    {327, 3, 1, 109},
+    {330, 3, 1, 110},
+    {333, 3, 1, 111},
+    {336, 3, 1, 112},
+    {339, 3, 1, 113},
+    {342, 3, 1, 114},
+    {345, 3, 1, 115},
+    {348, 3, 1, 116},
+    {351, 3, 1, 117},
+    {354, 3, 1, 118},
+    {357, 3, 1, 119},
+    {360, 3, 1, 120},
+    {363, 3, 1, 121},
+    {366, 3, 1, 122},
+    {369, 3, 1, 123},
+    {372, 3, 1, 124},
+    {375, 3, 1, 125},
+    {378, 3, 1, 126},
+    {381, 3, 1, 127},
+    {384, 3, 1, 128},
+    {387, 3, 1, 129},
+    {390, 3, 1, 130},
+    {393, 3, 1, 131},
+    {396, 3, 1, 132},
+    {399, 3, 1, 133},
+    {402, 3, 1, 134},
+    {405, 3, 1, 135},
+    {408, 3, 1, 136},
+    {411, 3, 1, 137},
+    {414, 3, 1, 138},
+    {417, 3, 1, 139},
+    {420, 3, 1, 140},
+    {423, 3, 1, 141},
+    {426, 3, 1, 142},
+    {429, 3, 1, 143},
+    {432, 3, 1, 144},
+    {435, 3, 1, 145},
+    {438, 3, 1, 146},
+    {441, 3, 1, 147},
+    {444, 3, 1, 148},
+    {447, 3, 1, 149},
+    {450, 3, 1, 150},
+    {453, 3, 1, 151},
+    {456, 3, 1, 152},
+    {459, 3, 1, 153},
+    {462, 3, 1, 154},
+    {465, 3, 1, 155},
+    {468, 3, 1, 156},
+    {471, 3, 1, 157},
+    {474, 3, 1, 158},
+    {477, 3, 1, 159},
+    {480, 3, 1, 160},
+    {483, 3, 1, 161},
+    {486, 3, 1, 162},
+    {489, 3, 1, 163},
+    {492, 3, 1, 164},
+    {495, 3, 1, 165},
+    {498, 3, 1, 166},
+    {501, 3, 1, 167},
+    {504, 3, 1, 168},
+    {507, 3, 1, 169},
+    {510, 3, 1, 170},
+    {513, 3, 1, 171},
+    {516, 3, 1, 172},
+    {519, 3, 1, 173},
+    {522, 3, 1, 174},
+    {525, 3, 1, 175},
+    {528, 3, 1, 176},
+    {531, 3, 1, 177},
+    {534, 3, 1, 178},
+    {537, 3, 1, 179},
+    {540, 3, 1, 180},
+    {543, 3, 1, 181},
+    {546, 3, 1, 182},
+    {549, 3, 1, 183},
+    {552, 3, 1, 184},
+    {555, 3, 1, 185},
+    {558, 3, 1, 186},
+    {561, 3, 1, 187},
+    {564, 3, 1, 188},
+    {567, 3, 1, 189},
+    {570, 3, 1, 190},
+    {573, 3, 1, 191},
+    {576, 3, 1, 192},
+    {579, 3, 1, 193},
+    {582, 3, 1, 194},
+    {585, 3, 1, 195},
+    {588, 3, 1, 196},
+    {591, 3, 1, 197},
+    {594, 3, 1, 198},
+    {597, 3, 1, 199},
+    {600, 3, 1, 200},
+    {603, 3, 1, 201},
+    {606, 3, 1, 202},
+    {609, 3, 1, 203},
+    {612, 3, 1, 204},
+    {615, 3, 1, 205},
+    {618, 3, 1, 206},
+    {621, 3, 1, 207},
+    {624, 3, 1, 208},
+    {627, 3, 1, 209},
+    {630, 3, 1, 210},
+    {633, 3, 1, 211},
+    {636, 3, 1, 212},
+    {639, 3, 1, 213},
+    {642, 3, 1, 214},
+    {645, 3, 1, 215},
+    {648, 3, 1, 216},
+    {651, 3, 1, 217},
+    {654, 3, 1, 218},
+    {657, 3, 1, 219},
+    {660, 3, 1, 220},
+    {663, 3, 1, 221},
+    {666, 3, 1, 222},
+    {669, 3, 1, 223},
+    {672, 3, 1, 224},
+    {675, 3, 1, 225},
+    {678, 3, 1, 226},
+    {681, 3, 1, 227},
+    {684, 3, 1, 228},
+    {687, 3, 1, 229},
+    {690, 3, 1, 230},
+    {693, 3, 1, 231},
+    {696, 3, 1, 232},
+    {699, 3, 1, 233},
+    {702, 3, 1, 234},
+    {705, 3, 1, 235},
+    {708, 3, 1, 236},
+    {711, 3, 1, 237},
+    {714, 3, 1, 238},
+    {717, 3, 1, 239},
+    {720, 3, 1, 240},
+    {723, 3, 1, 241},
+    {726, 3, 1, 242},
+    {729, 3, 1, 243},
+    {732, 3, 1, 244},
+    {735, 3, 1, 245},
+    {738, 3, 1, 246},
+    {741, 3, 1, 247},
+    {744, 3, 1, 248},
+    {747, 3, 1, 249},
+    {750, 3, 1, 250},
+    {753, 3, 1, 251},
+    {756, 3, 1, 252},
+    {759, 3, 1, 253},
+    {762, 3, 1, 254},
+    {765, 3, 1, 255},
+    {768, 3, 1, 256},
+    {771, 3, 1, 257},
+    {774, 3, 1, 258},
+    {777, 3, 1, 259},
+    {780, 3, 1, 260},
+    {783, 3, 1, 261},
+    {786, 3, 1, 262},
+    {789, 3, 1, 263},
+    {792, 3, 1, 264},
+    {795, 3, 1, 265},
+    {798, 3, 1, 266},
+    {801, 3, 1, 267},
+    {804, 3, 1, 268},
+    {807, 3, 1, 269},
+    {810, 3, 1, 270},
+    {813, 3, 1, 271},
+    {816, 3, 1, 272},
+    {819, 3, 1, 273},
+    {822, 3, 1, 274},
+    {825, 3, 1, 275},
+    {828, 3, 1, 276},
+    {831, 3, 1, 277},
+    {834, 3, 1, 278},
+    {837, 3, 1, 279},
+    {840, 3, 1, 280},
+    {843, 3, 1, 281},
+    {846, 3, 1, 282},
+    {849, 3, 1, 283},
+    {852, 3, 1, 284},
+    {855, 3, 1, 285},
+    {858, 3, 1, 286},
+    {861, 3, 1, 287},
+    {864, 3, 1, 288},
+    {867, 3, 1, 289},
+    {870, 3, 1, 290},
+    {873, 3, 1, 291},
+    {876, 3, 1, 292},
+    {879, 3, 1, 293},
+    {882, 3, 1, 294},
+    {885, 3, 1, 295},
+    {888, 3, 1, 296},
+    {891, 3, 1, 297},
+    {894, 3, 1, 298},
+    {897, 3, 1, 299},
+    {900, 3, 1, 300},
+    {903, 3, 1, 301},
+    {906, 3, 1, 302},
+    {909, 3, 1, 303},
+    {912, 3, 1, 304},
+    {915, 3, 1, 305},
+    {918, 3, 1, 306},
+    {921, 3, 1, 307},
+    {924, 3, 1, 308},
+    {927, 3, 1, 309},
+    {930, 3, 1, 310},
+    {933, 3, 1, 311},
+    {936, 3, 1, 312},
+    {939, 3, 1, 313},
+    {942, 3, 1, 314},
+    {945, 3, 1, 315},
+    {948, 3, 1, 316},
+    {951, 3, 1, 317},
+    {954, 3, 1, 318},
+    {957, 3, 1, 319},
+    {960, 3, 1, 320},
+    {963, 3, 1, 321},
+    {966, 3, 1, 322},
+    {969, 3, 1, 323},
+    {972, 3, 1, 324},
+    {975, 3, 1, 325},
+    {978, 3, 1, 326},
+    {981, 3, 1, 327},
+    {984, 3, 1, 328},
+    {987, 3, 1, 329},
+    {990, 3, 1, 330},
+    {993, 3, 1, 331},
+    {996, 3, 1, 332},
+    {999, 3, 1, 333},
+    {1002, 3, 1, 334},
+    {1005, 3, 1, 335},
+    {1008, 3, 1, 336},
+    {1011, 3, 1, 337},
+    {1014, 3, 1, 338},
+    {1017, 3, 1, 339},
+    {1020, 3, 1, 340},
+    {1023, 3, 1, 341},
+    {1026, 3, 1, 342},
+    {1029, 3, 1, 343},
+    {1032, 3, 1, 344},
+    {1035, 3, 1, 345},
+    {1038, 3, 1, 346},
+    {1041, 3, 1, 347},
+    {1044, 3, 1, 348},
+    {1047, 3, 1, 349},
+    {1050, 3, 1, 350},
+    {1053, 3, 1, 351},
+    {1056, 3, 1, 352},
+    {1059, 3, 1, 353},
+    {1062, 3, 1, 354},
+    {1065, 3, 1, 355},
+    {1068, 3, 1, 356},
+    {1071, 3, 1, 357},
+    {1074, 3, 1, 358},
+    {1077, 3, 1, 359},
+    {1080, 3, 1, 360},
+    {1083, 3, 1, 361},
+    {1086, 3, 1, 362},
+    {1089, 3, 1, 363},
+    {1092, 3, 1, 364},
+    {1095, 3, 1, 365},
+    {1098, 3, 1, 366},
+    {1101, 3, 1, 367},
+    {1104, 3, 1, 368},
+    {1107, 3, 1, 369},
+    {1110, 3, 1, 370},
+    {1113, 3, 1, 371},
+    {1116, 3, 1, 372},
+    {1119, 3, 1, 373},
+    {1122, 3, 1, 374},
+    {1125, 3, 1, 375},
+    {1128, 3, 1, 376},
+    {1131, 3, 1, 377},
+    {1134, 3, 1, 378},
+    {1137, 3, 1, 379},
+    {1140, 3, 1, 380},
+    {1143, 3, 1, 381},
+    {1146, 3, 1, 382},
+    {1149, 3, 1, 383},
+    {1152, 3, 1, 384},
+    {1155, 3, 1, 385},
+    {1158, 3, 1, 386},
+    {1161, 3, 1, 387},
+    {1164, 3, 1, 388},
+    {1167, 3, 1, 389},
+    {1170, 3, 1, 390},
+    {1173, 3, 1, 391},
+    {1176, 3, 1, 392},
+    {1179, 3, 1, 393},
+    {1182, 3, 1, 394},
+    {1185, 3, 1, 395},
+    {1188, 3, 1, 396},
+    {1191, 3, 1, 397},
+    {1194, 3, 1, 398},
+    {1197, 3, 1, 399},
+    {1200, 3, 1, 400},
+    {1203, 3, 1, 401},
+    {1206, 3, 1, 402},
+    {1209, 3, 1, 403},
+    {1212, 3, 1, 404},
+    {1215, 3, 1, 405},
+    {1218, 3, 1, 406},
+    {1221, 3, 1, 407},
+    {1224, 3, 1, 408},
+    {1227, 3, 1, 409},
+    {1230, 3, 1, 410},
+    {1233, 3, 1, 411},
+    {1236, 3, 1, 412},
+    {1239, 3, 1, 413},
+    {1242, 3, 1, 414},
+    {1245, 3, 1, 415},
+    {1248, 3, 1, 416},
+    {1251, 3, 1, 417},
+    {1254, 3, 1, 418},
+    {1257, 3, 1, 419},
+    {1260, 3, 1, 420},
+    {1263, 3, 1, 421},
+    {1266, 3, 1, 422},
+    {1269, 3, 1, 423},
+    {1272, 3, 1, 424},
+    {1275, 3, 1, 425},
+    {1278, 3, 1, 426},
+    {1281, 3, 1, 427},
+    {1284, 3, 1, 428},
+    {1287, 3, 1, 429},
+    {1290, 3, 1, 430},
+    {1293, 3, 1, 431},
+    {1296, 3, 1, 432},
+    {1299, 3, 1, 433},
+    {1302, 3, 1, 434},
+    {1305, 3, 1, 435},
+    {1308, 3, 1, 436},
+    {1311, 3, 1, 437},
+    {1314, 3, 1, 438},
+    {1317, 3, 1, 439},
+    {1320, 3, 1, 440},
+    {1323, 3, 1, 441},
+    {1326, 3, 1, 442},
+    {1329, 3, 1, 443},
+    {1332, 3, 1, 444},
+    {1335, 3, 1, 445},
+    {1338, 3, 1, 446},
+    {1341, 3, 1, 447},
+    {1344, 3, 1, 448},
+    {1347, 3, 1, 449},
+    {1350, 3, 1, 450},
+    {1353, 3, 1, 451},
+    {1356, 3, 1, 452},
+    {1359, 3, 1, 453},
+    {1362, 3, 1, 454},
+    {1365, 3, 1, 455},
+    {1368, 3, 1, 456},
+    {1371, 3, 1, 457},
+    {1374, 3, 1, 458},
+    {1377, 3, 1, 459},
+    {1380, 3, 1, 460},
+    {1383, 3, 1, 461},
+    {1386, 3, 1, 462},
+    {1389, 3, 1, 463},
+    {1392, 3, 1, 464},
+    {1395, 3, 1, 465},
+    {1398, 3, 1, 466},
+    {1401, 3, 1, 467},
+    {1404, 3, 1, 468},
+    {1407, 3, 1, 469},
+    {1410, 3, 1, 470},
+    {1413, 3, 1, 471},
+    {1416, 3, 1, 472},
+    {1419, 3, 1, 473},
+    {1422, 3, 1, 474},
+    {1425, 3, 1, 475},
+    {1428, 3, 1, 476},
+    {1431, 3, 1, 477},
+    {1434, 3, 1, 478},
+    {1437, 3, 1, 479},
+    {1440, 3, 1, 480},
+    {1443, 3, 1, 481},
+    {1446, 3, 1, 482},
+    {1449, 3, 1, 483},
+    {1452, 3, 1, 484},
+    {1455, 3, 1, 485},
+    {1458, 3, 1, 486},
+    {1461, 3, 1, 487},
+    {1464, 3, 1, 488},
+    {1467, 3, 1, 489},
+    {1470, 3, 1, 490},
+    {1473, 3, 1, 491},
+    {1476, 3, 1, 492},
+    {1479, 3, 1, 493},
+    {1482, 3, 1, 494},
+    {1485, 3, 1, 495},
+    {1488, 3, 1, 496},
+    {1491, 3, 1, 497},
+    {1494, 3, 1, 498},
+    {1497, 3, 1, 499},
+    {1500, 3, 1, 500},
+    {1503, 3, 1, 501},
+    {1506, 3, 1, 502},
+    {1509, 3, 1, 503},
+    {1512, 3, 1, 504},
+    {1515, 3, 1, 505},
+    {1518, 3, 1, 506},
+    {1521, 3, 1, 507},
+    {1524, 3, 1, 508},
+    {1527, 3, 1, 509},
+    {1530, 3, 1, 510},
+    {1533, 3, 1, 511},
+    {1536, 3, 1, 0},
+    {1539, 3, 1, 512},
+    {1542, 3, 1, 2},
+    {1545, 3, 1, 3},
+    {1548, 3, 1, 4},
+    {1551, 3, 1, 5},
+    {1554, 3, 1, 6},
+    {1557, 3, 1, 7},
+    {1560, 3, 1, 8},
+    {1563, 3, 1, 9},
+    {1566, 3, 1, 10},
+    {1569, 3, 1, 11},
+    {1572, 3, 1, 14},
+    {1575, 3, 1, 15},
+    {1578, 3, 1, 17},
+    {1581, 3, 1, 18},
+    {1584, 3, 1, 19},
+    {1587, 3, 1, 20},
+    {1590, 3, 1, 21},
+    {1593, 3, 1, 22},
+    {1596, 3, 1, 23},
+    {1599, 3, 1, 24},
+    {1602, 3, 1, 25},
+    {1605, 3, 1, 26},
+    {1608, 3, 1, 27},
+    {1611, 3, 1, 28},
+    {1614, 3, 1, 29},
+    {1617, 3, 1, 30},
+    {1620, 3, 1, 32},
+    {1623, 3, 1, 33},
+    {1626, 3, 1, 34},
+    {1629, 3, 1, 35},
+    {1632, 3, 1, 36},
+    {1635, 3, 1, 37},
+    {1638, 3, 1, 40},
+    {1641, 3, 1, 41},
+    {1644, 3, 1, 42},
+    {1647, 3, 1, 513},
+    {1650, 3, 1, 44},
+    {1653, 3, 1, 45},
+    {1656, 3, 1, 46},
+    {1659, 3, 1, 47},
+    {1662, 3, 1, 48},
+    {1665, 3, 1, 49},
+    {1668, 3, 1, 50},
+    {1671, 3, 1, 51},
+    {1674, 3, 1, 52},
+    {1677, 3, 1, 53},
+    {1680, 3, 1, 54},
+    {1683, 3, 1, 55},
+    {1686, 3, 1, 56},
+    {1689, 3, 1, 57},
+    {1692, 3, 1, 58},
+    {1695, 3, 1, 59},
+    {1698, 3, 1, 60},
+    {1701, 3, 1, 63},
+    {1704, 3, 1, 64},
+    {1707, 3, 1, 65},
+    {1710, 3, 1, 66},
+    {1713, 3, 1, 67},
+    {1716, 3, 1, 68},
+    {1719, 3, 1, 71},
+    {1722, 3, 1, 72},
+    {1725, 3, 1, 73},
+    {1728, 3, 1, 74},
+    {1731, 3, 1, 75},
+    {1734, 3, 1, 76},
+    {1737, 3, 1, 77},
+    {1740, 3, 1, 78},
+    {1743, 3, 1, 79},
+    {1746, 3, 1, 80},
+    {1749, 3, 1, 81},
+    {1752, 3, 1, 82},
+    {1755, 3, 1, 83},
+    {1758, 3, 1, 84},
+    {1761, 3, 1, 85},
+    {1764, 3, 1, 86},
+    {1767, 3, 1, 87},
+    {1770, 3, 1, 88},
+    {1773, 3, 1, 89},
+    {1776, 3, 1, 90},
+    {1779, 3, 1, 91},
+    {1782, 3, 1, 94},
+    {1785, 3, 1, 95},
+    {1788, 3, 1, 96},
+    {1791, 3, 1, 97},
+    {1794, 3, 1, 98},
+    {1797, 3, 1, 99},
+    {1800, 3, 1, 102},
+    {1803, 3, 1, 103},
+    {1806, 3, 1, 104},
+    {1809, 3, 1, 105},
+    {1812, 3, 1, 106},
+    {1815, 3, 1, 107},
+    {1818, 3, 1, 108},
+    {1821, 3, 1, 109},
+    {1824, 3, 1, 110},
+    {1827, 3, 1, 111},
+    {1830, 3, 1, 112},
+    {1833, 3, 1, 113},
+    {1836, 3, 1, 114},
+    {1839, 3, 1, 115},
+    {1842, 3, 1, 116},
+    {1845, 3, 1, 117},
+    {1848, 3, 1, 118},
+    {1851, 3, 1, 119},
+    {1854, 3, 1, 120},
+    {1857, 3, 1, 121},
+    {1860, 3, 1, 122},
+    {1863, 3, 1, 125},
+    {1866, 3, 1, 126},
+    {1869, 3, 1, 127},
+    {1872, 3, 1, 128},
+    {1875, 3, 1, 129},
+    {1878, 3, 1, 130},
+    {1881, 3, 1, 133},
+    {1884, 3, 1, 134},
+    {1887, 3, 1, 135},
+    {1890, 3, 1, 136},
+    {1893, 3, 1, 137},
+    {1896, 3, 1, 138},
+    {1899, 3, 1, 139},
+    {1902, 3, 1, 140},
+    {1905, 3, 1, 141},
+    {1908, 3, 1, 142},
+    {1911, 3, 1, 143},
+    {1914, 3, 1, 144},
+    {1917, 3, 1, 145},
+    {1920, 3, 1, 146},
+    {1923, 3, 1, 147},
+    {1926, 3, 1, 148},
+    {1929, 3, 1, 149},
+    {1932, 3, 1, 150},
+    {1935, 3, 1, 151},
+    {1938, 3, 1, 152},
+    {1941, 3, 1, 153},
+    {1944, 3, 1, 156},
+    {1947, 3, 1, 157},
+    {1950, 3, 1, 158},
+    {1953, 3, 1, 159},
+    {1956, 3, 1, 160},
+    {1959, 3, 1, 161},
+    {1962, 3, 1, 164},
+    {1965, 3, 1, 165},
+    {1968, 3, 1, 166},
+    {1971, 3, 1, 167},
+    {1974, 3, 1, 168},
+    {1977, 3, 1, 169},
+    {1980, 3, 1, 170},
+    {1983, 3, 1, 171},
+    {1986, 3, 1, 172},
+    {1989, 3, 1, 173},
+    {1992, 3, 1, 174},
+    {1995, 3, 1, 175},
+    {1998, 3, 1, 176},
+    {2001, 3, 1, 177},
+    {2004, 3, 1, 178},
+    {2007, 3, 1, 179},
+    {2010, 3, 1, 180},
+    {2013, 3, 1, 181},
+    {2016, 3, 1, 182},
+    {2019, 3, 1, 183},
+    {2022, 3, 1, 186},
+    {2025, 3, 1, 187},
+    {2028, 3, 1, 188},
+    {2031, 3, 1, 189},
+    {2034, 3, 1, 190},
+    {2037, 3, 1, 191},
+    {2040, 3, 1, 194},
+    {2043, 3, 1, 195},
+    {2046, 3, 1, 196},
+    {2049, 3, 1, 197},
+    {2052, 3, 1, 198},
+    {2055, 3, 1, 199},
+    {2058, 3, 1, 200},
+    {2061, 3, 1, 201},
+    {2064, 3, 1, 202},
+    {2067, 3, 1, 203},
+    {2070, 3, 1, 204},
+    {2073, 3, 1, 205},
+    {2076, 3, 1, 206},
+    {2079, 3, 1, 207},
+    {2082, 3, 1, 208},
+    {2085, 3, 1, 209},
+    {2088, 3, 1, 210},
+    {2091, 3, 1, 514},
+    {2094, 3, 1, 212},
+    {2097, 3, 1, 213},
+    {2100, 3, 1, 214},
+    {2103, 3, 1, 217},
+    {2106, 3, 1, 218},
+    {2109, 3, 1, 219},
+    {2112, 3, 1, 220},
+    {2115, 3, 1, 221},
+    {2118, 3, 1, 222},
+    {2121, 3, 1, 223},
+    {2124, 3, 1, 224},
+    {2127, 3, 1, 225},
+    {2130, 3, 1, 226},
+    {2133, 3, 1, 227},
+    {2136, 3, 1, 228},
+    {2139, 3, 1, 229},
+    {2142, 3, 1, 230},
+    {2145, 3, 1, 231},
+    {2148, 3, 1, 232},
+    {2151, 3, 1, 233},
+    {2154, 3, 1, 234},
+    {2157, 3, 1, 235},
+    {2160, 3, 1, 236},
+    {2163, 3, 1, 237},
+    {2166, 3, 1, 240},
+    {2169, 3, 1, 241},
+    {2172, 3, 1, 242},
+    {2175, 3, 1, 243},
+    {2178, 3, 1, 244},
+    {2181, 3, 1, 245},
+    {2184, 3, 1, 248},
+    {2187, 3, 1, 249},
+    {2190, 3, 1, 250},
+    {2193, 3, 1, 251},
+    {2196, 3, 1, 252},
+    {2199, 3, 1, 253},
+    {2202, 3, 1, 254},
+    {2205, 3, 1, 255},
+    {2208, 3, 1, 256},
+    {2211, 3, 1, 257},
+    {2214, 3, 1, 258},
+    {2217, 3, 1, 259},
+    {2220, 3, 1, 260},
+    {2223, 3, 1, 261},
+    {2226, 3, 1, 262},
+    {2229, 3, 1, 263},
+    {2232, 3, 1, 264},
+    {2235, 3, 1, 515},
+    {2238, 3, 1, 266},
+    {2241, 3, 1, 267},
+    {2244, 3, 1, 268},
+    {2247, 3, 1, 271},
+    {2250, 3, 1, 272},
+    {2253, 3, 1, 273},
+    {2256, 3, 1, 516},
+    {2259, 3, 1, 275},
+    {2262, 3, 1, 276},
+    {2265, 3, 1, 279},
+    {2268, 3, 1, 280},
+    {2271, 3, 1, 517},
+    {2274, 3, 1, 282},
+    {2277, 3, 1, 283},
+    {2280, 3, 1, 284},
+    {2283, 3, 1, 285},
+    {2286, 3, 1, 286},
+    {2289, 3, 1, 287},
+    {2292, 3, 1, 288},
+    {2295, 3, 1, 289},
+    {2298, 3, 1, 290},
+    {2301, 3, 1, 291},
+    {2304, 3, 1, 292},
+    {2307, 3, 1, 293},
+    {2310, 3, 1, 294},
+    {2313, 3, 1, 295},
+    {2316, 3, 1, 296},
+    {2319, 3, 1, 297},
+    {2322, 3, 1, 298},
+    {2325, 3, 1, 299},
+    {2328, 3, 1, 302},
+    {2331, 3, 1, 303},
+    {2334, 3, 1, 304},
+    {2337, 3, 1, 305},
+    {2340, 3, 1, 306},
+    {2343, 3, 1, 307},
+    {2346, 3, 1, 310},
+    {2349, 3, 1, 311},
+    {2352, 3, 1, 312},
+    {2355, 3, 1, 313},
+    {2358, 3, 1, 314},
+    {2361, 3, 1, 315},
+    {2364, 3, 1, 316},
+    {2367, 3, 1, 317},
+    {2370, 3, 1, 318},
+    {2373, 3, 1, 319},
+    {2376, 3, 1, 320},
+    {2379, 3, 1, 321},
+    {2382, 3, 1, 322},
+    {2385, 3, 1, 323},
+    {2388, 3, 1, 324},
+    {2391, 3, 1, 325},
+    {2394, 3, 1, 326},
+    {2397, 3, 1, 327},
+    {2400, 3, 1, 328},
+    {2403, 3, 1, 329},
+    {2406, 3, 1, 332},
+    {2409, 3, 1, 333},
+    {2412, 3, 1, 334},
+    {2415, 3, 1, 335},
+    {2418, 3, 1, 336},
+    {2421, 3, 1, 337},
+    {2424, 3, 1, 340},
+    {2427, 3, 1, 341},
+    {2430, 3, 1, 342},
+    {2433, 3, 1, 343},
+    {2436, 3, 1, 344},
+    {2439, 3, 1, 345},
+    {2442, 3, 1, 346},
+    {2445, 3, 1, 347},
+    {2448, 3, 1, 348},
+    {2451, 3, 1, 349},
+    {2454, 3, 1, 350},
+    {2457, 3, 1, 351},
+    {2460, 3, 1, 352},
+    {2463, 3, 1, 353},
+    {2466, 3, 1, 354},
+    {2469, 3, 1, 355},
+    {2472, 3, 1, 356},
+    {2475, 3, 1, 357},
+    {2478, 3, 1, 358},
+    {2481, 3, 1, 359},
+    {2484, 3, 1, 360},
+    {2487, 3, 1, 363},
+    {2490, 3, 1, 364},
+    {2493, 3, 1, 365},
+    {2496, 3, 1, 366},
+    {2499, 3, 1, 367},
+    {2502, 3, 1, 368},
+    {2505, 3, 1, 371},
+    {2508, 3, 1, 372},
+    {2511, 3, 1, 373},
+    {2514, 3, 1, 374},
+    {2517, 3, 1, 375},
+    {2520, 3, 1, 376},
+    {2523, 3, 1, 377},
+    {2526, 3, 1, 378},
+    {2529, 3, 1, 379},
+    {2532, 3, 1, 380},
+    {2535, 3, 1, 381},
+    {2538, 3, 1, 382},
+    {2541, 3, 1, 383},
+    {2544, 3, 1, 384},
+    {2547, 3, 1, 385},
+    {2550, 3, 1, 386},
+    {2553, 3, 1, 387},
+    {2556, 3, 1, 388},
+    {2559, 3, 1, 389},
+    {2562, 3, 1, 390},
+    {2565, 3, 1, 391},
+    {2568, 3, 1, 394},
+    {2571, 3, 1, 395},
+    {2574, 3, 1, 396},
+    {2577, 3, 1, 397},
+    {2580, 3, 1, 398},
+    {2583, 3, 1, 399},
+    {2586, 3, 1, 402},
+    {2589, 3, 1, 403},
+    {2592, 3, 1, 404},
+    {2595, 3, 1, 405},
+    {2598, 3, 1, 406},
+    {2601, 3, 1, 407},
+    {2604, 3, 1, 408},
+    {2607, 3, 1, 409},
+    {2610, 3, 1, 410},
+    {2613, 3, 1, 411},
+    {2616, 3, 1, 412},
+    {2619, 3, 1, 413},
+    {2622, 3, 1, 414},
+    {2625, 3, 1, 415},
+    {2628, 3, 1, 416},
+    {2631, 3, 1, 417},
+    {2634, 3, 1, 418},
+    {2637, 3, 1, 419},
+    {2640, 3, 1, 420},
+    {2643, 3, 1, 421},
+    {2646, 3, 1, 422},
+    {2649, 3, 1, 425},
+    {2652, 3, 1, 426},
+    {2655, 3, 1, 427},
+    {2658, 3, 1, 428},
+    {2661, 3, 1, 429},
+    {2664, 3, 1, 430},
+    {2667, 3, 1, 431},
+    {2670, 3, 1, 432},
+    {2673, 3, 1, 433},
+    {2676, 3, 1, 434},
+    {2679, 3, 1, 435},
+    {2682, 3, 1, 436},
+    {2685, 3, 1, 437},
+    {2688, 3, 1, 438},
+    {2691, 3, 1, 439},
+    {2694, 3, 1, 440},
+    {2697, 3, 1, 441},
+    {2700, 3, 1, 442},
+    {2703, 3, 1, 443},
+    {2706, 3, 1, 444},
+    {2709, 3, 1, 445},
+    {2712, 3, 1, 448},
+    {2715, 3, 1, 449},
+    {2718, 3, 1, 450},
+    {2721, 3, 1, 451},
+    {2724, 3, 1, 452},
+    {2727, 3, 1, 453},
+    {2730, 3, 1, 456},
+    {2733, 3, 1, 457},
+    {2736, 3, 1, 458},
+    {2739, 3, 1, 459},
+    {2742, 3, 1, 460},
+    {2745, 3, 1, 461},
+    {2748, 3, 1, 462},
+    {2751, 3, 1, 463},
+    {2754, 3, 1, 464},
+    {2757, 3, 1, 465},
+    {2760, 3, 1, 466},
+    {2763, 3, 1, 467},
+    {2766, 3, 1, 468},
+    {2769, 3, 1, 469},
+    {2772, 3, 1, 470},
+    {2775, 3, 1, 471},
+    {2778, 3, 1, 472},
+    {2781, 3, 1, 473},
+    {2784, 3, 1, 474},
+    {2787, 3, 1, 475},
+    {2790, 3, 1, 478},
+    {2793, 3, 1, 479},
+    {2796, 3, 1, 480},
+    {2799, 3, 1, 481},
+    {2802, 3, 1, 482},
+    {2805, 3, 1, 483},
+    {2808, 3, 1, 486},
+    {2811, 3, 1, 487},
+    {2814, 3, 1, 488},
+    {2817, 3, 1, 489},
+    {2820, 3, 1, 490},
+    {2823, 3, 1, 491},
+    {2826, 3, 1, 492},
+    {2829, 3, 1, 493},
+    {2832, 3, 1, 494},
+    {2835, 3, 1, 495},
+    {2838, 3, 1, 496},
+    {2841, 3, 1, 497},
+    {2844, 3, 1, 498},
+    {2847, 3, 1, 499},
+    {2850, 3, 1, 500},
+    {2853, 3, 1, 501},
+    {2856, 3, 1, 502},
+    {2859, 3, 1, 503},
+    {2862, 3, 1, 504},
+    {2865, 3, 1, 505},
+    {2868, 3, 1, 506},
+    {2871, 3, 1, 509},
+    {2874, 3, 1, 510},
+    {2877, 3, 1, 511},
+};
+constexpr vertex_index monkey_1_indices[] = {
+    4,
+    15,
+    477,
+    0,
+    7,
+    8,
+    477,
+    16,
+    5,
+    475,
+    8,
+    9,
+    5,
+    17,
+    478,
+    1,
+    9,
+    10,
+    478,
+    18,
+    479,
+    476,
+    10,
+    11,
+    479,
+    19,
+    480,
+    2,
+    11,
+    12,
+    480,
+    20,
+    481,
+    2,
+    13,
+    3,
+    473,
+    81,
+    6,
+    307,
+    481,
+    20,
+    3,
+    14,
+    4,
+    474,
+    6,
+    7,
+    307,
+    20,
+    35,
+    13,
+    29,
+    14,
+    6,
+    22,
+    7,
+    14,
+    30,
+    15,
+    7,
+    23,
+    8,
+    15,
+    31,
+    16,
+    8,
+    24,
+    9,
+    16,
+    32,
+    17,
+    9,
+    25,
+    10,
+    18,
+    32,
+    33,
+    10,
+    26,
+    11,
+    19,
+    33,
+    34,
+    12,
+    26,
+    27,
+    19,
+    35,
+    20,
+    12,
+    28,
+    13,
+    6,
+    81,
+    21,
+    33,
+    47,
+    48,
+    25,
+    41,
+    26,
+    33,
+    49,
+    34,
+    26,
+    42,
+    27,
+    34,
+    50,
+    35,
+    27,
+    43,
+    28,
+    21,
+    81,
+    36,
+    307,
+    35,
+    50,
+    29,
+    43,
+    44,
+    21,
+    37,
+    22,
+    29,
+    45,
+    30,
+    22,
+    38,
+    23,
+    31,
+    45,
+    46,
+    23,
+    39,
+    24,
+    32,
+    46,
+    47,
+    24,
+    40,
+    25,
+    36,
+    52,
+    37,
+    44,
+    60,
+    45,
+    37,
+    53,
+    38,
+    46,
+    60,
+    61,
+    38,
+    54,
+    39,
+    46,
+    62,
+    47,
+    39,
+    55,
+    40,
+    47,
+    63,
+    48,
+    40,
+    56,
+    41,
+    48,
+    64,
+    49,
+    42,
+    56,
+    57,
+    49,
+    65,
+    50,
+    43,
+    57,
+    58,
+    36,
+    81,
+    51,
+    307,
+    50,
+    65,
+    43,
+    59,
+    44,
+    55,
+    71,
+    56,
+    64,
+    78,
+    79,
+    57,
+    71,
+    72,
+    64,
+    80,
+    65,
+    58,
+    72,
+    73,
+    51,
+    81,
+    66,
+    307,
+    65,
+    80,
+    58,
+    74,
+    59,
+    51,
+    67,
+    52,
+    59,
+    75,
+    60,
+    52,
+    68,
+    53,
+    61,
+    75,
+    76,
+    53,
+    69,
+    54,
+    61,
+    77,
+    62,
+    55,
+    69,
+    70,
+    62,
+    78,
+    63,
+    74,
+    91,
+    75,
+    67,
+    84,
+    68,
+    76,
+    91,
+    92,
+    68,
+    85,
+    69,
+    76,
+    93,
+    77,
+    70,
+    85,
+    86,
+    77,
+    94,
+    78,
+    70,
+    87,
+    71,
+    78,
+    95,
+    79,
+    72,
+    87,
+    88,
+    80,
+    95,
+    96,
+    73,
+    88,
+    89,
+    66,
+    81,
+    82,
+    307,
+    80,
+    96,
+    73,
+    90,
+    74,
+    66,
+    83,
+    67,
+    95,
+    109,
+    110,
+    88,
+    102,
+    103,
+    95,
+    111,
+    96,
+    89,
+    103,
+    104,
+    82,
+    81,
+    97,
+    307,
+    96,
+    111,
+    89,
+    105,
+    90,
+    83,
+    97,
+    98,
+    90,
+    106,
+    91,
+    83,
+    99,
+    84,
+    92,
+    106,
+    107,
+    84,
+    100,
+    85,
+    92,
+    108,
+    93,
+    86,
+    100,
+    101,
+    94,
+    108,
+    109,
+    86,
+    102,
+    87,
+    98,
+    114,
+    99,
+    107,
+    121,
+    122,
+    99,
+    115,
+    100,
+    107,
+    123,
+    108,
+    101,
+    115,
+    116,
+    109,
+    123,
+    124,
+    101,
+    117,
+    102,
+    109,
+    125,
+    110,
+    103,
+    117,
+    118,
+    110,
+    126,
+    111,
+    104,
+    118,
+    119,
+    97,
+    81,
+    112,
+    307,
+    111,
+    126,
+    104,
+    120,
+    105,
+    98,
+    112,
+    113,
+    105,
+    121,
+    106,
+    118,
+    132,
+    133,
+    125,
+    141,
+    126,
+    119,
+    133,
+    134,
+    112,
+    81,
+    127,
+    307,
+    126,
+    141,
+    119,
+    135,
+    120,
+    112,
+    128,
+    113,
+    120,
+    136,
+    121,
+    113,
+    129,
+    114,
+    122,
+    136,
+    137,
+    114,
+    130,
+    115,
+    122,
+    138,
+    123,
+    116,
+    130,
+    131,
+    124,
+    138,
+    139,
+    116,
+    132,
+    117,
+    124,
+    140,
+    125,
+    137,
+    151,
+    152,
+    129,
+    145,
+    130,
+    137,
+    153,
+    138,
+    131,
+    145,
+    146,
+    139,
+    153,
+    154,
+    131,
+    147,
+    132,
+    139,
+    155,
+    140,
+    133,
+    147,
+    148,
+    141,
+    155,
+    156,
+    134,
+    148,
+    149,
+    127,
+    81,
+    142,
+    307,
+    141,
+    156,
+    134,
+    150,
+    135,
+    127,
+    143,
+    128,
+    135,
+    151,
+    136,
+    129,
+    143,
+    144,
+    155,
+    171,
+    156,
+    149,
+    163,
+    164,
+    142,
+    81,
+    157,
+    307,
+    156,
+    171,
+    149,
+    165,
+    150,
+    142,
+    158,
+    143,
+    150,
+    166,
+    151,
+    144,
+    158,
+    159,
+    152,
+    166,
+    167,
+    144,
+    160,
+    145,
+    152,
+    168,
+    153,
+    146,
+    160,
+    161,
+    154,
+    168,
+    169,
+    146,
+    162,
+    147,
+    154,
+    170,
+    155,
+    148,
+    162,
+    163,
+    167,
+    183,
+    168,
+    161,
+    175,
+    176,
+    168,
+    184,
+    169,
+    161,
+    177,
+    162,
+    170,
+    184,
+    185,
+    163,
+    177,
+    178,
+    171,
+    185,
+    186,
+    164,
+    178,
+    179,
+    157,
+    81,
+    172,
+    307,
+    171,
+    186,
+    164,
+    180,
+    165,
+    157,
+    173,
+    158,
+    165,
+    181,
+    166,
+    158,
+    174,
+    159,
+    167,
+    181,
+    182,
+    159,
+    175,
+    160,
+    172,
+    81,
+    187,
+    307,
+    186,
+    201,
+    179,
+    195,
+    180,
+    173,
+    187,
+    188,
+    180,
+    196,
+    181,
+    174,
+    188,
+    189,
+    182,
+    196,
+    197,
+    174,
+    190,
+    175,
+    182,
+    198,
+    183,
+    176,
+    190,
+    191,
+    184,
+    198,
+    199,
+    176,
+    192,
+    177,
+    184,
+    200,
+    185,
+    178,
+    192,
+    193,
+    185,
+    201,
+    186,
+    179,
+    193,
+    194,
+    191,
+    205,
+    206,
+    199,
+    213,
+    214,
+    191,
+    207,
+    192,
+    199,
+    215,
+    200,
+    193,
+    207,
+    208,
+    200,
+    216,
+    201,
+    194,
+    208,
+    209,
+    187,
+    81,
+    202,
+    307,
+    201,
+    216,
+    194,
+    210,
+    195,
+    187,
+    203,
+    188,
+    195,
+    211,
+    196,
+    188,
+    204,
+    189,
+    197,
+    211,
+    212,
+    189,
+    205,
+    190,
+    197,
+    213,
+    198,
+    209,
+    225,
+    210,
+    202,
+    218,
+    203,
+    210,
+    226,
+    211,
+    203,
+    219,
+    204,
+    212,
+    226,
+    227,
+    204,
+    220,
+    205,
+    212,
+    228,
+    213,
+    206,
+    220,
+    221,
+    214,
+    228,
+    229,
+    206,
+    222,
+    207,
+    214,
+    230,
+    215,
+    208,
+    222,
+    223,
+    215,
+    231,
+    216,
+    209,
+    223,
+    224,
+    202,
+    81,
+    217,
+    307,
+    216,
+    231,
+    229,
+    243,
+    244,
+    221,
+    237,
+    222,
+    229,
+    245,
+    230,
+    223,
+    237,
+    238,
+    231,
+    245,
+    246,
+    224,
+    238,
+    239,
+    217,
+    81,
+    232,
+    307,
+    231,
+    246,
+    224,
+    240,
+    225,
+    217,
+    233,
+    218,
+    225,
+    241,
+    226,
+    219,
+    233,
+    234,
+    227,
+    241,
+    242,
+    219,
+    235,
+    220,
+    227,
+    243,
+    228,
+    221,
+    235,
+    236,
+    232,
+    248,
+    233,
+    240,
+    256,
+    241,
+    233,
+    249,
+    234,
+    242,
+    256,
+    257,
+    234,
+    250,
+    235,
+    242,
+    258,
+    243,
+    236,
+    250,
+    251,
+    244,
+    258,
+    259,
+    236,
+    252,
+    237,
+    244,
+    260,
+    245,
+    238,
+    252,
+    253,
+    245,
+    261,
+    246,
+    239,
+    253,
+    254,
+    232,
+    81,
+    247,
+    307,
+    246,
+    261,
+    239,
+    255,
+    240,
+    251,
+    267,
+    252,
+    259,
+    275,
+    260,
+    253,
+    267,
+    268,
+    260,
+    276,
+    261,
+    254,
+    268,
+    269,
+    247,
+    81,
+    262,
+    307,
+    261,
+    276,
+    254,
+    270,
+    255,
+    248,
+    262,
+    263,
+    255,
+    271,
+    256,
+    248,
+    264,
+    249,
+    257,
+    271,
+    272,
+    249,
+    265,
+    250,
+    257,
+    273,
+    258,
+    251,
+    265,
+    266,
+    259,
+    273,
+    274,
+    270,
+    286,
+    271,
+    263,
+    279,
+    264,
+    272,
+    286,
+    287,
+    264,
+    280,
+    265,
+    272,
+    288,
+    273,
+    266,
+    280,
+    281,
+    274,
+    288,
+    289,
+    266,
+    282,
+    267,
+    274,
+    290,
+    275,
+    268,
+    282,
+    283,
+    276,
+    290,
+    291,
+    269,
+    283,
+    284,
+    262,
+    81,
+    277,
+    307,
+    276,
+    291,
+    269,
+    285,
+    270,
+    263,
+    277,
+    278,
+    289,
+    305,
+    290,
+    283,
+    297,
+    298,
+    291,
+    305,
+    306,
+    284,
+    298,
+    299,
+    277,
+    81,
+    292,
+    307,
+    291,
+    306,
+    284,
+    300,
+    285,
+    277,
+    293,
+    278,
+    285,
+    301,
+    286,
+    278,
+    294,
+    279,
+    287,
+    301,
+    302,
+    279,
+    295,
+    280,
+    287,
+    303,
+    288,
+    281,
+    295,
+    296,
+    289,
+    303,
+    304,
+    281,
+    297,
+    282,
+    302,
+    317,
+    318,
+    294,
+    311,
+    295,
+    302,
+    319,
+    303,
+    296,
+    311,
+    312,
+    304,
+    319,
+    320,
+    296,
+    313,
+    297,
+    304,
+    321,
+    305,
+    298,
+    313,
+    314,
+    305,
+    322,
+    306,
+    299,
+    314,
+    315,
+    292,
+    81,
+    308,
+    307,
+    306,
+    322,
+    299,
+    316,
+    300,
+    292,
+    309,
+    293,
+    300,
+    317,
+    301,
+    293,
+    310,
+    294,
+    321,
+    337,
+    322,
+    315,
+    329,
+    330,
+    308,
+    81,
+    323,
+    307,
+    322,
+    337,
+    315,
+    331,
+    316,
+    308,
+    324,
+    309,
+    316,
+    332,
+    317,
+    309,
+    325,
+    310,
+    318,
+    332,
+    333,
+    310,
+    326,
+    311,
+    318,
+    334,
+    319,
+    311,
+    327,
+    312,
+    320,
+    334,
+    335,
+    312,
+    328,
+    313,
+    320,
+    336,
+    321,
+    314,
+    328,
+    329,
+    325,
+    341,
+    326,
+    333,
+    349,
+    334,
+    327,
+    341,
+    342,
+    335,
+    349,
+    350,
+    327,
+    343,
+    328,
+    335,
+    351,
+    336,
+    329,
+    343,
+    344,
+    336,
+    352,
+    337,
+    330,
+    344,
+    345,
+    323,
+    81,
+    338,
+    307,
+    337,
+    352,
+    330,
+    346,
+    331,
+    323,
+    339,
+    324,
+    331,
+    347,
+    332,
+    324,
+    340,
+    325,
+    333,
+    347,
+    348,
+    345,
+    359,
+    360,
+    338,
+    81,
+    353,
+    307,
+    352,
+    367,
+    345,
+    361,
+    346,
+    338,
+    354,
+    339,
+    346,
+    362,
+    347,
+    340,
+    354,
+    355,
+    348,
+    362,
+    363,
+    340,
+    356,
+    341,
+    348,
+    364,
+    349,
+    342,
+    356,
+    357,
+    350,
+    364,
+    365,
+    342,
+    358,
+    343,
+    350,
+    366,
+    351,
+    344,
+    358,
+    359,
+    351,
+    367,
+    352,
+    363,
+    379,
+    364,
+    357,
+    371,
+    372,
+    365,
+    379,
+    380,
+    357,
+    373,
+    358,
+    365,
+    381,
+    366,
+    359,
+    373,
+    374,
+    366,
+    382,
+    367,
+    360,
+    374,
+    375,
+    353,
+    81,
+    368,
+    307,
+    367,
+    382,
+    360,
+    376,
+    361,
+    353,
+    369,
+    354,
+    361,
+    377,
+    362,
+    355,
+    369,
+    370,
+    363,
+    377,
+    378,
+    355,
+    371,
+    356,
+    368,
+    81,
+    383,
+    307,
+    382,
+    397,
+    375,
+    391,
+    376,
+    368,
+    384,
+    369,
+    376,
+    392,
+    377,
+    370,
+    384,
+    385,
+    378,
+    392,
+    393,
+    370,
+    386,
+    371,
+    378,
+    394,
+    379,
+    372,
+    386,
+    387,
+    380,
+    394,
+    395,
+    372,
+    388,
+    373,
+    380,
+    396,
+    381,
+    374,
+    388,
+    389,
+    381,
+    397,
+    382,
+    375,
+    389,
+    390,
+    387,
+    401,
+    402,
+    395,
+    409,
+    410,
+    387,
+    403,
+    388,
+    396,
+    410,
+    411,
+    389,
+    403,
+    404,
+    396,
+    412,
+    397,
+    390,
+    404,
+    405,
+    383,
+    81,
+    398,
+    307,
+    397,
+    412,
+    390,
+    406,
+    391,
+    384,
+    398,
+    399,
+    391,
+    407,
+    392,
+    384,
+    400,
+    385,
+    393,
+    407,
+    408,
+    385,
+    401,
+    386,
+    393,
+    409,
+    394,
+    405,
+    421,
+    406,
+    398,
+    414,
+    399,
+    406,
+    422,
+    407,
+    400,
+    414,
+    415,
+    408,
+    422,
+    423,
+    400,
+    416,
+    401,
+    408,
+    424,
+    409,
+    402,
+    416,
+    417,
+    410,
+    424,
+    425,
+    402,
+    418,
+    403,
+    410,
+    426,
+    411,
+    404,
+    418,
+    419,
+    411,
+    427,
+    412,
+    405,
+    419,
+    420,
+    398,
+    81,
+    413,
+    307,
+    412,
+    427,
+    425,
+    439,
+    440,
+    417,
+    433,
+    418,
+    425,
+    441,
+    426,
+    419,
+    433,
+    434,
+    426,
+    442,
+    427,
+    420,
+    434,
+    435,
+    413,
+    81,
+    428,
+    307,
+    427,
+    442,
+    420,
+    436,
+    421,
+    413,
+    429,
+    414,
+    421,
+    437,
+    422,
+    415,
+    429,
+    430,
+    423,
+    437,
+    438,
+    415,
+    431,
+    416,
+    423,
+    439,
+    424,
+    417,
+    431,
+    432,
+    436,
+    452,
+    437,
+    429,
+    445,
+    430,
+    438,
+    452,
+    453,
+    430,
+    446,
+    431,
+    438,
+    454,
+    439,
+    432,
+    446,
+    447,
+    440,
+    454,
+    455,
+    432,
+    448,
+    433,
+    440,
+    456,
+    441,
+    434,
+    448,
+    449,
+    441,
+    457,
+    442,
+    435,
+    449,
+    450,
+    428,
+    81,
+    443,
+    307,
+    442,
+    457,
+    435,
+    451,
+    436,
+    429,
+    443,
+    444,
+    455,
+    471,
+    456,
+    449,
+    463,
+    464,
+    457,
+    471,
+    472,
+    450,
+    464,
+    465,
+    443,
+    81,
+    458,
+    307,
+    457,
+    472,
+    450,
+    466,
+    451,
+    443,
+    459,
+    444,
+    451,
+    467,
+    452,
+    445,
+    459,
+    460,
+    453,
+    467,
+    468,
+    445,
+    461,
+    446,
+    453,
+    469,
+    454,
+    447,
+    461,
+    462,
+    455,
+    469,
+    470,
+    447,
+    463,
+    448,
+    460,
+    474,
+    0,
+    467,
+    5,
+    468,
+    461,
+    0,
+    475,
+    468,
+    478,
+    469,
+    462,
+    475,
+    1,
+    470,
+    478,
+    479,
+    463,
+    1,
+    476,
+    470,
+    480,
+    471,
+    464,
+    476,
+    2,
+    471,
+    481,
+    472,
+    465,
+    2,
+    3,
+    458,
+    81,
+    473,
+    307,
+    472,
+    481,
+    465,
+    4,
+    466,
+    459,
+    473,
+    474,
+    466,
+    477,
+    467,
+    4,
+    14,
+    15,
+    0,
+    474,
+    7,
+    477,
+    15,
+    16,
+    475,
+    0,
+    8,
+    5,
+    16,
+    17,
+    1,
+    475,
+    9,
+    478,
+    17,
+    18,
+    476,
+    1,
+    10,
+    479,
+    18,
+    19,
+    2,
+    476,
+    11,
+    480,
+    19,
+    20,
+    2,
+    12,
+    13,
+    3,
+    13,
+    14,
+    474,
+    473,
+    6,
+    13,
+    28,
+    29,
+    6,
+    21,
+    22,
+    14,
+    29,
+    30,
+    7,
+    22,
+    23,
+    15,
+    30,
+    31,
+    8,
+    23,
+    24,
+    16,
+    31,
+    32,
+    9,
+    24,
+    25,
+    18,
+    17,
+    32,
+    10,
+    25,
+    26,
+    19,
+    18,
+    33,
+    12,
+    11,
+    26,
+    19,
+    34,
+    35,
+    12,
+    27,
+    28,
+    33,
+    32,
+    47,
+    25,
+    40,
+    41,
+    33,
+    48,
+    49,
+    26,
+    41,
+    42,
+    34,
+    49,
+    50,
+    27,
+    42,
+    43,
+    29,
+    28,
+    43,
+    21,
+    36,
+    37,
+    29,
+    44,
+    45,
+    22,
+    37,
+    38,
+    31,
+    30,
+    45,
+    23,
+    38,
+    39,
+    32,
+    31,
+    46,
+    24,
+    39,
+    40,
+    36,
+    51,
+    52,
+    44,
+    59,
+    60,
+    37,
+    52,
+    53,
+    46,
+    45,
+    60,
+    38,
+    53,
+    54,
+    46,
+    61,
+    62,
+    39,
+    54,
+    55,
+    47,
+    62,
+    63,
+    40,
+    55,
+    56,
+    48,
+    63,
+    64,
+    42,
+    41,
+    56,
+    49,
+    64,
+    65,
+    43,
+    42,
+    57,
+    43,
+    58,
+    59,
+    55,
+    70,
+    71,
+    64,
+    63,
+    78,
+    57,
+    56,
+    71,
+    64,
+    79,
+    80,
+    58,
+    57,
+    72,
+    58,
+    73,
+    74,
+    51,
+    66,
+    67,
+    59,
+    74,
+    75,
+    52,
+    67,
+    68,
+    61,
+    60,
+    75,
+    53,
+    68,
+    69,
+    61,
+    76,
+    77,
+    55,
+    54,
+    69,
+    62,
+    77,
+    78,
+    74,
+    90,
+    91,
+    67,
+    83,
+    84,
+    76,
+    75,
+    91,
+    68,
+    84,
+    85,
+    76,
+    92,
+    93,
+    70,
+    69,
+    85,
+    77,
+    93,
+    94,
+    70,
+    86,
+    87,
+    78,
+    94,
+    95,
+    72,
+    71,
+    87,
+    80,
+    79,
+    95,
+    73,
+    72,
+    88,
+    73,
+    89,
+    90,
+    66,
+    82,
+    83,
+    95,
+    94,
+    109,
+    88,
+    87,
+    102,
+    95,
+    110,
+    111,
+    89,
+    88,
+    103,
+    89,
+    104,
+    105,
+    83,
+    82,
+    97,
+    90,
+    105,
+    106,
+    83,
+    98,
+    99,
+    92,
+    91,
+    106,
+    84,
+    99,
+    100,
+    92,
+    107,
+    108,
+    86,
+    85,
+    100,
+    94,
+    93,
+    108,
+    86,
+    101,
+    102,
+    98,
+    113,
+    114,
+    107,
+    106,
+    121,
+    99,
+    114,
+    115,
+    107,
+    122,
+    123,
+    101,
+    100,
+    115,
+    109,
+    108,
+    123,
+    101,
+    116,
+    117,
+    109,
+    124,
+    125,
+    103,
+    102,
+    117,
+    110,
+    125,
+    126,
+    104,
+    103,
+    118,
+    104,
+    119,
+    120,
+    98,
+    97,
+    112,
+    105,
+    120,
+    121,
+    118,
+    117,
+    132,
+    125,
+    140,
+    141,
+    119,
+    118,
+    133,
+    119,
+    134,
+    135,
+    112,
+    127,
+    128,
+    120,
+    135,
+    136,
+    113,
+    128,
+    129,
+    122,
+    121,
+    136,
+    114,
+    129,
+    130,
+    122,
+    137,
+    138,
+    116,
+    115,
+    130,
+    124,
+    123,
+    138,
+    116,
+    131,
+    132,
+    124,
+    139,
+    140,
+    137,
+    136,
+    151,
+    129,
+    144,
+    145,
+    137,
+    152,
+    153,
+    131,
+    130,
+    145,
+    139,
+    138,
+    153,
+    131,
+    146,
+    147,
+    139,
+    154,
+    155,
+    133,
+    132,
+    147,
+    141,
+    140,
+    155,
+    134,
+    133,
+    148,
+    134,
+    149,
+    150,
+    127,
+    142,
+    143,
+    135,
+    150,
+    151,
+    129,
+    128,
+    143,
+    155,
+    170,
+    171,
+    149,
+    148,
+    163,
+    149,
+    164,
+    165,
+    142,
+    157,
+    158,
+    150,
+    165,
+    166,
+    144,
+    143,
+    158,
+    152,
+    151,
+    166,
+    144,
+    159,
+    160,
+    152,
+    167,
+    168,
+    146,
+    145,
+    160,
+    154,
+    153,
+    168,
+    146,
+    161,
+    162,
+    154,
+    169,
+    170,
+    148,
+    147,
+    162,
+    167,
+    182,
+    183,
+    161,
+    160,
+    175,
+    168,
+    183,
+    184,
+    161,
+    176,
+    177,
+    170,
+    169,
+    184,
+    163,
+    162,
+    177,
+    171,
+    170,
+    185,
+    164,
+    163,
+    178,
+    164,
+    179,
+    180,
+    157,
+    172,
+    173,
+    165,
+    180,
+    181,
+    158,
+    173,
+    174,
+    167,
+    166,
+    181,
+    159,
+    174,
+    175,
+    179,
+    194,
+    195,
+    173,
+    172,
+    187,
+    180,
+    195,
+    196,
+    174,
+    173,
+    188,
+    182,
+    181,
+    196,
+    174,
+    189,
+    190,
+    182,
+    197,
+    198,
+    176,
+    175,
+    190,
+    184,
+    183,
+    198,
+    176,
+    191,
+    192,
+    184,
+    199,
+    200,
+    178,
+    177,
+    192,
+    185,
+    200,
+    201,
+    179,
+    178,
+    193,
+    191,
+    190,
+    205,
+    199,
+    198,
+    213,
+    191,
+    206,
+    207,
+    199,
+    214,
+    215,
+    193,
+    192,
+    207,
+    200,
+    215,
+    216,
+    194,
+    193,
+    208,
+    194,
+    209,
+    210,
+    187,
+    202,
+    203,
+    195,
+    210,
+    211,
+    188,
+    203,
+    204,
+    197,
+    196,
+    211,
+    189,
+    204,
+    205,
+    197,
+    212,
+    213,
+    209,
+    224,
+    225,
+    202,
+    217,
+    218,
+    210,
+    225,
+    226,
+    203,
+    218,
+    219,
+    212,
+    211,
+    226,
+    204,
+    219,
+    220,
+    212,
+    227,
+    228,
+    206,
+    205,
+    220,
+    214,
+    213,
+    228,
+    206,
+    221,
+    222,
+    214,
+    229,
+    230,
+    208,
+    207,
+    222,
+    215,
+    230,
+    231,
+    209,
+    208,
+    223,
+    229,
+    228,
+    243,
+    221,
+    236,
+    237,
+    229,
+    244,
+    245,
+    223,
+    222,
+    237,
+    231,
+    230,
+    245,
+    224,
+    223,
+    238,
+    224,
+    239,
+    240,
+    217,
+    232,
+    233,
+    225,
+    240,
+    241,
+    219,
+    218,
+    233,
+    227,
+    226,
+    241,
+    219,
+    234,
+    235,
+    227,
+    242,
+    243,
+    221,
+    220,
+    235,
+    232,
+    247,
+    248,
+    240,
+    255,
+    256,
+    233,
+    248,
+    249,
+    242,
+    241,
+    256,
+    234,
+    249,
+    250,
+    242,
+    257,
+    258,
+    236,
+    235,
+    250,
+    244,
+    243,
+    258,
+    236,
+    251,
+    252,
+    244,
+    259,
+    260,
+    238,
+    237,
+    252,
+    245,
+    260,
+    261,
+    239,
+    238,
+    253,
+    239,
+    254,
+    255,
+    251,
+    266,
+    267,
+    259,
+    274,
+    275,
+    253,
+    252,
+    267,
+    260,
+    275,
+    276,
+    254,
+    253,
+    268,
+    254,
+    269,
+    270,
+    248,
+    247,
+    262,
+    255,
+    270,
+    271,
+    248,
+    263,
+    264,
+    257,
+    256,
+    271,
+    249,
+    264,
+    265,
+    257,
+    272,
+    273,
+    251,
+    250,
+    265,
+    259,
+    258,
+    273,
+    270,
+    285,
+    286,
+    263,
+    278,
+    279,
+    272,
+    271,
+    286,
+    264,
+    279,
+    280,
+    272,
+    287,
+    288,
+    266,
+    265,
+    280,
+    274,
+    273,
+    288,
+    266,
+    281,
+    282,
+    274,
+    289,
+    290,
+    268,
+    267,
+    282,
+    276,
+    275,
+    290,
+    269,
+    268,
+    283,
+    269,
+    284,
+    285,
+    263,
+    262,
+    277,
+    289,
+    304,
+    305,
+    283,
+    282,
+    297,
+    291,
+    290,
+    305,
+    284,
+    283,
+    298,
+    284,
+    299,
+    300,
+    277,
+    292,
+    293,
+    285,
+    300,
+    301,
+    278,
+    293,
+    294,
+    287,
+    286,
+    301,
+    279,
+    294,
+    295,
+    287,
+    302,
+    303,
+    281,
+    280,
+    295,
+    289,
+    288,
+    303,
+    281,
+    296,
+    297,
+    302,
+    301,
+    317,
+    294,
+    310,
+    311,
+    302,
+    318,
+    319,
+    296,
+    295,
+    311,
+    304,
+    303,
+    319,
+    296,
+    312,
+    313,
+    304,
+    320,
+    321,
+    298,
+    297,
+    313,
+    305,
+    321,
+    322,
+    299,
+    298,
+    314,
+    299,
+    315,
+    316,
+    292,
+    308,
+    309,
+    300,
+    316,
+    317,
+    293,
+    309,
+    310,
+    321,
+    336,
+    337,
+    315,
+    314,
+    329,
+    315,
+    330,
+    331,
+    308,
+    323,
+    324,
+    316,
+    331,
+    332,
+    309,
+    324,
+    325,
+    318,
+    317,
+    332,
+    310,
+    325,
+    326,
+    318,
+    333,
+    334,
+    311,
+    326,
+    327,
+    320,
+    319,
+    334,
+    312,
+    327,
+    328,
+    320,
+    335,
+    336,
+    314,
+    313,
+    328,
+    325,
+    340,
+    341,
+    333,
+    348,
+    349,
+    327,
+    326,
+    341,
+    335,
+    334,
+    349,
+    327,
+    342,
+    343,
+    335,
+    350,
+    351,
+    329,
+    328,
+    343,
+    336,
+    351,
+    352,
+    330,
+    329,
+    344,
+    330,
+    345,
+    346,
+    323,
+    338,
+    339,
+    331,
+    346,
+    347,
+    324,
+    339,
+    340,
+    333,
+    332,
+    347,
+    345,
+    344,
+    359,
+    345,
+    360,
+    361,
+    338,
+    353,
+    354,
+    346,
+    361,
+    362,
+    340,
+    339,
+    354,
+    348,
+    347,
+    362,
+    340,
+    355,
+    356,
+    348,
+    363,
+    364,
+    342,
+    341,
+    356,
+    350,
+    349,
+    364,
+    342,
+    357,
+    358,
+    350,
+    365,
+    366,
+    344,
+    343,
+    358,
+    351,
+    366,
+    367,
+    363,
+    378,
+    379,
+    357,
+    356,
+    371,
+    365,
+    364,
+    379,
+    357,
+    372,
+    373,
+    365,
+    380,
+    381,
+    359,
+    358,
+    373,
+    366,
+    381,
+    382,
+    360,
+    359,
+    374,
+    360,
+    375,
+    376,
+    353,
+    368,
+    369,
+    361,
+    376,
+    377,
+    355,
+    354,
+    369,
+    363,
+    362,
+    377,
+    355,
+    370,
+    371,
+    375,
+    390,
+    391,
+    368,
+    383,
+    384,
+    376,
+    391,
+    392,
+    370,
+    369,
+    384,
+    378,
+    377,
+    392,
+    370,
+    385,
+    386,
+    378,
+    393,
+    394,
+    372,
+    371,
+    386,
+    380,
+    379,
+    394,
+    372,
+    387,
+    388,
+    380,
+    395,
+    396,
+    374,
+    373,
+    388,
+    381,
+    396,
+    397,
+    375,
+    374,
+    389,
+    387,
+    386,
+    401,
+    395,
+    394,
+    409,
+    387,
+    402,
+    403,
+    396,
+    395,
+    410,
+    389,
+    388,
+    403,
+    396,
+    411,
+    412,
+    390,
+    389,
+    404,
+    390,
+    405,
+    406,
+    384,
+    383,
+    398,
+    391,
+    406,
+    407,
+    384,
+    399,
+    400,
+    393,
+    392,
+    407,
+    385,
+    400,
+    401,
+    393,
+    408,
+    409,
+    405,
+    420,
+    421,
+    398,
+    413,
+    414,
+    406,
+    421,
+    422,
+    400,
+    399,
+    414,
+    408,
+    407,
+    422,
+    400,
+    415,
+    416,
+    408,
+    423,
+    424,
+    402,
+    401,
+    416,
+    410,
+    409,
+    424,
+    402,
+    417,
+    418,
+    410,
+    425,
+    426,
+    404,
+    403,
+    418,
+    411,
+    426,
+    427,
+    405,
+    404,
+    419,
+    425,
+    424,
+    439,
+    417,
+    432,
+    433,
+    425,
+    440,
+    441,
+    419,
+    418,
+    433,
+    426,
+    441,
+    442,
+    420,
+    419,
+    434,
+    420,
+    435,
+    436,
+    413,
+    428,
+    429,
+    421,
+    436,
+    437,
+    415,
+    414,
+    429,
+    423,
+    422,
+    437,
+    415,
+    430,
+    431,
+    423,
+    438,
+    439,
+    417,
+    416,
+    431,
+    436,
+    451,
+    452,
+    429,
+    444,
+    445,
+    438,
+    437,
+    452,
+    430,
+    445,
+    446,
+    438,
+    453,
+    454,
+    432,
+    431,
+    446,
+    440,
+    439,
+    454,
+    432,
+    447,
+    448,
+    440,
+    455,
+    456,
+    434,
+    433,
+    448,
+    441,
+    456,
+    457,
+    435,
+    434,
+    449,
+    435,
+    450,
+    451,
+    429,
+    428,
+    443,
+    455,
+    470,
+    471,
+    449,
+    448,
+    463,
+    457,
+    456,
+    471,
+    450,
+    449,
+    464,
+    450,
+    465,
+    466,
+    443,
+    458,
+    459,
+    451,
+    466,
+    467,
+    445,
+    444,
+    459,
+    453,
+    452,
+    467,
+    445,
+    460,
+    461,
+    453,
+    468,
+    469,
+    447,
+    446,
+    461,
+    455,
+    454,
+    469,
+    447,
+    462,
+    463,
+    460,
+    459,
+    474,
+    467,
+    477,
+    5,
+    461,
+    460,
+    0,
+    468,
+    5,
+    478,
+    462,
+    461,
+    475,
+    470,
+    469,
+    478,
+    463,
+    462,
+    1,
+    470,
+    479,
+    480,
+    464,
+    463,
+    476,
+    471,
+    480,
+    481,
+    465,
+    464,
+    2,
+    465,
+    3,
+    4,
+    459,
+    458,
+    473,
+    466,
+    4,
+    477,
+};
+constexpr object monkey_objects[] = {
+    {{nullptr, 0}, {monkey_0_vertices, 507}, {3.756538717425428e-05f, 3.0041657737456262e-05f, 3.283925980213098e-05f}, {0.1866779923439026f, 0.0f, -0.09151896834373474f}, {monkey_0_normals, 927}, {monkey_0_faces, 952}, {monkey_0_indices, 2871}, {{-1.044264554977417f, -0.9844050407409668f, -1.1675958633422852f}, {1.4176206588745117f, 0.9844050407409668f, 0.9845578670501709f}, {0.1866779923439026f, 0.0f, -0.09151896834373474f}, 1.5367618799209595f}},
+    {{nullptr, 0}, {monkey_1_vertices, 482}, {9.054033398570027e-06f, 1.936941043823026e-05f, 3.051849489565939e-05f}, {0.6662424802780151f, 0.3309425115585327f, -5.066394805908203e-07f}, {monkey_1_normals, 518}, {monkey_1_faces, 960}, {monkey_1_indices, 2880}, {{0.3695599138736725f, -0.3037543296813965f, -1.000030517578125f}, {0.9629250764846802f, 0.9656393527984619f, 1.0000295639038086f}, {0.6662424802780151f, 0.3309425115585327f, -5.066394805908203e-07f}, 1.0000368356704712f}},
+};
+constexpr material monkey_materials[] = {
+    {{200.0f, 57.84375f, 25.735750198364258f}},
+    {{200.0f, 133.2050018310547f, 31.30849838256836f}},
+};
+constexpr m3::vec3 monkey_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+constexpr scene monkey_scene = {{monkey_objects, 2}, {monkey_materials, 2}, {monkey_lights, 3}, {{-10.0f, 5.0f, 10.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(monkey_scene));
 
-newmtl Material
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.045155 0.054261
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
+constexpr quantized_vertex sphere_0_vertices[] = {
+    {-3515, 27485, -17731},
+    {-2879, -269, -32767},
+    {-2421, -18441, -27088},
+    {-960, 30298, -12749},
+    {2534, 20584, -25704},
+    {1902, 9892, -31436},
+    {6938, 3228, -32024},
+    {3135, -6460, -32132},
+    {2920, -12644, -30242},
+    {7991, -17972, -26356},
+    {12511, 3221, -30221},
+    {5404, -27228, -17538},
+    {659, 32165, -6665},
+    {8934, 25521, -18994},
+    {12620, 15967, -26044},
+    {15861, -2915, -28834},
+    {14040, -12418, -27014},
+    {12567, -23543, -19411},
+    {18970, 12838, -23582},
+    {20396, 6973, -24876},
+    {25789, 0, -20445},
+    {20656, -6703, -24698},
+    {17450, -18444, -20912},
+    {13032, 27350, -12838},
+    {22497, 16491, -17644},
+    {23124, -12622, -19693},
+    {6859, -30354, -10837},
+    {6, 32767, -35},
+    {9867, 30568, -7756},
+    {19038, 23509, -13055},
+    {28436, 6460, -15266},
+    {28436, -6460, -15266},
+    {22781, -20749, -11803},
+    {14487, -27357, -11427},
+    {26257, 18283, -7497},
+    {28889, 12622, -9351},
+    {31638, 0, -9026},
+    {30087, -10376, -8868},
+    {18182, -27418, 240},
+    {25048, 21428, -1689},
+    {32767, 3785, -2147},
+    {30256, -12622, 2410},
+    {25407, -20937, -2399},
+    {18073, 27590, -1490},
+    {30256, 12622, 2410},
+    {32108, -6460, 3094},
+    {12611, -30446, -308},
+    {5521, -32274, -3720},
+    {22323, 23222, 6309},
+    {27087, 16288, 9306},
+    {30880, 6460, 9296},
+    {31303, 0, 10061},
+    {29304, -9561, 11473},
+    {24378, -20937, 7500},
+    {12123, 30298, 3939},
+    {24959, 6460, 20399},
+    {14954, 27329, 10499},
+    {19639, 20937, 16252},
+    {23800, 12622, 18801},
+    {25057, 0, 21267},
+    {24959, -6460, 20399},
+    {22577, -15579, 18364},
+    {6479, 32322, 808},
+    {16179, 15530, 24044},
+    {17727, 3228, 27487},
+    {16179, -15530, 24044},
+    {16850, -23356, 15989},
+    {13813, -27462, 11961},
+    {3140, -32212, 5828},
+    {9435, 23356, 21214},
+    {15239, -6460, 28391},
+    {7469, -18283, 26213},
+    {-835, 32165, 6535},
+    {6582, 27329, 17028},
+    {7469, 18283, 26213},
+    {9323, 12622, 28844},
+    {9400, 6460, 30817},
+    {8999, 0, 31593},
+    {9323, -12622, 28844},
+    {6266, -25484, 19934},
+    {7364, -30354, 10430},
+    {-3053, 2436, 32767},
+    {3199, -6460, 32056},
+    {3366, 30568, 12030},
+    {-2630, 20937, 25336},
+    {-2439, 12622, 30211},
+    {-9326, -6460, 30835},
+    {-2439, -12622, 30211},
+    {-2630, -20937, 25336},
+    {-9326, 6460, 30835},
+    {-12976, -16104, 25712},
+    {-4007, -27330, 17805},
+    {-8303, 30298, 9638},
+    {-5705, 27357, 17482},
+    {-12140, 20937, 22396},
+    {-13829, 12622, 26973},
+    {-16003, 0, 28688},
+    {-23113, 12622, 19624},
+    {-21666, 3785, 24621},
+    {-18679, -10270, 25126},
+    {-12426, -23356, 19609},
+    {-13244, -27330, 12570},
+    {-4566, -30446, 11713},
+    {6, -32767, -35},
+    {-19801, 20937, 16041},
+    {-24906, -6460, 20449},
+    {-22808, -16288, 17289},
+    {-26576, 15746, 11348},
+    {-28424, 6460, 15196},
+    {-29264, 0, 14954},
+    {-16130, 27590, 8223},
+    {-22032, 23319, 6845},
+    {-32767, 2436, 3365},
+    {-30850, -6460, 9358},
+    {-27834, -15579, 8508},
+    {-21246, -23356, 9393},
+    {-14500, -29276, 4535},
+    {-4990, -32165, 4315},
+    {-28966, 15579, 2913},
+    {-32096, 6460, -3163},
+    {-23121, 23222, -1903},
+    {-31298, -10270, -1590},
+    {-25968, -18283, -8413},
+    {-24908, -21504, -1466},
+    {-12599, 30446, -308},
+    {-17953, 27257, -3948},
+    {-27889, 15579, -8397},
+    {-31292, 0, -10130},
+    {-30869, -6460, -9365},
+    {-17953, -27257, -3948},
+    {-19641, 23356, -12465},
+    {-24152, 15530, -16092},
+    {-28408, 3785, -16477},
+    {-27006, -12622, -13867},
+    {-20645, -23222, -10610},
+    {-6509, 32306, -676},
+    {-20408, 0, -25814},
+    {-24947, -6460, -20468},
+    {-20784, -18283, -17713},
+    {-11789, -30408, -4705},
+    {-8702, 30295, -9185},
+    {-12799, 27350, -13059},
+    {-18541, 15579, -22483},
+    {-20481, 6460, -24943},
+    {-19668, -10376, -24441},
+    {-15026, -23222, -17707},
+    {-12652, -27418, -13079},
+    {-9388, -6460, -30886},
+    {-12435, -18283, -24322},
+    {-9129, 23543, -21242},
+    {-8538, 15578, -27871},
+    {-9847, 4164, -31243},
+    {-9024, -12842, -28939},
+    {-7118, -23222, -22113},
+    {-3360, -27403, -17867},
+    {1875, -23222, -23158},
+    {-3844, -30340, -12105},
+    {-4827, -32262, -4577},
+};
+constexpr m3::vec3 sphere_0_normals[] = {
+    {0.03840000182390213f, -0.8023999929428101f, -0.5954999923706055f},
+    {0.03449999913573265f, 0.11389999836683273f, -0.992900013923645f},
+    {0.008799999952316284f, -0.9927999973297119f, -0.11959999799728394f},
+    {0.08110000193119049f, 0.8497999906539917f, -0.5209000110626221f},
+    {0.08320000022649765f, -0.5346999764442444f, -0.8409000039100647f},
+    {0.22310000658035278f, -0.6836000084877014f, -0.6948999762535095f},
+    {0.17960000038146973f, 0.45680001378059387f, -0.8712000250816345f},
+    {0.12470000237226486f, 0.9387999773025513f, -0.32109999656677246f},
+    {0.2295999974012375f, 0.8806999921798706f, -0.4142000079154968f},
+    {0.4034999907016754f, -0.5285000205039978f, -0.7469000220298767f},
+    {0.3037000000476837f, -0.8294000029563904f, -0.46889999508857727f},
+    {0.6434999704360962f, 0.011300000362098217f, -0.7653999924659729f},
+    {0.07900000363588333f, 0.9934999942779541f, -0.08240000158548355f},
+    {0.5770000219345093f, -0.37380000948905945f, -0.7261999845504761f},
+    {0.448199987411499f, 0.7305999994277954f, -0.5151000022888184f},
+    {0.760200023651123f, -0.1875f, -0.6220999956130981f},
+    {0.6622999906539917f, -0.536300003528595f, -0.5231000185012817f},
+    {0.5511000156402588f, -0.6733999848365784f, -0.4927000105381012f},
+    {0.3450999855995178f, -0.9178000092506409f, -0.1965000033378601f},
+    {0.8901000022888184f, 0.0007999999797903001f, -0.45590001344680786f},
+    {0.8113999962806702f, -0.3815000057220459f, -0.44269999861717224f},
+    {0.483599990606308f, 0.8438000082969666f, -0.23270000517368317f},
+    {0.7145000100135803f, 0.5940999984741211f, -0.3695000112056732f},
+    {0.8241999745368958f, -0.5127999782562256f, -0.24040000140666962f},
+    {0.6444000005722046f, 0.7365000247955322f, -0.20589999854564667f},
+    {0.9429000020027161f, 0.19210000336170197f, -0.2721000015735626f},
+    {0.9330999851226807f, -0.1446000039577484f, -0.32919999957084656f},
+    {0.3605000078678131f, 0.9315000176429749f, -0.04800000041723251f},
+    {0.8377000093460083f, -0.5392000079154968f, 0.08699999749660492f},
+    {0.6617000102996826f, 0.7475000023841858f, 0.05779999867081642f},
+    {0.7886000275611877f, 0.6000999808311462f, 0.1340000033378601f},
+    {0.9695000052452087f, 0.21969999372959137f, 0.10849999636411667f},
+    {0.986299991607666f, 0.08160000294446945f, 0.14350000023841858f},
+    {0.22120000422000885f, -0.9732999801635742f, 0.061400000005960464f},
+    {0.11159999668598175f, -0.9932000041007996f, 0.03420000150799751f},
+    {0.9523000121116638f, -0.16099999845027924f, 0.2590999901294708f},
+    {0.9319000244140625f, -0.30250000953674316f, 0.19990000128746033f},
+    {0.5220000147819519f, 0.8389000296592712f, 0.15399999916553497f},
+    {0.5764999985694885f, -0.7890999913215637f, 0.21199999749660492f},
+    {0.5953999757766724f, 0.7329999804496765f, 0.32899999618530273f},
+    {0.36469998955726624f, -0.9122999906539917f, 0.1860000044107437f},
+    {0.2240999937057495f, 0.9514999985694885f, 0.21080000698566437f},
+    {0.4564000070095062f, 0.6233999729156494f, 0.6348999738693237f},
+    {0.6126000285148621f, 0.49559998512268066f, 0.6155999898910522f},
+    {0.29499998688697815f, 0.8773999810218811f, 0.3783000111579895f},
+    {0.3982999920845032f, 0.08510000258684158f, 0.9132999777793884f},
+    {0.05550000071525574f, 0.9936000108718872f, 0.09799999743700027f},
+    {0.43140000104904175f, -0.35339999198913574f, 0.8299999833106995f},
+    {0.35280001163482666f, -0.48730000853538513f, 0.798799991607666f},
+    {0.3643999993801117f, 0.5784000158309937f, 0.7297999858856201f},
+    {0.28600001335144043f, -0.18950000405311584f, 0.939300000667572f},
+    {0.1071000024676323f, -0.374099999666214f, 0.9211999773979187f},
+    {0.02160000056028366f, 0.8454999923706055f, 0.5335000157356262f},
+    {0.11010000109672546f, -0.6639000177383423f, 0.7396000027656555f},
+    {0.003000000026077032f, -0.7628999948501587f, 0.6464999914169312f},
+    {-0.13570000231266022f, 0.24899999797344208f, 0.958899974822998f},
+    {-0.09600000083446503f, -0.1462000012397766f, 0.9846000075340271f},
+    {-0.0917000025510788f, 0.9352999925613403f, 0.3418000042438507f},
+    {-0.25589999556541443f, -0.3765000104904175f, 0.8903999924659729f},
+    {-0.20589999854564667f, 0.7168999910354614f, 0.666100025177002f},
+    {-0.04820000007748604f, -0.9722999930381775f, 0.22849999368190765f},
+    {-0.29910001158714294f, -0.008200000040233135f, 0.954200029373169f},
+    {-0.025800000876188278f, -0.9937999844551086f, 0.10769999772310257f},
+    {-0.47429999709129333f, 0.19210000336170197f, 0.8590999841690063f},
+    {-0.4569999873638153f, -0.18299999833106995f, 0.8705000281333923f},
+    {-0.4020000100135803f, -0.30640000104904175f, 0.8628000020980835f},
+    {-0.28119999170303345f, -0.8216000199317932f, 0.4959000051021576f},
+    {-0.36340001225471497f, 0.8264999985694885f, 0.4300000071525574f},
+    {-0.5640000104904175f, -0.4844000041484833f, 0.6687999963760376f},
+    {-0.07819999754428864f, 0.9936000108718872f, 0.08089999854564667f},
+    {-0.301800012588501f, -0.9147999882698059f, 0.2685999870300293f},
+    {-0.7623000144958496f, 0.21969999372959137f, 0.6087999939918518f},
+    {-0.7989000082015991f, 0.08160000294446945f, 0.5958999991416931f},
+    {-0.6899999976158142f, -0.35109999775886536f, 0.6328999996185303f},
+    {-0.5631999969482422f, -0.6682000160217285f, 0.4862000048160553f},
+    {-0.6022999882698059f, 0.7250999808311462f, 0.33379998803138733f},
+    {-0.5130000114440918f, -0.8125f, 0.2768000066280365f},
+    {-0.7181000113487244f, 0.4964999854564667f, 0.4876999855041504f},
+    {-0.8654999732971191f, -0.18950000405311584f, 0.46369999647140503f},
+    {-0.2816999852657318f, 0.9498000144958496f, 0.13580000400543213f},
+    {-0.7785999774932861f, 0.5917999744415283f, 0.20890000462532043f},
+    {-0.8686000108718872f, -0.49399998784065247f, 0.03840000182390213f},
+    {-0.7626000046730042f, -0.6292999982833862f, 0.14990000426769257f},
+    {-0.9573000073432922f, 0.27959999442100525f, 0.0737999975681305f},
+    {-0.1120000034570694f, -0.9937000274658203f, 0.008799999952316284f},
+    {-0.9843999743461609f, -0.15000000596046448f, 0.09239999949932098f},
+    {-0.9341999888420105f, -0.32330000400543213f, 0.15070000290870667f},
+    {-0.5393000245094299f, 0.8400999903678894f, 0.05779999867081642f},
+    {-0.9941999912261963f, -0.008200000040233135f, -0.10719999670982361f},
+    {-0.8644999861717224f, -0.49320000410079956f, -0.0966000035405159f},
+    {-0.8148000240325928f, 0.5745999813079834f, -0.07760000228881836f},
+    {-0.7096999883651733f, -0.6743000149726868f, -0.20419999957084656f},
+    {-0.9192000031471252f, 0.24940000474452972f, -0.30469998717308044f},
+    {-0.8916000127792358f, -0.38530001044273376f, -0.2379000037908554f},
+    {-0.651199996471405f, 0.7305999994277954f, -0.2053000032901764f},
+    {-0.2969000041484833f, 0.9435999989509583f, -0.14640000462532043f},
+    {-0.7390999794006348f, -0.5328999757766724f, -0.41190001368522644f},
+    {-0.7278000116348267f, 0.5855000019073486f, -0.3569999933242798f},
+    {-0.5127000212669373f, -0.8105000257492065f, -0.2833000123500824f},
+    {-0.6064000129699707f, 0.5946999788284302f, -0.527899980545044f},
+    {-0.7402999997138977f, 0.08160000294446945f, -0.6672999858856201f},
+    {-0.7195000052452087f, -0.3815000057220459f, -0.5802000164985657f},
+    {-0.5782999992370605f, -0.6751999855041504f, -0.4578999876976013f},
+    {-0.6611999869346619f, -0.1446000039577484f, -0.7361000180244446f},
+    {-0.5370000004768372f, -0.5016999840736389f, -0.6782000064849854f},
+    {-0.45980000495910645f, 0.7084000110626221f, -0.5354999899864197f},
+    {-0.2703000009059906f, -0.9153000116348267f, -0.2985999882221222f},
+    {-0.06069999933242798f, 0.9934999942779541f, -0.09610000252723694f},
+    {-0.35910001397132874f, -0.6751999855041504f, -0.6442999839782715f},
+    {-0.3889000117778778f, 0.5723999738693237f, -0.7218999862670898f},
+    {-0.23180000483989716f, -0.541100025177002f, -0.8083999752998352f},
+    {-0.0421999990940094f, 0.47429999709129333f, -0.8794000148773193f},
+    {-0.09709999710321426f, -0.19460000097751617f, -0.9761000275611877f},
+    {-0.07890000194311142f, 0.7235999703407288f, -0.685699999332428f},
+    {-0.08489999920129776f, -0.6773999929428101f, -0.7307000160217285f},
+    {0.02410000003874302f, -0.9679999947547913f, -0.25f},
+    {0.29100000858306885f, 0.29739999771118164f, -0.9093000292778015f},
+    {0.08299999684095383f, -0.02160000056028366f, -0.9962999820709229f},
+    {0.058800000697374344f, 0.7767000198364258f, -0.6270999908447266f},
+    {0.08309999853372574f, -0.5874999761581421f, -0.8050000071525574f},
+    {0.2671000063419342f, 0.6370000243186951f, -0.7231000065803528f},
+    {0.20600000023841858f, -0.7314000129699707f, -0.6500999927520752f},
+    {0.28290000557899475f, -0.08540000021457672f, -0.955299973487854f},
+    {0.29260000586509705f, -0.25600001215934753f, -0.9212999939918518f},
+    {0.4519999921321869f, 0.28110000491142273f, -0.8464999794960022f},
+    {0.16910000145435333f, 0.8938999772071838f, -0.41510000824928284f},
+    {0.2637999951839447f, -0.3921000063419342f, -0.8812999725341797f},
+    {0.5081999897956848f, -0.2551000118255615f, -0.8226000070571899f},
+    {0.38440001010894775f, -0.5800999999046326f, -0.7182000279426575f},
+    {0.2946000099182129f, -0.8400999903678894f, -0.4555000066757202f},
+    {0.48179998993873596f, 0.633400022983551f, -0.6054999828338623f},
+    {0.5266000032424927f, 0.0966000035405159f, -0.8446000218391418f},
+    {0.7355999946594238f, 0.2994999885559082f, -0.6075999736785889f},
+    {0.5234000086784363f, 0.5512999892234802f, -0.6496999859809875f},
+    {0.6474999785423279f, -0.012299999594688416f, -0.7620000243186951f},
+    {0.15299999713897705f, 0.9782999753952026f, -0.1396999955177307f},
+    {0.5684999823570251f, -0.4043000042438507f, -0.7164999842643738f},
+    {0.7573000192642212f, -0.20800000429153442f, -0.6190999746322632f},
+    {0.5385000109672546f, -0.7027999758720398f, -0.4648999869823456f},
+    {0.6104000210762024f, -0.7684999704360962f, -0.19220000505447388f},
+    {0.7580000162124634f, 0.1898999959230423f, -0.6240000128746033f},
+    {0.7860999703407288f, 0.4893999993801117f, -0.3776000142097473f},
+    {0.8108000159263611f, 0.3734000027179718f, -0.4507000148296356f},
+    {0.3287999927997589f, -0.9254999756813049f, -0.18770000338554382f},
+    {0.8901000022888184f, -0.0007999999797903001f, -0.45590001344680786f},
+    {0.7937999963760376f, -0.4408000111579895f, -0.41909998655319214f},
+    {0.515500009059906f, 0.8206999897956848f, -0.24629999697208405f},
+    {0.6815000176429749f, 0.6935999989509583f, -0.23340000212192535f},
+    {0.9847999811172485f, -0.13439999520778656f, -0.10970000177621841f},
+    {0.4832000136375427f, -0.8611999750137329f, -0.1574999988079071f},
+    {0.9408000111579895f, 0.20730000734329224f, -0.26829999685287476f},
+    {0.9398000240325928f, 0.32359999418258667f, -0.10920000076293945f},
+    {0.8812999725341797f, 0.46380001306533813f, -0.0908999964594841f},
+    {0.9574000239372253f, -0.2800999879837036f, -0.07010000199079514f},
+    {0.37450000643730164f, 0.9258000254631042f, -0.05090000107884407f},
+    {0.8840000033378601f, -0.45570001006126404f, -0.1039000004529953f},
+    {0.8478000164031982f, 0.3057999908924103f, 0.4332999885082245f},
+    {0.6800000071525574f, -0.7297999858856201f, 0.0706000030040741f},
+    {0.8360000252723694f, 0.5400000214576721f, 0.09719999879598618f},
+    {0.9929999709129333f, -0.003599999938160181f, 0.11789999902248383f},
+    {0.9077000021934509f, 0.35030001401901245f, 0.23090000450611115f},
+    {0.85589998960495f, -0.4560999870300293f, 0.24379999935626984f},
+    {0.5483999848365784f, 0.8206999897956848f, 0.16050000488758087f},
+    {0.4577000141143799f, -0.873199999332428f, 0.16740000247955322f},
+    {0.8001000285148621f, -0.4747999906539917f, 0.3666999936103821f},
+    {0.6669999957084656f, -0.6184999942779541f, 0.4153999984264374f},
+    {0.7031000256538391f, 0.6277999877929688f, 0.33390000462532043f},
+    {0.5909000039100647f, -0.7439000010490417f, 0.31209999322891235f},
+    {0.7355999946594238f, 0.5063999891281128f, 0.44999998807907104f},
+    {0.8738999962806702f, 0.09560000151395798f, 0.4765999913215637f},
+    {0.2678000032901764f, -0.9534000158309937f, 0.13899999856948853f},
+    {0.8744000196456909f, -0.09839999675750732f, 0.47510001063346863f},
+    {0.40560001134872437f, 0.76910001039505f, 0.49390000104904175f},
+    {0.8025000095367432f, -0.32199999690055847f, 0.5023000240325928f},
+    {0.29260000586509705f, 0.9124000072479248f, 0.28619998693466187f},
+    {0.6074000000953674f, 0.29109999537467957f, 0.7390999794006348f},
+    {0.5372999906539917f, -0.5824000239372253f, 0.6100000143051147f},
+    {0.6261000037193298f, -0.09860000014305115f, 0.7735000252723694f},
+    {0.6705999970436096f, 0.10890000313520432f, 0.7337999939918518f},
+    {0.6158000230789185f, -0.30410000681877136f, 0.7268999814987183f},
+    {0.374099999666214f, -0.6473000049591064f, 0.6640999913215637f},
+    {0.43380001187324524f, -0.027300000190734863f, 0.900600016117096f},
+    {0.12559999525547028f, 0.9743000268936157f, 0.18700000643730164f},
+    {0.4569000005722046f, 0.2872999906539917f, 0.8417999744415283f},
+    {0.3513999879360199f, -0.7753999829292297f, 0.5246999859809875f},
+    {0.35280001163482666f, 0.48730000853538513f, 0.798799991607666f},
+    {0.26840001344680786f, -0.8445000052452087f, 0.4634000062942505f},
+    {0.0778999999165535f, -0.48080000281333923f, 0.8733000159263611f},
+    {0.2851000130176544f, -0.20499999821186066f, 0.9362999796867371f},
+    {0.09430000185966492f, -0.013299999758601189f, 0.9955000281333923f},
+    {0.04490000009536743f, 0.767300009727478f, 0.6396999955177307f},
+    {0.0778999999165535f, 0.48080000281333923f, 0.8733000159263611f},
+    {0.11389999836683273f, 0.6747999787330627f, 0.7290999889373779f},
+    {0.060100000351667404f, -0.8877999782562256f, 0.4562999904155731f},
+    {0.08789999783039093f, 0.26350000500679016f, 0.9606999754905701f},
+    {-0.24619999527931213f, 0.4959000051021576f, 0.8327999711036682f},
+    {0.043699998408555984f, -0.9397000074386597f, 0.3391000032424927f},
+    {0.11860000342130661f, 0.11129999905824661f, 0.9866999983787537f},
+    {-0.0949999988079071f, -0.20499999821186066f, 0.9740999937057495f},
+    {-0.09870000183582306f, 0.9207000136375427f, 0.3776000142097473f},
+    {-0.19910000264644623f, -0.4925000071525574f, 0.8471999764442444f},
+    {-0.2687999904155731f, -0.6323999762535095f, 0.7265999913215637f},
+    {-0.20309999585151672f, -0.7281000018119812f, 0.654699981212616f},
+    {-0.40369999408721924f, 0.7793999910354614f, 0.47920000553131104f},
+    {-0.25360000133514404f, 0.374099999666214f, 0.8920000195503235f},
+    {-0.30140000581741333f, 0.005499999970197678f, 0.953499972820282f},
+    {-0.259799987077713f, -0.8500000238418579f, 0.45829999446868896f},
+    {-0.4754999876022339f, 0.20730000734329224f, 0.8550000190734863f},
+    {-0.5461000204086304f, 0.4959000051021576f, 0.6751999855041504f},
+    {-0.5284000039100647f, -0.5699999928474426f, 0.6291999816894531f},
+    {-0.6323999762535095f, -0.10700000077486038f, 0.7671999931335449f},
+    {-0.5873000025749207f, 0.32359999418258667f, 0.7418000102043152f},
+    {-0.8341000080108643f, -0.3203999996185303f, 0.4489000141620636f},
+    {-0.1770000010728836f, 0.9714000225067139f, 0.1581999957561493f},
+    {-0.2775999903678894f, -0.932200014591217f, 0.23240000009536743f},
+    {-0.7856000065803528f, -0.003599999938160181f, 0.6187999844551086f},
+    {-0.534500002861023f, -0.7081000208854675f, 0.46140000224113464f},
+    {-0.34869998693466187f, 0.9226999878883362f, 0.16429999470710754f},
+    {-0.7289000153541565f, -0.5756000280380249f, 0.37059998512268066f},
+    {-0.7077999711036682f, 0.6230999827384949f, 0.3330000042915344f},
+    {-0.8065000176429749f, 0.3562999963760376f, 0.4717999994754791f},
+    {-0.9265000224113464f, 0.2815000116825104f, 0.24959999322891235f},
+    {-0.5960000157356262f, 0.8001999855041504f, 0.06650000065565109f},
+    {-0.944599986076355f, 0.11129999905824661f, 0.30880001187324524f},
+    {-0.9578999876976013f, -0.013299999758601189f, 0.2867000102996826f},
+    {0.04349999874830246f, -0.8971999883651733f, -0.43950000405311584f},
+    {-0.6233000159263611f, -0.7785000205039978f, 0.07360000163316727f},
+    {-0.7634999752044678f, 0.6396999955177307f, 0.08799999952316284f},
+    {-0.27639999985694885f, -0.9607999920845032f, 0.021199999377131462f},
+    {-0.45719999074935913f, -0.8889999985694885f, -0.025299999862909317f},
+    {-0.9926000237464905f, -0.07750000059604645f, -0.09390000253915787f},
+    {-0.8769000172615051f, -0.1137000024318695f, -0.46700000762939453f},
+    {-0.9225999712944031f, 0.37549999356269836f, -0.08789999783039093f},
+    {-0.7251999974250793f, 0.6488000154495239f, -0.23070000112056732f},
+    {-0.6633999943733215f, -0.7281000018119812f, -0.17249999940395355f},
+    {-0.9312999844551086f, 0.20730000734329224f, -0.2996000051498413f},
+    {-0.8895999789237976f, -0.39100000262260437f, -0.2361000031232834f},
+    {-0.4097000062465668f, 0.8880000114440918f, -0.20900000631809235f},
+    {-0.8636999726295471f, -0.20499999821186066f, -0.46050000190734863f},
+    {-0.7317000031471252f, 0.30090001225471497f, -0.6115999817848206f},
+    {-0.5020999908447266f, 0.8197000026702881f, -0.27559998631477356f},
+    {-0.707099974155426f, -0.5871000289916992f, -0.39410001039505005f},
+    {-0.4645000100135803f, -0.8482000231742859f, -0.25459998846054077f},
+    {-0.8507999777793884f, 0.3221000134944916f, -0.41510000824928284f},
+    {-0.5199000239372253f, -0.7484999895095825f, -0.4115999937057495f},
+    {-0.2897000014781952f, -0.788100004196167f, -0.5432000160217285f},
+    {-0.7601000070571899f, -0.003599999938160181f, -0.6498000025749207f},
+    {-0.7146999835968018f, -0.392300009727478f, -0.5791000127792358f},
+    {-0.5024999976158142f, -0.5871000289916992f, -0.6347000002861023f},
+    {-0.486299991607666f, 0.6636999845504761f, -0.5683000087738037f},
+    {-0.24310000240802765f, -0.9318000078201294f, -0.2694999873638153f},
+    {-0.4424000084400177f, 0.3093999922275543f, -0.8417999744415283f},
+    {-0.23389999568462372f, -0.858299970626831f, -0.45669999718666077f},
+    {-0.4634000062942505f, -0.09910000115633011f, -0.8805999755859375f},
+    {-0.4887000024318695f, 0.1111999973654747f, -0.8652999997138977f},
+    {-0.1331000030040741f, 0.9660000205039978f, -0.22179999947547913f},
+    {-0.20909999310970306f, 0.8842999935150146f, -0.4174000024795532f},
+    {-0.4284999966621399f, -0.28610000014305115f, -0.8571000099182129f},
+    {-0.09679999947547913f, -0.29190000891685486f, -0.9514999985694885f},
+    {-0.4339999854564667f, -0.4092999994754791f, -0.8026000261306763f},
+    {-0.26429998874664307f, 0.8238000273704529f, -0.5015000104904175f},
+    {-0.22380000352859497f, -0.5888000130653381f, -0.7767000198364258f},
+    {-0.2395000010728836f, -0.0430000014603138f, -0.9699000120162964f},
+    {-0.1599999964237213f, 0.29679998755455017f, -0.9415000081062317f},
+    {-0.10199999809265137f, 0.17640000581741333f, -0.9789999723434448f},
+    {-0.09229999780654907f, -0.4092999994754791f, -0.9077000021934509f},
+    {-0.1339000016450882f, 0.6284000277519226f, -0.7663000226020813f},
+    {-0.0771000012755394f, -0.7440000176429749f, -0.6636999845504761f},
+};
+constexpr face sphere_0_faces[] = {
+    {0, 3, 0, 0},
+    {3, 3, 0, 2},
+    {6, 3, 0, 4},
+    {9, 3, 0, 5},
+    {12, 3, 0, 10},
+    {15, 3, 0, 11},
+    {18, 3, 0, 12},
+    {21, 3, 0, 13},
+    {24, 3, 0, 15},
+    {27, 3, 0, 16},
+    {30, 3, 0, 17},
+    {33, 3, 0, 18},
+    {36, 3, 0, 19},
+    {39, 3, 0, 20},
+    {42, 3, 0, 23},
+    {45, 3, 0, 25},
+    {48, 3, 0, 26},
+    {51, 3, 0, 28},
+    {54, 3, 0, 31},
+    {57, 3, 0, 32},
+    {60, 3, 0, 33},
+    {63, 3, 0, 34},
+    {66, 3, 0, 35},
+    {69, 3, 0, 36},
+    {72, 3, 0, 42},
+    {75, 3, 0, 43},
+    {78, 3, 0, 46},
+    {81, 3, 0, 49},
+    {84, 3, 0, 52},
+    {87, 3, 0, 57},
+    {90, 3, 0, 59},
+    {93, 3, 0, 60},
+    {96, 3, 0, 61},
+    {99, 3, 0, 62},
+    {102, 3, 0, 63},
+    {105, 3, 0, 64},
+    {108, 3, 0, 65},
+    {111, 3, 0, 67},
+    {114, 3, 0, 68},
+    {117, 3, 0, 69},
+    {120, 3, 0, 70},
+    {123, 3, 0, 71},
+    {126, 3, 0, 72},
+    {129, 3, 0, 73},
+    {132, 3, 0, 74},
+    {135, 3, 0, 75},
+    {138, 3, 0, 76},
+    {141, 3, 0, 77},
+    {144, 3, 0, 78},
+    {147, 3, 0, 79},
+    {150, 3, 0, 80},
+    {153, 3, 0, 81},
+    {156, 3, 0, 82},
+    {159, 3, 0, 83},
+    {162, 3, 0, 84},
+    {165, 3, 0, 85},
+    {168, 3, 0, 86},
+    {171, 3, 0, 87},
+    {174, 3, 0, 88},
+    {177, 3, 0, 89},
+    {180, 3, 0, 90},
+    {183, 3, 0, 91},
+    {186, 3, 0, 92},
+    {189, 3, 0, 93},
+    {192, 3, 0, 94},
+    {195, 3, 0, 95},
+    {198, 3, 0, 96},
+    {201, 3, 0, 97},
+    {204, 3, 0, 98},
+    {207, 3, 0, 99},
+    {210, 3, 0, 100},
+    {213, 3, 0, 101},
+    {216, 3, 0, 102},
+    {219, 3, 0, 103},
+    {222, 3, 0, 104},
+    {225, 3, 0, 105},
+    {228, 3, 0, 106},
+    {231, 3, 0, 107},
+    {234, 3, 0, 108},
+    {237, 3, 0, 109},
+    {240, 3, 0, 110},
+    {243, 3, 0, 114},
+    {246, 4, 0, 115},
+    {250, 3, 0, 119},
+    {253, 3, 0, 121},
+    {256, 4, 0, 124},
+    {260, 3, 0, 126},
+    {263, 3, 0, 128},
+    {266, 3, 0, 129},
+    {269, 4, 0, 130},
+    {273, 3, 0, 131},
+    {276, 4, 0, 132},
+    {280, 3, 0, 133},
+    {283, 3, 0, 134},
+    {286, 3, 0, 136},
+    {289, 3, 0, 137},
+    {292, 3, 0, 138},
+    {295, 4, 0, 139},
+    {299, 3, 0, 140},
+    {302, 3, 0, 141},
+    {305, 3, 0, 142},
+    {308, 3, 0, 143},
+    {311, 3, 0, 144},
+    {314, 3, 0, 145},
+    {317, 4, 0, 148},
+    {321, 3, 0, 150},
+    {324, 3, 0, 151},
+    {327, 3, 0, 153},
+    {330, 3, 0, 155},
+    {333, 3, 0, 159},
+    {336, 3, 0, 160},
+    {339, 3, 0, 170},
+    {342, 4, 0, 175},
+    {346, 3, 0, 182},
+    {349, 3, 0, 185},
+    {352, 4, 0, 190},
+    {356, 4, 0, 191},
+    {360, 3, 0, 192},
+    {363, 4, 0, 195},
+    {367, 3, 0, 196},
+    {370, 3, 0, 199},
+    {373, 4, 0, 203},
+    {377, 3, 0, 204},
+    {380, 3, 0, 205},
+    {383, 3, 0, 207},
+    {386, 4, 0, 208},
+    {390, 3, 0, 209},
+    {393, 4, 0, 210},
+    {397, 3, 0, 211},
+    {400, 4, 0, 212},
+    {404, 3, 0, 213},
+    {407, 3, 0, 214},
+    {410, 3, 0, 215},
+    {413, 3, 0, 216},
+    {416, 3, 0, 217},
+    {419, 3, 0, 218},
+    {422, 3, 0, 219},
+    {425, 3, 0, 220},
+    {428, 4, 0, 221},
+    {432, 4, 0, 222},
+    {436, 3, 0, 223},
+    {439, 3, 0, 224},
+    {442, 4, 0, 225},
+    {446, 4, 0, 226},
+    {450, 3, 0, 227},
+    {453, 4, 0, 228},
+    {457, 3, 0, 229},
+    {460, 4, 0, 230},
+    {464, 4, 0, 231},
+    {468, 3, 0, 232},
+    {471, 3, 0, 233},
+    {474, 3, 0, 234},
+    {477, 3, 0, 235},
+    {480, 3, 0, 236},
+    {483, 4, 0, 237},
+    {487, 3, 0, 238},
+    {490, 4, 0, 239},
+    {494, 3, 0, 240},
+    {497, 3, 0, 241},
+    {500, 3, 0, 242},
+    {503, 3, 0, 243},
+    {506, 3, 0, 244},
+    {509, 4, 0, 245},
+    {513, 3, 0, 246},
+    {516, 3, 0, 247},
+    {519, 3, 0, 248},
+    {522, 3, 0, 249},
+    {525, 3, 0, 250},
+    {528, 4, 0, 251},
+    {532, 3, 0, 252},
+    {535, 4, 0, 253},
+    {539, 3, 0, 254},
+    {542, 4, 0, 256},
+    {546, 3, 0, 257},
+    {549, 3, 0, 259},
+    {552, 3, 0, 260},
+    {555, 3, 0, 261},
+    {558, 3, 0, 262},
+    {561, 3, 0, 265},
+    {564, 3, 0, 267},
+    {567, 3, 1, 22},
+    {570, 3, 1, 24},
+    {573, 3, 1, 29},
+    {576, 3, 1, 30},
+    {579, 3, 1, 39},
+    {582, 3, 1, 41},
+    {585, 3, 1, 44},
+    {588, 3, 1, 146},
+    {591, 3, 1, 147},
+    {594, 4, 1, 152},
+    {598, 3, 1, 158},
+    {601, 3, 1, 162},
+    {604, 3, 1, 166},
+    {607, 3, 1, 168},
+    {610, 4, 1, 172},
+    {614, 3, 1, 174},
+    {617, 3, 2, 38},
+    {620, 3, 2, 40},
+    {623, 3, 2, 45},
+    {626, 3, 2, 47},
+    {629, 3, 2, 48},
+    {632, 3, 2, 50},
+    {635, 3, 2, 51},
+    {638, 3, 2, 53},
+    {641, 3, 2, 54},
+    {644, 3, 2, 55},
+    {647, 3, 2, 56},
+    {650, 3, 2, 58},
+    {653, 3, 2, 66},
+    {656, 3, 2, 149},
+    {659, 4, 2, 156},
+    {663, 3, 2, 157},
+    {666, 3, 2, 161},
+    {669, 3, 2, 163},
+    {672, 3, 2, 164},
+    {675, 3, 2, 165},
+    {678, 3, 2, 167},
+    {681, 4, 2, 169},
+    {685, 4, 2, 171},
+    {689, 3, 2, 173},
+    {692, 3, 2, 176},
+    {695, 4, 2, 177},
+    {699, 3, 2, 178},
+    {702, 4, 2, 179},
+    {706, 4, 2, 180},
+    {710, 3, 2, 181},
+    {713, 4, 2, 183},
+    {717, 3, 2, 184},
+    {720, 3, 2, 186},
+    {723, 4, 2, 187},
+    {727, 3, 2, 188},
+    {730, 3, 2, 189},
+    {733, 4, 2, 193},
+    {737, 4, 2, 194},
+    {741, 3, 2, 197},
+    {744, 3, 2, 198},
+    {747, 3, 2, 200},
+    {750, 3, 2, 201},
+    {753, 3, 2, 202},
+    {756, 3, 2, 206},
+    {759, 3, 3, 1},
+    {762, 3, 3, 3},
+    {765, 3, 3, 6},
+    {768, 3, 3, 7},
+    {771, 3, 3, 8},
+    {774, 3, 3, 9},
+    {777, 3, 3, 14},
+    {780, 3, 3, 21},
+    {783, 3, 3, 27},
+    {786, 3, 3, 37},
+    {789, 3, 3, 111},
+    {792, 3, 3, 112},
+    {795, 3, 3, 113},
+    {798, 4, 3, 116},
+    {802, 3, 3, 117},
+    {805, 3, 3, 118},
+    {808, 3, 3, 120},
+    {811, 4, 3, 122},
+    {815, 4, 3, 123},
+    {819, 3, 3, 125},
+    {822, 3, 3, 127},
+    {825, 3, 3, 135},
+    {828, 3, 3, 154},
+    {831, 4, 3, 255},
+    {835, 4, 3, 258},
+    {839, 3, 3, 263},
+    {842, 3, 3, 264},
+    {845, 3, 3, 266},
+};
+constexpr vertex_index sphere_0_indices[] = {
+    155,
+    11,
+    154,
+    103,
+    157,
+    47,
+    8,
+    9,
+    2,
+    9,
+    17,
+    155,
+    11,
+    17,
+    33,
+    15,
+    19,
+    20,
+    12,
+    27,
+    62,
+    21,
+    25,
+    16,
+    20,
+    31,
+    21,
+    22,
+    25,
+    32,
+    22,
+    32,
+    17,
+    33,
+    46,
+    26,
+    20,
+    30,
+    36,
+    31,
+    37,
+    25,
+    32,
+    37,
+    42,
+    30,
+    35,
+    40,
+    36,
+    37,
+    31,
+    42,
+    41,
+    53,
+    40,
+    44,
+    50,
+    40,
+    50,
+    51,
+    47,
+    46,
+    68,
+    103,
+    47,
+    68,
+    51,
+    52,
+    45,
+    45,
+    52,
+    41,
+    57,
+    69,
+    63,
+    57,
+    63,
+    58,
+    62,
+    27,
+    72,
+    63,
+    69,
+    74,
+    73,
+    83,
+    93,
+    83,
+    72,
+    92,
+    93,
+    94,
+    84,
+    102,
+    117,
+    68,
+    81,
+    89,
+    96,
+    103,
+    68,
+    117,
+    89,
+    95,
+    98,
+    96,
+    99,
+    86,
+    86,
+    99,
+    90,
+    92,
+    110,
+    93,
+    90,
+    99,
+    106,
+    72,
+    27,
+    135,
+    101,
+    116,
+    102,
+    98,
+    97,
+    108,
+    98,
+    108,
+    109,
+    105,
+    106,
+    99,
+    106,
+    115,
+    100,
+    110,
+    111,
+    104,
+    101,
+    115,
+    116,
+    104,
+    107,
+    97,
+    109,
+    113,
+    105,
+    135,
+    124,
+    92,
+    107,
+    111,
+    118,
+    114,
+    121,
+    123,
+    114,
+    123,
+    115,
+    112,
+    118,
+    119,
+    103,
+    117,
+    157,
+    112,
+    121,
+    113,
+    113,
+    121,
+    114,
+    110,
+    124,
+    125,
+    112,
+    119,
+    127,
+    123,
+    121,
+    122,
+    118,
+    120,
+    126,
+    122,
+    134,
+    123,
+    119,
+    126,
+    132,
+    128,
+    133,
+    121,
+    125,
+    130,
+    120,
+    124,
+    135,
+    140,
+    122,
+    133,
+    138,
+    126,
+    130,
+    131,
+    129,
+    134,
+    146,
+    131,
+    130,
+    142,
+    132,
+    143,
+    136,
+    137,
+    144,
+    133,
+    138,
+    145,
+    134,
+    136,
+    144,
+    137,
+    138,
+    144,
+    148,
+    141,
+    149,
+    130,
+    146,
+    156,
+    139,
+    135,
+    27,
+    12,
+    148,
+    153,
+    145,
+    142,
+    149,
+    150,
+    148,
+    152,
+    2,
+    2,
+    155,
+    153,
+    47,
+    157,
+    156,
+    26,
+    2,
+    9,
+    155,
+    11,
+    155,
+    17,
+    19,
+    10,
+    14,
+    18,
+    8,
+    16,
+    9,
+    17,
+    9,
+    22,
+    11,
+    33,
+    26,
+    24,
+    14,
+    13,
+    29,
+    10,
+    19,
+    15,
+    24,
+    30,
+    19,
+    18,
+    14,
+    24,
+    18,
+    15,
+    20,
+    21,
+    22,
+    16,
+    25,
+    21,
+    31,
+    25,
+    17,
+    32,
+    33,
+    42,
+    38,
+    33,
+    32,
+    20,
+    19,
+    30,
+    24,
+    34,
+    35,
+    30,
+    24,
+    35,
+    47,
+    26,
+    46,
+    20,
+    36,
+    31,
+    32,
+    25,
+    37,
+    45,
+    37,
+    36,
+    40,
+    36,
+    30,
+    40,
+    40,
+    35,
+    44,
+    37,
+    45,
+    41,
+    42,
+    37,
+    41,
+    40,
+    51,
+    45,
+    50,
+    44,
+    49,
+    46,
+    80,
+    68,
+    63,
+    64,
+    55,
+    58,
+    62,
+    72,
+    83,
+    63,
+    74,
+    75,
+    84,
+    69,
+    73,
+    93,
+    85,
+    75,
+    74,
+    84,
+    74,
+    69,
+    84,
+    95,
+    85,
+    84,
+    94,
+    68,
+    80,
+    102,
+    83,
+    92,
+    93,
+    104,
+    94,
+    93,
+    110,
+    89,
+    85,
+    95,
+    81,
+    96,
+    86,
+    96,
+    89,
+    98,
+    97,
+    95,
+    94,
+    104,
+    90,
+    106,
+    100,
+    105,
+    99,
+    96,
+    98,
+    98,
+    95,
+    97,
+    114,
+    106,
+    105,
+    113,
+    72,
+    135,
+    92,
+    102,
+    116,
+    117,
+    98,
+    109,
+    105,
+    101,
+    100,
+    115,
+    92,
+    124,
+    110,
+    106,
+    114,
+    115,
+    104,
+    111,
+    107,
+    108,
+    97,
+    107,
+    118,
+    112,
+    108,
+    107,
+    120,
+    111,
+    110,
+    125,
+    109,
+    108,
+    112,
+    109,
+    112,
+    113,
+    26,
+    156,
+    154,
+    11,
+    123,
+    129,
+    116,
+    115,
+    118,
+    111,
+    120,
+    157,
+    117,
+    116,
+    139,
+    116,
+    129,
+    139,
+    128,
+    121,
+    112,
+    127,
+    137,
+    128,
+    127,
+    132,
+    119,
+    118,
+    126,
+    126,
+    120,
+    130,
+    129,
+    123,
+    134,
+    127,
+    119,
+    132,
+    122,
+    121,
+    133,
+    141,
+    125,
+    124,
+    140,
+    128,
+    137,
+    133,
+    142,
+    143,
+    132,
+    131,
+    125,
+    141,
+    130,
+    122,
+    138,
+    134,
+    139,
+    129,
+    146,
+    132,
+    126,
+    131,
+    146,
+    134,
+    145,
+    153,
+    154,
+    146,
+    145,
+    132,
+    136,
+    137,
+    138,
+    133,
+    144,
+    138,
+    148,
+    145,
+    142,
+    130,
+    149,
+    139,
+    156,
+    157,
+    150,
+    151,
+    143,
+    142,
+    146,
+    154,
+    156,
+    147,
+    144,
+    136,
+    151,
+    136,
+    143,
+    151,
+    0,
+    141,
+    140,
+    3,
+    144,
+    147,
+    152,
+    148,
+    144,
+    152,
+    141,
+    0,
+    149,
+    148,
+    2,
+    153,
+    151,
+    1,
+    147,
+    152,
+    8,
+    2,
+    154,
+    153,
+    155,
+    24,
+    29,
+    34,
+    43,
+    39,
+    29,
+    43,
+    48,
+    39,
+    39,
+    48,
+    49,
+    56,
+    57,
+    48,
+    62,
+    83,
+    54,
+    56,
+    83,
+    73,
+    23,
+    43,
+    29,
+    34,
+    29,
+    39,
+    44,
+    35,
+    34,
+    39,
+    39,
+    49,
+    44,
+    43,
+    56,
+    48,
+    49,
+    48,
+    57,
+    49,
+    57,
+    58,
+    69,
+    57,
+    56,
+    73,
+    54,
+    83,
+    56,
+    38,
+    53,
+    67,
+    67,
+    80,
+    46,
+    64,
+    76,
+    77,
+    70,
+    78,
+    65,
+    65,
+    78,
+    71,
+    77,
+    82,
+    70,
+    82,
+    87,
+    78,
+    71,
+    88,
+    79,
+    79,
+    88,
+    91,
+    81,
+    85,
+    89,
+    81,
+    86,
+    82,
+    86,
+    90,
+    87,
+    91,
+    100,
+    101,
+    46,
+    33,
+    38,
+    58,
+    55,
+    50,
+    49,
+    38,
+    42,
+    53,
+    53,
+    41,
+    52,
+    38,
+    67,
+    46,
+    53,
+    52,
+    61,
+    53,
+    61,
+    66,
+    67,
+    53,
+    66,
+    55,
+    59,
+    51,
+    50,
+    60,
+    52,
+    51,
+    59,
+    52,
+    60,
+    61,
+    61,
+    65,
+    66,
+    70,
+    60,
+    59,
+    64,
+    59,
+    55,
+    64,
+    65,
+    61,
+    60,
+    70,
+    79,
+    66,
+    65,
+    71,
+    64,
+    77,
+    70,
+    75,
+    76,
+    64,
+    63,
+    67,
+    66,
+    79,
+    67,
+    79,
+    80,
+    87,
+    88,
+    71,
+    78,
+    70,
+    82,
+    78,
+    77,
+    81,
+    82,
+    102,
+    80,
+    79,
+    91,
+    85,
+    81,
+    76,
+    75,
+    77,
+    76,
+    81,
+    82,
+    86,
+    87,
+    88,
+    87,
+    90,
+    88,
+    90,
+    100,
+    91,
+    88,
+    100,
+    91,
+    101,
+    102,
+    5,
+    6,
+    1,
+    0,
+    3,
+    13,
+    4,
+    14,
+    5,
+    12,
+    28,
+    3,
+    28,
+    23,
+    13,
+    9,
+    16,
+    22,
+    23,
+    29,
+    13,
+    28,
+    43,
+    23,
+    28,
+    62,
+    54,
+    43,
+    54,
+    56,
+    150,
+    4,
+    5,
+    1,
+    7,
+    147,
+    149,
+    0,
+    4,
+    14,
+    10,
+    6,
+    5,
+    1,
+    6,
+    7,
+    4,
+    0,
+    13,
+    4,
+    13,
+    14,
+    15,
+    7,
+    6,
+    10,
+    16,
+    8,
+    7,
+    15,
+    3,
+    28,
+    13,
+    15,
+    21,
+    16,
+    12,
+    62,
+    28,
+    28,
+    54,
+    43,
+    12,
+    3,
+    140,
+    135,
+    8,
+    152,
+    147,
+    7,
+    151,
+    150,
+    5,
+    1,
+    151,
+    5,
+    150,
+    149,
+    4,
+};
+constexpr object sphere_objects[] = {
+    {{nullptr, 0}, {sphere_0_vertices, 158}, {3.053982800338417e-05f, 3.0518509447574615e-05f, 3.0544204491889104e-05f}, {-0.00017648935317993164f, 0.0f, 0.0010599792003631592f}, {sphere_0_normals, 268}, {sphere_0_faces, 268}, {sphere_0_indices, 848}, {{-1.0009055137634277f, -1.000030517578125f, -0.9998124837875366f}, {1.0005526542663574f, 1.000030517578125f, 1.0019325017929077f}, {-0.00017648935317993164f, 0.0f, 0.0010599792003631592f}, 1.009665608406067f}},
+};
+constexpr material sphere_materials[] = {
+    {{25.006498336791992f, 200.0f, 35.12525177001953f}},
+    {{200.0f, 180.67950439453125f, 23.162498474121094f}},
+    {{200.0f, 16.17275047302246f, 22.012500762939453f}},
+    {{27.083999633789062f, 60.054500579833984f, 200.0f}},
+};
+constexpr m3::vec3 sphere_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+constexpr scene sphere_scene = {{sphere_objects, 1}, {sphere_materials, 4}, {sphere_lights, 3}, {{-10.0f, 10.0f, -15.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(sphere_scene));
 
-newmtl Material.001
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.045155 0.054261
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-)X"},{.name = "sphere", .scene = R"X(# path to .obj file
-o models/sphere.obj
+constexpr quantized_vertex spheres_0_vertices[] = {
+    {-3515, 27485, -17731},
+    {-2879, -269, -32767},
+    {-2421, -18441, -27088},
+    {-960, 30298, -12749},
+    {2534, 20584, -25704},
+    {1902, 9892, -31436},
+    {6938, 3228, -32024},
+    {3135, -6460, -32132},
+    {2920, -12644, -30242},
+    {7991, -17972, -26356},
+    {12511, 3221, -30221},
+    {5404, -27228, -17538},
+    {659, 32165, -6665},
+    {8934, 25521, -18994},
+    {12620, 15967, -26044},
+    {15861, -2915, -28834},
+    {14040, -12418, -27014},
+    {12567, -23543, -19411},
+    {18970, 12838, -23582},
+    {20396, 6973, -24876},
+    {25789, 0, -20445},
+    {20656, -6703, -24698},
+    {17450, -18444, -20912},
+    {13032, 27350, -12838},
+    {22497, 16491, -17644},
+    {23124, -12622, -19693},
+    {6859, -30354, -10837},
+    {6, 32767, -35},
+    {9867, 30568, -7756},
+    {19038, 23509, -13055},
+    {28436, 6460, -15266},
+    {28436, -6460, -15266},
+    {22781, -20749, -11803},
+    {14487, -27357, -11427},
+    {26257, 18283, -7497},
+    {28889, 12622, -9351},
+    {31638, 0, -9026},
+    {30087, -10376, -8868},
+    {18182, -27418, 240},
+    {25048, 21428, -1689},
+    {32767, 3785, -2147},
+    {30256, -12622, 2410},
+    {25407, -20937, -2399},
+    {18073, 27590, -1490},
+    {30256, 12622, 2410},
+    {32108, -6460, 3094},
+    {12611, -30446, -308},
+    {5521, -32274, -3720},
+    {22323, 23222, 6309},
+    {27087, 16288, 9306},
+    {30880, 6460, 9296},
+    {31303, 0, 10061},
+    {29304, -9561, 11473},
+    {24378, -20937, 7500},
+    {12123, 30298, 3939},
+    {24959, 6460, 20399},
+    {14954, 27329, 10499},
+    {19639, 20937, 16252},
+    {23800, 12622, 18801},
+    {25057, 0, 21267},
+    {24959, -6460, 20399},
+    {22577, -15579, 18364},
+    {6479, 32322, 808},
+    {16179, 15530, 24044},
+    {17727, 3228, 27487},
+    {16179, -15530, 24044},
+    {16849, -23356, 15989},
+    {13813, -27462, 11961},
+    {3140, -32212, 5828},
+    {9434, 23356, 21214},
+    {15239, -6460, 28391},
+    {7469, -18283, 26213},
+    {-835, 32165, 6535},
+    {6582, 27329, 17028},
+    {7469, 18283, 26213},
+    {9323, 12622, 28844},
+    {9400, 6460, 30817},
+    {8999, 0, 31593},
+    {9323, -12622, 28844},
+    {6266, -25484, 19934},
+    {7364, -30354, 10430},
+    {-3053, 2436, 32767},
+    {3199, -6460, 32056},
+    {3366, 30568, 12030},
+    {-2630, 20937, 25336},
+    {-2439, 12622, 30211},
+    {-9326, -6460, 30835},
+    {-2439, -12622, 30211},
+    {-2630, -20937, 25336},
+    {-9326, 6460, 30835},
+    {-12976, -16104, 25712},
+    {-4007, -27330, 17805},
+    {-8303, 30298, 9638},
+    {-5705, 27357, 17482},
+    {-12140, 20937, 22396},
+    {-13829, 12622, 26973},
+    {-16003, 0, 28688},
+    {-23113, 12622, 19624},
+    {-21666, 3785, 24621},
+    {-18679, -10270, 25126},
+    {-12426, -23356, 19609},
+    {-13244, -27330, 12570},
+    {-4566, -30446, 11713},
+    {6, -32767, -35},
+    {-19801, 20937, 16041},
+    {-24906, -6460, 20449},
+    {-22808, -16288, 17289},
+    {-26576, 15746, 11348},
+    {-28424, 6460, 15196},
+    {-29264, 0, 14954},
+    {-16130, 27590, 8223},
+    {-22032, 23319, 6845},
+    {-32767, 2436, 3365},
+    {-30850, -6460, 9358},
+    {-27834, -15579, 8508},
+    {-21246, -23356, 9393},
+    {-14500, -29276, 4535},
+    {-4990, -32165, 4315},
+    {-28966, 15579, 2913},
+    {-32096, 6460, -3163},
+    {-23121, 23222, -1903},
+    {-31298, -10270, -1590},
+    {-25968, -18283, -8413},
+    {-24908, -21504, -1466},
+    {-12599, 30446, -308},
+    {-17953, 27257, -3948},
+    {-27889, 15579, -8397},
+    {-31292, 0, -10130},
+    {-30869, -6460, -9365},
+    {-17953, -27257, -3948},
+    {-19641, 23356, -12465},
+    {-24152, 15530, -16092},
+    {-28408, 3785, -16477},
+    {-27006, -12622, -13867},
+    {-20645, -23222, -10610},
+    {-6509, 32306, -676},
+    {-20408, 0, -25814},
+    {-24947, -6460, -20468},
+    {-20784, -18283, -17713},
+    {-11789, -30408, -4705},
+    {-8702, 30295, -9185},
+    {-12799, 27350, -13059},
+    {-18541, 15579, -22483},
+    {-20481, 6460, -24943},
+    {-19668, -10376, -24441},
+    {-15026, -23222, -17707},
+    {-12653, -27418, -13079},
+    {-9388, -6460, -30886},
+    {-12435, -18283, -24322},
+    {-9129, 23543, -21242},
+    {-8538, 15578, -27871},
+    {-9847, 4164, -31243},
+    {-9024, -12842, -28939},
+    {-7118, -23222, -22113},
+    {-3360, -27403, -17867},
+    {1875, -23222, -23158},
+    {-3844, -30340, -12105},
+    {-4827, -32262, -4577},
+};
+constexpr m3::vec3 spheres_0_normals[] = {
+    {0.03840000182390213f, -0.8023999929428101f, -0.5954999923706055f},
+    {0.03449999913573265f, 0.11389999836683273f, -0.992900013923645f},
+    {0.008799999952316284f, -0.9927999973297119f, -0.11959999799728394f},
+    {0.08110000193119049f, 0.8497999906539917f, -0.5209000110626221f},
+    {0.08320000022649765f, -0.5346999764442444f, -0.8409000039100647f},
+    {0.22310000658035278f, -0.6836000084877014f, -0.6948999762535095f},
+    {0.17960000038146973f, 0.45680001378059387f, -0.8712000250816345f},
+    {0.12470000237226486f, 0.9387999773025513f, -0.32109999656677246f},
+    {0.2295999974012375f, 0.8806999921798706f, -0.4142000079154968f},
+    {0.4034999907016754f, -0.5285000205039978f, -0.7469000220298767f},
+    {0.3037000000476837f, -0.8294000029563904f, -0.46889999508857727f},
+    {0.6434999704360962f, 0.011300000362098217f, -0.7653999924659729f},
+    {0.07900000363588333f, 0.9934999942779541f, -0.08240000158548355f},
+    {0.5770000219345093f, -0.37380000948905945f, -0.7261999845504761f},
+    {0.448199987411499f, 0.7305999994277954f, -0.5151000022888184f},
+    {0.760200023651123f, -0.1875f, -0.6220999956130981f},
+    {0.6622999906539917f, -0.536300003528595f, -0.5231000185012817f},
+    {0.5511000156402588f, -0.6733999848365784f, -0.4927000105381012f},
+    {0.3450999855995178f, -0.9178000092506409f, -0.1965000033378601f},
+    {0.8901000022888184f, 0.0007999999797903001f, -0.45590001344680786f},
+    {0.8113999962806702f, -0.3815000057220459f, -0.44269999861717224f},
+    {0.483599990606308f, 0.8438000082969666f, -0.23270000517368317f},
+    {0.7145000100135803f, 0.5940999984741211f, -0.3695000112056732f},
+    {0.8241999745368958f, -0.5127999782562256f, -0.24040000140666962f},
+    {0.6444000005722046f, 0.7365000247955322f, -0.20589999854564667f},
+    {0.9429000020027161f, 0.19210000336170197f, -0.2721000015735626f},
+    {0.9330999851226807f, -0.1446000039577484f, -0.32919999957084656f},
+    {0.3605000078678131f, 0.9315000176429749f, -0.04800000041723251f},
+    {0.8377000093460083f, -0.5392000079154968f, 0.08699999749660492f},
+    {0.6617000102996826f, 0.7475000023841858f, 0.05779999867081642f},
+    {0.7886000275611877f, 0.6000999808311462f, 0.1340000033378601f},
+    {0.9695000052452087f, 0.21969999372959137f, 0.10849999636411667f},
+    {0.986299991607666f, 0.08160000294446945f, 0.14350000023841858f},
+    {0.22120000422000885f, -0.9732999801635742f, 0.061400000005960464f},
+    {0.11159999668598175f, -0.9932000041007996f, 0.03420000150799751f},
+    {0.9523000121116638f, -0.16099999845027924f, 0.2590999901294708f},
+    {0.9319000244140625f, -0.30250000953674316f, 0.19990000128746033f},
+    {0.5220000147819519f, 0.8389000296592712f, 0.15399999916553497f},
+    {0.5764999985694885f, -0.7890999913215637f, 0.21199999749660492f},
+    {0.5953999757766724f, 0.7329999804496765f, 0.32899999618530273f},
+    {0.36469998955726624f, -0.9122999906539917f, 0.1860000044107437f},
+    {0.2240999937057495f, 0.9514999985694885f, 0.21080000698566437f},
+    {0.4564000070095062f, 0.6233999729156494f, 0.6348999738693237f},
+    {0.6126000285148621f, 0.49559998512268066f, 0.6155999898910522f},
+    {0.29499998688697815f, 0.8773999810218811f, 0.3783000111579895f},
+    {0.3982999920845032f, 0.08510000258684158f, 0.9132999777793884f},
+    {0.05550000071525574f, 0.9936000108718872f, 0.09799999743700027f},
+    {0.43140000104904175f, -0.35339999198913574f, 0.8299999833106995f},
+    {0.35280001163482666f, -0.48730000853538513f, 0.798799991607666f},
+    {0.3643999993801117f, 0.5784000158309937f, 0.7297999858856201f},
+    {0.28600001335144043f, -0.18950000405311584f, 0.939300000667572f},
+    {0.1071000024676323f, -0.374099999666214f, 0.9211999773979187f},
+    {0.02160000056028366f, 0.8454999923706055f, 0.5335000157356262f},
+    {0.11010000109672546f, -0.6639000177383423f, 0.7396000027656555f},
+    {0.003000000026077032f, -0.7628999948501587f, 0.6464999914169312f},
+    {-0.13570000231266022f, 0.24899999797344208f, 0.958899974822998f},
+    {-0.09600000083446503f, -0.1462000012397766f, 0.9846000075340271f},
+    {-0.0917000025510788f, 0.9352999925613403f, 0.3418000042438507f},
+    {-0.25589999556541443f, -0.3765000104904175f, 0.8903999924659729f},
+    {-0.20589999854564667f, 0.7168999910354614f, 0.666100025177002f},
+    {-0.04820000007748604f, -0.9722999930381775f, 0.22849999368190765f},
+    {-0.29910001158714294f, -0.008200000040233135f, 0.954200029373169f},
+    {-0.025800000876188278f, -0.9937999844551086f, 0.10769999772310257f},
+    {-0.47429999709129333f, 0.19210000336170197f, 0.8590999841690063f},
+    {-0.4569999873638153f, -0.18299999833106995f, 0.8705000281333923f},
+    {-0.4020000100135803f, -0.30640000104904175f, 0.8628000020980835f},
+    {-0.28119999170303345f, -0.8216000199317932f, 0.4959000051021576f},
+    {-0.36340001225471497f, 0.8264999985694885f, 0.4300000071525574f},
+    {-0.5640000104904175f, -0.4844000041484833f, 0.6687999963760376f},
+    {-0.07819999754428864f, 0.9936000108718872f, 0.08089999854564667f},
+    {-0.301800012588501f, -0.9147999882698059f, 0.2685999870300293f},
+    {-0.7623000144958496f, 0.21969999372959137f, 0.6087999939918518f},
+    {-0.7989000082015991f, 0.08160000294446945f, 0.5958999991416931f},
+    {-0.6899999976158142f, -0.35109999775886536f, 0.6328999996185303f},
+    {-0.5631999969482422f, -0.6682000160217285f, 0.4862000048160553f},
+    {-0.6022999882698059f, 0.7250999808311462f, 0.33379998803138733f},
+    {-0.5130000114440918f, -0.8125f, 0.2768000066280365f},
+    {-0.7181000113487244f, 0.4964999854564667f, 0.4876999855041504f},
+    {-0.8654999732971191f, -0.18950000405311584f, 0.46369999647140503f},
+    {-0.2816999852657318f, 0.9498000144958496f, 0.13580000400543213f},
+    {-0.7785999774932861f, 0.5917999744415283f, 0.20890000462532043f},
+    {-0.8686000108718872f, -0.49399998784065247f, 0.03840000182390213f},
+    {-0.7626000046730042f, -0.6292999982833862f, 0.14990000426769257f},
+    {-0.9573000073432922f, 0.27959999442100525f, 0.0737999975681305f},
+    {-0.1120000034570694f, -0.9937000274658203f, 0.008799999952316284f},
+    {-0.9843999743461609f, -0.15000000596046448f, 0.09239999949932098f},
+    {-0.9341999888420105f, -0.32330000400543213f, 0.15070000290870667f},
+    {-0.5393000245094299f, 0.8400999903678894f, 0.05779999867081642f},
+    {-0.9941999912261963f, -0.008200000040233135f, -0.10719999670982361f},
+    {-0.8644999861717224f, -0.49320000410079956f, -0.0966000035405159f},
+    {-0.8148000240325928f, 0.5745999813079834f, -0.07760000228881836f},
+    {-0.7096999883651733f, -0.6743000149726868f, -0.20419999957084656f},
+    {-0.9192000031471252f, 0.24940000474452972f, -0.30469998717308044f},
+    {-0.8916000127792358f, -0.38530001044273376f, -0.2379000037908554f},
+    {-0.651199996471405f, 0.7305999994277954f, -0.2053000032901764f},
+    {-0.2969000041484833f, 0.9435999989509583f, -0.14640000462532043f},
+    {-0.7390999794006348f, -0.5328999757766724f, -0.41190001368522644f},
+    {-0.7278000116348267f, 0.5855000019073486f, -0.3569999933242798f},
+    {-0.5127000212669373f, -0.8105000257492065f, -0.2833000123500824f},
+    {-0.6064000129699707f, 0.5946999788284302f, -0.527899980545044f},
+    {-0.7402999997138977f, 0.08160000294446945f, -0.6672999858856201f},
+    {-0.7195000052452087f, -0.3815000057220459f, -0.5802000164985657f},
+    {-0.5782999992370605f, -0.6751999855041504f, -0.4578999876976013f},
+    {-0.6611999869346619f, -0.1446000039577484f, -0.7361000180244446f},
+    {-0.5370000004768372f, -0.5016999840736389f, -0.6782000064849854f},
+    {-0.45980000495910645f, 0.7084000110626221f, -0.5354999899864197f},
+    {-0.2703000009059906f, -0.9153000116348267f, -0.2985999882221222f},
+    {-0.06069999933242798f, 0.9934999942779541f, -0.09610000252723694f},
+    {-0.35910001397132874f, -0.6751999855041504f, -0.6442999839782715f},
+    {-0.3889000117778778f, 0.5723999738693237f, -0.7218999862670898f},
+    {-0.23180000483989716f, -0.541100025177002f, -0.8083999752998352f},
+    {-0.0421999990940094f, 0.47429999709129333f, -0.8794000148773193f},
+    {-0.09709999710321426f, -0.19460000097751617f, -0.9761000275611877f},
+    {-0.07890000194311142f, 0.7235999703407288f, -0.685699999332428f},
+    {-0.08489999920129776f, -0.6773999929428101f, -0.7307000160217285f},
+    {0.02410000003874302f, -0.9679999947547913f, -0.25f},
+    {0.29100000858306885f, 0.29739999771118164f, -0.9093000292778015f},
+    {0.08299999684095383f, -0.02160000056028366f, -0.9962999820709229f},
+    {0.058800000697374344f, 0.7767000198364258f, -0.6270999908447266f},
+    {0.08309999853372574f, -0.5874999761581421f, -0.8050000071525574f},
+    {0.2671000063419342f, 0.6370000243186951f, -0.7231000065803528f},
+    {0.20600000023841858f, -0.7314000129699707f, -0.6500999927520752f},
+    {0.28290000557899475f, -0.08540000021457672f, -0.955299973487854f},
+    {0.29260000586509705f, -0.25600001215934753f, -0.9212999939918518f},
+    {0.4519999921321869f, 0.28110000491142273f, -0.8464999794960022f},
+    {0.16910000145435333f, 0.8938999772071838f, -0.41510000824928284f},
+    {0.2637999951839447f, -0.3921000063419342f, -0.8812999725341797f},
+    {0.5081999897956848f, -0.2551000118255615f, -0.8226000070571899f},
+    {0.38440001010894775f, -0.5800999999046326f, -0.7182000279426575f},
+    {0.2946000099182129f, -0.8400999903678894f, -0.4555000066757202f},
+    {0.48179998993873596f, 0.633400022983551f, -0.6054999828338623f},
+    {0.5266000032424927f, 0.0966000035405159f, -0.8446000218391418f},
+    {0.7355999946594238f, 0.2994999885559082f, -0.6075999736785889f},
+    {0.5234000086784363f, 0.5512999892234802f, -0.6496999859809875f},
+    {0.6474999785423279f, -0.012299999594688416f, -0.7620000243186951f},
+    {0.15299999713897705f, 0.9782999753952026f, -0.1396999955177307f},
+    {0.5684999823570251f, -0.4043000042438507f, -0.7164999842643738f},
+    {0.7573000192642212f, -0.20800000429153442f, -0.6190999746322632f},
+    {0.5385000109672546f, -0.7027999758720398f, -0.4648999869823456f},
+    {0.6104000210762024f, -0.7684999704360962f, -0.19220000505447388f},
+    {0.7580000162124634f, 0.1898999959230423f, -0.6240000128746033f},
+    {0.7860999703407288f, 0.4893999993801117f, -0.3776000142097473f},
+    {0.8108000159263611f, 0.3734000027179718f, -0.4507000148296356f},
+    {0.3287999927997589f, -0.9254999756813049f, -0.18770000338554382f},
+    {0.8901000022888184f, -0.0007999999797903001f, -0.45590001344680786f},
+    {0.7937999963760376f, -0.4408000111579895f, -0.41909998655319214f},
+    {0.515500009059906f, 0.8206999897956848f, -0.24629999697208405f},
+    {0.6815000176429749f, 0.6935999989509583f, -0.23340000212192535f},
+    {0.9847999811172485f, -0.13439999520778656f, -0.10970000177621841f},
+    {0.4832000136375427f, -0.8611999750137329f, -0.1574999988079071f},
+    {0.9408000111579895f, 0.20730000734329224f, -0.26829999685287476f},
+    {0.9398000240325928f, 0.32359999418258667f, -0.10920000076293945f},
+    {0.8812999725341797f, 0.46380001306533813f, -0.0908999964594841f},
+    {0.9574000239372253f, -0.2800999879837036f, -0.07010000199079514f},
+    {0.37450000643730164f, 0.9258000254631042f, -0.05090000107884407f},
+    {0.8840000033378601f, -0.45570001006126404f, -0.1039000004529953f},
+    {0.8478000164031982f, 0.3057999908924103f, 0.4332999885082245f},
+    {0.6800000071525574f, -0.7297999858856201f, 0.0706000030040741f},
+    {0.8360000252723694f, 0.5400000214576721f, 0.09719999879598618f},
+    {0.9929999709129333f, -0.003599999938160181f, 0.11789999902248383f},
+    {0.9077000021934509f, 0.35030001401901245f, 0.23090000450611115f},
+    {0.85589998960495f, -0.4560999870300293f, 0.24379999935626984f},
+    {0.5483999848365784f, 0.8206999897956848f, 0.16050000488758087f},
+    {0.4577000141143799f, -0.873199999332428f, 0.16740000247955322f},
+    {0.8001000285148621f, -0.4747999906539917f, 0.3666999936103821f},
+    {0.6669999957084656f, -0.6184999942779541f, 0.4153999984264374f},
+    {0.7031000256538391f, 0.6277999877929688f, 0.33390000462532043f},
+    {0.5909000039100647f, -0.7439000010490417f, 0.31209999322891235f},
+    {0.7355999946594238f, 0.5063999891281128f, 0.44999998807907104f},
+    {0.8738999962806702f, 0.09560000151395798f, 0.4765999913215637f},
+    {0.2678000032901764f, -0.9534000158309937f, 0.13899999856948853f},
+    {0.8744000196456909f, -0.09839999675750732f, 0.47510001063346863f},
+    {0.40560001134872437f, 0.76910001039505f, 0.49390000104904175f},
+    {0.8025000095367432f, -0.32199999690055847f, 0.5023000240325928f},
+    {0.29260000586509705f, 0.9124000072479248f, 0.28619998693466187f},
+    {0.6074000000953674f, 0.29109999537467957f, 0.7390999794006348f},
+    {0.5372999906539917f, -0.5824000239372253f, 0.6100000143051147f},
+    {0.6261000037193298f, -0.09860000014305115f, 0.7735000252723694f},
+    {0.6705999970436096f, 0.10890000313520432f, 0.7337999939918518f},
+    {0.6158000230789185f, -0.30410000681877136f, 0.7268999814987183f},
+    {0.374099999666214f, -0.6473000049591064f, 0.6640999913215637f},
+    {0.43380001187324524f, -0.027300000190734863f, 0.900600016117096f},
+    {0.12559999525547028f, 0.9743000268936157f, 0.18700000643730164f},
+    {0.4569000005722046f, 0.2872999906539917f, 0.8417999744415283f},
+    {0.3513999879360199f, -0.7753999829292297f, 0.5246999859809875f},
+    {0.35280001163482666f, 0.48730000853538513f, 0.798799991607666f},
+    {0.26840001344680786f, -0.8445000052452087f, 0.4634000062942505f},
+    {0.0778999999165535f, -0.48080000281333923f, 0.8733000159263611f},
+    {0.2851000130176544f, -0.20499999821186066f, 0.9362999796867371f},
+    {0.09430000185966492f, -0.013299999758601189f, 0.9955000281333923f},
+    {0.04490000009536743f, 0.767300009727478f, 0.6396999955177307f},
+    {0.0778999999165535f, 0.48080000281333923f, 0.8733000159263611f},
+    {0.11389999836683273f, 0.6747999787330627f, 0.7290999889373779f},
+    {0.060100000351667404f, -0.8877999782562256f, 0.4562999904155731f},
+    {0.08789999783039093f, 0.26350000500679016f, 0.9606999754905701f},
+    {-0.24619999527931213f, 0.4959000051021576f, 0.8327999711036682f},
+    {0.043699998408555984f, -0.9397000074386597f, 0.3391000032424927f},
+    {0.11860000342130661f, 0.11129999905824661f, 0.9866999983787537f},
+    {-0.0949999988079071f, -0.20499999821186066f, 0.9740999937057495f},
+    {-0.09870000183582306f, 0.9207000136375427f, 0.3776000142097473f},
+    {-0.19910000264644623f, -0.4925000071525574f, 0.8471999764442444f},
+    {-0.2687999904155731f, -0.6323999762535095f, 0.7265999913215637f},
+    {-0.20309999585151672f, -0.7281000018119812f, 0.654699981212616f},
+    {-0.40369999408721924f, 0.7793999910354614f, 0.47920000553131104f},
+    {-0.25360000133514404f, 0.374099999666214f, 0.8920000195503235f},
+    {-0.30140000581741333f, 0.005499999970197678f, 0.953499972820282f},
+    {-0.259799987077713f, -0.8500000238418579f, 0.45829999446868896f},
+    {-0.4754999876022339f, 0.20730000734329224f, 0.8550000190734863f},
+    {-0.5461000204086304f, 0.4959000051021576f, 0.6751999855041504f},
+    {-0.5284000039100647f, -0.5699999928474426f, 0.6291999816894531f},
+    {-0.6323999762535095f, -0.10700000077486038f, 0.7671999931335449f},
+    {-0.5873000025749207f, 0.32359999418258667f, 0.7418000102043152f},
+    {-0.8341000080108643f, -0.3203999996185303f, 0.4489000141620636f},
+    {-0.1770000010728836f, 0.9714000225067139f, 0.1581999957561493f},
+    {-0.2775999903678894f, -0.932200014591217f, 0.23240000009536743f},
+    {-0.7856000065803528f, -0.003599999938160181f, 0.6187999844551086f},
+    {-0.534500002861023f, -0.7081000208854675f, 0.46140000224113464f},
+    {-0.34869998693466187f, 0.9226999878883362f, 0.16429999470710754f},
+    {-0.7289000153541565f, -0.5756000280380249f, 0.37059998512268066f},
+    {-0.7077999711036682f, 0.6230999827384949f, 0.3330000042915344f},
+    {-0.8065000176429749f, 0.3562999963760376f, 0.4717999994754791f},
+    {-0.9265000224113464f, 0.2815000116825104f, 0.24959999322891235f},
+    {-0.5960000157356262f, 0.8001999855041504f, 0.06650000065565109f},
+    {-0.944599986076355f, 0.11129999905824661f, 0.30880001187324524f},
+    {-0.9578999876976013f, -0.013299999758601189f, 0.2867000102996826f},
+    {0.04349999874830246f, -0.8971999883651733f, -0.43950000405311584f},
+    {-0.6233000159263611f, -0.7785000205039978f, 0.07360000163316727f},
+    {-0.7634999752044678f, 0.6396999955177307f, 0.08799999952316284f},
+    {-0.27639999985694885f, -0.9607999920845032f, 0.021199999377131462f},
+    {-0.45719999074935913f, -0.8889999985694885f, -0.025299999862909317f},
+    {-0.9926000237464905f, -0.07750000059604645f, -0.09390000253915787f},
+    {-0.8769000172615051f, -0.1137000024318695f, -0.46700000762939453f},
+    {-0.9225999712944031f, 0.37549999356269836f, -0.08789999783039093f},
+    {-0.7251999974250793f, 0.6488000154495239f, -0.23070000112056732f},
+    {-0.6633999943733215f, -0.7281000018119812f, -0.17249999940395355f},
+    {-0.9312999844551086f, 0.20730000734329224f, -0.2996000051498413f},
+    {-0.8895999789237976f, -0.39100000262260437f, -0.2361000031232834f},
+    {-0.4097000062465668f, 0.8880000114440918f, -0.20900000631809235f},
+    {-0.8636999726295471f, -0.20499999821186066f, -0.46050000190734863f},
+    {-0.7317000031471252f, 0.30090001225471497f, -0.6115999817848206f},
+    {-0.5020999908447266f, 0.8197000026702881f, -0.27559998631477356f},
+    {-0.707099974155426f, -0.5871000289916992f, -0.39410001039505005f},
+    {-0.4645000100135803f, -0.8482000231742859f, -0.25459998846054077f},
+    {-0.8507999777793884f, 0.3221000134944916f, -0.41510000824928284f},
+    {-0.5199000239372253f, -0.7484999895095825f, -0.4115999937057495f},
+    {-0.2897000014781952f, -0.788100004196167f, -0.5432000160217285f},
+    {-0.7601000070571899f, -0.003599999938160181f, -0.6498000025749207f},
+    {-0.7146999835968018f, -0.392300009727478f, -0.5791000127792358f},
+    {-0.5024999976158142f, -0.5871000289916992f, -0.6347000002861023f},
+    {-0.486299991607666f, 0.6636999845504761f, -0.5683000087738037f},
+    {-0.24310000240802765f, -0.9318000078201294f, -0.2694999873638153f},
+    {-0.4424000084400177f, 0.3093999922275543f, -0.8417999744415283f},
+    {-0.23389999568462372f, -0.858299970626831f, -0.45669999718666077f},
+    {-0.4634000062942505f, -0.09910000115633011f, -0.8805999755859375f},
+    {-0.4887000024318695f, 0.1111999973654747f, -0.8652999997138977f},
+    {-0.1331000030040741f, 0.9660000205039978f, -0.22179999947547913f},
+    {-0.20909999310970306f, 0.8842999935150146f, -0.4174000024795532f},
+    {-0.4284999966621399f, -0.28610000014305115f, -0.8571000099182129f},
+    {-0.09679999947547913f, -0.29190000891685486f, -0.9514999985694885f},
+    {-0.4339999854564667f, -0.4092999994754791f, -0.8026000261306763f},
+    {-0.26429998874664307f, 0.8238000273704529f, -0.5015000104904175f},
+    {-0.22380000352859497f, -0.5888000130653381f, -0.7767000198364258f},
+    {-0.2395000010728836f, -0.0430000014603138f, -0.9699000120162964f},
+    {-0.1599999964237213f, 0.29679998755455017f, -0.9415000081062317f},
+    {-0.10199999809265137f, 0.17640000581741333f, -0.9789999723434448f},
+    {-0.09229999780654907f, -0.4092999994754791f, -0.9077000021934509f},
+    {-0.1339000016450882f, 0.6284000277519226f, -0.7663000226020813f},
+    {-0.0771000012755394f, -0.7440000176429749f, -0.6636999845504761f},
+};
+constexpr face spheres_0_faces[] = {
+    {0, 3, 0, 0},
+    {3, 3, 0, 2},
+    {6, 3, 0, 4},
+    {9, 3, 0, 5},
+    {12, 3, 0, 10},
+    {15, 3, 0, 11},
+    {18, 3, 0, 12},
+    {21, 3, 0, 13},
+    {24, 3, 0, 15},
+    {27, 3, 0, 16},
+    {30, 3, 0, 17},
+    {33, 3, 0, 18},
+    {36, 3, 0, 19},
+    {39, 3, 0, 20},
+    {42, 3, 0, 23},
+    {45, 3, 0, 25},
+    {48, 3, 0, 26},
+    {51, 3, 0, 28},
+    {54, 3, 0, 31},
+    {57, 3, 0, 32},
+    {60, 3, 0, 33},
+    {63, 3, 0, 34},
+    {66, 3, 0, 35},
+    {69, 3, 0, 36},
+    {72, 3, 0, 42},
+    {75, 3, 0, 43},
+    {78, 3, 0, 46},
+    {81, 3, 0, 49},
+    {84, 3, 0, 52},
+    {87, 3, 0, 57},
+    {90, 3, 0, 59},
+    {93, 3, 0, 60},
+    {96, 3, 0, 61},
+    {99, 3, 0, 62},
+    {102, 3, 0, 63},
+    {105, 3, 0, 64},
+    {108, 3, 0, 65},
+    {111, 3, 0, 67},
+    {114, 3, 0, 68},
+    {117, 3, 0, 69},
+    {120, 3, 0, 70},
+    {123, 3, 0, 71},
+    {126, 3, 0, 72},
+    {129, 3, 0, 73},
+    {132, 3, 0, 74},
+    {135, 3, 0, 75},
+    {138, 3, 0, 76},
+    {141, 3, 0, 77},
+    {144, 3, 0, 78},
+    {147, 3, 0, 79},
+    {150, 3, 0, 80},
+    {153, 3, 0, 81},
+    {156, 3, 0, 82},
+    {159, 3, 0, 83},
+    {162, 3, 0, 84},
+    {165, 3, 0, 85},
+    {168, 3, 0, 86},
+    {171, 3, 0, 87},
+    {174, 3, 0, 88},
+    {177, 3, 0, 89},
+    {180, 3, 0, 90},
+    {183, 3, 0, 91},
+    {186, 3, 0, 92},
+    {189, 3, 0, 93},
+    {192, 3, 0, 94},
+    {195, 3, 0, 95},
+    {198, 3, 0, 96},
+    {201, 3, 0, 97},
+    {204, 3, 0, 98},
+    {207, 3, 0, 99},
+    {210, 3, 0, 100},
+    {213, 3, 0, 101},
+    {216, 3, 0, 102},
+    {219, 3, 0, 103},
+    {222, 3, 0, 104},
+    {225, 3, 0, 105},
+    {228, 3, 0, 106},
+    {231, 3, 0, 107},
+    {234, 3, 0, 108},
+    {237, 3, 0, 109},
+    {240, 3, 0, 110},
+    {243, 3, 0, 114},
+    {246, 4, 0, 115},
+    {250, 3, 0, 119},
+    {253, 3, 0, 121},
+    {256, 4, 0, 124},
+    {260, 3, 0, 126},
+    {263, 3, 0, 128},
+    {266, 3, 0, 129},
+    {269, 4, 0, 130},
+    {273, 3, 0, 131},
+    {276, 4, 0, 132},
+    {280, 3, 0, 133},
+    {283, 3, 0, 134},
+    {286, 3, 0, 136},
+    {289, 3, 0, 137},
+    {292, 3, 0, 138},
+    {295, 4, 0, 139},
+    {299, 3, 0, 140},
+    {302, 3, 0, 141},
+    {305, 3, 0, 142},
+    {308, 3, 0, 143},
+    {311, 3, 0, 144},
+    {314, 3, 0, 145},
+    {317, 4, 0, 148},
+    {321, 3, 0, 150},
+    {324, 3, 0, 151},
+    {327, 3, 0, 153},
+    {330, 3, 0, 155},
+    {333, 3, 0, 159},
+    {336, 3, 0, 160},
+    {339, 3, 0, 170},
+    {342, 4, 0, 175},
+    {346, 3, 0, 182},
+    {349, 3, 0, 185},
+    {352, 4, 0, 190},
+    {356, 4, 0, 191},
+    {360, 3, 0, 192},
+    {363, 4, 0, 195},
+    {367, 3, 0, 196},
+    {370, 3, 0, 199},
+    {373, 4, 0, 203},
+    {377, 3, 0, 204},
+    {380, 3, 0, 205},
+    {383, 3, 0, 207},
+    {386, 4, 0, 208},
+    {390, 3, 0, 209},
+    {393, 4, 0, 210},
+    {397, 3, 0, 211},
+    {400, 4, 0, 212},
+    {404, 3, 0, 213},
+    {407, 3, 0, 214},
+    {410, 3, 0, 215},
+    {413, 3, 0, 216},
+    {416, 3, 0, 217},
+    {419, 3, 0, 218},
+    {422, 3, 0, 219},
+    {425, 3, 0, 220},
+    {428, 4, 0, 221},
+    {432, 4, 0, 222},
+    {436, 3, 0, 223},
+    {439, 3, 0, 224},
+    {442, 4, 0, 225},
+    {446, 4, 0, 226},
+    {450, 3, 0, 227},
+    {453, 4, 0, 228},
+    {457, 3, 0, 229},
+    {460, 4, 0, 230},
+    {464, 4, 0, 231},
+    {468, 3, 0, 232},
+    {471, 3, 0, 233},
+    {474, 3, 0, 234},
+    {477, 3, 0, 235},
+    {480, 3, 0, 236},
+    {483, 4, 0, 237},
+    {487, 3, 0, 238},
+    {490, 4, 0, 239},
+    {494, 3, 0, 240},
+    {497, 3, 0, 241},
+    {500, 3, 0, 242},
+    {503, 3, 0, 243},
+    {506, 3, 0, 244},
+    {509, 4, 0, 245},
+    {513, 3, 0, 246},
+    {516, 3, 0, 247},
+    {519, 3, 0, 248},
+    {522, 3, 0, 249},
+    {525, 3, 0, 250},
+    {528, 4, 0, 251},
+    {532, 3, 0, 252},
+    {535, 4, 0, 253},
+    {539, 3, 0, 254},
+    {542, 4, 0, 256},
+    {546, 3, 0, 257},
+    {549, 3, 0, 259},
+    {552, 3, 0, 260},
+    {555, 3, 0, 261},
+    {558, 3, 0, 262},
+    {561, 3, 0, 265},
+    {564, 3, 0, 267},
+    {567, 3, 1, 22},
+    {570, 3, 1, 24},
+    {573, 3, 1, 29},
+    {576, 3, 1, 30},
+    {579, 3, 1, 39},
+    {582, 3, 1, 41},
+    {585, 3, 1, 44},
+    {588, 3, 1, 146},
+    {591, 3, 1, 147},
+    {594, 4, 1, 152},
+    {598, 3, 1, 158},
+    {601, 3, 1, 162},
+    {604, 3, 1, 166},
+    {607, 3, 1, 168},
+    {610, 4, 1, 172},
+    {614, 3, 1, 174},
+    {617, 3, 2, 38},
+    {620, 3, 2, 40},
+    {623, 3, 2, 45},
+    {626, 3, 2, 47},
+    {629, 3, 2, 48},
+    {632, 3, 2, 50},
+    {635, 3, 2, 51},
+    {638, 3, 2, 53},
+    {641, 3, 2, 54},
+    {644, 3, 2, 55},
+    {647, 3, 2, 56},
+    {650, 3, 2, 58},
+    {653, 3, 2, 66},
+    {656, 3, 2, 149},
+    {659, 4, 2, 156},
+    {663, 3, 2, 157},
+    {666, 3, 2, 161},
+    {669, 3, 2, 163},
+    {672, 3, 2, 164},
+    {675, 3, 2, 165},
+    {678, 3, 2, 167},
+    {681, 4, 2, 169},
+    {685, 4, 2, 171},
+    {689, 3, 2, 173},
+    {692, 3, 2, 176},
+    {695, 4, 2, 177},
+    {699, 3, 2, 178},
+    {702, 4, 2, 179},
+    {706, 4, 2, 180},
+    {710, 3, 2, 181},
+    {713, 4, 2, 183},
+    {717, 3, 2, 184},
+    {720, 3, 2, 186},
+    {723, 4, 2, 187},
+    {727, 3, 2, 188},
+    {730, 3, 2, 189},
+    {733, 4, 2, 193},
+    {737, 4, 2, 194},
+    {741, 3, 2, 197},
+    {744, 3, 2, 198},
+    {747, 3, 2, 200},
+    {750, 3, 2, 201},
+    {753, 3, 2, 202},
+    {756, 3, 2, 206},
+    {759, 3, 3, 1},
+    {762, 3, 3, 3},
+    {765, 3, 3, 6},
+    {768, 3, 3, 7},
+    {771, 3, 3, 8},
+    {774, 3, 3, 9},
+    {777, 3, 3, 14},
+    {780, 3, 3, 21},
+    {783, 3, 3, 27},
+    {786, 3, 3, 37},
+    {789, 3, 3, 111},
+    {792, 3, 3, 112},
+    {795, 3, 3, 113},
+    {798, 4, 3, 116},
+    {802, 3, 3, 117},
+    {805, 3, 3, 118},
+    {808, 3, 3, 120},
+    {811, 4, 3, 122},
+    {815, 4, 3, 123},
+    {819, 3, 3, 125},
+    {822, 3, 3, 127},
+    {825, 3, 3, 135},
+    {828, 3, 3, 154},
+    {831, 4, 3, 255},
+    {835, 4, 3, 258},
+    {839, 3, 3, 263},
+    {842, 3, 3, 264},
+    {845, 3, 3, 266},
+};
+constexpr vertex_index spheres_0_indices[] = {
+    155,
+    11,
+    154,
+    103,
+    157,
+    47,
+    8,
+    9,
+    2,
+    9,
+    17,
+    155,
+    11,
+    17,
+    33,
+    15,
+    19,
+    20,
+    12,
+    27,
+    62,
+    21,
+    25,
+    16,
+    20,
+    31,
+    21,
+    22,
+    25,
+    32,
+    22,
+    32,
+    17,
+    33,
+    46,
+    26,
+    20,
+    30,
+    36,
+    31,
+    37,
+    25,
+    32,
+    37,
+    42,
+    30,
+    35,
+    40,
+    36,
+    37,
+    31,
+    42,
+    41,
+    53,
+    40,
+    44,
+    50,
+    40,
+    50,
+    51,
+    47,
+    46,
+    68,
+    103,
+    47,
+    68,
+    51,
+    52,
+    45,
+    45,
+    52,
+    41,
+    57,
+    69,
+    63,
+    57,
+    63,
+    58,
+    62,
+    27,
+    72,
+    63,
+    69,
+    74,
+    73,
+    83,
+    93,
+    83,
+    72,
+    92,
+    93,
+    94,
+    84,
+    102,
+    117,
+    68,
+    81,
+    89,
+    96,
+    103,
+    68,
+    117,
+    89,
+    95,
+    98,
+    96,
+    99,
+    86,
+    86,
+    99,
+    90,
+    92,
+    110,
+    93,
+    90,
+    99,
+    106,
+    72,
+    27,
+    135,
+    101,
+    116,
+    102,
+    98,
+    97,
+    108,
+    98,
+    108,
+    109,
+    105,
+    106,
+    99,
+    106,
+    115,
+    100,
+    110,
+    111,
+    104,
+    101,
+    115,
+    116,
+    104,
+    107,
+    97,
+    109,
+    113,
+    105,
+    135,
+    124,
+    92,
+    107,
+    111,
+    118,
+    114,
+    121,
+    123,
+    114,
+    123,
+    115,
+    112,
+    118,
+    119,
+    103,
+    117,
+    157,
+    112,
+    121,
+    113,
+    113,
+    121,
+    114,
+    110,
+    124,
+    125,
+    112,
+    119,
+    127,
+    123,
+    121,
+    122,
+    118,
+    120,
+    126,
+    122,
+    134,
+    123,
+    119,
+    126,
+    132,
+    128,
+    133,
+    121,
+    125,
+    130,
+    120,
+    124,
+    135,
+    140,
+    122,
+    133,
+    138,
+    126,
+    130,
+    131,
+    129,
+    134,
+    146,
+    131,
+    130,
+    142,
+    132,
+    143,
+    136,
+    137,
+    144,
+    133,
+    138,
+    145,
+    134,
+    136,
+    144,
+    137,
+    138,
+    144,
+    148,
+    141,
+    149,
+    130,
+    146,
+    156,
+    139,
+    135,
+    27,
+    12,
+    148,
+    153,
+    145,
+    142,
+    149,
+    150,
+    148,
+    152,
+    2,
+    2,
+    155,
+    153,
+    47,
+    157,
+    156,
+    26,
+    2,
+    9,
+    155,
+    11,
+    155,
+    17,
+    19,
+    10,
+    14,
+    18,
+    8,
+    16,
+    9,
+    17,
+    9,
+    22,
+    11,
+    33,
+    26,
+    24,
+    14,
+    13,
+    29,
+    10,
+    19,
+    15,
+    24,
+    30,
+    19,
+    18,
+    14,
+    24,
+    18,
+    15,
+    20,
+    21,
+    22,
+    16,
+    25,
+    21,
+    31,
+    25,
+    17,
+    32,
+    33,
+    42,
+    38,
+    33,
+    32,
+    20,
+    19,
+    30,
+    24,
+    34,
+    35,
+    30,
+    24,
+    35,
+    47,
+    26,
+    46,
+    20,
+    36,
+    31,
+    32,
+    25,
+    37,
+    45,
+    37,
+    36,
+    40,
+    36,
+    30,
+    40,
+    40,
+    35,
+    44,
+    37,
+    45,
+    41,
+    42,
+    37,
+    41,
+    40,
+    51,
+    45,
+    50,
+    44,
+    49,
+    46,
+    80,
+    68,
+    63,
+    64,
+    55,
+    58,
+    62,
+    72,
+    83,
+    63,
+    74,
+    75,
+    84,
+    69,
+    73,
+    93,
+    85,
+    75,
+    74,
+    84,
+    74,
+    69,
+    84,
+    95,
+    85,
+    84,
+    94,
+    68,
+    80,
+    102,
+    83,
+    92,
+    93,
+    104,
+    94,
+    93,
+    110,
+    89,
+    85,
+    95,
+    81,
+    96,
+    86,
+    96,
+    89,
+    98,
+    97,
+    95,
+    94,
+    104,
+    90,
+    106,
+    100,
+    105,
+    99,
+    96,
+    98,
+    98,
+    95,
+    97,
+    114,
+    106,
+    105,
+    113,
+    72,
+    135,
+    92,
+    102,
+    116,
+    117,
+    98,
+    109,
+    105,
+    101,
+    100,
+    115,
+    92,
+    124,
+    110,
+    106,
+    114,
+    115,
+    104,
+    111,
+    107,
+    108,
+    97,
+    107,
+    118,
+    112,
+    108,
+    107,
+    120,
+    111,
+    110,
+    125,
+    109,
+    108,
+    112,
+    109,
+    112,
+    113,
+    26,
+    156,
+    154,
+    11,
+    123,
+    129,
+    116,
+    115,
+    118,
+    111,
+    120,
+    157,
+    117,
+    116,
+    139,
+    116,
+    129,
+    139,
+    128,
+    121,
+    112,
+    127,
+    137,
+    128,
+    127,
+    132,
+    119,
+    118,
+    126,
+    126,
+    120,
+    130,
+    129,
+    123,
+    134,
+    127,
+    119,
+    132,
+    122,
+    121,
+    133,
+    141,
+    125,
+    124,
+    140,
+    128,
+    137,
+    133,
+    142,
+    143,
+    132,
+    131,
+    125,
+    141,
+    130,
+    122,
+    138,
+    134,
+    139,
+    129,
+    146,
+    132,
+    126,
+    131,
+    146,
+    134,
+    145,
+    153,
+    154,
+    146,
+    145,
+    132,
+    136,
+    137,
+    138,
+    133,
+    144,
+    138,
+    148,
+    145,
+    142,
+    130,
+    149,
+    139,
+    156,
+    157,
+    150,
+    151,
+    143,
+    142,
+    146,
+    154,
+    156,
+    147,
+    144,
+    136,
+    151,
+    136,
+    143,
+    151,
+    0,
+    141,
+    140,
+    3,
+    144,
+    147,
+    152,
+    148,
+    144,
+    152,
+    141,
+    0,
+    149,
+    148,
+    2,
+    153,
+    151,
+    1,
+    147,
+    152,
+    8,
+    2,
+    154,
+    153,
+    155,
+    24,
+    29,
+    34,
+    43,
+    39,
+    29,
+    43,
+    48,
+    39,
+    39,
+    48,
+    49,
+    56,
+    57,
+    48,
+    62,
+    83,
+    54,
+    56,
+    83,
+    73,
+    23,
+    43,
+    29,
+    34,
+    29,
+    39,
+    44,
+    35,
+    34,
+    39,
+    39,
+    49,
+    44,
+    43,
+    56,
+    48,
+    49,
+    48,
+    57,
+    49,
+    57,
+    58,
+    69,
+    57,
+    56,
+    73,
+    54,
+    83,
+    56,
+    38,
+    53,
+    67,
+    67,
+    80,
+    46,
+    64,
+    76,
+    77,
+    70,
+    78,
+    65,
+    65,
+    78,
+    71,
+    77,
+    82,
+    70,
+    82,
+    87,
+    78,
+    71,
+    88,
+    79,
+    79,
+    88,
+    91,
+    81,
+    85,
+    89,
+    81,
+    86,
+    82,
+    86,
+    90,
+    87,
+    91,
+    100,
+    101,
+    46,
+    33,
+    38,
+    58,
+    55,
+    50,
+    49,
+    38,
+    42,
+    53,
+    53,
+    41,
+    52,
+    38,
+    67,
+    46,
+    53,
+    52,
+    61,
+    53,
+    61,
+    66,
+    67,
+    53,
+    66,
+    55,
+    59,
+    51,
+    50,
+    60,
+    52,
+    51,
+    59,
+    52,
+    60,
+    61,
+    61,
+    65,
+    66,
+    70,
+    60,
+    59,
+    64,
+    59,
+    55,
+    64,
+    65,
+    61,
+    60,
+    70,
+    79,
+    66,
+    65,
+    71,
+    64,
+    77,
+    70,
+    75,
+    76,
+    64,
+    63,
+    67,
+    66,
+    79,
+    67,
+    79,
+    80,
+    87,
+    88,
+    71,
+    78,
+    70,
+    82,
+    78,
+    77,
+    81,
+    82,
+    102,
+    80,
+    79,
+    91,
+    85,
+    81,
+    76,
+    75,
+    77,
+    76,
+    81,
+    82,
+    86,
+    87,
+    88,
+    87,
+    90,
+    88,
+    90,
+    100,
+    91,
+    88,
+    100,
+    91,
+    101,
+    102,
+    5,
+    6,
+    1,
+    0,
+    3,
+    13,
+    4,
+    14,
+    5,
+    12,
+    28,
+    3,
+    28,
+    23,
+    13,
+    9,
+    16,
+    22,
+    23,
+    29,
+    13,
+    28,
+    43,
+    23,
+    28,
+    62,
+    54,
+    43,
+    54,
+    56,
+    150,
+    4,
+    5,
+    1,
+    7,
+    147,
+    149,
+    0,
+    4,
+    14,
+    10,
+    6,
+    5,
+    1,
+    6,
+    7,
+    4,
+    0,
+    13,
+    4,
+    13,
+    14,
+    15,
+    7,
+    6,
+    10,
+    16,
+    8,
+    7,
+    15,
+    3,
+    28,
+    13,
+    15,
+    21,
+    16,
+    12,
+    62,
+    28,
+    28,
+    54,
+    43,
+    12,
+    3,
+    140,
+    135,
+    8,
+    152,
+    147,
+    7,
+    151,
+    150,
+    5,
+    1,
+    151,
+    5,
+    150,
+    149,
+    4,
+};
+constexpr quantized_vertex spheres_1_vertices[] = {
+    {-3515, 27485, -17731},
+    {-2879, -269, -32767},
+    {-2421, -18441, -27088},
+    {-960, 30298, -12749},
+    {2534, 20584, -25704},
+    {1902, 9892, -31436},
+    {6938, 3228, -32024},
+    {3135, -6460, -32132},
+    {2920, -12644, -30242},
+    {7991, -17972, -26356},
+    {12511, 3221, -30221},
+    {5404, -27228, -17537},
+    {659, 32165, -6665},
+    {8934, 25521, -18994},
+    {12620, 15967, -26044},
+    {15861, -2915, -28834},
+    {14040, -12418, -27014},
+    {12567, -23543, -19411},
+    {18970, 12838, -23582},
+    {20396, 6973, -24876},
+    {25789, 0, -20445},
+    {20656, -6703, -24698},
+    {17450, -18444, -20912},
+    {13032, 27350, -12838},
+    {22497, 16491, -17644},
+    {23124, -12622, -19693},
+    {6859, -30354, -10837},
+    {6, 32767, -35},
+    {9867, 30568, -7756},
+    {19039, 23509, -13055},
+    {28436, 6460, -15266},
+    {28436, -6460, -15266},
+    {22781, -20749, -11803},
+    {14487, -27357, -11427},
+    {26257, 18283, -7497},
+    {28889, 12622, -9351},
+    {31638, 0, -9026},
+    {30087, -10376, -8868},
+    {18182, -27418, 240},
+    {25048, 21428, -1689},
+    {32767, 3785, -2147},
+    {30256, -12622, 2409},
+    {25407, -20937, -2399},
+    {18073, 27590, -1490},
+    {30256, 12622, 2409},
+    {32108, -6460, 3094},
+    {12611, -30446, -308},
+    {5521, -32274, -3720},
+    {22323, 23222, 6309},
+    {27087, 16288, 9306},
+    {30880, 6460, 9296},
+    {31303, 0, 10061},
+    {29304, -9561, 11473},
+    {24378, -20937, 7500},
+    {12123, 30298, 3939},
+    {24959, 6460, 20399},
+    {14954, 27329, 10499},
+    {19639, 20937, 16252},
+    {23800, 12622, 18801},
+    {25057, 0, 21267},
+    {24959, -6460, 20399},
+    {22577, -15579, 18364},
+    {6479, 32322, 808},
+    {16179, 15530, 24044},
+    {17727, 3228, 27487},
+    {16179, -15530, 24044},
+    {16850, -23356, 15989},
+    {13813, -27462, 11961},
+    {3140, -32212, 5828},
+    {9435, 23356, 21214},
+    {15239, -6460, 28391},
+    {7469, -18283, 26213},
+    {-835, 32165, 6535},
+    {6582, 27329, 17028},
+    {7469, 18283, 26213},
+    {9323, 12622, 28844},
+    {9400, 6460, 30817},
+    {8999, 0, 31593},
+    {9323, -12622, 28844},
+    {6266, -25484, 19934},
+    {7364, -30354, 10430},
+    {-3053, 2436, 32767},
+    {3199, -6460, 32056},
+    {3366, 30568, 12030},
+    {-2630, 20937, 25336},
+    {-2439, 12622, 30211},
+    {-9326, -6460, 30835},
+    {-2439, -12622, 30211},
+    {-2630, -20937, 25336},
+    {-9326, 6460, 30835},
+    {-12976, -16104, 25712},
+    {-4007, -27330, 17805},
+    {-8303, 30298, 9638},
+    {-5705, 27357, 17482},
+    {-12140, 20937, 22396},
+    {-13829, 12622, 26973},
+    {-16003, 0, 28688},
+    {-23113, 12622, 19624},
+    {-21666, 3785, 24621},
+    {-18679, -10270, 25126},
+    {-12426, -23356, 19609},
+    {-13244, -27330, 12570},
+    {-4566, -30446, 11713},
+    {6, -32767, -35},
+    {-19801, 20937, 16041},
+    {-24906, -6460, 20449},
+    {-22808, -16288, 17289},
+    {-26576, 15746, 11348},
+    {-28424, 6460, 15196},
+    {-29264, 0, 14954},
+    {-16130, 27590, 8223},
+    {-22032, 23319, 6845},
+    {-32767, 2436, 3365},
+    {-30850, -6460, 9358},
+    {-27834, -15579, 8508},
+    {-21246, -23356, 9393},
+    {-14500, -29276, 4535},
+    {-4990, -32165, 4315},
+    {-28966, 15579, 2913},
+    {-32096, 6460, -3163},
+    {-23121, 23222, -1903},
+    {-31298, -10270, -1590},
+    {-25968, -18283, -8413},
+    {-24908, -21504, -1466},
+    {-12599, 30446, -308},
+    {-17953, 27257, -3948},
+    {-27889, 15579, -8397},
+    {-31292, 0, -10130},
+    {-30869, -6460, -9365},
+    {-17953, -27257, -3948},
+    {-19641, 23356, -12465},
+    {-24152, 15530, -16092},
+    {-28408, 3785, -16477},
+    {-27006, -12622, -13867},
+    {-20645, -23222, -10610},
+    {-6509, 32306, -676},
+    {-20408, 0, -25814},
+    {-24947, -6460, -20468},
+    {-20784, -18283, -17713},
+    {-11789, -30408, -4705},
+    {-8702, 30295, -9185},
+    {-12799, 27350, -13059},
+    {-18541, 15579, -22483},
+    {-20481, 6460, -24943},
+    {-19668, -10376, -24441},
+    {-15026, -23222, -17707},
+    {-12652, -27418, -13079},
+    {-9388, -6460, -30886},
+    {-12435, -18283, -24322},
+    {-9129, 23543, -21242},
+    {-8538, 15578, -27871},
+    {-9847, 4164, -31243},
+    {-9024, -12842, -28939},
+    {-7118, -23222, -22113},
+    {-3360, -27403, -17867},
+    {1875, -23222, -23158},
+    {-3844, -30340, -12105},
+    {-4827, -32262, -4577},
+};
+constexpr m3::vec3 spheres_1_normals[] = {
+    {0.03840000182390213f, -0.8023999929428101f, -0.5954999923706055f},
+    {0.03449999913573265f, 0.11389999836683273f, -0.992900013923645f},
+    {0.008799999952316284f, -0.9927999973297119f, -0.11959999799728394f},
+    {0.08110000193119049f, 0.8497999906539917f, -0.5209000110626221f},
+    {0.08320000022649765f, -0.5346999764442444f, -0.8409000039100647f},
+    {0.22310000658035278f, -0.6836000084877014f, -0.6948999762535095f},
+    {0.17960000038146973f, 0.45680001378059387f, -0.8712000250816345f},
+    {0.12470000237226486f, 0.9387999773025513f, -0.32109999656677246f},
+    {0.2295999974012375f, 0.8806999921798706f, -0.4142000079154968f},
+    {0.4034999907016754f, -0.5285000205039978f, -0.7469000220298767f},
+    {0.3037000000476837f, -0.8294000029563904f, -0.46889999508857727f},
+    {0.6434999704360962f, 0.011300000362098217f, -0.7653999924659729f},
+    {0.07900000363588333f, 0.9934999942779541f, -0.08240000158548355f},
+    {0.5770000219345093f, -0.37380000948905945f, -0.7261999845504761f},
+    {0.448199987411499f, 0.7305999994277954f, -0.5151000022888184f},
+    {0.760200023651123f, -0.1875f, -0.6220999956130981f},
+    {0.6622999906539917f, -0.536300003528595f, -0.5231000185012817f},
+    {0.5511000156402588f, -0.6733999848365784f, -0.4927000105381012f},
+    {0.3450999855995178f, -0.9178000092506409f, -0.1965000033378601f},
+    {0.8901000022888184f, 0.0007999999797903001f, -0.45590001344680786f},
+    {0.8113999962806702f, -0.3815000057220459f, -0.44269999861717224f},
+    {0.483599990606308f, 0.8438000082969666f, -0.23270000517368317f},
+    {0.7145000100135803f, 0.5940999984741211f, -0.3695000112056732f},
+    {0.8241999745368958f, -0.5127999782562256f, -0.24040000140666962f},
+    {0.6444000005722046f, 0.7365000247955322f, -0.20589999854564667f},
+    {0.9429000020027161f, 0.19210000336170197f, -0.2721000015735626f},
+    {0.9330999851226807f, -0.1446000039577484f, -0.32919999957084656f},
+    {0.3605000078678131f, 0.9315000176429749f, -0.04800000041723251f},
+    {0.8377000093460083f, -0.5392000079154968f, 0.08699999749660492f},
+    {0.6617000102996826f, 0.7475000023841858f, 0.05779999867081642f},
+    {0.7886000275611877f, 0.6000999808311462f, 0.1340000033378601f},
+    {0.9695000052452087f, 0.21969999372959137f, 0.10849999636411667f},
+    {0.986299991607666f, 0.08160000294446945f, 0.14350000023841858f},
+    {0.22120000422000885f, -0.9732999801635742f, 0.061400000005960464f},
+    {0.11159999668598175f, -0.9932000041007996f, 0.03420000150799751f},
+    {0.9523000121116638f, -0.16099999845027924f, 0.2590999901294708f},
+    {0.9319000244140625f, -0.30250000953674316f, 0.19990000128746033f},
+    {0.5220000147819519f, 0.8389000296592712f, 0.15399999916553497f},
+    {0.5764999985694885f, -0.7890999913215637f, 0.21199999749660492f},
+    {0.5953999757766724f, 0.7329999804496765f, 0.32899999618530273f},
+    {0.36469998955726624f, -0.9122999906539917f, 0.1860000044107437f},
+    {0.2240999937057495f, 0.9514999985694885f, 0.21080000698566437f},
+    {0.4564000070095062f, 0.6233999729156494f, 0.6348999738693237f},
+    {0.6126000285148621f, 0.49559998512268066f, 0.6155999898910522f},
+    {0.29499998688697815f, 0.8773999810218811f, 0.3783000111579895f},
+    {0.3982999920845032f, 0.08510000258684158f, 0.9132999777793884f},
+    {0.05550000071525574f, 0.9936000108718872f, 0.09799999743700027f},
+    {0.43140000104904175f, -0.35339999198913574f, 0.8299999833106995f},
+    {0.35280001163482666f, -0.48730000853538513f, 0.798799991607666f},
+    {0.3643999993801117f, 0.5784000158309937f, 0.7297999858856201f},
+    {0.28600001335144043f, -0.18950000405311584f, 0.939300000667572f},
+    {0.1071000024676323f, -0.374099999666214f, 0.9211999773979187f},
+    {0.02160000056028366f, 0.8454999923706055f, 0.5335000157356262f},
+    {0.11010000109672546f, -0.6639000177383423f, 0.7396000027656555f},
+    {0.003000000026077032f, -0.7628999948501587f, 0.6464999914169312f},
+    {-0.13570000231266022f, 0.24899999797344208f, 0.958899974822998f},
+    {-0.09600000083446503f, -0.1462000012397766f, 0.9846000075340271f},
+    {-0.0917000025510788f, 0.9352999925613403f, 0.3418000042438507f},
+    {-0.25589999556541443f, -0.3765000104904175f, 0.8903999924659729f},
+    {-0.20589999854564667f, 0.7168999910354614f, 0.666100025177002f},
+    {-0.04820000007748604f, -0.9722999930381775f, 0.22849999368190765f},
+    {-0.29910001158714294f, -0.008200000040233135f, 0.954200029373169f},
+    {-0.025800000876188278f, -0.9937999844551086f, 0.10769999772310257f},
+    {-0.47429999709129333f, 0.19210000336170197f, 0.8590999841690063f},
+    {-0.4569999873638153f, -0.18299999833106995f, 0.8705000281333923f},
+    {-0.4020000100135803f, -0.30640000104904175f, 0.8628000020980835f},
+    {-0.28119999170303345f, -0.8216000199317932f, 0.4959000051021576f},
+    {-0.36340001225471497f, 0.8264999985694885f, 0.4300000071525574f},
+    {-0.5640000104904175f, -0.4844000041484833f, 0.6687999963760376f},
+    {-0.07819999754428864f, 0.9936000108718872f, 0.08089999854564667f},
+    {-0.301800012588501f, -0.9147999882698059f, 0.2685999870300293f},
+    {-0.7623000144958496f, 0.21969999372959137f, 0.6087999939918518f},
+    {-0.7989000082015991f, 0.08160000294446945f, 0.5958999991416931f},
+    {-0.6899999976158142f, -0.35109999775886536f, 0.6328999996185303f},
+    {-0.5631999969482422f, -0.6682000160217285f, 0.4862000048160553f},
+    {-0.6022999882698059f, 0.7250999808311462f, 0.33379998803138733f},
+    {-0.5130000114440918f, -0.8125f, 0.2768000066280365f},
+    {-0.7181000113487244f, 0.4964999854564667f, 0.4876999855041504f},
+    {-0.8654999732971191f, -0.18950000405311584f, 0.46369999647140503f},
+    {-0.2816999852657318f, 0.9498000144958496f, 0.13580000400543213f},
+    {-0.7785999774932861f, 0.5917999744415283f, 0.20890000462532043f},
+    {-0.8686000108718872f, -0.49399998784065247f, 0.03840000182390213f},
+    {-0.7626000046730042f, -0.6292999982833862f, 0.14990000426769257f},
+    {-0.9573000073432922f, 0.27959999442100525f, 0.0737999975681305f},
+    {-0.1120000034570694f, -0.9937000274658203f, 0.008799999952316284f},
+    {-0.9843999743461609f, -0.15000000596046448f, 0.09239999949932098f},
+    {-0.9341999888420105f, -0.32330000400543213f, 0.15070000290870667f},
+    {-0.5393000245094299f, 0.8400999903678894f, 0.05779999867081642f},
+    {-0.9941999912261963f, -0.008200000040233135f, -0.10719999670982361f},
+    {-0.8644999861717224f, -0.49320000410079956f, -0.0966000035405159f},
+    {-0.8148000240325928f, 0.5745999813079834f, -0.07760000228881836f},
+    {-0.7096999883651733f, -0.6743000149726868f, -0.20419999957084656f},
+    {-0.9192000031471252f, 0.24940000474452972f, -0.30469998717308044f},
+    {-0.8916000127792358f, -0.38530001044273376f, -0.2379000037908554f},
+    {-0.651199996471405f, 0.7305999994277954f, -0.2053000032901764f},
+    {-0.2969000041484833f, 0.9435999989509583f, -0.14640000462532043f},
+    {-0.7390999794006348f, -0.5328999757766724f, -0.41190001368522644f},
+    {-0.7278000116348267f, 0.5855000019073486f, -0.3569999933242798f},
+    {-0.5127000212669373f, -0.8105000257492065f, -0.2833000123500824f},
+    {-0.6064000129699707f, 0.5946999788284302f, -0.527899980545044f},
+    {-0.7402999997138977f, 0.08160000294446945f, -0.6672999858856201f},
+    {-0.7195000052452087f, -0.3815000057220459f, -0.5802000164985657f},
+    {-0.5782999992370605f, -0.6751999855041504f, -0.4578999876976013f},
+    {-0.6611999869346619f, -0.1446000039577484f, -0.7361000180244446f},
+    {-0.5370000004768372f, -0.5016999840736389f, -0.6782000064849854f},
+    {-0.45980000495910645f, 0.7084000110626221f, -0.5354999899864197f},
+    {-0.2703000009059906f, -0.9153000116348267f, -0.2985999882221222f},
+    {-0.06069999933242798f, 0.9934999942779541f, -0.09610000252723694f},
+    {-0.35910001397132874f, -0.6751999855041504f, -0.6442999839782715f},
+    {-0.3889000117778778f, 0.5723999738693237f, -0.7218999862670898f},
+    {-0.23180000483989716f, -0.541100025177002f, -0.8083999752998352f},
+    {-0.0421999990940094f, 0.47429999709129333f, -0.8794000148773193f},
+    {-0.09709999710321426f, -0.19460000097751617f, -0.9761000275611877f},
+    {-0.07890000194311142f, 0.7235999703407288f, -0.685699999332428f},
+    {-0.08489999920129776f, -0.6773999929428101f, -0.7307000160217285f},
+    {0.02410000003874302f, -0.9679999947547913f, -0.25f},
+    {0.29100000858306885f, 0.29739999771118164f, -0.9093000292778015f},
+    {0.08299999684095383f, -0.02160000056028366f, -0.9962999820709229f},
+    {0.058800000697374344f, 0.7767000198364258f, -0.6270999908447266f},
+    {0.08309999853372574f, -0.5874999761581421f, -0.8050000071525574f},
+    {0.2671000063419342f, 0.6370000243186951f, -0.7231000065803528f},
+    {0.20600000023841858f, -0.7314000129699707f, -0.6500999927520752f},
+    {0.28290000557899475f, -0.08540000021457672f, -0.955299973487854f},
+    {0.29260000586509705f, -0.25600001215934753f, -0.9212999939918518f},
+    {0.4519999921321869f, 0.28110000491142273f, -0.8464999794960022f},
+    {0.16910000145435333f, 0.8938999772071838f, -0.41510000824928284f},
+    {0.2637999951839447f, -0.3921000063419342f, -0.8812999725341797f},
+    {0.5081999897956848f, -0.2551000118255615f, -0.8226000070571899f},
+    {0.38440001010894775f, -0.5800999999046326f, -0.7182000279426575f},
+    {0.2946000099182129f, -0.8400999903678894f, -0.4555000066757202f},
+    {0.48179998993873596f, 0.633400022983551f, -0.6054999828338623f},
+    {0.5266000032424927f, 0.0966000035405159f, -0.8446000218391418f},
+    {0.7355999946594238f, 0.2994999885559082f, -0.6075999736785889f},
+    {0.5234000086784363f, 0.5512999892234802f, -0.6496999859809875f},
+    {0.6474999785423279f, -0.012299999594688416f, -0.7620000243186951f},
+    {0.15299999713897705f, 0.9782999753952026f, -0.1396999955177307f},
+    {0.5684999823570251f, -0.4043000042438507f, -0.7164999842643738f},
+    {0.7573000192642212f, -0.20800000429153442f, -0.6190999746322632f},
+    {0.5385000109672546f, -0.7027999758720398f, -0.4648999869823456f},
+    {0.6104000210762024f, -0.7684999704360962f, -0.19220000505447388f},
+    {0.7580000162124634f, 0.1898999959230423f, -0.6240000128746033f},
+    {0.7860999703407288f, 0.4893999993801117f, -0.3776000142097473f},
+    {0.8108000159263611f, 0.3734000027179718f, -0.4507000148296356f},
+    {0.3287999927997589f, -0.9254999756813049f, -0.18770000338554382f},
+    {0.8901000022888184f, -0.0007999999797903001f, -0.45590001344680786f},
+    {0.7937999963760376f, -0.4408000111579895f, -0.41909998655319214f},
+    {0.515500009059906f, 0.8206999897956848f, -0.24629999697208405f},
+    {0.6815000176429749f, 0.6935999989509583f, -0.23340000212192535f},
+    {0.9847999811172485f, -0.13439999520778656f, -0.10970000177621841f},
+    {0.4832000136375427f, -0.8611999750137329f, -0.1574999988079071f},
+    {0.9408000111579895f, 0.20730000734329224f, -0.26829999685287476f},
+    {0.9398000240325928f, 0.32359999418258667f, -0.10920000076293945f},
+    {0.8812999725341797f, 0.46380001306533813f, -0.0908999964594841f},
+    {0.9574000239372253f, -0.2800999879837036f, -0.07010000199079514f},
+    {0.37450000643730164f, 0.9258000254631042f, -0.05090000107884407f},
+    {0.8840000033378601f, -0.45570001006126404f, -0.1039000004529953f},
+    {0.8478000164031982f, 0.3057999908924103f, 0.4332999885082245f},
+    {0.6800000071525574f, -0.7297999858856201f, 0.0706000030040741f},
+    {0.8360000252723694f, 0.5400000214576721f, 0.09719999879598618f},
+    {0.9929999709129333f, -0.003599999938160181f, 0.11789999902248383f},
+    {0.9077000021934509f, 0.35030001401901245f, 0.23090000450611115f},
+    {0.85589998960495f, -0.4560999870300293f, 0.24379999935626984f},
+    {0.5483999848365784f, 0.8206999897956848f, 0.16050000488758087f},
+    {0.4577000141143799f, -0.873199999332428f, 0.16740000247955322f},
+    {0.8001000285148621f, -0.4747999906539917f, 0.3666999936103821f},
+    {0.6669999957084656f, -0.6184999942779541f, 0.4153999984264374f},
+    {0.7031000256538391f, 0.6277999877929688f, 0.33390000462532043f},
+    {0.5909000039100647f, -0.7439000010490417f, 0.31209999322891235f},
+    {0.7355999946594238f, 0.5063999891281128f, 0.44999998807907104f},
+    {0.8738999962806702f, 0.09560000151395798f, 0.4765999913215637f},
+    {0.2678000032901764f, -0.9534000158309937f, 0.13899999856948853f},
+    {0.8744000196456909f, -0.09839999675750732f, 0.47510001063346863f},
+    {0.40560001134872437f, 0.76910001039505f, 0.49390000104904175f},
+    {0.8025000095367432f, -0.32199999690055847f, 0.5023000240325928f},
+    {0.29260000586509705f, 0.9124000072479248f, 0.28619998693466187f},
+    {0.6074000000953674f, 0.29109999537467957f, 0.7390999794006348f},
+    {0.5372999906539917f, -0.5824000239372253f, 0.6100000143051147f},
+    {0.6261000037193298f, -0.09860000014305115f, 0.7735000252723694f},
+    {0.6705999970436096f, 0.10890000313520432f, 0.7337999939918518f},
+    {0.6158000230789185f, -0.30410000681877136f, 0.7268999814987183f},
+    {0.374099999666214f, -0.6473000049591064f, 0.6640999913215637f},
+    {0.43380001187324524f, -0.027300000190734863f, 0.900600016117096f},
+    {0.12559999525547028f, 0.9743000268936157f, 0.18700000643730164f},
+    {0.4569000005722046f, 0.2872999906539917f, 0.8417999744415283f},
+    {0.3513999879360199f, -0.7753999829292297f, 0.5246999859809875f},
+    {0.35280001163482666f, 0.48730000853538513f, 0.798799991607666f},
+    {0.26840001344680786f, -0.8445000052452087f, 0.4634000062942505f},
+    {0.0778999999165535f, -0.48080000281333923f, 0.8733000159263611f},
+    {0.2851000130176544f, -0.20499999821186066f, 0.9362999796867371f},
+    {0.09430000185966492f, -0.013299999758601189f, 0.9955000281333923f},
+    {0.04490000009536743f, 0.767300009727478f, 0.6396999955177307f},
+    {0.0778999999165535f, 0.48080000281333923f, 0.8733000159263611f},
+    {0.11389999836683273f, 0.6747999787330627f, 0.7290999889373779f},
+    {0.060100000351667404f, -0.8877999782562256f, 0.4562999904155731f},
+    {0.08789999783039093f, 0.26350000500679016f, 0.9606999754905701f},
+    {-0.24619999527931213f, 0.4959000051021576f, 0.8327999711036682f},
+    {0.043699998408555984f, -0.9397000074386597f, 0.3391000032424927f},
+    {0.11860000342130661f, 0.11129999905824661f, 0.9866999983787537f},
+    {-0.0949999988079071f, -0.20499999821186066f, 0.9740999937057495f},
+    {-0.09870000183582306f, 0.9207000136375427f, 0.3776000142097473f},
+    {-0.19910000264644623f, -0.4925000071525574f, 0.8471999764442444f},
+    {-0.2687999904155731f, -0.6323999762535095f, 0.7265999913215637f},
+    {-0.20309999585151672f, -0.7281000018119812f, 0.654699981212616f},
+    {-0.40369999408721924f, 0.7793999910354614f, 0.47920000553131104f},
+    {-0.25360000133514404f, 0.374099999666214f, 0.8920000195503235f},
+    {-0.30140000581741333f, 0.005499999970197678f, 0.953499972820282f},
+    {-0.259799987077713f, -0.8500000238418579f, 0.45829999446868896f},
+    {-0.4754999876022339f, 0.20730000734329224f, 0.8550000190734863f},
+    {-0.5461000204086304f, 0.4959000051021576f, 0.6751999855041504f},
+    {-0.5284000039100647f, -0.5699999928474426f, 0.6291999816894531f},
+    {-0.6323999762535095f, -0.10700000077486038f, 0.7671999931335449f},
+    {-0.5873000025749207f, 0.32359999418258667f, 0.7418000102043152f},
+    {-0.8341000080108643f, -0.3203999996185303f, 0.4489000141620636f},
+    {-0.1770000010728836f, 0.9714000225067139f, 0.1581999957561493f},
+    {-0.2775999903678894f, -0.932200014591217f, 0.23240000009536743f},
+    {-0.7856000065803528f, -0.003599999938160181f, 0.6187999844551086f},
+    {-0.534500002861023f, -0.7081000208854675f, 0.46140000224113464f},
+    {-0.34869998693466187f, 0.9226999878883362f, 0.16429999470710754f},
+    {-0.7289000153541565f, -0.5756000280380249f, 0.37059998512268066f},
+    {-0.7077999711036682f, 0.6230999827384949f, 0.3330000042915344f},
+    {-0.8065000176429749f, 0.3562999963760376f, 0.4717999994754791f},
+    {-0.9265000224113464f, 0.2815000116825104f, 0.24959999322891235f},
+    {-0.5960000157356262f, 0.8001999855041504f, 0.06650000065565109f},
+    {-0.944599986076355f, 0.11129999905824661f, 0.30880001187324524f},
+    {-0.9578999876976013f, -0.013299999758601189f, 0.2867000102996826f},
+    {0.04349999874830246f, -0.8971999883651733f, -0.43950000405311584f},
+    {-0.6233000159263611f, -0.7785000205039978f, 0.07360000163316727f},
+    {-0.7634999752044678f, 0.6396999955177307f, 0.08799999952316284f},
+    {-0.27639999985694885f, -0.9607999920845032f, 0.021199999377131462f},
+    {-0.45719999074935913f, -0.8889999985694885f, -0.025299999862909317f},
+    {-0.9926000237464905f, -0.07750000059604645f, -0.09390000253915787f},
+    {-0.8769000172615051f, -0.1137000024318695f, -0.46700000762939453f},
+    {-0.9225999712944031f, 0.37549999356269836f, -0.08789999783039093f},
+    {-0.7251999974250793f, 0.6488000154495239f, -0.23070000112056732f},
+    {-0.6633999943733215f, -0.7281000018119812f, -0.17249999940395355f},
+    {-0.9312999844551086f, 0.20730000734329224f, -0.2996000051498413f},
+    {-0.8895999789237976f, -0.39100000262260437f, -0.2361000031232834f},
+    {-0.4097000062465668f, 0.8880000114440918f, -0.20900000631809235f},
+    {-0.8636999726295471f, -0.20499999821186066f, -0.46050000190734863f},
+    {-0.7317000031471252f, 0.30090001225471497f, -0.6115999817848206f},
+    {-0.5020999908447266f, 0.8197000026702881f, -0.27559998631477356f},
+    {-0.707099974155426f, -0.5871000289916992f, -0.39410001039505005f},
+    {-0.4645000100135803f, -0.8482000231742859f, -0.25459998846054077f},
+    {-0.8507999777793884f, 0.3221000134944916f, -0.41510000824928284f},
+    {-0.5199000239372253f, -0.7484999895095825f, -0.4115999937057495f},
+    {-0.2897000014781952f, -0.788100004196167f, -0.5432000160217285f},
+    {-0.7601000070571899f, -0.003599999938160181f, -0.6498000025749207f},
+    {-0.7146999835968018f, -0.392300009727478f, -0.5791000127792358f},
+    {-0.5024999976158142f, -0.5871000289916992f, -0.6347000002861023f},
+    {-0.486299991607666f, 0.6636999845504761f, -0.5683000087738037f},
+    {-0.24310000240802765f, -0.9318000078201294f, -0.2694999873638153f},
+    {-0.4424000084400177f, 0.3093999922275543f, -0.8417999744415283f},
+    {-0.23389999568462372f, -0.858299970626831f, -0.45669999718666077f},
+    {-0.4634000062942505f, -0.09910000115633011f, -0.8805999755859375f},
+    {-0.4887000024318695f, 0.1111999973654747f, -0.8652999997138977f},
+    {-0.1331000030040741f, 0.9660000205039978f, -0.22179999947547913f},
+    {-0.20909999310970306f, 0.8842999935150146f, -0.4174000024795532f},
+    {-0.4284999966621399f, -0.28610000014305115f, -0.8571000099182129f},
+    {-0.09679999947547913f, -0.29190000891685486f, -0.9514999985694885f},
+    {-0.4339999854564667f, -0.4092999994754791f, -0.8026000261306763f},
+    {-0.26429998874664307f, 0.8238000273704529f, -0.5015000104904175f},
+    {-0.22380000352859497f, -0.5888000130653381f, -0.7767000198364258f},
+    {-0.2395000010728836f, -0.0430000014603138f, -0.9699000120162964f},
+    {-0.1599999964237213f, 0.29679998755455017f, -0.9415000081062317f},
+    {-0.10199999809265137f, 0.17640000581741333f, -0.9789999723434448f},
+    {-0.09229999780654907f, -0.4092999994754791f, -0.9077000021934509f},
+    {-0.1339000016450882f, 0.6284000277519226f, -0.7663000226020813f},
+    {-0.0771000012755394f, -0.7440000176429749f, -0.6636999845504761f},
+};
+constexpr face spheres_1_faces[] = {
+    {0, 3, 4, 0},
+    {3, 3, 4, 2},
+    {6, 3, 4, 4},
+    {9, 3, 4, 5},
+    {12, 3, 4, 10},
+    {15, 3, 4, 11},
+    {18, 3, 4, 12},
+    {21, 3, 4, 13},
+    {24, 3, 4, 15},
+    {27, 3, 4, 16},
+    {30, 3, 4, 17},
+    {33, 3, 4, 18},
+    {36, 3, 4, 19},
+    {39, 3, 4, 20},
+    {42, 3, 4, 23},
+    {45, 3, 4, 25},
+    {48, 3, 4, 26},
+    {51, 3, 4, 28},
+    {54, 3, 4, 31},
+    {57, 3, 4, 32},
+    {60, 3, 4, 33},
+    {63, 3, 4, 34},
+    {66, 3, 4, 35},
+    {69, 3, 4, 36},
+    {72, 3, 4, 42},
+    {75, 3, 4, 43},
+    {78, 3, 4, 46},
+    {81, 3, 4, 49},
+    {84, 3, 4, 52},
+    {87, 3, 4, 57},
+    {90, 3, 4, 59},
+    {93, 3, 4, 60},
+    {96, 3, 4, 61},
+    {99, 3, 4, 62},
+    {102, 3, 4, 63},
+    {105, 3, 4, 64},
+    {108, 3, 4, 65},
+    {111, 3, 4, 67},
+    {114, 3, 4, 68},
+    {117, 3, 4, 69},
+    {120, 3, 4, 70},
+    {123, 3, 4, 71},
+    {126, 3, 4, 72},
+    {129, 3, 4, 73},
+    {132, 3, 4, 74},
+    {135, 3, 4, 75},
+    {138, 3, 4, 76},
+    {141, 3, 4, 77},
+    {144, 3, 4, 78},
+    {147, 3, 4, 79},
+    {150, 3, 4, 80},
+    {153, 3, 4, 81},
+    {156, 3, 4, 82},
+    {159, 3, 4, 83},
+    {162, 3, 4, 84},
+    {165, 3, 4, 85},
+    {168, 3, 4, 86},
+    {171, 3, 4, 87},
+    {174, 3, 4, 88},
+    {177, 3, 4, 89},
+    {180, 3, 4, 90},
+    {183, 3, 4, 91},
+    {186, 3, 4, 92},
+    {189, 3, 4, 93},
+    {192, 3, 4, 94},
+    {195, 3, 4, 95},
+    {198, 3, 4, 96},
+    {201, 3, 4, 97},
+    {204, 3, 4, 98},
+    {207, 3, 4, 99},
+    {210, 3, 4, 100},
+    {213, 3, 4, 101},
+    {216, 3, 4, 102},
+    {219, 3, 4, 103},
+    {222, 3, 4, 104},
+    {225, 3, 4, 105},
+    {228, 3, 4, 106},
+    {231, 3, 4, 107},
+    {234, 3, 4, 108},
+    {237, 3, 4, 109},
+    {240, 3, 4, 110},
+    {243, 3, 4, 114},
+    {246, 4, 4, 115},
+    {250, 3, 4, 119},
+    {253, 3, 4, 121},
+    {256, 4, 4, 124},
+    {260, 3, 4, 126},
+    {263, 3, 4, 128},
+    {266, 3, 4, 129},
+    {269, 4, 4, 130},
+    {273, 3, 4, 131},
+    {276, 4, 4, 132},
+    {280, 3, 4, 133},
+    {283, 3, 4, 134},
+    {286, 3, 4, 136},
+    {289, 3, 4, 137},
+    {292, 3, 4, 138},
+    {295, 4, 4, 139},
+    {299, 3, 4, 140},
+    {302, 3, 4, 141},
+    {305, 3, 4, 142},
+    {308, 3, 4, 143},
+    {311, 3, 4, 144},
+    {314, 3, 4, 145},
+    {317, 4, 4, 148},
+    {321, 3, 4, 150},
+    {324, 3, 4, 151},
+    {327, 3, 4, 153},
+    {330, 3, 4, 155},
+    {333, 3, 4, 159},
+    {336, 3, 4, 160},
+    {339, 3, 4, 170},
+    {342, 4, 4, 175},
+    {346, 3, 4, 182},
+    {349, 3, 4, 185},
+    {352, 4, 4, 190},
+    {356, 4, 4, 191},
+    {360, 3, 4, 192},
+    {363, 4, 4, 195},
+    {367, 3, 4, 196},
+    {370, 3, 4, 199},
+    {373, 4, 4, 203},
+    {377, 3, 4, 204},
+    {380, 3, 4, 205},
+    {383, 3, 4, 207},
+    {386, 4, 4, 208},
+    {390, 3, 4, 209},
+    {393, 4, 4, 210},
+    {397, 3, 4, 211},
+    {400, 4, 4, 212},
+    {404, 3, 4, 213},
+    {407, 3, 4, 214},
+    {410, 3, 4, 215},
+    {413, 3, 4, 216},
+    {416, 3, 4, 217},
+    {419, 3, 4, 218},
+    {422, 3, 4, 219},
+    {425, 3, 4, 220},
+    {428, 4, 4, 221},
+    {432, 4, 4, 222},
+    {436, 3, 4, 223},
+    {439, 3, 4, 224},
+    {442, 4, 4, 225},
+    {446, 4, 4, 226},
+    {450, 3, 4, 227},
+    {453, 4, 4, 228},
+    {457, 3, 4, 229},
+    {460, 4, 4, 230},
+    {464, 4, 4, 231},
+    {468, 3, 4, 232},
+    {471, 3, 4, 233},
+    {474, 3, 4, 234},
+    {477, 3, 4, 235},
+    {480, 3, 4, 236},
+    {483, 4, 4, 237},
+    {487, 3, 4, 238},
+    {490, 4, 4, 239},
+    {494, 3, 4, 240},
+    {497, 3, 4, 241},
+    {500, 3, 4, 242},
+    {503, 3, 4, 243},
+    {506, 3, 4, 244},
+    {509, 4, 4, 245},
+    {513, 3, 4, 246},
+    {516, 3, 4, 247},
+    {519, 3, 4, 248},
+    {522, 3, 4, 249},
+    {525, 3, 4, 250},
+    {528, 4, 4, 251},
+    {532, 3, 4, 252},
+    {535, 4, 4, 253},
+    {539, 3, 4, 254},
+    {542, 4, 4, 256},
+    {546, 3, 4, 257},
+    {549, 3, 4, 259},
+    {552, 3, 4, 260},
+    {555, 3, 4, 261},
+    {558, 3, 4, 262},
+    {561, 3, 4, 265},
+    {564, 3, 4, 267},
+    {567, 3, 5, 22},
+    {570, 3, 5, 24},
+    {573, 3, 5, 29},
+    {576, 3, 5, 30},
+    {579, 3, 5, 39},
+    {582, 3, 5, 41},
+    {585, 3, 5, 44},
+    {588, 3, 5, 146},
+    {591, 3, 5, 147},
+    {594, 4, 5, 152},
+    {598, 3, 5, 158},
+    {601, 3, 5, 162},
+    {604, 3, 5, 166},
+    {607, 3, 5, 168},
+    {610, 4, 5, 172},
+    {614, 3, 5, 174},
+    {617, 3, 6, 38},
+    {620, 3, 6, 40},
+    {623, 3, 6, 45},
+    {626, 3, 6, 47},
+    {629, 3, 6, 48},
+    {632, 3, 6, 50},
+    {635, 3, 6, 51},
+    {638, 3, 6, 53},
+    {641, 3, 6, 54},
+    {644, 3, 6, 55},
+    {647, 3, 6, 56},
+    {650, 3, 6, 58},
+    {653, 3, 6, 66},
+    {656, 3, 6, 149},
+    {659, 4, 6, 156},
+    {663, 3, 6, 157},
+    {666, 3, 6, 161},
+    {669, 3, 6, 163},
+    {672, 3, 6, 164},
+    {675, 3, 6, 165},
+    {678, 3, 6, 167},
+    {681, 4, 6, 169},
+    {685, 4, 6, 171},
+    {689, 3, 6, 173},
+    {692, 3, 6, 176},
+    {695, 4, 6, 177},
+    {699, 3, 6, 178},
+    {702, 4, 6, 179},
+    {706, 4, 6, 180},
+    {710, 3, 6, 181},
+    {713, 4, 6, 183},
+    {717, 3, 6, 184},
+    {720, 3, 6, 186},
+    {723, 4, 6, 187},
+    {727, 3, 6, 188},
+    {730, 3, 6, 189},
+    {733, 4, 6, 193},
+    {737, 4, 6, 194},
+    {741, 3, 6, 197},
+    {744, 3, 6, 198},
+    {747, 3, 6, 200},
+    {750, 3, 6, 201},
+    {753, 3, 6, 202},
+    {756, 3, 6, 206},
+    {759, 3, 7, 1},
+    {762, 3, 7, 3},
+    {765, 3, 7, 6},
+    {768, 3, 7, 7},
+    {771, 3, 7, 8},
+    {774, 3, 7, 9},
+    {777, 3, 7, 14},
+    {780, 3, 7, 21},
+    {783, 3, 7, 27},
+    {786, 3, 7, 37},
+    {789, 3, 7, 111},
+    {792, 3, 7, 112},
+    {795, 3, 7, 113},
+    {798, 4, 7, 116},
+    {802, 3, 7, 117},
+    {805, 3, 7, 118},
+    {808, 3, 7, 120},
+    {811, 4, 7, 122},
+    {815, 4, 7, 123},
+    {819, 3, 7, 125},
+    {822, 3, 7, 127},
+    {825, 3, 7, 135},
+    {828, 3, 7, 154},
+    {831, 4, 7, 255},
+    {835, 4, 7, 258},
+    {839, 3, 7, 263},
+    {842, 3, 7, 264},
+    {845, 3, 7, 266},
+};
+constexpr vertex_index spheres_1_indices[] = {
+    155,
+    11,
+    154,
+    103,
+    157,
+    47,
+    8,
+    9,
+    2,
+    9,
+    17,
+    155,
+    11,
+    17,
+    33,
+    15,
+    19,
+    20,
+    12,
+    27,
+    62,
+    21,
+    25,
+    16,
+    20,
+    31,
+    21,
+    22,
+    25,
+    32,
+    22,
+    32,
+    17,
+    33,
+    46,
+    26,
+    20,
+    30,
+    36,
+    31,
+    37,
+    25,
+    32,
+    37,
+    42,
+    30,
+    35,
+    40,
+    36,
+    37,
+    31,
+    42,
+    41,
+    53,
+    40,
+    44,
+    50,
+    40,
+    50,
+    51,
+    47,
+    46,
+    68,
+    103,
+    47,
+    68,
+    51,
+    52,
+    45,
+    45,
+    52,
+    41,
+    57,
+    69,
+    63,
+    57,
+    63,
+    58,
+    62,
+    27,
+    72,
+    63,
+    69,
+    74,
+    73,
+    83,
+    93,
+    83,
+    72,
+    92,
+    93,
+    94,
+    84,
+    102,
+    117,
+    68,
+    81,
+    89,
+    96,
+    103,
+    68,
+    117,
+    89,
+    95,
+    98,
+    96,
+    99,
+    86,
+    86,
+    99,
+    90,
+    92,
+    110,
+    93,
+    90,
+    99,
+    106,
+    72,
+    27,
+    135,
+    101,
+    116,
+    102,
+    98,
+    97,
+    108,
+    98,
+    108,
+    109,
+    105,
+    106,
+    99,
+    106,
+    115,
+    100,
+    110,
+    111,
+    104,
+    101,
+    115,
+    116,
+    104,
+    107,
+    97,
+    109,
+    113,
+    105,
+    135,
+    124,
+    92,
+    107,
+    111,
+    118,
+    114,
+    121,
+    123,
+    114,
+    123,
+    115,
+    112,
+    118,
+    119,
+    103,
+    117,
+    157,
+    112,
+    121,
+    113,
+    113,
+    121,
+    114,
+    110,
+    124,
+    125,
+    112,
+    119,
+    127,
+    123,
+    121,
+    122,
+    118,
+    120,
+    126,
+    122,
+    134,
+    123,
+    119,
+    126,
+    132,
+    128,
+    133,
+    121,
+    125,
+    130,
+    120,
+    124,
+    135,
+    140,
+    122,
+    133,
+    138,
+    126,
+    130,
+    131,
+    129,
+    134,
+    146,
+    131,
+    130,
+    142,
+    132,
+    143,
+    136,
+    137,
+    144,
+    133,
+    138,
+    145,
+    134,
+    136,
+    144,
+    137,
+    138,
+    144,
+    148,
+    141,
+    149,
+    130,
+    146,
+    156,
+    139,
+    135,
+    27,
+    12,
+    148,
+    153,
+    145,
+    142,
+    149,
+    150,
+    148,
+    152,
+    2,
+    2,
+    155,
+    153,
+    47,
+    157,
+    156,
+    26,
+    2,
+    9,
+    155,
+    11,
+    155,
+    17,
+    19,
+    10,
+    14,
+    18,
+    8,
+    16,
+    9,
+    17,
+    9,
+    22,
+    11,
+    33,
+    26,
+    24,
+    14,
+    13,
+    29,
+    10,
+    19,
+    15,
+    24,
+    30,
+    19,
+    18,
+    14,
+    24,
+    18,
+    15,
+    20,
+    21,
+    22,
+    16,
+    25,
+    21,
+    31,
+    25,
+    17,
+    32,
+    33,
+    42,
+    38,
+    33,
+    32,
+    20,
+    19,
+    30,
+    24,
+    34,
+    35,
+    30,
+    24,
+    35,
+    47,
+    26,
+    46,
+    20,
+    36,
+    31,
+    32,
+    25,
+    37,
+    45,
+    37,
+    36,
+    40,
+    36,
+    30,
+    40,
+    40,
+    35,
+    44,
+    37,
+    45,
+    41,
+    42,
+    37,
+    41,
+    40,
+    51,
+    45,
+    50,
+    44,
+    49,
+    46,
+    80,
+    68,
+    63,
+    64,
+    55,
+    58,
+    62,
+    72,
+    83,
+    63,
+    74,
+    75,
+    84,
+    69,
+    73,
+    93,
+    85,
+    75,
+    74,
+    84,
+    74,
+    69,
+    84,
+    95,
+    85,
+    84,
+    94,
+    68,
+    80,
+    102,
+    83,
+    92,
+    93,
+    104,
+    94,
+    93,
+    110,
+    89,
+    85,
+    95,
+    81,
+    96,
+    86,
+    96,
+    89,
+    98,
+    97,
+    95,
+    94,
+    104,
+    90,
+    106,
+    100,
+    105,
+    99,
+    96,
+    98,
+    98,
+    95,
+    97,
+    114,
+    106,
+    105,
+    113,
+    72,
+    135,
+    92,
+    102,
+    116,
+    117,
+    98,
+    109,
+    105,
+    101,
+    100,
+    115,
+    92,
+    124,
+    110,
+    106,
+    114,
+    115,
+    104,
+    111,
+    107,
+    108,
+    97,
+    107,
+    118,
+    112,
+    108,
+    107,
+    120,
+    111,
+    110,
+    125,
+    109,
+    108,
+    112,
+    109,
+    112,
+    113,
+    26,
+    156,
+    154,
+    11,
+    123,
+    129,
+    116,
+    115,
+    118,
+    111,
+    120,
+    157,
+    117,
+    116,
+    139,
+    116,
+    129,
+    139,
+    128,
+    121,
+    112,
+    127,
+    137,
+    128,
+    127,
+    132,
+    119,
+    118,
+    126,
+    126,
+    120,
+    130,
+    129,
+    123,
+    134,
+    127,
+    119,
+    132,
+    122,
+    121,
+    133,
+    141,
+    125,
+    124,
+    140,
+    128,
+    137,
+    133,
+    142,
+    143,
+    132,
+    131,
+    125,
+    141,
+    130,
+    122,
+    138,
+    134,
+    139,
+    129,
+    146,
+    132,
+    126,
+    131,
+    146,
+    134,
+    145,
+    153,
+    154,
+    146,
+    145,
+    132,
+    136,
+    137,
+    138,
+    133,
+    144,
+    138,
+    148,
+    145,
+    142,
+    130,
+    149,
+    139,
+    156,
+    157,
+    150,
+    151,
+    143,
+    142,
+    146,
+    154,
+    156,
+    147,
+    144,
+    136,
+    151,
+    136,
+    143,
+    151,
+    0,
+    141,
+    140,
+    3,
+    144,
+    147,
+    152,
+    148,
+    144,
+    152,
+    141,
+    0,
+    149,
+    148,
+    2,
+    153,
+    151,
+    1,
+    147,
+    152,
+    8,
+    2,
+    154,
+    153,
+    155,
+    24,
+    29,
+    34,
+    43,
+    39,
+    29,
+    43,
+    48,
+    39,
+    39,
+    48,
+    49,
+    56,
+    57,
+    48,
+    62,
+    83,
+    54,
+    56,
+    83,
+    73,
+    23,
+    43,
+    29,
+    34,
+    29,
+    39,
+    44,
+    35,
+    34,
+    39,
+    39,
+    49,
+    44,
+    43,
+    56,
+    48,
+    49,
+    48,
+    57,
+    49,
+    57,
+    58,
+    69,
+    57,
+    56,
+    73,
+    54,
+    83,
+    56,
+    38,
+    53,
+    67,
+    67,
+    80,
+    46,
+    64,
+    76,
+    77,
+    70,
+    78,
+    65,
+    65,
+    78,
+    71,
+    77,
+    82,
+    70,
+    82,
+    87,
+    78,
+    71,
+    88,
+    79,
+    79,
+    88,
+    91,
+    81,
+    85,
+    89,
+    81,
+    86,
+    82,
+    86,
+    90,
+    87,
+    91,
+    100,
+    101,
+    46,
+    33,
+    38,
+    58,
+    55,
+    50,
+    49,
+    38,
+    42,
+    53,
+    53,
+    41,
+    52,
+    38,
+    67,
+    46,
+    53,
+    52,
+    61,
+    53,
+    61,
+    66,
+    67,
+    53,
+    66,
+    55,
+    59,
+    51,
+    50,
+    60,
+    52,
+    51,
+    59,
+    52,
+    60,
+    61,
+    61,
+    65,
+    66,
+    70,
+    60,
+    59,
+    64,
+    59,
+    55,
+    64,
+    65,
+    61,
+    60,
+    70,
+    79,
+    66,
+    65,
+    71,
+    64,
+    77,
+    70,
+    75,
+    76,
+    64,
+    63,
+    67,
+    66,
+    79,
+    67,
+    79,
+    80,
+    87,
+    88,
+    71,
+    78,
+    70,
+    82,
+    78,
+    77,
+    81,
+    82,
+    102,
+    80,
+    79,
+    91,
+    85,
+    81,
+    76,
+    75,
+    77,
+    76,
+    81,
+    82,
+    86,
+    87,
+    88,
+    87,
+    90,
+    88,
+    90,
+    100,
+    91,
+    88,
+    100,
+    91,
+    101,
+    102,
+    5,
+    6,
+    1,
+    0,
+    3,
+    13,
+    4,
+    14,
+    5,
+    12,
+    28,
+    3,
+    28,
+    23,
+    13,
+    9,
+    16,
+    22,
+    23,
+    29,
+    13,
+    28,
+    43,
+    23,
+    28,
+    62,
+    54,
+    43,
+    54,
+    56,
+    150,
+    4,
+    5,
+    1,
+    7,
+    147,
+    149,
+    0,
+    4,
+    14,
+    10,
+    6,
+    5,
+    1,
+    6,
+    7,
+    4,
+    0,
+    13,
+    4,
+    13,
+    14,
+    15,
+    7,
+    6,
+    10,
+    16,
+    8,
+    7,
+    15,
+    3,
+    28,
+    13,
+    15,
+    21,
+    16,
+    12,
+    62,
+    28,
+    28,
+    54,
+    43,
+    12,
+    3,
+    140,
+    135,
+    8,
+    152,
+    147,
+    7,
+    151,
+    150,
+    5,
+    1,
+    151,
+    5,
+    150,
+    149,
+    4,
+};
+constexpr object spheres_objects[] = {
+    {{nullptr, 0}, {spheres_0_vertices, 158}, {3.053982800338417e-05f, 3.0518509447574615e-05f, 3.0544204491889104e-05f}, {-0.3688405156135559f, 0.0f, 0.0010599792003631592f}, {spheres_0_normals, 268}, {spheres_0_faces, 268}, {spheres_0_indices, 848}, {{-1.3695695400238037f, -1.000030517578125f, -0.9998124837875366f}, {0.6318885684013367f, 1.000030517578125f, 1.0019325017929077f}, {-0.3688405156135559f, 0.0f, 0.0010599792003631592f}, 1.009665608406067f}},
+    {{nullptr, 0}, {spheres_1_vertices, 158}, {3.0539824365405366e-05f, 3.0518509447574615e-05f, 3.0544204491889104e-05f}, {0.2420484721660614f, 0.0f, -0.8557980060577393f}, {spheres_1_normals, 268}, {spheres_1_faces, 268}, {spheres_1_indices, 848}, {{-0.7586804628372192f, -1.000030517578125f, -1.8566704988479614f}, {1.2427774667739868f, 1.000030517578125f, 0.1450744867324829f}, {0.2420484721660614f, 0.0f, -0.8557980060577393f}, 1.0096654891967773f}},
+};
+constexpr material spheres_materials[] = {
+    {{25.006498336791992f, 200.0f, 35.12525177001953f}},
+    {{200.0f, 180.67950439453125f, 23.162498474121094f}},
+    {{200.0f, 16.17275047302246f, 22.012500762939453f}},
+    {{27.083999633789062f, 60.054500579833984f, 200.0f}},
+    {{25.006498336791992f, 200.0f, 35.12525177001953f}},
+    {{200.0f, 180.67950439453125f, 23.162498474121094f}},
+    {{200.0f, 16.17275047302246f, 22.012500762939453f}},
+    {{27.083999633789062f, 60.054500579833984f, 200.0f}},
+};
+constexpr m3::vec3 spheres_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+};
+constexpr scene spheres_scene = {{spheres_objects, 2}, {spheres_materials, 8}, {spheres_lights, 3}, {{-10.0f, 10.0f, -20.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(spheres_scene));
 
-# path to .mtl file
-m models/sphere.mtl
+constexpr quantized_vertex tree_0_vertices[] = {
+    {-1062, -32681, 5343},
+    {-3418, -32579, 8900},
+    {-1955, -32567, 13187},
+    {1445, -32642, 14182},
+    {3512, -32738, 10399},
+    {2518, -32767, 5786},
+    {2010, -23948, 5605},
+    {1653, -22543, 7193},
+    {2466, -22342, 9427},
+    {3736, -23743, 9965},
+    {4093, -25147, 8377},
+    {3280, -25348, 6143},
+    {6234, -19621, 2228},
+    {5519, -18748, 4037},
+    {6301, -18773, 6052},
+    {7913, -19355, 6345},
+    {8551, -20372, 4607},
+    {7640, -20590, 2714},
+    {8479, -12478, -46},
+    {7613, -11719, 1532},
+    {8265, -11388, 3421},
+    {9839, -11610, 3835},
+    {10629, -12584, 2383},
+    {9928, -13057, 577},
+    {10966, -6945, -4851},
+    {10308, -6178, -3523},
+    {10984, -5310, -2167},
+    {12330, -5869, -1822},
+    {12923, -6837, -2980},
+    {12418, -7176, -4782},
+    {12650, -935, -9374},
+    {11746, -237, -8457},
+    {12187, 568, -7115},
+    {13475, 634, -6844},
+    {14365, 191, -8011},
+    {13926, -649, -9319},
+    {10718, 4788, -16117},
+    {9981, 4995, -14968},
+    {10230, 5768, -13703},
+    {11438, 5890, -13566},
+    {12167, 5713, -14732},
+    {11813, 5345, -16228},
+    {9535, 11923, -16440},
+    {8908, 12094, -15434},
+    {9209, 12398, -14233},
+    {10189, 12394, -13960},
+    {10804, 12059, -14910},
+    {10513, 11893, -16159},
+    {-2948, -23356, 8529},
+    {-3481, -24653, 10173},
+    {-2818, -24790, 12500},
+    {-1504, -23447, 13073},
+    {-971, -22150, 11430},
+    {-1634, -22013, 9103},
+    {-7184, -18784, 11594},
+    {-8133, -19441, 13340},
+    {-7298, -19626, 15340},
+    {-5828, -18846, 15766},
+    {-4981, -17969, 14085},
+    {-5638, -18172, 11971},
+    {-8479, -10890, 12285},
+    {-9392, -11271, 14109},
+    {-8776, -11380, 16062},
+    {-7163, -11079, 16522},
+    {-6249, -11293, 14654},
+    {-6865, -11229, 12699},
+    {-7064, -3686, 13029},
+    {-7880, -3901, 14514},
+    {-7530, -3477, 16395},
+    {-6069, -3741, 16592},
+    {-5256, -3931, 15099},
+    {-5600, -3452, 13238},
+    {-8007, 3406, 13028},
+    {-8975, 3148, 14237},
+    {-8530, 3059, 15955},
+    {-7283, 3378, 16319},
+    {-6468, 4060, 15177},
+    {-6850, 3975, 13431},
+    {-9204, -9273, 12993},
+    {-7185, -10244, 13361},
+    {-10014, -10892, 12525},
+    {-8008, -12061, 12867},
+    {-10395, -11082, 14838},
+    {-8439, -12268, 15405},
+    {-9586, -9463, 15307},
+    {-7616, -10450, 15898},
+    {-12459, -7039, 11776},
+    {-13656, -8014, 11071},
+    {-14141, -8145, 13117},
+    {-13250, -6799, 13624},
+    {-15620, -2799, 11467},
+    {-16465, -3906, 10799},
+    {-16774, -4317, 12613},
+    {-15931, -3208, 13281},
+    {-17864, -1523, 11073},
+    {-18811, -2461, 10468},
+    {-18802, -3034, 12167},
+    {-18154, -1864, 12827},
+    {-19654, 676, 13684},
+    {-20812, 157, 13270},
+    {-20644, -782, 14516},
+    {-19579, -141, 15077},
+    {-5178, -16500, 12969},
+    {-6570, -18328, 11837},
+    {-5789, -16707, 15383},
+    {-7275, -18607, 14489},
+    {-4318, -17924, 15875},
+    {-5687, -20014, 15012},
+    {-3707, -17718, 13461},
+    {-4983, -19735, 12360},
+    {-1355, -14047, 14328},
+    {-1927, -13976, 16019},
+    {-1538, -15344, 16394},
+    {-966, -15416, 14702},
+    {898, -13246, 16619},
+    {237, -13129, 18154},
+    {480, -14489, 18380},
+    {1496, -14390, 17245},
+    {2447, -12054, 18637},
+    {1654, -11954, 19914},
+    {2400, -12687, 20865},
+    {3056, -12974, 19496},
+    {3493, -9976, 18631},
+    {3017, -9564, 19976},
+    {3995, -9894, 20742},
+    {4510, -10189, 19372},
+    {4007, -6624, 17553},
+    {3588, -6760, 19044},
+    {4644, -6404, 19631},
+    {5032, -6930, 18272},
+    {3790, -3273, 17440},
+    {3459, -3731, 18747},
+    {4407, -3343, 19360},
+    {4719, -3740, 18013},
+    {-4885, -13192, 16426},
+    {-5338, -14340, 17407},
+    {-4057, -14605, 18037},
+    {-3605, -13456, 17056},
+    {-5136, -11570, 20011},
+    {-5569, -12733, 20759},
+    {-4325, -13063, 21111},
+    {-3951, -11778, 20712},
+    {-5885, -10913, 23227},
+    {-6257, -12096, 23703},
+    {-5298, -12186, 24742},
+    {-4837, -11099, 24073},
+    {-7203, -9527, 24894},
+    {-7905, -10046, 25968},
+    {-7041, -9996, 27031},
+    {-6336, -9487, 25953},
+    {-7261, -6392, 24978},
+    {-7977, -6787, 26082},
+    {-7214, -6500, 27184},
+    {-6431, -6416, 26052},
+    {-8575, -3326, 25494},
+    {-8978, -4155, 26537},
+    {-8495, -3418, 27628},
+    {-7717, -3661, 26485},
+    {13629, -2175, -9499},
+    {13208, -1831, -6009},
+    {13735, -3738, -9227},
+    {13341, -3607, -5785},
+    {12277, -3888, -9667},
+    {11680, -3778, -6208},
+    {12172, -2325, -9939},
+    {11548, -2002, -6432},
+    {14256, -2629, -12850},
+    {14346, -4072, -12497},
+    {12959, -4156, -12696},
+    {12957, -2822, -13492},
+    {14873, -3944, -16103},
+    {14629, -5094, -15110},
+    {13607, -5365, -16222},
+    {13543, -3957, -16320},
+    {16312, -4625, -18880},
+    {16235, -5913, -18713},
+    {15399, -5966, -19925},
+    {15332, -4672, -19880},
+    {18017, -4422, -21054},
+    {18676, -5500, -21503},
+    {17743, -5403, -22638},
+    {18048, -4114, -22704},
+    {21167, -3704, -21576},
+    {21854, -4647, -21776},
+    {21349, -4568, -23144},
+    {21372, -3372, -23021},
+    {4514, 357, 19023},
+    {-9452, -107, 26658},
+    {25571, 19197, -8642},
+    {16265, 28852, -3628},
+    {14008, 14914, -780},
+    {19044, 7679, -15009},
+    {5705, 10215, -13930},
+    {3987, 23301, -6896},
+    {22696, 30231, -19617},
+    {24414, 17145, -26651},
+    {14394, 25532, -32767},
+    {12137, 11594, -29919},
+    {2831, 21249, -24905},
+    {9357, 32767, -18538},
+    {-18781, 22177, 27932},
+    {-1828, 21008, 31302},
+    {-8036, 31792, 14732},
+    {-11530, 6080, 32016},
+    {3696, 5747, 21341},
+    {5855, 21637, 10658},
+    {-21576, 23528, 5204},
+    {-16052, 8266, -4757},
+    {-23735, 7638, 15887},
+    {-9843, -2517, 11813},
+    {902, 7098, -1387},
+    {-6350, 23195, -5471},
+    {-28042, 10356, 30652},
+    {-25279, 16651, 18844},
+    {-32767, 8255, 17607},
+    {-29642, -544, 26211},
+    {-27868, -985, 11660},
+    {-25172, 9643, 7106},
+    {-17526, 13042, 28214},
+    {-20222, 2415, 32767},
+    {-12628, 3803, 22267},
+    {-20115, -4594, 21029},
+    {-17353, 1702, 9222},
+    {-15753, 12602, 13662},
+    {228, 2027, 13380},
+    {4294, 6775, 16547},
+    {6555, 1797, 11346},
+    {3364, -3985, 13292},
+    {9367, -2952, 16405},
+    {9942, 3698, 18417},
+    {-294, 4070, 21708},
+    {-869, -2581, 19697},
+    {2519, -680, 26767},
+    {4779, -5658, 21566},
+    {8845, -910, 24733},
+    {5709, 5102, 24821},
+    {32767, -2791, -24903},
+    {27263, -7807, -30030},
+    {27440, 707, -32033},
+    {28861, -9016, -19302},
+    {21119, -9366, -22970},
+    {20242, -3358, -30838},
+    {29148, 4760, -22543},
+    {23005, 3201, -15483},
+    {30026, -1249, -14675},
+    {22827, -5313, -13481},
+    {17501, -1816, -20610},
+    {21407, 4409, -26211},
+    {4860, 21934, -4668},
+    {10823, 25038, 2806},
+    {7292, 16788, 4391},
+    {-1074, 17290, 1419},
+    {1221, 17524, 12655},
+    {8574, 22313, 13513},
+    {4639, 30639, -1144},
+    {-2713, 25851, -2002},
+    {-1432, 31375, 7121},
+    {-4962, 23125, 8705},
+    {1000, 26229, 16179},
+    {6934, 30873, 10092},
+    {-683, -25010, 6073},
+    {-2787, -25499, 9063},
+    {-1506, -25527, 12312},
+    {-2602, -16414, 14048},
+    {1299, -25133, 13101},
+    {3255, -25903, 10003},
+    {2168, -25819, 6622},
+    {54, -22305, 8024},
+    {927, -22359, 11119},
+    {-4324, -15149, 13532},
+    {-5112, -15252, 16169},
+    {-3399, -16338, 16371},
+    {-3220, -14182, 15627},
+    {-9546, -87, 25803},
+    {-9979, -629, 26763},
+    {-9356, -137, 27513},
+    {3872, -61, 19309},
+    {4711, -289, 19711},
+    {-8856, 169, 26546},
+    {4242, 323, 18222},
+    {5085, 130, 18630},
+};
+constexpr m3::vec3 tree_0_normals[] = {
+    {-0.7071999907493591f, 0.3531000018119812f, -0.6126000285148621f},
+    {-0.5764999985694885f, 0.7944999933242798f, 0.19099999964237213f},
+    {-0.5763999819755554f, 0.7944999933242798f, 0.19099999964237213f},
+    {0.1574999988079071f, 0.41990000009536743f, 0.8938000202178955f},
+    {0.1574999988079071f, 0.4198000133037567f, 0.8938000202178955f},
+    {0.7229999899864197f, -0.3391999900341034f, 0.6018000245094299f},
+    {0.6240000128746033f, -0.75f, -0.21940000355243683f},
+    {-0.12489999830722809f, -0.3937999904155731f, -0.9107000231742859f},
+    {-0.8343999981880188f, 0.1437000036239624f, -0.5320000052452087f},
+    {-0.8797000050544739f, 0.33959999680519104f, 0.3328000009059906f},
+    {-0.879800021648407f, 0.33959999680519104f, 0.3327000141143799f},
+    {-0.04280000180006027f, 0.2565000057220459f, 0.9656000137329102f},
+    {-0.04280000180006027f, 0.2565999925136566f, 0.9656000137329102f},
+    {0.86080002784729f, -0.09889999777078629f, 0.4991999864578247f},
+    {0.8123999834060669f, -0.3352999985218048f, -0.47699999809265137f},
+    {0.8123999834060669f, -0.3352999985218048f, -0.4771000146865845f},
+    {0.0892999991774559f, -0.24330000579357147f, -0.9657999873161316f},
+    {-0.8069999814033508f, -0.00839999970048666f, -0.590399980545044f},
+    {-0.8069999814033508f, -0.00839999970048666f, -0.590499997138977f},
+    {-0.7961000204086304f, 0.5527999997138977f, 0.24629999697208405f},
+    {-0.0737999975681305f, 0.6055999994277954f, 0.7922999858856201f},
+    {0.8270000219345093f, 0.05380000174045563f, 0.5595999956130981f},
+    {0.8087000250816345f, -0.5353000164031982f, -0.24400000274181366f},
+    {0.8086000084877014f, -0.5353000164031982f, -0.24400000274181366f},
+    {0.03359999880194664f, -0.5907999873161316f, -0.8061000108718872f},
+    {0.03370000049471855f, -0.5907999873161316f, -0.8061000108718872f},
+    {-0.8611999750137329f, -0.10400000214576721f, -0.4975000023841858f},
+    {-0.8611999750137329f, -0.10400000214576721f, -0.4973999857902527f},
+    {-0.8787000179290771f, 0.3968999981880188f, 0.2653000056743622f},
+    {0.03830000013113022f, 0.5121999979019165f, 0.8579999804496765f},
+    {0.8632000088691711f, 0.09179999679327011f, 0.49639999866485596f},
+    {0.8629000186920166f, 0.0908999964594841f, 0.49709999561309814f},
+    {0.9036999940872192f, -0.3409000039100647f, -0.2590999901294708f},
+    {-0.039900001138448715f, -0.47049999237060547f, -0.8815000057220459f},
+    {-0.039900001138448715f, -0.47040000557899475f, -0.8815000057220459f},
+    {-0.7139999866485596f, -0.5949000120162964f, -0.36910000443458557f},
+    {-0.7141000032424927f, -0.5949000120162964f, -0.36899998784065247f},
+    {-0.9204000234603882f, 0.022199999541044235f, 0.3901999890804291f},
+    {-0.9204999804496765f, 0.022199999541044235f, 0.3901999890804291f},
+    {-0.9204000234603882f, 0.022199999541044235f, 0.3903000056743622f},
+    {-0.14669999480247498f, 0.669700026512146f, 0.7279999852180481f},
+    {-0.1467999964952469f, 0.669700026512146f, 0.7279999852180481f},
+    {0.6693000197410583f, 0.6402999758720398f, 0.376800000667572f},
+    {0.6693999767303467f, 0.6402999758720398f, 0.376800000667572f},
+    {0.9168999791145325f, -0.01940000057220459f, -0.3986999988555908f},
+    {0.9168999791145325f, -0.01940000057220459f, -0.3986000120639801f},
+    {0.15880000591278076f, -0.6287000179290771f, -0.7612000107765198f},
+    {0.15889999270439148f, -0.6287000179290771f, -0.7612000107765198f},
+    {-0.7652999758720398f, -0.1559000015258789f, -0.6244999766349792f},
+    {-0.9287999868392944f, -0.13009999692440033f, 0.34709998965263367f},
+    {-0.08860000222921371f, 0.0478999987244606f, 0.9948999881744385f},
+    {0.7694000005722046f, 0.18490000069141388f, 0.6114000082015991f},
+    {0.9151999950408936f, 0.19439999759197235f, -0.3528999984264374f},
+    {-0.053300000727176666f, -0.04470000043511391f, -0.9976000189781189f},
+    {-0.6868000030517578f, -0.34040001034736633f, -0.6421999931335449f},
+    {-0.6642000079154968f, -0.720300018787384f, 0.20029999315738678f},
+    {0.046300001442432404f, -0.35929998755455017f, 0.9320999979972839f},
+    {0.6660000085830688f, 0.3603000044822693f, 0.6531999707221985f},
+    {0.6660000085830688f, 0.3603000044822693f, 0.6531000137329102f},
+    {0.6097999811172485f, 0.7728999853134155f, -0.17550000548362732f},
+    {0.6097999811172485f, 0.7728000283241272f, -0.17550000548362732f},
+    {-0.08699999749660492f, 0.3953000009059906f, -0.9143999814987183f},
+    {-0.08699999749660492f, 0.3953999876976013f, -0.9143999814987183f},
+    {-0.8148999810218811f, -0.09019999951124191f, -0.5726000070571899f},
+    {-0.8148000240325928f, -0.09019999951124191f, -0.5726000070571899f},
+    {-0.864799976348877f, -0.19519999623298645f, 0.4625000059604645f},
+    {-0.864799976348877f, -0.19519999623298645f, 0.4625999927520752f},
+    {-0.18880000710487366f, -0.10270000249147415f, 0.9765999913215637f},
+    {0.8375999927520752f, 0.11089999973773956f, 0.5349000096321106f},
+    {0.8375999927520752f, 0.11089999973773956f, 0.5347999930381775f},
+    {0.8952000141143799f, 0.19949999451637268f, -0.3984000086784363f},
+    {0.14380000531673431f, 0.0925000011920929f, -0.9853000044822693f},
+    {-0.8363999724388123f, 0.20280000567436218f, -0.5091999769210815f},
+    {-0.9082000255584717f, 0.1379999965429306f, 0.3952000141143799f},
+    {-0.2078000009059906f, 0.002300000051036477f, 0.9782000184059143f},
+    {-0.2076999992132187f, 0.002300000051036477f, 0.9782000184059143f},
+    {0.8190000057220459f, -0.13279999792575836f, 0.5583000183105469f},
+    {0.8190000057220459f, -0.13279999792575836f, 0.5582000017166138f},
+    {0.9103000164031982f, -0.13490000367164612f, -0.3912999927997589f},
+    {0.19099999964237213f, 0.020500000566244125f, -0.9814000129699707f},
+    {0.19099999964237213f, 0.020600000396370888f, -0.9814000129699707f},
+    {-0.6646999716758728f, -0.093299999833107f, -0.7412999868392944f},
+    {-0.9487000107765198f, -0.14669999480247498f, 0.2802000045776367f},
+    {-0.09799999743700027f, 0.012299999594688416f, 0.9951000213623047f},
+    {0.6772000193595886f, 0.10279999673366547f, 0.728600025177002f},
+    {0.9692999720573425f, 0.15639999508857727f, -0.18950000405311584f},
+    {0.09939999878406525f, 0.03799999877810478f, -0.9943000078201294f},
+    {0.18860000371932983f, 0.11749999970197678f, -0.9750000238418579f},
+    {0.18860000371932983f, 0.11739999800920486f, -0.9750000238418579f},
+    {-0.45570001006126404f, -0.8687000274658203f, -0.19419999420642853f},
+    {-0.25519999861717224f, -0.08349999785423279f, 0.9632999897003174f},
+    {0.38760000467300415f, 0.9035999774932861f, 0.18219999969005585f},
+    {0.24330000579357147f, 0.24809999763965607f, -0.9376999735832214f},
+    {-0.4474000036716461f, -0.82669997215271f, -0.34119999408721924f},
+    {-0.2709999978542328f, -0.22509999573230743f, 0.9358999729156494f},
+    {0.41190001368522644f, 0.8460999727249146f, 0.3382999897003174f},
+    {-0.1446000039577484f, 0.5649999976158142f, -0.8123000264167786f},
+    {-0.1446000039577484f, 0.5648999810218811f, -0.8123000264167786f},
+    {-0.8398000001907349f, -0.5009999871253967f, -0.20919999480247498f},
+    {0.21739999949932098f, -0.4984999895095825f, 0.8392000198364258f},
+    {0.8438000082969666f, 0.44609999656677246f, 0.2985000014305115f},
+    {0.8438000082969666f, 0.44609999656677246f, 0.29840001463890076f},
+    {-0.7283999919891357f, 0.6633999943733215f, -0.1712999939918518f},
+    {-0.3095000088214874f, -0.09269999712705612f, 0.946399986743927f},
+    {0.7757999897003174f, -0.5995000004768372f, 0.19679999351501465f},
+    {0.35670000314712524f, 0.15649999678134918f, -0.9210000038146973f},
+    {0.35670000314712524f, 0.15639999508857727f, -0.9210000038146973f},
+    {-0.21310000121593475f, 0.9656000137329102f, -0.14920000731945038f},
+    {-0.21299999952316284f, 0.9656000137329102f, -0.14920000731945038f},
+    {-0.590399980545044f, -0.0038999998942017555f, 0.8070999979972839f},
+    {0.2498999983072281f, -0.9539999961853027f, 0.16539999842643738f},
+    {0.6061000227928162f, 0.011300000362098217f, -0.7953000068664551f},
+    {0.6061000227928162f, 0.01119999960064888f, -0.7953000068664551f},
+    {-0.36039999127388f, 0.8851000070571899f, -0.2944999933242798f},
+    {-0.36039999127388f, 0.8851000070571899f, -0.2946000099182129f},
+    {-0.6779000163078308f, -0.03229999914765358f, 0.7343999743461609f},
+    {0.38909998536109924f, -0.84170001745224f, 0.37450000643730164f},
+    {0.38909998536109924f, -0.84170001745224f, 0.37439998984336853f},
+    {0.6970000267028809f, 0.07819999754428864f, -0.7128000259399414f},
+    {0.6970000267028809f, 0.07819999754428864f, -0.7127000093460083f},
+    {-0.7268999814987183f, 0.4474000036716461f, -0.5210000276565552f},
+    {-0.7268999814987183f, 0.4474000036716461f, -0.5209000110626221f},
+    {-0.41429999470710754f, 0.2793999910354614f, 0.8661999702453613f},
+    {0.7501000165939331f, -0.4343999922275543f, 0.49869999289512634f},
+    {0.41929998993873596f, -0.26109999418258667f, -0.8694999814033508f},
+    {-0.8970000147819519f, 0.03400000184774399f, -0.4406000077724457f},
+    {-0.8970000147819519f, 0.03400000184774399f, -0.4406999945640564f},
+    {-0.40790000557899475f, 0.2953000068664551f, 0.8640000224113464f},
+    {-0.40790000557899475f, 0.2953000068664551f, 0.8639000058174133f},
+    {0.9162999987602234f, -0.0820000022649765f, 0.3919999897480011f},
+    {0.9162999987602234f, -0.08190000057220459f, 0.3919999897480011f},
+    {0.9162999987602234f, -0.0820000022649765f, 0.3919000029563904f},
+    {0.37929999828338623f, -0.2833000123500824f, -0.8808000087738037f},
+    {-0.9301000237464905f, -0.0731000006198883f, -0.36010000109672546f},
+    {-0.9300000071525574f, -0.0731000006198883f, -0.36010000109672546f},
+    {-0.39089998602867126f, 0.03200000151991844f, 0.9199000000953674f},
+    {0.9452000260353088f, 0.11699999868869781f, 0.30469998717308044f},
+    {0.9452000260353088f, 0.11710000038146973f, 0.30469998717308044f},
+    {0.4645000100135803f, 0.00839999970048666f, -0.8855000138282776f},
+    {-0.9438999891281128f, 0.23980000615119934f, -0.22699999809265137f},
+    {-0.3319000005722046f, -0.8180999755859375f, 0.46959999203681946f},
+    {0.9419999718666077f, -0.22310000658035278f, 0.2506999969482422f},
+    {0.3262999951839447f, 0.8331999778747559f, -0.446399986743927f},
+    {0.3264000117778778f, 0.8331999778747559f, -0.446399986743927f},
+    {-0.9211999773979187f, 0.1914999932050705f, -0.3386000096797943f},
+    {-0.2768999934196472f, -0.9419000148773193f, 0.19020000100135803f},
+    {0.9049999713897705f, -0.18479999899864197f, 0.3831000030040741f},
+    {0.9050999879837036f, -0.18479999899864197f, 0.3831000030040741f},
+    {0.23190000653266907f, 0.9587000012397766f, -0.1647000014781952f},
+    {0.23180000483989716f, 0.9587000012397766f, -0.1647000014781952f},
+    {-0.7077000141143799f, 0.01209999993443489f, -0.7063999772071838f},
+    {-0.4474000036716461f, -0.7605999708175659f, 0.47049999237060547f},
+    {0.7113000154495239f, 0.021199999377131462f, 0.7026000022888184f},
+    {0.40220001339912415f, 0.8004000186920166f, -0.444599986076355f},
+    {-0.7538999915122986f, 0.00039999998989515007f, -0.6570000052452087f},
+    {-0.7200999855995178f, -0.06129999831318855f, 0.6912000179290771f},
+    {-0.7200999855995178f, -0.06129999831318855f, 0.691100001335144f},
+    {0.7314000129699707f, 0.014800000004470348f, 0.6818000078201294f},
+    {0.6711999773979187f, 0.028599999845027924f, -0.7407000064849854f},
+    {-0.7336000204086304f, -0.24809999763965607f, -0.6327000260353088f},
+    {-0.6234999895095825f, -0.3522000014781952f, 0.6980000138282776f},
+    {-0.6234999895095825f, -0.3522000014781952f, 0.6980999708175659f},
+    {0.7013000249862671f, 0.23119999468326569f, 0.6743000149726868f},
+    {0.7013999819755554f, 0.23119999468326569f, 0.6743000149726868f},
+    {0.6468999981880188f, 0.37959998846054077f, -0.6614000201225281f},
+    {0.9847000241279602f, 0.09200000017881393f, 0.14830000698566437f},
+    {0.0851999968290329f, -0.9944999814033508f, 0.060499999672174454f},
+    {-0.9703999757766724f, -0.09809999912977219f, -0.2207999974489212f},
+    {-0.07090000063180923f, 0.9886000156402588f, -0.133200004696846f},
+    {0.9689000248908997f, 0.10000000149011612f, 0.226500004529953f},
+    {0.06400000303983688f, -0.9873999953269958f, 0.14470000565052032f},
+    {-0.9581999778747559f, -0.1046999990940094f, -0.2660999894142151f},
+    {-0.05290000140666962f, 0.9801999926567078f, -0.19089999794960022f},
+    {0.9753000140190125f, 0.1014999970793724f, 0.1964000016450882f},
+    {0.009399999864399433f, -0.9151999950408936f, 0.40290001034736633f},
+    {-0.9753000140190125f, -0.09529999643564224f, -0.19910000264644623f},
+    {0.03970000147819519f, 0.8920999765396118f, -0.45010000467300415f},
+    {0.03970000147819519f, 0.8920999765396118f, -0.44999998807907104f},
+    {0.866599977016449f, 0.1316000074148178f, 0.4814000129699707f},
+    {0.053300000727176666f, -0.9703999757766724f, 0.23569999635219574f},
+    {-0.8425999879837036f, -0.06909999996423721f, -0.5340999960899353f},
+    {0.09669999778270721f, 0.9779000282287598f, -0.18520000576972961f},
+    {0.6434999704360962f, 0.03750000149011612f, 0.7645000219345093f},
+    {0.03480000048875809f, -0.9886999726295471f, -0.14589999616146088f},
+    {-0.6100999712944031f, -0.011500000022351742f, -0.7922000288963318f},
+    {-0.6100999712944031f, -0.011599999852478504f, -0.7922000288963318f},
+    {-0.11779999732971191f, 0.9883000254631042f, 0.09669999778270721f},
+    {0.121799997985363f, -0.2362000048160553f, 0.9639999866485596f},
+    {0.19480000436306f, -0.9661999940872192f, -0.16869999468326569f},
+    {0.19480000436306f, -0.9661999940872192f, -0.16859999299049377f},
+    {-0.10050000250339508f, -0.01489999983459711f, -0.9947999715805054f},
+    {-0.10050000250339508f, -0.014800000004470348f, -0.9947999715805054f},
+    {-0.1867000013589859f, 0.9567999839782715f, 0.22300000488758087f},
+    {-0.1868000030517578f, 0.9567999839782715f, 0.22300000488758087f},
+    {-0.7422000169754028f, 0.08820000290870667f, -0.6643000245094299f},
+    {-0.7422000169754028f, 0.08820000290870667f, -0.6643999814987183f},
+    {-0.9061999917030334f, 0.07769999653100967f, 0.4156000018119812f},
+    {-0.2092999964952469f, 0.10540000349283218f, 0.9721999764442444f},
+    {-0.2092999964952469f, 0.10540000349283218f, 0.972100019454956f},
+    {0.8043000102043152f, 0.08299999684095383f, 0.5884000062942505f},
+    {0.8043000102043152f, 0.08299999684095383f, 0.5882999897003174f},
+    {0.9574000239372253f, 0.0771000012755394f, -0.2782999873161316f},
+    {0.09309999644756317f, 0.06930000334978104f, -0.9932000041007996f},
+    {-0.301800012588501f, 0.5333999991416931f, -0.7901999950408936f},
+    {-0.30169999599456787f, 0.5333999991416931f, -0.7901999950408936f},
+    {0.006000000052154064f, 0.9998000264167786f, 0.020099999383091927f},
+    {0.4544000029563904f, 0.4832000136375427f, 0.7483999729156494f},
+    {0.7264000177383423f, -0.16120000183582306f, 0.6680999994277954f},
+    {0.7264000177383423f, -0.16120000183582306f, 0.6682000160217285f},
+    {0.4357999861240387f, -0.8736000061035156f, -0.21649999916553497f},
+    {0.4357999861240387f, -0.8736000061035156f, -0.21639999747276306f},
+    {0.026900000870227814f, -0.38989999890327454f, -0.9204999804496765f},
+    {-0.692799985408783f, -0.19050000607967377f, -0.6955000162124634f},
+    {-0.692799985408783f, -0.19059999287128448f, -0.6955000162124634f},
+    {-0.43950000405311584f, -0.8700000047683716f, 0.22360000014305115f},
+    {-0.12129999697208405f, -0.20010000467300415f, 0.9721999764442444f},
+    {-0.12129999697208405f, -0.20010000467300415f, 0.9722999930381775f},
+    {0.27869999408721924f, 0.49880000948905945f, 0.8206999897956848f},
+    {0.14650000631809235f, 0.9886000156402588f, -0.03350000083446503f},
+    {0.14650000631809235f, 0.9886000156402588f, -0.033399999141693115f},
+    {-0.2768000066280365f, 0.5320000052452087f, -0.8001999855041504f},
+    {-0.8016999959945679f, 0.5189999938011169f, -0.2964000105857849f},
+    {-0.16779999434947968f, -0.13680000603199005f, 0.9763000011444092f},
+    {-0.16779999434947968f, -0.13670000433921814f, 0.9763000011444092f},
+    {0.6449000239372253f, -0.6912000179290771f, 0.3260999917984009f},
+    {0.6449000239372253f, -0.6912000179290771f, 0.326200008392334f},
+    {0.27630001306533813f, 0.09059999883174896f, -0.9567999839782715f},
+    {-0.29350000619888306f, 0.9380000233650208f, -0.1843000054359436f},
+    {-0.29339998960494995f, 0.9380000233650208f, -0.1843000054359436f},
+    {-0.14550000429153442f, 0.2703000009059906f, 0.95169997215271f},
+    {-0.14550000429153442f, 0.2702000141143799f, 0.95169997215271f},
+    {0.4375f, -0.8672000169754028f, 0.2379000037908554f},
+    {0.20280000567436218f, -0.02199999988079071f, -0.9789999723434448f},
+    {-0.953499972820282f, 0.1688999980688095f, -0.24940000474452972f},
+    {-0.953499972820282f, 0.16899999976158142f, -0.24940000474452972f},
+    {-0.41370001435279846f, -0.060100000351667404f, 0.9083999991416931f},
+    {0.9301999807357788f, -0.13539999723434448f, 0.3411000072956085f},
+    {0.4422999918460846f, 0.06759999692440033f, -0.8942999839782715f},
+    {-0.9208999872207642f, 0.14229999482631683f, -0.3630000054836273f},
+    {-0.44279998540878296f, -0.6456999778747559f, 0.6220999956130981f},
+    {0.9021999835968018f, 0.03750000149011612f, 0.42980000376701355f},
+    {0.21649999916553497f, 0.7663999795913696f, -0.6047999858856201f},
+    {0.21580000221729279f, 0.7667999863624573f, -0.6046000123023987f},
+    {-0.771399974822998f, -0.2003999948501587f, -0.6039999723434448f},
+    {-0.5612999796867371f, -0.20819999277591705f, 0.8009999990463257f},
+    {0.7480999827384949f, 0.22689999639987946f, 0.6236000061035156f},
+    {0.5719000101089478f, 0.1891999989748001f, -0.7982000112533569f},
+    {0.5719000101089478f, 0.1890999972820282f, -0.7982000112533569f},
+    {0.07609999924898148f, 0.8956999778747559f, 0.43799999356269836f},
+    {0.07620000094175339f, 0.8956999778747559f, 0.43799999356269836f},
+    {0.07620000094175339f, 0.895799994468689f, 0.43799999356269836f},
+    {0.07609999924898148f, 0.895799994468689f, 0.43799999356269836f},
+    {0.029500000178813934f, 0.8902000188827515f, 0.4546999931335449f},
+    {0.9093999862670898f, -0.05220000073313713f, -0.41269999742507935f},
+    {-0.6650000214576721f, 0.7360000014305115f, 0.12690000236034393f},
+    {-0.39640000462532043f, 0.9132999777793884f, 0.0934000015258789f},
+    {0.9484999775886536f, 0.2881999909877777f, -0.13130000233650208f},
+    {-0.34850001335144043f, -0.1573999971151352f, 0.9240000247955322f},
+    {-0.7687000036239624f, -0.5694000124931335f, -0.2913999855518341f},
+    {-0.7687000036239624f, -0.5694000124931335f, -0.2912999987602234f},
+    {0.7301999926567078f, 0.5932000279426575f, 0.33889999985694885f},
+    {0.289900004863739f, 0.1599999964237213f, -0.9435999989509583f},
+    {-0.3440000116825104f, -0.03139999881386757f, 0.9383999705314636f},
+    {-0.538100004196167f, -0.8174999952316284f, -0.20499999821186066f},
+    {0.49540001153945923f, 0.8457000255584717f, 0.19850000739097595f},
+    {0.30149999260902405f, 0.0568000003695488f, -0.9517999887466431f},
+    {0.4300999939441681f, 0.07069999724626541f, 0.8999999761581421f},
+    {0.5203999876976013f, -0.5817000269889832f, 0.6251999735832214f},
+    {-0.12489999830722809f, -0.8583999872207642f, 0.4975000023841858f},
+    {-0.6140000224113464f, -0.37709999084472656f, 0.6934000253677368f},
+    {-0.2709999978542328f, 0.19709999859333038f, 0.9422000050544739f},
+    {0.6140000224113464f, 0.37709999084472656f, -0.6934000253677368f},
+    {0.2709999978542328f, -0.19709999859333038f, -0.9422000050544739f},
+    {-0.4300999939441681f, -0.07069999724626541f, -0.8999999761581421f},
+    {-0.5203999876976013f, 0.5817000269889832f, -0.6251999735832214f},
+    {0.12489999830722809f, 0.8583999872207642f, -0.4975000023841858f},
+    {0.7123000025749207f, 0.5425999760627747f, 0.44510000944137573f},
+    {0.8583999872207642f, -0.5128999948501587f, 0.00039999998989515007f},
+    {-0.18569999933242798f, -0.9606999754905701f, -0.2062000036239624f},
+    {-0.9769999980926514f, -0.1818999946117401f, 0.11079999804496765f},
+    {-0.4221000075340271f, 0.7472000122070312f, 0.5134000182151794f},
+    {0.9769999980926514f, 0.1818999946117401f, -0.11079999804496765f},
+    {0.4221000075340271f, -0.7472000122070312f, -0.5134000182151794f},
+    {-0.7123000025749207f, -0.5425999760627747f, -0.44510000944137573f},
+    {-0.8583999872207642f, 0.5128999948501587f, -0.00039999998989515007f},
+    {0.18569999933242798f, 0.9606999754905701f, 0.2062000036239624f},
+    {-0.04690000042319298f, 0.7567999958992004f, 0.6520000100135803f},
+    {-0.13660000264644623f, 0.13040000200271606f, 0.9819999933242798f},
+    {0.4406999945640564f, -0.26980000734329224f, 0.8561999797821045f},
+    {0.8871999979019165f, 0.10909999907016754f, 0.44839999079704285f},
+    {0.5857999920845032f, 0.7436000108718872f, 0.3222000002861023f},
+    {-0.8871999979019165f, -0.10909999907016754f, -0.44839999079704285f},
+    {-0.5857999920845032f, -0.7436000108718872f, -0.3222000002861023f},
+    {0.04690000042319298f, -0.7567999958992004f, -0.6520000100135803f},
+    {0.13660000264644623f, -0.13040000200271606f, -0.9819999933242798f},
+    {-0.4406999945640564f, 0.26980000734329224f, -0.8561999797821045f},
+    {-0.554099977016449f, 0.8181999921798706f, 0.15369999408721924f},
+    {-0.6992999911308289f, -0.19529999792575836f, 0.6876999735832214f},
+    {0.23479999601840973f, -0.8429999947547913f, 0.48410001397132874f},
+    {0.9573000073432922f, -0.2296999990940094f, -0.17579999566078186f},
+    {0.46970000863075256f, 0.7968999743461609f, -0.3799000084400177f},
+    {-0.9573000073432922f, 0.2296999990940094f, 0.17579999566078186f},
+    {-0.46970000863075256f, -0.7968999743461609f, 0.3799000084400177f},
+    {0.554099977016449f, -0.8181999921798706f, -0.15369999408721924f},
+    {0.6992999911308289f, 0.19529999792575836f, -0.6876999735832214f},
+    {-0.23479999601840973f, 0.8429999947547913f, -0.48410001397132874f},
+    {-0.7235000133514404f, 0.6549999713897705f, 0.21799999475479126f},
+    {-0.8988999724388123f, -0.0007999999797903001f, 0.4381999969482422f},
+    {-0.8919000029563904f, -0.43320000171661377f, -0.12950000166893005f},
+    {-0.7121999859809875f, -0.04470000043511391f, -0.7005000114440918f},
+    {-0.6080999970436096f, 0.6277999877929688f, -0.48579999804496765f},
+    {0.7121999859809875f, 0.04470000043511391f, 0.7005000114440918f},
+    {0.6080999970436096f, -0.6277999877929688f, 0.48579999804496765f},
+    {0.7235000133514404f, -0.6549999713897705f, -0.21799999475479126f},
+    {0.8988999724388123f, 0.0007999999797903001f, -0.4381999969482422f},
+    {0.8919000029563904f, 0.43320000171661377f, 0.12950000166893005f},
+    {-0.11079999804496765f, 0.8375999927520752f, 0.5350000262260437f},
+    {-0.3946000039577484f, -0.22349999845027924f, 0.8913000226020813f},
+    {-0.3833000063896179f, -0.9232000112533569f, -0.0272000003606081f},
+    {-0.0925000011920929f, -0.2946000099182129f, -0.9510999917984009f},
+    {0.07590000331401825f, 0.7936000227928162f, -0.6036999821662903f},
+    {0.0925000011920929f, 0.2946000099182129f, 0.9510999917984009f},
+    {-0.07590000331401825f, -0.7936000227928162f, 0.6036999821662903f},
+    {0.11079999804496765f, -0.8375999927520752f, -0.5350000262260437f},
+    {0.3946000039577484f, 0.22349999845027924f, -0.8913000226020813f},
+    {0.3833000063896179f, 0.9232000112533569f, 0.0272000003606081f},
+    {-0.17170000076293945f, 0.5737000107765198f, -0.8008999824523926f},
+    {-0.23469999432563782f, -0.11800000071525574f, -0.964900016784668f},
+    {0.3846000134944916f, -0.43810001015663147f, -0.8125f},
+    {0.8305000066757202f, 0.05570000037550926f, -0.5543000102043152f},
+    {0.48660001158714294f, 0.6809999942779541f, -0.5471000075340271f},
+    {-0.8305000066757202f, -0.05570000037550926f, 0.5543000102043152f},
+    {-0.48660001158714294f, -0.6809999942779541f, 0.5471000075340271f},
+    {0.17170000076293945f, -0.5737000107765198f, 0.8008999824523926f},
+    {0.23469999432563782f, 0.11800000071525574f, 0.964900016784668f},
+    {-0.3846000134944916f, 0.43810001015663147f, 0.8125f},
+    {-0.6358000040054321f, 0.7196999788284302f, -0.27889999747276306f},
+    {-0.7378000020980835f, -0.399399995803833f, -0.5442000031471252f},
+    {0.26429998874664307f, -0.9174000024795532f, -0.29760000109672546f},
+    {0.9857000112533569f, -0.11829999834299088f, 0.12020000070333481f},
+    {0.4293000102043152f, 0.8934999704360962f, 0.13179999589920044f},
+    {-0.9857000112533569f, 0.11829999834299088f, -0.12020000070333481f},
+    {-0.4293000102043152f, -0.8934999704360962f, -0.13179999589920044f},
+    {0.6358000040054321f, -0.7196999788284302f, 0.27889999747276306f},
+    {0.7378000020980835f, 0.399399995803833f, 0.5442000031471252f},
+    {-0.26429998874664307f, 0.9174000024795532f, 0.29760000109672546f},
+    {0.6480000019073486f, -0.15189999341964722f, -0.7462999820709229f},
+    {0.7243000268936157f, -0.6470999717712402f, -0.23819999396800995f},
+    {0.09880000352859497f, -0.9819999933242798f, -0.16099999845027924f},
+    {-0.36390000581741333f, -0.6937999725341797f, -0.6215000152587891f},
+    {-0.02449999935925007f, -0.18070000410079956f, -0.9832000136375427f},
+    {0.36390000581741333f, 0.6937999725341797f, 0.6215000152587891f},
+    {0.02449999935925007f, 0.18070000410079956f, 0.9832000136375427f},
+    {-0.6480000019073486f, 0.15189999341964722f, 0.7462999820709229f},
+    {-0.7243000268936157f, 0.6470999717712402f, 0.23819999396800995f},
+    {-0.09880000352859497f, 0.9819999933242798f, 0.16099999845027924f},
+    {0.7493000030517578f, 0.48820000886917114f, -0.4474000036716461f},
+    {0.8726999759674072f, -0.31299999356269836f, 0.3747999966144562f},
+    {-0.13930000364780426f, -0.8550000190734863f, 0.49959999322891235f},
+    {-0.8881000280380249f, -0.3885999917984009f, -0.24539999663829803f},
+    {-0.33889999985694885f, 0.4415000081062317f, -0.8307999968528748f},
+    {0.8881000280380249f, 0.3885999917984009f, 0.24539999663829803f},
+    {0.33889999985694885f, -0.4415000081062317f, 0.8307999968528748f},
+    {-0.7493000030517578f, -0.48820000886917114f, 0.44749999046325684f},
+    {-0.8726999759674072f, 0.31299999356269836f, -0.3747999966144562f},
+    {0.13930000364780426f, 0.8550000190734863f, -0.49959999322891235f},
+    {0.722000002861023f, -0.40959998965263367f, -0.557699978351593f},
+    {0.11649999767541885f, -0.7836999893188477f, -0.6100999712944031f},
+    {-0.06880000233650208f, -0.9965999722480774f, 0.04540000110864639f},
+    {0.4223000109195709f, -0.7541000247001648f, 0.5029000043869019f},
+    {0.9110000133514404f, -0.391400009393692f, 0.13030000030994415f},
+    {-0.4223000109195709f, 0.7541000247001648f, -0.5029000043869019f},
+    {-0.9110000133514404f, 0.391400009393692f, -0.13030000030994415f},
+    {-0.722000002861023f, 0.40959998965263367f, 0.5576000213623047f},
+    {-0.11649999767541885f, 0.7836999893188477f, 0.6100999712944031f},
+    {0.06870000064373016f, 0.9965999722480774f, -0.04529999941587448f},
+    {0.586899995803833f, 0.2590999901294708f, -0.7670999765396118f},
+    {-0.3928000032901764f, -0.34610000252723694f, -0.8519999980926514f},
+    {-0.6924999952316284f, -0.6905999779701233f, 0.2085999995470047f},
+    {0.10199999809265137f, -0.29829999804496765f, 0.9490000009536743f},
+    {0.8927000164985657f, 0.28859999775886536f, 0.34599998593330383f},
+    {-0.10199999809265137f, 0.29829999804496765f, -0.9490000009536743f},
+    {-0.8927000164985657f, -0.28859999775886536f, -0.34599998593330383f},
+    {-0.586899995803833f, -0.2590999901294708f, 0.7670999765396118f},
+    {0.3928000032901764f, 0.34610000252723694f, 0.8519999980926514f},
+    {0.6924999952316284f, 0.6905999779701233f, -0.2085999995470047f},
+};
+constexpr face tree_0_faces[] = {
+    {0, 4, 0, 0},
+    {4, 4, 0, 2},
+    {8, 4, 0, 3},
+    {12, 4, 0, 5},
+    {16, 4, 0, 6},
+    {20, 4, 0, 7},
+    {24, 4, 0, 8},
+    {28, 4, 0, 9},
+    {32, 4, 0, 11},
+    {36, 4, 0, 13},
+    {40, 4, 0, 14},
+    {44, 4, 0, 16},
+    {48, 4, 0, 17},
+    {52, 4, 0, 19},
+    {56, 4, 0, 20},
+    {60, 4, 0, 21},
+    {64, 4, 0, 23},
+    {68, 4, 0, 25},
+    {72, 4, 0, 27},
+    {76, 4, 0, 28},
+    {80, 4, 0, 29},
+    {84, 4, 0, 31},
+    {88, 4, 0, 32},
+    {92, 4, 0, 33},
+    {96, 4, 0, 36},
+    {100, 4, 0, 39},
+    {104, 4, 0, 41},
+    {108, 4, 0, 42},
+    {112, 4, 0, 44},
+    {116, 4, 0, 46},
+    {120, 4, 0, 48},
+    {124, 4, 0, 49},
+    {128, 4, 0, 50},
+    {132, 4, 0, 51},
+    {136, 4, 0, 52},
+    {140, 4, 0, 53},
+    {144, 4, 0, 54},
+    {148, 4, 0, 55},
+    {152, 4, 0, 56},
+    {156, 4, 0, 58},
+    {160, 4, 0, 59},
+    {164, 4, 0, 61},
+    {168, 4, 0, 64},
+    {172, 4, 0, 65},
+    {176, 4, 0, 67},
+    {180, 4, 0, 69},
+    {184, 4, 0, 70},
+    {188, 4, 0, 71},
+    {192, 4, 0, 72},
+    {196, 4, 0, 73},
+    {200, 4, 0, 75},
+    {204, 4, 0, 77},
+    {208, 4, 0, 78},
+    {212, 4, 0, 80},
+    {216, 4, 0, 81},
+    {220, 4, 0, 82},
+    {224, 4, 0, 83},
+    {228, 4, 0, 84},
+    {232, 4, 0, 85},
+    {236, 4, 0, 86},
+    {240, 4, 0, 88},
+    {244, 4, 0, 89},
+    {248, 4, 0, 90},
+    {252, 4, 0, 91},
+    {256, 4, 0, 92},
+    {260, 4, 0, 93},
+    {264, 4, 0, 94},
+    {268, 4, 0, 95},
+    {272, 4, 0, 96},
+    {276, 4, 0, 98},
+    {280, 4, 0, 99},
+    {284, 4, 0, 100},
+    {288, 4, 0, 102},
+    {292, 4, 0, 103},
+    {296, 4, 0, 104},
+    {300, 4, 0, 106},
+    {304, 4, 0, 107},
+    {308, 4, 0, 109},
+    {312, 4, 0, 110},
+    {316, 4, 0, 112},
+    {320, 4, 0, 113},
+    {324, 4, 0, 115},
+    {328, 4, 0, 116},
+    {332, 4, 0, 118},
+    {336, 4, 0, 121},
+    {340, 4, 0, 122},
+    {344, 4, 0, 123},
+    {348, 4, 0, 124},
+    {352, 4, 0, 126},
+    {356, 4, 0, 127},
+    {360, 4, 0, 131},
+    {364, 4, 0, 132},
+    {368, 4, 0, 134},
+    {372, 4, 0, 135},
+    {376, 4, 0, 136},
+    {380, 4, 0, 138},
+    {384, 4, 0, 139},
+    {388, 4, 0, 140},
+    {392, 4, 0, 141},
+    {396, 4, 0, 143},
+    {400, 4, 0, 144},
+    {404, 4, 0, 145},
+    {408, 4, 0, 146},
+    {412, 4, 0, 149},
+    {416, 4, 0, 150},
+    {420, 4, 0, 151},
+    {424, 4, 0, 152},
+    {428, 4, 0, 153},
+    {432, 4, 0, 154},
+    {436, 4, 0, 155},
+    {440, 4, 0, 157},
+    {444, 4, 0, 158},
+    {448, 4, 0, 159},
+    {452, 4, 0, 160},
+    {456, 4, 0, 162},
+    {460, 4, 0, 164},
+    {464, 4, 0, 165},
+    {468, 4, 0, 166},
+    {472, 4, 0, 167},
+    {476, 4, 0, 168},
+    {480, 4, 0, 169},
+    {484, 4, 0, 170},
+    {488, 4, 0, 171},
+    {492, 4, 0, 172},
+    {496, 4, 0, 173},
+    {500, 4, 0, 174},
+    {504, 4, 0, 175},
+    {508, 4, 0, 177},
+    {512, 4, 0, 178},
+    {516, 4, 0, 179},
+    {520, 4, 0, 180},
+    {524, 4, 0, 181},
+    {528, 4, 0, 182},
+    {532, 4, 0, 183},
+    {536, 4, 0, 185},
+    {540, 4, 0, 186},
+    {544, 4, 0, 187},
+    {548, 4, 0, 189},
+    {552, 4, 0, 191},
+    {556, 4, 0, 192},
+    {560, 4, 0, 195},
+    {564, 4, 0, 196},
+    {568, 4, 0, 198},
+    {572, 4, 0, 199},
+    {576, 4, 0, 201},
+    {580, 4, 0, 202},
+    {584, 4, 0, 204},
+    {588, 4, 0, 205},
+    {592, 4, 0, 206},
+    {596, 4, 0, 207},
+    {600, 4, 0, 210},
+    {604, 4, 0, 211},
+    {608, 4, 0, 213},
+    {612, 4, 0, 214},
+    {616, 4, 0, 215},
+    {620, 4, 0, 217},
+    {624, 4, 0, 218},
+    {628, 4, 0, 220},
+    {632, 4, 0, 221},
+    {636, 4, 0, 223},
+    {640, 4, 0, 225},
+    {644, 4, 0, 226},
+    {648, 4, 0, 228},
+    {652, 4, 0, 230},
+    {656, 4, 0, 231},
+    {660, 4, 0, 232},
+    {664, 4, 0, 234},
+    {668, 4, 0, 235},
+    {672, 4, 0, 236},
+    {676, 4, 0, 237},
+    {680, 4, 0, 238},
+    {684, 4, 0, 239},
+    {688, 4, 0, 240},
+    {692, 4, 0, 242},
+    {696, 4, 0, 243},
+    {700, 4, 0, 244},
+    {704, 4, 0, 245},
+    {708, 4, 0, 247},
+    {712, 4, 0, 251},
+    {716, 3, 0, 252},
+    {719, 3, 0, 253},
+    {722, 4, 0, 254},
+    {726, 3, 0, 255},
+    {729, 3, 0, 256},
+    {732, 4, 0, 257},
+    {736, 4, 0, 258},
+    {740, 4, 0, 260},
+    {744, 4, 0, 261},
+    {748, 4, 0, 262},
+    {752, 4, 0, 263},
+    {756, 4, 0, 264},
+    {760, 4, 0, 265},
+    {764, 3, 1, 266},
+    {767, 3, 1, 267},
+    {770, 3, 1, 268},
+    {773, 3, 1, 269},
+    {776, 3, 1, 270},
+    {779, 3, 1, 271},
+    {782, 3, 1, 272},
+    {785, 3, 1, 273},
+    {788, 3, 1, 274},
+    {791, 3, 1, 275},
+    {794, 3, 1, 276},
+    {797, 3, 1, 277},
+    {800, 3, 1, 278},
+    {803, 3, 1, 279},
+    {806, 3, 1, 280},
+    {809, 3, 1, 281},
+    {812, 3, 1, 282},
+    {815, 3, 1, 283},
+    {818, 3, 1, 284},
+    {821, 3, 1, 285},
+    {824, 3, 1, 286},
+    {827, 3, 1, 287},
+    {830, 3, 1, 288},
+    {833, 3, 1, 289},
+    {836, 3, 1, 290},
+    {839, 3, 1, 291},
+    {842, 3, 1, 292},
+    {845, 3, 1, 293},
+    {848, 3, 1, 294},
+    {851, 3, 1, 295},
+    {854, 3, 1, 296},
+    {857, 3, 1, 297},
+    {860, 3, 1, 298},
+    {863, 3, 1, 299},
+    {866, 3, 1, 300},
+    {869, 3, 1, 301},
+    {872, 3, 1, 302},
+    {875, 3, 1, 303},
+    {878, 3, 1, 304},
+    {881, 3, 1, 305},
+    {884, 3, 1, 306},
+    {887, 3, 1, 307},
+    {890, 3, 1, 308},
+    {893, 3, 1, 309},
+    {896, 3, 1, 310},
+    {899, 3, 1, 311},
+    {902, 3, 1, 312},
+    {905, 3, 1, 313},
+    {908, 3, 1, 314},
+    {911, 3, 1, 315},
+    {914, 3, 1, 316},
+    {917, 3, 1, 317},
+    {920, 3, 1, 318},
+    {923, 3, 1, 319},
+    {926, 3, 1, 320},
+    {929, 3, 1, 321},
+    {932, 3, 1, 322},
+    {935, 3, 1, 323},
+    {938, 3, 1, 324},
+    {941, 3, 1, 325},
+    {944, 3, 1, 326},
+    {947, 3, 1, 327},
+    {950, 3, 1, 328},
+    {953, 3, 1, 329},
+    {956, 3, 1, 330},
+    {959, 3, 1, 331},
+    {962, 3, 1, 332},
+    {965, 3, 1, 333},
+    {968, 3, 1, 334},
+    {971, 3, 1, 335},
+    {974, 3, 1, 336},
+    {977, 3, 1, 337},
+    {980, 3, 1, 338},
+    {983, 3, 1, 339},
+    {986, 3, 1, 340},
+    {989, 3, 1, 341},
+    {992, 3, 1, 342},
+    {995, 3, 1, 343},
+    {998, 3, 1, 344},
+    {1001, 3, 1, 345},
+    {1004, 3, 1, 346},
+    {1007, 3, 1, 347},
+    {1010, 3, 1, 348},
+    {1013, 3, 1, 349},
+    {1016, 3, 1, 350},
+    {1019, 3, 1, 351},
+    {1022, 3, 1, 352},
+    {1025, 3, 1, 353},
+    {1028, 3, 1, 354},
+    {1031, 3, 1, 355},
+    {1034, 3, 1, 356},
+    {1037, 3, 1, 357},
+    {1040, 3, 1, 358},
+    {1043, 3, 1, 359},
+    {1046, 3, 1, 360},
+    {1049, 3, 1, 361},
+    {1052, 3, 1, 362},
+    {1055, 3, 1, 363},
+    {1058, 3, 1, 364},
+    {1061, 3, 1, 365},
+    {1064, 3, 1, 366},
+    {1067, 3, 1, 367},
+    {1070, 3, 1, 368},
+    {1073, 3, 1, 369},
+    {1076, 3, 1, 370},
+    {1079, 3, 1, 371},
+    {1082, 3, 1, 372},
+    {1085, 3, 1, 373},
+    {1088, 3, 1, 374},
+    {1091, 3, 1, 375},
+    {1094, 3, 1, 376},
+    {1097, 3, 1, 377},
+    {1100, 3, 1, 378},
+    {1103, 3, 1, 379},
+    {1106, 3, 1, 380},
+    {1109, 3, 1, 381},
+    {1112, 3, 1, 382},
+    {1115, 3, 1, 383},
+    {1118, 3, 1, 384},
+    {1121, 3, 1, 385},
+};
+constexpr vertex_index tree_0_indices[] = {
+    6,
+    7,
+    13,
+    12,
+    8,
+    14,
+    13,
+    7,
+    9,
+    15,
+    14,
+    8,
+    10,
+    16,
+    15,
+    9,
+    10,
+    11,
+    17,
+    16,
+    11,
+    6,
+    12,
+    17,
+    12,
+    13,
+    19,
+    18,
+    20,
+    19,
+    13,
+    14,
+    15,
+    21,
+    20,
+    14,
+    15,
+    16,
+    22,
+    21,
+    16,
+    17,
+    23,
+    22,
+    17,
+    12,
+    18,
+    23,
+    19,
+    25,
+    24,
+    18,
+    20,
+    26,
+    25,
+    19,
+    20,
+    21,
+    27,
+    26,
+    21,
+    22,
+    28,
+    27,
+    23,
+    29,
+    28,
+    22,
+    23,
+    18,
+    24,
+    29,
+    25,
+    31,
+    30,
+    24,
+    25,
+    26,
+    32,
+    31,
+    27,
+    33,
+    32,
+    26,
+    28,
+    34,
+    33,
+    27,
+    28,
+    29,
+    35,
+    34,
+    29,
+    24,
+    30,
+    35,
+    30,
+    31,
+    37,
+    36,
+    32,
+    38,
+    37,
+    31,
+    33,
+    39,
+    38,
+    32,
+    34,
+    40,
+    39,
+    33,
+    35,
+    41,
+    40,
+    34,
+    35,
+    30,
+    36,
+    41,
+    36,
+    37,
+    43,
+    42,
+    37,
+    38,
+    44,
+    43,
+    38,
+    39,
+    45,
+    44,
+    39,
+    40,
+    46,
+    45,
+    41,
+    47,
+    46,
+    40,
+    36,
+    42,
+    47,
+    41,
+    49,
+    55,
+    54,
+    48,
+    49,
+    50,
+    56,
+    55,
+    50,
+    51,
+    57,
+    56,
+    51,
+    52,
+    58,
+    57,
+    53,
+    59,
+    58,
+    52,
+    48,
+    54,
+    59,
+    53,
+    61,
+    60,
+    54,
+    55,
+    56,
+    62,
+    61,
+    55,
+    62,
+    56,
+    57,
+    63,
+    63,
+    57,
+    58,
+    64,
+    59,
+    65,
+    64,
+    58,
+    54,
+    60,
+    65,
+    59,
+    61,
+    67,
+    66,
+    60,
+    62,
+    68,
+    67,
+    61,
+    62,
+    63,
+    69,
+    68,
+    63,
+    64,
+    70,
+    69,
+    65,
+    71,
+    70,
+    64,
+    65,
+    60,
+    66,
+    71,
+    72,
+    66,
+    67,
+    73,
+    67,
+    68,
+    74,
+    73,
+    69,
+    75,
+    74,
+    68,
+    76,
+    75,
+    69,
+    70,
+    70,
+    71,
+    77,
+    76,
+    71,
+    66,
+    72,
+    77,
+    81,
+    80,
+    78,
+    79,
+    81,
+    83,
+    82,
+    80,
+    83,
+    85,
+    84,
+    82,
+    79,
+    78,
+    84,
+    85,
+    91,
+    95,
+    94,
+    90,
+    91,
+    92,
+    96,
+    95,
+    93,
+    97,
+    96,
+    92,
+    90,
+    94,
+    97,
+    93,
+    95,
+    99,
+    98,
+    94,
+    95,
+    96,
+    100,
+    99,
+    96,
+    97,
+    101,
+    100,
+    94,
+    98,
+    101,
+    97,
+    105,
+    104,
+    102,
+    103,
+    107,
+    106,
+    104,
+    105,
+    107,
+    109,
+    108,
+    106,
+    109,
+    103,
+    102,
+    108,
+    110,
+    111,
+    115,
+    114,
+    111,
+    112,
+    116,
+    115,
+    113,
+    117,
+    116,
+    112,
+    113,
+    110,
+    114,
+    117,
+    114,
+    115,
+    119,
+    118,
+    116,
+    120,
+    119,
+    115,
+    116,
+    117,
+    121,
+    120,
+    117,
+    114,
+    118,
+    121,
+    123,
+    122,
+    118,
+    119,
+    124,
+    123,
+    119,
+    120,
+    124,
+    120,
+    121,
+    125,
+    125,
+    121,
+    118,
+    122,
+    122,
+    123,
+    127,
+    126,
+    124,
+    128,
+    127,
+    123,
+    128,
+    124,
+    125,
+    129,
+    126,
+    129,
+    125,
+    122,
+    126,
+    127,
+    131,
+    130,
+    128,
+    132,
+    131,
+    127,
+    129,
+    133,
+    132,
+    128,
+    126,
+    130,
+    133,
+    129,
+    134,
+    135,
+    139,
+    138,
+    135,
+    136,
+    140,
+    139,
+    137,
+    141,
+    140,
+    136,
+    137,
+    134,
+    138,
+    141,
+    138,
+    139,
+    143,
+    142,
+    140,
+    144,
+    143,
+    139,
+    140,
+    141,
+    145,
+    144,
+    141,
+    138,
+    142,
+    145,
+    143,
+    147,
+    146,
+    142,
+    144,
+    148,
+    147,
+    143,
+    144,
+    145,
+    149,
+    148,
+    145,
+    142,
+    146,
+    149,
+    151,
+    150,
+    146,
+    147,
+    152,
+    151,
+    147,
+    148,
+    152,
+    148,
+    149,
+    153,
+    146,
+    150,
+    153,
+    149,
+    154,
+    150,
+    151,
+    155,
+    152,
+    156,
+    155,
+    151,
+    152,
+    153,
+    157,
+    156,
+    150,
+    154,
+    157,
+    153,
+    159,
+    161,
+    160,
+    158,
+    163,
+    162,
+    160,
+    161,
+    165,
+    164,
+    162,
+    163,
+    165,
+    159,
+    158,
+    164,
+    158,
+    160,
+    167,
+    166,
+    160,
+    162,
+    168,
+    167,
+    164,
+    169,
+    168,
+    162,
+    164,
+    158,
+    166,
+    169,
+    166,
+    167,
+    171,
+    170,
+    168,
+    172,
+    171,
+    167,
+    168,
+    169,
+    173,
+    172,
+    166,
+    170,
+    173,
+    169,
+    171,
+    175,
+    174,
+    170,
+    172,
+    176,
+    175,
+    171,
+    172,
+    173,
+    177,
+    176,
+    177,
+    173,
+    170,
+    174,
+    175,
+    179,
+    178,
+    174,
+    179,
+    175,
+    176,
+    180,
+    177,
+    181,
+    180,
+    176,
+    177,
+    174,
+    178,
+    181,
+    179,
+    183,
+    182,
+    178,
+    184,
+    183,
+    179,
+    180,
+    180,
+    181,
+    185,
+    184,
+    181,
+    178,
+    182,
+    185,
+    0,
+    1,
+    261,
+    260,
+    1,
+    2,
+    262,
+    261,
+    3,
+    264,
+    262,
+    2,
+    3,
+    4,
+    265,
+    264,
+    5,
+    266,
+    265,
+    4,
+    0,
+    260,
+    266,
+    5,
+    260,
+    267,
+    7,
+    6,
+    268,
+    8,
+    7,
+    267,
+    264,
+    9,
+    8,
+    268,
+    264,
+    265,
+    10,
+    9,
+    265,
+    266,
+    11,
+    10,
+    260,
+    6,
+    11,
+    266,
+    260,
+    261,
+    49,
+    48,
+    262,
+    50,
+    49,
+    261,
+    51,
+    50,
+    262,
+    264,
+    264,
+    268,
+    52,
+    51,
+    267,
+    53,
+    52,
+    268,
+    260,
+    48,
+    53,
+    267,
+    270,
+    269,
+    102,
+    104,
+    271,
+    270,
+    104,
+    106,
+    263,
+    271,
+    106,
+    108,
+    263,
+    108,
+    102,
+    269,
+    110,
+    269,
+    272,
+    111,
+    271,
+    112,
+    111,
+    272,
+    271,
+    263,
+    113,
+    112,
+    269,
+    110,
+    113,
+    263,
+    130,
+    131,
+    276,
+    279,
+    131,
+    132,
+    277,
+    276,
+    133,
+    280,
+    277,
+    132,
+    133,
+    130,
+    279,
+    280,
+    269,
+    270,
+    135,
+    134,
+    271,
+    136,
+    135,
+    270,
+    271,
+    272,
+    137,
+    136,
+    269,
+    134,
+    137,
+    272,
+    155,
+    274,
+    273,
+    154,
+    274,
+    155,
+    156,
+    275,
+    157,
+    278,
+    275,
+    156,
+    278,
+    157,
+    154,
+    273,
+    276,
+    277,
+    186,
+    279,
+    277,
+    280,
+    279,
+    277,
+    279,
+    186,
+    274,
+    275,
+    187,
+    273,
+    275,
+    278,
+    273,
+    275,
+    273,
+    187,
+    92,
+    88,
+    89,
+    93,
+    87,
+    88,
+    92,
+    91,
+    90,
+    93,
+    89,
+    86,
+    87,
+    91,
+    90,
+    86,
+    82,
+    84,
+    89,
+    88,
+    82,
+    88,
+    87,
+    80,
+    78,
+    86,
+    89,
+    84,
+    78,
+    80,
+    87,
+    86,
+    188,
+    189,
+    190,
+    191,
+    188,
+    190,
+    192,
+    191,
+    190,
+    193,
+    192,
+    190,
+    189,
+    193,
+    190,
+    194,
+    195,
+    196,
+    195,
+    197,
+    196,
+    197,
+    198,
+    196,
+    198,
+    199,
+    196,
+    199,
+    194,
+    196,
+    188,
+    194,
+    189,
+    191,
+    195,
+    188,
+    192,
+    197,
+    191,
+    193,
+    198,
+    192,
+    189,
+    199,
+    193,
+    194,
+    188,
+    195,
+    195,
+    191,
+    197,
+    197,
+    192,
+    198,
+    198,
+    193,
+    199,
+    199,
+    189,
+    194,
+    200,
+    201,
+    202,
+    203,
+    201,
+    200,
+    204,
+    201,
+    203,
+    205,
+    201,
+    204,
+    202,
+    201,
+    205,
+    206,
+    207,
+    208,
+    208,
+    207,
+    209,
+    209,
+    207,
+    210,
+    210,
+    207,
+    211,
+    211,
+    207,
+    206,
+    200,
+    202,
+    206,
+    203,
+    200,
+    208,
+    204,
+    203,
+    209,
+    205,
+    204,
+    210,
+    202,
+    205,
+    211,
+    206,
+    208,
+    200,
+    208,
+    209,
+    203,
+    209,
+    210,
+    204,
+    210,
+    211,
+    205,
+    211,
+    206,
+    202,
+    212,
+    213,
+    214,
+    215,
+    212,
+    214,
+    216,
+    215,
+    214,
+    217,
+    216,
+    214,
+    213,
+    217,
+    214,
+    218,
+    219,
+    220,
+    219,
+    221,
+    220,
+    221,
+    222,
+    220,
+    222,
+    223,
+    220,
+    223,
+    218,
+    220,
+    212,
+    218,
+    213,
+    215,
+    219,
+    212,
+    216,
+    221,
+    215,
+    217,
+    222,
+    216,
+    213,
+    223,
+    217,
+    218,
+    212,
+    219,
+    219,
+    215,
+    221,
+    221,
+    216,
+    222,
+    222,
+    217,
+    223,
+    223,
+    213,
+    218,
+    224,
+    225,
+    226,
+    227,
+    224,
+    226,
+    228,
+    227,
+    226,
+    229,
+    228,
+    226,
+    225,
+    229,
+    226,
+    230,
+    231,
+    232,
+    231,
+    233,
+    232,
+    233,
+    234,
+    232,
+    234,
+    235,
+    232,
+    235,
+    230,
+    232,
+    224,
+    230,
+    225,
+    227,
+    231,
+    224,
+    228,
+    233,
+    227,
+    229,
+    234,
+    228,
+    225,
+    235,
+    229,
+    230,
+    224,
+    231,
+    231,
+    227,
+    233,
+    233,
+    228,
+    234,
+    234,
+    229,
+    235,
+    235,
+    225,
+    230,
+    236,
+    237,
+    238,
+    239,
+    237,
+    236,
+    240,
+    237,
+    239,
+    241,
+    237,
+    240,
+    238,
+    237,
+    241,
+    242,
+    243,
+    244,
+    244,
+    243,
+    245,
+    245,
+    243,
+    246,
+    246,
+    243,
+    247,
+    247,
+    243,
+    242,
+    236,
+    238,
+    242,
+    239,
+    236,
+    244,
+    240,
+    239,
+    245,
+    241,
+    240,
+    246,
+    238,
+    241,
+    247,
+    242,
+    244,
+    236,
+    244,
+    245,
+    239,
+    245,
+    246,
+    240,
+    246,
+    247,
+    241,
+    247,
+    242,
+    238,
+    248,
+    249,
+    250,
+    251,
+    248,
+    250,
+    252,
+    251,
+    250,
+    253,
+    252,
+    250,
+    249,
+    253,
+    250,
+    254,
+    255,
+    256,
+    255,
+    257,
+    256,
+    257,
+    258,
+    256,
+    258,
+    259,
+    256,
+    259,
+    254,
+    256,
+    248,
+    254,
+    249,
+    251,
+    255,
+    248,
+    252,
+    257,
+    251,
+    253,
+    258,
+    252,
+    249,
+    259,
+    253,
+    254,
+    248,
+    255,
+    255,
+    251,
+    257,
+    257,
+    252,
+    258,
+    258,
+    253,
+    259,
+    259,
+    249,
+    254,
+};
+constexpr object tree_objects[] = {
+    {{nullptr, 0}, {tree_0_vertices, 281}, {4.269707278581336e-05f, 4.050070128869265e-05f, 3.174187440890819e-05f}, {-0.00713503360748291f, 0.03886348009109497f, -0.03254300355911255f}, {tree_0_normals, 386}, {tree_0_faces, 312}, {tree_0_indices, 1124}, {{-1.4062327146530151f, -1.2882635593414307f, -1.0726606845855713f}, {1.3919626474380493f, 1.365990400314331f, 1.0075747966766357f}, {-0.00713503360748291f, 0.03886348009109497f, -0.03254300355911255f}, 1.6811059713363647f}},
+};
+constexpr material tree_materials[] = {
+    {{53.14432907104492f, 35.45933151245117f, 14.126338005065918f}},
+    {{65.75642395019531f, 112.7695541381836f, 28.356868743896484f}},
+};
+constexpr m3::vec3 tree_lights[] = {
+    {-1.0f, -1.0f, -1.0f},
+    {-1.0f, 1.0f, 1.0f},
+    {1.0f, 1.0f, 1.0f},
+    {1.0f, -1.0f, 1.0f},
+};
+constexpr scene tree_scene = {{tree_objects, 1}, {tree_materials, 2}, {tree_lights, 4}, {{0.0f, 0.0f, -10.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}};
+static_assert(is_valid(tree_scene));
 
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
-
-# camera position vector
-cp -10.0 10.0 -15.0
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib sphere.mtl
-o Sphere
-v -0.107517 0.838792 -0.540528
-v -0.088102 -0.008211 -0.999782
-v -0.074099 -0.562790 -0.826308
-v -0.029493 0.924637 -0.388341
-v 0.077222 0.628184 -0.784051
-v 0.057919 0.301900 -0.959114
-v 0.211712 0.098528 -0.977101
-v 0.095563 -0.197140 -0.980385
-v 0.088998 -0.385888 -0.922658
-v 0.243875 -0.548469 -0.803951
-v 0.381908 0.098313 -0.922007
-v 0.164873 -0.830951 -0.534609
-v 0.019948 0.981621 -0.202530
-v 0.272674 0.778878 -0.579104
-v 0.385242 0.487290 -0.794419
-v 0.484208 -0.088966 -0.879647
-v 0.428609 -0.378984 -0.824061
-v 0.383607 -0.718498 -0.591826
-v 0.579177 0.391797 -0.719220
-v 0.622702 0.212795 -0.758764
-v 0.787408 -0.000000 -0.623425
-v 0.630658 -0.204561 -0.753321
-v 0.532749 -0.562888 -0.637685
-v 0.397822 0.834685 -0.391058
-v 0.686881 0.503271 -0.537872
-v 0.706035 -0.385203 -0.600455
-v 0.209292 -0.926351 -0.329937
-v 0.000000 1.000000 0.000000
-v 0.301172 0.932889 -0.235828
-v 0.581256 0.717473 -0.397691
-v 0.868253 0.197140 -0.465214
-v 0.868253 -0.197140 -0.465214
-v 0.695541 -0.633224 -0.359460
-v 0.442263 -0.834889 -0.347961
-v 0.801707 0.557974 -0.227921
-v 0.882076 0.385203 -0.284560
-v 0.966045 0.000000 -0.274641
-v 0.918663 -0.316658 -0.269816
-v 0.555095 -0.836769 0.008386
-v 0.764772 0.653956 -0.050543
-v 1.000522 0.115511 -0.064524
-v 0.923828 -0.385203 0.074657
-v 0.775746 -0.638968 -0.072222
-v 0.551784 0.842014 -0.044455
-v 0.923828 0.385203 0.074657
-v 0.980385 -0.197140 0.095565
-v 0.384949 -0.929162 -0.008339
-v 0.168447 -0.984947 -0.112553
-v 0.681573 0.708715 0.193768
-v 0.827053 0.497100 0.285319
-v 0.942903 0.197140 0.284992
-v 0.955819 0.000000 0.308350
-v 0.894759 -0.291792 0.351487
-v 0.744334 -0.638968 0.230140
-v 0.370067 0.924637 0.121363
-v 0.762067 0.197140 0.624132
-v 0.456530 0.834055 0.321752
-v 0.599604 0.638968 0.497466
-v 0.726658 0.385203 0.575326
-v 0.765061 -0.000000 0.650654
-v 0.762067 -0.197140 0.624132
-v 0.689306 -0.475433 0.561978
-v 0.197698 0.986420 0.025750
-v 0.493932 0.473967 0.735457
-v 0.541211 0.098529 0.840618
-v 0.493932 -0.473967 0.735457
-v 0.514405 -0.712804 0.489428
-v 0.421656 -0.838086 0.366403
-v 0.095717 -0.983075 0.179074
-v 0.287952 0.712804 0.649027
-v 0.465214 -0.197140 0.868253
-v 0.227921 -0.557974 0.801707
-v -0.025690 0.981636 0.200666
-v 0.200835 0.834055 0.521161
-v 0.227921 0.557974 0.801707
-v 0.284560 0.385203 0.882076
-v 0.286887 0.197140 0.942328
-v 0.274641 0.000000 0.966044
-v 0.284560 -0.385203 0.882076
-v 0.191191 -0.777723 0.609921
-v 0.224729 -0.926351 0.319622
-v -0.093416 0.074357 1.001902
-v 0.097535 -0.197140 0.980191
-v 0.102623 0.932889 0.368494
-v -0.080506 0.638968 0.774930
-v -0.074657 0.385203 0.923828
-v -0.284992 -0.197140 0.942903
-v -0.074657 -0.385202 0.923828
-v -0.080506 -0.638968 0.774930
-v -0.284992 0.197140 0.942903
-v -0.396471 -0.491477 0.786423
-v -0.122553 -0.834056 0.544908
-v -0.253743 0.924637 0.295453
-v -0.174411 0.834889 0.535026
-v -0.370931 0.638968 0.685134
-v -0.422507 0.385203 0.824936
-v -0.488896 -0.000000 0.877297
-v -0.706035 0.385203 0.600455
-v -0.661850 0.115512 0.753101
-v -0.570620 -0.313439 0.768509
-v -0.379669 -0.712804 0.600003
-v -0.404634 -0.834056 0.384987
-v -0.139609 -0.929162 0.358838
-v 0.000000 -1.000000 0.000000
-v -0.604884 0.638968 0.491032
-v -0.760811 -0.197140 0.625662
-v -0.696720 -0.497100 0.529154
-v -0.811793 0.480539 0.347680
-v -0.868253 0.197140 0.465213
-v -0.893902 0.000000 0.457830
-v -0.492769 0.842014 0.252230
-v -0.673017 0.711675 0.210147
-v -1.000875 0.074358 0.103840
-v -0.942328 -0.197140 0.286887
-v -0.850226 -0.475433 0.260919
-v -0.649027 -0.712804 0.287952
-v -0.442991 -0.893458 0.139565
-v -0.152575 -0.981636 0.132844
-v -0.884792 0.475433 0.090034
-v -0.980385 0.197140 -0.095565
-v -0.706279 0.708715 -0.057076
-v -0.956011 -0.313439 -0.047493
-v -0.793221 -0.557974 -0.255895
-v -0.760852 -0.656278 -0.043728
-v -0.384949 0.929162 -0.008339
-v -0.548445 0.831849 -0.119539
-v -0.851896 0.475433 -0.255414
-v -0.955818 0.000000 -0.308350
-v -0.942903 -0.197140 -0.284992
-v -0.548445 -0.831849 -0.119539
-v -0.600003 0.712804 -0.379669
-v -0.737781 0.473967 -0.490454
-v -0.867751 0.115513 -0.502210
-v -0.824936 -0.385203 -0.422507
-v -0.630674 -0.708715 -0.323013
-v -0.198949 0.985942 -0.019595
-v -0.623424 0.000000 -0.787408
-v -0.762067 -0.197140 -0.624132
-v -0.634913 -0.557974 -0.539968
-v -0.360201 -0.927993 -0.142649
-v -0.265928 0.924550 -0.279499
-v -0.391057 0.834685 -0.397822
-v -0.566425 0.475433 -0.685657
-v -0.625662 0.197140 -0.760811
-v -0.600834 -0.316657 -0.745480
-v -0.459056 -0.708715 -0.539774
-v -0.386581 -0.836769 -0.398441
-v -0.286888 -0.197141 -0.942327
-v -0.379946 -0.557974 -0.741837
-v -0.278965 0.718497 -0.647758
-v -0.260919 0.475432 -0.850226
-v -0.300908 0.127072 -0.953234
-v -0.275777 -0.391922 -0.882854
-v -0.217550 -0.708715 -0.674358
-v -0.102780 -0.836302 -0.544661
-v 0.057076 -0.708714 -0.706279
-v -0.117581 -0.925922 -0.368665
-v -0.147594 -0.984597 -0.138739
-vn 0.0384 -0.8024 -0.5955
-vn 0.0345 0.1139 -0.9929
-vn 0.0088 -0.9928 -0.1196
-vn 0.0811 0.8498 -0.5209
-vn 0.0832 -0.5347 -0.8409
-vn 0.2231 -0.6836 -0.6949
-vn 0.1796 0.4568 -0.8712
-vn 0.1247 0.9388 -0.3211
-vn 0.2296 0.8807 -0.4142
-vn 0.4035 -0.5285 -0.7469
-vn 0.3037 -0.8294 -0.4689
-vn 0.6435 0.0113 -0.7654
-vn 0.0790 0.9935 -0.0824
-vn 0.5770 -0.3738 -0.7262
-vn 0.4482 0.7306 -0.5151
-vn 0.7602 -0.1875 -0.6221
-vn 0.6623 -0.5363 -0.5231
-vn 0.5511 -0.6734 -0.4927
-vn 0.3451 -0.9178 -0.1965
-vn 0.8901 0.0008 -0.4559
-vn 0.8114 -0.3815 -0.4427
-vn 0.4836 0.8438 -0.2327
-vn 0.7145 0.5941 -0.3695
-vn 0.8242 -0.5128 -0.2404
-vn 0.6444 0.7365 -0.2059
-vn 0.9429 0.1921 -0.2721
-vn 0.9331 -0.1446 -0.3292
-vn 0.3605 0.9315 -0.0480
-vn 0.8377 -0.5392 0.0870
-vn 0.6617 0.7475 0.0578
-vn 0.7886 0.6001 0.1340
-vn 0.9695 0.2197 0.1085
-vn 0.9863 0.0816 0.1435
-vn 0.2212 -0.9733 0.0614
-vn 0.1116 -0.9932 0.0342
-vn 0.9523 -0.1610 0.2591
-vn 0.9319 -0.3025 0.1999
-vn 0.5220 0.8389 0.1540
-vn 0.5765 -0.7891 0.2120
-vn 0.5954 0.7330 0.3290
-vn 0.3647 -0.9123 0.1860
-vn 0.2241 0.9515 0.2108
-vn 0.4564 0.6234 0.6349
-vn 0.6126 0.4956 0.6156
-vn 0.2950 0.8774 0.3783
-vn 0.3983 0.0851 0.9133
-vn 0.0555 0.9936 0.0980
-vn 0.4314 -0.3534 0.8300
-vn 0.3528 -0.4873 0.7988
-vn 0.3644 0.5784 0.7298
-vn 0.2860 -0.1895 0.9393
-vn 0.1071 -0.3741 0.9212
-vn 0.0216 0.8455 0.5335
-vn 0.1101 -0.6639 0.7396
-vn 0.0030 -0.7629 0.6465
-vn -0.1357 0.2490 0.9589
-vn -0.0960 -0.1462 0.9846
-vn -0.0917 0.9353 0.3418
-vn -0.2559 -0.3765 0.8904
-vn -0.2059 0.7169 0.6661
-vn -0.0482 -0.9723 0.2285
-vn -0.2991 -0.0082 0.9542
-vn -0.0258 -0.9938 0.1077
-vn -0.4743 0.1921 0.8591
-vn -0.4570 -0.1830 0.8705
-vn -0.4020 -0.3064 0.8628
-vn -0.2812 -0.8216 0.4959
-vn -0.3634 0.8265 0.4300
-vn -0.5640 -0.4844 0.6688
-vn -0.0782 0.9936 0.0809
-vn -0.3018 -0.9148 0.2686
-vn -0.7623 0.2197 0.6088
-vn -0.7989 0.0816 0.5959
-vn -0.6900 -0.3511 0.6329
-vn -0.5632 -0.6682 0.4862
-vn -0.6023 0.7251 0.3338
-vn -0.5130 -0.8125 0.2768
-vn -0.7181 0.4965 0.4877
-vn -0.8655 -0.1895 0.4637
-vn -0.2817 0.9498 0.1358
-vn -0.7786 0.5918 0.2089
-vn -0.8686 -0.4940 0.0384
-vn -0.7626 -0.6293 0.1499
-vn -0.9573 0.2796 0.0738
-vn -0.1120 -0.9937 0.0088
-vn -0.9844 -0.1500 0.0924
-vn -0.9342 -0.3233 0.1507
-vn -0.5393 0.8401 0.0578
-vn -0.9942 -0.0082 -0.1072
-vn -0.8645 -0.4932 -0.0966
-vn -0.8148 0.5746 -0.0776
-vn -0.7097 -0.6743 -0.2042
-vn -0.9192 0.2494 -0.3047
-vn -0.8916 -0.3853 -0.2379
-vn -0.6512 0.7306 -0.2053
-vn -0.2969 0.9436 -0.1464
-vn -0.7391 -0.5329 -0.4119
-vn -0.7278 0.5855 -0.3570
-vn -0.5127 -0.8105 -0.2833
-vn -0.6064 0.5947 -0.5279
-vn -0.7403 0.0816 -0.6673
-vn -0.7195 -0.3815 -0.5802
-vn -0.5783 -0.6752 -0.4579
-vn -0.6612 -0.1446 -0.7361
-vn -0.5370 -0.5017 -0.6782
-vn -0.4598 0.7084 -0.5355
-vn -0.2703 -0.9153 -0.2986
-vn -0.0607 0.9935 -0.0961
-vn -0.3591 -0.6752 -0.6443
-vn -0.3889 0.5724 -0.7219
-vn -0.2318 -0.5411 -0.8084
-vn -0.0422 0.4743 -0.8794
-vn -0.0971 -0.1946 -0.9761
-vn -0.0789 0.7236 -0.6857
-vn -0.0849 -0.6774 -0.7307
-vn 0.0241 -0.9680 -0.2500
-vn 0.2910 0.2974 -0.9093
-vn 0.0830 -0.0216 -0.9963
-vn 0.0588 0.7767 -0.6271
-vn 0.0831 -0.5875 -0.8050
-vn 0.2671 0.6370 -0.7231
-vn 0.2060 -0.7314 -0.6501
-vn 0.2829 -0.0854 -0.9553
-vn 0.2926 -0.2560 -0.9213
-vn 0.4520 0.2811 -0.8465
-vn 0.1691 0.8939 -0.4151
-vn 0.2638 -0.3921 -0.8813
-vn 0.5082 -0.2551 -0.8226
-vn 0.3844 -0.5801 -0.7182
-vn 0.2946 -0.8401 -0.4555
-vn 0.4818 0.6334 -0.6055
-vn 0.5266 0.0966 -0.8446
-vn 0.7356 0.2995 -0.6076
-vn 0.5234 0.5513 -0.6497
-vn 0.6475 -0.0123 -0.7620
-vn 0.1530 0.9783 -0.1397
-vn 0.5685 -0.4043 -0.7165
-vn 0.7573 -0.2080 -0.6191
-vn 0.5385 -0.7028 -0.4649
-vn 0.6104 -0.7685 -0.1922
-vn 0.7580 0.1899 -0.6240
-vn 0.7861 0.4894 -0.3776
-vn 0.8108 0.3734 -0.4507
-vn 0.3288 -0.9255 -0.1877
-vn 0.8901 -0.0008 -0.4559
-vn 0.7938 -0.4408 -0.4191
-vn 0.5155 0.8207 -0.2463
-vn 0.6815 0.6936 -0.2334
-vn 0.9848 -0.1344 -0.1097
-vn 0.4832 -0.8612 -0.1575
-vn 0.9408 0.2073 -0.2683
-vn 0.9398 0.3236 -0.1092
-vn 0.8813 0.4638 -0.0909
-vn 0.9574 -0.2801 -0.0701
-vn 0.3745 0.9258 -0.0509
-vn 0.8840 -0.4557 -0.1039
-vn 0.8478 0.3058 0.4333
-vn 0.6800 -0.7298 0.0706
-vn 0.8360 0.5400 0.0972
-vn 0.9930 -0.0036 0.1179
-vn 0.9077 0.3503 0.2309
-vn 0.8559 -0.4561 0.2438
-vn 0.5484 0.8207 0.1605
-vn 0.4577 -0.8732 0.1674
-vn 0.8001 -0.4748 0.3667
-vn 0.6670 -0.6185 0.4154
-vn 0.7031 0.6278 0.3339
-vn 0.5909 -0.7439 0.3121
-vn 0.7356 0.5064 0.4500
-vn 0.8739 0.0956 0.4766
-vn 0.2678 -0.9534 0.1390
-vn 0.8744 -0.0984 0.4751
-vn 0.4056 0.7691 0.4939
-vn 0.8025 -0.3220 0.5023
-vn 0.2926 0.9124 0.2862
-vn 0.6074 0.2911 0.7391
-vn 0.5373 -0.5824 0.6100
-vn 0.6261 -0.0986 0.7735
-vn 0.6706 0.1089 0.7338
-vn 0.6158 -0.3041 0.7269
-vn 0.3741 -0.6473 0.6641
-vn 0.4338 -0.0273 0.9006
-vn 0.1256 0.9743 0.1870
-vn 0.4569 0.2873 0.8418
-vn 0.3514 -0.7754 0.5247
-vn 0.3528 0.4873 0.7988
-vn 0.2684 -0.8445 0.4634
-vn 0.0779 -0.4808 0.8733
-vn 0.2851 -0.2050 0.9363
-vn 0.0943 -0.0133 0.9955
-vn 0.0449 0.7673 0.6397
-vn 0.0779 0.4808 0.8733
-vn 0.1139 0.6748 0.7291
-vn 0.0601 -0.8878 0.4563
-vn 0.0879 0.2635 0.9607
-vn -0.2462 0.4959 0.8328
-vn 0.0437 -0.9397 0.3391
-vn 0.1186 0.1113 0.9867
-vn -0.0950 -0.2050 0.9741
-vn -0.0987 0.9207 0.3776
-vn -0.1991 -0.4925 0.8472
-vn -0.2688 -0.6324 0.7266
-vn -0.2031 -0.7281 0.6547
-vn -0.4037 0.7794 0.4792
-vn -0.2536 0.3741 0.8920
-vn -0.3014 0.0055 0.9535
-vn -0.2598 -0.8500 0.4583
-vn -0.4755 0.2073 0.8550
-vn -0.5461 0.4959 0.6752
-vn -0.5284 -0.5700 0.6292
-vn -0.6324 -0.1070 0.7672
-vn -0.5873 0.3236 0.7418
-vn -0.8341 -0.3204 0.4489
-vn -0.1770 0.9714 0.1582
-vn -0.2776 -0.9322 0.2324
-vn -0.7856 -0.0036 0.6188
-vn -0.5345 -0.7081 0.4614
-vn -0.3487 0.9227 0.1643
-vn -0.7289 -0.5756 0.3706
-vn -0.7078 0.6231 0.3330
-vn -0.8065 0.3563 0.4718
-vn -0.9265 0.2815 0.2496
-vn -0.5960 0.8002 0.0665
-vn -0.9446 0.1113 0.3088
-vn -0.9579 -0.0133 0.2867
-vn 0.0435 -0.8972 -0.4395
-vn -0.6233 -0.7785 0.0736
-vn -0.7635 0.6397 0.0880
-vn -0.2764 -0.9608 0.0212
-vn -0.4572 -0.8890 -0.0253
-vn -0.9926 -0.0775 -0.0939
-vn -0.8769 -0.1137 -0.4670
-vn -0.9226 0.3755 -0.0879
-vn -0.7252 0.6488 -0.2307
-vn -0.6634 -0.7281 -0.1725
-vn -0.9313 0.2073 -0.2996
-vn -0.8896 -0.3910 -0.2361
-vn -0.4097 0.8880 -0.2090
-vn -0.8637 -0.2050 -0.4605
-vn -0.7317 0.3009 -0.6116
-vn -0.5021 0.8197 -0.2756
-vn -0.7071 -0.5871 -0.3941
-vn -0.4645 -0.8482 -0.2546
-vn -0.8508 0.3221 -0.4151
-vn -0.5199 -0.7485 -0.4116
-vn -0.2897 -0.7881 -0.5432
-vn -0.7601 -0.0036 -0.6498
-vn -0.7147 -0.3923 -0.5791
-vn -0.5025 -0.5871 -0.6347
-vn -0.4863 0.6637 -0.5683
-vn -0.2431 -0.9318 -0.2695
-vn -0.4424 0.3094 -0.8418
-vn -0.2339 -0.8583 -0.4567
-vn -0.4634 -0.0991 -0.8806
-vn -0.4887 0.1112 -0.8653
-vn -0.1331 0.9660 -0.2218
-vn -0.2091 0.8843 -0.4174
-vn -0.4285 -0.2861 -0.8571
-vn -0.0968 -0.2919 -0.9515
-vn -0.4340 -0.4093 -0.8026
-vn -0.2643 0.8238 -0.5015
-vn -0.2238 -0.5888 -0.7767
-vn -0.2395 -0.0430 -0.9699
-vn -0.1600 0.2968 -0.9415
-vn -0.1020 0.1764 -0.9790
-vn -0.0923 -0.4093 -0.9077
-vn -0.1339 0.6284 -0.7663
-vn -0.0771 -0.7440 -0.6637
-vt 0.737176 0.250000
-vt 0.702383 0.187500
-vt 0.779637 0.187500
-vt 0.741874 0.599249
-vt 0.718750 0.531273
-vt 0.763980 0.500000
-vt 0.734375 0.000000
-vt 0.879629 0.062500
-vt 0.593677 0.062500
-vt 0.781230 0.812500
-vt 0.762032 0.875000
-vt 0.685473 0.777944
-vt 0.734697 0.375000
-vt 0.703125 0.312500
-vt 0.764235 0.312500
-vt 0.658359 0.250000
-vt 0.734375 0.717281
-vt 0.678319 0.660608
-vt 0.734224 0.937500
-vt 0.605595 0.875000
-vt 0.623673 0.812500
-vt 0.673680 0.375000
-vt 0.639230 0.312500
-vt 0.606077 0.187500
-vt 0.670132 0.472235
-vt 0.640625 0.562500
-vt 0.606567 0.500000
-vt 0.640625 1.000000
-vt 0.479138 0.937500
-vt 0.639064 0.437500
-vt 0.612180 0.375000
-vt 0.595563 0.750000
-vt 0.578286 0.437500
-vt 0.577540 0.283466
-vt 0.503540 0.125000
-vt 0.660224 0.125000
-vt 0.578286 0.562500
-vt 0.544067 0.500000
-vt 0.543444 0.396147
-vt 0.512752 0.812500
-vt 0.603325 0.667055
-vt 0.544073 0.687500
-vt 0.515588 0.281661
-vt 0.510998 0.724803
-vt 0.549680 0.625000
-vt 0.509405 0.537235
-vt 0.449506 0.875000
-vt 0.487179 0.375000
-vt 0.453088 0.281661
-vt 0.455926 0.750000
-vt 0.445771 0.665313
-vt 0.487180 0.625000
-vt 0.453286 0.562500
-vt 0.450317 0.500000
-vt 0.328120 0.062500
-vt 0.453125 0.000000
-vt 0.437500 0.406180
-vt 0.484536 0.437500
-vt 0.402284 0.812500
-vt 0.497588 0.187500
-vt 0.386121 0.187500
-vt 0.390588 0.718339
-vt 0.347717 0.125000
-vt 0.293360 0.875000
-vt 0.316528 0.750000
-vt 0.343750 0.656371
-vt 0.393429 0.625000
-vt 0.308534 0.812500
-vt 0.343750 0.531273
-vt 0.297036 0.562500
-vt 0.294067 0.500000
-vt 0.328125 1.000000
-vt 0.230145 0.937500
-vt 0.328286 0.437500
-vt 0.299679 0.375000
-vt 0.343750 0.343629
-vt 0.294073 0.312500
-vt 0.294073 0.687500
-vt 0.265786 0.437500
-vt 0.237180 0.375000
-vt 0.199790 0.812500
-vt 0.234338 0.281661
-vt 0.296902 0.219059
-vt 0.214815 0.187500
-vt 0.237635 0.520573
-vt 0.237180 0.625000
-vt 0.203286 0.562500
-vt 0.203286 0.437500
-vt 0.137012 0.875000
-vt 0.176363 0.337227
-vt 0.171838 0.718339
-vt 0.234338 0.718339
-vt 0.190964 0.125000
-vt 0.113605 0.062500
-vt 0.169067 0.500000
-vt 0.203125 0.000000
-vt 0.174680 0.625000
-vt 0.134405 0.537235
-vt 0.148421 0.399333
-vt 0.160279 0.250000
-vt 0.121065 0.187500
-vt 0.075252 0.812500
-vt 0.102021 0.334687
-vt 0.140625 1.000000
-vt 0.030235 0.937500
-vt 0.055088 0.153620
-vt 0.112179 0.625000
-vt 0.078286 0.562500
-vt 0.075317 0.500000
-vt 0.109536 0.437500
-vt 0.066529 0.250000
-vt 0.048167 0.750000
-vt 0.108913 0.719958
-vt 0.062500 0.658651
-vt 0.047036 0.437500
-vt 0.032456 0.875000
-vt 0.015664 0.655822
-vt 0.046914 0.344178
-vt 0.000000 0.399333
-vt 0.000000 0.273040
-vt 0.018885 0.520574
-vt 0.000000 0.562500
-vt 0.015625 0.000000
-vt 0.000000 0.062500
-vt 0.000000 0.812500
-vt 1.000000 0.500000
-vt 0.984536 0.562500
-vt 0.950317 0.500000
-vt 0.991904 0.273040
-vt 0.992171 0.399333
-vt 0.950323 0.312500
-vt 1.000000 0.655822
-vt 0.987176 0.750000
-vt 0.953164 0.655822
-vt 0.924676 0.250000
-vt 0.915655 0.537235
-vt 0.953286 0.437500
-vt 0.924679 0.375000
-vt 0.965747 0.812500
-vt 0.910279 0.750000
-vt 0.978825 0.875000
-vt 0.921769 0.937500
-vt 0.871079 0.875000
-vt 0.887823 0.312500
-vt 0.906250 0.656371
-vt 0.965747 0.187500
-vt 0.872588 0.187500
-vt 0.859414 0.655822
-vt 0.859536 0.562500
-vt 0.856567 0.500000
-vt 0.890786 0.437500
-vt 0.855944 0.396148
-vt 0.862176 0.250000
-vt 0.825323 0.312500
-vt 0.873622 0.812500
-vt 0.814726 0.750000
-vt 0.799126 0.125000
-vt 0.939862 0.125000
-vt 0.828125 1.000000
-vt 0.799676 0.250000
-vt 0.796945 0.653777
-vt 0.798190 0.375000
-vt 0.734536 0.437500
-vt 0.797036 0.437500
-vt 0.687500 0.531257
-vt 0.642102 0.625000
-vt 0.390786 0.562500
-vt 0.390665 0.344178
-vt 0.378980 0.250000
-vt 0.387817 0.500000
-vt 0.390786 0.437500
-vt 0.299680 0.625000
-vt 0.000000 0.750000
-vt 0.000000 0.187500
-vt 0.000000 0.125000
-vt 0.801816 0.543181
-s 0
-usemtl Material.001
-f 156/1/1 12/2/1 155/3/1
-f 104/7/3 158/8/3 48/9/3
-f 9/13/5 10/14/5 3/15/5
-f 10/14/6 18/16/6 156/1/6
-f 12/2/11 18/16/11 34/24/11
-f 16/25/12 20/26/12 21/27/12
-f 13/19/13 28/28/13 63/29/13
-f 22/30/14 26/31/14 17/22/14
-f 21/27/16 32/33/16 22/30/16
-f 23/23/17 26/31/17 33/34/17
-f 23/23/18 33/34/18 18/16/18
-f 34/24/19 47/35/19 27/36/19
-f 21/27/20 31/37/20 37/38/20
-f 32/33/21 38/39/21 26/31/21
-f 33/34/24 38/39/24 43/43/24
-f 31/37/26 36/45/26 41/46/26
-f 37/38/27 38/39/27 32/33/27
-f 43/43/29 42/48/29 54/49/29
-f 41/46/32 45/52/32 51/53/32
-f 41/46/33 51/53/33 52/54/33
-f 48/9/34 47/35/34 69/55/34
-f 104/56/35 48/9/35 69/55/35
-f 52/54/36 53/57/36 46/58/36
-f 46/58/37 53/57/37 42/48/37
-f 58/62/43 70/65/43 64/66/43
-f 58/62/44 64/66/44 59/67/44
-f 63/29/47 28/72/47 73/73/47
-f 64/66/50 70/65/50 75/78/50
-f 74/68/53 84/64/53 94/81/53
-f 84/64/58 73/73/58 93/89/58
-f 94/81/60 95/91/60 85/92/60
-f 103/93/61 118/94/61 69/55/61
-f 82/85/62 90/87/62 97/95/62
-f 104/96/63 69/55/63 118/94/63
-f 90/87/64 96/97/64 99/98/64
-f 97/95/65 100/99/65 87/88/65
-f 87/88/66 100/99/66 91/90/66
-f 93/89/68 111/102/68 94/81/68
-f 91/90/69 100/99/69 107/103/69
-f 73/73/70 28/104/70 136/105/70
-f 102/101/71 117/106/71 103/93/71
-f 99/98/72 98/107/72 109/108/72
-f 99/98/73 109/108/73 110/109/73
-f 106/110/74 107/103/74 100/99/74
-f 107/103/75 116/111/75 101/100/75
-f 111/102/76 112/112/76 105/113/76
-f 102/101/77 116/111/77 117/106/77
-f 105/113/78 108/114/78 98/107/78
-f 110/109/79 114/115/79 106/110/79
-f 136/105/80 125/116/80 93/89/80
-f 108/114/81 112/112/81 119/117/81
-f 115/118/82 122/119/82 124/120/82
-f 115/118/83 124/120/83 116/111/83
-f 113/121/84 119/117/84 120/122/84
-f 104/123/85 118/94/85 158/124/85
-f 113/121/86 122/119/86 114/115/86
-f 114/115/87 122/119/87 115/118/87
-f 111/102/88 125/116/88 126/125/88
-f 113/126/89 120/127/89 128/128/89
-f 124/129/90 122/130/90 123/131/90
-f 119/132/91 121/133/91 127/134/91
-f 123/131/92 135/135/92 124/129/92
-f 120/127/93 127/134/93 133/136/93
-f 129/137/94 134/138/94 122/130/94
-f 126/139/95 131/140/95 121/133/95
-f 125/141/96 136/142/96 141/143/96
-f 123/131/97 134/138/97 139/144/97
-f 127/134/98 131/140/98 132/145/98
-f 130/146/99 135/135/99 147/147/99
-f 132/145/100 131/140/100 143/148/100
-f 133/136/101 144/149/101 137/150/101
-f 138/151/102 145/152/102 134/138/102
-f 139/144/103 146/153/103 135/135/103
-f 137/150/104 145/152/104 138/151/104
-f 139/144/105 145/152/105 149/154/105
-f 142/155/106 150/156/106 131/140/106
-f 147/147/107 157/157/107 140/158/107
-f 136/142/108 28/159/108 13/19/108
-f 149/154/109 154/160/109 146/153/109
-f 143/148/110 150/156/110 151/161/110
-f 149/154/111 153/162/111 3/15/111
-f 3/15/115 156/1/115 154/160/115
-f 48/9/116 158/8/116 157/157/116 27/36/116
-f 3/15/120 10/14/120 156/1/120
-f 12/2/122 156/1/122 18/16/122
-f 20/26/125 11/165/125 15/18/125 19/166/125
-f 9/13/127 17/22/127 10/14/127
-f 18/16/129 10/14/129 23/23/129
-f 12/2/130 34/24/130 27/36/130
-f 25/41/131 15/18/131 14/12/131 30/32/131
-f 11/165/132 20/26/132 16/25/132
-f 25/41/133 31/37/133 20/26/133 19/166/133
-f 15/18/134 25/41/134 19/166/134
-f 16/25/135 21/27/135 22/30/135
-f 23/23/137 17/22/137 26/31/137
-f 22/30/138 32/33/138 26/31/138
-f 18/16/139 33/34/139 34/24/139
-f 43/43/140 39/60/140 34/24/140 33/34/140
-f 21/27/141 20/26/141 31/37/141
-f 25/41/142 35/42/142 36/45/142
-f 31/37/143 25/41/143 36/45/143
-f 48/9/144 27/36/144 47/35/144
-f 21/27/145 37/38/145 32/33/145
-f 33/34/146 26/31/146 38/39/146
-f 46/58/149 38/39/149 37/38/149 41/46/149
-f 37/38/151 31/37/151 41/46/151
-f 41/46/152 36/45/152 45/52/152
-f 38/39/154 46/58/154 42/48/154
-f 43/43/156 38/39/156 42/48/156
-f 41/46/160 52/54/160 46/58/160
-f 51/53/161 45/52/161 50/51/161
-f 47/35/171 81/63/171 69/55/171
-f 64/66/176 65/69/176 56/167/176 59/67/176
-f 63/29/183 73/73/183 84/64/183
-f 64/66/186 75/78/186 76/172/186
-f 85/92/191 70/65/191 74/68/191 94/81/191
-f 86/86/192 76/172/192 75/78/192 85/92/192
-f 75/78/193 70/65/193 85/92/193
-f 96/97/196 86/86/196 85/92/196 95/91/196
-f 69/55/197 81/63/197 103/93/197
-f 84/64/200 93/89/200 94/81/200
-f 105/113/204 95/91/204 94/81/204 111/102/204
-f 90/87/205 86/86/205 96/97/205
-f 82/85/206 97/95/206 87/88/206
-f 97/95/208 90/87/208 99/98/208
-f 98/107/209 96/97/209 95/91/209 105/113/209
-f 91/90/210 107/103/210 101/100/210
-f 106/110/211 100/99/211 97/95/211 99/98/211
-f 99/98/212 96/97/212 98/107/212
-f 115/118/213 107/103/213 106/110/213 114/115/213
-f 73/73/214 136/105/214 93/89/214
-f 103/93/215 117/106/215 118/94/215
-f 99/98/216 110/109/216 106/110/216
-f 102/101/217 101/100/217 116/111/217
-f 93/89/218 125/116/218 111/102/218
-f 107/103/219 115/118/219 116/111/219
-f 105/113/220 112/112/220 108/114/220
-f 109/108/221 98/107/221 108/114/221
-f 119/117/222 113/121/222 109/108/222 108/114/222
-f 121/173/223 112/112/223 111/102/223 126/125/223
-f 110/109/224 109/108/224 113/121/224
-f 110/109/225 113/121/225 114/115/225
-f 27/36/226 157/157/226 155/3/226 12/2/226
-f 124/120/227 130/174/227 117/106/227 116/111/227
-f 119/117/228 112/112/228 121/173/228
-f 158/124/229 118/94/229 117/106/229 140/175/229
-f 117/106/230 130/174/230 140/175/230
-f 129/137/231 122/130/231 113/126/231 128/128/231
-f 138/151/232 129/137/232 128/128/232 133/136/232
-f 120/127/233 119/132/233 127/134/233
-f 127/134/234 121/133/234 131/140/234
-f 130/146/235 124/129/235 135/135/235
-f 128/128/236 120/127/236 133/136/236
-f 123/131/237 122/130/237 134/138/237
-f 142/155/238 126/139/238 125/141/238 141/143/238
-f 129/137/239 138/151/239 134/138/239
-f 143/148/240 144/149/240 133/136/240 132/145/240
-f 126/139/241 142/155/241 131/140/241
-f 123/131/242 139/144/242 135/135/242
-f 140/158/243 130/146/243 147/147/243
-f 133/136/244 127/134/244 132/145/244
-f 147/147/245 135/135/245 146/153/245
-f 154/160/246 155/3/246 147/147/246 146/153/246
-f 133/136/247 137/150/247 138/151/247
-f 139/144/248 134/138/248 145/152/248
-f 139/144/249 149/154/249 146/153/249
-f 143/148/250 131/140/250 150/156/250
-f 140/158/251 157/157/251 158/8/251
-f 151/161/252 152/176/252 144/149/252 143/148/252
-f 147/147/253 155/3/253 157/157/253
-f 148/164/254 145/152/254 137/150/254 152/176/254
-f 137/150/255 144/149/255 152/176/255
-f 1/10/257 142/155/257 141/143/257 4/11/257
-f 145/152/258 148/164/258 153/162/258
-f 149/154/260 145/152/260 153/162/260
-f 142/155/261 1/10/261 150/156/261
-f 149/154/262 3/15/262 154/160/262
-f 152/176/263 2/6/263 148/164/263
-f 153/162/266 9/13/266 3/15/266
-f 155/3/268 154/160/268 156/1/268
-usemtl Material.002
-f 25/41/23 30/32/23 35/42/23
-f 44/40/25 40/44/25 30/32/25
-f 44/40/30 49/50/30 40/44/30
-f 40/44/31 49/50/31 50/51/31
-f 57/59/40 58/62/40 49/50/40
-f 63/29/42 84/64/42 55/47/42
-f 57/59/45 84/64/45 74/68/45
-f 24/21/147 44/40/147 30/32/147
-f 35/42/148 30/32/148 40/44/148
-f 45/52/153 36/45/153 35/42/153 40/44/153
-f 40/44/159 50/51/159 45/52/159
-f 44/40/163 57/59/163 49/50/163
-f 50/51/167 49/50/167 58/62/167
-f 50/51/169 58/62/169 59/67/169
-f 70/65/173 58/62/173 57/59/173 74/68/173
-f 55/47/175 84/64/175 57/59/175
-usemtl Material.003
-f 39/60/39 54/49/39 68/61/39
-f 68/61/41 81/63/41 47/35/41
-f 65/69/46 77/70/46 78/71/46
-f 71/74/48 79/75/48 66/76/48
-f 66/76/49 79/75/49 72/77/49
-f 78/71/51 83/79/51 71/74/51
-f 83/79/52 88/80/52 79/75/52
-f 72/77/54 89/82/54 80/83/54
-f 80/83/55 89/82/55 92/84/55
-f 82/85/56 86/86/56 90/87/56
-f 82/85/57 87/88/57 83/79/57
-f 87/88/59 91/90/59 88/80/59
-f 92/84/67 101/100/67 102/101/67
-f 47/35/150 34/24/150 39/60/150
-f 59/67/157 56/167/157 51/53/157 50/51/157
-f 39/60/158 43/43/158 54/49/158
-f 54/49/162 42/48/162 53/57/162
-f 39/60/164 68/61/164 47/35/164
-f 54/49/165 53/57/165 62/168/165
-f 54/49/166 62/168/166 67/169/166
-f 68/61/168 54/49/168 67/169/168
-f 56/167/170 60/170/170 52/54/170 51/53/170
-f 61/171/172 53/57/172 52/54/172 60/170/172
-f 53/57/174 61/171/174 62/168/174
-f 62/168/177 66/76/177 67/169/177
-f 71/74/178 61/171/178 60/170/178 65/69/178
-f 60/170/179 56/167/179 65/69/179
-f 66/76/180 62/168/180 61/171/180 71/74/180
-f 80/83/181 67/169/181 66/76/181 72/77/181
-f 65/69/182 78/71/182 71/74/182
-f 76/172/184 77/70/184 65/69/184 64/66/184
-f 68/61/185 67/169/185 80/83/185
-f 68/61/187 80/83/187 81/63/187
-f 88/80/188 89/82/188 72/77/188 79/75/188
-f 71/74/189 83/79/189 79/75/189
-f 78/71/190 82/85/190 83/79/190
-f 103/93/194 81/63/194 80/83/194 92/84/194
-f 86/86/195 82/85/195 77/70/195 76/172/195
-f 78/71/198 77/70/198 82/85/198
-f 83/79/199 87/88/199 88/80/199
-f 89/82/201 88/80/201 91/90/201
-f 89/82/202 91/90/202 101/100/202
-f 92/84/203 89/82/203 101/100/203
-f 92/84/207 102/101/207 103/93/207
-usemtl Material.004
-f 6/4/2 7/5/2 2/6/2
-f 1/10/4 4/11/4 14/12/4
-f 5/17/7 15/18/7 6/4/7
-f 13/19/8 29/20/8 4/11/8
-f 29/20/9 24/21/9 14/12/9
-f 10/14/10 17/22/10 23/23/10
-f 24/21/15 30/32/15 14/12/15
-f 29/20/22 44/40/22 24/21/22
-f 29/20/28 63/29/28 55/47/28
-f 44/40/38 55/47/38 57/59/38
-f 151/161/112 5/17/112 6/4/112
-f 2/6/113 8/163/113 148/164/113
-f 150/156/114 1/10/114 5/17/114
-f 15/18/117 11/165/117 7/5/117 6/4/117
-f 2/6/118 7/5/118 8/163/118
-f 5/17/119 1/10/119 14/12/119
-f 5/17/121 14/12/121 15/18/121
-f 16/25/123 8/163/123 7/5/123 11/165/123
-f 17/22/124 9/13/124 8/163/124 16/25/124
-f 4/11/126 29/20/126 14/12/126
-f 16/25/128 22/30/128 17/22/128
-f 13/19/136 63/29/136 29/20/136
-f 29/20/155 55/47/155 44/40/155
-f 13/19/256 4/11/256 141/143/256 136/142/256
-f 9/13/259 153/162/259 148/164/259 8/163/259
-f 152/176/264 151/161/264 6/4/264
-f 2/6/265 152/176/265 6/4/265
-f 151/161/267 150/156/267 5/17/267
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'sphere.blend'
-# www.blender.org
-
-newmtl Material.001
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.100026 0.800000 0.140501
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.002
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.722718 0.092650
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.003
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.064691 0.088050
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.004
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.108336 0.240218 0.800000
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-)X"},{.name = "spheres", .scene = R"X(# path to .obj file
-o models/spheres.obj
-
-# path to .mtl file
-m models/spheres.mtl
-
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
-
-# camera position vector
-cp -10.0 10.0 -20.0
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib spheres.mtl
-o Sphere
-v -0.476181 0.838792 -0.540528
-v -0.456767 -0.008211 -0.999782
-v -0.442764 -0.562790 -0.826308
-v -0.398158 0.924637 -0.388341
-v -0.291443 0.628184 -0.784051
-v -0.310746 0.301900 -0.959114
-v -0.156952 0.098528 -0.977101
-v -0.273102 -0.197140 -0.980385
-v -0.279667 -0.385888 -0.922658
-v -0.124789 -0.548469 -0.803951
-v 0.013243 0.098313 -0.922007
-v -0.203792 -0.830951 -0.534609
-v -0.348717 0.981621 -0.202530
-v -0.095990 0.778878 -0.579104
-v 0.016578 0.487290 -0.794419
-v 0.115544 -0.088966 -0.879647
-v 0.059944 -0.378984 -0.824061
-v 0.014942 -0.718498 -0.591826
-v 0.210513 0.391797 -0.719220
-v 0.254037 0.212795 -0.758764
-v 0.418744 -0.000000 -0.623425
-v 0.261993 -0.204561 -0.753321
-v 0.164084 -0.562888 -0.637685
-v 0.029157 0.834685 -0.391058
-v 0.318216 0.503271 -0.537872
-v 0.337371 -0.385203 -0.600455
-v -0.159373 -0.926351 -0.329937
-v -0.368665 1.000000 0.000000
-v -0.067492 0.932889 -0.235828
-v 0.212591 0.717473 -0.397691
-v 0.499589 0.197140 -0.465214
-v 0.499589 -0.197140 -0.465214
-v 0.326876 -0.633224 -0.359460
-v 0.073598 -0.834889 -0.347961
-v 0.433042 0.557974 -0.227921
-v 0.513411 0.385203 -0.284560
-v 0.597380 0.000000 -0.274641
-v 0.549998 -0.316658 -0.269816
-v 0.186431 -0.836769 0.008386
-v 0.396107 0.653956 -0.050543
-v 0.631858 0.115511 -0.064524
-v 0.555163 -0.385203 0.074657
-v 0.407082 -0.638968 -0.072222
-v 0.183119 0.842014 -0.044455
-v 0.555164 0.385203 0.074657
-v 0.611720 -0.197140 0.095565
-v 0.016285 -0.929162 -0.008339
-v -0.200218 -0.984947 -0.112553
-v 0.312908 0.708715 0.193768
-v 0.458388 0.497100 0.285319
-v 0.574239 0.197140 0.284992
-v 0.587155 0.000000 0.308350
-v 0.526094 -0.291792 0.351487
-v 0.375670 -0.638968 0.230140
-v 0.001402 0.924637 0.121363
-v 0.393403 0.197140 0.624132
-v 0.087865 0.834055 0.321752
-v 0.230940 0.638968 0.497466
-v 0.357993 0.385203 0.575326
-v 0.396397 -0.000000 0.650654
-v 0.393403 -0.197140 0.624132
-v 0.320642 -0.475433 0.561978
-v -0.170967 0.986420 0.025750
-v 0.125267 0.473967 0.735457
-v 0.172546 0.098529 0.840618
-v 0.125267 -0.473967 0.735457
-v 0.145740 -0.712804 0.489428
-v 0.052992 -0.838086 0.366403
-v -0.272948 -0.983075 0.179074
-v -0.080713 0.712804 0.649027
-v 0.096549 -0.197140 0.868253
-v -0.140744 -0.557974 0.801707
-v -0.394355 0.981636 0.200666
-v -0.167830 0.834055 0.521161
-v -0.140744 0.557974 0.801707
-v -0.084105 0.385203 0.882076
-v -0.081778 0.197140 0.942328
-v -0.094024 0.000000 0.966044
-v -0.084105 -0.385203 0.882076
-v -0.177474 -0.777723 0.609921
-v -0.143936 -0.926351 0.319622
-v -0.462080 0.074357 1.001902
-v -0.271130 -0.197140 0.980191
-v -0.266042 0.932889 0.368494
-v -0.449171 0.638968 0.774930
-v -0.443321 0.385203 0.923828
-v -0.653657 -0.197140 0.942903
-v -0.443321 -0.385202 0.923828
-v -0.449171 -0.638968 0.774930
-v -0.653657 0.197140 0.942903
-v -0.765136 -0.491477 0.786423
-v -0.491218 -0.834056 0.544908
-v -0.622408 0.924637 0.295453
-v -0.543076 0.834889 0.535026
-v -0.739595 0.638968 0.685134
-v -0.791172 0.385203 0.824936
-v -0.857561 -0.000000 0.877297
-v -1.074700 0.385203 0.600455
-v -1.030515 0.115512 0.753101
-v -0.939285 -0.313439 0.768509
-v -0.748333 -0.712804 0.600003
-v -0.773299 -0.834056 0.384987
-v -0.508274 -0.929162 0.358838
-v -0.368665 -1.000000 0.000000
-v -0.973549 0.638968 0.491032
-v -1.129476 -0.197140 0.625662
-v -1.065385 -0.497100 0.529154
-v -1.180458 0.480539 0.347680
-v -1.236918 0.197140 0.465213
-v -1.262567 0.000000 0.457830
-v -0.861433 0.842014 0.252230
-v -1.041682 0.711675 0.210147
-v -1.369539 0.074358 0.103840
-v -1.310993 -0.197140 0.286887
-v -1.218891 -0.475433 0.260919
-v -1.017692 -0.712804 0.287952
-v -0.811656 -0.893458 0.139565
-v -0.521239 -0.981636 0.132844
-v -1.253456 0.475433 0.090034
-v -1.349049 0.197140 -0.095565
-v -1.074944 0.708715 -0.057076
-v -1.324676 -0.313439 -0.047493
-v -1.161885 -0.557974 -0.255895
-v -1.129516 -0.656278 -0.043728
-v -0.753614 0.929162 -0.008339
-v -0.917109 0.831849 -0.119539
-v -1.220560 0.475433 -0.255414
-v -1.324483 0.000000 -0.308350
-v -1.311568 -0.197140 -0.284992
-v -0.917110 -0.831849 -0.119539
-v -0.968668 0.712804 -0.379669
-v -1.106445 0.473967 -0.490454
-v -1.236416 0.115513 -0.502210
-v -1.193600 -0.385203 -0.422507
-v -0.999339 -0.708715 -0.323013
-v -0.567614 0.985942 -0.019595
-v -0.992089 0.000000 -0.787408
-v -1.130732 -0.197140 -0.624132
-v -1.003578 -0.557974 -0.539968
-v -0.728866 -0.927993 -0.142649
-v -0.634593 0.924550 -0.279499
-v -0.759722 0.834685 -0.397822
-v -0.935089 0.475433 -0.685657
-v -0.994327 0.197140 -0.760811
-v -0.969499 -0.316657 -0.745480
-v -0.827720 -0.708715 -0.539774
-v -0.755246 -0.836769 -0.398441
-v -0.655553 -0.197141 -0.942327
-v -0.748611 -0.557974 -0.741837
-v -0.647630 0.718497 -0.647758
-v -0.629584 0.475432 -0.850226
-v -0.669572 0.127072 -0.953234
-v -0.644442 -0.391922 -0.882854
-v -0.586215 -0.708715 -0.674358
-v -0.471444 -0.836302 -0.544661
-v -0.311588 -0.708714 -0.706279
-v -0.486245 -0.925922 -0.368665
-v -0.516259 -0.984597 -0.138739
-vn 0.0384 -0.8024 -0.5955
-vn 0.0345 0.1139 -0.9929
-vn 0.0088 -0.9928 -0.1196
-vn 0.0811 0.8498 -0.5209
-vn 0.0832 -0.5347 -0.8409
-vn 0.2231 -0.6836 -0.6949
-vn 0.1796 0.4568 -0.8712
-vn 0.1247 0.9388 -0.3211
-vn 0.2296 0.8807 -0.4142
-vn 0.4035 -0.5285 -0.7469
-vn 0.3037 -0.8294 -0.4689
-vn 0.6435 0.0113 -0.7654
-vn 0.0790 0.9935 -0.0824
-vn 0.5770 -0.3738 -0.7262
-vn 0.4482 0.7306 -0.5151
-vn 0.7602 -0.1875 -0.6221
-vn 0.6623 -0.5363 -0.5231
-vn 0.5511 -0.6734 -0.4927
-vn 0.3451 -0.9178 -0.1965
-vn 0.8901 0.0008 -0.4559
-vn 0.8114 -0.3815 -0.4427
-vn 0.4836 0.8438 -0.2327
-vn 0.7145 0.5941 -0.3695
-vn 0.8242 -0.5128 -0.2404
-vn 0.6444 0.7365 -0.2059
-vn 0.9429 0.1921 -0.2721
-vn 0.9331 -0.1446 -0.3292
-vn 0.3605 0.9315 -0.0480
-vn 0.8377 -0.5392 0.0870
-vn 0.6617 0.7475 0.0578
-vn 0.7886 0.6001 0.1340
-vn 0.9695 0.2197 0.1085
-vn 0.9863 0.0816 0.1435
-vn 0.2212 -0.9733 0.0614
-vn 0.1116 -0.9932 0.0342
-vn 0.9523 -0.1610 0.2591
-vn 0.9319 -0.3025 0.1999
-vn 0.5220 0.8389 0.1540
-vn 0.5765 -0.7891 0.2120
-vn 0.5954 0.7330 0.3290
-vn 0.3647 -0.9123 0.1860
-vn 0.2241 0.9515 0.2108
-vn 0.4564 0.6234 0.6349
-vn 0.6126 0.4956 0.6156
-vn 0.2950 0.8774 0.3783
-vn 0.3983 0.0851 0.9133
-vn 0.0555 0.9936 0.0980
-vn 0.4314 -0.3534 0.8300
-vn 0.3528 -0.4873 0.7988
-vn 0.3644 0.5784 0.7298
-vn 0.2860 -0.1895 0.9393
-vn 0.1071 -0.3741 0.9212
-vn 0.0216 0.8455 0.5335
-vn 0.1101 -0.6639 0.7396
-vn 0.0030 -0.7629 0.6465
-vn -0.1357 0.2490 0.9589
-vn -0.0960 -0.1462 0.9846
-vn -0.0917 0.9353 0.3418
-vn -0.2559 -0.3765 0.8904
-vn -0.2059 0.7169 0.6661
-vn -0.0482 -0.9723 0.2285
-vn -0.2991 -0.0082 0.9542
-vn -0.0258 -0.9938 0.1077
-vn -0.4743 0.1921 0.8591
-vn -0.4570 -0.1830 0.8705
-vn -0.4020 -0.3064 0.8628
-vn -0.2812 -0.8216 0.4959
-vn -0.3634 0.8265 0.4300
-vn -0.5640 -0.4844 0.6688
-vn -0.0782 0.9936 0.0809
-vn -0.3018 -0.9148 0.2686
-vn -0.7623 0.2197 0.6088
-vn -0.7989 0.0816 0.5959
-vn -0.6900 -0.3511 0.6329
-vn -0.5632 -0.6682 0.4862
-vn -0.6023 0.7251 0.3338
-vn -0.5130 -0.8125 0.2768
-vn -0.7181 0.4965 0.4877
-vn -0.8655 -0.1895 0.4637
-vn -0.2817 0.9498 0.1358
-vn -0.7786 0.5918 0.2089
-vn -0.8686 -0.4940 0.0384
-vn -0.7626 -0.6293 0.1499
-vn -0.9573 0.2796 0.0738
-vn -0.1120 -0.9937 0.0088
-vn -0.9844 -0.1500 0.0924
-vn -0.9342 -0.3233 0.1507
-vn -0.5393 0.8401 0.0578
-vn -0.9942 -0.0082 -0.1072
-vn -0.8645 -0.4932 -0.0966
-vn -0.8148 0.5746 -0.0776
-vn -0.7097 -0.6743 -0.2042
-vn -0.9192 0.2494 -0.3047
-vn -0.8916 -0.3853 -0.2379
-vn -0.6512 0.7306 -0.2053
-vn -0.2969 0.9436 -0.1464
-vn -0.7391 -0.5329 -0.4119
-vn -0.7278 0.5855 -0.3570
-vn -0.5127 -0.8105 -0.2833
-vn -0.6064 0.5947 -0.5279
-vn -0.7403 0.0816 -0.6673
-vn -0.7195 -0.3815 -0.5802
-vn -0.5783 -0.6752 -0.4579
-vn -0.6612 -0.1446 -0.7361
-vn -0.5370 -0.5017 -0.6782
-vn -0.4598 0.7084 -0.5355
-vn -0.2703 -0.9153 -0.2986
-vn -0.0607 0.9935 -0.0961
-vn -0.3591 -0.6752 -0.6443
-vn -0.3889 0.5724 -0.7219
-vn -0.2318 -0.5411 -0.8084
-vn -0.0422 0.4743 -0.8794
-vn -0.0971 -0.1946 -0.9761
-vn -0.0789 0.7236 -0.6857
-vn -0.0849 -0.6774 -0.7307
-vn 0.0241 -0.9680 -0.2500
-vn 0.2910 0.2974 -0.9093
-vn 0.0830 -0.0216 -0.9963
-vn 0.0588 0.7767 -0.6271
-vn 0.0831 -0.5875 -0.8050
-vn 0.2671 0.6370 -0.7231
-vn 0.2060 -0.7314 -0.6501
-vn 0.2829 -0.0854 -0.9553
-vn 0.2926 -0.2560 -0.9213
-vn 0.4520 0.2811 -0.8465
-vn 0.1691 0.8939 -0.4151
-vn 0.2638 -0.3921 -0.8813
-vn 0.5082 -0.2551 -0.8226
-vn 0.3844 -0.5801 -0.7182
-vn 0.2946 -0.8401 -0.4555
-vn 0.4818 0.6334 -0.6055
-vn 0.5266 0.0966 -0.8446
-vn 0.7356 0.2995 -0.6076
-vn 0.5234 0.5513 -0.6497
-vn 0.6475 -0.0123 -0.7620
-vn 0.1530 0.9783 -0.1397
-vn 0.5685 -0.4043 -0.7165
-vn 0.7573 -0.2080 -0.6191
-vn 0.5385 -0.7028 -0.4649
-vn 0.6104 -0.7685 -0.1922
-vn 0.7580 0.1899 -0.6240
-vn 0.7861 0.4894 -0.3776
-vn 0.8108 0.3734 -0.4507
-vn 0.3288 -0.9255 -0.1877
-vn 0.8901 -0.0008 -0.4559
-vn 0.7938 -0.4408 -0.4191
-vn 0.5155 0.8207 -0.2463
-vn 0.6815 0.6936 -0.2334
-vn 0.9848 -0.1344 -0.1097
-vn 0.4832 -0.8612 -0.1575
-vn 0.9408 0.2073 -0.2683
-vn 0.9398 0.3236 -0.1092
-vn 0.8813 0.4638 -0.0909
-vn 0.9574 -0.2801 -0.0701
-vn 0.3745 0.9258 -0.0509
-vn 0.8840 -0.4557 -0.1039
-vn 0.8478 0.3058 0.4333
-vn 0.6800 -0.7298 0.0706
-vn 0.8360 0.5400 0.0972
-vn 0.9930 -0.0036 0.1179
-vn 0.9077 0.3503 0.2309
-vn 0.8559 -0.4561 0.2438
-vn 0.5484 0.8207 0.1605
-vn 0.4577 -0.8732 0.1674
-vn 0.8001 -0.4748 0.3667
-vn 0.6670 -0.6185 0.4154
-vn 0.7031 0.6278 0.3339
-vn 0.5909 -0.7439 0.3121
-vn 0.7356 0.5064 0.4500
-vn 0.8739 0.0956 0.4766
-vn 0.2678 -0.9534 0.1390
-vn 0.8744 -0.0984 0.4751
-vn 0.4056 0.7691 0.4939
-vn 0.8025 -0.3220 0.5023
-vn 0.2926 0.9124 0.2862
-vn 0.6074 0.2911 0.7391
-vn 0.5373 -0.5824 0.6100
-vn 0.6261 -0.0986 0.7735
-vn 0.6706 0.1089 0.7338
-vn 0.6158 -0.3041 0.7269
-vn 0.3741 -0.6473 0.6641
-vn 0.4338 -0.0273 0.9006
-vn 0.1256 0.9743 0.1870
-vn 0.4569 0.2873 0.8418
-vn 0.3514 -0.7754 0.5247
-vn 0.3528 0.4873 0.7988
-vn 0.2684 -0.8445 0.4634
-vn 0.0779 -0.4808 0.8733
-vn 0.2851 -0.2050 0.9363
-vn 0.0943 -0.0133 0.9955
-vn 0.0449 0.7673 0.6397
-vn 0.0779 0.4808 0.8733
-vn 0.1139 0.6748 0.7291
-vn 0.0601 -0.8878 0.4563
-vn 0.0879 0.2635 0.9607
-vn -0.2462 0.4959 0.8328
-vn 0.0437 -0.9397 0.3391
-vn 0.1186 0.1113 0.9867
-vn -0.0950 -0.2050 0.9741
-vn -0.0987 0.9207 0.3776
-vn -0.1991 -0.4925 0.8472
-vn -0.2688 -0.6324 0.7266
-vn -0.2031 -0.7281 0.6547
-vn -0.4037 0.7794 0.4792
-vn -0.2536 0.3741 0.8920
-vn -0.3014 0.0055 0.9535
-vn -0.2598 -0.8500 0.4583
-vn -0.4755 0.2073 0.8550
-vn -0.5461 0.4959 0.6752
-vn -0.5284 -0.5700 0.6292
-vn -0.6324 -0.1070 0.7672
-vn -0.5873 0.3236 0.7418
-vn -0.8341 -0.3204 0.4489
-vn -0.1770 0.9714 0.1582
-vn -0.2776 -0.9322 0.2324
-vn -0.7856 -0.0036 0.6188
-vn -0.5345 -0.7081 0.4614
-vn -0.3487 0.9227 0.1643
-vn -0.7289 -0.5756 0.3706
-vn -0.7078 0.6231 0.3330
-vn -0.8065 0.3563 0.4718
-vn -0.9265 0.2815 0.2496
-vn -0.5960 0.8002 0.0665
-vn -0.9446 0.1113 0.3088
-vn -0.9579 -0.0133 0.2867
-vn 0.0435 -0.8972 -0.4395
-vn -0.6233 -0.7785 0.0736
-vn -0.7635 0.6397 0.0880
-vn -0.2764 -0.9608 0.0212
-vn -0.4572 -0.8890 -0.0253
-vn -0.9926 -0.0775 -0.0939
-vn -0.8769 -0.1137 -0.4670
-vn -0.9226 0.3755 -0.0879
-vn -0.7252 0.6488 -0.2307
-vn -0.6634 -0.7281 -0.1725
-vn -0.9313 0.2073 -0.2996
-vn -0.8896 -0.3910 -0.2361
-vn -0.4097 0.8880 -0.2090
-vn -0.8637 -0.2050 -0.4605
-vn -0.7317 0.3009 -0.6116
-vn -0.5021 0.8197 -0.2756
-vn -0.7071 -0.5871 -0.3941
-vn -0.4645 -0.8482 -0.2546
-vn -0.8508 0.3221 -0.4151
-vn -0.5199 -0.7485 -0.4116
-vn -0.2897 -0.7881 -0.5432
-vn -0.7601 -0.0036 -0.6498
-vn -0.7147 -0.3923 -0.5791
-vn -0.5025 -0.5871 -0.6347
-vn -0.4863 0.6637 -0.5683
-vn -0.2431 -0.9318 -0.2695
-vn -0.4424 0.3094 -0.8418
-vn -0.2339 -0.8583 -0.4567
-vn -0.4634 -0.0991 -0.8806
-vn -0.4887 0.1112 -0.8653
-vn -0.1331 0.9660 -0.2218
-vn -0.2091 0.8843 -0.4174
-vn -0.4285 -0.2861 -0.8571
-vn -0.0968 -0.2919 -0.9515
-vn -0.4340 -0.4093 -0.8026
-vn -0.2643 0.8238 -0.5015
-vn -0.2238 -0.5888 -0.7767
-vn -0.2395 -0.0430 -0.9699
-vn -0.1600 0.2968 -0.9415
-vn -0.1020 0.1764 -0.9790
-vn -0.0923 -0.4093 -0.9077
-vn -0.1339 0.6284 -0.7663
-vn -0.0771 -0.7440 -0.6637
-vt 0.737176 0.250000
-vt 0.702383 0.187500
-vt 0.779637 0.187500
-vt 0.741874 0.599249
-vt 0.718750 0.531273
-vt 0.763980 0.500000
-vt 0.734375 0.000000
-vt 0.879629 0.062500
-vt 0.593677 0.062500
-vt 0.781230 0.812500
-vt 0.762032 0.875000
-vt 0.685473 0.777944
-vt 0.734697 0.375000
-vt 0.703125 0.312500
-vt 0.764235 0.312500
-vt 0.658359 0.250000
-vt 0.734375 0.717281
-vt 0.678319 0.660608
-vt 0.734224 0.937500
-vt 0.605595 0.875000
-vt 0.623673 0.812500
-vt 0.673680 0.375000
-vt 0.639230 0.312500
-vt 0.606077 0.187500
-vt 0.670132 0.472235
-vt 0.640625 0.562500
-vt 0.606567 0.500000
-vt 0.640625 1.000000
-vt 0.479138 0.937500
-vt 0.639064 0.437500
-vt 0.612180 0.375000
-vt 0.595563 0.750000
-vt 0.578286 0.437500
-vt 0.577540 0.283466
-vt 0.503540 0.125000
-vt 0.660224 0.125000
-vt 0.578286 0.562500
-vt 0.544067 0.500000
-vt 0.543444 0.396147
-vt 0.512752 0.812500
-vt 0.603325 0.667055
-vt 0.544073 0.687500
-vt 0.515588 0.281661
-vt 0.510998 0.724803
-vt 0.549680 0.625000
-vt 0.509405 0.537235
-vt 0.449506 0.875000
-vt 0.487179 0.375000
-vt 0.453088 0.281661
-vt 0.455926 0.750000
-vt 0.445771 0.665313
-vt 0.487180 0.625000
-vt 0.453286 0.562500
-vt 0.450317 0.500000
-vt 0.328120 0.062500
-vt 0.453125 0.000000
-vt 0.437500 0.406180
-vt 0.484536 0.437500
-vt 0.402284 0.812500
-vt 0.497588 0.187500
-vt 0.386121 0.187500
-vt 0.390588 0.718339
-vt 0.347717 0.125000
-vt 0.293360 0.875000
-vt 0.316528 0.750000
-vt 0.343750 0.656371
-vt 0.393429 0.625000
-vt 0.308534 0.812500
-vt 0.343750 0.531273
-vt 0.297036 0.562500
-vt 0.294067 0.500000
-vt 0.328125 1.000000
-vt 0.230145 0.937500
-vt 0.328286 0.437500
-vt 0.299679 0.375000
-vt 0.343750 0.343629
-vt 0.294073 0.312500
-vt 0.294073 0.687500
-vt 0.265786 0.437500
-vt 0.237180 0.375000
-vt 0.199790 0.812500
-vt 0.234338 0.281661
-vt 0.296902 0.219059
-vt 0.214815 0.187500
-vt 0.237635 0.520573
-vt 0.237180 0.625000
-vt 0.203286 0.562500
-vt 0.203286 0.437500
-vt 0.137012 0.875000
-vt 0.176363 0.337227
-vt 0.171838 0.718339
-vt 0.234338 0.718339
-vt 0.190964 0.125000
-vt 0.113605 0.062500
-vt 0.169067 0.500000
-vt 0.203125 0.000000
-vt 0.174680 0.625000
-vt 0.134405 0.537235
-vt 0.148421 0.399333
-vt 0.160279 0.250000
-vt 0.121065 0.187500
-vt 0.075252 0.812500
-vt 0.102021 0.334687
-vt 0.140625 1.000000
-vt 0.030235 0.937500
-vt 0.055088 0.153620
-vt 0.112179 0.625000
-vt 0.078286 0.562500
-vt 0.075317 0.500000
-vt 0.109536 0.437500
-vt 0.066529 0.250000
-vt 0.048167 0.750000
-vt 0.108913 0.719958
-vt 0.062500 0.658651
-vt 0.047036 0.437500
-vt 0.032456 0.875000
-vt 0.015664 0.655822
-vt 0.046914 0.344178
-vt 0.000000 0.399333
-vt 0.000000 0.273040
-vt 0.018885 0.520574
-vt 0.000000 0.562500
-vt 0.015625 0.000000
-vt 0.000000 0.062500
-vt 0.000000 0.812500
-vt 1.000000 0.500000
-vt 0.984536 0.562500
-vt 0.950317 0.500000
-vt 0.991904 0.273040
-vt 0.992171 0.399333
-vt 0.950323 0.312500
-vt 1.000000 0.655822
-vt 0.987176 0.750000
-vt 0.953164 0.655822
-vt 0.924676 0.250000
-vt 0.915655 0.537235
-vt 0.953286 0.437500
-vt 0.924679 0.375000
-vt 0.965747 0.812500
-vt 0.910279 0.750000
-vt 0.978825 0.875000
-vt 0.921769 0.937500
-vt 0.871079 0.875000
-vt 0.887823 0.312500
-vt 0.906250 0.656371
-vt 0.965747 0.187500
-vt 0.872588 0.187500
-vt 0.859414 0.655822
-vt 0.859536 0.562500
-vt 0.856567 0.500000
-vt 0.890786 0.437500
-vt 0.855944 0.396148
-vt 0.862176 0.250000
-vt 0.825323 0.312500
-vt 0.873622 0.812500
-vt 0.814726 0.750000
-vt 0.799126 0.125000
-vt 0.939862 0.125000
-vt 0.828125 1.000000
-vt 0.799676 0.250000
-vt 0.796945 0.653777
-vt 0.798190 0.375000
-vt 0.734536 0.437500
-vt 0.797036 0.437500
-vt 0.687500 0.531257
-vt 0.642102 0.625000
-vt 0.390786 0.562500
-vt 0.390665 0.344178
-vt 0.378980 0.250000
-vt 0.387817 0.500000
-vt 0.390786 0.437500
-vt 0.299680 0.625000
-vt 0.000000 0.750000
-vt 0.000000 0.187500
-vt 0.000000 0.125000
-vt 0.801816 0.543181
-s 0
-usemtl Material.001
-f 156/1/1 12/2/1 155/3/1
-f 104/7/3 158/8/3 48/9/3
-f 9/13/5 10/14/5 3/15/5
-f 10/14/6 18/16/6 156/1/6
-f 12/2/11 18/16/11 34/24/11
-f 16/25/12 20/26/12 21/27/12
-f 13/19/13 28/28/13 63/29/13
-f 22/30/14 26/31/14 17/22/14
-f 21/27/16 32/33/16 22/30/16
-f 23/23/17 26/31/17 33/34/17
-f 23/23/18 33/34/18 18/16/18
-f 34/24/19 47/35/19 27/36/19
-f 21/27/20 31/37/20 37/38/20
-f 32/33/21 38/39/21 26/31/21
-f 33/34/24 38/39/24 43/43/24
-f 31/37/26 36/45/26 41/46/26
-f 37/38/27 38/39/27 32/33/27
-f 43/43/29 42/48/29 54/49/29
-f 41/46/32 45/52/32 51/53/32
-f 41/46/33 51/53/33 52/54/33
-f 48/9/34 47/35/34 69/55/34
-f 104/56/35 48/9/35 69/55/35
-f 52/54/36 53/57/36 46/58/36
-f 46/58/37 53/57/37 42/48/37
-f 58/62/43 70/65/43 64/66/43
-f 58/62/44 64/66/44 59/67/44
-f 63/29/47 28/72/47 73/73/47
-f 64/66/50 70/65/50 75/78/50
-f 74/68/53 84/64/53 94/81/53
-f 84/64/58 73/73/58 93/89/58
-f 94/81/60 95/91/60 85/92/60
-f 103/93/61 118/94/61 69/55/61
-f 82/85/62 90/87/62 97/95/62
-f 104/96/63 69/55/63 118/94/63
-f 90/87/64 96/97/64 99/98/64
-f 97/95/65 100/99/65 87/88/65
-f 87/88/66 100/99/66 91/90/66
-f 93/89/68 111/102/68 94/81/68
-f 91/90/69 100/99/69 107/103/69
-f 73/73/70 28/104/70 136/105/70
-f 102/101/71 117/106/71 103/93/71
-f 99/98/72 98/107/72 109/108/72
-f 99/98/73 109/108/73 110/109/73
-f 106/110/74 107/103/74 100/99/74
-f 107/103/75 116/111/75 101/100/75
-f 111/102/76 112/112/76 105/113/76
-f 102/101/77 116/111/77 117/106/77
-f 105/113/78 108/114/78 98/107/78
-f 110/109/79 114/115/79 106/110/79
-f 136/105/80 125/116/80 93/89/80
-f 108/114/81 112/112/81 119/117/81
-f 115/118/82 122/119/82 124/120/82
-f 115/118/83 124/120/83 116/111/83
-f 113/121/84 119/117/84 120/122/84
-f 104/123/85 118/94/85 158/124/85
-f 113/121/86 122/119/86 114/115/86
-f 114/115/87 122/119/87 115/118/87
-f 111/102/88 125/116/88 126/125/88
-f 113/126/89 120/127/89 128/128/89
-f 124/129/90 122/130/90 123/131/90
-f 119/132/91 121/133/91 127/134/91
-f 123/131/92 135/135/92 124/129/92
-f 120/127/93 127/134/93 133/136/93
-f 129/137/94 134/138/94 122/130/94
-f 126/139/95 131/140/95 121/133/95
-f 125/141/96 136/142/96 141/143/96
-f 123/131/97 134/138/97 139/144/97
-f 127/134/98 131/140/98 132/145/98
-f 130/146/99 135/135/99 147/147/99
-f 132/145/100 131/140/100 143/148/100
-f 133/136/101 144/149/101 137/150/101
-f 138/151/102 145/152/102 134/138/102
-f 139/144/103 146/153/103 135/135/103
-f 137/150/104 145/152/104 138/151/104
-f 139/144/105 145/152/105 149/154/105
-f 142/155/106 150/156/106 131/140/106
-f 147/147/107 157/157/107 140/158/107
-f 136/142/108 28/159/108 13/19/108
-f 149/154/109 154/160/109 146/153/109
-f 143/148/110 150/156/110 151/161/110
-f 149/154/111 153/162/111 3/15/111
-f 3/15/115 156/1/115 154/160/115
-f 48/9/116 158/8/116 157/157/116 27/36/116
-f 3/15/120 10/14/120 156/1/120
-f 12/2/122 156/1/122 18/16/122
-f 20/26/125 11/165/125 15/18/125 19/166/125
-f 9/13/127 17/22/127 10/14/127
-f 18/16/129 10/14/129 23/23/129
-f 12/2/130 34/24/130 27/36/130
-f 25/41/131 15/18/131 14/12/131 30/32/131
-f 11/165/132 20/26/132 16/25/132
-f 25/41/133 31/37/133 20/26/133 19/166/133
-f 15/18/134 25/41/134 19/166/134
-f 16/25/135 21/27/135 22/30/135
-f 23/23/137 17/22/137 26/31/137
-f 22/30/138 32/33/138 26/31/138
-f 18/16/139 33/34/139 34/24/139
-f 43/43/140 39/60/140 34/24/140 33/34/140
-f 21/27/141 20/26/141 31/37/141
-f 25/41/142 35/42/142 36/45/142
-f 31/37/143 25/41/143 36/45/143
-f 48/9/144 27/36/144 47/35/144
-f 21/27/145 37/38/145 32/33/145
-f 33/34/146 26/31/146 38/39/146
-f 46/58/149 38/39/149 37/38/149 41/46/149
-f 37/38/151 31/37/151 41/46/151
-f 41/46/152 36/45/152 45/52/152
-f 38/39/154 46/58/154 42/48/154
-f 43/43/156 38/39/156 42/48/156
-f 41/46/160 52/54/160 46/58/160
-f 51/53/161 45/52/161 50/51/161
-f 47/35/171 81/63/171 69/55/171
-f 64/66/176 65/69/176 56/167/176 59/67/176
-f 63/29/183 73/73/183 84/64/183
-f 64/66/186 75/78/186 76/172/186
-f 85/92/191 70/65/191 74/68/191 94/81/191
-f 86/86/192 76/172/192 75/78/192 85/92/192
-f 75/78/193 70/65/193 85/92/193
-f 96/97/196 86/86/196 85/92/196 95/91/196
-f 69/55/197 81/63/197 103/93/197
-f 84/64/200 93/89/200 94/81/200
-f 105/113/204 95/91/204 94/81/204 111/102/204
-f 90/87/205 86/86/205 96/97/205
-f 82/85/206 97/95/206 87/88/206
-f 97/95/208 90/87/208 99/98/208
-f 98/107/209 96/97/209 95/91/209 105/113/209
-f 91/90/210 107/103/210 101/100/210
-f 106/110/211 100/99/211 97/95/211 99/98/211
-f 99/98/212 96/97/212 98/107/212
-f 115/118/213 107/103/213 106/110/213 114/115/213
-f 73/73/214 136/105/214 93/89/214
-f 103/93/215 117/106/215 118/94/215
-f 99/98/216 110/109/216 106/110/216
-f 102/101/217 101/100/217 116/111/217
-f 93/89/218 125/116/218 111/102/218
-f 107/103/219 115/118/219 116/111/219
-f 105/113/220 112/112/220 108/114/220
-f 109/108/221 98/107/221 108/114/221
-f 119/117/222 113/121/222 109/108/222 108/114/222
-f 121/173/223 112/112/223 111/102/223 126/125/223
-f 110/109/224 109/108/224 113/121/224
-f 110/109/225 113/121/225 114/115/225
-f 27/36/226 157/157/226 155/3/226 12/2/226
-f 124/120/227 130/174/227 117/106/227 116/111/227
-f 119/117/228 112/112/228 121/173/228
-f 158/124/229 118/94/229 117/106/229 140/175/229
-f 117/106/230 130/174/230 140/175/230
-f 129/137/231 122/130/231 113/126/231 128/128/231
-f 138/151/232 129/137/232 128/128/232 133/136/232
-f 120/127/233 119/132/233 127/134/233
-f 127/134/234 121/133/234 131/140/234
-f 130/146/235 124/129/235 135/135/235
-f 128/128/236 120/127/236 133/136/236
-f 123/131/237 122/130/237 134/138/237
-f 142/155/238 126/139/238 125/141/238 141/143/238
-f 129/137/239 138/151/239 134/138/239
-f 143/148/240 144/149/240 133/136/240 132/145/240
-f 126/139/241 142/155/241 131/140/241
-f 123/131/242 139/144/242 135/135/242
-f 140/158/243 130/146/243 147/147/243
-f 133/136/244 127/134/244 132/145/244
-f 147/147/245 135/135/245 146/153/245
-f 154/160/246 155/3/246 147/147/246 146/153/246
-f 133/136/247 137/150/247 138/151/247
-f 139/144/248 134/138/248 145/152/248
-f 139/144/249 149/154/249 146/153/249
-f 143/148/250 131/140/250 150/156/250
-f 140/158/251 157/157/251 158/8/251
-f 151/161/252 152/176/252 144/149/252 143/148/252
-f 147/147/253 155/3/253 157/157/253
-f 148/164/254 145/152/254 137/150/254 152/176/254
-f 137/150/255 144/149/255 152/176/255
-f 1/10/257 142/155/257 141/143/257 4/11/257
-f 145/152/258 148/164/258 153/162/258
-f 149/154/260 145/152/260 153/162/260
-f 142/155/261 1/10/261 150/156/261
-f 149/154/262 3/15/262 154/160/262
-f 152/176/263 2/6/263 148/164/263
-f 153/162/266 9/13/266 3/15/266
-f 155/3/268 154/160/268 156/1/268
-usemtl Material.002
-f 25/41/23 30/32/23 35/42/23
-f 44/40/25 40/44/25 30/32/25
-f 44/40/30 49/50/30 40/44/30
-f 40/44/31 49/50/31 50/51/31
-f 57/59/40 58/62/40 49/50/40
-f 63/29/42 84/64/42 55/47/42
-f 57/59/45 84/64/45 74/68/45
-f 24/21/147 44/40/147 30/32/147
-f 35/42/148 30/32/148 40/44/148
-f 45/52/153 36/45/153 35/42/153 40/44/153
-f 40/44/159 50/51/159 45/52/159
-f 44/40/163 57/59/163 49/50/163
-f 50/51/167 49/50/167 58/62/167
-f 50/51/169 58/62/169 59/67/169
-f 70/65/173 58/62/173 57/59/173 74/68/173
-f 55/47/175 84/64/175 57/59/175
-usemtl Material.003
-f 39/60/39 54/49/39 68/61/39
-f 68/61/41 81/63/41 47/35/41
-f 65/69/46 77/70/46 78/71/46
-f 71/74/48 79/75/48 66/76/48
-f 66/76/49 79/75/49 72/77/49
-f 78/71/51 83/79/51 71/74/51
-f 83/79/52 88/80/52 79/75/52
-f 72/77/54 89/82/54 80/83/54
-f 80/83/55 89/82/55 92/84/55
-f 82/85/56 86/86/56 90/87/56
-f 82/85/57 87/88/57 83/79/57
-f 87/88/59 91/90/59 88/80/59
-f 92/84/67 101/100/67 102/101/67
-f 47/35/150 34/24/150 39/60/150
-f 59/67/157 56/167/157 51/53/157 50/51/157
-f 39/60/158 43/43/158 54/49/158
-f 54/49/162 42/48/162 53/57/162
-f 39/60/164 68/61/164 47/35/164
-f 54/49/165 53/57/165 62/168/165
-f 54/49/166 62/168/166 67/169/166
-f 68/61/168 54/49/168 67/169/168
-f 56/167/170 60/170/170 52/54/170 51/53/170
-f 61/171/172 53/57/172 52/54/172 60/170/172
-f 53/57/174 61/171/174 62/168/174
-f 62/168/177 66/76/177 67/169/177
-f 71/74/178 61/171/178 60/170/178 65/69/178
-f 60/170/179 56/167/179 65/69/179
-f 66/76/180 62/168/180 61/171/180 71/74/180
-f 80/83/181 67/169/181 66/76/181 72/77/181
-f 65/69/182 78/71/182 71/74/182
-f 76/172/184 77/70/184 65/69/184 64/66/184
-f 68/61/185 67/169/185 80/83/185
-f 68/61/187 80/83/187 81/63/187
-f 88/80/188 89/82/188 72/77/188 79/75/188
-f 71/74/189 83/79/189 79/75/189
-f 78/71/190 82/85/190 83/79/190
-f 103/93/194 81/63/194 80/83/194 92/84/194
-f 86/86/195 82/85/195 77/70/195 76/172/195
-f 78/71/198 77/70/198 82/85/198
-f 83/79/199 87/88/199 88/80/199
-f 89/82/201 88/80/201 91/90/201
-f 89/82/202 91/90/202 101/100/202
-f 92/84/203 89/82/203 101/100/203
-f 92/84/207 102/101/207 103/93/207
-usemtl Material.004
-f 6/4/2 7/5/2 2/6/2
-f 1/10/4 4/11/4 14/12/4
-f 5/17/7 15/18/7 6/4/7
-f 13/19/8 29/20/8 4/11/8
-f 29/20/9 24/21/9 14/12/9
-f 10/14/10 17/22/10 23/23/10
-f 24/21/15 30/32/15 14/12/15
-f 29/20/22 44/40/22 24/21/22
-f 29/20/28 63/29/28 55/47/28
-f 44/40/38 55/47/38 57/59/38
-f 151/161/112 5/17/112 6/4/112
-f 2/6/113 8/163/113 148/164/113
-f 150/156/114 1/10/114 5/17/114
-f 15/18/117 11/165/117 7/5/117 6/4/117
-f 2/6/118 7/5/118 8/163/118
-f 5/17/119 1/10/119 14/12/119
-f 5/17/121 14/12/121 15/18/121
-f 16/25/123 8/163/123 7/5/123 11/165/123
-f 17/22/124 9/13/124 8/163/124 16/25/124
-f 4/11/126 29/20/126 14/12/126
-f 16/25/128 22/30/128 17/22/128
-f 13/19/136 63/29/136 29/20/136
-f 29/20/155 55/47/155 44/40/155
-f 13/19/256 4/11/256 141/143/256 136/142/256
-f 9/13/259 153/162/259 148/164/259 8/163/259
-f 152/176/264 151/161/264 6/4/264
-f 2/6/265 152/176/265 6/4/265
-f 151/161/267 150/156/267 5/17/267
-o Sphere.001
-v 0.134708 0.838792 -1.397386
-v 0.154123 -0.008211 -1.856640
-v 0.168126 -0.562790 -1.683166
-v 0.212732 0.924637 -1.245199
-v 0.319447 0.628184 -1.640909
-v 0.300144 0.301900 -1.815972
-v 0.453937 0.098528 -1.833959
-v 0.337788 -0.197140 -1.837244
-v 0.331223 -0.385888 -1.779516
-v 0.486100 -0.548469 -1.660809
-v 0.624133 0.098313 -1.778865
-v 0.407098 -0.830951 -1.391467
-v 0.262173 0.981621 -1.059388
-v 0.514899 0.778878 -1.435962
-v 0.627467 0.487290 -1.651278
-v 0.726433 -0.088966 -1.736505
-v 0.670834 -0.378984 -1.680919
-v 0.625832 -0.718498 -1.448684
-v 0.821402 0.391797 -1.576078
-v 0.864926 0.212795 -1.615623
-v 1.029633 -0.000000 -1.480283
-v 0.872883 -0.204561 -1.610179
-v 0.774973 -0.562888 -1.494544
-v 0.640047 0.834685 -1.247916
-v 0.929106 0.503271 -1.394730
-v 0.948260 -0.385203 -1.457313
-v 0.451517 -0.926351 -1.186795
-v 0.242225 1.000000 -0.856858
-v 0.543397 0.932889 -1.092686
-v 0.823481 0.717473 -1.254550
-v 1.110478 0.197140 -1.322072
-v 1.110478 -0.197140 -1.322072
-v 0.937766 -0.633224 -1.216318
-v 0.684488 -0.834889 -1.204819
-v 1.043931 0.557974 -1.084779
-v 1.124301 0.385203 -1.141418
-v 1.208270 0.000000 -1.131499
-v 1.160888 -0.316658 -1.126674
-v 0.797320 -0.836769 -0.848472
-v 1.006997 0.653956 -0.907401
-v 1.242747 0.115511 -0.921383
-v 1.166053 -0.385203 -0.782202
-v 1.017971 -0.638968 -0.929081
-v 0.794008 0.842014 -0.901314
-v 1.166053 0.385203 -0.782202
-v 1.222610 -0.197140 -0.761293
-v 0.627174 -0.929162 -0.865197
-v 0.410671 -0.984947 -0.969411
-v 0.923798 0.708715 -0.663091
-v 1.069277 0.497100 -0.571539
-v 1.185128 0.197140 -0.571866
-v 1.198044 0.000000 -0.548508
-v 1.136983 -0.291792 -0.505371
-v 0.986559 -0.638968 -0.626718
-v 0.612292 0.924637 -0.735495
-v 1.004292 0.197140 -0.232726
-v 0.698755 0.834055 -0.535106
-v 0.841829 0.638968 -0.359392
-v 0.968883 0.385203 -0.281532
-v 1.007286 -0.000000 -0.206204
-v 1.004292 -0.197140 -0.232726
-v 0.931531 -0.475433 -0.294880
-v 0.439923 0.986420 -0.831108
-v 0.736156 0.473967 -0.121401
-v 0.783435 0.098529 -0.016240
-v 0.736156 -0.473967 -0.121401
-v 0.756630 -0.712804 -0.367430
-v 0.663881 -0.838086 -0.490455
-v 0.337942 -0.983075 -0.677784
-v 0.530177 0.712804 -0.207831
-v 0.707438 -0.197140 0.011395
-v 0.470146 -0.557974 -0.055152
-v 0.216535 0.981636 -0.656193
-v 0.443060 0.834055 -0.335697
-v 0.470146 0.557974 -0.055152
-v 0.526785 0.385203 0.025217
-v 0.529112 0.197140 0.085470
-v 0.516866 0.000000 0.109186
-v 0.526785 -0.385203 0.025217
-v 0.433416 -0.777723 -0.246937
-v 0.466954 -0.926351 -0.537236
-v 0.148809 0.074357 0.145044
-v 0.339760 -0.197140 0.123333
-v 0.344848 0.932889 -0.488364
-v 0.161719 0.638968 -0.081928
-v 0.167568 0.385203 0.066970
-v -0.042767 -0.197140 0.086045
-v 0.167568 -0.385202 0.066970
-v 0.161719 -0.638968 -0.081928
-v -0.042767 0.197140 0.086045
-v -0.154246 -0.491477 -0.070435
-v 0.119671 -0.834056 -0.311951
-v -0.011518 0.924637 -0.561405
-v 0.067813 0.834889 -0.321832
-v -0.128706 0.638968 -0.171725
-v -0.180283 0.385203 -0.031922
-v -0.246671 -0.000000 0.020439
-v -0.463810 0.385203 -0.256404
-v -0.419625 0.115512 -0.103757
-v -0.328395 -0.313439 -0.088350
-v -0.137444 -0.712804 -0.256855
-v -0.162409 -0.834056 -0.471871
-v 0.102616 -0.929162 -0.498020
-v 0.242225 -1.000000 -0.856858
-v -0.362660 0.638968 -0.365826
-v -0.518586 -0.197140 -0.231196
-v -0.454495 -0.497100 -0.327704
-v -0.569568 0.480539 -0.509178
-v -0.626028 0.197140 -0.391645
-v -0.651677 0.000000 -0.399029
-v -0.250544 0.842014 -0.604629
-v -0.430792 0.711675 -0.646711
-v -0.758650 0.074358 -0.753018
-v -0.700104 -0.197140 -0.569972
-v -0.608001 -0.475433 -0.595940
-v -0.406802 -0.712804 -0.568906
-v -0.200766 -0.893458 -0.717293
-v 0.089650 -0.981636 -0.724014
-v -0.642567 0.475433 -0.766824
-v -0.738160 0.197140 -0.952423
-v -0.464054 0.708715 -0.913934
-v -0.713786 -0.313439 -0.904351
-v -0.550996 -0.557974 -1.112753
-v -0.518627 -0.656278 -0.900586
-v -0.142724 0.929162 -0.865198
-v -0.306220 0.831849 -0.976398
-v -0.609671 0.475433 -1.112273
-v -0.713594 0.000000 -1.165208
-v -0.700678 -0.197140 -1.141850
-v -0.306220 -0.831849 -0.976397
-v -0.357779 0.712804 -1.236527
-v -0.495556 0.473967 -1.347312
-v -0.625526 0.115513 -1.359068
-v -0.582711 -0.385203 -1.279366
-v -0.388450 -0.708715 -1.179871
-v 0.043275 0.985942 -0.876453
-v -0.381199 0.000000 -1.644266
-v -0.519842 -0.197140 -1.480990
-v -0.392688 -0.557974 -1.396827
-v -0.117976 -0.927993 -0.999507
-v -0.023703 0.924550 -1.136357
-v -0.148832 0.834685 -1.254680
-v -0.324200 0.475433 -1.542515
-v -0.383437 0.197140 -1.617669
-v -0.358610 -0.316657 -1.602338
-v -0.216831 -0.708715 -1.396632
-v -0.144356 -0.836769 -1.255299
-v -0.044663 -0.197141 -1.799186
-v -0.137722 -0.557974 -1.598695
-v -0.036741 0.718497 -1.504616
-v -0.018694 0.475432 -1.707084
-v -0.058683 0.127072 -1.810092
-v -0.033552 -0.391922 -1.739712
-v 0.024675 -0.708715 -1.531217
-v 0.139445 -0.836302 -1.401520
-v 0.299301 -0.708714 -1.563137
-v 0.124644 -0.925922 -1.225524
-v 0.094631 -0.984597 -0.995598
-vn 0.0384 -0.8024 -0.5955
-vn 0.0345 0.1139 -0.9929
-vn 0.0088 -0.9928 -0.1196
-vn 0.0811 0.8498 -0.5209
-vn 0.0832 -0.5347 -0.8409
-vn 0.2231 -0.6836 -0.6949
-vn 0.1796 0.4568 -0.8712
-vn 0.1247 0.9388 -0.3211
-vn 0.2296 0.8807 -0.4142
-vn 0.4035 -0.5285 -0.7469
-vn 0.3037 -0.8294 -0.4689
-vn 0.6435 0.0113 -0.7654
-vn 0.0790 0.9935 -0.0824
-vn 0.5770 -0.3738 -0.7262
-vn 0.4482 0.7306 -0.5151
-vn 0.7602 -0.1875 -0.6221
-vn 0.6623 -0.5363 -0.5231
-vn 0.5511 -0.6734 -0.4927
-vn 0.3451 -0.9178 -0.1965
-vn 0.8901 0.0008 -0.4559
-vn 0.8114 -0.3815 -0.4427
-vn 0.4836 0.8438 -0.2327
-vn 0.7145 0.5941 -0.3695
-vn 0.8242 -0.5128 -0.2404
-vn 0.6444 0.7365 -0.2059
-vn 0.9429 0.1921 -0.2721
-vn 0.9331 -0.1446 -0.3292
-vn 0.3605 0.9315 -0.0480
-vn 0.8377 -0.5392 0.0870
-vn 0.6617 0.7475 0.0578
-vn 0.7886 0.6001 0.1340
-vn 0.9695 0.2197 0.1085
-vn 0.9863 0.0816 0.1435
-vn 0.2212 -0.9733 0.0614
-vn 0.1116 -0.9932 0.0342
-vn 0.9523 -0.1610 0.2591
-vn 0.9319 -0.3025 0.1999
-vn 0.5220 0.8389 0.1540
-vn 0.5765 -0.7891 0.2120
-vn 0.5954 0.7330 0.3290
-vn 0.3647 -0.9123 0.1860
-vn 0.2241 0.9515 0.2108
-vn 0.4564 0.6234 0.6349
-vn 0.6126 0.4956 0.6156
-vn 0.2950 0.8774 0.3783
-vn 0.3983 0.0851 0.9133
-vn 0.0555 0.9936 0.0980
-vn 0.4314 -0.3534 0.8300
-vn 0.3528 -0.4873 0.7988
-vn 0.3644 0.5784 0.7298
-vn 0.2860 -0.1895 0.9393
-vn 0.1071 -0.3741 0.9212
-vn 0.0216 0.8455 0.5335
-vn 0.1101 -0.6639 0.7396
-vn 0.0030 -0.7629 0.6465
-vn -0.1357 0.2490 0.9589
-vn -0.0960 -0.1462 0.9846
-vn -0.0917 0.9353 0.3418
-vn -0.2559 -0.3765 0.8904
-vn -0.2059 0.7169 0.6661
-vn -0.0482 -0.9723 0.2285
-vn -0.2991 -0.0082 0.9542
-vn -0.0258 -0.9938 0.1077
-vn -0.4743 0.1921 0.8591
-vn -0.4570 -0.1830 0.8705
-vn -0.4020 -0.3064 0.8628
-vn -0.2812 -0.8216 0.4959
-vn -0.3634 0.8265 0.4300
-vn -0.5640 -0.4844 0.6688
-vn -0.0782 0.9936 0.0809
-vn -0.3018 -0.9148 0.2686
-vn -0.7623 0.2197 0.6088
-vn -0.7989 0.0816 0.5959
-vn -0.6900 -0.3511 0.6329
-vn -0.5632 -0.6682 0.4862
-vn -0.6023 0.7251 0.3338
-vn -0.5130 -0.8125 0.2768
-vn -0.7181 0.4965 0.4877
-vn -0.8655 -0.1895 0.4637
-vn -0.2817 0.9498 0.1358
-vn -0.7786 0.5918 0.2089
-vn -0.8686 -0.4940 0.0384
-vn -0.7626 -0.6293 0.1499
-vn -0.9573 0.2796 0.0738
-vn -0.1120 -0.9937 0.0088
-vn -0.9844 -0.1500 0.0924
-vn -0.9342 -0.3233 0.1507
-vn -0.5393 0.8401 0.0578
-vn -0.9942 -0.0082 -0.1072
-vn -0.8645 -0.4932 -0.0966
-vn -0.8148 0.5746 -0.0776
-vn -0.7097 -0.6743 -0.2042
-vn -0.9192 0.2494 -0.3047
-vn -0.8916 -0.3853 -0.2379
-vn -0.6512 0.7306 -0.2053
-vn -0.2969 0.9436 -0.1464
-vn -0.7391 -0.5329 -0.4119
-vn -0.7278 0.5855 -0.3570
-vn -0.5127 -0.8105 -0.2833
-vn -0.6064 0.5947 -0.5279
-vn -0.7403 0.0816 -0.6673
-vn -0.7195 -0.3815 -0.5802
-vn -0.5783 -0.6752 -0.4579
-vn -0.6612 -0.1446 -0.7361
-vn -0.5370 -0.5017 -0.6782
-vn -0.4598 0.7084 -0.5355
-vn -0.2703 -0.9153 -0.2986
-vn -0.0607 0.9935 -0.0961
-vn -0.3591 -0.6752 -0.6443
-vn -0.3889 0.5724 -0.7219
-vn -0.2318 -0.5411 -0.8084
-vn -0.0422 0.4743 -0.8794
-vn -0.0971 -0.1946 -0.9761
-vn -0.0789 0.7236 -0.6857
-vn -0.0849 -0.6774 -0.7307
-vn 0.0241 -0.9680 -0.2500
-vn 0.2910 0.2974 -0.9093
-vn 0.0830 -0.0216 -0.9963
-vn 0.0588 0.7767 -0.6271
-vn 0.0831 -0.5875 -0.8050
-vn 0.2671 0.6370 -0.7231
-vn 0.2060 -0.7314 -0.6501
-vn 0.2829 -0.0854 -0.9553
-vn 0.2926 -0.2560 -0.9213
-vn 0.4520 0.2811 -0.8465
-vn 0.1691 0.8939 -0.4151
-vn 0.2638 -0.3921 -0.8813
-vn 0.5082 -0.2551 -0.8226
-vn 0.3844 -0.5801 -0.7182
-vn 0.2946 -0.8401 -0.4555
-vn 0.4818 0.6334 -0.6055
-vn 0.5266 0.0966 -0.8446
-vn 0.7356 0.2995 -0.6076
-vn 0.5234 0.5513 -0.6497
-vn 0.6475 -0.0123 -0.7620
-vn 0.1530 0.9783 -0.1397
-vn 0.5685 -0.4043 -0.7165
-vn 0.7573 -0.2080 -0.6191
-vn 0.5385 -0.7028 -0.4649
-vn 0.6104 -0.7685 -0.1922
-vn 0.7580 0.1899 -0.6240
-vn 0.7861 0.4894 -0.3776
-vn 0.8108 0.3734 -0.4507
-vn 0.3288 -0.9255 -0.1877
-vn 0.8901 -0.0008 -0.4559
-vn 0.7938 -0.4408 -0.4191
-vn 0.5155 0.8207 -0.2463
-vn 0.6815 0.6936 -0.2334
-vn 0.9848 -0.1344 -0.1097
-vn 0.4832 -0.8612 -0.1575
-vn 0.9408 0.2073 -0.2683
-vn 0.9398 0.3236 -0.1092
-vn 0.8813 0.4638 -0.0909
-vn 0.9574 -0.2801 -0.0701
-vn 0.3745 0.9258 -0.0509
-vn 0.8840 -0.4557 -0.1039
-vn 0.8478 0.3058 0.4333
-vn 0.6800 -0.7298 0.0706
-vn 0.8360 0.5400 0.0972
-vn 0.9930 -0.0036 0.1179
-vn 0.9077 0.3503 0.2309
-vn 0.8559 -0.4561 0.2438
-vn 0.5484 0.8207 0.1605
-vn 0.4577 -0.8732 0.1674
-vn 0.8001 -0.4748 0.3667
-vn 0.6670 -0.6185 0.4154
-vn 0.7031 0.6278 0.3339
-vn 0.5909 -0.7439 0.3121
-vn 0.7356 0.5064 0.4500
-vn 0.8739 0.0956 0.4766
-vn 0.2678 -0.9534 0.1390
-vn 0.8744 -0.0984 0.4751
-vn 0.4056 0.7691 0.4939
-vn 0.8025 -0.3220 0.5023
-vn 0.2926 0.9124 0.2862
-vn 0.6074 0.2911 0.7391
-vn 0.5373 -0.5824 0.6100
-vn 0.6261 -0.0986 0.7735
-vn 0.6706 0.1089 0.7338
-vn 0.6158 -0.3041 0.7269
-vn 0.3741 -0.6473 0.6641
-vn 0.4338 -0.0273 0.9006
-vn 0.1256 0.9743 0.1870
-vn 0.4569 0.2873 0.8418
-vn 0.3514 -0.7754 0.5247
-vn 0.3528 0.4873 0.7988
-vn 0.2684 -0.8445 0.4634
-vn 0.0779 -0.4808 0.8733
-vn 0.2851 -0.2050 0.9363
-vn 0.0943 -0.0133 0.9955
-vn 0.0449 0.7673 0.6397
-vn 0.0779 0.4808 0.8733
-vn 0.1139 0.6748 0.7291
-vn 0.0601 -0.8878 0.4563
-vn 0.0879 0.2635 0.9607
-vn -0.2462 0.4959 0.8328
-vn 0.0437 -0.9397 0.3391
-vn 0.1186 0.1113 0.9867
-vn -0.0950 -0.2050 0.9741
-vn -0.0987 0.9207 0.3776
-vn -0.1991 -0.4925 0.8472
-vn -0.2688 -0.6324 0.7266
-vn -0.2031 -0.7281 0.6547
-vn -0.4037 0.7794 0.4792
-vn -0.2536 0.3741 0.8920
-vn -0.3014 0.0055 0.9535
-vn -0.2598 -0.8500 0.4583
-vn -0.4755 0.2073 0.8550
-vn -0.5461 0.4959 0.6752
-vn -0.5284 -0.5700 0.6292
-vn -0.6324 -0.1070 0.7672
-vn -0.5873 0.3236 0.7418
-vn -0.8341 -0.3204 0.4489
-vn -0.1770 0.9714 0.1582
-vn -0.2776 -0.9322 0.2324
-vn -0.7856 -0.0036 0.6188
-vn -0.5345 -0.7081 0.4614
-vn -0.3487 0.9227 0.1643
-vn -0.7289 -0.5756 0.3706
-vn -0.7078 0.6231 0.3330
-vn -0.8065 0.3563 0.4718
-vn -0.9265 0.2815 0.2496
-vn -0.5960 0.8002 0.0665
-vn -0.9446 0.1113 0.3088
-vn -0.9579 -0.0133 0.2867
-vn 0.0435 -0.8972 -0.4395
-vn -0.6233 -0.7785 0.0736
-vn -0.7635 0.6397 0.0880
-vn -0.2764 -0.9608 0.0212
-vn -0.4572 -0.8890 -0.0253
-vn -0.9926 -0.0775 -0.0939
-vn -0.8769 -0.1137 -0.4670
-vn -0.9226 0.3755 -0.0879
-vn -0.7252 0.6488 -0.2307
-vn -0.6634 -0.7281 -0.1725
-vn -0.9313 0.2073 -0.2996
-vn -0.8896 -0.3910 -0.2361
-vn -0.4097 0.8880 -0.2090
-vn -0.8637 -0.2050 -0.4605
-vn -0.7317 0.3009 -0.6116
-vn -0.5021 0.8197 -0.2756
-vn -0.7071 -0.5871 -0.3941
-vn -0.4645 -0.8482 -0.2546
-vn -0.8508 0.3221 -0.4151
-vn -0.5199 -0.7485 -0.4116
-vn -0.2897 -0.7881 -0.5432
-vn -0.7601 -0.0036 -0.6498
-vn -0.7147 -0.3923 -0.5791
-vn -0.5025 -0.5871 -0.6347
-vn -0.4863 0.6637 -0.5683
-vn -0.2431 -0.9318 -0.2695
-vn -0.4424 0.3094 -0.8418
-vn -0.2339 -0.8583 -0.4567
-vn -0.4634 -0.0991 -0.8806
-vn -0.4887 0.1112 -0.8653
-vn -0.1331 0.9660 -0.2218
-vn -0.2091 0.8843 -0.4174
-vn -0.4285 -0.2861 -0.8571
-vn -0.0968 -0.2919 -0.9515
-vn -0.4340 -0.4093 -0.8026
-vn -0.2643 0.8238 -0.5015
-vn -0.2238 -0.5888 -0.7767
-vn -0.2395 -0.0430 -0.9699
-vn -0.1600 0.2968 -0.9415
-vn -0.1020 0.1764 -0.9790
-vn -0.0923 -0.4093 -0.9077
-vn -0.1339 0.6284 -0.7663
-vn -0.0771 -0.7440 -0.6637
-vt 0.737176 0.250000
-vt 0.702383 0.187500
-vt 0.779637 0.187500
-vt 0.741874 0.599249
-vt 0.718750 0.531273
-vt 0.763980 0.500000
-vt 0.734375 0.000000
-vt 0.879629 0.062500
-vt 0.593677 0.062500
-vt 0.781230 0.812500
-vt 0.762032 0.875000
-vt 0.685473 0.777944
-vt 0.734697 0.375000
-vt 0.703125 0.312500
-vt 0.764235 0.312500
-vt 0.658359 0.250000
-vt 0.734375 0.717281
-vt 0.678319 0.660608
-vt 0.734224 0.937500
-vt 0.605595 0.875000
-vt 0.623673 0.812500
-vt 0.673680 0.375000
-vt 0.639230 0.312500
-vt 0.606077 0.187500
-vt 0.670132 0.472235
-vt 0.640625 0.562500
-vt 0.606567 0.500000
-vt 0.640625 1.000000
-vt 0.479138 0.937500
-vt 0.639064 0.437500
-vt 0.612180 0.375000
-vt 0.595563 0.750000
-vt 0.578286 0.437500
-vt 0.577540 0.283466
-vt 0.503540 0.125000
-vt 0.660224 0.125000
-vt 0.578286 0.562500
-vt 0.544067 0.500000
-vt 0.543444 0.396147
-vt 0.512752 0.812500
-vt 0.603325 0.667055
-vt 0.544073 0.687500
-vt 0.515588 0.281661
-vt 0.510998 0.724803
-vt 0.549680 0.625000
-vt 0.509405 0.537235
-vt 0.449506 0.875000
-vt 0.487179 0.375000
-vt 0.453088 0.281661
-vt 0.455926 0.750000
-vt 0.445771 0.665313
-vt 0.487180 0.625000
-vt 0.453286 0.562500
-vt 0.450317 0.500000
-vt 0.328120 0.062500
-vt 0.453125 0.000000
-vt 0.437500 0.406180
-vt 0.484536 0.437500
-vt 0.402284 0.812500
-vt 0.497588 0.187500
-vt 0.386121 0.187500
-vt 0.390588 0.718339
-vt 0.347717 0.125000
-vt 0.293360 0.875000
-vt 0.316528 0.750000
-vt 0.343750 0.656371
-vt 0.393429 0.625000
-vt 0.308534 0.812500
-vt 0.343750 0.531273
-vt 0.297036 0.562500
-vt 0.294067 0.500000
-vt 0.328125 1.000000
-vt 0.230145 0.937500
-vt 0.328286 0.437500
-vt 0.299679 0.375000
-vt 0.343750 0.343629
-vt 0.294073 0.312500
-vt 0.294073 0.687500
-vt 0.265786 0.437500
-vt 0.237180 0.375000
-vt 0.199790 0.812500
-vt 0.234338 0.281661
-vt 0.296902 0.219059
-vt 0.214815 0.187500
-vt 0.237635 0.520573
-vt 0.237180 0.625000
-vt 0.203286 0.562500
-vt 0.203286 0.437500
-vt 0.137012 0.875000
-vt 0.176363 0.337227
-vt 0.171838 0.718339
-vt 0.234338 0.718339
-vt 0.190964 0.125000
-vt 0.113605 0.062500
-vt 0.169067 0.500000
-vt 0.203125 0.000000
-vt 0.174680 0.625000
-vt 0.134405 0.537235
-vt 0.148421 0.399333
-vt 0.160279 0.250000
-vt 0.121065 0.187500
-vt 0.075252 0.812500
-vt 0.102021 0.334687
-vt 0.140625 1.000000
-vt 0.030235 0.937500
-vt 0.055088 0.153620
-vt 0.112179 0.625000
-vt 0.078286 0.562500
-vt 0.075317 0.500000
-vt 0.109536 0.437500
-vt 0.066529 0.250000
-vt 0.048167 0.750000
-vt 0.108913 0.719958
-vt 0.062500 0.658651
-vt 0.047036 0.437500
-vt 0.032456 0.875000
-vt 0.015664 0.655822
-vt 0.046914 0.344178
-vt 0.000000 0.399333
-vt 0.000000 0.273040
-vt 0.018885 0.520574
-vt 0.000000 0.562500
-vt 0.015625 0.000000
-vt 0.000000 0.062500
-vt 0.000000 0.812500
-vt 1.000000 0.500000
-vt 0.984536 0.562500
-vt 0.950317 0.500000
-vt 0.991904 0.273040
-vt 0.992171 0.399333
-vt 0.950323 0.312500
-vt 1.000000 0.655822
-vt 0.987176 0.750000
-vt 0.953164 0.655822
-vt 0.924676 0.250000
-vt 0.915655 0.537235
-vt 0.953286 0.437500
-vt 0.924679 0.375000
-vt 0.965747 0.812500
-vt 0.910279 0.750000
-vt 0.978825 0.875000
-vt 0.921769 0.937500
-vt 0.871079 0.875000
-vt 0.887823 0.312500
-vt 0.906250 0.656371
-vt 0.965747 0.187500
-vt 0.872588 0.187500
-vt 0.859414 0.655822
-vt 0.859536 0.562500
-vt 0.856567 0.500000
-vt 0.890786 0.437500
-vt 0.855944 0.396148
-vt 0.862176 0.250000
-vt 0.825323 0.312500
-vt 0.873622 0.812500
-vt 0.814726 0.750000
-vt 0.799126 0.125000
-vt 0.939862 0.125000
-vt 0.828125 1.000000
-vt 0.799676 0.250000
-vt 0.796945 0.653777
-vt 0.798190 0.375000
-vt 0.734536 0.437500
-vt 0.797036 0.437500
-vt 0.687500 0.531257
-vt 0.642102 0.625000
-vt 0.390786 0.562500
-vt 0.390665 0.344178
-vt 0.378980 0.250000
-vt 0.387817 0.500000
-vt 0.390786 0.437500
-vt 0.299680 0.625000
-vt 0.000000 0.750000
-vt 0.000000 0.187500
-vt 0.000000 0.125000
-vt 0.801816 0.543181
-s 0
-usemtl Material.005
-f 314/177/269 170/178/269 313/179/269
-f 262/183/271 316/184/271 206/185/271
-f 167/189/273 168/190/273 161/191/273
-f 168/190/274 176/192/274 314/177/274
-f 170/178/279 176/192/279 192/200/279
-f 174/201/280 178/202/280 179/203/280
-f 171/195/281 186/204/281 221/205/281
-f 180/206/282 184/207/282 175/198/282
-f 179/203/284 190/209/284 180/206/284
-f 181/199/285 184/207/285 191/210/285
-f 181/199/286 191/210/286 176/192/286
-f 192/200/287 205/211/287 185/212/287
-f 179/203/288 189/213/288 195/214/288
-f 190/209/289 196/215/289 184/207/289
-f 191/210/292 196/215/292 201/219/292
-f 189/213/294 194/221/294 199/222/294
-f 195/214/295 196/215/295 190/209/295
-f 201/219/297 200/224/297 212/225/297
-f 199/222/300 203/228/300 209/229/300
-f 199/222/301 209/229/301 210/230/301
-f 206/185/302 205/211/302 227/231/302
-f 262/232/303 206/185/303 227/231/303
-f 210/230/304 211/233/304 204/234/304
-f 204/234/305 211/233/305 200/224/305
-f 216/238/311 228/241/311 222/242/311
-f 216/238/312 222/242/312 217/243/312
-f 221/205/315 186/248/315 231/249/315
-f 222/242/318 228/241/318 233/254/318
-f 232/244/321 242/240/321 252/257/321
-f 242/240/326 231/249/326 251/265/326
-f 252/257/328 253/267/328 243/268/328
-f 261/269/329 276/270/329 227/231/329
-f 240/261/330 248/263/330 255/271/330
-f 262/272/331 227/231/331 276/270/331
-f 248/263/332 254/273/332 257/274/332
-f 255/271/333 258/275/333 245/264/333
-f 245/264/334 258/275/334 249/266/334
-f 251/265/336 269/278/336 252/257/336
-f 249/266/337 258/275/337 265/279/337
-f 231/249/338 186/280/338 294/281/338
-f 260/277/339 275/282/339 261/269/339
-f 257/274/340 256/283/340 267/284/340
-f 257/274/341 267/284/341 268/285/341
-f 264/286/342 265/279/342 258/275/342
-f 265/279/343 274/287/343 259/276/343
-f 269/278/344 270/288/344 263/289/344
-f 260/277/345 274/287/345 275/282/345
-f 263/289/346 266/290/346 256/283/346
-f 268/285/347 272/291/347 264/286/347
-f 294/281/348 283/292/348 251/265/348
-f 266/290/349 270/288/349 277/293/349
-f 273/294/350 280/295/350 282/296/350
-f 273/294/351 282/296/351 274/287/351
-f 271/297/352 277/293/352 278/298/352
-f 262/299/353 276/270/353 316/300/353
-f 271/297/354 280/295/354 272/291/354
-f 272/291/355 280/295/355 273/294/355
-f 269/278/356 283/292/356 284/301/356
-f 271/302/357 278/303/357 286/304/357
-f 282/305/358 280/306/358 281/307/358
-f 277/308/359 279/309/359 285/310/359
-f 281/307/360 293/311/360 282/305/360
-f 278/303/361 285/310/361 291/312/361
-f 287/313/362 292/314/362 280/306/362
-f 284/315/363 289/316/363 279/309/363
-f 283/317/364 294/318/364 299/319/364
-f 281/307/365 292/314/365 297/320/365
-f 285/310/366 289/316/366 290/321/366
-f 288/322/367 293/311/367 305/323/367
-f 290/321/368 289/316/368 301/324/368
-f 291/312/369 302/325/369 295/326/369
-f 296/327/370 303/328/370 292/314/370
-f 297/320/371 304/329/371 293/311/371
-f 295/326/372 303/328/372 296/327/372
-f 297/320/373 303/328/373 307/330/373
-f 300/331/374 308/332/374 289/316/374
-f 305/323/375 315/333/375 298/334/375
-f 294/318/376 186/335/376 171/195/376
-f 307/330/377 312/336/377 304/329/377
-f 301/324/378 308/332/378 309/337/378
-f 307/330/379 311/338/379 161/191/379
-f 161/191/383 314/177/383 312/336/383
-f 206/185/384 316/184/384 315/333/384 185/212/384
-f 161/191/388 168/190/388 314/177/388
-f 170/178/390 314/177/390 176/192/390
-f 178/202/393 169/341/393 173/194/393 177/342/393
-f 167/189/395 175/198/395 168/190/395
-f 176/192/397 168/190/397 181/199/397
-f 170/178/398 192/200/398 185/212/398
-f 183/217/399 173/194/399 172/188/399 188/208/399
-f 169/341/400 178/202/400 174/201/400
-f 183/217/401 189/213/401 178/202/401 177/342/401
-f 173/194/402 183/217/402 177/342/402
-f 174/201/403 179/203/403 180/206/403
-f 181/199/405 175/198/405 184/207/405
-f 180/206/406 190/209/406 184/207/406
-f 176/192/407 191/210/407 192/200/407
-f 201/219/408 197/236/408 192/200/408 191/210/408
-f 179/203/409 178/202/409 189/213/409
-f 183/217/410 193/218/410 194/221/410
-f 189/213/411 183/217/411 194/221/411
-f 206/185/412 185/212/412 205/211/412
-f 179/203/413 195/214/413 190/209/413
-f 191/210/414 184/207/414 196/215/414
-f 204/234/417 196/215/417 195/214/417 199/222/417
-f 195/214/419 189/213/419 199/222/419
-f 199/222/420 194/221/420 203/228/420
-f 196/215/422 204/234/422 200/224/422
-f 201/219/424 196/215/424 200/224/424
-f 199/222/428 210/230/428 204/234/428
-f 209/229/429 203/228/429 208/227/429
-f 205/211/439 239/239/439 227/231/439
-f 222/242/444 223/245/444 214/343/444 217/243/444
-f 221/205/451 231/249/451 242/240/451
-f 222/242/454 233/254/454 234/348/454
-f 243/268/459 228/241/459 232/244/459 252/257/459
-f 244/262/460 234/348/460 233/254/460 243/268/460
-f 233/254/461 228/241/461 243/268/461
-f 254/273/464 244/262/464 243/268/464 253/267/464
-f 227/231/465 239/239/465 261/269/465
-f 242/240/468 251/265/468 252/257/468
-f 263/289/472 253/267/472 252/257/472 269/278/472
-f 248/263/473 244/262/473 254/273/473
-f 240/261/474 255/271/474 245/264/474
-f 255/271/476 248/263/476 257/274/476
-f 256/283/477 254/273/477 253/267/477 263/289/477
-f 249/266/478 265/279/478 259/276/478
-f 264/286/479 258/275/479 255/271/479 257/274/479
-f 257/274/480 254/273/480 256/283/480
-f 273/294/481 265/279/481 264/286/481 272/291/481
-f 231/249/482 294/281/482 251/265/482
-f 261/269/483 275/282/483 276/270/483
-f 257/274/484 268/285/484 264/286/484
-f 260/277/485 259/276/485 274/287/485
-f 251/265/486 283/292/486 269/278/486
-f 265/279/487 273/294/487 274/287/487
-f 263/289/488 270/288/488 266/290/488
-f 267/284/489 256/283/489 266/290/489
-f 277/293/490 271/297/490 267/284/490 266/290/490
-f 279/349/491 270/288/491 269/278/491 284/301/491
-f 268/285/492 267/284/492 271/297/492
-f 268/285/493 271/297/493 272/291/493
-f 185/212/494 315/333/494 313/179/494 170/178/494
-f 282/296/495 288/350/495 275/282/495 274/287/495
-f 277/293/496 270/288/496 279/349/496
-f 316/300/497 276/270/497 275/282/497 298/351/497
-f 275/282/498 288/350/498 298/351/498
-f 287/313/499 280/306/499 271/302/499 286/304/499
-f 296/327/500 287/313/500 286/304/500 291/312/500
-f 278/303/501 277/308/501 285/310/501
-f 285/310/502 279/309/502 289/316/502
-f 288/322/503 282/305/503 293/311/503
-f 286/304/504 278/303/504 291/312/504
-f 281/307/505 280/306/505 292/314/505
-f 300/331/506 284/315/506 283/317/506 299/319/506
-f 287/313/507 296/327/507 292/314/507
-f 301/324/508 302/325/508 291/312/508 290/321/508
-f 284/315/509 300/331/509 289/316/509
-f 281/307/510 297/320/510 293/311/510
-f 298/334/511 288/322/511 305/323/511
-f 291/312/512 285/310/512 290/321/512
-f 305/323/513 293/311/513 304/329/513
-f 312/336/514 313/179/514 305/323/514 304/329/514
-f 291/312/515 295/326/515 296/327/515
-f 297/320/516 292/314/516 303/328/516
-f 297/320/517 307/330/517 304/329/517
-f 301/324/518 289/316/518 308/332/518
-f 298/334/519 315/333/519 316/184/519
-f 309/337/520 310/352/520 302/325/520 301/324/520
-f 305/323/521 313/179/521 315/333/521
-f 306/340/522 303/328/522 295/326/522 310/352/522
-f 295/326/523 302/325/523 310/352/523
-f 159/186/525 300/331/525 299/319/525 162/187/525
-f 303/328/526 306/340/526 311/338/526
-f 307/330/528 303/328/528 311/338/528
-f 300/331/529 159/186/529 308/332/529
-f 307/330/530 161/191/530 312/336/530
-f 310/352/531 160/182/531 306/340/531
-f 311/338/534 167/189/534 161/191/534
-f 313/179/536 312/336/536 314/177/536
-usemtl Material.006
-f 183/217/291 188/208/291 193/218/291
-f 202/216/293 198/220/293 188/208/293
-f 202/216/298 207/226/298 198/220/298
-f 198/220/299 207/226/299 208/227/299
-f 215/235/308 216/238/308 207/226/308
-f 221/205/310 242/240/310 213/223/310
-f 215/235/313 242/240/313 232/244/313
-f 182/197/415 202/216/415 188/208/415
-f 193/218/416 188/208/416 198/220/416
-f 203/228/421 194/221/421 193/218/421 198/220/421
-f 198/220/427 208/227/427 203/228/427
-f 202/216/431 215/235/431 207/226/431
-f 208/227/435 207/226/435 216/238/435
-f 208/227/437 216/238/437 217/243/437
-f 228/241/441 216/238/441 215/235/441 232/244/441
-f 213/223/443 242/240/443 215/235/443
-usemtl Material.007
-f 197/236/307 212/225/307 226/237/307
-f 226/237/309 239/239/309 205/211/309
-f 223/245/314 235/246/314 236/247/314
-f 229/250/316 237/251/316 224/252/316
-f 224/252/317 237/251/317 230/253/317
-f 236/247/319 241/255/319 229/250/319
-f 241/255/320 246/256/320 237/251/320
-f 230/253/322 247/258/322 238/259/322
-f 238/259/323 247/258/323 250/260/323
-f 240/261/324 244/262/324 248/263/324
-f 240/261/325 245/264/325 241/255/325
-f 245/264/327 249/266/327 246/256/327
-f 250/260/335 259/276/335 260/277/335
-f 205/211/418 192/200/418 197/236/418
-f 217/243/425 214/343/425 209/229/425 208/227/425
-f 197/236/426 201/219/426 212/225/426
-f 212/225/430 200/224/430 211/233/430
-f 197/236/432 226/237/432 205/211/432
-f 212/225/433 211/233/433 220/344/433
-f 212/225/434 220/344/434 225/345/434
-f 226/237/436 212/225/436 225/345/436
-f 214/343/438 218/346/438 210/230/438 209/229/438
-f 219/347/440 211/233/440 210/230/440 218/346/440
-f 211/233/442 219/347/442 220/344/442
-f 220/344/445 224/252/445 225/345/445
-f 229/250/446 219/347/446 218/346/446 223/245/446
-f 218/346/447 214/343/447 223/245/447
-f 224/252/448 220/344/448 219/347/448 229/250/448
-f 238/259/449 225/345/449 224/252/449 230/253/449
-f 223/245/450 236/247/450 229/250/450
-f 234/348/452 235/246/452 223/245/452 222/242/452
-f 226/237/453 225/345/453 238/259/453
-f 226/237/455 238/259/455 239/239/455
-f 246/256/456 247/258/456 230/253/456 237/251/456
-f 229/250/457 241/255/457 237/251/457
-f 236/247/458 240/261/458 241/255/458
-f 261/269/462 239/239/462 238/259/462 250/260/462
-f 244/262/463 240/261/463 235/246/463 234/348/463
-f 236/247/466 235/246/466 240/261/466
-f 241/255/467 245/264/467 246/256/467
-f 247/258/469 246/256/469 249/266/469
-f 247/258/470 249/266/470 259/276/470
-f 250/260/471 247/258/471 259/276/471
-f 250/260/475 260/277/475 261/269/475
-usemtl Material.008
-f 164/180/270 165/181/270 160/182/270
-f 159/186/272 162/187/272 172/188/272
-f 163/193/275 173/194/275 164/180/275
-f 171/195/276 187/196/276 162/187/276
-f 187/196/277 182/197/277 172/188/277
-f 168/190/278 175/198/278 181/199/278
-f 182/197/283 188/208/283 172/188/283
-f 187/196/290 202/216/290 182/197/290
-f 187/196/296 221/205/296 213/223/296
-f 202/216/306 213/223/306 215/235/306
-f 309/337/380 163/193/380 164/180/380
-f 160/182/381 166/339/381 306/340/381
-f 308/332/382 159/186/382 163/193/382
-f 173/194/385 169/341/385 165/181/385 164/180/385
-f 160/182/386 165/181/386 166/339/386
-f 163/193/387 159/186/387 172/188/387
-f 163/193/389 172/188/389 173/194/389
-f 174/201/391 166/339/391 165/181/391 169/341/391
-f 175/198/392 167/189/392 166/339/392 174/201/392
-f 162/187/394 187/196/394 172/188/394
-f 174/201/396 180/206/396 175/198/396
-f 171/195/404 221/205/404 187/196/404
-f 187/196/423 213/223/423 202/216/423
-f 171/195/524 162/187/524 299/319/524 294/318/524
-f 167/189/527 311/338/527 306/340/527 166/339/527
-f 310/352/532 309/337/532 164/180/532
-f 160/182/533 310/352/533 164/180/533
-f 309/337/535 308/332/535 163/193/535
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'sphere.blend'
-# www.blender.org
-
-newmtl Material.001
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.100026 0.800000 0.140501
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.002
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.722718 0.092650
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.003
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.064691 0.088050
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.004
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.108336 0.240218 0.800000
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.005
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.100026 0.800000 0.140501
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.006
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.722718 0.092650
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.007
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.064691 0.088050
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.008
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.108336 0.240218 0.800000
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-)X"},{.name = "monkey", .scene = R"X(# path to .obj file
-o models/monkey.obj
-
-# path to .mtl file
-m models/monkey.mtl
-
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
-
-# camera position vector
-cp -10.0 5.0 10.0
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib monkey.mtl
-o Suzanne
-v -0.053710 0.164062 0.880172
-v -0.785570 0.164062 0.400584
-v 0.041386 0.093750 0.849084
-v -0.795026 0.093750 0.300983
-v 0.140542 0.054688 0.783294
-v -0.774284 0.054688 0.183808
-v -0.044230 -0.023438 0.708915
-v -0.632332 -0.023438 0.323531
-v -0.099897 0.031250 0.793863
-v -0.687999 0.031250 0.408479
-v -0.134153 0.132812 0.846139
-v -0.722255 0.132812 0.460755
-v -0.208062 0.164062 0.816387
-v -0.665475 0.164062 0.516644
-v -0.236898 0.093750 0.732108
-v -0.576690 0.093750 0.509441
-v -0.224720 0.054688 0.628002
-v -0.486099 0.054688 0.456720
-v -0.294347 0.242188 0.591716
-v -0.425036 0.242188 0.506075
-v -0.289174 0.242188 0.697851
-v -0.524414 0.242188 0.543698
-v -0.234200 0.242188 0.799259
-v -0.639337 0.242188 0.533772
-v -0.208062 0.328125 0.816387
-v -0.665475 0.328125 0.516644
-v -0.236898 0.390625 0.732108
-v -0.576690 0.390625 0.509441
-v -0.224720 0.437500 0.628002
-v -0.486099 0.437500 0.456720
-v -0.044230 0.515625 0.708915
-v -0.632332 0.515625 0.323531
-v -0.099897 0.453125 0.793863
-v -0.687999 0.453125 0.408479
-v -0.134153 0.359375 0.846139
-v -0.722255 0.359375 0.460755
-v -0.053710 0.328125 0.880172
-v -0.785570 0.328125 0.400584
-v 0.041386 0.390625 0.849084
-v -0.795026 0.390625 0.300983
-v 0.140542 0.437500 0.783294
-v -0.774284 0.437500 0.183808
-v 0.214450 0.242188 0.813045
-v -0.831064 0.242188 0.127918
-v 0.102226 0.242188 0.870271
-v -0.838737 0.242188 0.253657
-v -0.023290 0.242188 0.890766
-v -0.807426 0.242188 0.376921
-v -0.025320 0.242188 0.908117
-v -0.822525 0.242188 0.385708
-v -0.055739 0.335938 0.897523
-v -0.800669 0.335938 0.409370
-v -0.146999 0.375000 0.865742
-v -0.735101 0.375000 0.480358
-v -0.227442 0.335938 0.831709
-v -0.671786 0.335938 0.540530
-v -0.260115 0.242188 0.810298
-v -0.639114 0.242188 0.561940
-v -0.227442 0.156250 0.831709
-v -0.671786 0.156250 0.540530
-v -0.159845 0.242188 0.885346
-v -0.747948 0.242188 0.499962
-v -0.146999 0.117188 0.865742
-v -0.735101 0.117188 0.480358
-v -0.055739 0.156250 0.897523
-v -0.800669 0.156250 0.409370
-v -0.406794 0.429688 0.620775
-v -0.449614 0.351562 0.686119
-v -0.402512 -0.679688 0.614240
-v -0.428204 -0.320312 0.653447
-v -0.436768 -0.187500 0.666516
-v -0.393948 -0.773438 0.601171
-v -0.329717 0.406250 0.503154
-v -0.312589 0.570312 0.477016
-v 0.299743 0.898438 -0.457413
-v 0.466743 0.562500 -0.712257
-v 0.453896 0.070312 -0.692654
-v 0.192692 -0.382812 -0.294051
-v -0.138411 -0.187500 0.581815
-v -0.478203 -0.187500 0.359149
-v -0.051210 -0.437500 0.648298
-v -0.573968 -0.437500 0.305735
-v -0.018538 -0.695312 0.669708
-v -0.606640 -0.695312 0.284324
-v 0.015941 -0.890625 0.645600
-v -0.598299 -0.890625 0.243088
-v -0.012449 -0.945312 0.617655
-v -0.561345 -0.945312 0.257964
-v -0.153732 -0.968750 0.562434
-v -0.454318 -0.968750 0.365460
-v -0.316871 -0.984375 0.483551
-v 0.074751 -0.140625 0.684138
-v -0.657109 -0.140625 0.204550
-v 0.233831 -0.039062 0.797724
-v -0.824753 -0.039062 0.104033
-v 0.448577 0.148438 0.826361
-v -0.936730 0.148438 -0.081432
-v 0.393356 0.429688 0.967644
-v -1.044227 0.429688 0.025595
-v 0.252073 0.484375 0.912423
-v -0.937200 0.484375 0.133092
-v 0.034852 0.601562 0.844802
-v -0.788491 0.601562 0.305265
-v -0.134599 0.757812 0.789804
-v -0.670425 0.757812 0.438676
-v -0.284669 0.718750 0.719484
-v -0.546047 0.718750 0.548203
-v -0.358800 0.492188 0.661565
-v -0.463352 0.492188 0.593053
-v -0.286698 0.414062 0.736835
-v -0.561146 0.414062 0.556989
-v -0.315089 0.304688 0.708891
-v -0.524192 0.304688 0.571865
-v -0.236898 0.093750 0.732108
-v -0.576690 0.093750 0.509441
-v -0.071729 0.015625 0.793640
-v -0.699038 0.015625 0.382564
-v 0.043416 0.062500 0.831733
-v -0.779927 0.062500 0.292196
-v 0.167348 0.187500 0.884924
-v -0.878167 0.187500 0.199798
-v 0.180417 0.296875 0.893488
-v -0.891236 0.296875 0.191233
-v 0.139180 0.375000 0.885147
-v -0.867128 0.375000 0.225713
-v -0.034552 0.437500 0.836683
-v -0.753344 0.437500 0.365659
-v -0.206255 0.468750 0.770869
-v -0.624461 0.468750 0.496818
-v -0.402512 -0.765625 0.614240
-v -0.311029 -0.718750 0.674189
-v -0.493995 -0.718750 0.554291
-v -0.291649 -0.835938 0.658867
-v -0.487683 -0.835938 0.530406
-v -0.328826 -0.882812 0.615824
-v -0.433377 -0.882812 0.547311
-v -0.376820 -0.890625 0.575033
-v -0.411076 -0.195312 0.627309
-v -0.406794 -0.140625 0.620775
-v -0.321846 -0.148438 0.676441
-v -0.491742 -0.148438 0.565108
-v -0.306525 -0.226562 0.695822
-v -0.515628 -0.226562 0.558796
-v -0.334915 -0.289062 0.667877
-v -0.478673 -0.289062 0.573672
-v -0.034998 -0.046875 0.780348
-v -0.701514 -0.046875 0.343580
-v 0.173660 0.054688 0.861039
-v -0.858786 0.054688 0.184476
-v 0.277988 0.203125 0.901384
-v -0.937423 0.203125 0.104924
-v 0.261083 0.375000 0.955689
-v -0.980466 0.375000 0.142101
-v 0.176803 0.414062 0.984525
-v -0.973263 0.414062 0.230886
-v -0.070838 0.546875 0.906310
-v -0.802698 0.546875 0.426721
-v -0.196800 0.640625 0.870470
-v -0.719557 0.640625 0.527906
-v -0.296846 0.617188 0.823590
-v -0.636639 0.617188 0.600924
-v -0.377512 0.429688 0.761389
-v -0.547409 0.429688 0.650056
-v -0.340781 -0.101562 0.748097
-v -0.549884 -0.101562 0.611072
-v -0.213235 -0.445312 0.710252
-v -0.566096 -0.445312 0.479021
-v -0.167717 -0.703125 0.712059
-v -0.585923 -0.703125 0.438008
-v -0.141802 -0.820312 0.701019
-v -0.586146 -0.820312 0.409840
-v -0.150811 -0.914062 0.657753
-v -0.542879 -0.914062 0.400831
-v -0.209622 -0.929688 0.619215
-v -0.484069 -0.929688 0.439369
-v -0.351127 -0.945312 0.535826
-v -0.398230 0.046875 0.607706
-v -0.419640 0.210938 0.640378
-v -0.132346 0.476562 0.800620
-v -0.681242 0.476562 0.440929
-v -0.273852 0.140625 0.717232
-v -0.548300 0.140625 0.537386
-v -0.304272 0.210938 0.706638
-v -0.526444 0.210938 0.561049
-v -0.304495 -0.687500 0.678471
-v -0.500529 -0.687500 0.550009
-v -0.345731 -0.445312 0.670129
-v -0.476421 -0.445312 0.584489
-v -0.411076 -0.445312 0.627309
-v -0.406794 -0.328125 0.620775
-v -0.349791 -0.273438 0.704831
-v -0.506618 -0.273438 0.602062
-v -0.325682 -0.226562 0.739311
-v -0.547854 -0.226562 0.593721
-v -0.336722 -0.132812 0.713395
-v -0.519687 -0.132812 0.593498
-v -0.395532 -0.125000 0.674857
-v -0.460877 -0.125000 0.632037
-v -0.453896 -0.203125 0.692654
-v -0.406126 -0.148438 0.705277
-v -0.484539 -0.148438 0.653893
-v -0.366919 -0.156250 0.730969
-v -0.523746 -0.156250 0.628200
-v -0.362414 -0.226562 0.752602
-v -0.545379 -0.226562 0.632705
-v -0.375706 -0.250000 0.715871
-v -0.506395 -0.250000 0.630230
-v -0.441050 -0.289062 0.673050
-v -0.088388 -0.312500 0.605255
-v -0.519662 -0.312500 0.322640
-v -0.252442 -0.242188 0.684560
-v -0.526890 -0.242188 0.504714
-v -0.239373 -0.312500 0.693124
-v -0.539959 -0.312500 0.496150
-v -0.107991 -0.250000 0.592409
-v -0.500059 -0.250000 0.335486
-v -0.376820 -0.875000 0.575033
-v -0.337613 -0.867188 0.600725
-v -0.416027 -0.867188 0.549341
-v -0.311252 -0.820312 0.646021
-v -0.468079 -0.820312 0.543252
-v -0.319816 -0.742188 0.659090
-v -0.476644 -0.742188 0.556321
-v -0.359692 -0.781250 0.548895
-v -0.285560 -0.750000 0.606814
-v -0.442387 -0.750000 0.504045
-v -0.272714 -0.812500 0.587211
-v -0.429541 -0.812500 0.484442
-v -0.307639 -0.851562 0.554984
-v -0.386052 -0.851562 0.503600
-v -0.346845 -0.859375 0.529292
-v -0.284446 0.218750 0.747652
-v -0.571962 0.218750 0.559242
-v -0.267095 0.156250 0.749681
-v -0.580749 0.156250 0.544143
-v -0.134376 0.429688 0.817971
-v -0.696340 0.429688 0.449716
-v -0.195216 0.421875 0.796784
-v -0.652629 0.421875 0.497041
-v -0.071061 0.398438 0.878143
-v -0.776783 0.398438 0.415682
-v 0.089380 0.351562 0.889875
-v -0.851583 0.351562 0.273261
-v 0.113265 0.289062 0.896186
-v -0.866905 0.289062 0.253880
-v 0.111013 0.195312 0.885370
-v -0.856088 0.195312 0.251628
-v 0.004655 0.101562 0.862376
-v -0.792550 0.101562 0.339967
-v -0.093139 0.062500 0.826313
-v -0.720448 0.062500 0.415237
-v -0.238705 0.109375 0.777626
-v -0.617704 0.109375 0.529268
-v -0.277911 0.296875 0.751934
-v -0.578497 0.296875 0.554960
-v -0.251774 0.375000 0.769062
-v -0.604635 0.375000 0.537832
-v -0.219324 0.359375 0.762305
-v -0.611392 0.359375 0.505382
-v -0.251996 0.296875 0.740894
-v -0.578720 0.296875 0.526792
-v -0.212790 0.125000 0.766587
-v -0.617927 0.125000 0.501100
-v -0.084575 0.085938 0.813244
-v -0.711884 0.085938 0.402168
-v 0.000150 0.117188 0.840743
-v -0.770917 0.117188 0.335462
-v 0.089157 0.210938 0.861707
-v -0.825668 0.210938 0.262221
-v 0.095692 0.281250 0.865989
-v -0.832203 0.281250 0.257939
-v 0.071806 0.335938 0.859678
-v -0.816882 0.335938 0.277320
-v -0.064749 0.390625 0.854257
-v -0.757403 0.390625 0.400361
-v -0.184399 0.398438 0.794531
-v -0.654881 0.398438 0.486224
-v -0.130094 0.406250 0.811437
-v -0.692058 0.406250 0.443181
-v -0.241180 0.171875 0.738642
-v -0.580972 0.171875 0.515976
-v -0.247714 0.226562 0.734360
-v -0.574438 0.226562 0.520258
-v -0.242517 0.460938 0.569637
-v -0.425482 0.460938 0.449740
-v -0.174920 0.664062 0.623274
-v -0.501643 0.664062 0.409172
-v -0.044453 0.687500 0.680747
-v -0.606417 0.687500 0.312492
-v 0.101112 0.554688 0.729434
-v -0.709162 0.554688 0.198461
-v 0.298730 0.453125 0.784209
-v -0.838267 0.453125 0.039134
-v 0.413875 0.406250 0.822302
-v -0.919156 0.406250 -0.051235
-v 0.441374 0.164062 0.737577
-v -0.852450 0.164062 -0.110268
-v 0.276206 0.000000 0.676044
-v -0.730102 0.000000 0.016610
-v 0.109008 -0.093750 0.631862
-v -0.622853 -0.093750 0.152274
-v -0.158436 0.898438 0.241775
-v 0.042820 0.984375 -0.065345
-v 0.368256 -0.195312 -0.561964
-v -0.102769 -0.460938 0.156827
-v -0.252640 -0.976562 0.385534
-v -0.188410 -0.804688 0.287517
-v -0.175564 -0.570312 0.267913
-v -0.154154 -0.484375 0.235241
-v 0.682283 0.234375 0.512484
-v -0.742231 0.234375 -0.421001
-v 0.744484 0.320312 0.431818
-v -0.693099 0.320312 -0.510231
-v 0.886707 0.265625 0.057992
-v -0.407118 0.265625 -0.789852
-v 0.770917 0.437500 -0.335462
-v -0.000150 0.437500 -0.840743
-v 0.575702 -0.046875 0.461322
-v -0.652778 -0.046875 -0.343702
-v 0.586542 -0.125000 0.188211
-v -0.406697 -0.125000 -0.462659
-v 0.771339 -0.007812 -0.008268
-v -0.300314 -0.007812 -0.710523
-v 0.644956 0.054688 -0.371302
-v 0.082991 0.054688 -0.739558
-v -0.026632 -0.351562 0.468254
-v -0.418700 -0.351562 0.211331
-v 0.008985 -0.414062 0.314124
-v -0.291600 -0.414062 0.117150
-v 0.031955 -0.710938 0.478624
-v -0.451595 -0.710938 0.161753
-v -0.004999 -0.500000 0.463749
-v -0.423205 -0.500000 0.189698
-v 0.056064 -0.914062 0.513104
-v -0.492832 -0.914062 0.153412
-v -0.083636 -0.757812 0.384197
-v -0.318876 -0.757812 0.230043
-v -0.092422 -0.539062 0.369098
-v -0.301525 -0.539062 0.232073
-v -0.102571 -0.945312 0.455853
-v -0.377018 -0.945312 0.276007
-v -0.052547 -0.281250 0.479293
-v -0.418477 -0.281250 0.239499
-v -0.080492 -0.226562 0.507683
-v -0.433353 -0.226562 0.276453
-v -0.104154 -0.171875 0.529539
-v -0.443947 -0.171875 0.306873
-v 0.086508 -0.390625 0.252839
-v -0.266354 -0.390625 0.021609
-v 0.393899 -0.312500 -0.059454
-v -0.102720 -0.312500 -0.384890
-v 0.582977 -0.148438 -0.262468
-v 0.007944 -0.148438 -0.639288
-v 0.588819 0.867188 -0.071831
-v -0.169179 0.867188 -0.568547
-v 0.417538 0.929688 0.189548
-v -0.340461 0.929688 -0.307169
-v 0.250538 0.851562 0.444392
-v -0.507460 0.851562 -0.052324
-v 0.150021 0.523438 0.612036
-v -0.621046 0.523438 0.106755
-v 0.423578 0.406250 0.679212
-v -0.791833 0.406250 -0.117248
-v 0.375138 0.453125 0.582086
-v -0.683445 0.453125 -0.111605
-v 0.505852 0.703125 0.396869
-v -0.565801 0.703125 -0.305386
-v 0.598003 0.562500 0.541320
-v -0.735028 0.562500 -0.332217
-v 0.730746 0.617188 0.338751
-v -0.602285 0.617188 -0.534785
-v 0.642877 0.750000 0.187766
-v -0.428775 0.750000 -0.514489
-v 0.779903 0.679688 -0.021337
-v -0.291750 0.679688 -0.723592
-v 0.863490 0.539062 0.136183
-v -0.469542 0.539062 -0.737354
-v 0.837376 0.328125 -0.151804
-v -0.195070 0.328125 -0.828366
-v 0.704880 0.023438 -0.191926
-v -0.105394 0.023438 -0.722899
-v 0.797452 0.328125 0.279718
-v -0.574786 0.328125 -0.619511
-v 0.258434 -0.171875 0.346821
-v -0.421151 -0.171875 -0.098511
-v 0.475011 -0.195312 0.059082
-v -0.243781 -0.195312 -0.411943
-v 0.873391 0.406250 0.292119
-v -0.616468 0.406250 -0.684187
-v 0.715425 -0.140625 0.319371
-v -0.578400 -0.140625 -0.528474
-v 1.048930 -0.101562 0.295064
-v -0.689239 -0.101562 -0.843959
-v 1.307165 0.054688 0.342859
-v -0.836140 0.054688 -1.061651
-v 1.361693 0.320312 0.387932
-v -0.899233 0.320312 -1.093655
-v 1.263676 0.507812 0.323701
-v -0.801216 0.507812 -1.029424
-v 1.027297 0.476562 0.299569
-v -0.684734 0.476562 -0.822326
-v 1.007916 0.414062 0.314890
-v -0.691045 0.414062 -0.798441
-v 1.207341 0.437500 0.324147
-v -0.779137 0.437500 -0.977594
-v 1.281250 0.289062 0.353898
-v -0.835918 0.289062 -1.033483
-v 1.235509 0.078125 0.323924
-v -0.790177 0.078125 -1.003509
-v 1.029549 -0.039062 0.310385
-v -0.695550 -0.039062 -0.820074
-v 0.765448 -0.070312 0.342810
-v -0.619859 -0.070312 -0.564982
-v 0.890964 0.359375 0.322316
-v -0.651170 0.359375 -0.688246
-v 0.949106 0.304688 0.276352
-v -0.632235 0.304688 -0.759902
-v 0.854010 -0.023438 0.307440
-v -0.622780 -0.023438 -0.660301
-v 1.070340 0.000000 0.262392
-v -0.667828 0.000000 -0.876632
-v 1.237316 0.093750 0.278406
-v -0.749163 0.093750 -1.023335
-v 1.276522 0.250000 0.304098
-v -0.788370 0.250000 -1.049027
-v 1.219965 0.359375 0.276376
-v -0.740376 0.359375 -1.008237
-v 1.052989 0.343750 0.260362
-v -0.659041 0.343750 -0.861533
-v 0.821338 0.289062 0.286030
-v -0.590107 0.289062 -0.638891
-v 0.849060 0.171875 0.229472
-v -0.549317 0.171875 -0.686885
-v 0.783715 0.093750 0.186652
-v -0.483972 0.093750 -0.644064
-v 0.835991 0.085938 0.220908
-v -0.536248 0.085938 -0.678321
-v 0.855594 0.015625 0.233754
-v -0.555851 0.015625 -0.691167
-v 0.829456 -0.015625 0.216626
-v -0.529713 -0.015625 -0.674039
-v 0.646244 0.000000 0.339420
-v -0.569167 0.000000 -0.457040
-v 0.695376 -0.023438 0.250190
-v -0.506966 -0.023438 -0.537706
-v 0.703940 0.039062 0.237121
-v -0.498402 0.039062 -0.550775
-v 0.782131 0.203125 0.260338
-v -0.550901 0.203125 -0.613199
-v 0.890519 0.242188 0.265981
-v -0.599340 0.242188 -0.710325
-v 0.920493 0.234375 0.220240
-v -0.569366 0.234375 -0.756066
-v 0.855148 -0.015625 0.177419
-v -0.504021 -0.015625 -0.713246
-v 0.887821 0.015625 0.198829
-v -0.536693 0.015625 -0.734656
-v 0.868217 0.078125 0.185983
-v -0.517090 0.078125 -0.721810
-v 0.815942 0.093750 0.151727
-v -0.464814 0.093750 -0.687553
-v 0.881286 0.171875 0.194547
-v -0.530159 0.171875 -0.730374
-v 1.096033 0.328125 0.223185
-v -0.642136 0.328125 -0.915838
-v 1.258726 0.343750 0.245733
-v -0.727753 0.343750 -1.056007
-v 1.321818 0.242188 0.277737
-v -0.782281 0.242188 -1.101080
-v 1.278329 0.085938 0.258579
-v -0.747356 0.085938 -1.068853
-v 1.106849 0.000000 0.220932
-v -0.644388 0.000000 -0.926655
-v 0.883984 -0.015625 0.261699
-v -0.592806 -0.015625 -0.706043
-v 0.985615 0.289062 0.234893
-v -0.608795 0.289062 -0.809926
-v 0.924775 0.109375 0.213705
-v -0.565084 0.109375 -0.762600
-v 0.968264 0.062500 0.232863
-v -0.600008 0.062500 -0.794827
-v 1.037668 0.125000 0.240981
-v -0.635156 0.125000 -0.855221
-v 0.996431 0.171875 0.232640
-v -0.611048 0.171875 -0.820742
-v 1.055019 0.234375 0.243011
-v -0.643943 0.234375 -0.870320
-v 1.091973 0.187500 0.257887
-v -0.672333 0.187500 -0.898265
-v 1.141997 0.210938 0.281327
-v -0.713792 0.210938 -0.934773
-v 1.122393 0.273438 0.268480
-v -0.694189 0.273438 -0.921927
-v 1.121502 0.437500 0.155810
-v -0.590529 0.437500 -0.966084
-v 1.345258 0.468750 0.227714
-v -0.745772 0.468750 -1.142540
-v 1.417583 0.296875 0.331151
-v -0.869481 0.296875 -1.167563
-v 1.388970 0.054688 0.275039
-v -0.806612 0.054688 -1.163727
-v 1.138853 -0.085938 0.157840
-v -0.599316 -0.085938 -0.981183
-v 0.839827 -0.125000 0.158039
-v -0.480136 -0.125000 -0.706934
-v 0.928612 0.382812 0.150836
-v -0.508972 0.382812 -0.791214
-vn 0.1578 -0.2026 0.9665
-vn -0.9491 -0.2026 0.2411
-vn 0.4326 -0.3051 0.8484
-vn -0.9505 -0.3051 -0.0580
-vn 0.0904 -0.7905 0.6057
-vn -0.5914 -0.7905 0.1588
-vn -0.1039 -0.5163 0.8501
-vn -0.7380 -0.5163 0.4345
-vn -0.5369 -0.5222 0.6626
-vn -0.3932 -0.5222 0.7568
-vn -0.4732 -0.8487 0.2362
-vn -0.0277 -0.8487 0.5282
-vn -0.9416 -0.3352 0.0309
-vn 0.3475 -0.3352 0.8757
-vn -0.8649 -0.1981 0.4612
-vn -0.0777 -0.1981 0.9771
-vn -0.8621 0.1958 0.4674
-vn -0.0844 0.1958 0.9770
-vn -0.9443 0.3264 0.0413
-vn 0.3391 0.3264 0.8823
-vn -0.4947 0.8173 0.2953
-vn -0.0733 0.8173 0.5715
-vn -0.5039 0.6023 0.6191
-vn -0.3687 0.5518 0.7480
-vn -0.1516 0.5231 0.8387
-vn -0.7310 0.5446 0.4111
-vn 0.0778 0.7672 0.6366
-vn -0.6148 0.7672 0.1828
-vn 0.4266 0.2968 0.8544
-vn -0.9540 0.2940 -0.0582
-vn 0.1922 0.1868 0.9634
-vn -0.9491 0.2026 0.2411
-vn 0.9327 0.3436 0.1091
-vn -0.3557 0.3058 -0.8831
-vn 0.4576 0.8296 -0.3200
-vn 0.1273 0.8146 -0.5659
-vn -0.0614 0.7605 -0.6464
-vn 0.5924 0.7988 -0.1047
-vn -0.5075 0.3143 -0.8023
-vn 0.9448 0.3276 -0.0075
-vn -0.3666 -0.3538 -0.8605
-vn 0.9353 -0.3538 -0.0074
-vn -0.1404 -0.7988 -0.5850
-vn 0.6057 -0.7806 -0.1539
-vn 0.4639 -0.8206 -0.3337
-vn 0.1208 -0.8206 -0.5586
-vn 0.9435 -0.3293 -0.0379
-vn -0.3418 -0.3293 -0.8802
-vn -0.1666 -0.0623 0.9841
-vn -0.8358 -0.0623 0.5455
-vn -0.2560 -0.1754 0.9506
-vn -0.7694 -0.1754 0.6142
-vn -0.4573 -0.1835 0.8702
-vn -0.6154 -0.1835 0.7666
-vn -0.5990 -0.0283 0.8003
-vn -0.4947 -0.0283 0.8686
-vn -0.5990 0.0260 0.8003
-vn -0.4947 0.0260 0.8687
-vn -0.4538 0.1729 0.8742
-vn -0.6204 0.1729 0.7650
-vn -0.2604 0.1656 0.9512
-vn -0.7682 0.1656 0.6184
-vn -0.1666 0.0572 0.9844
-vn -0.8360 0.0572 0.5457
-vn -0.1404 -0.8748 0.4636
-vn -0.3770 -0.8433 0.3831
-vn -0.0511 -0.8656 0.4982
-vn -0.4175 -0.8620 0.2875
-vn 0.1331 -0.5049 0.8528
-vn -0.8351 -0.5049 0.2184
-vn 0.3056 -0.0633 0.9501
-vn -0.9931 -0.0633 0.0991
-vn 0.2659 0.1132 0.9573
-vn -0.9839 0.1132 0.1384
-vn 0.0920 -0.8345 0.5432
-vn -0.5348 -0.8345 0.1325
-vn -0.0230 -0.7290 0.6841
-vn -0.7349 -0.5751 0.3593
-vn 0.2609 -0.4197 0.8694
-vn -0.9013 -0.4197 0.1078
-vn 0.2624 -0.3915 0.8820
-vn -0.8894 -0.2978 0.3469
-vn -0.2241 0.3425 0.9124
-vn -0.9290 0.3606 -0.0833
-vn 0.1154 0.6482 0.7526
-vn -0.7365 0.6448 0.2042
-vn 0.1836 0.5565 0.8103
-vn -0.8162 0.5565 0.1551
-vn -0.4535 0.6560 0.6033
-vn -0.3761 0.6685 0.6416
-vn -0.9501 0.2715 0.1538
-vn 0.3114 0.3768 0.8724
-vn -0.8325 0.5262 0.1734
-vn 0.1665 0.5774 0.7993
-vn 0.1006 -0.6281 0.7716
-vn -0.8760 -0.3230 0.3581
-vn -0.2821 -0.4694 0.8367
-vn -0.6546 -0.4694 0.5927
-vn -0.4755 -0.5792 0.6621
-vn -0.3809 -0.5010 0.7771
-vn -0.4116 -0.7843 0.4641
-vn -0.3817 -0.5759 0.7230
-vn -0.4936 -0.1695 0.8530
-vn -0.2984 -0.8645 0.4045
-vn -0.1385 -0.0609 0.9885
-vn -0.6534 -0.3128 0.6894
-vn -0.2262 -0.1828 0.9568
-vn -0.8472 -0.1812 0.4993
-vn -0.1840 -0.3068 0.9338
-vn -0.7658 -0.2762 0.5807
-vn -0.2519 0.2113 0.9444
-vn -0.8647 -0.2408 0.4409
-vn -0.6306 0.3903 0.6708
-vn -0.3633 0.3903 0.8460
-vn 0.2026 -0.2915 0.9349
-vn -0.6202 -0.4956 0.6081
-vn -0.4965 -0.0781 0.8645
-vn -0.5945 -0.0781 0.8003
-vn -0.5387 -0.2316 0.8100
-vn -0.5941 -0.0845 0.7999
-vn -0.2975 -0.7103 0.6379
-vn -0.4661 -0.7103 0.5274
-vn -0.3241 -0.5947 0.7357
-vn -0.5452 -0.5947 0.5908
-vn -0.2509 -0.1662 0.9536
-vn -0.7366 -0.3928 0.5506
-vn -0.2422 -0.0360 0.9696
-vn -0.7923 -0.0360 0.6091
-vn -0.2464 -0.0808 0.9658
-vn -0.7872 -0.0808 0.6114
-vn -0.5667 0.0511 0.8224
-vn -0.5469 0.0665 0.8346
-vn -0.5506 -0.0651 0.8323
-vn -0.5469 -0.0665 0.8346
-vn -0.5481 -0.0000 0.8364
-vn 0.6821 -0.5335 0.5001
-vn -0.7308 -0.5335 -0.4258
-vn 0.8814 0.2692 0.3883
-vn -0.7078 0.2692 -0.6531
-vn 0.2933 0.9004 -0.3212
-vn 0.1269 0.9165 -0.3795
-vn -0.8364 -0.0000 -0.5481
-vn 0.3195 0.5492 0.7722
-vn 0.2423 -0.8956 0.3730
-vn -0.5033 -0.8639 -0.0200
-vn -0.1796 -0.5747 0.7984
-vn -0.6603 -0.5747 0.4834
-vn -0.8359 0.5353 0.1213
-vn 0.2224 0.5353 0.8148
-vn -0.2705 0.7759 0.5700
-vn -0.4147 0.7759 0.4755
-vn 0.3056 0.2870 0.9079
-vn -0.9529 0.2971 0.0605
-vn -0.1356 -0.5409 0.8301
-vn -0.7070 -0.5409 0.4556
-vn -0.4901 0.2343 0.8396
-vn -0.5650 0.2247 0.7939
-vn -0.5380 -0.6087 0.5831
-vn -0.3199 -0.6087 0.7261
-vn -0.8943 0.0716 0.4417
-vn -0.0480 0.0716 0.9963
-vn -0.7993 -0.5774 0.1665
-vn 0.1665 -0.5774 0.7993
-vn 0.0629 -0.4310 0.9001
-vn -0.7931 0.0738 0.6047
-vn -0.2482 0.0311 0.9682
-vn -0.7602 0.0662 0.6463
-vn 0.3122 0.3910 0.8658
-vn -0.9719 0.2059 -0.1137
-vn 0.4769 0.3180 0.8194
-vn -0.9664 0.1994 -0.1624
-vn 0.5120 0.3798 0.7704
-vn -0.9108 0.3798 -0.1619
-vn -0.3396 -0.4161 0.8435
-vn -0.4483 -0.8655 0.2236
-vn -0.6414 -0.1945 0.7422
-vn -0.4245 -0.1945 0.8843
-vn -0.8643 -0.0000 0.5030
-vn -0.1162 -0.0000 0.9932
-vn -0.2810 0.9494 0.1402
-vn -0.0163 0.9494 0.3136
-vn -0.6555 0.7337 -0.1789
-vn 0.4257 0.7337 0.5296
-vn 0.8364 -0.0000 0.5481
-vn 0.1905 -0.9450 0.2660
-vn -0.3200 -0.9450 -0.0685
-vn -0.5041 -0.3031 0.8087
-vn -0.5403 -0.3031 0.7850
-vn -0.3953 -0.3479 0.8501
-vn -0.6216 -0.3479 0.7018
-vn -0.8601 -0.2239 0.4584
-vn -0.0770 -0.2239 0.9716
-vn -0.7541 0.0271 0.6562
-vn -0.3007 0.0271 0.9533
-vn -0.6836 -0.0090 0.7298
-vn -0.3092 0.1038 0.9453
-vn -0.7779 -0.4874 0.3967
-vn 0.2385 -0.4595 0.8555
-vn -0.3792 -0.8797 0.2869
-vn -0.1117 -0.8797 0.4622
-vn -0.0615 -0.5895 0.8054
-vn -0.7139 -0.5895 0.3779
-vn 0.2183 -0.4589 0.8612
-vn -0.8768 -0.4589 0.1436
-vn -0.0080 -0.1144 0.9934
-vn -0.9076 -0.1144 0.4039
-vn 0.0260 0.1197 0.9925
-vn -0.9259 0.1155 0.3596
-vn -0.1061 0.4082 0.9067
-vn -0.7343 0.6574 0.1693
-vn -0.1724 0.7882 0.5908
-vn -0.4728 0.7882 0.3939
-vn -0.3479 0.3387 0.8742
-vn -0.6627 0.3387 0.6680
-vn -0.5975 0.2756 0.7530
-vn -0.4519 0.2756 0.8484
-vn -0.2778 -0.2181 0.9356
-vn -0.7016 -0.5739 0.4224
-vn -0.2436 -0.3015 0.9218
-vn -0.7480 -0.3015 0.5913
-vn -0.5361 -0.8339 0.1311
-vn -0.4661 -0.3156 0.8265
-vn -0.2696 -0.7822 0.5616
-vn -0.0340 -0.9071 0.4196
-vn -0.7945 -0.2851 0.5361
-vn -0.1744 -0.2851 0.9425
-vn -0.7521 -0.0577 0.6566
-vn -0.1048 0.0508 0.9932
-vn -0.6747 0.5245 0.5193
-vn -0.2068 0.5245 0.8259
-vn -0.4738 0.5546 0.6841
-vn -0.3595 0.6815 0.6374
-vn -0.0538 0.6342 0.7713
-vn -0.7118 0.5221 0.4699
-vn 0.0413 0.5300 0.8470
-vn -0.7931 0.5300 0.3003
-vn 0.0325 -0.3391 0.9402
-vn -0.8750 -0.3391 0.3455
-vn 0.3912 -0.0615 0.9183
-vn -0.9981 -0.0615 0.0079
-vn 0.3171 0.1116 0.9418
-vn -0.9901 0.1116 0.0852
-vn -0.2816 0.8888 -0.3617
-vn 0.4440 0.8888 0.1139
-vn -0.5111 0.3744 -0.7737
-vn 0.9134 0.3744 0.1597
-vn 0.0034 0.8710 -0.4912
-vn 0.4335 0.8626 -0.2607
-vn 0.6641 0.7445 0.0690
-vn -0.3307 0.7489 -0.5743
-vn 0.4906 0.8685 -0.0711
-vn -0.1445 0.8833 -0.4460
-vn 0.3979 0.9141 -0.0780
-vn -0.0873 0.9141 -0.3960
-vn 0.9840 0.1343 0.1173
-vn -0.3427 0.1323 -0.9301
-vn 0.7260 -0.6649 -0.1759
-vn -0.1285 -0.6649 -0.7358
-vn 0.5064 -0.8566 -0.0987
-vn -0.1117 -0.8566 -0.5037
-vn 0.7677 -0.3858 -0.5117
-vn 0.2616 -0.6644 -0.7001
-vn 0.6981 -0.0976 -0.7093
-vn 0.2708 -0.0125 -0.9626
-vn 0.4439 -0.5633 -0.6969
-vn 0.2873 -0.3112 -0.9059
-vn 0.2452 -0.9649 -0.0945
-vn -0.0112 -0.9649 -0.2625
-vn 0.2373 -0.9624 -0.1322
-vn 0.0265 -0.9624 -0.2703
-vn 0.9525 0.1573 0.2606
-vn -0.6192 0.1573 -0.7693
-vn 0.9539 0.1838 0.2370
-vn -0.5981 0.1838 -0.7800
-vn 0.7165 0.0766 -0.6934
-vn 0.3498 0.0766 -0.9337
-vn 0.6446 -0.0530 -0.7627
-vn 0.6292 -0.3635 -0.6870
-vn 0.9759 0.1371 0.1699
-vn 0.0380 -0.6780 -0.7341
-vn 0.9709 0.1355 0.1972
-vn -0.5684 0.1355 -0.8115
-vn 0.8772 0.3440 0.3349
-vn -0.6896 0.2673 -0.6731
-vn 0.8836 0.3642 0.2944
-vn -0.6596 0.2813 -0.6970
-vn 0.6888 0.4337 0.5810
-vn -0.6894 0.2455 -0.6815
-vn 0.2647 -0.9577 -0.1128
-vn 0.1698 -0.7864 -0.5939
-vn 0.7479 -0.4712 -0.4676
-vn 0.1249 -0.4759 -0.8706
-vn 0.5140 -0.8236 -0.2396
-vn -0.0292 -0.8342 -0.5507
-vn 0.3255 -0.9442 0.0497
-vn -0.1755 -0.9442 -0.2786
-vn 0.4004 -0.9163 -0.0115
-vn -0.1493 -0.9163 -0.3717
-vn 0.9393 0.3333 0.0819
-vn -0.8158 -0.4737 -0.3318
-vn 0.6891 -0.3740 0.6207
-vn -0.8441 -0.3740 -0.3841
-vn 0.7699 -0.0454 -0.6366
-vn 0.1316 -0.2265 -0.9651
-vn -0.0175 0.9658 0.2588
-vn -0.2289 0.9626 0.1451
-vn 0.2083 0.9750 -0.0772
-vn -0.0124 0.9750 -0.2218
-vn 0.6986 0.6192 -0.3585
-vn 0.0499 0.6192 -0.7836
-vn 0.4744 0.8618 0.1793
-vn -0.3538 0.8618 -0.3634
-vn -0.1805 0.6447 0.7428
-vn -0.6090 0.6447 0.4620
-vn 0.4179 0.7888 0.4507
-vn -0.5800 0.7888 -0.2033
-vn 0.7000 0.6755 0.2316
-vn -0.4918 0.6755 -0.5494
-vn 0.9726 0.1364 -0.1881
-vn -0.1248 0.2517 -0.9597
-vn 0.9507 0.2318 -0.2059
-vn -0.1907 0.2318 -0.9539
-vn 0.6617 0.7254 0.1897
-vn -0.4380 0.7254 -0.5310
-vn 0.5405 0.6729 0.5051
-vn -0.6788 0.6729 -0.2940
-vn 0.3905 0.4074 0.8255
-vn -0.9128 0.4074 -0.0285
-vn 0.4657 0.8840 -0.0413
-vn -0.2314 0.9434 -0.2377
-vn -0.1601 0.6237 0.7651
-vn -0.5939 0.5080 0.6238
-vn 0.3969 0.1005 -0.9124
-vn 0.6781 0.1005 -0.7281
-vn -0.1772 0.5674 0.8041
-vn -0.6666 0.5674 0.4835
-vn -0.6665 0.1847 0.7223
-vn -0.3962 0.1847 0.8994
-vn 0.9937 0.0893 0.0674
-vn -0.9332 0.2255 -0.2800
-vn 0.5754 0.0762 0.8143
-vn -0.9763 0.0762 -0.2026
-vn 0.7886 0.2169 0.5753
-vn -0.8423 0.2169 -0.4934
-vn 0.9242 -0.0304 0.3806
-vn -0.8169 0.0893 -0.5698
-vn 0.6089 -0.6646 0.4331
-vn -0.5833 -0.7651 -0.2729
-vn 0.2649 -0.9243 0.2749
-vn -0.3575 -0.9244 -0.1332
-vn 0.1835 -0.8754 0.4471
-vn -0.4832 -0.8754 0.0102
-vn 0.4609 -0.7642 0.4511
-vn -0.5976 -0.7642 -0.2426
-vn 0.4807 -0.6368 0.6028
-vn -0.7446 -0.6368 -0.2002
-vn -0.2471 -0.4499 0.8582
-vn -0.6883 -0.4499 0.5691
-vn 0.9020 -0.3070 -0.3036
-vn -0.0072 -0.3290 -0.9443
-vn 0.8583 -0.2400 -0.4535
-vn -0.0278 -0.3343 -0.9421
-vn 0.5345 -0.8452 -0.0014
-vn 0.0993 -0.8341 -0.5426
-vn 0.7351 -0.6610 0.1505
-vn -0.4621 -0.6154 -0.6386
-vn 0.8255 -0.4408 -0.3526
-vn -0.0063 -0.4408 -0.8976
-vn -0.1760 0.2855 0.9421
-vn -0.7159 0.4867 0.5006
-vn -0.1138 0.0975 0.9887
-vn -0.8611 0.0975 0.4990
-vn -0.2412 0.1993 0.9498
-vn -0.6909 -0.0079 0.7229
-vn -0.3605 -0.0836 0.9290
-vn -0.7671 -0.0758 0.6370
-vn -0.2293 0.0824 0.9699
-vn -0.9171 -0.2198 0.3327
-vn 0.1119 -0.3850 0.9161
-vn -0.8846 -0.3850 0.2631
-vn 0.0358 0.5580 0.8291
-vn -0.7744 0.5580 0.2981
-vn -0.4904 0.8318 0.2602
-vn -0.0428 0.8318 0.5535
-vn -0.9715 0.2223 -0.0822
-vn 0.3483 0.2366 0.9070
-vn -0.8627 -0.3579 0.3574
-vn 0.0141 -0.3548 0.9348
-vn 0.0333 -0.5991 0.8000
-vn -0.7667 -0.5252 0.3692
-vn 0.3006 -0.4567 0.8373
-vn -0.8877 -0.4567 0.0586
-vn 0.7628 -0.6131 0.2057
-vn -0.5974 -0.7658 -0.2382
-vn -0.6645 0.2923 0.6878
-vn -0.3316 0.2733 0.9030
-vn 0.8841 -0.3578 0.3005
-vn -0.6284 -0.3578 -0.6907
-vn -0.4816 0.3399 0.8078
-vn -0.5485 0.3399 0.7640
-vn 0.0521 0.9064 0.4193
-vn -0.4052 0.9064 0.1196
-vn -0.0494 -0.4480 0.8927
-vn -0.9706 0.1689 0.1716
-vn 0.1216 -0.5534 0.8240
-vn -0.8357 -0.4075 -0.3681
-vn 0.0632 -0.3122 0.9479
-vn -0.8286 -0.5217 0.2034
-vn 0.1300 -0.5533 0.8228
-vn -0.9225 -0.2571 0.2879
-vn 0.7906 0.5323 0.3027
-vn -0.5931 0.5323 -0.6041
-vn 0.8170 -0.3765 0.4367
-vn -0.6160 -0.4446 -0.6503
-vn 0.8738 -0.0181 0.4859
-vn -0.7943 -0.0181 -0.6072
-vn 0.4187 -0.6644 0.6191
-vn -0.7347 -0.6644 -0.1367
-vn 0.6053 -0.6176 0.5021
-vn -0.7357 -0.5947 -0.3241
-vn 0.5232 -0.7022 0.4828
-vn -0.6515 -0.7022 -0.2870
-vn 0.0924 0.9921 0.0853
-vn -0.1354 0.9631 -0.2327
-vn 0.7317 0.3145 0.6048
-vn -0.8583 0.3469 -0.3781
-vn 0.4629 -0.7767 0.4272
-vn -0.5765 -0.7767 -0.2539
-vn -0.0000 1.0000 -0.0000
-vn 0.3133 -0.6899 0.6526
-vn -0.7234 -0.6899 -0.0267
-vn 0.0190 -0.8808 0.4732
-vn -0.4414 -0.8808 0.1714
-vn -0.4939 -0.5252 -0.6930
-vn 0.8171 -0.5080 0.2725
-vn -0.3843 0.2429 -0.8907
-vn 0.9705 0.2377 0.0405
-vn -0.3338 0.7847 -0.5223
-vn 0.6121 0.7847 0.0976
-vn -0.0834 0.9899 0.1144
-vn 0.1002 0.9939 0.0470
-vn -0.4572 0.0392 0.8885
-vn -0.6851 0.0097 0.7284
-vn -0.3233 0.0852 0.9424
-vn -0.8444 0.0413 0.5342
-vn -0.2685 0.0926 0.9588
-vn -0.7719 0.0926 0.6289
-vn -0.3598 0.0124 0.9329
-vn -0.6455 0.0458 0.7624
-vn -0.5137 0.3867 0.7659
-vn -0.4971 0.3867 0.7767
-vn -0.1902 -0.0364 0.9811
-vn -0.8510 -0.0320 0.5242
-vn -0.3084 -0.1897 0.9321
-vn -0.7432 0.0723 0.6652
-vn -0.7506 0.6088 0.2568
-vn -0.0775 0.7454 0.6622
-vn 0.1648 0.1802 0.9697
-vn -0.9549 0.1802 0.2360
-vn -0.1130 -0.2008 0.9731
-vn -0.8657 -0.1986 0.4594
-vn 0.0429 -0.1334 0.9901
-vn -0.7224 -0.4062 0.5596
-vn -0.0301 0.2833 0.9585
-vn -0.8668 0.2833 0.4102
-vn -0.1662 0.5802 0.7973
-vn -0.6647 0.5802 0.4707
-vn 0.1295 -0.9912 -0.0280
-vn -0.0260 -0.9912 -0.1299
-vn 0.3130 -0.8715 0.3776
-vn -0.4712 -0.8715 -0.1363
-vn 0.6348 -0.2541 0.7297
-vn -0.9311 -0.2460 -0.2693
-vn 0.7406 0.5291 0.4142
-vn -0.6895 0.5627 -0.4560
-vn -0.0924 0.9439 -0.3170
-vn 0.3525 0.9243 -0.1464
-vn -0.3851 0.8743 -0.2956
-vn 0.4612 0.8851 0.0617
-vn 0.0266 -0.0030 -0.9996
-vn 0.9163 -0.0144 -0.4002
-vn 0.4195 0.0104 -0.9077
-vn 0.6648 0.0104 -0.7469
-vn 0.8395 0.0266 -0.5428
-vn 0.1626 0.0266 -0.9863
-vn -0.6775 0.5901 -0.4391
-vn 0.5872 0.6786 0.4412
-vn 0.8326 -0.2291 -0.5043
-vn 0.1300 -0.2291 -0.9647
-vn -0.0126 -0.9943 -0.1060
-vn 0.1023 -0.9943 -0.0307
-vn 0.1699 -0.1971 0.9655
-vn -0.9531 -0.1971 0.2296
-vn 0.4418 -0.3017 0.8449
-vn -0.9510 -0.3017 -0.0678
-vn 0.1210 -0.7967 0.5922
-vn -0.5912 -0.7967 0.1254
-vn -0.1681 -0.4954 0.8523
-vn -0.7143 -0.4954 0.4943
-vn -0.5027 -0.5714 0.6487
-vn -0.3941 -0.5714 0.7199
-vn -0.4939 -0.8315 0.2542
-vn -0.0359 -0.8315 0.5543
-vn -0.8637 -0.1863 0.4682
-vn -0.0845 -0.1863 0.9788
-vn -0.8815 0.1812 0.4360
-vn -0.0479 0.1812 0.9823
-vn -0.5387 0.5518 0.6366
-vn -0.3665 0.6023 0.7091
-vn -0.0852 0.5446 0.8343
-vn -0.7085 0.5231 0.4738
-vn 0.4342 0.2940 0.8515
-vn -0.9536 0.2968 -0.0501
-vn 0.1578 0.2026 0.9665
-vn -0.9601 0.1868 0.2084
-vn 0.9517 0.3058 -0.0264
-vn -0.4724 0.3436 -0.8117
-vn 0.4680 0.8146 -0.3426
-vn 0.1107 0.8296 -0.5473
-vn -0.1404 0.7988 -0.5850
-vn 0.6172 0.7605 -0.2018
-vn -0.3703 0.3276 -0.8692
-vn 0.9382 0.3143 0.1451
-vn -0.4947 -0.3408 -0.7995
-vn 0.9305 -0.3408 0.1344
-vn -0.0614 -0.7605 -0.6464
-vn 0.9214 -0.3734 0.1078
-vn -0.4666 -0.3734 -0.8018
-vn -0.2007 -0.8433 0.4986
-vn -0.3691 -0.8748 0.3138
-vn -0.0970 -0.8620 0.4975
-vn -0.4364 -0.8656 0.2457
-vn 0.1251 -0.4256 0.8962
-vn -0.8717 -0.4256 0.2430
-vn 0.2744 -0.0299 0.9611
-vn -0.9908 -0.0299 0.1320
-vn 0.3534 0.0689 0.9329
-vn -0.9964 0.0689 0.0484
-vn -0.1246 -0.7779 0.6159
-vn -0.5150 -0.7779 0.3601
-vn -0.0361 -0.5751 0.8173
-vn -0.6180 -0.7290 0.2942
-vn 0.2495 -0.4191 0.8730
-vn -0.9000 -0.4191 0.1197
-vn 0.0369 -0.2978 0.9539
-vn -0.9134 -0.3915 0.1115
-vn 0.4472 0.3606 0.8185
-vn -0.7471 0.3425 0.5696
-vn 0.1068 0.6448 0.7568
-vn -0.7361 0.6482 0.1946
-vn 0.1774 0.4924 0.8521
-vn -0.8521 0.4924 0.1774
-vn -0.4382 0.6685 0.6009
-vn -0.3722 0.6560 0.6566
-vn -0.9242 0.3768 0.0627
-vn 0.2382 0.2715 0.9325
-vn -0.7993 0.5774 0.1665
-vn 0.1734 0.5262 0.8325
-vn 0.0213 -0.3230 0.9461
-vn -0.7476 -0.6281 0.2158
-vn -0.2869 -0.4685 0.8356
-vn -0.6517 -0.4685 0.5966
-vn -0.5605 -0.5010 0.6595
-vn -0.4172 -0.5792 0.7003
-vn -0.5105 -0.5759 0.6386
-vn -0.2612 -0.7843 0.5627
-vn -0.2518 -0.8645 0.4351
-vn -0.5851 -0.1695 0.7931
-vn -0.3712 -0.3128 0.8743
-vn -0.8511 -0.0609 0.5215
-vn -0.1196 -0.1812 0.9761
-vn -0.7869 -0.1828 0.5893
-vn -0.2267 -0.2762 0.9340
-vn -0.7827 -0.3068 0.5415
-vn -0.0591 -0.2408 0.9688
-vn -0.7654 0.2113 0.6079
-vn -0.5643 -0.1899 0.8034
-vn -0.5114 -0.1899 0.8381
-vn -0.3100 -0.4956 0.8113
-vn -0.9381 -0.2915 0.1874
-vn -0.2735 -0.3498 0.8960
-vn -0.7123 -0.3498 0.6085
-vn -0.4963 -0.0845 0.8641
-vn -0.5276 -0.2316 0.8173
-vn -0.4275 -0.6507 0.6276
-vn -0.4048 -0.6507 0.6424
-vn -0.2382 -0.5476 0.8021
-vn -0.6404 -0.5476 0.5385
-vn -0.2108 -0.3928 0.8951
-vn -0.7742 -0.1662 0.6107
-vn -0.2898 -0.0164 0.9570
-vn -0.7617 -0.0164 0.6477
-vn -0.2382 -0.1432 0.9606
-vn -0.7857 -0.1432 0.6019
-vn -0.5278 0.0511 0.8478
-vn -0.5433 -0.0651 0.8370
-vn 0.7261 -0.6087 0.3199
-vn -0.5831 -0.6087 -0.5380
-vn 0.9358 0.1919 0.2956
-vn -0.6446 0.1919 -0.7401
-vn 0.2973 0.9165 -0.2678
-vn 0.1774 0.9004 -0.3972
-vn -0.8355 0.5492 0.0153
-vn 0.2192 -0.8639 0.4535
-vn -0.4387 -0.8956 -0.0733
-vn -0.7403 0.6667 -0.0866
-vn 0.3749 0.6667 0.6442
-vn -0.2012 0.8086 0.5529
-vn -0.4266 0.8086 0.4052
-vn 0.3249 0.2971 0.8979
-vn -0.9544 0.2870 0.0822
-vn 0.1751 -0.8575 0.4838
-vn -0.5135 -0.8575 0.0326
-vn -0.5024 0.2247 0.8349
-vn -0.5741 0.2343 0.7845
-vn -0.4152 -0.2609 0.8715
-vn -0.6334 -0.2609 0.7286
-vn -0.3642 -0.8206 0.4405
-vn -0.2586 -0.8206 0.5097
-vn 0.2729 0.2817 0.9199
-vn -0.9523 0.2817 0.1169
-vn -0.2378 0.0738 0.9685
-vn -0.8504 -0.4310 0.3016
-vn -0.2892 0.0662 0.9550
-vn -0.7886 0.0311 0.6141
-vn 0.4922 0.2059 0.8458
-vn -0.9185 0.3910 0.0593
-vn 0.5347 0.1994 0.8212
-vn -0.9417 0.3180 -0.1102
-vn 0.6501 0.0664 0.7569
-vn -0.9535 0.0664 -0.2940
-vn -0.0260 -0.8655 0.5003
-vn -0.6379 -0.4161 0.6480
-vn -0.6744 -0.2043 0.7096
-vn -0.3814 -0.2043 0.9015
-vn -0.6367 -0.1829 0.7491
-vn -0.4327 -0.1829 0.8828
-vn -0.6442 0.3123 0.6982
-vn -0.3830 0.3123 0.8694
-vn -0.6472 0.6857 -0.3330
-vn 0.5637 0.6857 0.4605
-vn -0.4844 -0.2870 0.8264
-vn -0.5644 -0.2870 0.7740
-vn -0.8802 -0.3293 0.3418
-vn 0.0379 -0.3293 0.9435
-vn -0.8859 -0.1130 0.4498
-vn -0.0588 -0.1130 0.9919
-vn -0.7433 0.1038 0.6608
-vn -0.3963 -0.0090 0.9181
-vn -0.8796 -0.4595 0.1228
-vn -0.0532 -0.4874 0.8716
-vn -0.5149 -0.6359 0.5749
-vn -0.3215 -0.6359 0.7016
-vn -0.0064 -0.6211 0.7837
-vn -0.7160 -0.6211 0.3187
-vn -0.0419 -0.3557 0.9337
-vn -0.8393 -0.3557 0.4111
-vn 0.0497 -0.0839 0.9952
-vn -0.9324 -0.0839 0.3517
-vn 0.0399 0.1155 0.9925
-vn -0.9203 0.1197 0.3724
-vn 0.1379 0.6574 0.7408
-vn -0.7890 0.4082 0.4592
-vn -0.1990 0.3478 0.9162
-vn -0.7606 0.3478 0.5482
-vn -0.3799 0.3774 0.8445
-vn -0.6227 0.3774 0.6854
-vn -0.5079 0.2306 0.8300
-vn -0.5582 0.2306 0.7970
-vn -0.1073 -0.5739 0.8119
-vn -0.7469 -0.2181 0.6281
-vn -0.2945 -0.2252 0.9287
-vn -0.7340 -0.2252 0.6408
-vn -0.5717 -0.3156 0.7573
-vn 0.0938 -0.8339 0.5439
-vn -0.3712 -0.9071 0.1986
-vn -0.4073 -0.7822 0.4714
-vn -0.7800 -0.2397 0.5780
-vn -0.2186 -0.2397 0.9459
-vn -0.8688 0.0508 0.4925
-vn -0.3018 -0.0577 0.9516
-vn -0.5211 0.4072 0.7501
-vn -0.4798 0.4072 0.7772
-vn -0.4409 0.6815 0.5841
-vn -0.4381 0.5546 0.7075
-vn -0.1467 0.5221 0.8402
-vn -0.6858 0.6342 0.3572
-vn 0.3719 -0.3158 0.8729
-vn -0.9488 -0.3158 0.0075
-vn 0.3543 -0.0807 0.9316
-vn -0.9956 -0.0807 0.0470
-vn 0.3264 0.1210 0.9375
-vn -0.9898 0.1210 0.0750
-vn -0.3326 0.6811 -0.6523
-vn 0.7308 0.6811 0.0446
-vn -0.5042 0.3650 -0.7826
-vn 0.9188 0.3650 0.1499
-vn 0.0660 0.8626 -0.5016
-vn 0.4490 0.8710 -0.1992
-vn 0.6586 0.7489 0.0739
-vn -0.3283 0.7445 -0.5814
-vn 0.4666 0.8833 -0.0455
-vn -0.1307 0.8685 -0.4782
-vn 0.3907 0.9159 -0.0925
-vn -0.0711 0.9159 -0.3951
-vn 0.9896 0.1323 -0.0570
-vn -0.5003 0.1343 -0.8554
-vn 0.6586 -0.7524 -0.0122
-vn -0.2517 -0.7524 -0.6087
-vn 0.6379 -0.7323 -0.2386
-vn -0.0358 -0.7323 -0.6801
-vn 0.5375 -0.6644 -0.5193
-vn 0.1627 -0.3858 -0.9081
-vn 0.7745 -0.0125 -0.6325
-vn 0.3716 -0.0976 -0.9232
-vn 0.7159 -0.3112 -0.6250
-vn 0.4618 -0.5633 -0.6851
-vn 0.1015 -0.9948 -0.0128
-vn -0.0288 -0.9948 -0.0981
-vn 0.2061 -0.9718 -0.1148
-vn 0.0230 -0.9718 -0.2348
-vn 0.7587 -0.5621 0.3292
-vn -0.6047 -0.5621 -0.5643
-vn 0.9601 0.1396 0.2423
-vn -0.6054 0.1396 -0.7836
-vn 0.6390 -0.0274 -0.7687
-vn 0.4497 -0.0274 -0.8928
-vn 0.3788 -0.3635 -0.8511
-vn 0.4420 -0.0530 -0.8954
-vn 0.6579 -0.6780 -0.3279
-vn -0.5453 0.1371 -0.8269
-vn 0.9707 0.1393 0.1959
-vn -0.5671 0.1393 -0.8118
-vn 0.8924 0.2673 0.3636
-vn -0.6572 0.3440 -0.6706
-vn 0.9024 0.2813 0.3265
-vn -0.6227 0.3642 -0.6926
-vn 0.9000 0.2455 0.3600
-vn -0.8076 0.4337 -0.3996
-vn 0.4768 -0.7864 -0.3928
-vn -0.0023 -0.9577 -0.2877
-vn 0.7484 -0.4759 -0.4620
-vn 0.1302 -0.4712 -0.8724
-vn 0.5166 -0.8342 -0.1930
-vn 0.0145 -0.8236 -0.5669
-vn 0.2858 -0.9574 0.0418
-vn -0.1524 -0.9574 -0.2454
-vn 0.3253 -0.9443 0.0503
-vn -0.1760 -0.9443 -0.2781
-vn 0.6298 -0.4737 0.6156
-vn -0.4500 0.3333 -0.8285
-vn 0.3815 -0.6358 0.6710
-vn -0.7675 -0.6358 -0.0820
-vn 0.8323 -0.2265 -0.5059
-vn 0.2763 -0.0454 -0.9600
-vn -0.0417 0.9626 0.2678
-vn -0.2303 0.9658 0.1193
-vn 0.2078 0.9734 -0.0966
-vn 0.0056 0.9734 -0.2291
-vn 0.6783 0.5711 -0.4623
-vn 0.1531 0.5711 -0.8065
-vn 0.3698 0.9288 0.0251
-vn -0.1706 0.9288 -0.3291
-vn -0.2934 0.7955 0.5302
-vn -0.3690 0.7955 0.4807
-vn 0.4187 0.7696 0.4821
-vn -0.6092 0.7696 -0.1914
-vn 0.7012 0.6857 0.1951
-vn -0.4588 0.6857 -0.5651
-vn 0.9298 0.2517 -0.2687
-vn -0.2158 0.1364 -0.9669
-vn 0.6810 0.5704 -0.4592
-vn 0.1492 0.5704 -0.8077
-vn 0.6096 0.7624 0.2172
-vn -0.4425 0.7624 -0.4723
-vn 0.4968 0.6833 0.5350
-vn -0.6889 0.6833 -0.2420
-vn 0.2384 0.3830 0.8925
-vn -0.9134 0.3830 0.1377
-vn 0.3103 0.9434 0.1173
-vn -0.1481 0.8840 -0.4435
-vn -0.3349 0.5080 0.7936
-vn -0.6376 0.6237 0.4522
-vn 0.3832 0.1145 -0.9165
-vn 0.6874 0.1145 -0.7172
-vn -0.1181 0.9462 -0.3011
-vn 0.3232 0.9462 -0.0119
-vn 0.6292 0.2255 0.7438
-vn -0.4584 0.0893 -0.8842
-vn 0.7175 0.1241 0.6854
-vn -0.9149 0.1241 -0.3843
-vn 0.9317 0.1472 0.3320
-vn -0.6763 0.1472 -0.7217
-vn 0.8485 0.0893 0.5216
-vn -0.7179 -0.0304 -0.6955
-vn 0.4830 -0.7651 0.4259
-vn -0.6401 -0.6646 -0.3854
-vn 0.2648 -0.9244 0.2746
-vn -0.3578 -0.9243 -0.1332
-vn 0.3583 -0.8354 0.4168
-vn -0.5252 -0.8354 -0.1621
-vn -0.1787 -0.5237 0.8329
-vn -0.6923 -0.5237 0.4964
-vn 0.8687 -0.3290 -0.3703
-vn -0.0817 -0.3070 -0.9482
-vn 0.8749 -0.3343 -0.3505
-vn 0.0732 -0.2400 -0.9680
-vn 0.4579 -0.8341 -0.3076
-vn -0.2120 -0.8452 -0.4906
-vn 0.7699 -0.6154 0.1688
-vn -0.4314 -0.6610 -0.6140
-vn -0.1732 0.4867 0.8562
-vn -0.7935 0.2855 0.5375
-vn -0.0752 0.2593 0.9629
-vn -0.8528 0.2593 0.4533
-vn -0.3870 -0.0079 0.9220
-vn -0.7746 0.1993 0.6003
-vn -0.2779 -0.0758 0.9576
-vn -0.7078 -0.0836 0.7014
-vn 0.0610 -0.2198 0.9736
-vn -0.7977 0.0824 0.5974
-vn 0.1421 -0.1939 0.9707
-vn -0.9467 -0.1939 0.2572
-vn 0.0558 0.7506 0.6584
-vn -0.6259 0.7506 0.2117
-vn -0.4913 0.8296 0.2653
-vn -0.0471 0.8296 0.5563
-vn -0.9707 0.2366 0.0427
-vn 0.4631 0.2223 0.8579
-vn -0.8628 -0.3548 0.3602
-vn 0.0167 -0.3579 0.9336
-vn -0.0324 -0.5252 0.8504
-vn -0.7468 -0.5991 0.2888
-vn 0.2615 -0.4428 0.8576
-vn -0.8907 -0.4428 0.1026
-vn 0.4568 -0.7658 0.4527
-vn -0.4930 -0.6131 -0.6173
-vn -0.6955 0.2733 0.6645
-vn -0.3654 0.2923 0.8838
-vn 0.8548 -0.3869 0.3459
-vn -0.6584 -0.3869 -0.6457
-vn -0.3881 -0.0891 0.9173
-vn -0.6861 -0.0891 0.7220
-vn -0.4008 0.8972 0.1855
-vn -0.0101 0.8972 0.4415
-vn 0.2301 0.1689 0.9584
-vn -0.7988 -0.4480 0.4016
-vn 0.1082 0.5844 0.8042
-vn -0.7806 0.5844 0.2218
-vn 0.6711 -0.4075 0.6193
-vn -0.8041 -0.5534 0.2174
-vn 0.1442 -0.5217 0.8409
-vn -0.8943 -0.3122 0.3205
-vn 0.1042 -0.2571 0.9607
-vn -0.8063 -0.5533 0.2092
-vn 0.7301 -0.4788 0.4875
-vn -0.7384 -0.4788 -0.4748
-vn 0.8421 -0.4446 0.3052
-vn -0.7265 -0.3765 -0.5748
-vn 0.5910 -0.6363 0.4959
-vn -0.6906 -0.6363 -0.3439
-vn 0.5908 -0.5947 0.5452
-vn -0.7020 -0.6176 -0.3545
-vn 0.2674 0.9631 0.0313
-vn -0.1151 0.9921 -0.0507
-vn 0.6893 0.3469 0.6360
-vn -0.8466 0.3145 -0.4294
-vn 0.5914 -0.7071 0.3876
-vn -0.5914 -0.7071 -0.3876
-vn -0.0906 0.9898 0.1097
-vn -0.0644 0.9898 0.1269
-vn 0.3621 -0.7211 0.5906
-vn -0.6861 -0.7211 -0.0962
-vn 0.0433 -0.9022 0.4292
-vn -0.4108 -0.9022 0.1317
-vn -0.6542 -0.4853 -0.5801
-vn -0.4589 0.2328 -0.8575
-vn -0.0831 0.9939 -0.0731
-vn -0.0716 0.9899 0.1222
-vn -0.3944 0.0097 0.9189
-vn -0.6322 0.0392 0.7738
-vn -0.1527 0.0413 0.9874
-vn -0.7350 0.0852 0.6727
-vn -0.2482 -0.0461 0.9676
-vn -0.7881 -0.0461 0.6138
-vn -0.4414 0.0458 0.8962
-vn -0.7117 0.0124 0.7023
-vn 0.0362 0.1916 0.9808
-vn -0.9137 0.1916 0.3583
-vn -0.1410 -0.0320 0.9895
-vn -0.8236 -0.0364 0.5660
-vn -0.3133 0.0723 0.9469
-vn -0.7316 -0.1897 0.6548
-vn -0.4300 -0.0225 0.9026
-vn -0.6559 -0.0225 0.7545
-vn -0.5762 0.7454 0.3353
-vn 0.0641 0.6088 0.7907
-vn 0.0181 -0.1486 0.9887
-vn -0.9138 -0.1486 0.3781
-vn -0.0756 -0.1986 0.9772
-vn -0.8471 -0.2008 0.4921
-vn -0.2247 -0.4062 0.8857
-vn -0.9250 -0.1334 0.3559
-vn 0.0511 0.2164 0.9750
-vn -0.9143 0.2164 0.3424
-vn 0.1158 -0.9932 -0.0069
-vn -0.0399 -0.9932 -0.1090
-vn 0.4762 -0.8527 0.2149
-vn -0.3871 -0.8527 -0.3508
-vn 0.6186 -0.2460 0.7462
-vn -0.9224 -0.2541 -0.2907
-vn 0.6933 0.5627 0.4502
-vn -0.6754 0.5291 -0.5137
-vn -0.0065 0.9243 -0.3816
-vn 0.3276 0.9439 -0.0418
-vn -0.2407 0.8851 -0.3982
-vn 0.4247 0.8743 0.2351
-vn 0.0012 -0.0144 -0.9999
-vn 0.9059 -0.0030 -0.4234
-vn 0.3146 -0.0749 -0.9463
-vn 0.7421 -0.0749 -0.6661
-vn -0.6390 0.6786 -0.3623
-vn 0.6730 0.5901 0.4459
-vn 0.9609 -0.1711 -0.2177
-vn -0.1839 -0.1711 -0.9679
-vn -0.0663 -0.8283 -0.5564
-vn 0.5366 -0.8283 -0.1613
-vt 0.890955 0.590063
-vt 0.860081 0.560115
-vt 0.904571 0.559404
-vt 0.856226 0.850547
-vt 0.888398 0.821999
-vt 0.900640 0.853232
-vt 0.853018 0.521562
-vt 0.920166 0.524546
-vt 0.847458 0.888748
-vt 0.914672 0.888748
-vt 0.798481 0.569535
-vt 0.795104 0.838402
-vt 0.870622 0.589649
-vt 0.828900 0.590771
-vt 0.826436 0.818537
-vt 0.868067 0.821510
-vt 0.854402 0.604754
-vt 0.828171 0.633354
-vt 0.827598 0.775964
-vt 0.852534 0.805700
-vt 0.791018 0.645443
-vt 0.791018 0.762238
-vt 0.855181 0.668527
-vt 0.842358 0.702491
-vt 0.844839 0.707525
-vt 0.856142 0.742025
-vt 0.854107 0.625459
-vt 0.853157 0.785002
-vt 0.867508 0.642291
-vt 0.900375 0.666964
-vt 0.901223 0.745592
-vt 0.867293 0.768782
-vt 0.918898 0.699697
-vt 0.921180 0.713713
-vt 0.931889 0.636832
-vt 0.968392 0.645333
-vt 0.968213 0.770220
-vt 0.931368 0.777093
-vt 0.905882 0.627902
-vt 0.890474 0.641909
-vt 0.904990 0.784860
-vt 0.906232 0.605742
-vt 0.904357 0.807013
-vt 0.931250 0.820926
-vt 0.933717 0.593037
-vt 0.968392 0.573812
-vt 0.965038 0.841671
-vt 0.889591 0.593275
-vt 0.887178 0.818729
-vt 0.900583 0.804677
-vt 0.902359 0.607909
-vt 0.898822 0.786233
-vt 0.899781 0.626257
-vt 0.890219 0.770183
-vt 0.887351 0.775442
-vt 0.887842 0.636527
-vt 0.870376 0.775972
-vt 0.859881 0.623942
-vt 0.870908 0.635245
-vt 0.858859 0.786774
-vt 0.859664 0.608186
-vt 0.857942 0.802505
-vt 0.871664 0.593961
-vt 0.869299 0.817249
-vt 0.879400 0.616512
-vt 0.878029 0.795063
-vt 0.536419 0.062072
-vt 0.518916 0.050294
-vt 0.540260 0.053805
-vt 0.501452 0.062043
-vt 0.518925 0.059681
-vt 0.542788 0.064089
-vt 0.551930 0.058338
-vt 0.495083 0.064047
-vt 0.497626 0.053770
-vt 0.555073 0.061900
-vt 0.482805 0.061829
-vt 0.485955 0.058273
-vt 0.563812 0.076586
-vt 0.546290 0.072669
-vt 0.491565 0.072625
-vt 0.474014 0.076511
-vt 0.583135 0.108495
-vt 0.548333 0.084893
-vt 0.489507 0.084858
-vt 0.454527 0.108481
-vt 0.605512 0.165134
-vt 0.621513 0.227818
-vt 0.553118 0.209599
-vt 0.416514 0.229490
-vt 0.432024 0.165644
-vt 0.485339 0.210053
-vt 0.676379 0.233241
-vt 0.647395 0.200502
-vt 0.360308 0.235899
-vt 0.372747 0.256357
-vt 0.683908 0.279995
-vt 0.664761 0.253225
-vt 0.353696 0.284606
-vt 0.707254 0.310054
-vt 0.715342 0.265392
-vt 0.330721 0.316853
-vt 0.351187 0.317440
-vt 0.697446 0.332673
-vt 0.687515 0.311539
-vt 0.341964 0.339667
-vt 0.362723 0.329722
-vt 0.662817 0.372521
-vt 0.676824 0.323937
-vt 0.379297 0.378686
-vt 0.402772 0.362131
-vt 0.618316 0.375151
-vt 0.639050 0.357330
-vt 0.424583 0.379267
-vt 0.604826 0.397804
-vt 0.626842 0.395792
-vt 0.439252 0.401540
-vt 0.442396 0.381222
-vt 0.553095 0.390512
-vt 0.600808 0.377857
-vt 0.490934 0.391862
-vt 0.482938 0.358497
-vt 0.521923 0.386009
-vt 0.559674 0.357011
-vt 0.521086 0.343868
-vt 0.599845 0.344815
-vt 0.577279 0.340156
-vt 0.441977 0.347815
-vt 0.615546 0.342005
-vt 0.634472 0.332311
-vt 0.425972 0.345582
-vt 0.662406 0.312804
-vt 0.406362 0.336480
-vt 0.668440 0.297958
-vt 0.377061 0.317685
-vt 0.664101 0.277872
-vt 0.370304 0.302644
-vt 0.639236 0.253047
-vt 0.374100 0.281778
-vt 0.613992 0.242662
-vt 0.398938 0.255633
-vt 0.572941 0.258564
-vt 0.424464 0.244473
-vt 0.519760 0.248864
-vt 0.466409 0.259709
-vt 0.558527 0.316594
-vt 0.482619 0.317843
-vt 0.520277 0.294764
-vt 0.556923 0.291214
-vt 0.483433 0.292249
-vt 0.563905 0.272007
-vt 0.475886 0.273078
-vt 0.525483 0.068967
-vt 0.512375 0.068956
-vt 0.531231 0.073829
-vt 0.506626 0.073811
-vt 0.531019 0.087431
-vt 0.555621 0.121749
-vt 0.532669 0.090920
-vt 0.505177 0.090908
-vt 0.482177 0.121781
-vt 0.506827 0.087416
-vt 0.518981 0.151749
-vt 0.532042 0.127713
-vt 0.538112 0.158382
-vt 0.505828 0.127728
-vt 0.518941 0.128358
-vt 0.518925 0.093952
-vt 0.518927 0.085180
-vt 0.548362 0.173560
-vt 0.535214 0.166808
-vt 0.502799 0.166857
-vt 0.489683 0.173693
-vt 0.499851 0.158434
-vt 0.544281 0.193366
-vt 0.537959 0.175966
-vt 0.500100 0.176033
-vt 0.493996 0.193428
-vt 0.528757 0.191785
-vt 0.519841 0.200843
-vt 0.509219 0.191626
-vt 0.500890 0.187571
-vt 0.519132 0.185382
-vt 0.517577 0.190607
-vt 0.518998 0.159028
-vt 0.519016 0.165599
-vt 0.506910 0.171667
-vt 0.528222 0.186316
-vt 0.509787 0.186260
-vt 0.533528 0.184215
-vt 0.537248 0.187577
-vt 0.504547 0.184206
-vt 0.504604 0.176791
-vt 0.531131 0.171631
-vt 0.533449 0.176739
-vt 0.519099 0.179457
-vt 0.561572 0.167779
-vt 0.476363 0.167996
-vt 0.478371 0.149447
-vt 0.559475 0.149319
-vt 0.596138 0.133426
-vt 0.441395 0.133592
-vt 0.601169 0.147885
-vt 0.436337 0.148194
-vt 0.528933 0.084957
-vt 0.508915 0.084945
-vt 0.518925 0.083865
-vt 0.529036 0.075429
-vt 0.508820 0.075415
-vt 0.523751 0.070508
-vt 0.514106 0.070501
-vt 0.518928 0.067899
-vt 0.518929 0.069468
-vt 0.518928 0.074259
-vt 0.516297 0.074966
-vt 0.524236 0.076691
-vt 0.521560 0.074970
-vt 0.513619 0.076684
-vt 0.524601 0.079886
-vt 0.513252 0.079879
-vt 0.518926 0.079331
-vt 0.571787 0.277295
-vt 0.568351 0.292904
-vt 0.468070 0.278617
-vt 0.471978 0.294282
-vt 0.573085 0.311386
-vt 0.467790 0.313081
-vt 0.584855 0.327708
-vt 0.456477 0.329961
-vt 0.458737 0.268049
-vt 0.611720 0.255725
-vt 0.580734 0.266620
-vt 0.427062 0.257728
-vt 0.632494 0.262853
-vt 0.406068 0.265508
-vt 0.653658 0.279971
-vt 0.384904 0.283634
-vt 0.656064 0.297636
-vt 0.383015 0.301864
-vt 0.386858 0.314615
-vt 0.652752 0.310186
-vt 0.411556 0.327673
-vt 0.614408 0.331972
-vt 0.629040 0.323864
-vt 0.426727 0.335361
-vt 0.601033 0.333624
-vt 0.440344 0.336537
-vt 0.601799 0.328453
-vt 0.439372 0.331331
-vt 0.450408 0.323919
-vt 0.613335 0.327083
-vt 0.427623 0.330358
-vt 0.626851 0.320513
-vt 0.413648 0.324175
-vt 0.646248 0.306421
-vt 0.393381 0.310510
-vt 0.649541 0.296225
-vt 0.389662 0.300183
-vt 0.647785 0.283486
-vt 0.391040 0.287071
-vt 0.629829 0.267263
-vt 0.408893 0.269959
-vt 0.612641 0.261560
-vt 0.426254 0.263693
-vt 0.585166 0.270991
-vt 0.454369 0.272583
-vt 0.578124 0.281900
-vt 0.461798 0.283441
-vt 0.579548 0.309340
-vt 0.590644 0.321516
-vt 0.461204 0.311233
-vt 0.577524 0.293776
-vt 0.462754 0.295432
-vt 0.553209 0.433063
-vt 0.523031 0.433628
-vt 0.492809 0.434538
-vt 0.609819 0.431516
-vt 0.435860 0.435740
-vt 0.416915 0.400552
-vt 0.396518 0.425416
-vt 0.648174 0.419316
-vt 0.350292 0.396229
-vt 0.692106 0.388274
-vt 0.312756 0.350588
-vt 0.735879 0.312112
-vt 0.726332 0.341754
-vt 0.301067 0.320593
-vt 0.320452 0.270303
-vt 0.304876 0.261087
-vt 0.698172 0.216906
-vt 0.729900 0.256393
-vt 0.337414 0.219179
-vt 0.663103 0.190671
-vt 0.373474 0.191872
-vt 0.649444 0.022378
-vt 0.621440 0.048089
-vt 0.626908 0.015608
-vt 0.388827 0.021586
-vt 0.416419 0.047631
-vt 0.376796 0.075296
-vt 0.577206 0.032801
-vt 0.567460 0.000144
-vt 0.411318 0.015131
-vt 0.460782 0.032656
-vt 0.547413 0.041724
-vt 0.518922 0.024886
-vt 0.470636 0.000144
-vt 0.490511 0.041669
-vt 0.558059 0.053871
-vt 0.479842 0.053785
-vt 0.576951 0.057998
-vt 0.460920 0.057845
-vt 0.611687 0.078268
-vt 0.425932 0.077985
-vt 0.660451 0.076084
-vt 0.626663 0.111357
-vt 0.410618 0.111244
-vt 0.629482 0.130456
-vt 0.407648 0.130594
-vt 0.413741 0.147158
-vt 0.619303 0.159841
-vt 0.418035 0.160361
-vt 0.389677 0.201890
-vt 0.886245 0.121777
-vt 0.891780 0.036916
-vt 0.945900 0.079569
-vt 0.141314 0.112482
-vt 0.142277 0.021467
-vt 0.183115 0.092127
-vt 0.849114 0.099732
-vt 0.805584 0.010786
-vt 0.232648 0.003484
-vt 0.246353 0.076510
-vt 0.687018 0.077204
-vt 0.672384 0.022201
-vt 0.349875 0.075955
-vt 0.365979 0.020991
-vt 0.760215 0.193244
-vt 0.789046 0.233323
-vt 0.271553 0.193871
-vt 0.241255 0.236977
-vt 0.909112 0.183261
-vt 0.994525 0.167705
-vt 0.107928 0.179083
-vt 0.078961 0.060719
-vt 0.862868 0.338556
-vt 0.962901 0.344752
-vt 0.911671 0.402429
-vt 0.160557 0.356821
-vt 0.043968 0.367038
-vt 0.123776 0.315519
-vt 0.915360 0.259804
-vt 0.999856 0.254640
-vt 0.098965 0.266968
-vt 0.000144 0.259113
-vt 0.011829 0.155367
-vt 0.749542 0.334683
-vt 0.766337 0.300809
-vt 0.789162 0.313727
-vt 0.267408 0.310142
-vt 0.288183 0.346496
-vt 0.242992 0.325552
-vt 0.815314 0.276388
-vt 0.846174 0.293397
-vt 0.213065 0.285164
-vt 0.178537 0.304983
-vt 0.845007 0.256352
-vt 0.873517 0.265922
-vt 0.179662 0.263312
-vt 0.147089 0.274284
-vt 0.859075 0.228168
-vt 0.886999 0.233769
-vt 0.162803 0.231720
-vt 0.131514 0.237587
-vt 0.875030 0.184705
-vt 0.842355 0.195160
-vt 0.145224 0.182749
-vt 0.894128 0.301884
-vt 0.794286 0.364062
-vt 0.770185 0.379538
-vt 0.239776 0.382592
-vt 0.845499 0.449967
-vt 0.106400 0.432652
-vt 0.815858 0.445381
-vt 0.755700 0.418603
-vt 0.287033 0.442912
-vt 0.219260 0.477186
-vt 0.268122 0.398737
-vt 0.185281 0.484099
-vt 0.819845 0.468071
-vt 0.215894 0.503605
-vt 0.809631 0.233887
-vt 0.219168 0.237388
-vt 0.829287 0.219562
-vt 0.199067 0.222464
-vt 0.788458 0.080826
-vt 0.715482 0.139727
-vt 0.319538 0.139409
-vt 0.246666 0.114850
-vt 0.785486 0.152330
-vt 0.245969 0.151002
-vt 0.623495 0.146796
-vt 0.837382 0.156361
-vt 0.196622 0.155241
-vt 0.171653 0.132294
-vt 0.786480 0.117591
-vt 0.858171 0.137775
-vt 0.432388 0.894943
-vt 0.491058 0.881714
-vt 0.506166 0.904851
-vt 0.321637 0.893225
-vt 0.263032 0.878321
-vt 0.315867 0.868209
-vt 0.572792 0.860484
-vt 0.604825 0.879946
-vt 0.181486 0.854693
-vt 0.247207 0.901159
-vt 0.148729 0.873349
-vt 0.619962 0.791615
-vt 0.136063 0.784093
-vt 0.169745 0.787474
-vt 0.586396 0.793977
-vt 0.563786 0.739211
-vt 0.194086 0.733241
-vt 0.208656 0.740879
-vt 0.549027 0.746412
-vt 0.508270 0.697693
-vt 0.250811 0.693249
-vt 0.258399 0.707497
-vt 0.438641 0.680683
-vt 0.434803 0.658882
-vt 0.320962 0.677959
-vt 0.325318 0.656224
-vt 0.500314 0.711729
-vt 0.452955 0.700023
-vt 0.306136 0.696976
-vt 0.505666 0.730944
-vt 0.252524 0.726592
-vt 0.568148 0.787367
-vt 0.188269 0.781375
-vt 0.214575 0.750414
-vt 0.555495 0.826352
-vt 0.199850 0.820889
-vt 0.501231 0.844356
-vt 0.253846 0.840502
-vt 0.457832 0.840040
-vt 0.297562 0.837358
-vt 0.783193 0.187449
-vt 0.246955 0.187075
-vt 0.233625 0.175620
-vt 0.394766 0.686125
-vt 0.391039 0.611891
-vt 0.364838 0.684445
-vt 0.391747 0.862097
-vt 0.438797 0.870229
-vt 0.363377 0.861308
-vt 0.435018 0.718280
-vt 0.323658 0.715731
-vt 0.384658 0.710299
-vt 0.433669 0.729661
-vt 0.374400 0.708969
-vt 0.410995 0.747662
-vt 0.427812 0.742828
-vt 0.324726 0.727177
-vt 0.347028 0.745816
-vt 0.330270 0.740536
-vt 0.384657 0.795423
-vt 0.418086 0.784946
-vt 0.372270 0.794472
-vt 0.431333 0.817535
-vt 0.401605 0.841460
-vt 0.324790 0.815460
-vt 0.338952 0.783073
-vt 0.354026 0.840297
-vt 0.825107 0.209762
-vt 0.199767 0.214827
-vt 0.816266 0.203086
-vt 0.209828 0.206161
-vt 0.226485 0.183086
-vt 0.796021 0.176969
-vt 0.802192 0.184609
-vt 0.448505 0.804621
-vt 0.473386 0.824700
-vt 0.307886 0.802031
-vt 0.282357 0.821525
-vt 0.321237 0.777208
-vt 0.423718 0.754191
-vt 0.435868 0.779569
-vt 0.334089 0.752045
-vt 0.319919 0.747250
-vt 0.437950 0.749777
-vt 0.312907 0.729222
-vt 0.440995 0.724383
-vt 0.445392 0.731997
-vt 0.317510 0.721697
-vt 0.455277 0.713731
-vt 0.303460 0.710657
-vt 0.512485 0.828811
-vt 0.242975 0.824574
-vt 0.550942 0.811814
-vt 0.204839 0.806417
-vt 0.552139 0.787682
-vt 0.204331 0.782156
-vt 0.539407 0.764539
-vt 0.542850 0.755753
-vt 0.217774 0.759319
-vt 0.508439 0.743135
-vt 0.249419 0.738732
-vt 0.454776 0.761665
-vt 0.302729 0.758742
-vt 0.286960 0.745020
-vt 0.470841 0.748408
-vt 0.475403 0.783904
-vt 0.281439 0.780511
-vt 0.268291 0.766661
-vt 0.503673 0.787562
-vt 0.494476 0.802470
-vt 0.252972 0.783410
-vt 0.261790 0.798626
-vt 0.516802 0.807339
-vt 0.239243 0.802891
-vt 0.237920 0.787045
-vt 0.518562 0.791602
-vt 0.484068 0.628776
-vt 0.543385 0.683538
-vt 0.276936 0.625067
-vt 0.216123 0.678120
-vt 0.581052 0.726933
-vt 0.177176 0.720426
-vt 0.616701 0.759965
-vt 0.140379 0.752377
-vt 0.660647 0.741167
-vt 0.707492 0.759884
-vt 0.097038 0.732052
-vt 0.677256 0.670436
-vt 0.745511 0.652100
-vt 0.049526 0.748824
-vt 0.083564 0.662038
-vt 0.671403 0.592656
-vt 0.740843 0.572428
-vt 0.019409 0.639749
-vt 0.092820 0.589862
-vt 0.834705 0.206959
-vt 0.051216 0.522659
-vt 0.033664 0.564403
-vt 0.620420 0.565675
-vt 0.498072 0.552315
-vt 0.145041 0.562595
-vt 0.264218 0.550140
-vt 0.369913 0.610196
-vt 0.464579 0.342230
-vt 0.176788 0.196179
-vt 0.770572 0.444261
-vt 0.271364 0.473316
-vt 0.488870 0.770464
-vt 0.834578 0.206879
-s 0
-usemtl Material.001
-f 47/1/1 3/2/1 45/3/1
-f 4/4/2 48/5/2 46/6/2
-f 45/3/3 5/7/3 43/8/3
-f 6/9/4 46/6/4 44/10/4
-f 3/2/5 7/11/5 5/7/5
-f 8/12/6 4/4/6 6/9/6
-f 1/13/7 9/14/7 3/2/7
-f 10/15/8 2/16/8 4/4/8
-f 11/17/9 15/18/9 9/14/9
-f 16/19/10 12/20/10 10/15/10
-f 9/14/11 17/21/11 7/11/11
-f 18/22/12 10/15/12 8/12/12
-f 15/18/13 21/23/13 19/24/13 17/21/13
-f 20/25/14 22/26/14 16/19/14 18/22/14
-f 13/27/15 21/23/15 15/18/15
-f 22/26/16 14/28/16 16/19/16
-f 23/29/17 27/30/17 21/23/17
-f 28/31/18 24/32/18 22/26/18
-f 21/23/19 27/30/19 29/33/19 19/24/19
-f 30/34/20 28/31/20 22/26/20 20/25/20
-f 27/30/21 33/35/21 31/36/21 29/33/21
-f 32/37/22 34/38/22 28/31/22 30/34/22
-f 35/39/23 27/30/23 25/40/23
-f 36/41/24 28/31/24 34/38/24
-f 37/42/25 33/35/25 35/39/25
-f 38/43/26 34/38/26 40/44/26
-f 33/35/27 39/45/27 41/46/27 31/36/27
-f 42/47/28 40/44/28 34/38/28 32/37/28
-f 45/3/29 41/46/29 39/45/29
-f 46/6/30 42/47/30 44/10/30
-f 47/1/31 39/45/31 37/42/31
-f 48/5/32 40/44/32 46/6/32
-f 37/42/33 49/48/33 47/1/33
-f 38/43/34 50/49/34 52/50/34
-f 35/39/35 51/51/35 37/42/35
-f 36/41/36 52/50/36 54/52/36
-f 25/40/37 53/53/37 35/39/37
-f 26/54/38 54/52/38 56/55/38
-f 23/29/39 55/56/39 25/40/39
-f 24/32/40 56/55/40 58/57/40
-f 23/29/41 59/58/41 57/59/41
-f 60/60/42 24/32/42 58/57/42
-f 13/27/43 63/61/43 59/58/43
-f 64/62/44 12/20/44 14/28/44 60/60/44
-f 11/17/45 1/13/45 65/63/45 63/61/45
-f 66/64/46 2/16/46 12/20/46 64/62/46
-f 1/13/47 49/48/47 65/63/47
-f 50/49/48 2/16/48 66/64/48
-f 61/65/49 65/63/49 49/48/49
-f 50/49/50 66/64/50 62/66/50
-f 63/61/51 65/63/51 61/65/51
-f 62/66/52 66/64/52 64/62/52
-f 61/65/53 59/58/53 63/61/53
-f 64/62/54 60/60/54 62/66/54
-f 61/65/55 57/59/55 59/58/55
-f 60/60/56 58/57/56 62/66/56
-f 61/65/57 55/56/57 57/59/57
-f 58/57/58 56/55/58 62/66/58
-f 61/65/59 53/53/59 55/56/59
-f 56/55/60 54/52/60 62/66/60
-f 61/65/61 51/51/61 53/53/61
-f 54/52/62 52/50/62 62/66/62
-f 61/65/63 49/48/63 51/51/63
-f 52/50/64 50/49/64 62/66/64
-f 174/67/65 91/68/65 89/69/65
-f 175/70/66 91/68/66 176/71/66
-f 172/72/67 89/69/67 87/73/67
-f 173/74/68 90/75/68 175/70/68
-f 85/76/69 172/72/69 87/73/69
-f 173/74/70 86/77/70 88/78/70
-f 83/79/71 170/80/71 85/76/71
-f 171/81/72 84/82/72 86/77/72
-f 81/83/73 168/84/73 83/79/73
-f 169/85/74 82/86/74 84/82/74
-f 79/87/75 146/88/75 164/89/75
-f 147/90/76 80/91/76 165/92/76
-f 94/93/77 146/88/77 92/94/77
-f 95/95/78 147/90/78 149/96/78
-f 94/93/79 150/97/79 148/98/79
-f 151/99/80 95/95/80 149/96/80
-f 98/100/81 150/97/81 96/101/81
-f 99/102/82 151/99/82 153/103/82
-f 100/104/83 152/105/83 98/100/83
-f 101/106/84 153/103/84 155/107/84
-f 102/108/85 154/109/85 100/104/85
-f 103/110/86 155/107/86 157/111/86
-f 102/108/87 158/112/87 156/113/87
-f 159/114/88 103/110/88 157/111/88
-f 106/115/89 158/112/89 104/116/89
-f 107/117/90 159/114/90 161/118/90
-f 108/119/91 160/120/91 106/115/91
-f 109/121/92 161/118/92 163/122/92
-f 67/123/93 162/124/93 108/119/93
-f 67/123/94 163/122/94 68/125/94
-f 128/126/95 162/124/95 110/127/95
-f 129/128/96 163/122/96 161/118/96
-f 128/126/97 158/112/97 160/120/97
-f 159/114/98 129/128/98 161/118/98
-f 156/113/99 179/129/99 126/130/99
-f 157/111/100 180/131/100 159/114/100
-f 154/109/101 126/130/101 124/132/101
-f 155/107/102 127/133/102 157/111/102
-f 152/105/103 124/132/103 122/134/103
-f 153/103/104 125/135/104 155/107/104
-f 150/97/105 122/134/105 120/136/105
-f 151/99/106 123/137/106 153/103/106
-f 148/98/107 120/136/107 118/138/107
-f 149/96/108 121/139/108 151/99/108
-f 146/88/109 118/138/109 116/140/109
-f 147/90/110 119/141/110 149/96/110
-f 164/89/111 116/140/111 114/142/111
-f 165/92/112 117/143/112 147/90/112
-f 114/142/113 177/144/113 164/89/113
-f 177/144/114 115/145/114 165/92/114
-f 162/124/115 112/146/115 110/127/115
-f 163/122/116 113/147/116 68/125/116
-f 112/146/117 178/148/117 183/149/117
-f 178/148/118 113/147/118 184/150/118
-f 181/151/119 178/148/119 177/144/119
-f 182/152/120 178/148/120 184/150/120
-f 135/153/121 176/71/121 174/67/121
-f 176/71/122 136/154/122 175/70/122
-f 133/155/123 174/67/123 172/72/123
-f 175/70/124 134/156/124 173/74/124
-f 133/155/125 170/80/125 131/157/125
-f 134/156/126 171/81/126 173/74/126
-f 166/158/127 185/159/127 168/84/127
-f 186/160/128 167/161/128 169/85/128
-f 131/157/129 168/84/129 185/159/129
-f 169/85/130 132/162/130 186/160/130
-f 190/163/131 187/164/131 144/165/131
-f 190/163/132 188/166/132 189/167/132
-f 187/164/133 69/168/133 185/159/133
-f 188/166/134 69/168/134 189/167/134
-f 131/157/135 69/168/135 130/169/135
-f 132/162/135 69/168/135 186/160/135
-f 142/170/136 191/171/136 144/165/136
-f 192/172/137 143/173/137 145/174/137
-f 140/175/138 193/176/138 142/170/138
-f 194/177/139 141/178/139 143/173/139
-f 197/179/140 140/175/140 139/180/140
-f 198/181/141 141/178/141 196/182/141
-f 71/183/142 139/180/142 138/184/142
-f 71/183/143 139/180/143 198/181/143
-f 144/165/144 70/185/144 190/163/144
-f 145/174/145 70/185/145 192/172/145
-f 191/171/146 208/186/146 70/185/146
-f 192/172/147 208/186/147 207/187/147
-f 71/183/148 200/188/148 197/179/148
-f 201/189/149 71/183/149 198/181/149
-f 197/179/150 202/190/150 195/191/150
-f 203/192/151 198/181/151 196/182/151
-f 202/190/152 193/176/152 195/191/152
-f 203/192/153 194/177/153 205/193/153
-f 193/176/154 206/194/154 191/171/154
-f 207/187/155 194/177/155 192/172/155
-f 204/195/156 200/188/156 199/196/156
-f 205/193/157 201/189/157 203/192/157
-f 199/196/158 206/194/158 204/195/158
-f 207/187/159 199/196/159 205/193/159
-f 139/180/160 164/89/160 177/144/160
-f 165/92/161 139/180/161 177/144/161
-f 140/175/162 211/197/162 164/89/162
-f 212/198/163 141/178/163 165/92/163
-f 144/165/164 211/197/164 142/170/164
-f 145/174/165 212/198/165 214/199/165
-f 187/164/166 213/200/166 144/165/166
-f 188/166/167 214/199/167 167/161/167
-f 209/201/168 166/158/168 81/83/168
-f 210/202/169 167/161/169 214/199/169
-f 215/203/170 213/200/170 209/201/170
-f 216/204/171 214/199/171 212/198/171
-f 79/87/172 211/197/172 215/203/172
-f 212/198/173 80/91/173 216/204/173
-f 130/169/174 222/205/174 131/157/174
-f 130/169/175 223/206/175 72/207/175
-f 133/155/176 222/205/176 220/208/176
-f 223/206/177 134/156/177 221/209/177
-f 135/153/178 220/208/178 218/210/178
-f 221/209/179 136/154/179 219/211/179
-f 137/212/135 218/210/135 217/213/135
-f 219/211/135 137/212/135 217/213/135
-f 218/210/180 231/214/180 217/213/180
-f 219/211/181 231/214/181 230/215/181
-f 218/210/182 227/216/182 229/217/182
-f 228/218/183 219/211/183 230/215/183
-f 220/208/142 225/219/142 227/216/142
-f 226/220/184 221/209/184 228/218/184
-f 72/207/185 225/219/185 222/205/185
-f 72/207/186 226/220/186 224/221/186
-f 224/221/187 229/217/187 225/219/187
-f 230/215/188 224/221/188 226/220/188
-f 225/219/189 229/217/189 227/216/189
-f 228/218/190 230/215/190 226/220/190
-f 183/149/191 234/222/191 232/223/191
-f 235/224/192 184/150/192 233/225/192
-f 112/146/193 232/223/193 254/226/193
-f 233/225/194 113/147/194 255/227/194
-f 112/146/195 256/228/195 110/127/195
-f 113/147/196 257/229/196 255/227/196
-f 114/142/197 234/222/197 181/151/197
-f 115/145/198 235/224/198 253/230/198
-f 114/142/199 250/231/199 252/232/199
-f 251/233/200 115/145/200 253/230/200
-f 116/140/201 248/234/201 250/231/201
-f 249/235/202 117/143/202 251/233/202
-f 118/138/203 246/236/203 248/234/203
-f 247/237/204 119/141/204 249/235/204
-f 120/136/205 244/238/205 246/236/205
-f 245/239/206 121/139/206 247/237/206
-f 124/132/207 244/238/207 122/134/207
-f 125/135/208 245/239/208 243/240/208
-f 126/130/209 242/241/209 124/132/209
-f 127/133/210 243/240/210 241/242/210
-f 126/130/211 236/243/211 240/244/211
-f 237/245/212 127/133/212 241/242/212
-f 179/129/213 238/246/213 236/243/213
-f 239/247/214 180/131/214 237/245/214
-f 128/126/215 256/228/215 238/246/215
-f 257/229/216 129/128/216 239/247/216
-f 256/228/217 276/248/217 238/246/217
-f 257/229/218 277/249/218 259/250/218
-f 236/243/219 276/248/219 278/251/219
-f 277/249/220 237/245/220 279/252/220
-f 236/243/221 274/253/221 240/244/221
-f 237/245/222 275/254/222 279/252/222
-f 240/244/223 272/255/223 242/241/223
-f 241/242/224 273/256/224 275/254/224
-f 244/238/225 272/255/225 270/257/225
-f 273/256/226 245/239/226 271/258/226
-f 244/238/227 268/259/227 246/236/227
-f 245/239/228 269/260/228 271/258/228
-f 248/234/229 268/259/229 266/261/229
-f 269/260/230 249/235/230 267/262/230
-f 248/234/231 264/263/231 250/231/231
-f 249/235/232 265/264/232 267/262/232
-f 250/231/233 262/265/233 252/232/233
-f 251/233/234 263/266/234 265/264/234
-f 234/222/235 262/265/235 280/267/235
-f 263/266/236 235/224/236 281/268/236
-f 256/228/237 260/269/237 258/270/237
-f 261/271/238 257/229/238 259/250/238
-f 254/226/239 282/272/239 260/269/239
-f 283/273/240 255/227/240 261/271/240
-f 232/223/241 280/267/241 282/272/241
-f 281/268/242 233/225/242 283/273/242
-f 67/123/243 284/274/243 73/275/243
-f 285/276/244 67/123/244 73/275/244
-f 108/119/245 286/277/245 284/274/245
-f 287/278/246 109/121/246 285/276/246
-f 104/116/247 286/277/247 106/115/247
-f 105/279/248 287/278/248 289/280/248
-f 102/108/249 288/281/249 104/116/249
-f 103/110/250 289/280/250 291/282/250
-f 100/104/251 290/283/251 102/108/251
-f 101/106/252 291/282/252 293/284/252
-f 100/104/253 294/285/253 292/286/253
-f 295/287/254 101/106/254 293/284/254
-f 96/101/255 294/285/255 98/100/255
-f 97/288/256 295/287/256 297/289/256
-f 96/101/257 298/290/257 296/291/257
-f 299/292/258 97/288/258 297/289/258
-f 94/93/259 300/293/259 298/290/259
-f 301/294/260 95/95/260 299/292/260
-f 309/295/261 338/296/261 308/297/261
-f 309/298/262 339/299/262 329/300/262
-f 308/297/263 336/301/263 307/302/263
-f 308/303/264 337/304/264 339/299/264
-f 307/302/265 340/305/265 306/306/265
-f 307/307/266 341/308/266 337/304/266
-f 89/69/267 306/306/267 340/305/267
-f 306/306/268 90/75/268 341/308/268
-f 87/73/269 340/305/269 334/309/269
-f 341/308/270 88/78/270 335/310/270
-f 85/76/271 334/309/271 330/311/271
-f 335/310/272 86/77/272 331/312/272
-f 83/79/273 330/311/273 332/313/273
-f 331/312/274 84/82/274 333/314/274
-f 330/311/275 338/296/275 332/313/275
-f 339/299/276 331/312/276 333/314/276
-f 334/309/277 336/301/277 330/311/277
-f 335/310/278 337/304/278 341/308/278
-f 332/313/279 328/315/279 326/316/279
-f 333/314/280 329/300/280 339/299/280
-f 81/83/281 332/313/281 326/316/281
-f 333/314/282 82/86/282 327/317/282
-f 342/318/283 215/203/283 209/201/283
-f 343/319/284 216/204/284 345/320/284
-f 326/316/285 209/201/285 81/83/285
-f 327/317/286 210/202/286 343/319/286
-f 215/203/287 346/321/287 79/87/287
-f 216/204/288 347/322/288 345/320/288
-f 346/321/289 92/94/289 79/87/289
-f 347/322/290 93/323/290 301/294/290
-f 324/324/291 304/325/291 77/326/291
-f 325/327/292 304/328/292 353/329/292
-f 352/330/293 78/331/293 304/325/293
-f 353/329/294 78/332/294 351/333/294
-f 78/331/295 348/334/295 305/335/295
-f 349/336/296 78/332/296 305/337/296
-f 305/335/297 328/315/297 309/295/297
-f 329/300/298 305/337/298 309/298/298
-f 328/315/299 342/318/299 326/316/299
-f 329/300/300 343/319/300 349/336/300
-f 296/291/301 318/338/301 310/339/301
-f 319/340/302 297/289/302 311/341/302
-f 316/342/303 77/326/303 76/343/303
-f 317/344/304 77/345/304 325/327/304
-f 358/346/305 303/347/305 302/348/305
-f 359/349/306 303/350/306 357/351/306
-f 303/347/307 354/352/307 75/353/307
-f 355/354/308 303/350/308 75/355/308
-f 75/353/309 316/342/309 76/343/309
-f 317/344/310 75/355/310 76/356/310
-f 292/357/311 362/358/311 364/359/311
-f 363/360/312 293/361/312 365/362/312
-f 364/359/313 368/363/313 366/364/313
-f 369/365/314 365/362/314 367/366/314
-f 366/364/315 370/367/315 372/368/315
-f 371/369/316 367/366/316 373/370/316
-f 372/368/317 376/371/317 374/372/317
-f 377/373/318 373/370/318 375/374/318
-f 378/375/319 376/371/319 314/376/319
-f 379/377/320 377/373/320 375/374/320
-f 316/342/321 374/372/321 378/375/321
-f 375/374/322 317/344/322 379/377/322
-f 354/352/323 372/368/323 374/372/323
-f 373/370/324 355/354/324 375/374/324
-f 356/378/325 366/364/325 372/368/325
-f 367/366/326 357/351/326 373/370/326
-f 358/346/327 364/359/327 366/364/327
-f 365/362/328 359/349/328 367/366/328
-f 292/357/329 360/379/329 290/380/329
-f 293/361/330 361/381/330 365/362/330
-f 360/379/331 302/348/331 74/382/331
-f 361/381/332 302/383/332 359/349/332
-f 284/384/333 288/385/333 290/380/333
-f 289/386/334 285/387/334 291/388/334
-f 284/384/335 360/379/335 74/382/335
-f 361/381/336 285/387/336 74/389/336
-f 73/390/337 284/384/337 74/382/337
-f 74/389/338 285/387/338 73/391/338
-f 296/291/339 362/358/339 294/285/339
-f 297/289/340 363/360/340 311/341/340
-f 310/339/341 368/363/341 362/358/341
-f 369/365/342 311/341/342 363/360/342
-f 312/392/343 370/367/343 368/363/343
-f 371/369/344 313/393/344 369/365/344
-f 376/371/345 382/394/345 314/376/345
-f 377/373/346 383/395/346 371/369/346
-f 350/396/347 384/397/347 348/334/347
-f 351/333/348 385/398/348 387/399/348
-f 384/397/349 320/400/349 318/338/349
-f 385/398/350 321/401/350 387/399/350
-f 298/290/351 384/397/351 318/338/351
-f 385/398/352 299/292/352 319/340/352
-f 300/293/353 342/318/353 384/397/353
-f 343/319/354 301/294/354 385/398/354
-f 342/318/355 348/334/355 384/397/355
-f 385/398/356 349/336/356 343/319/356
-f 300/293/357 346/321/357 344/402/357
-f 345/320/358 347/322/358 301/294/358
-f 322/403/359 378/375/359 314/376/359
-f 323/404/360 379/377/360 381/405/360
-f 378/375/361 324/324/361 316/342/361
-f 379/377/362 325/327/362 381/405/362
-f 386/406/363 322/403/363 320/400/363
-f 387/399/364 323/404/364 381/405/364
-f 352/330/365 386/406/365 350/396/365
-f 353/329/366 387/399/366 381/405/366
-f 324/324/367 380/407/367 352/330/367
-f 353/329/368 381/405/368 325/327/368
-f 388/408/369 402/409/369 400/410/369
-f 389/411/370 403/412/370 415/413/370
-f 400/410/371 404/414/371 398/415/371
-f 405/416/372 401/417/372 399/418/372
-f 404/414/373 396/419/373 398/415/373
-f 405/416/374 397/420/374 407/421/374
-f 406/422/375 394/423/375 396/419/375
-f 407/421/376 395/424/376 409/425/376
-f 408/426/377 392/427/377 394/423/377
-f 409/425/378 393/428/378 411/429/378
-f 392/427/379 412/430/379 390/431/379
-f 413/432/380 393/428/380 391/433/380
-f 410/434/381 418/435/381 412/430/381
-f 419/436/382 411/429/382 413/432/382
-f 408/426/383 420/437/383 410/434/383
-f 421/438/384 409/425/384 411/429/384
-f 424/439/385 408/426/385 406/422/385
-f 425/440/386 409/425/386 423/441/386
-f 426/442/387 406/422/387 404/414/387
-f 427/443/388 407/421/388 425/440/388
-f 428/444/389 404/414/389 402/409/389
-f 429/445/390 405/416/390 427/443/390
-f 402/409/391 416/446/391 428/444/391
-f 417/447/392 403/412/392 429/445/392
-f 320/400/393 442/448/393 318/338/393
-f 321/401/394 443/449/394 445/450/394
-f 390/431/395 444/451/395 320/452/395
-f 391/433/396 445/453/396 413/432/396
-f 310/339/397 442/448/397 312/392/397
-f 443/449/398 311/341/398 313/393/398
-f 382/454/399 414/455/399 388/408/399
-f 415/413/400 383/456/400 389/411/400
-f 412/430/401 440/457/401 444/451/401
-f 441/458/402 413/432/402 445/453/402
-f 446/459/403 440/457/403 438/460/403
-f 447/461/404 441/458/404 445/453/404
-f 434/462/135 438/460/135 436/463/135
-f 439/464/135 435/465/135 437/466/135
-f 448/467/405 434/462/405 432/468/405
-f 449/469/406 435/465/406 447/461/406
-f 448/467/407 450/470/407 430/471/407
-f 449/469/408 451/472/408 433/473/408
-f 430/471/409 416/446/409 414/455/409
-f 431/474/410 417/447/410 451/472/410
-f 312/392/411 430/475/411 382/394/411
-f 431/476/412 313/393/412 383/395/412
-f 442/448/413 448/477/413 312/392/413
-f 443/449/414 449/478/414 447/479/414
-f 442/448/415 444/480/415 446/481/415
-f 447/479/416 445/450/416 443/449/416
-f 416/446/417 452/482/417 476/483/417
-f 453/484/418 417/447/418 477/485/418
-f 432/468/419 452/482/419 450/470/419
-f 433/473/420 453/484/420 463/486/420
-f 432/468/421 460/487/421 462/488/421
-f 461/489/422 433/473/422 463/486/422
-f 436/463/423 460/487/423 434/462/423
-f 437/466/424 461/489/424 459/490/424
-f 438/460/425 458/491/425 436/463/425
-f 439/464/426 459/490/426 457/492/426
-f 438/460/427 454/493/427 456/494/427
-f 455/495/428 439/464/428 457/492/428
-f 440/457/429 474/496/429 454/493/429
-f 475/497/429 441/458/429 455/495/429
-f 428/444/430 476/483/430 464/498/430
-f 477/485/431 429/445/431 465/499/431
-f 426/442/432 464/498/432 466/500/432
-f 465/499/433 427/443/433 467/501/433
-f 424/439/434 466/500/434 468/502/434
-f 467/501/435 427/443/435 425/440/435 469/503/435
-f 424/439/436 470/504/436 422/505/436
-f 469/503/437 425/440/437 423/441/437 471/506/437
-f 420/437/438 422/505/438 470/504/438 472/507/438
-f 471/506/439 423/441/439 421/438/439 473/508/439
-f 420/437/440 474/496/440 418/435/440
-f 421/438/441 475/497/441 473/508/441
-f 456/494/442 478/509/442 458/491/442
-f 457/492/443 479/510/443 481/511/443
-f 480/512/444 484/513/444 478/509/444
-f 481/511/445 485/514/445 483/515/445
-f 484/513/446 488/516/446 486/517/446
-f 489/518/447 485/514/447 487/519/447
-f 488/516/448 492/520/448 486/517/448
-f 489/518/449 493/521/449 491/522/449
-f 464/498/450 486/517/450 492/520/450
-f 487/519/451 465/499/451 493/521/451
-f 484/513/452 476/483/452 452/482/452
-f 485/514/453 477/485/453 487/519/453
-f 462/488/454 484/513/454 452/482/454
-f 463/486/455 485/514/455 479/510/455
-f 458/491/135 462/488/135 460/487/135
-f 463/486/135 459/490/135 461/489/135
-f 474/496/456 456/494/456 454/493/456
-f 475/497/457 457/492/457 481/511/457
-f 472/507/458 480/512/458 474/496/458
-f 481/511/459 473/508/459 475/497/459
-f 488/516/460 472/507/460 470/504/460
-f 489/518/461 473/508/461 483/515/461
-f 490/523/462 470/504/462 468/502/462
-f 491/522/463 471/506/463 489/518/463
-f 466/500/464 490/523/464 468/502/464
-f 491/522/465 467/501/465 469/503/465
-f 464/498/466 492/520/466 466/500/466
-f 467/501/467 493/521/467 465/499/467
-f 392/427/468 504/524/468 502/525/468
-f 505/526/469 393/428/469 503/527/469
-f 394/423/470 502/525/470 500/528/470
-f 503/527/471 395/424/471 501/529/471
-f 394/423/472 498/530/472 396/419/472
-f 395/424/473 499/531/473 501/529/473
-f 396/419/474 496/532/474 398/533/474
-f 397/420/475 497/534/475 499/531/475
-f 398/533/476 494/535/476 400/536/476
-f 399/537/477 495/538/477 497/534/477
-f 400/536/478 506/539/478 388/540/478
-f 401/541/479 507/542/479 495/538/479
-f 502/525/480 506/539/480 494/535/480
-f 503/527/481 507/542/481 505/526/481
-f 494/535/482 500/528/482 502/525/482
-f 501/529/483 495/538/483 503/527/483
-f 496/532/484 498/530/484 500/528/484
-f 501/529/485 499/531/485 497/534/485
-f 382/394/486 506/543/486 314/376/486
-f 383/544/487 507/542/487 389/545/487
-f 314/546/488 504/524/488 322/547/488
-f 505/526/489 315/548/489 323/549/489
-f 320/452/490 504/524/490 390/431/490
-f 505/526/491 321/550/491 391/433/491
-f 47/1/492 1/13/492 3/2/492
-f 4/4/493 2/16/493 48/5/493
-f 45/3/494 3/2/494 5/7/494
-f 6/9/495 4/4/495 46/6/495
-f 3/2/496 9/14/496 7/11/496
-f 8/12/497 10/15/497 4/4/497
-f 1/13/498 11/17/498 9/14/498
-f 10/15/499 12/20/499 2/16/499
-f 11/17/500 13/27/500 15/18/500
-f 16/19/501 14/28/501 12/20/501
-f 9/14/502 15/18/502 17/21/502
-f 18/22/503 16/19/503 10/15/503
-f 13/27/504 23/29/504 21/23/504
-f 22/26/505 24/32/505 14/28/505
-f 23/29/506 25/40/506 27/30/506
-f 28/31/507 26/54/507 24/32/507
-f 35/39/508 33/35/508 27/30/508
-f 36/41/509 26/54/509 28/31/509
-f 37/42/510 39/45/510 33/35/510
-f 38/43/511 36/41/511 34/38/511
-f 45/3/512 43/8/512 41/46/512
-f 46/6/513 40/44/513 42/47/513
-f 47/1/514 45/3/514 39/45/514
-f 48/5/515 38/43/515 40/44/515
-f 37/42/516 51/51/516 49/48/516
-f 38/43/517 48/5/517 50/49/517
-f 35/39/518 53/53/518 51/51/518
-f 36/41/519 38/43/519 52/50/519
-f 25/40/520 55/56/520 53/53/520
-f 26/54/521 36/41/521 54/52/521
-f 23/29/522 57/59/522 55/56/522
-f 24/32/523 26/54/523 56/55/523
-f 23/29/524 13/27/524 59/58/524
-f 60/60/525 14/28/525 24/32/525
-f 13/27/526 11/17/526 63/61/526
-f 1/13/527 47/1/527 49/48/527
-f 50/49/528 48/5/528 2/16/528
-f 174/67/529 176/71/529 91/68/529
-f 175/70/530 90/75/530 91/68/530
-f 172/72/531 174/67/531 89/69/531
-f 173/74/532 88/78/532 90/75/532
-f 85/76/533 170/80/533 172/72/533
-f 173/74/534 171/81/534 86/77/534
-f 83/79/535 168/84/535 170/80/535
-f 171/81/536 169/85/536 84/82/536
-f 81/83/537 166/158/537 168/84/537
-f 169/85/538 167/161/538 82/86/538
-f 79/87/539 92/94/539 146/88/539
-f 147/90/540 93/323/540 80/91/540
-f 94/93/541 148/98/541 146/88/541
-f 95/95/542 93/323/542 147/90/542
-f 94/93/543 96/101/543 150/97/543
-f 151/99/544 97/288/544 95/95/544
-f 98/100/545 152/105/545 150/97/545
-f 99/102/546 97/288/546 151/99/546
-f 100/104/547 154/109/547 152/105/547
-f 101/106/548 99/102/548 153/103/548
-f 102/108/549 156/113/549 154/109/549
-f 103/110/550 101/106/550 155/107/550
-f 102/108/551 104/116/551 158/112/551
-f 159/114/552 105/279/552 103/110/552
-f 106/115/553 160/120/553 158/112/553
-f 107/117/554 105/279/554 159/114/554
-f 108/119/555 162/124/555 160/120/555
-f 109/121/556 107/117/556 161/118/556
-f 67/123/557 68/125/557 162/124/557
-f 67/123/558 109/121/558 163/122/558
-f 128/126/559 160/120/559 162/124/559
-f 129/128/560 111/551/560 163/122/560
-f 128/126/561 179/129/561 158/112/561
-f 159/114/562 180/131/562 129/128/562
-f 156/113/563 158/112/563 179/129/563
-f 157/111/564 127/133/564 180/131/564
-f 154/109/565 156/113/565 126/130/565
-f 155/107/566 125/135/566 127/133/566
-f 152/105/567 154/109/567 124/132/567
-f 153/103/568 123/137/568 125/135/568
-f 150/97/569 152/105/569 122/134/569
-f 151/99/570 121/139/570 123/137/570
-f 148/98/571 150/97/571 120/136/571
-f 149/96/572 119/141/572 121/139/572
-f 146/88/573 148/98/573 118/138/573
-f 147/90/574 117/143/574 119/141/574
-f 164/89/575 146/88/575 116/140/575
-f 165/92/576 115/145/576 117/143/576
-f 114/142/577 181/151/577 177/144/577
-f 177/144/578 182/152/578 115/145/578
-f 162/124/579 68/125/579 112/146/579
-f 163/122/580 111/551/580 113/147/580
-f 112/146/581 68/125/581 178/148/581
-f 178/148/582 68/125/582 113/147/582
-f 181/151/583 183/149/583 178/148/583
-f 182/152/584 177/144/584 178/148/584
-f 135/153/585 137/212/585 176/71/585
-f 176/71/586 137/212/586 136/154/586
-f 133/155/587 135/153/587 174/67/587
-f 175/70/588 136/154/588 134/156/588
-f 133/155/589 172/72/589 170/80/589
-f 134/156/590 132/162/590 171/81/590
-f 166/158/591 187/164/591 185/159/591
-f 186/160/592 188/166/592 167/161/592
-f 131/157/593 170/80/593 168/84/593
-f 169/85/594 171/81/594 132/162/594
-f 190/163/132 189/167/132 187/164/132
-f 190/163/595 145/174/595 188/166/595
-f 187/164/134 189/167/134 69/168/134
-f 188/166/596 186/160/596 69/168/596
-f 131/157/135 185/159/135 69/168/135
-f 132/162/135 130/169/135 69/168/135
-f 142/170/597 193/176/597 191/171/597
-f 192/172/598 194/177/598 143/173/598
-f 140/175/599 195/191/599 193/176/599
-f 194/177/600 196/182/600 141/178/600
-f 197/179/601 195/191/601 140/175/601
-f 198/181/602 139/180/602 141/178/602
-f 71/183/603 197/179/603 139/180/603
-f 144/165/604 191/171/604 70/185/604
-f 145/174/605 190/163/605 70/185/605
-f 191/171/146 206/194/146 208/186/146
-f 192/172/147 70/185/147 208/186/147
-f 71/183/606 199/196/606 200/188/606
-f 201/189/607 199/196/607 71/183/607
-f 197/179/608 200/188/608 202/190/608
-f 203/192/609 201/189/609 198/181/609
-f 202/190/610 204/195/610 193/176/610
-f 203/192/611 196/182/611 194/177/611
-f 193/176/612 204/195/612 206/194/612
-f 207/187/613 205/193/613 194/177/613
-f 204/195/614 202/190/614 200/188/614
-f 205/193/615 199/196/615 201/189/615
-f 199/196/616 208/186/616 206/194/616
-f 207/187/617 208/186/617 199/196/617
-f 139/180/618 140/175/618 164/89/618
-f 165/92/619 141/178/619 139/180/619
-f 140/175/620 142/170/620 211/197/620
-f 212/198/621 143/173/621 141/178/621
-f 144/165/622 213/200/622 211/197/622
-f 145/174/623 143/173/623 212/198/623
-f 187/164/624 166/158/624 213/200/624
-f 188/166/625 145/174/625 214/199/625
-f 209/201/626 213/200/626 166/158/626
-f 210/202/627 82/86/627 167/161/627
-f 215/203/628 211/197/628 213/200/628
-f 216/204/629 210/202/629 214/199/629
-f 79/87/630 164/89/630 211/197/630
-f 212/198/631 165/92/631 80/91/631
-f 130/169/632 72/207/632 222/205/632
-f 130/169/633 132/162/633 223/206/633
-f 133/155/634 131/157/634 222/205/634
-f 223/206/635 132/162/635 134/156/635
-f 135/153/636 133/155/636 220/208/636
-f 221/209/637 134/156/637 136/154/637
-f 137/212/638 135/153/638 218/210/638
-f 219/211/639 136/154/639 137/212/639
-f 218/210/180 229/217/180 231/214/180
-f 219/211/181 217/213/181 231/214/181
-f 218/210/640 220/208/640 227/216/640
-f 228/218/641 221/209/641 219/211/641
-f 220/208/142 222/205/142 225/219/142
-f 226/220/184 223/206/184 221/209/184
-f 72/207/185 224/221/185 225/219/185
-f 72/207/186 223/206/186 226/220/186
-f 224/221/642 231/214/642 229/217/642
-f 230/215/643 231/214/643 224/221/643
-f 183/149/644 181/151/644 234/222/644
-f 235/224/645 182/152/645 184/150/645
-f 112/146/646 183/149/646 232/223/646
-f 233/225/647 184/150/647 113/147/647
-f 112/146/648 254/226/648 256/228/648
-f 113/147/649 111/551/649 257/229/649
-f 114/142/650 252/232/650 234/222/650
-f 115/145/651 182/152/651 235/224/651
-f 114/142/652 116/140/652 250/231/652
-f 251/233/653 117/143/653 115/145/653
-f 116/140/654 118/138/654 248/234/654
-f 249/235/655 119/141/655 117/143/655
-f 118/138/656 120/136/656 246/236/656
-f 247/237/657 121/139/657 119/141/657
-f 120/136/658 122/134/658 244/238/658
-f 245/239/659 123/137/659 121/139/659
-f 124/132/660 242/241/660 244/238/660
-f 125/135/661 123/137/661 245/239/661
-f 126/130/662 240/244/662 242/241/662
-f 127/133/663 125/135/663 243/240/663
-f 126/130/664 179/129/664 236/243/664
-f 237/245/665 180/131/665 127/133/665
-f 179/129/666 128/126/666 238/246/666
-f 239/247/667 129/128/667 180/131/667
-f 128/126/668 110/127/668 256/228/668
-f 257/229/669 111/551/669 129/128/669
-f 256/228/670 258/270/670 276/248/670
-f 257/229/671 239/247/671 277/249/671
-f 236/243/672 238/246/672 276/248/672
-f 277/249/673 239/247/673 237/245/673
-f 236/243/674 278/251/674 274/253/674
-f 237/245/675 241/242/675 275/254/675
-f 240/244/676 274/253/676 272/255/676
-f 241/242/677 243/240/677 273/256/677
-f 244/238/678 242/241/678 272/255/678
-f 273/256/679 243/240/679 245/239/679
-f 244/238/680 270/257/680 268/259/680
-f 245/239/681 247/237/681 269/260/681
-f 248/234/682 246/236/682 268/259/682
-f 269/260/683 247/237/683 249/235/683
-f 248/234/684 266/261/684 264/263/684
-f 249/235/685 251/233/685 265/264/685
-f 250/231/686 264/263/686 262/265/686
-f 251/233/687 253/230/687 263/266/687
-f 234/222/235 252/232/235 262/265/235
-f 263/266/236 253/230/236 235/224/236
-f 256/228/688 254/226/688 260/269/688
-f 261/271/689 255/227/689 257/229/689
-f 254/226/690 232/223/690 282/272/690
-f 283/273/691 233/225/691 255/227/691
-f 232/223/692 234/222/692 280/267/692
-f 281/268/693 235/224/693 233/225/693
-f 67/123/694 108/119/694 284/274/694
-f 285/276/695 109/121/695 67/123/695
-f 108/119/696 106/115/696 286/277/696
-f 287/278/697 107/117/697 109/121/697
-f 104/116/698 288/281/698 286/277/698
-f 105/279/699 107/117/699 287/278/699
-f 102/108/700 290/283/700 288/281/700
-f 103/110/701 105/279/701 289/280/701
-f 100/104/702 292/286/702 290/283/702
-f 101/106/703 103/110/703 291/282/703
-f 100/104/704 98/100/704 294/285/704
-f 295/287/705 99/102/705 101/106/705
-f 96/101/706 296/291/706 294/285/706
-f 97/288/707 99/102/707 295/287/707
-f 96/101/708 94/93/708 298/290/708
-f 299/292/709 95/95/709 97/288/709
-f 94/93/710 92/94/710 300/293/710
-f 301/294/711 93/323/711 95/95/711
-f 309/295/712 328/315/712 338/296/712
-f 309/298/713 308/303/713 339/299/713
-f 308/297/714 338/296/714 336/301/714
-f 308/303/715 307/307/715 337/304/715
-f 307/302/716 336/301/716 340/305/716
-f 307/307/717 306/306/717 341/308/717
-f 89/69/718 91/68/718 306/306/718
-f 306/306/719 91/68/719 90/75/719
-f 87/73/720 89/69/720 340/305/720
-f 341/308/721 90/75/721 88/78/721
-f 85/76/722 87/73/722 334/309/722
-f 335/310/723 88/78/723 86/77/723
-f 83/79/724 85/76/724 330/311/724
-f 331/312/725 86/77/725 84/82/725
-f 330/311/726 336/301/726 338/296/726
-f 339/299/727 337/304/727 331/312/727
-f 334/309/728 340/305/728 336/301/728
-f 335/310/729 331/312/729 337/304/729
-f 332/313/730 338/296/730 328/315/730
-f 333/314/731 327/317/731 329/300/731
-f 81/83/732 83/79/732 332/313/732
-f 333/314/733 84/82/733 82/86/733
-f 342/318/734 344/402/734 215/203/734
-f 343/319/735 210/202/735 216/204/735
-f 326/316/736 342/318/736 209/201/736
-f 327/317/737 82/86/737 210/202/737
-f 215/203/738 344/402/738 346/321/738
-f 216/204/739 80/91/739 347/322/739
-f 346/321/740 300/293/740 92/94/740
-f 347/322/741 80/91/741 93/323/741
-f 324/324/742 352/330/742 304/325/742
-f 325/327/743 77/345/743 304/328/743
-f 352/330/744 350/396/744 78/331/744
-f 353/329/745 304/328/745 78/332/745
-f 78/331/746 350/396/746 348/334/746
-f 349/336/747 351/333/747 78/332/747
-f 305/335/748 348/334/748 328/315/748
-f 329/300/749 349/336/749 305/337/749
-f 328/315/750 348/334/750 342/318/750
-f 329/300/751 327/317/751 343/319/751
-f 296/291/752 298/290/752 318/338/752
-f 319/340/753 299/292/753 297/289/753
-f 316/342/754 324/324/754 77/326/754
-f 317/344/755 76/356/755 77/345/755
-f 358/346/756 356/378/756 303/347/756
-f 359/349/757 302/383/757 303/350/757
-f 303/347/758 356/378/758 354/352/758
-f 355/354/759 357/351/759 303/350/759
-f 75/353/760 354/352/760 316/342/760
-f 317/344/761 355/354/761 75/355/761
-f 292/357/762 294/285/762 362/358/762
-f 363/360/763 295/287/763 293/361/763
-f 364/359/764 362/358/764 368/363/764
-f 369/365/765 363/360/765 365/362/765
-f 366/364/766 368/363/766 370/367/766
-f 371/369/767 369/365/767 367/366/767
-f 372/368/768 370/367/768 376/371/768
-f 377/373/769 371/369/769 373/370/769
-f 378/375/770 374/372/770 376/371/770
-f 379/377/771 315/552/771 377/373/771
-f 316/342/772 354/352/772 374/372/772
-f 375/374/773 355/354/773 317/344/773
-f 354/352/774 356/378/774 372/368/774
-f 373/370/775 357/351/775 355/354/775
-f 356/378/776 358/346/776 366/364/776
-f 367/366/777 359/349/777 357/351/777
-f 358/346/778 360/379/778 364/359/778
-f 365/362/779 361/381/779 359/349/779
-f 292/357/780 364/359/780 360/379/780
-f 293/361/781 291/388/781 361/381/781
-f 360/379/782 358/346/782 302/348/782
-f 361/381/783 74/389/783 302/383/783
-f 284/384/784 286/553/784 288/385/784
-f 289/386/785 287/554/785 285/387/785
-f 284/384/786 290/380/786 360/379/786
-f 361/381/787 291/388/787 285/387/787
-f 296/291/788 310/339/788 362/358/788
-f 297/289/789 295/287/789 363/360/789
-f 310/339/790 312/392/790 368/363/790
-f 369/365/791 313/393/791 311/341/791
-f 312/392/792 382/394/792 370/367/792
-f 371/369/793 383/395/793 313/393/793
-f 376/371/794 370/367/794 382/394/794
-f 377/373/795 315/552/795 383/395/795
-f 350/396/796 386/406/796 384/397/796
-f 351/333/797 349/336/797 385/398/797
-f 384/397/798 386/406/798 320/400/798
-f 385/398/799 319/340/799 321/401/799
-f 298/290/800 300/293/800 384/397/800
-f 385/398/801 301/294/801 299/292/801
-f 300/293/802 344/402/802 342/318/802
-f 343/319/803 345/320/803 301/294/803
-f 322/403/804 380/407/804 378/375/804
-f 323/404/805 315/552/805 379/377/805
-f 378/375/806 380/407/806 324/324/806
-f 379/377/807 317/344/807 325/327/807
-f 386/406/808 380/407/808 322/403/808
-f 387/399/809 321/401/809 323/404/809
-f 352/330/810 380/407/810 386/406/810
-f 353/329/811 351/333/811 387/399/811
-f 388/408/812 414/455/812 402/409/812
-f 389/411/813 401/417/813 403/412/813
-f 400/410/814 402/409/814 404/414/814
-f 405/416/815 403/412/815 401/417/815
-f 404/414/816 406/422/816 396/419/816
-f 405/416/817 399/418/817 397/420/817
-f 406/422/818 408/426/818 394/423/818
-f 407/421/819 397/420/819 395/424/819
-f 408/426/820 410/434/820 392/427/820
-f 409/425/821 395/424/821 393/428/821
-f 392/427/822 410/434/822 412/430/822
-f 413/432/823 411/429/823 393/428/823
-f 410/434/824 420/437/824 418/435/824
-f 419/436/825 421/438/825 411/429/825
-f 408/426/826 422/505/826 420/437/826
-f 421/438/827 423/441/827 409/425/827
-f 424/439/828 422/505/828 408/426/828
-f 425/440/829 407/421/829 409/425/829
-f 426/442/830 424/439/830 406/422/830
-f 427/443/831 405/416/831 407/421/831
-f 428/444/832 426/442/832 404/414/832
-f 429/445/833 403/412/833 405/416/833
-f 402/409/834 414/455/834 416/446/834
-f 417/447/835 415/413/835 403/412/835
-f 320/400/836 444/480/836 442/448/836
-f 321/401/837 319/340/837 443/449/837
-f 390/431/838 412/430/838 444/451/838
-f 391/433/839 321/550/839 445/453/839
-f 310/339/840 318/338/840 442/448/840
-f 443/449/841 319/340/841 311/341/841
-f 382/454/842 430/471/842 414/455/842
-f 415/413/843 431/474/843 383/456/843
-f 412/430/844 418/435/844 440/457/844
-f 441/458/845 419/436/845 413/432/845
-f 446/459/846 444/451/846 440/457/846
-f 447/461/847 439/464/847 441/458/847
-f 434/462/848 446/459/848 438/460/848
-f 439/464/849 447/461/849 435/465/849
-f 448/467/850 446/459/850 434/462/850
-f 449/469/851 433/473/851 435/465/851
-f 448/467/852 432/468/852 450/470/852
-f 449/469/853 431/474/853 451/472/853
-f 430/471/854 450/470/854 416/446/854
-f 431/474/855 415/413/855 417/447/855
-f 312/392/856 448/477/856 430/475/856
-f 431/476/857 449/478/857 313/393/857
-f 442/448/858 446/481/858 448/477/858
-f 443/449/859 313/393/859 449/478/859
-f 416/446/860 450/470/860 452/482/860
-f 453/484/861 451/472/861 417/447/861
-f 432/468/862 462/488/862 452/482/862
-f 433/473/863 451/472/863 453/484/863
-f 432/468/421 434/462/421 460/487/421
-f 461/489/422 435/465/422 433/473/422
-f 436/463/864 458/491/864 460/487/864
-f 437/466/865 435/465/865 461/489/865
-f 438/460/866 456/494/866 458/491/866
-f 439/464/867 437/466/867 459/490/867
-f 438/460/868 440/457/868 454/493/868
-f 455/495/869 441/458/869 439/464/869
-f 440/457/870 418/435/870 474/496/870
-f 475/497/871 419/436/871 441/458/871
-f 428/444/872 416/446/872 476/483/872
-f 477/485/873 417/447/873 429/445/873
-f 426/442/874 428/444/874 464/498/874
-f 465/499/875 429/445/875 427/443/875
-f 424/439/876 426/442/876 466/500/876
-f 424/439/877 468/502/877 470/504/877
-f 420/437/878 472/507/878 474/496/878
-f 421/438/879 419/436/879 475/497/879
-f 456/494/880 480/512/880 478/509/880
-f 457/492/881 459/490/881 479/510/881
-f 480/512/882 482/555/882 484/513/882
-f 481/511/883 479/510/883 485/514/883
-f 484/513/884 482/555/884 488/516/884
-f 489/518/885 483/515/885 485/514/885
-f 488/516/886 490/523/886 492/520/886
-f 489/518/887 487/519/887 493/521/887
-f 464/498/888 476/483/888 486/517/888
-f 487/519/889 477/485/889 465/499/889
-f 484/513/890 486/517/890 476/483/890
-f 485/514/891 453/484/891 477/485/891
-f 462/488/892 478/509/892 484/513/892
-f 463/486/893 453/484/893 485/514/893
-f 458/491/894 478/509/894 462/488/894
-f 463/486/895 479/510/895 459/490/895
-f 474/496/896 480/512/896 456/494/896
-f 475/497/897 455/495/897 457/492/897
-f 472/507/898 482/555/898 480/512/898
-f 481/511/899 483/515/899 473/508/899
-f 488/516/900 482/555/900 472/507/900
-f 489/518/901 471/506/901 473/508/901
-f 490/523/902 488/516/902 470/504/902
-f 491/522/903 469/503/903 471/506/903
-f 466/500/904 492/520/904 490/523/904
-f 491/522/905 493/521/905 467/501/905
-f 392/427/906 390/431/906 504/524/906
-f 505/526/907 391/433/907 393/428/907
-f 394/423/908 392/427/908 502/525/908
-f 503/527/909 393/428/909 395/424/909
-f 394/423/910 500/528/910 498/530/910
-f 395/424/911 397/420/911 499/531/911
-f 396/419/912 498/530/912 496/532/912
-f 397/420/913 399/537/913 497/534/913
-f 398/533/914 496/532/914 494/535/914
-f 399/537/915 401/541/915 495/538/915
-f 400/536/916 494/535/916 506/539/916
-f 401/541/917 389/545/917 507/542/917
-f 502/525/918 504/524/918 506/539/918
-f 503/527/919 495/538/919 507/542/919
-f 494/535/920 496/532/920 500/528/920
-f 501/529/921 497/534/921 495/538/921
-f 382/394/922 388/556/922 506/543/922
-f 383/544/923 315/548/923 507/542/923
-f 314/546/924 506/539/924 504/524/924
-f 505/526/925 507/542/925 315/548/925
-f 320/452/926 322/547/926 504/524/926
-f 505/526/927 323/549/927 321/550/927
-o Sphere
-v 0.666243 0.858657 -0.555570
-v 0.666243 0.683550 -0.831470
-v 0.666243 0.454762 -0.980785
-v 0.666243 0.330942 -1.000000
-v 0.666243 0.207123 -0.980785
-v 0.666243 -0.021666 -0.831470
-v 0.677534 0.953425 -0.191342
-v 0.688392 0.917308 -0.375330
-v 0.698398 0.858657 -0.544895
-v 0.707169 0.779727 -0.693520
-v 0.714367 0.683550 -0.815493
-v 0.719715 0.573823 -0.906127
-v 0.723009 0.454762 -0.961940
-v 0.724121 0.330942 -0.980785
-v 0.723009 0.207123 -0.961940
-v 0.719715 0.088062 -0.906127
-v 0.714367 -0.021666 -0.815493
-v 0.707169 -0.117842 -0.693520
-v 0.698398 -0.196773 -0.544895
-v 0.688392 -0.255423 -0.375330
-v 0.677534 -0.291540 -0.191342
-v 0.688392 0.953425 -0.180240
-v 0.709690 0.917308 -0.353553
-v 0.729318 0.858657 -0.513280
-v 0.746522 0.779727 -0.653281
-v 0.760641 0.683550 -0.768178
-v 0.771133 0.573823 -0.853553
-v 0.777593 0.454762 -0.906127
-v 0.779775 0.330942 -0.923879
-v 0.777593 0.207123 -0.906127
-v 0.771133 0.088062 -0.853553
-v 0.760641 -0.021666 -0.768178
-v 0.746522 -0.117842 -0.653281
-v 0.729318 -0.196773 -0.513280
-v 0.709690 -0.255423 -0.353553
-v 0.688392 -0.291540 -0.180240
-v 0.698398 0.953425 -0.162212
-v 0.729318 0.917308 -0.318190
-v 0.757814 0.858657 -0.461940
-v 0.782790 0.779727 -0.587938
-v 0.803288 0.683550 -0.691342
-v 0.818519 0.573823 -0.768178
-v 0.827899 0.454762 -0.815493
-v 0.831066 0.330942 -0.831469
-v 0.827899 0.207123 -0.815493
-v 0.818519 0.088062 -0.768178
-v 0.803288 -0.021666 -0.691342
-v 0.782790 -0.117842 -0.587938
-v 0.757814 -0.196773 -0.461940
-v 0.729318 -0.255423 -0.318190
-v 0.698398 -0.291540 -0.162212
-v 0.707169 0.953425 -0.137950
-v 0.746522 0.917308 -0.270598
-v 0.782790 0.858657 -0.392847
-v 0.814580 0.779727 -0.500000
-v 0.840668 0.683550 -0.587938
-v 0.860054 0.573823 -0.653281
-v 0.871992 0.454762 -0.693520
-v 0.876023 0.330942 -0.707107
-v 0.871992 0.207123 -0.693520
-v 0.860054 0.088062 -0.653281
-v 0.840668 -0.021666 -0.587938
-v 0.814580 -0.117842 -0.500000
-v 0.782790 -0.196773 -0.392847
-v 0.746522 -0.255423 -0.270598
-v 0.707169 -0.291540 -0.137950
-v 0.714367 0.953425 -0.108386
-v 0.760641 0.917308 -0.212608
-v 0.803288 0.858657 -0.308658
-v 0.840668 0.779727 -0.392847
-v 0.871346 0.683550 -0.461940
-v 0.894141 0.573823 -0.513280
-v 0.908178 0.454762 -0.544895
-v 0.912918 0.330942 -0.555570
-v 0.908178 0.207123 -0.544895
-v 0.894141 0.088062 -0.513280
-v 0.871346 -0.021666 -0.461940
-v 0.840668 -0.117842 -0.392847
-v 0.803288 -0.196773 -0.308658
-v 0.760641 -0.255423 -0.212608
-v 0.714367 -0.291540 -0.108386
-v 0.666243 0.965620 0.000000
-v 0.719715 0.953425 -0.074658
-v 0.771133 0.917308 -0.146447
-v 0.818519 0.858657 -0.212607
-v 0.860054 0.779727 -0.270598
-v 0.894141 0.683550 -0.318190
-v 0.919470 0.573823 -0.353553
-v 0.935067 0.454762 -0.375330
-v 0.940334 0.330942 -0.382683
-v 0.935067 0.207123 -0.375330
-v 0.919470 0.088062 -0.353553
-v 0.894141 -0.021666 -0.318190
-v 0.860054 -0.117842 -0.270598
-v 0.818519 -0.196773 -0.212607
-v 0.771133 -0.255423 -0.146447
-v 0.719715 -0.291540 -0.074658
-v 0.723009 0.953425 -0.038060
-v 0.777593 0.917308 -0.074658
-v 0.827899 0.858657 -0.108386
-v 0.871992 0.779727 -0.137950
-v 0.908178 0.683550 -0.162212
-v 0.935067 0.573823 -0.180240
-v 0.951625 0.454762 -0.191342
-v 0.957216 0.330942 -0.195090
-v 0.951625 0.207123 -0.191342
-v 0.935067 0.088062 -0.180240
-v 0.908178 -0.021666 -0.162212
-v 0.871992 -0.117842 -0.137950
-v 0.827899 -0.196773 -0.108386
-v 0.777593 -0.255423 -0.074658
-v 0.723009 -0.291540 -0.038060
-v 0.724121 0.953425 0.000000
-v 0.779775 0.917308 0.000000
-v 0.831066 0.858657 0.000000
-v 0.876023 0.779727 -0.000000
-v 0.912918 0.683550 0.000000
-v 0.940334 0.573823 -0.000000
-v 0.957216 0.454762 0.000000
-v 0.962916 0.330942 0.000000
-v 0.957216 0.207123 0.000000
-v 0.940334 0.088062 -0.000000
-v 0.912918 -0.021666 0.000000
-v 0.876023 -0.117842 -0.000000
-v 0.831066 -0.196773 0.000000
-v 0.779775 -0.255423 0.000000
-v 0.724121 -0.291540 0.000000
-v 0.723009 0.953425 0.038060
-v 0.777593 0.917308 0.074658
-v 0.827899 0.858657 0.108386
-v 0.871992 0.779727 0.137950
-v 0.908178 0.683550 0.162212
-v 0.935067 0.573823 0.180240
-v 0.951625 0.454762 0.191342
-v 0.957216 0.330942 0.195090
-v 0.951625 0.207123 0.191342
-v 0.935067 0.088062 0.180240
-v 0.908178 -0.021666 0.162212
-v 0.871992 -0.117842 0.137950
-v 0.827899 -0.196773 0.108386
-v 0.777593 -0.255423 0.074658
-v 0.723009 -0.291540 0.038060
-v 0.719715 0.953425 0.074658
-v 0.771133 0.917308 0.146447
-v 0.818519 0.858657 0.212608
-v 0.860054 0.779727 0.270598
-v 0.894141 0.683550 0.318190
-v 0.919470 0.573823 0.353553
-v 0.935067 0.454762 0.375330
-v 0.940333 0.330942 0.382683
-v 0.935067 0.207123 0.375330
-v 0.919470 0.088062 0.353553
-v 0.894141 -0.021666 0.318190
-v 0.860054 -0.117842 0.270598
-v 0.818519 -0.196773 0.212608
-v 0.771133 -0.255423 0.146447
-v 0.719715 -0.291540 0.074658
-v 0.714367 0.953425 0.108386
-v 0.760641 0.917308 0.212608
-v 0.803288 0.858657 0.308658
-v 0.840668 0.779727 0.392847
-v 0.871346 0.683550 0.461940
-v 0.894141 0.573823 0.513280
-v 0.908178 0.454762 0.544895
-v 0.912918 0.330942 0.555570
-v 0.908178 0.207123 0.544895
-v 0.894141 0.088062 0.513280
-v 0.871346 -0.021666 0.461940
-v 0.840668 -0.117842 0.392847
-v 0.803288 -0.196773 0.308658
-v 0.760641 -0.255423 0.212608
-v 0.714367 -0.291540 0.108386
-v 0.707169 0.953425 0.137950
-v 0.746522 0.917308 0.270598
-v 0.782790 0.858657 0.392847
-v 0.814580 0.779727 0.500000
-v 0.840668 0.683550 0.587938
-v 0.860054 0.573823 0.653281
-v 0.871992 0.454762 0.693520
-v 0.876023 0.330942 0.707107
-v 0.871992 0.207123 0.693520
-v 0.860054 0.088062 0.653281
-v 0.840668 -0.021666 0.587938
-v 0.814580 -0.117842 0.500000
-v 0.782790 -0.196773 0.392847
-v 0.746522 -0.255423 0.270598
-v 0.707169 -0.291540 0.137950
-v 0.698398 0.953425 0.162212
-v 0.729318 0.917308 0.318190
-v 0.757814 0.858657 0.461940
-v 0.782790 0.779727 0.587938
-v 0.803288 0.683550 0.691342
-v 0.818519 0.573823 0.768178
-v 0.827899 0.454762 0.815493
-v 0.831066 0.330942 0.831469
-v 0.827899 0.207123 0.815493
-v 0.818519 0.088062 0.768178
-v 0.803288 -0.021666 0.691342
-v 0.782790 -0.117842 0.587938
-v 0.757814 -0.196773 0.461940
-v 0.729318 -0.255423 0.318190
-v 0.698398 -0.291540 0.162212
-v 0.688392 0.953425 0.180240
-v 0.709690 0.917308 0.353553
-v 0.729318 0.858657 0.513280
-v 0.746522 0.779727 0.653281
-v 0.760641 0.683550 0.768178
-v 0.771133 0.573823 0.853553
-v 0.777593 0.454762 0.906127
-v 0.779775 0.330942 0.923879
-v 0.777593 0.207123 0.906127
-v 0.771133 0.088062 0.853553
-v 0.760641 -0.021666 0.768178
-v 0.746522 -0.117842 0.653281
-v 0.729318 -0.196773 0.513280
-v 0.709690 -0.255423 0.353553
-v 0.688392 -0.291540 0.180240
-v 0.677534 0.953425 0.191342
-v 0.688392 0.917308 0.375330
-v 0.698398 0.858657 0.544895
-v 0.707169 0.779727 0.693520
-v 0.714367 0.683550 0.815493
-v 0.719715 0.573823 0.906127
-v 0.723009 0.454762 0.961939
-v 0.724121 0.330942 0.980785
-v 0.723009 0.207123 0.961939
-v 0.719715 0.088062 0.906127
-v 0.714367 -0.021666 0.815493
-v 0.707169 -0.117842 0.693520
-v 0.698398 -0.196773 0.544895
-v 0.688392 -0.255423 0.375330
-v 0.677534 -0.291540 0.191342
-v 0.666243 0.953425 0.195090
-v 0.666243 0.917308 0.382683
-v 0.666243 0.858657 0.555570
-v 0.666243 0.779727 0.707107
-v 0.666243 0.683550 0.831469
-v 0.666243 0.573823 0.923879
-v 0.666243 0.454762 0.980785
-v 0.666243 0.330942 0.999999
-v 0.666243 0.207123 0.980785
-v 0.666243 0.088062 0.923879
-v 0.666243 -0.021666 0.831469
-v 0.666243 -0.117842 0.707107
-v 0.666243 -0.196773 0.555570
-v 0.666243 -0.255423 0.382683
-v 0.666243 -0.291540 0.195090
-v 0.654951 0.953425 0.191342
-v 0.644094 0.917308 0.375330
-v 0.634087 0.858657 0.544895
-v 0.625317 0.779727 0.693520
-v 0.618119 0.683550 0.815493
-v 0.612770 0.573823 0.906127
-v 0.609477 0.454762 0.961939
-v 0.608365 0.330942 0.980785
-v 0.609477 0.207123 0.961939
-v 0.612770 0.088062 0.906127
-v 0.618119 -0.021666 0.815493
-v 0.625317 -0.117842 0.693520
-v 0.634087 -0.196773 0.544895
-v 0.644094 -0.255423 0.375330
-v 0.654951 -0.291540 0.191342
-v 0.644094 0.953425 0.180240
-v 0.622796 0.917308 0.353553
-v 0.603168 0.858657 0.513280
-v 0.585964 0.779727 0.653281
-v 0.571844 0.683550 0.768177
-v 0.561353 0.573823 0.853553
-v 0.554892 0.454762 0.906127
-v 0.552711 0.330942 0.923879
-v 0.554892 0.207123 0.906127
-v 0.561353 0.088062 0.853553
-v 0.571844 -0.021666 0.768177
-v 0.585964 -0.117842 0.653281
-v 0.603168 -0.196773 0.513280
-v 0.622796 -0.255423 0.353553
-v 0.644094 -0.291540 0.180240
-v 0.634087 0.953425 0.162212
-v 0.603168 0.917308 0.318190
-v 0.574672 0.858657 0.461939
-v 0.549695 0.779727 0.587938
-v 0.529197 0.683550 0.691341
-v 0.513966 0.573823 0.768178
-v 0.504587 0.454762 0.815493
-v 0.501420 0.330942 0.831469
-v 0.504587 0.207123 0.815493
-v 0.513966 0.088062 0.768178
-v 0.529197 -0.021666 0.691341
-v 0.549695 -0.117842 0.587938
-v 0.574672 -0.196773 0.461939
-v 0.603168 -0.255423 0.318190
-v 0.634087 -0.291540 0.162212
-v 0.625317 0.953425 0.137950
-v 0.585964 0.917308 0.270598
-v 0.549695 0.858657 0.392847
-v 0.517906 0.779727 0.500000
-v 0.491817 0.683550 0.587937
-v 0.472431 0.573823 0.653281
-v 0.460494 0.454762 0.693520
-v 0.456463 0.330942 0.707106
-v 0.460494 0.207123 0.693520
-v 0.472431 0.088062 0.653281
-v 0.491817 -0.021666 0.587937
-v 0.517906 -0.117842 0.500000
-v 0.549695 -0.196773 0.392847
-v 0.585964 -0.255423 0.270598
-v 0.625317 -0.291540 0.137950
-v 0.666243 -0.303735 0.000000
-v 0.618119 0.953425 0.108386
-v 0.571844 0.917308 0.212607
-v 0.529198 0.858657 0.308658
-v 0.491817 0.779727 0.392847
-v 0.461140 0.683550 0.461939
-v 0.438345 0.573823 0.513280
-v 0.424308 0.454762 0.544895
-v 0.419568 0.330942 0.555569
-v 0.424308 0.207123 0.544895
-v 0.438345 0.088062 0.513280
-v 0.461140 -0.021666 0.461939
-v 0.491817 -0.117842 0.392847
-v 0.529198 -0.196773 0.308658
-v 0.571844 -0.255423 0.212607
-v 0.618119 -0.291540 0.108386
-v 0.612770 0.953425 0.074658
-v 0.561353 0.917308 0.146447
-v 0.513966 0.858657 0.212607
-v 0.472431 0.779727 0.270598
-v 0.438345 0.683550 0.318189
-v 0.413016 0.573823 0.353553
-v 0.397419 0.454762 0.375330
-v 0.392152 0.330942 0.382683
-v 0.397419 0.207123 0.375330
-v 0.413016 0.088062 0.353553
-v 0.438345 -0.021666 0.318189
-v 0.472431 -0.117842 0.270598
-v 0.513966 -0.196773 0.212607
-v 0.561353 -0.255423 0.146447
-v 0.612770 -0.291540 0.074658
-v 0.609477 0.953425 0.038060
-v 0.554892 0.917308 0.074658
-v 0.504587 0.858657 0.108386
-v 0.460494 0.779727 0.137950
-v 0.424308 0.683550 0.162211
-v 0.397419 0.573823 0.180240
-v 0.380861 0.454762 0.191341
-v 0.375270 0.330942 0.195090
-v 0.380861 0.207123 0.191341
-v 0.397419 0.088062 0.180240
-v 0.424308 -0.021666 0.162211
-v 0.460494 -0.117842 0.137950
-v 0.504587 -0.196773 0.108386
-v 0.554892 -0.255423 0.074658
-v 0.609477 -0.291540 0.038060
-v 0.608365 0.953425 -0.000000
-v 0.552711 0.917308 -0.000000
-v 0.501420 0.858657 -0.000000
-v 0.456463 0.779727 -0.000000
-v 0.419568 0.683550 -0.000000
-v 0.392152 0.573823 -0.000000
-v 0.375270 0.454762 -0.000000
-v 0.369569 0.330942 -0.000000
-v 0.375270 0.207123 -0.000000
-v 0.392152 0.088062 -0.000000
-v 0.419568 -0.021666 -0.000000
-v 0.456463 -0.117842 -0.000000
-v 0.501420 -0.196773 -0.000000
-v 0.552711 -0.255423 -0.000000
-v 0.608365 -0.291540 -0.000000
-v 0.609477 0.953425 -0.038060
-v 0.554892 0.917308 -0.074658
-v 0.504587 0.858657 -0.108386
-v 0.460494 0.779727 -0.137950
-v 0.424308 0.683550 -0.162212
-v 0.397419 0.573823 -0.180240
-v 0.380861 0.454762 -0.191342
-v 0.375270 0.330942 -0.195091
-v 0.380861 0.207123 -0.191342
-v 0.397419 0.088062 -0.180240
-v 0.424308 -0.021666 -0.162212
-v 0.460494 -0.117842 -0.137950
-v 0.504587 -0.196773 -0.108386
-v 0.554892 -0.255423 -0.074658
-v 0.609477 -0.291540 -0.038060
-v 0.612770 0.953425 -0.074658
-v 0.561353 0.917308 -0.146447
-v 0.513966 0.858657 -0.212607
-v 0.472431 0.779727 -0.270598
-v 0.438345 0.683550 -0.318190
-v 0.413016 0.573823 -0.353553
-v 0.397419 0.454762 -0.375330
-v 0.392152 0.330942 -0.382683
-v 0.397419 0.207123 -0.375330
-v 0.413016 0.088062 -0.353553
-v 0.438345 -0.021666 -0.318190
-v 0.472431 -0.117842 -0.270598
-v 0.513966 -0.196773 -0.212607
-v 0.561353 -0.255423 -0.146447
-v 0.612770 -0.291540 -0.074658
-v 0.618119 0.953425 -0.108386
-v 0.571844 0.917308 -0.212607
-v 0.529198 0.858657 -0.308658
-v 0.491817 0.779727 -0.392847
-v 0.461140 0.683550 -0.461940
-v 0.438345 0.573823 -0.513280
-v 0.424308 0.454762 -0.544895
-v 0.419568 0.330942 -0.555570
-v 0.424308 0.207123 -0.544895
-v 0.438345 0.088062 -0.513280
-v 0.461140 -0.021666 -0.461940
-v 0.491817 -0.117842 -0.392847
-v 0.529198 -0.196773 -0.308658
-v 0.571844 -0.255423 -0.212607
-v 0.618119 -0.291540 -0.108386
-v 0.625317 0.953425 -0.137950
-v 0.585964 0.917308 -0.270598
-v 0.549695 0.858657 -0.392847
-v 0.517906 0.779727 -0.500000
-v 0.491817 0.683550 -0.587938
-v 0.472431 0.573823 -0.653281
-v 0.460494 0.454762 -0.693520
-v 0.456463 0.330942 -0.707106
-v 0.460494 0.207123 -0.693520
-v 0.472431 0.088062 -0.653281
-v 0.491817 -0.021666 -0.587938
-v 0.517906 -0.117842 -0.500000
-v 0.549695 -0.196773 -0.392847
-v 0.585964 -0.255423 -0.270598
-v 0.625317 -0.291540 -0.137950
-v 0.634088 0.953425 -0.162212
-v 0.603168 0.917308 -0.318190
-v 0.574672 0.858657 -0.461939
-v 0.549695 0.779727 -0.587938
-v 0.529198 0.683550 -0.691341
-v 0.513966 0.573823 -0.768177
-v 0.504587 0.454762 -0.815493
-v 0.501420 0.330942 -0.831469
-v 0.504587 0.207123 -0.815493
-v 0.513966 0.088062 -0.768177
-v 0.529198 -0.021666 -0.691341
-v 0.549695 -0.117842 -0.587938
-v 0.574672 -0.196773 -0.461939
-v 0.603168 -0.255423 -0.318190
-v 0.634088 -0.291540 -0.162212
-v 0.644094 0.953425 -0.180240
-v 0.622796 0.917308 -0.353553
-v 0.603168 0.858657 -0.513279
-v 0.585964 0.779727 -0.653281
-v 0.571844 0.683550 -0.768177
-v 0.561353 0.573823 -0.853553
-v 0.554892 0.454762 -0.906127
-v 0.552711 0.330942 -0.923879
-v 0.554892 0.207123 -0.906127
-v 0.561353 0.088062 -0.853553
-v 0.571844 -0.021666 -0.768177
-v 0.585964 -0.117842 -0.653281
-v 0.603168 -0.196773 -0.513279
-v 0.622796 -0.255423 -0.353553
-v 0.644094 -0.291540 -0.180240
-v 0.654951 0.953425 -0.191342
-v 0.644094 0.917308 -0.375330
-v 0.634088 0.858657 -0.544895
-v 0.625317 0.779727 -0.693520
-v 0.618119 0.683550 -0.815493
-v 0.612770 0.573823 -0.906127
-v 0.609477 0.454762 -0.961939
-v 0.608365 0.330942 -0.980784
-v 0.609477 0.207123 -0.961939
-v 0.612770 0.088062 -0.906127
-v 0.618119 -0.021666 -0.815493
-v 0.625317 -0.117842 -0.693520
-v 0.634088 -0.196773 -0.544895
-v 0.644094 -0.255423 -0.375330
-v 0.654951 -0.291540 -0.191342
-v 0.666243 0.953425 -0.195090
-v 0.666243 0.917308 -0.382683
-v 0.666243 0.779727 -0.707107
-v 0.666243 0.573823 -0.923879
-v 0.666243 0.088062 -0.923879
-v 0.666243 -0.117842 -0.707107
-v 0.666243 -0.196773 -0.555570
-v 0.666243 -0.255423 -0.382683
-v 0.666243 -0.291540 -0.195090
-vn 0.2869 -0.4131 -0.8643
-vn 0.1061 0.9417 -0.3194
-vn 0.2461 -0.6244 -0.7414
-vn 0.1516 0.8767 -0.4566
-vn 0.1990 -0.7752 -0.5995
-vn 0.1990 0.7752 -0.5995
-vn 0.1516 -0.8767 -0.4566
-vn 0.2461 0.6244 -0.7414
-vn 0.1060 -0.9417 -0.3194
-vn 0.2869 0.4131 -0.8643
-vn 0.0626 -0.9800 -0.1887
-vn 0.3117 0.1457 -0.9389
-vn 0.0207 0.9978 -0.0624
-vn 0.0207 -0.9978 -0.0624
-vn 0.3117 -0.1457 -0.9389
-vn 0.0626 0.9800 -0.1887
-vn 0.0612 -0.9963 -0.0599
-vn 0.7104 -0.1121 -0.6948
-vn 0.1830 0.9667 -0.1790
-vn 0.6753 -0.3283 -0.6605
-vn 0.3023 0.9062 -0.2956
-vn 0.6097 -0.5222 -0.5963
-vn 0.4163 0.8130 -0.4072
-vn 0.5209 -0.6850 -0.5094
-vn 0.5209 0.6850 -0.5094
-vn 0.4163 -0.8130 -0.4072
-vn 0.6097 0.5222 -0.5963
-vn 0.3023 -0.9062 -0.2956
-vn 0.6753 0.3283 -0.6605
-vn 0.1830 -0.9667 -0.1790
-vn 0.7104 0.1121 -0.6948
-vn 0.0612 0.9963 -0.0599
-vn 0.6026 -0.7246 -0.3345
-vn 0.7940 0.4188 -0.4407
-vn 0.4605 -0.8501 -0.2556
-vn 0.8459 0.2532 -0.4695
-vn 0.2900 -0.9434 -0.1610
-vn 0.8712 0.0847 -0.4836
-vn 0.0992 0.9935 -0.0550
-vn 0.0992 -0.9935 -0.0550
-vn 0.8712 -0.0847 -0.4836
-vn 0.2900 0.9434 -0.1610
-vn 0.8459 -0.2532 -0.4695
-vn 0.4605 0.8501 -0.2556
-vn 0.7940 -0.4188 -0.4407
-vn 0.6026 0.7246 -0.3345
-vn 0.7136 -0.5779 -0.3961
-vn 0.7136 0.5779 -0.3961
-vn 0.3787 0.9154 -0.1369
-vn 0.9205 -0.2048 -0.3328
-vn 0.5761 0.7904 -0.2083
-vn 0.8824 -0.3459 -0.3190
-vn 0.7200 0.6433 -0.2603
-vn 0.8185 -0.4925 -0.2959
-vn 0.8185 0.4925 -0.2959
-vn 0.7200 -0.6433 -0.2603
-vn 0.8824 0.3459 -0.3190
-vn 0.5761 -0.7904 -0.2083
-vn 0.9205 0.2048 -0.3328
-vn 0.3787 -0.9154 -0.1369
-vn 0.9383 0.0678 -0.3392
-vn 0.1330 0.9900 -0.0481
-vn 0.1330 -0.9900 -0.0481
-vn 0.9383 -0.0678 -0.3392
-vn 0.9274 0.2983 -0.2258
-vn 0.6556 -0.7381 -0.1596
-vn 0.9567 0.1746 -0.2329
-vn 0.4474 -0.8877 -0.1089
-vn 0.9700 0.0575 -0.2362
-vn 0.1614 0.9861 -0.0393
-vn 0.1614 -0.9861 -0.0393
-vn 0.9700 -0.0575 -0.2362
-vn 0.4474 0.8877 -0.1089
-vn 0.9567 -0.1746 -0.2329
-vn 0.6556 0.7381 -0.1596
-vn 0.9274 -0.2983 -0.2258
-vn 0.7913 0.5803 -0.1927
-vn 0.8760 -0.4326 -0.2133
-vn 0.8760 0.4326 -0.2133
-vn 0.7913 -0.5803 -0.1927
-vn 0.9756 -0.1561 -0.1547
-vn 0.7073 0.6980 -0.1122
-vn 0.9515 -0.2683 -0.1509
-vn 0.8338 0.5359 -0.1322
-vn 0.9081 -0.3931 -0.1440
-vn 0.9081 0.3931 -0.1440
-vn 0.8338 -0.5359 -0.1322
-vn 0.9515 0.2683 -0.1509
-vn 0.7073 -0.6980 -0.1122
-vn 0.9756 0.1561 -0.1547
-vn 0.4970 -0.8642 -0.0788
-vn 0.9864 0.0512 -0.1564
-vn 0.1835 0.9826 -0.0291
-vn 0.1835 -0.9826 -0.0291
-vn 0.9864 -0.0512 -0.1564
-vn 0.4970 0.8642 -0.0788
-vn 0.7382 -0.6713 -0.0664
-vn 0.9854 0.1453 -0.0887
-vn 0.5288 -0.8474 -0.0476
-vn 0.9948 0.0476 -0.0895
-vn 0.1985 0.9799 -0.0179
-vn 0.1985 -0.9799 -0.0179
-vn 0.9948 -0.0476 -0.0895
-vn 0.5288 0.8474 -0.0476
-vn 0.9854 -0.1453 -0.0887
-vn 0.7382 0.6713 -0.0664
-vn 0.9642 -0.2505 -0.0868
-vn 0.8578 0.5081 -0.0772
-vn 0.9256 -0.3693 -0.0833
-vn 0.9256 0.3693 -0.0833
-vn 0.8578 -0.5081 -0.0772
-vn 0.9642 0.2505 -0.0868
-vn 0.7526 0.6581 -0.0220
-vn 0.9698 -0.2423 -0.0283
-vn 0.8687 0.4948 -0.0254
-vn 0.9333 -0.3580 -0.0273
-vn 0.9333 0.3580 -0.0273
-vn 0.8687 -0.4948 -0.0254
-vn 0.9698 0.2423 -0.0283
-vn 0.7526 -0.6581 -0.0220
-vn 0.9897 0.1403 -0.0289
-vn 0.5443 -0.8387 -0.0159
-vn 0.9985 0.0460 -0.0292
-vn 0.2062 0.9785 -0.0060
-vn 0.2062 -0.9785 -0.0060
-vn 0.9985 -0.0460 -0.0292
-vn 0.5443 0.8387 -0.0159
-vn 0.9897 -0.1403 -0.0289
-vn 0.9897 0.1403 0.0289
-vn 0.5443 -0.8387 0.0159
-vn 0.9985 0.0460 0.0292
-vn 0.2062 0.9785 0.0060
-vn 0.2062 -0.9785 0.0060
-vn 0.9985 -0.0460 0.0292
-vn 0.5443 0.8387 0.0159
-vn 0.9897 -0.1403 0.0289
-vn 0.7526 0.6581 0.0220
-vn 0.9698 -0.2423 0.0283
-vn 0.8687 0.4948 0.0254
-vn 0.9333 -0.3580 0.0273
-vn 0.9333 0.3580 0.0273
-vn 0.8687 -0.4948 0.0254
-vn 0.9698 0.2423 0.0283
-vn 0.7526 -0.6581 0.0220
-vn 0.9642 -0.2505 0.0868
-vn 0.8578 0.5081 0.0772
-vn 0.9256 -0.3693 0.0833
-vn 0.9256 0.3693 0.0833
-vn 0.8578 -0.5081 0.0772
-vn 0.9642 0.2505 0.0868
-vn 0.7382 -0.6713 0.0664
-vn 0.9854 0.1453 0.0887
-vn 0.5288 -0.8474 0.0476
-vn 0.9948 0.0476 0.0895
-vn 0.1985 0.9799 0.0179
-vn 0.1985 -0.9799 0.0179
-vn 0.9948 -0.0476 0.0895
-vn 0.5288 0.8474 0.0476
-vn 0.9854 -0.1453 0.0887
-vn 0.7382 0.6713 0.0664
-vn 0.4970 -0.8642 0.0788
-vn 0.9864 0.0512 0.1564
-vn 0.1835 0.9826 0.0291
-vn 0.1835 -0.9826 0.0291
-vn 0.9864 -0.0512 0.1564
-vn 0.4970 0.8642 0.0788
-vn 0.9756 -0.1561 0.1547
-vn 0.7073 0.6980 0.1122
-vn 0.9515 -0.2683 0.1509
-vn 0.8338 0.5359 0.1322
-vn 0.9081 -0.3931 0.1440
-vn 0.9081 0.3931 0.1440
-vn 0.8338 -0.5359 0.1322
-vn 0.9515 0.2683 0.1509
-vn 0.7073 -0.6980 0.1122
-vn 0.9756 0.1561 0.1547
-vn 0.8760 -0.4326 0.2133
-vn 0.8760 0.4326 0.2133
-vn 0.7913 -0.5803 0.1927
-vn 0.9274 0.2983 0.2258
-vn 0.6556 -0.7381 0.1596
-vn 0.9567 0.1746 0.2329
-vn 0.4474 -0.8877 0.1089
-vn 0.9700 0.0575 0.2362
-vn 0.1614 0.9861 0.0393
-vn 0.1614 -0.9861 0.0393
-vn 0.9700 -0.0575 0.2362
-vn 0.4474 0.8877 0.1089
-vn 0.9567 -0.1746 0.2329
-vn 0.6556 0.7381 0.1596
-vn 0.9274 -0.2983 0.2258
-vn 0.7913 0.5803 0.1927
-vn 0.1330 0.9900 0.0481
-vn 0.1330 -0.9900 0.0481
-vn 0.9383 -0.0678 0.3392
-vn 0.3787 0.9154 0.1369
-vn 0.9205 -0.2048 0.3328
-vn 0.5761 0.7904 0.2083
-vn 0.8824 -0.3459 0.3190
-vn 0.7200 0.6433 0.2603
-vn 0.8185 -0.4925 0.2959
-vn 0.8185 0.4925 0.2959
-vn 0.7200 -0.6433 0.2603
-vn 0.8824 0.3459 0.3190
-vn 0.5761 -0.7904 0.2083
-vn 0.9205 0.2048 0.3328
-vn 0.3787 -0.9154 0.1369
-vn 0.9383 0.0678 0.3392
-vn 0.7136 0.5779 0.3961
-vn 0.6026 -0.7246 0.3345
-vn 0.7940 0.4188 0.4407
-vn 0.4604 -0.8501 0.2556
-vn 0.8459 0.2532 0.4695
-vn 0.2900 -0.9434 0.1610
-vn 0.8712 0.0847 0.4836
-vn 0.0992 0.9935 0.0550
-vn 0.0992 -0.9935 0.0550
-vn 0.8712 -0.0847 0.4836
-vn 0.2900 0.9434 0.1610
-vn 0.8459 -0.2532 0.4695
-vn 0.4604 0.8501 0.2556
-vn 0.7940 -0.4188 0.4407
-vn 0.6026 0.7246 0.3345
-vn 0.7136 -0.5779 0.3961
-vn 0.7104 -0.1121 0.6948
-vn 0.1830 0.9667 0.1790
-vn 0.6753 -0.3283 0.6605
-vn 0.3023 0.9062 0.2956
-vn 0.6097 -0.5222 0.5963
-vn 0.4163 0.8130 0.4072
-vn 0.5209 -0.6850 0.5094
-vn 0.5209 0.6850 0.5094
-vn 0.4163 -0.8130 0.4072
-vn 0.6097 0.5222 0.5963
-vn 0.3023 -0.9062 0.2956
-vn 0.6753 0.3283 0.6605
-vn 0.1830 -0.9667 0.1790
-vn 0.7104 0.1121 0.6948
-vn 0.0612 0.9963 0.0599
-vn 0.0612 -0.9963 0.0599
-vn 0.1516 -0.8767 0.4566
-vn 0.2461 0.6244 0.7414
-vn 0.1061 -0.9417 0.3194
-vn 0.2869 0.4131 0.8643
-vn 0.0626 -0.9800 0.1887
-vn 0.3117 0.1457 0.9389
-vn 0.0207 0.9978 0.0624
-vn 0.0207 -0.9978 0.0624
-vn 0.3117 -0.1457 0.9389
-vn 0.0626 0.9800 0.1887
-vn 0.2869 -0.4131 0.8643
-vn 0.1061 0.9417 0.3194
-vn 0.2461 -0.6244 0.7414
-vn 0.1516 0.8767 0.4566
-vn 0.1990 -0.7752 0.5995
-vn 0.1990 0.7752 0.5995
-vn -0.0626 0.9800 0.1887
-vn -0.2869 -0.4131 0.8643
-vn -0.1061 0.9417 0.3194
-vn -0.2461 -0.6244 0.7414
-vn -0.1516 0.8767 0.4566
-vn -0.1990 -0.7752 0.5995
-vn -0.1990 0.7752 0.5995
-vn -0.1516 -0.8767 0.4566
-vn -0.2461 0.6244 0.7414
-vn -0.1061 -0.9417 0.3194
-vn -0.2869 0.4131 0.8643
-vn -0.0626 -0.9800 0.1887
-vn -0.3117 0.1457 0.9389
-vn -0.0207 0.9978 0.0624
-vn -0.0207 -0.9978 0.0624
-vn -0.3117 -0.1457 0.9389
-vn -0.6097 0.5222 0.5963
-vn -0.3023 -0.9062 0.2956
-vn -0.6753 0.3283 0.6604
-vn -0.1830 -0.9667 0.1790
-vn -0.7104 0.1121 0.6948
-vn -0.0612 0.9963 0.0599
-vn -0.0612 -0.9963 0.0599
-vn -0.7104 -0.1121 0.6948
-vn -0.1830 0.9667 0.1790
-vn -0.6753 -0.3283 0.6605
-vn -0.3023 0.9062 0.2956
-vn -0.6097 -0.5222 0.5963
-vn -0.4163 0.8130 0.4072
-vn -0.5209 -0.6850 0.5094
-vn -0.5209 0.6850 0.5094
-vn -0.4163 -0.8130 0.4072
-vn -0.8459 -0.2532 0.4695
-vn -0.4605 0.8501 0.2556
-vn -0.7940 -0.4188 0.4407
-vn -0.6026 0.7246 0.3345
-vn -0.7136 -0.5779 0.3961
-vn -0.7136 0.5779 0.3961
-vn -0.6026 -0.7246 0.3345
-vn -0.7940 0.4188 0.4407
-vn -0.4605 -0.8501 0.2556
-vn -0.8459 0.2532 0.4695
-vn -0.2900 -0.9434 0.1610
-vn -0.8712 0.0847 0.4836
-vn -0.0992 0.9935 0.0550
-vn -0.0992 -0.9935 0.0550
-vn -0.8712 -0.0847 0.4836
-vn -0.2900 0.9434 0.1610
-vn -0.5761 -0.7904 0.2083
-vn -0.9205 0.2048 0.3328
-vn -0.3787 -0.9154 0.1369
-vn -0.9383 0.0678 0.3392
-vn -0.1330 0.9900 0.0481
-vn -0.1330 -0.9900 0.0481
-vn -0.9383 -0.0678 0.3392
-vn -0.3787 0.9154 0.1369
-vn -0.9205 -0.2048 0.3328
-vn -0.5761 0.7904 0.2083
-vn -0.8824 -0.3459 0.3190
-vn -0.7200 0.6433 0.2603
-vn -0.8185 -0.4925 0.2959
-vn -0.8185 0.4925 0.2959
-vn -0.7200 -0.6433 0.2603
-vn -0.8824 0.3459 0.3190
-vn -0.9274 -0.2983 0.2258
-vn -0.7913 0.5803 0.1927
-vn -0.8760 -0.4326 0.2133
-vn -0.8760 0.4326 0.2133
-vn -0.7913 -0.5803 0.1927
-vn -0.9274 0.2983 0.2258
-vn -0.6556 -0.7381 0.1596
-vn -0.9567 0.1746 0.2329
-vn -0.4474 -0.8877 0.1089
-vn -0.9700 0.0575 0.2362
-vn -0.1614 0.9861 0.0393
-vn -0.1614 -0.9861 0.0393
-vn -0.9700 -0.0575 0.2362
-vn -0.4474 0.8877 0.1089
-vn -0.9567 -0.1746 0.2329
-vn -0.6556 0.7381 0.1596
-vn -0.4970 -0.8642 0.0788
-vn -0.9864 0.0512 0.1564
-vn -0.1835 0.9826 0.0291
-vn -0.1835 -0.9826 0.0291
-vn -0.9864 -0.0512 0.1564
-vn -0.4970 0.8642 0.0788
-vn -0.9756 -0.1561 0.1547
-vn -0.7073 0.6980 0.1122
-vn -0.9515 -0.2683 0.1509
-vn -0.8338 0.5359 0.1322
-vn -0.9081 -0.3931 0.1440
-vn -0.9081 0.3931 0.1440
-vn -0.8338 -0.5359 0.1322
-vn -0.9515 0.2683 0.1509
-vn -0.7073 -0.6980 0.1122
-vn -0.9756 0.1561 0.1547
-vn -0.8578 0.5081 0.0772
-vn -0.9256 -0.3693 0.0833
-vn -0.9256 0.3693 0.0833
-vn -0.8578 -0.5081 0.0772
-vn -0.9642 0.2505 0.0868
-vn -0.7382 -0.6713 0.0664
-vn -0.9854 0.1453 0.0887
-vn -0.5288 -0.8474 0.0476
-vn -0.9948 0.0476 0.0895
-vn -0.1985 0.9799 0.0179
-vn -0.1985 -0.9799 0.0179
-vn -0.9948 -0.0476 0.0895
-vn -0.5288 0.8474 0.0476
-vn -0.9854 -0.1453 0.0887
-vn -0.7382 0.6713 0.0664
-vn -0.9642 -0.2505 0.0868
-vn -0.9985 0.0460 0.0292
-vn -0.2062 0.9785 0.0060
-vn -0.2062 -0.9785 0.0060
-vn -0.9985 -0.0460 0.0292
-vn -0.5443 0.8387 0.0159
-vn -0.9897 -0.1403 0.0289
-vn -0.7526 0.6581 0.0220
-vn -0.9698 -0.2423 0.0283
-vn -0.8687 0.4948 0.0254
-vn -0.9333 -0.3580 0.0273
-vn -0.9333 0.3580 0.0273
-vn -0.8687 -0.4948 0.0254
-vn -0.9698 0.2423 0.0283
-vn -0.7526 -0.6581 0.0220
-vn -0.9897 0.1403 0.0289
-vn -0.5443 -0.8387 0.0159
-vn -0.9333 -0.3580 -0.0273
-vn -0.9333 0.3580 -0.0273
-vn -0.8687 -0.4948 -0.0254
-vn -0.9698 0.2423 -0.0283
-vn -0.7526 -0.6581 -0.0220
-vn -0.9897 0.1403 -0.0289
-vn -0.5443 -0.8387 -0.0159
-vn -0.9985 0.0460 -0.0292
-vn -0.2062 0.9785 -0.0060
-vn -0.2062 -0.9785 -0.0060
-vn -0.9985 -0.0460 -0.0292
-vn -0.5443 0.8387 -0.0159
-vn -0.9897 -0.1403 -0.0289
-vn -0.7526 0.6581 -0.0220
-vn -0.9698 -0.2423 -0.0283
-vn -0.8687 0.4948 -0.0254
-vn -0.1985 0.9799 -0.0179
-vn -0.1985 -0.9799 -0.0179
-vn -0.9948 -0.0476 -0.0895
-vn -0.5288 0.8474 -0.0476
-vn -0.9854 -0.1453 -0.0887
-vn -0.7382 0.6713 -0.0664
-vn -0.9642 -0.2505 -0.0868
-vn -0.8578 0.5081 -0.0772
-vn -0.9256 -0.3693 -0.0833
-vn -0.9256 0.3693 -0.0833
-vn -0.8578 -0.5081 -0.0772
-vn -0.9642 0.2505 -0.0868
-vn -0.7382 -0.6713 -0.0664
-vn -0.9854 0.1453 -0.0887
-vn -0.5288 -0.8474 -0.0476
-vn -0.9948 0.0476 -0.0895
-vn -0.9081 0.3931 -0.1440
-vn -0.8338 -0.5359 -0.1322
-vn -0.9515 0.2683 -0.1509
-vn -0.7073 -0.6980 -0.1122
-vn -0.9756 0.1561 -0.1547
-vn -0.4970 -0.8642 -0.0788
-vn -0.9864 0.0512 -0.1564
-vn -0.1835 0.9826 -0.0291
-vn -0.1835 -0.9826 -0.0291
-vn -0.9864 -0.0512 -0.1564
-vn -0.4970 0.8642 -0.0788
-vn -0.9756 -0.1561 -0.1547
-vn -0.7073 0.6980 -0.1122
-vn -0.9515 -0.2683 -0.1509
-vn -0.8338 0.5359 -0.1322
-vn -0.9081 -0.3931 -0.1440
-vn -0.9700 -0.0575 -0.2362
-vn -0.4474 0.8877 -0.1089
-vn -0.9567 -0.1746 -0.2329
-vn -0.6556 0.7381 -0.1596
-vn -0.9274 -0.2983 -0.2258
-vn -0.7913 0.5803 -0.1927
-vn -0.8760 -0.4326 -0.2133
-vn -0.8760 0.4326 -0.2133
-vn -0.7913 -0.5803 -0.1927
-vn -0.9274 0.2983 -0.2258
-vn -0.6556 -0.7381 -0.1596
-vn -0.9567 0.1746 -0.2329
-vn -0.4474 -0.8877 -0.1089
-vn -0.9700 0.0575 -0.2362
-vn -0.1614 0.9861 -0.0393
-vn -0.1614 -0.9861 -0.0393
-vn -0.7200 -0.6433 -0.2603
-vn -0.8824 0.3459 -0.3190
-vn -0.5761 -0.7904 -0.2083
-vn -0.9205 0.2048 -0.3328
-vn -0.3787 -0.9154 -0.1369
-vn -0.9383 0.0678 -0.3392
-vn -0.1330 0.9900 -0.0481
-vn -0.1330 -0.9900 -0.0481
-vn -0.9383 -0.0678 -0.3392
-vn -0.3787 0.9154 -0.1369
-vn -0.9205 -0.2048 -0.3328
-vn -0.5761 0.7904 -0.2083
-vn -0.8824 -0.3459 -0.3190
-vn -0.7200 0.6433 -0.2603
-vn -0.8185 -0.4925 -0.2959
-vn -0.8185 0.4925 -0.2959
-vn -0.8459 -0.2532 -0.4695
-vn -0.4605 0.8501 -0.2556
-vn -0.7940 -0.4188 -0.4407
-vn -0.6026 0.7246 -0.3345
-vn -0.7136 -0.5779 -0.3961
-vn -0.7136 0.5779 -0.3961
-vn -0.6026 -0.7246 -0.3345
-vn -0.7940 0.4188 -0.4407
-vn -0.4605 -0.8501 -0.2556
-vn -0.8459 0.2532 -0.4695
-vn -0.2900 -0.9434 -0.1610
-vn -0.8712 0.0847 -0.4836
-vn -0.0992 0.9935 -0.0550
-vn -0.0992 -0.9935 -0.0550
-vn -0.8712 -0.0847 -0.4836
-vn -0.2900 0.9434 -0.1610
-vn -0.3023 -0.9062 -0.2956
-vn -0.6753 0.3283 -0.6605
-vn -0.1830 -0.9667 -0.1790
-vn -0.7104 0.1121 -0.6948
-vn -0.0612 0.9963 -0.0599
-vn -0.0612 -0.9963 -0.0599
-vn -0.7104 -0.1121 -0.6948
-vn -0.1830 0.9667 -0.1790
-vn -0.6753 -0.3283 -0.6605
-vn -0.3023 0.9062 -0.2956
-vn -0.6097 -0.5222 -0.5963
-vn -0.4163 0.8130 -0.4072
-vn -0.5209 -0.6850 -0.5094
-vn -0.5209 0.6850 -0.5094
-vn -0.4163 -0.8130 -0.4072
-vn -0.6097 0.5222 -0.5963
-vn -0.1061 0.9417 -0.3194
-vn -0.2461 -0.6244 -0.7414
-vn -0.1516 0.8767 -0.4566
-vn -0.1990 -0.7752 -0.5995
-vn -0.1990 0.7752 -0.5995
-vn -0.1516 -0.8767 -0.4566
-vn -0.2461 0.6244 -0.7414
-vn -0.1061 -0.9417 -0.3194
-vn -0.2869 0.4131 -0.8643
-vn -0.0626 -0.9800 -0.1887
-vn -0.3117 0.1457 -0.9389
-vn -0.0207 0.9978 -0.0624
-vn -0.0207 -0.9978 -0.0624
-vn -0.3117 -0.1457 -0.9389
-vn -0.0626 0.9800 -0.1887
-vn -0.2869 -0.4131 -0.8643
-vn 0.1060 0.9417 -0.3194
-vn 0.4604 0.8501 -0.2556
-vn 0.4605 -0.8501 0.2556
-vn -0.1060 -0.9417 0.3194
-vn -0.6753 0.3283 0.6605
-vn -0.6753 -0.3283 0.6604
-vt 0.750000 0.437500
-vt 0.718750 0.375000
-vt 0.750000 0.375000
-vt 0.750000 0.812500
-vt 0.718750 0.875000
-vt 0.718750 0.812500
-vt 0.718750 0.312500
-vt 0.750000 0.312500
-vt 0.750000 0.750000
-vt 0.718750 0.750000
-vt 0.718750 0.250000
-vt 0.750000 0.250000
-vt 0.750000 0.687500
-vt 0.718750 0.687500
-vt 0.718750 0.187500
-vt 0.750000 0.187500
-vt 0.750000 0.625000
-vt 0.718750 0.625000
-vt 0.718750 0.125000
-vt 0.750000 0.125000
-vt 0.750000 0.562500
-vt 0.718750 0.562500
-vt 0.718750 0.062500
-vt 0.750000 0.062500
-vt 0.718750 0.500000
-vt 0.750000 0.500000
-vt 0.750000 0.937500
-vt 0.734375 1.000000
-vt 0.718750 0.937500
-vt 0.734375 0.000000
-vt 0.718750 0.437500
-vt 0.750000 0.875000
-vt 0.703125 0.000000
-vt 0.687500 0.062500
-vt 0.687500 0.437500
-vt 0.687500 0.875000
-vt 0.687500 0.375000
-vt 0.687500 0.812500
-vt 0.687500 0.312500
-vt 0.687500 0.750000
-vt 0.687500 0.250000
-vt 0.687500 0.687500
-vt 0.687500 0.187500
-vt 0.687500 0.625000
-vt 0.687500 0.125000
-vt 0.687500 0.562500
-vt 0.687500 0.500000
-vt 0.703125 1.000000
-vt 0.687500 0.937500
-vt 0.656250 0.250000
-vt 0.656250 0.187500
-vt 0.656250 0.625000
-vt 0.656250 0.125000
-vt 0.656250 0.562500
-vt 0.656250 0.062500
-vt 0.656250 0.500000
-vt 0.671875 1.000000
-vt 0.656250 0.937500
-vt 0.671875 0.000000
-vt 0.656250 0.437500
-vt 0.656250 0.875000
-vt 0.656250 0.375000
-vt 0.656250 0.812500
-vt 0.656250 0.312500
-vt 0.656250 0.750000
-vt 0.656250 0.687500
-vt 0.625000 0.875000
-vt 0.625000 0.375000
-vt 0.625000 0.812500
-vt 0.625000 0.312500
-vt 0.625000 0.750000
-vt 0.625000 0.250000
-vt 0.625000 0.687500
-vt 0.625000 0.187500
-vt 0.625000 0.625000
-vt 0.625000 0.125000
-vt 0.625000 0.562500
-vt 0.625000 0.062500
-vt 0.625000 0.500000
-vt 0.640625 1.000000
-vt 0.625000 0.937500
-vt 0.640625 0.000000
-vt 0.625000 0.437500
-vt 0.593750 0.625000
-vt 0.593750 0.187500
-vt 0.593750 0.125000
-vt 0.593750 0.562500
-vt 0.593750 0.062500
-vt 0.593750 0.500000
-vt 0.609375 1.000000
-vt 0.593750 0.937500
-vt 0.609375 0.000000
-vt 0.593750 0.437500
-vt 0.593750 0.875000
-vt 0.593750 0.375000
-vt 0.593750 0.812500
-vt 0.593750 0.312500
-vt 0.593750 0.750000
-vt 0.593750 0.250000
-vt 0.593750 0.687500
-vt 0.562500 0.375000
-vt 0.562500 0.812500
-vt 0.562500 0.312500
-vt 0.562500 0.750000
-vt 0.562500 0.250000
-vt 0.562500 0.687500
-vt 0.562500 0.187500
-vt 0.562500 0.625000
-vt 0.562500 0.125000
-vt 0.562500 0.562500
-vt 0.562500 0.062500
-vt 0.562500 0.500000
-vt 0.578125 1.000000
-vt 0.562500 0.937500
-vt 0.578125 0.000000
-vt 0.562500 0.437500
-vt 0.562500 0.875000
-vt 0.531250 0.187500
-vt 0.531250 0.125000
-vt 0.531250 0.625000
-vt 0.531250 0.562500
-vt 0.531250 0.062500
-vt 0.531250 0.500000
-vt 0.546875 1.000000
-vt 0.531250 0.937500
-vt 0.546875 0.000000
-vt 0.531250 0.437500
-vt 0.531250 0.875000
-vt 0.531250 0.375000
-vt 0.531250 0.812500
-vt 0.531250 0.312500
-vt 0.531250 0.750000
-vt 0.531250 0.250000
-vt 0.531250 0.687500
-vt 0.500000 0.812500
-vt 0.500000 0.375000
-vt 0.500000 0.312500
-vt 0.500000 0.750000
-vt 0.500000 0.250000
-vt 0.500000 0.687500
-vt 0.500000 0.187500
-vt 0.500000 0.625000
-vt 0.500000 0.125000
-vt 0.500000 0.562500
-vt 0.500000 0.062500
-vt 0.500000 0.500000
-vt 0.515625 1.000000
-vt 0.500000 0.937500
-vt 0.515625 0.000000
-vt 0.500000 0.437500
-vt 0.500000 0.875000
-vt 0.468750 0.625000
-vt 0.468750 0.562500
-vt 0.468750 0.062500
-vt 0.468750 0.500000
-vt 0.484375 1.000000
-vt 0.468750 0.937500
-vt 0.484375 0.000000
-vt 0.468750 0.437500
-vt 0.468750 0.875000
-vt 0.468750 0.375000
-vt 0.468750 0.812500
-vt 0.468750 0.312500
-vt 0.468750 0.750000
-vt 0.468750 0.250000
-vt 0.468750 0.687500
-vt 0.468750 0.187500
-vt 0.468750 0.125000
-vt 0.437500 0.375000
-vt 0.437500 0.312500
-vt 0.437500 0.750000
-vt 0.437500 0.250000
-vt 0.437500 0.687500
-vt 0.437500 0.187500
-vt 0.437500 0.625000
-vt 0.437500 0.125000
-vt 0.437500 0.562500
-vt 0.437500 0.062500
-vt 0.437500 0.500000
-vt 0.453125 1.000000
-vt 0.437500 0.937500
-vt 0.453125 0.000000
-vt 0.437500 0.437500
-vt 0.437500 0.875000
-vt 0.437500 0.812500
-vt 0.406250 0.062500
-vt 0.406250 0.562500
-vt 0.406250 0.500000
-vt 0.421875 1.000000
-vt 0.406250 0.937500
-vt 0.421875 0.000000
-vt 0.406250 0.437500
-vt 0.406250 0.875000
-vt 0.406250 0.375000
-vt 0.406250 0.812500
-vt 0.406250 0.312500
-vt 0.406250 0.750000
-vt 0.406250 0.250000
-vt 0.406250 0.687500
-vt 0.406250 0.187500
-vt 0.406250 0.625000
-vt 0.406250 0.125000
-vt 0.375000 0.250000
-vt 0.375000 0.750000
-vt 0.375000 0.687500
-vt 0.375000 0.187500
-vt 0.375000 0.625000
-vt 0.375000 0.125000
-vt 0.375000 0.562500
-vt 0.375000 0.062500
-vt 0.375000 0.500000
-vt 0.390625 1.000000
-vt 0.375000 0.937500
-vt 0.390625 0.000000
-vt 0.375000 0.437500
-vt 0.375000 0.875000
-vt 0.375000 0.375000
-vt 0.375000 0.812500
-vt 0.375000 0.312500
-vt 0.359375 1.000000
-vt 0.343750 0.937500
-vt 0.359375 0.000000
-vt 0.343750 0.062500
-vt 0.343750 0.437500
-vt 0.343750 0.875000
-vt 0.343750 0.375000
-vt 0.343750 0.812500
-vt 0.343750 0.312500
-vt 0.343750 0.750000
-vt 0.343750 0.250000
-vt 0.343750 0.687500
-vt 0.343750 0.187500
-vt 0.343750 0.625000
-vt 0.343750 0.125000
-vt 0.343750 0.562500
-vt 0.343750 0.500000
-vt 0.312500 0.750000
-vt 0.312500 0.687500
-vt 0.312500 0.250000
-vt 0.312500 0.187500
-vt 0.312500 0.625000
-vt 0.312500 0.125000
-vt 0.312500 0.562500
-vt 0.312500 0.062500
-vt 0.312500 0.500000
-vt 0.328125 1.000000
-vt 0.312500 0.937500
-vt 0.328125 0.000000
-vt 0.312500 0.437500
-vt 0.312500 0.875000
-vt 0.312500 0.375000
-vt 0.312500 0.812500
-vt 0.312500 0.312500
-vt 0.281250 0.437500
-vt 0.281250 0.875000
-vt 0.281250 0.375000
-vt 0.281250 0.812500
-vt 0.281250 0.312500
-vt 0.281250 0.750000
-vt 0.281250 0.250000
-vt 0.281250 0.687500
-vt 0.281250 0.187500
-vt 0.281250 0.625000
-vt 0.281250 0.125000
-vt 0.281250 0.562500
-vt 0.281250 0.062500
-vt 0.281250 0.500000
-vt 0.296875 1.000000
-vt 0.281250 0.937500
-vt 0.296875 0.000000
-vt 0.250000 0.250000
-vt 0.250000 0.187500
-vt 0.250000 0.625000
-vt 0.250000 0.125000
-vt 0.250000 0.562500
-vt 0.250000 0.062500
-vt 0.250000 0.500000
-vt 0.265625 1.000000
-vt 0.250000 0.937500
-vt 0.265625 0.000000
-vt 0.250000 0.437500
-vt 0.250000 0.875000
-vt 0.250000 0.375000
-vt 0.250000 0.812500
-vt 0.250000 0.312500
-vt 0.250000 0.750000
-vt 0.250000 0.687500
-vt 0.218750 0.875000
-vt 0.218750 0.375000
-vt 0.218750 0.812500
-vt 0.218750 0.312500
-vt 0.218750 0.750000
-vt 0.218750 0.250000
-vt 0.218750 0.687500
-vt 0.218750 0.187500
-vt 0.218750 0.625000
-vt 0.218750 0.125000
-vt 0.218750 0.562500
-vt 0.218750 0.062500
-vt 0.218750 0.500000
-vt 0.234375 1.000000
-vt 0.218750 0.937500
-vt 0.234375 0.000000
-vt 0.218750 0.437500
-vt 0.187500 0.625000
-vt 0.187500 0.125000
-vt 0.187500 0.562500
-vt 0.187500 0.062500
-vt 0.187500 0.500000
-vt 0.203125 1.000000
-vt 0.187500 0.937500
-vt 0.203125 0.000000
-vt 0.187500 0.437500
-vt 0.187500 0.875000
-vt 0.187500 0.375000
-vt 0.187500 0.812500
-vt 0.187500 0.312500
-vt 0.187500 0.750000
-vt 0.187500 0.250000
-vt 0.187500 0.687500
-vt 0.187500 0.187500
-vt 0.156250 0.375000
-vt 0.156250 0.812500
-vt 0.156250 0.312500
-vt 0.156250 0.750000
-vt 0.156250 0.250000
-vt 0.156250 0.687500
-vt 0.156250 0.187500
-vt 0.156250 0.625000
-vt 0.156250 0.125000
-vt 0.156250 0.562500
-vt 0.156250 0.062500
-vt 0.156250 0.500000
-vt 0.171875 1.000000
-vt 0.156250 0.937500
-vt 0.171875 0.000000
-vt 0.156250 0.437500
-vt 0.156250 0.875000
-vt 0.125000 0.125000
-vt 0.125000 0.625000
-vt 0.125000 0.562500
-vt 0.125000 0.062500
-vt 0.125000 0.500000
-vt 0.140625 1.000000
-vt 0.125000 0.937500
-vt 0.140625 0.000000
-vt 0.125000 0.437500
-vt 0.125000 0.875000
-vt 0.125000 0.375000
-vt 0.125000 0.812500
-vt 0.125000 0.312500
-vt 0.125000 0.750000
-vt 0.125000 0.250000
-vt 0.125000 0.687500
-vt 0.125000 0.187500
-vt 0.093750 0.375000
-vt 0.093750 0.312500
-vt 0.093750 0.750000
-vt 0.093750 0.250000
-vt 0.093750 0.687500
-vt 0.093750 0.187500
-vt 0.093750 0.625000
-vt 0.093750 0.125000
-vt 0.093750 0.562500
-vt 0.093750 0.062500
-vt 0.093750 0.500000
-vt 0.109375 1.000000
-vt 0.093750 0.937500
-vt 0.109375 0.000000
-vt 0.093750 0.437500
-vt 0.093750 0.875000
-vt 0.093750 0.812500
-vt 0.062500 0.062500
-vt 0.062500 0.562500
-vt 0.062500 0.500000
-vt 0.078125 1.000000
-vt 0.062500 0.937500
-vt 0.078125 0.000000
-vt 0.062500 0.437500
-vt 0.062500 0.875000
-vt 0.062500 0.375000
-vt 0.062500 0.812500
-vt 0.062500 0.312500
-vt 0.062500 0.750000
-vt 0.062500 0.250000
-vt 0.062500 0.687500
-vt 0.062500 0.187500
-vt 0.062500 0.625000
-vt 0.062500 0.125000
-vt 0.031250 0.750000
-vt 0.031250 0.250000
-vt 0.031250 0.687500
-vt 0.031250 0.187500
-vt 0.031250 0.625000
-vt 0.031250 0.125000
-vt 0.031250 0.562500
-vt 0.031250 0.062500
-vt 0.031250 0.500000
-vt 0.046875 1.000000
-vt 0.031250 0.937500
-vt 0.046875 0.000000
-vt 0.031250 0.437500
-vt 0.031250 0.875000
-vt 0.031250 0.375000
-vt 0.031250 0.812500
-vt 0.031250 0.312500
-vt 0.000000 0.562500
-vt 0.000000 0.500000
-vt 0.015625 1.000000
-vt 0.000000 0.937500
-vt 0.015625 0.000000
-vt 0.000000 0.062500
-vt 0.000000 0.437500
-vt 0.000000 0.875000
-vt 0.000000 0.375000
-vt 0.000000 0.812500
-vt 0.000000 0.312500
-vt 0.000000 0.750000
-vt 0.000000 0.250000
-vt 0.000000 0.687500
-vt 0.000000 0.187500
-vt 0.000000 0.625000
-vt 0.000000 0.125000
-vt 1.000000 0.312500
-vt 0.968750 0.250000
-vt 1.000000 0.250000
-vt 1.000000 0.687500
-vt 0.968750 0.750000
-vt 0.968750 0.687500
-vt 1.000000 0.187500
-vt 0.968750 0.187500
-vt 0.968750 0.625000
-vt 1.000000 0.625000
-vt 0.968750 0.125000
-vt 1.000000 0.125000
-vt 1.000000 0.562500
-vt 0.968750 0.562500
-vt 0.968750 0.062500
-vt 1.000000 0.062500
-vt 1.000000 0.500000
-vt 0.968750 0.500000
-vt 1.000000 0.937500
-vt 0.984375 1.000000
-vt 0.968750 0.937500
-vt 0.984375 0.000000
-vt 0.968750 0.437500
-vt 1.000000 0.437500
-vt 0.968750 0.875000
-vt 1.000000 0.875000
-vt 0.968750 0.375000
-vt 1.000000 0.375000
-vt 1.000000 0.812500
-vt 0.968750 0.812500
-vt 0.968750 0.312500
-vt 1.000000 0.750000
-vt 0.953125 1.000000
-vt 0.937500 0.937500
-vt 0.953125 0.000000
-vt 0.937500 0.062500
-vt 0.937500 0.437500
-vt 0.937500 0.875000
-vt 0.937500 0.375000
-vt 0.937500 0.812500
-vt 0.937500 0.312500
-vt 0.937500 0.750000
-vt 0.937500 0.250000
-vt 0.937500 0.687500
-vt 0.937500 0.187500
-vt 0.937500 0.625000
-vt 0.937500 0.125000
-vt 0.937500 0.562500
-vt 0.937500 0.500000
-vt 0.906250 0.750000
-vt 0.906250 0.687500
-vt 0.906250 0.250000
-vt 0.906250 0.187500
-vt 0.906250 0.625000
-vt 0.906250 0.125000
-vt 0.906250 0.562500
-vt 0.906250 0.062500
-vt 0.906250 0.500000
-vt 0.921875 1.000000
-vt 0.906250 0.937500
-vt 0.921875 0.000000
-vt 0.906250 0.437500
-vt 0.906250 0.875000
-vt 0.906250 0.375000
-vt 0.906250 0.812500
-vt 0.906250 0.312500
-vt 0.875000 0.437500
-vt 0.875000 0.875000
-vt 0.875000 0.375000
-vt 0.875000 0.812500
-vt 0.875000 0.312500
-vt 0.875000 0.750000
-vt 0.875000 0.250000
-vt 0.875000 0.687500
-vt 0.875000 0.187500
-vt 0.875000 0.625000
-vt 0.875000 0.125000
-vt 0.875000 0.562500
-vt 0.875000 0.062500
-vt 0.875000 0.500000
-vt 0.890625 1.000000
-vt 0.875000 0.937500
-vt 0.890625 0.000000
-vt 0.843750 0.250000
-vt 0.843750 0.187500
-vt 0.843750 0.625000
-vt 0.843750 0.125000
-vt 0.843750 0.562500
-vt 0.843750 0.062500
-vt 0.843750 0.500000
-vt 0.859375 1.000000
-vt 0.843750 0.937500
-vt 0.859375 0.000000
-vt 0.843750 0.437500
-vt 0.843750 0.875000
-vt 0.843750 0.375000
-vt 0.843750 0.812500
-vt 0.843750 0.312500
-vt 0.843750 0.750000
-vt 0.843750 0.687500
-vt 0.812500 0.375000
-vt 0.812500 0.812500
-vt 0.812500 0.312500
-vt 0.812500 0.750000
-vt 0.812500 0.250000
-vt 0.812500 0.687500
-vt 0.812500 0.187500
-vt 0.812500 0.625000
-vt 0.812500 0.125000
-vt 0.812500 0.562500
-vt 0.812500 0.062500
-vt 0.812500 0.500000
-vt 0.828125 1.000000
-vt 0.812500 0.937500
-vt 0.828125 0.000000
-vt 0.812500 0.437500
-vt 0.812500 0.875000
-vt 0.781250 0.125000
-vt 0.781250 0.625000
-vt 0.781250 0.562500
-vt 0.781250 0.062500
-vt 0.781250 0.500000
-vt 0.796875 1.000000
-vt 0.781250 0.937500
-vt 0.796875 0.000000
-vt 0.781250 0.437500
-vt 0.781250 0.875000
-vt 0.781250 0.375000
-vt 0.781250 0.812500
-vt 0.781250 0.312500
-vt 0.781250 0.750000
-vt 0.781250 0.250000
-vt 0.781250 0.687500
-vt 0.781250 0.187500
-vt 0.765625 1.000000
-vt 0.765625 0.000000
-s 0
-usemtl Material.003
-f 512/557/928 523/558/928 985/559/928
-f 508/560/929 515/561/929 516/562/929
-f 985/559/930 524/563/930 513/564/930
-f 983/565/931 516/562/931 517/566/931
-f 513/564/932 525/567/932 986/568/932
-f 509/569/933 517/566/933 518/570/933
-f 986/568/934 526/571/934 987/572/934
-f 984/573/935 518/570/935 519/574/935
-f 987/572/936 527/575/936 988/576/936
-f 510/577/937 519/574/937 520/578/937
-f 988/576/938 528/579/938 989/580/938
-f 510/577/939 521/581/939 511/582/939
-f 981/583/940 589/584/940 514/585/940
-f 815/586/941 989/580/941 528/579/941
-f 511/582/942 522/587/942 512/557/942
-f 982/588/943 514/585/943 515/561/943
-f 815/589/944 528/579/944 543/590/944
-f 521/581/945 537/591/945 522/587/945
-f 514/585/946 530/592/946 515/561/946
-f 522/587/947 538/593/947 523/558/947
-f 515/561/948 531/594/948 516/562/948
-f 523/558/949 539/595/949 524/563/949
-f 516/562/950 532/596/950 517/566/950
-f 524/563/951 540/597/951 525/567/951
-f 517/566/952 533/598/952 518/570/952
-f 526/571/953 540/597/953 541/599/953
-f 518/570/954 534/600/954 519/574/954
-f 527/575/955 541/599/955 542/601/955
-f 520/578/956 534/600/956 535/602/956
-f 527/575/957 543/590/957 528/579/957
-f 520/578/958 536/603/958 521/581/958
-f 514/585/959 589/604/959 529/605/959
-f 541/599/960 555/606/960 556/607/960
-f 533/598/961 549/608/961 534/600/961
-f 541/599/962 557/609/962 542/601/962
-f 534/600/963 550/610/963 535/602/963
-f 542/601/964 558/611/964 543/590/964
-f 535/602/965 551/612/965 536/603/965
-f 529/605/966 589/613/966 544/614/966
-f 815/615/967 543/590/967 558/611/967
-f 537/591/968 551/612/968 552/616/968
-f 529/605/969 545/617/969 530/592/969
-f 537/591/970 553/618/970 538/593/970
-f 530/592/971 546/619/971 531/594/971
-f 539/595/972 553/618/972 554/620/972
-f 531/594/973 547/621/973 532/596/973
-f 540/597/974 554/620/974 555/606/974
-f 532/596/975 548/622/975 533/598/975
-f 544/614/976 560/623/976 545/617/976
-f 552/616/977 568/624/977 553/618/977
-f 545/617/978 561/625/978 546/619/978
-f 554/620/979 568/624/979 569/626/979
-f 546/619/980 562/627/980 547/621/980
-f 554/620/981 570/628/981 555/606/981
-f 547/621/982 563/629/982 548/622/982
-f 555/606/983 571/630/983 556/607/983
-f 548/622/984 564/631/984 549/608/984
-f 556/607/985 572/632/985 557/609/985
-f 550/610/986 564/631/986 565/633/986
-f 557/609/987 573/634/987 558/611/987
-f 551/612/988 565/633/988 566/635/988
-f 544/614/989 589/636/989 559/637/989
-f 815/638/990 558/611/990 573/634/990
-f 551/612/991 567/639/991 552/616/991
-f 563/629/992 579/640/992 564/631/992
-f 572/632/993 586/641/993 587/642/993
-f 565/633/994 579/640/994 580/643/994
-f 572/632/995 588/644/995 573/634/995
-f 566/635/996 580/643/996 581/645/996
-f 559/637/997 589/646/997 574/647/997
-f 815/648/998 573/634/998 588/644/998
-f 566/635/999 582/649/999 567/639/999
-f 559/637/1000 575/650/1000 560/623/1000
-f 567/639/1001 583/651/1001 568/624/1001
-f 560/623/1002 576/652/1002 561/625/1002
-f 569/626/1003 583/651/1003 584/653/1003
-f 561/625/1004 577/654/1004 562/627/1004
-f 569/626/1005 585/655/1005 570/628/1005
-f 563/629/1006 577/654/1006 578/656/1006
-f 570/628/1007 586/641/1007 571/630/1007
-f 582/649/1008 599/657/1008 583/651/1008
-f 575/650/1009 592/658/1009 576/652/1009
-f 584/653/1010 599/657/1010 600/659/1010
-f 576/652/1011 593/660/1011 577/654/1011
-f 584/653/1012 601/661/1012 585/655/1012
-f 578/656/1013 593/660/1013 594/662/1013
-f 585/655/1014 602/663/1014 586/641/1014
-f 578/656/1015 595/664/1015 579/640/1015
-f 586/641/1016 603/665/1016 587/642/1016
-f 580/643/1017 595/664/1017 596/666/1017
-f 588/644/1018 603/665/1018 604/667/1018
-f 581/645/1019 596/666/1019 597/668/1019
-f 574/647/1020 589/669/1020 590/670/1020
-f 815/671/1021 588/644/1021 604/667/1021
-f 581/645/1022 598/672/1022 582/649/1022
-f 574/647/1023 591/673/1023 575/650/1023
-f 603/665/1024 617/674/1024 618/675/1024
-f 596/666/1025 610/676/1025 611/677/1025
-f 603/665/1026 619/678/1026 604/667/1026
-f 597/668/1027 611/677/1027 612/679/1027
-f 590/670/1028 589/680/1028 605/681/1028
-f 815/682/1029 604/667/1029 619/678/1029
-f 597/668/1030 613/683/1030 598/672/1030
-f 591/673/1031 605/681/1031 606/684/1031
-f 598/672/1032 614/685/1032 599/657/1032
-f 591/673/1033 607/686/1033 592/658/1033
-f 600/659/1034 614/685/1034 615/687/1034
-f 592/658/1035 608/688/1035 593/660/1035
-f 600/659/1036 616/689/1036 601/661/1036
-f 594/662/1037 608/688/1037 609/690/1037
-f 602/663/1038 616/689/1038 617/674/1038
-f 594/662/1039 610/676/1039 595/664/1039
-f 606/684/1040 622/691/1040 607/686/1040
-f 615/687/1041 629/692/1041 630/693/1041
-f 607/686/1042 623/694/1042 608/688/1042
-f 615/687/1043 631/695/1043 616/689/1043
-f 609/690/1044 623/694/1044 624/696/1044
-f 617/674/1045 631/695/1045 632/697/1045
-f 609/690/1046 625/698/1046 610/676/1046
-f 617/674/1047 633/699/1047 618/675/1047
-f 611/677/1048 625/698/1048 626/700/1048
-f 618/675/1049 634/701/1049 619/678/1049
-f 612/679/1050 626/700/1050 627/702/1050
-f 605/681/1051 589/703/1051 620/704/1051
-f 815/705/1052 619/678/1052 634/701/1052
-f 612/679/1053 628/706/1053 613/683/1053
-f 606/684/1054 620/704/1054 621/707/1054
-f 613/683/1055 629/692/1055 614/685/1055
-f 626/700/1056 640/708/1056 641/709/1056
-f 633/699/1057 649/710/1057 634/701/1057
-f 627/702/1058 641/709/1058 642/711/1058
-f 620/704/1059 589/712/1059 635/713/1059
-f 815/714/1060 634/701/1060 649/710/1060
-f 627/702/1061 643/715/1061 628/706/1061
-f 620/704/1062 636/716/1062 621/707/1062
-f 628/706/1063 644/717/1063 629/692/1063
-f 621/707/1064 637/718/1064 622/691/1064
-f 630/693/1065 644/717/1065 645/719/1065
-f 622/691/1066 638/720/1066 623/694/1066
-f 630/693/1067 646/721/1067 631/695/1067
-f 624/696/1068 638/720/1068 639/722/1068
-f 632/697/1069 646/721/1069 647/723/1069
-f 624/696/1070 640/708/1070 625/698/1070
-f 632/697/1071 648/724/1071 633/699/1071
-f 645/719/1072 659/725/1072 660/726/1072
-f 637/718/1073 653/727/1073 638/720/1073
-f 645/719/1074 661/728/1074 646/721/1074
-f 639/722/1075 653/727/1075 654/729/1075
-f 647/723/1076 661/728/1076 662/730/1076
-f 639/722/1077 655/731/1077 640/708/1077
-f 647/723/1078 663/732/1078 648/724/1078
-f 641/709/1079 655/731/1079 656/733/1079
-f 649/710/1080 663/732/1080 664/734/1080
-f 642/711/1081 656/733/1081 657/735/1081
-f 635/713/1082 589/736/1082 650/737/1082
-f 815/738/1083 649/710/1083 664/734/1083
-f 642/711/1084 658/739/1084 643/715/1084
-f 635/713/1085 651/740/1085 636/716/1085
-f 643/715/1086 659/725/1086 644/717/1086
-f 637/718/1087 651/740/1087 652/741/1087
-f 663/732/1088 679/742/1088 664/734/1088
-f 657/735/1089 671/743/1089 672/744/1089
-f 650/737/1090 589/745/1090 665/746/1090
-f 815/747/1091 664/734/1091 679/742/1091
-f 657/735/1092 673/748/1092 658/739/1092
-f 650/737/1093 666/749/1093 651/740/1093
-f 658/739/1094 674/750/1094 659/725/1094
-f 652/741/1095 666/749/1095 667/751/1095
-f 660/726/1096 674/750/1096 675/752/1096
-f 652/741/1097 668/753/1097 653/727/1097
-f 660/726/1098 676/754/1098 661/728/1098
-f 654/729/1099 668/753/1099 669/755/1099
-f 662/730/1100 676/754/1100 677/756/1100
-f 654/729/1101 670/757/1101 655/731/1101
-f 662/730/1102 678/758/1102 663/732/1102
-f 656/733/1103 670/757/1103 671/743/1103
-f 675/752/1104 691/759/1104 676/754/1104
-f 669/755/1105 683/760/1105 684/761/1105
-f 676/754/1106 692/762/1106 677/756/1106
-f 669/755/1107 685/763/1107 670/757/1107
-f 678/758/1108 692/762/1108 693/764/1108
-f 671/743/1109 685/763/1109 686/765/1109
-f 679/742/1110 693/764/1110 694/766/1110
-f 672/744/1111 686/765/1111 687/767/1111
-f 665/746/1112 589/768/1112 680/769/1112
-f 815/770/1113 679/742/1113 694/766/1113
-f 672/744/1114 688/771/1114 673/748/1114
-f 665/746/1115 681/772/1115 666/749/1115
-f 673/748/1116 689/773/1116 674/750/1116
-f 666/749/1117 682/774/1117 667/751/1117
-f 675/752/1118 689/773/1118 690/775/1118
-f 667/751/1119 683/760/1119 668/753/1119
-f 680/769/1120 589/776/1120 695/777/1120
-f 815/778/1121 694/766/1121 709/779/1121
-f 687/767/1122 703/780/1122 688/771/1122
-f 681/772/1123 695/777/1123 696/781/1123
-f 688/771/1124 704/782/1124 689/773/1124
-f 682/774/1125 696/781/1125 697/783/1125
-f 690/775/1126 704/782/1126 705/784/1126
-f 682/774/1127 698/785/1127 683/760/1127
-f 690/775/1128 706/786/1128 691/759/1128
-f 684/761/1129 698/785/1129 699/787/1129
-f 692/762/1130 706/786/1130 707/788/1130
-f 684/761/1131 700/789/1131 685/763/1131
-f 692/762/1132 708/790/1132 693/764/1132
-f 686/765/1133 700/789/1133 701/791/1133
-f 693/764/1134 709/779/1134 694/766/1134
-f 687/767/1135 701/791/1135 702/792/1135
-f 699/787/1136 713/793/1136 714/794/1136
-f 707/788/1137 721/795/1137 722/796/1137
-f 699/787/1138 715/797/1138 700/789/1138
-f 707/788/1139 723/798/1139 708/790/1139
-f 701/791/1140 715/797/1140 716/799/1140
-f 708/790/1141 724/800/1141 709/779/1141
-f 702/792/1142 716/799/1142 717/801/1142
-f 695/777/1143 589/802/1143 710/803/1143
-f 815/804/1144 709/779/1144 724/800/1144
-f 702/792/1145 718/805/1145 703/780/1145
-f 695/777/1146 711/806/1146 696/781/1146
-f 703/780/1147 719/807/1147 704/782/1147
-f 696/781/1148 712/808/1148 697/783/1148
-f 705/784/1149 719/807/1149 720/809/1149
-f 697/783/1150 713/793/1150 698/785/1150
-f 705/784/1151 721/795/1151 706/786/1151
-f 717/801/1152 733/810/1152 718/805/1152
-f 710/803/1153 726/811/1153 711/806/1153
-f 718/805/1154 734/812/1154 719/807/1154
-f 711/806/1155 727/813/1155 712/808/1155
-f 720/809/1156 734/812/1156 735/814/1156
-f 712/808/1157 728/815/1157 713/793/1157
-f 720/809/1158 736/816/1158 721/795/1158
-f 714/794/1159 728/815/1159 729/817/1159
-f 722/796/1160 736/816/1160 737/818/1160
-f 714/794/1161 730/819/1161 715/797/1161
-f 722/796/1162 738/820/1162 723/798/1162
-f 716/799/1163 730/819/1163 731/821/1163
-f 723/798/1164 739/822/1164 724/800/1164
-f 717/801/1165 731/821/1165 732/823/1165
-f 710/803/1166 589/824/1166 725/825/1166
-f 815/826/1167 724/800/1167 739/822/1167
-f 737/818/1168 751/827/1168 752/828/1168
-f 729/817/1169 745/829/1169 730/819/1169
-f 737/818/1170 753/830/1170 738/820/1170
-f 731/821/1171 745/829/1171 746/831/1171
-f 739/822/1172 753/830/1172 754/832/1172
-f 732/823/1173 746/831/1173 747/833/1173
-f 725/825/1174 589/834/1174 740/835/1174
-f 815/836/1175 739/822/1175 754/832/1175
-f 732/823/1176 748/837/1176 733/810/1176
-f 725/825/1177 741/838/1177 726/811/1177
-f 733/810/1178 749/839/1178 734/812/1178
-f 727/813/1179 741/838/1179 742/840/1179
-f 735/814/1180 749/839/1180 750/841/1180
-f 727/813/1181 743/842/1181 728/815/1181
-f 735/814/1182 751/827/1182 736/816/1182
-f 729/817/1183 743/842/1183 744/843/1183
-f 740/835/1184 756/844/1184 741/838/1184
-f 748/837/1185 764/845/1185 749/839/1185
-f 741/838/1186 757/846/1186 742/840/1186
-f 750/841/1187 764/845/1187 765/847/1187
-f 742/840/1188 758/848/1188 743/842/1188
-f 750/841/1189 766/849/1189 751/827/1189
-f 744/843/1190 758/848/1190 759/850/1190
-f 752/828/1191 766/849/1191 767/851/1191
-f 744/843/1192 760/852/1192 745/829/1192
-f 752/828/1193 768/853/1193 753/830/1193
-f 746/831/1194 760/852/1194 761/854/1194
-f 753/830/1195 769/855/1195 754/832/1195
-f 747/833/1196 761/854/1196 762/856/1196
-f 740/835/1197 589/857/1197 755/858/1197
-f 815/859/1198 754/832/1198 769/855/1198
-f 747/833/1199 763/860/1199 748/837/1199
-f 759/850/1200 775/861/1200 760/852/1200
-f 767/851/1201 783/862/1201 768/853/1201
-f 761/854/1202 775/861/1202 776/863/1202
-f 768/853/1203 784/864/1203 769/855/1203
-f 762/856/1204 776/863/1204 777/865/1204
-f 755/858/1205 589/866/1205 770/867/1205
-f 815/868/1206 769/855/1206 784/864/1206
-f 762/856/1207 778/869/1207 763/860/1207
-f 756/844/1208 770/867/1208 771/870/1208
-f 763/860/1209 779/871/1209 764/845/1209
-f 756/844/1210 772/872/1210 757/846/1210
-f 765/847/1211 779/871/1211 780/873/1211
-f 757/846/1212 773/874/1212 758/848/1212
-f 765/847/1213 781/875/1213 766/849/1213
-f 759/850/1214 773/874/1214 774/876/1214
-f 767/851/1215 781/875/1215 782/877/1215
-f 778/869/1216 794/878/1216 779/871/1216
-f 771/870/1217 787/879/1217 772/872/1217
-f 780/873/1218 794/878/1218 795/880/1218
-f 772/872/1219 788/881/1219 773/874/1219
-f 780/873/1220 796/882/1220 781/875/1220
-f 774/876/1221 788/881/1221 789/883/1221
-f 782/877/1222 796/882/1222 797/884/1222
-f 774/876/1223 790/885/1223 775/861/1223
-f 782/877/1224 798/886/1224 783/862/1224
-f 776/863/1225 790/885/1225 791/887/1225
-f 784/864/1226 798/886/1226 799/888/1226
-f 777/865/1227 791/887/1227 792/889/1227
-f 770/867/1228 589/890/1228 785/891/1228
-f 815/892/1229 784/864/1229 799/888/1229
-f 777/865/1230 793/893/1230 778/869/1230
-f 771/870/1231 785/891/1231 786/894/1231
-f 797/884/1232 813/895/1232 798/886/1232
-f 791/887/1233 805/896/1233 806/897/1233
-f 799/888/1234 813/895/1234 814/898/1234
-f 792/889/1235 806/897/1235 807/899/1235
-f 785/891/1236 589/900/1236 800/901/1236
-f 815/902/1237 799/888/1237 814/898/1237
-f 792/889/1238 808/903/1238 793/893/1238
-f 785/891/1239 801/904/1239 786/894/1239
-f 793/893/1240 809/905/1240 794/878/1240
-f 786/894/1241 802/906/1241 787/879/1241
-f 795/880/1242 809/905/1242 810/907/1242
-f 787/879/1243 803/908/1243 788/881/1243
-f 795/880/1244 811/909/1244 796/882/1244
-f 789/883/1245 803/908/1245 804/910/1245
-f 797/884/1246 811/909/1246 812/911/1246
-f 789/883/1247 805/896/1247 790/885/1247
-f 810/907/1248 825/912/1248 826/913/1248
-f 802/906/1249 819/914/1249 803/908/1249
-f 810/907/1250 827/915/1250 811/909/1250
-f 804/910/1251 819/914/1251 820/916/1251
-f 812/911/1252 827/915/1252 828/917/1252
-f 804/910/1253 821/918/1253 805/896/1253
-f 812/911/1254 829/919/1254 813/895/1254
-f 806/897/1255 821/918/1255 822/920/1255
-f 813/895/1256 830/921/1256 814/898/1256
-f 807/899/1257 822/920/1257 823/922/1257
-f 800/901/1258 589/923/1258 816/924/1258
-f 815/925/1259 814/898/1259 830/921/1259
-f 807/899/1260 824/926/1260 808/903/1260
-f 800/901/1261 817/927/1261 801/904/1261
-f 808/903/1262 825/912/1262 809/905/1262
-f 801/904/1263 818/928/1263 802/906/1263
-f 829/919/1264 845/929/1264 830/921/1264
-f 823/922/1265 837/930/1265 838/931/1265
-f 816/924/1266 589/932/1266 831/933/1266
-f 815/934/1267 830/921/1267 845/929/1267
-f 823/922/1268 839/935/1268 824/926/1268
-f 816/924/1269 832/936/1269 817/927/1269
-f 824/926/1270 840/937/1270 825/912/1270
-f 817/927/1271 833/938/1271 818/928/1271
-f 826/913/1272 840/937/1272 841/939/1272
-f 818/928/1273 834/940/1273 819/914/1273
-f 826/913/1274 842/941/1274 827/915/1274
-f 819/914/1275 835/942/1275 820/916/1275
-f 828/917/1276 842/941/1276 843/943/1276
-f 820/916/1277 836/944/1277 821/918/1277
-f 828/917/1278 844/945/1278 829/919/1278
-f 822/920/1279 836/944/1279 837/930/1279
-f 833/938/1280 849/946/1280 834/940/1280
-f 841/939/1281 857/947/1281 842/941/1281
-f 835/942/1282 849/946/1282 850/948/1282
-f 843/943/1283 857/947/1283 858/949/1283
-f 835/942/1284 851/950/1284 836/944/1284
-f 843/943/1285 859/951/1285 844/945/1285
-f 837/930/1286 851/950/1286 852/952/1286
-f 844/945/1287 860/953/1287 845/929/1287
-f 838/931/1288 852/952/1288 853/954/1288
-f 831/933/1289 589/955/1289 846/956/1289
-f 815/957/1290 845/929/1290 860/953/1290
-f 838/931/1291 854/958/1291 839/935/1291
-f 831/933/1292 847/959/1292 832/936/1292
-f 839/935/1293 855/960/1293 840/937/1293
-f 832/936/1294 848/961/1294 833/938/1294
-f 841/939/1295 855/960/1295 856/962/1295
-f 853/954/1296 867/963/1296 868/964/1296
-f 846/956/1297 589/965/1297 861/966/1297
-f 815/967/1298 860/953/1298 875/968/1298
-f 853/954/1299 869/969/1299 854/958/1299
-f 846/956/1300 862/970/1300 847/959/1300
-f 854/958/1301 870/971/1301 855/960/1301
-f 848/961/1302 862/970/1302 863/972/1302
-f 856/962/1303 870/971/1303 871/973/1303
-f 848/961/1304 864/974/1304 849/946/1304
-f 856/962/1305 872/975/1305 857/947/1305
-f 850/948/1306 864/974/1306 865/976/1306
-f 858/949/1307 872/975/1307 873/977/1307
-f 850/948/1308 866/978/1308 851/950/1308
-f 858/949/1309 874/979/1309 859/951/1309
-f 852/952/1310 866/978/1310 867/963/1310
-f 859/951/1311 875/968/1311 860/953/1311
-f 871/980/1312 887/981/1312 872/982/1312
-f 865/983/1313 879/984/1313 880/985/1313
-f 873/986/1314 887/981/1314 888/987/1314
-f 865/983/1315 881/988/1315 866/989/1315
-f 873/986/1316 889/990/1316 874/991/1316
-f 867/992/1317 881/988/1317 882/993/1317
-f 874/991/1318 890/994/1318 875/995/1318
-f 868/996/1319 882/993/1319 883/997/1319
-f 861/998/1320 589/999/1320 876/1000/1320
-f 815/1001/1321 875/995/1321 890/994/1321
-f 868/996/1322 884/1002/1322 869/1003/1322
-f 861/998/1323 877/1004/1323 862/1005/1323
-f 869/1003/1324 885/1006/1324 870/1007/1324
-f 863/1008/1325 877/1004/1325 878/1009/1325
-f 871/980/1326 885/1006/1326 886/1010/1326
-f 863/1008/1327 879/984/1327 864/1011/1327
-f 876/1000/1328 589/1012/1328 891/1013/1328
-f 815/1014/1329 890/994/1329 905/1015/1329
-f 883/997/1330 899/1016/1330 884/1002/1330
-f 876/1000/1331 892/1017/1331 877/1004/1331
-f 884/1002/1332 900/1018/1332 885/1006/1332
-f 878/1009/1333 892/1017/1333 893/1019/1333
-f 886/1010/1334 900/1018/1334 901/1020/1334
-f 878/1009/1335 894/1021/1335 879/984/1335
-f 886/1010/1336 902/1022/1336 887/981/1336
-f 880/985/1337 894/1021/1337 895/1023/1337
-f 888/987/1338 902/1022/1338 903/1024/1338
-f 880/985/1339 896/1025/1339 881/988/1339
-f 888/987/1340 904/1026/1340 889/990/1340
-f 882/993/1341 896/1025/1341 897/1027/1341
-f 889/990/1342 905/1015/1342 890/994/1342
-f 883/997/1343 897/1027/1343 898/1028/1343
-f 895/1023/1344 909/1029/1344 910/1030/1344
-f 903/1024/1345 917/1031/1345 918/1032/1345
-f 895/1023/1346 911/1033/1346 896/1025/1346
-f 904/1026/1347 918/1032/1347 919/1034/1347
-f 897/1027/1348 911/1033/1348 912/1035/1348
-f 904/1026/1349 920/1036/1349 905/1015/1349
-f 898/1028/1350 912/1035/1350 913/1037/1350
-f 891/1013/1351 589/1038/1351 906/1039/1351
-f 815/1040/1352 905/1015/1352 920/1036/1352
-f 898/1028/1353 914/1041/1353 899/1016/1353
-f 892/1017/1354 906/1039/1354 907/1042/1354
-f 899/1016/1355 915/1043/1355 900/1018/1355
-f 892/1017/1356 908/1044/1356 893/1019/1356
-f 901/1020/1357 915/1043/1357 916/1045/1357
-f 893/1019/1358 909/1029/1358 894/1021/1358
-f 901/1020/1359 917/1031/1359 902/1022/1359
-f 913/1037/1360 929/1046/1360 914/1041/1360
-f 906/1039/1361 922/1047/1361 907/1042/1361
-f 914/1041/1362 930/1048/1362 915/1043/1362
-f 908/1044/1363 922/1047/1363 923/1049/1363
-f 916/1045/1364 930/1048/1364 931/1050/1364
-f 908/1044/1365 924/1051/1365 909/1029/1365
-f 916/1045/1366 932/1052/1366 917/1031/1366
-f 910/1030/1367 924/1051/1367 925/1053/1367
-f 918/1032/1368 932/1052/1368 933/1054/1368
-f 910/1030/1369 926/1055/1369 911/1033/1369
-f 918/1032/1370 934/1056/1370 919/1034/1370
-f 912/1035/1371 926/1055/1371 927/1057/1371
-f 919/1034/1372 935/1058/1372 920/1036/1372
-f 913/1037/1373 927/1057/1373 928/1059/1373
-f 906/1039/1374 589/1060/1374 921/1061/1374
-f 815/1062/1375 920/1036/1375 935/1058/1375
-f 933/1054/1376 947/1063/1376 948/1064/1376
-f 925/1053/1377 941/1065/1377 926/1055/1377
-f 933/1054/1378 949/1066/1378 934/1056/1378
-f 927/1057/1379 941/1065/1379 942/1067/1379
-f 934/1056/1380 950/1068/1380 935/1058/1380
-f 928/1059/1381 942/1067/1381 943/1069/1381
-f 921/1061/1382 589/1070/1382 936/1071/1382
-f 815/1072/1383 935/1058/1383 950/1068/1383
-f 928/1059/1384 944/1073/1384 929/1046/1384
-f 921/1061/1385 937/1074/1385 922/1047/1385
-f 929/1046/1386 945/1075/1386 930/1048/1386
-f 923/1049/1387 937/1074/1387 938/1076/1387
-f 931/1050/1388 945/1075/1388 946/1077/1388
-f 923/1049/1389 939/1078/1389 924/1051/1389
-f 931/1050/1390 947/1063/1390 932/1052/1390
-f 925/1053/1391 939/1078/1391 940/1079/1391
-f 944/1073/1392 960/1080/1392 945/1075/1392
-f 937/1074/1393 953/1081/1393 938/1076/1393
-f 946/1077/1394 960/1080/1394 961/1082/1394
-f 938/1076/1395 954/1083/1395 939/1078/1395
-f 946/1077/1396 962/1084/1396 947/1063/1396
-f 940/1079/1397 954/1083/1397 955/1085/1397
-f 948/1064/1398 962/1084/1398 963/1086/1398
-f 940/1079/1399 956/1087/1399 941/1065/1399
-f 948/1064/1400 964/1088/1400 949/1066/1400
-f 942/1067/1401 956/1087/1401 957/1089/1401
-f 949/1066/1402 965/1090/1402 950/1068/1402
-f 943/1069/1403 957/1089/1403 958/1091/1403
-f 936/1071/1404 589/1092/1404 951/1093/1404
-f 815/1094/1405 950/1068/1405 965/1090/1405
-f 943/1069/1406 959/1095/1406 944/1073/1406
-f 937/1074/1407 951/1093/1407 952/1096/1407
-f 963/1086/1408 979/1097/1408 964/1088/1408
-f 957/1089/1409 971/1098/1409 972/1099/1409
-f 965/1090/1410 979/1097/1410 980/1100/1410
-f 958/1091/1411 972/1099/1411 973/1101/1411
-f 951/1093/1412 589/1102/1412 966/1103/1412
-f 815/1104/1413 965/1090/1413 980/1100/1413
-f 958/1091/1414 974/1105/1414 959/1095/1414
-f 951/1093/1415 967/1106/1415 952/1096/1415
-f 959/1095/1416 975/1107/1416 960/1080/1416
-f 953/1081/1417 967/1106/1417 968/1108/1417
-f 961/1082/1418 975/1107/1418 976/1109/1418
-f 953/1081/1419 969/1110/1419 954/1083/1419
-f 961/1082/1420 977/1111/1420 962/1084/1420
-f 955/1085/1421 969/1110/1421 970/1112/1421
-f 963/1086/1422 977/1111/1422 978/1113/1422
-f 955/1085/1423 971/1098/1423 956/1087/1423
-f 968/1108/1424 982/588/1424 508/560/1424
-f 975/1107/1425 513/564/1425 976/1109/1425
-f 969/1110/1426 508/560/1426 983/565/1426
-f 976/1109/1427 986/568/1427 977/1111/1427
-f 970/1112/1428 983/565/1428 509/569/1428
-f 978/1113/1429 986/568/1429 987/572/1429
-f 971/1098/1430 509/569/1430 984/573/1430
-f 978/1113/1431 988/576/1431 979/1097/1431
-f 972/1099/1432 984/573/1432 510/577/1432
-f 979/1097/1433 989/580/1433 980/1100/1433
-f 973/1101/1434 510/577/1434 511/582/1434
-f 966/1103/1435 589/1114/1435 981/583/1435
-f 815/1115/1436 980/1100/1436 989/580/1436
-f 973/1101/1437 512/557/1437 974/1105/1437
-f 967/1106/1438 981/583/1438 982/588/1438
-f 974/1105/1439 985/559/1439 975/1107/1439
-f 512/557/928 522/587/928 523/558/928
-f 508/560/1440 982/588/1440 515/561/1440
-f 985/559/930 523/558/930 524/563/930
-f 983/565/931 508/560/931 516/562/931
-f 513/564/932 524/563/932 525/567/932
-f 509/569/933 983/565/933 517/566/933
-f 986/568/934 525/567/934 526/571/934
-f 984/573/935 509/569/935 518/570/935
-f 987/572/936 526/571/936 527/575/936
-f 510/577/937 984/573/937 519/574/937
-f 988/576/938 527/575/938 528/579/938
-f 510/577/939 520/578/939 521/581/939
-f 511/582/942 521/581/942 522/587/942
-f 982/588/943 981/583/943 514/585/943
-f 521/581/945 536/603/945 537/591/945
-f 514/585/946 529/605/946 530/592/946
-f 522/587/947 537/591/947 538/593/947
-f 515/561/948 530/592/948 531/594/948
-f 523/558/949 538/593/949 539/595/949
-f 516/562/950 531/594/950 532/596/950
-f 524/563/951 539/595/951 540/597/951
-f 517/566/952 532/596/952 533/598/952
-f 526/571/953 525/567/953 540/597/953
-f 518/570/954 533/598/954 534/600/954
-f 527/575/955 526/571/955 541/599/955
-f 520/578/956 519/574/956 534/600/956
-f 527/575/957 542/601/957 543/590/957
-f 520/578/958 535/602/958 536/603/958
-f 541/599/960 540/597/960 555/606/960
-f 533/598/961 548/622/961 549/608/961
-f 541/599/962 556/607/962 557/609/962
-f 534/600/963 549/608/963 550/610/963
-f 542/601/964 557/609/964 558/611/964
-f 535/602/965 550/610/965 551/612/965
-f 537/591/968 536/603/968 551/612/968
-f 529/605/969 544/614/969 545/617/969
-f 537/591/970 552/616/970 553/618/970
-f 530/592/1441 545/617/1441 546/619/1441
-f 539/595/972 538/593/972 553/618/972
-f 531/594/973 546/619/973 547/621/973
-f 540/597/974 539/595/974 554/620/974
-f 532/596/975 547/621/975 548/622/975
-f 544/614/976 559/637/976 560/623/976
-f 552/616/977 567/639/977 568/624/977
-f 545/617/978 560/623/978 561/625/978
-f 554/620/979 553/618/979 568/624/979
-f 546/619/980 561/625/980 562/627/980
-f 554/620/981 569/626/981 570/628/981
-f 547/621/982 562/627/982 563/629/982
-f 555/606/983 570/628/983 571/630/983
-f 548/622/984 563/629/984 564/631/984
-f 556/607/985 571/630/985 572/632/985
-f 550/610/986 549/608/986 564/631/986
-f 557/609/987 572/632/987 573/634/987
-f 551/612/988 550/610/988 565/633/988
-f 551/612/991 566/635/991 567/639/991
-f 563/629/992 578/656/992 579/640/992
-f 572/632/993 571/630/993 586/641/993
-f 565/633/994 564/631/994 579/640/994
-f 572/632/995 587/642/995 588/644/995
-f 566/635/996 565/633/996 580/643/996
-f 566/635/999 581/645/999 582/649/999
-f 559/637/1000 574/647/1000 575/650/1000
-f 567/639/1001 582/649/1001 583/651/1001
-f 560/623/1002 575/650/1002 576/652/1002
-f 569/626/1003 568/624/1003 583/651/1003
-f 561/625/1004 576/652/1004 577/654/1004
-f 569/626/1005 584/653/1005 585/655/1005
-f 563/629/1006 562/627/1006 577/654/1006
-f 570/628/1007 585/655/1007 586/641/1007
-f 582/649/1008 598/672/1008 599/657/1008
-f 575/650/1009 591/673/1009 592/658/1009
-f 584/653/1010 583/651/1010 599/657/1010
-f 576/652/1011 592/658/1011 593/660/1011
-f 584/653/1012 600/659/1012 601/661/1012
-f 578/656/1013 577/654/1013 593/660/1013
-f 585/655/1014 601/661/1014 602/663/1014
-f 578/656/1015 594/662/1015 595/664/1015
-f 586/641/1016 602/663/1016 603/665/1016
-f 580/643/1017 579/640/1017 595/664/1017
-f 588/644/1018 587/642/1018 603/665/1018
-f 581/645/1019 580/643/1019 596/666/1019
-f 581/645/1022 597/668/1022 598/672/1022
-f 574/647/1023 590/670/1023 591/673/1023
-f 603/665/1024 602/663/1024 617/674/1024
-f 596/666/1025 595/664/1025 610/676/1025
-f 603/665/1026 618/675/1026 619/678/1026
-f 597/668/1027 596/666/1027 611/677/1027
-f 597/668/1030 612/679/1030 613/683/1030
-f 591/673/1031 590/670/1031 605/681/1031
-f 598/672/1032 613/683/1032 614/685/1032
-f 591/673/1033 606/684/1033 607/686/1033
-f 600/659/1034 599/657/1034 614/685/1034
-f 592/658/1035 607/686/1035 608/688/1035
-f 600/659/1036 615/687/1036 616/689/1036
-f 594/662/1037 593/660/1037 608/688/1037
-f 602/663/1038 601/661/1038 616/689/1038
-f 594/662/1039 609/690/1039 610/676/1039
-f 606/684/1040 621/707/1040 622/691/1040
-f 615/687/1041 614/685/1041 629/692/1041
-f 607/686/1042 622/691/1042 623/694/1042
-f 615/687/1043 630/693/1043 631/695/1043
-f 609/690/1044 608/688/1044 623/694/1044
-f 617/674/1045 616/689/1045 631/695/1045
-f 609/690/1046 624/696/1046 625/698/1046
-f 617/674/1047 632/697/1047 633/699/1047
-f 611/677/1048 610/676/1048 625/698/1048
-f 618/675/1049 633/699/1049 634/701/1049
-f 612/679/1050 611/677/1050 626/700/1050
-f 612/679/1053 627/702/1053 628/706/1053
-f 606/684/1054 605/681/1054 620/704/1054
-f 613/683/1055 628/706/1055 629/692/1055
-f 626/700/1056 625/698/1056 640/708/1056
-f 633/699/1057 648/724/1057 649/710/1057
-f 627/702/1058 626/700/1058 641/709/1058
-f 627/702/1061 642/711/1061 643/715/1061
-f 620/704/1062 635/713/1062 636/716/1062
-f 628/706/1063 643/715/1063 644/717/1063
-f 621/707/1064 636/716/1064 637/718/1064
-f 630/693/1065 629/692/1065 644/717/1065
-f 622/691/1066 637/718/1066 638/720/1066
-f 630/693/1067 645/719/1067 646/721/1067
-f 624/696/1068 623/694/1068 638/720/1068
-f 632/697/1069 631/695/1069 646/721/1069
-f 624/696/1070 639/722/1070 640/708/1070
-f 632/697/1071 647/723/1071 648/724/1071
-f 645/719/1072 644/717/1072 659/725/1072
-f 637/718/1073 652/741/1073 653/727/1073
-f 645/719/1074 660/726/1074 661/728/1074
-f 639/722/1075 638/720/1075 653/727/1075
-f 647/723/1076 646/721/1076 661/728/1076
-f 639/722/1077 654/729/1077 655/731/1077
-f 647/723/1078 662/730/1078 663/732/1078
-f 641/709/1079 640/708/1079 655/731/1079
-f 649/710/1080 648/724/1080 663/732/1080
-f 642/711/1081 641/709/1081 656/733/1081
-f 642/711/1084 657/735/1084 658/739/1084
-f 635/713/1085 650/737/1085 651/740/1085
-f 643/715/1086 658/739/1086 659/725/1086
-f 637/718/1087 636/716/1087 651/740/1087
-f 663/732/1088 678/758/1088 679/742/1088
-f 657/735/1089 656/733/1089 671/743/1089
-f 657/735/1092 672/744/1092 673/748/1092
-f 650/737/1093 665/746/1093 666/749/1093
-f 658/739/1094 673/748/1094 674/750/1094
-f 652/741/1095 651/740/1095 666/749/1095
-f 660/726/1096 659/725/1096 674/750/1096
-f 652/741/1097 667/751/1097 668/753/1097
-f 660/726/1098 675/752/1098 676/754/1098
-f 654/729/1099 653/727/1099 668/753/1099
-f 662/730/1100 661/728/1100 676/754/1100
-f 654/729/1101 669/755/1101 670/757/1101
-f 662/730/1102 677/756/1102 678/758/1102
-f 656/733/1103 655/731/1103 670/757/1103
-f 675/752/1104 690/775/1104 691/759/1104
-f 669/755/1105 668/753/1105 683/760/1105
-f 676/754/1106 691/759/1106 692/762/1106
-f 669/755/1107 684/761/1107 685/763/1107
-f 678/758/1108 677/756/1108 692/762/1108
-f 671/743/1109 670/757/1109 685/763/1109
-f 679/742/1110 678/758/1110 693/764/1110
-f 672/744/1111 671/743/1111 686/765/1111
-f 672/744/1114 687/767/1114 688/771/1114
-f 665/746/1115 680/769/1115 681/772/1115
-f 673/748/1116 688/771/1116 689/773/1116
-f 666/749/1117 681/772/1117 682/774/1117
-f 675/752/1118 674/750/1118 689/773/1118
-f 667/751/1119 682/774/1119 683/760/1119
-f 687/767/1122 702/792/1122 703/780/1122
-f 681/772/1123 680/769/1123 695/777/1123
-f 688/771/1124 703/780/1124 704/782/1124
-f 682/774/1125 681/772/1125 696/781/1125
-f 690/775/1126 689/773/1126 704/782/1126
-f 682/774/1127 697/783/1127 698/785/1127
-f 690/775/1128 705/784/1128 706/786/1128
-f 684/761/1129 683/760/1129 698/785/1129
-f 692/762/1130 691/759/1130 706/786/1130
-f 684/761/1131 699/787/1131 700/789/1131
-f 692/762/1132 707/788/1132 708/790/1132
-f 686/765/1133 685/763/1133 700/789/1133
-f 693/764/1134 708/790/1134 709/779/1134
-f 687/767/1135 686/765/1135 701/791/1135
-f 699/787/1136 698/785/1136 713/793/1136
-f 707/788/1137 706/786/1137 721/795/1137
-f 699/787/1138 714/794/1138 715/797/1138
-f 707/788/1442 722/796/1442 723/798/1442
-f 701/791/1140 700/789/1140 715/797/1140
-f 708/790/1141 723/798/1141 724/800/1141
-f 702/792/1142 701/791/1142 716/799/1142
-f 702/792/1145 717/801/1145 718/805/1145
-f 695/777/1146 710/803/1146 711/806/1146
-f 703/780/1147 718/805/1147 719/807/1147
-f 696/781/1148 711/806/1148 712/808/1148
-f 705/784/1149 704/782/1149 719/807/1149
-f 697/783/1150 712/808/1150 713/793/1150
-f 705/784/1151 720/809/1151 721/795/1151
-f 717/801/1152 732/823/1152 733/810/1152
-f 710/803/1153 725/825/1153 726/811/1153
-f 718/805/1154 733/810/1154 734/812/1154
-f 711/806/1155 726/811/1155 727/813/1155
-f 720/809/1156 719/807/1156 734/812/1156
-f 712/808/1157 727/813/1157 728/815/1157
-f 720/809/1158 735/814/1158 736/816/1158
-f 714/794/1159 713/793/1159 728/815/1159
-f 722/796/1160 721/795/1160 736/816/1160
-f 714/794/1161 729/817/1161 730/819/1161
-f 722/796/1162 737/818/1162 738/820/1162
-f 716/799/1163 715/797/1163 730/819/1163
-f 723/798/1164 738/820/1164 739/822/1164
-f 717/801/1165 716/799/1165 731/821/1165
-f 737/818/1168 736/816/1168 751/827/1168
-f 729/817/1169 744/843/1169 745/829/1169
-f 737/818/1170 752/828/1170 753/830/1170
-f 731/821/1171 730/819/1171 745/829/1171
-f 739/822/1172 738/820/1172 753/830/1172
-f 732/823/1173 731/821/1173 746/831/1173
-f 732/823/1176 747/833/1176 748/837/1176
-f 725/825/1177 740/835/1177 741/838/1177
-f 733/810/1178 748/837/1178 749/839/1178
-f 727/813/1179 726/811/1179 741/838/1179
-f 735/814/1180 734/812/1180 749/839/1180
-f 727/813/1181 742/840/1181 743/842/1181
-f 735/814/1182 750/841/1182 751/827/1182
-f 729/817/1183 728/815/1183 743/842/1183
-f 740/835/1184 755/858/1184 756/844/1184
-f 748/837/1185 763/860/1185 764/845/1185
-f 741/838/1186 756/844/1186 757/846/1186
-f 750/841/1187 749/839/1187 764/845/1187
-f 742/840/1188 757/846/1188 758/848/1188
-f 750/841/1189 765/847/1189 766/849/1189
-f 744/843/1190 743/842/1190 758/848/1190
-f 752/828/1191 751/827/1191 766/849/1191
-f 744/843/1192 759/850/1192 760/852/1192
-f 752/828/1443 767/851/1443 768/853/1443
-f 746/831/1194 745/829/1194 760/852/1194
-f 753/830/1195 768/853/1195 769/855/1195
-f 747/833/1196 746/831/1196 761/854/1196
-f 747/833/1199 762/856/1199 763/860/1199
-f 759/850/1200 774/876/1200 775/861/1200
-f 767/851/1201 782/877/1201 783/862/1201
-f 761/854/1444 760/852/1444 775/861/1444
-f 768/853/1203 783/862/1203 784/864/1203
-f 762/856/1204 761/854/1204 776/863/1204
-f 762/856/1207 777/865/1207 778/869/1207
-f 756/844/1208 755/858/1208 770/867/1208
-f 763/860/1445 778/869/1445 779/871/1445
-f 756/844/1210 771/870/1210 772/872/1210
-f 765/847/1211 764/845/1211 779/871/1211
-f 757/846/1212 772/872/1212 773/874/1212
-f 765/847/1213 780/873/1213 781/875/1213
-f 759/850/1214 758/848/1214 773/874/1214
-f 767/851/1215 766/849/1215 781/875/1215
-f 778/869/1216 793/893/1216 794/878/1216
-f 771/870/1217 786/894/1217 787/879/1217
-f 780/873/1218 779/871/1218 794/878/1218
-f 772/872/1219 787/879/1219 788/881/1219
-f 780/873/1220 795/880/1220 796/882/1220
-f 774/876/1221 773/874/1221 788/881/1221
-f 782/877/1222 781/875/1222 796/882/1222
-f 774/876/1223 789/883/1223 790/885/1223
-f 782/877/1224 797/884/1224 798/886/1224
-f 776/863/1225 775/861/1225 790/885/1225
-f 784/864/1226 783/862/1226 798/886/1226
-f 777/865/1227 776/863/1227 791/887/1227
-f 777/865/1230 792/889/1230 793/893/1230
-f 771/870/1231 770/867/1231 785/891/1231
-f 797/884/1232 812/911/1232 813/895/1232
-f 791/887/1233 790/885/1233 805/896/1233
-f 799/888/1234 798/886/1234 813/895/1234
-f 792/889/1235 791/887/1235 806/897/1235
-f 792/889/1238 807/899/1238 808/903/1238
-f 785/891/1239 800/901/1239 801/904/1239
-f 793/893/1240 808/903/1240 809/905/1240
-f 786/894/1241 801/904/1241 802/906/1241
-f 795/880/1242 794/878/1242 809/905/1242
-f 787/879/1243 802/906/1243 803/908/1243
-f 795/880/1244 810/907/1244 811/909/1244
-f 789/883/1245 788/881/1245 803/908/1245
-f 797/884/1246 796/882/1246 811/909/1246
-f 789/883/1247 804/910/1247 805/896/1247
-f 810/907/1248 809/905/1248 825/912/1248
-f 802/906/1249 818/928/1249 819/914/1249
-f 810/907/1250 826/913/1250 827/915/1250
-f 804/910/1251 803/908/1251 819/914/1251
-f 812/911/1252 811/909/1252 827/915/1252
-f 804/910/1253 820/916/1253 821/918/1253
-f 812/911/1254 828/917/1254 829/919/1254
-f 806/897/1255 805/896/1255 821/918/1255
-f 813/895/1256 829/919/1256 830/921/1256
-f 807/899/1257 806/897/1257 822/920/1257
-f 807/899/1260 823/922/1260 824/926/1260
-f 800/901/1261 816/924/1261 817/927/1261
-f 808/903/1262 824/926/1262 825/912/1262
-f 801/904/1263 817/927/1263 818/928/1263
-f 829/919/1264 844/945/1264 845/929/1264
-f 823/922/1265 822/920/1265 837/930/1265
-f 823/922/1268 838/931/1268 839/935/1268
-f 816/924/1269 831/933/1269 832/936/1269
-f 824/926/1270 839/935/1270 840/937/1270
-f 817/927/1271 832/936/1271 833/938/1271
-f 826/913/1272 825/912/1272 840/937/1272
-f 818/928/1273 833/938/1273 834/940/1273
-f 826/913/1274 841/939/1274 842/941/1274
-f 819/914/1275 834/940/1275 835/942/1275
-f 828/917/1276 827/915/1276 842/941/1276
-f 820/916/1277 835/942/1277 836/944/1277
-f 828/917/1278 843/943/1278 844/945/1278
-f 822/920/1279 821/918/1279 836/944/1279
-f 833/938/1280 848/961/1280 849/946/1280
-f 841/939/1281 856/962/1281 857/947/1281
-f 835/942/1282 834/940/1282 849/946/1282
-f 843/943/1283 842/941/1283 857/947/1283
-f 835/942/1284 850/948/1284 851/950/1284
-f 843/943/1285 858/949/1285 859/951/1285
-f 837/930/1286 836/944/1286 851/950/1286
-f 844/945/1287 859/951/1287 860/953/1287
-f 838/931/1288 837/930/1288 852/952/1288
-f 838/931/1291 853/954/1291 854/958/1291
-f 831/933/1292 846/956/1292 847/959/1292
-f 839/935/1293 854/958/1293 855/960/1293
-f 832/936/1294 847/959/1294 848/961/1294
-f 841/939/1295 840/937/1295 855/960/1295
-f 853/954/1296 852/952/1296 867/963/1296
-f 853/954/1299 868/964/1299 869/969/1299
-f 846/956/1300 861/966/1300 862/970/1300
-f 854/958/1301 869/969/1301 870/971/1301
-f 848/961/1302 847/959/1302 862/970/1302
-f 856/962/1303 855/960/1303 870/971/1303
-f 848/961/1304 863/972/1304 864/974/1304
-f 856/962/1305 871/973/1305 872/975/1305
-f 850/948/1306 849/946/1306 864/974/1306
-f 858/949/1307 857/947/1307 872/975/1307
-f 850/948/1308 865/976/1308 866/978/1308
-f 858/949/1309 873/977/1309 874/979/1309
-f 852/952/1310 851/950/1310 866/978/1310
-f 859/951/1311 874/979/1311 875/968/1311
-f 871/980/1312 886/1010/1312 887/981/1312
-f 865/983/1313 864/1011/1313 879/984/1313
-f 873/986/1314 872/982/1314 887/981/1314
-f 865/983/1315 880/985/1315 881/988/1315
-f 873/986/1316 888/987/1316 889/990/1316
-f 867/992/1317 866/989/1317 881/988/1317
-f 874/991/1318 889/990/1318 890/994/1318
-f 868/996/1319 867/992/1319 882/993/1319
-f 868/996/1322 883/997/1322 884/1002/1322
-f 861/998/1323 876/1000/1323 877/1004/1323
-f 869/1003/1324 884/1002/1324 885/1006/1324
-f 863/1008/1325 862/1005/1325 877/1004/1325
-f 871/980/1326 870/1007/1326 885/1006/1326
-f 863/1008/1327 878/1009/1327 879/984/1327
-f 883/997/1330 898/1028/1330 899/1016/1330
-f 876/1000/1331 891/1013/1331 892/1017/1331
-f 884/1002/1332 899/1016/1332 900/1018/1332
-f 878/1009/1333 877/1004/1333 892/1017/1333
-f 886/1010/1334 885/1006/1334 900/1018/1334
-f 878/1009/1335 893/1019/1335 894/1021/1335
-f 886/1010/1336 901/1020/1336 902/1022/1336
-f 880/985/1337 879/984/1337 894/1021/1337
-f 888/987/1338 887/981/1338 902/1022/1338
-f 880/985/1339 895/1023/1339 896/1025/1339
-f 888/987/1340 903/1024/1340 904/1026/1340
-f 882/993/1341 881/988/1341 896/1025/1341
-f 889/990/1342 904/1026/1342 905/1015/1342
-f 883/997/1343 882/993/1343 897/1027/1343
-f 895/1023/1344 894/1021/1344 909/1029/1344
-f 903/1024/1345 902/1022/1345 917/1031/1345
-f 895/1023/1346 910/1030/1346 911/1033/1346
-f 904/1026/1347 903/1024/1347 918/1032/1347
-f 897/1027/1348 896/1025/1348 911/1033/1348
-f 904/1026/1349 919/1034/1349 920/1036/1349
-f 898/1028/1350 897/1027/1350 912/1035/1350
-f 898/1028/1353 913/1037/1353 914/1041/1353
-f 892/1017/1354 891/1013/1354 906/1039/1354
-f 899/1016/1355 914/1041/1355 915/1043/1355
-f 892/1017/1356 907/1042/1356 908/1044/1356
-f 901/1020/1357 900/1018/1357 915/1043/1357
-f 893/1019/1358 908/1044/1358 909/1029/1358
-f 901/1020/1359 916/1045/1359 917/1031/1359
-f 913/1037/1360 928/1059/1360 929/1046/1360
-f 906/1039/1361 921/1061/1361 922/1047/1361
-f 914/1041/1362 929/1046/1362 930/1048/1362
-f 908/1044/1363 907/1042/1363 922/1047/1363
-f 916/1045/1364 915/1043/1364 930/1048/1364
-f 908/1044/1365 923/1049/1365 924/1051/1365
-f 916/1045/1366 931/1050/1366 932/1052/1366
-f 910/1030/1367 909/1029/1367 924/1051/1367
-f 918/1032/1368 917/1031/1368 932/1052/1368
-f 910/1030/1369 925/1053/1369 926/1055/1369
-f 918/1032/1370 933/1054/1370 934/1056/1370
-f 912/1035/1371 911/1033/1371 926/1055/1371
-f 919/1034/1372 934/1056/1372 935/1058/1372
-f 913/1037/1373 912/1035/1373 927/1057/1373
-f 933/1054/1376 932/1052/1376 947/1063/1376
-f 925/1053/1377 940/1079/1377 941/1065/1377
-f 933/1054/1378 948/1064/1378 949/1066/1378
-f 927/1057/1379 926/1055/1379 941/1065/1379
-f 934/1056/1380 949/1066/1380 950/1068/1380
-f 928/1059/1381 927/1057/1381 942/1067/1381
-f 928/1059/1384 943/1069/1384 944/1073/1384
-f 921/1061/1385 936/1071/1385 937/1074/1385
-f 929/1046/1386 944/1073/1386 945/1075/1386
-f 923/1049/1387 922/1047/1387 937/1074/1387
-f 931/1050/1388 930/1048/1388 945/1075/1388
-f 923/1049/1389 938/1076/1389 939/1078/1389
-f 931/1050/1390 946/1077/1390 947/1063/1390
-f 925/1053/1391 924/1051/1391 939/1078/1391
-f 944/1073/1392 959/1095/1392 960/1080/1392
-f 937/1074/1393 952/1096/1393 953/1081/1393
-f 946/1077/1394 945/1075/1394 960/1080/1394
-f 938/1076/1395 953/1081/1395 954/1083/1395
-f 946/1077/1396 961/1082/1396 962/1084/1396
-f 940/1079/1397 939/1078/1397 954/1083/1397
-f 948/1064/1398 947/1063/1398 962/1084/1398
-f 940/1079/1399 955/1085/1399 956/1087/1399
-f 948/1064/1400 963/1086/1400 964/1088/1400
-f 942/1067/1401 941/1065/1401 956/1087/1401
-f 949/1066/1402 964/1088/1402 965/1090/1402
-f 943/1069/1403 942/1067/1403 957/1089/1403
-f 943/1069/1406 958/1091/1406 959/1095/1406
-f 937/1074/1407 936/1071/1407 951/1093/1407
-f 963/1086/1408 978/1113/1408 979/1097/1408
-f 957/1089/1409 956/1087/1409 971/1098/1409
-f 965/1090/1410 964/1088/1410 979/1097/1410
-f 958/1091/1411 957/1089/1411 972/1099/1411
-f 958/1091/1414 973/1101/1414 974/1105/1414
-f 951/1093/1415 966/1103/1415 967/1106/1415
-f 959/1095/1416 974/1105/1416 975/1107/1416
-f 953/1081/1417 952/1096/1417 967/1106/1417
-f 961/1082/1418 960/1080/1418 975/1107/1418
-f 953/1081/1419 968/1108/1419 969/1110/1419
-f 961/1082/1420 976/1109/1420 977/1111/1420
-f 955/1085/1421 954/1083/1421 969/1110/1421
-f 963/1086/1422 962/1084/1422 977/1111/1422
-f 955/1085/1423 970/1112/1423 971/1098/1423
-f 968/1108/1424 967/1106/1424 982/588/1424
-f 975/1107/1425 985/559/1425 513/564/1425
-f 969/1110/1426 968/1108/1426 508/560/1426
-f 976/1109/1427 513/564/1427 986/568/1427
-f 970/1112/1428 969/1110/1428 983/565/1428
-f 978/1113/1429 977/1111/1429 986/568/1429
-f 971/1098/1430 970/1112/1430 509/569/1430
-f 978/1113/1431 987/572/1431 988/576/1431
-f 972/1099/1432 971/1098/1432 984/573/1432
-f 979/1097/1433 988/576/1433 989/580/1433
-f 973/1101/1434 972/1099/1434 510/577/1434
-f 973/1101/1437 511/582/1437 512/557/1437
-f 967/1106/1438 966/1103/1438 981/583/1438
-f 974/1105/1439 512/557/1439 985/559/1439
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'monkey.blend'
-# www.blender.org
-
-newmtl Material.001
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.231375 0.102943
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-
-newmtl Material.003
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.532820 0.125234
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-)X"},{.name = "cone", .scene = R"X(# path to .obj file
-o models/cone.obj
-
-# path to .mtl file
-m models/cone.mtl
-
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
-
-# camera position vector
-cp -10.0 10.0 -35.0
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib cone.mtl
-o Cone
-v 0.000000 -0.365573 -1.000000
-v 0.195090 -0.365573 -0.980785
-v 0.382683 -0.365573 -0.923880
-v 0.555570 -0.365573 -0.831470
-v 0.707107 -0.365573 -0.707107
-v 0.831470 -0.365573 -0.555570
-v 0.923880 -0.365573 -0.382683
-v 0.980785 -0.365573 -0.195090
-v 1.000000 -0.365573 0.000000
-v 0.980785 -0.365573 0.195090
-v 0.923880 -0.365573 0.382683
-v 0.831470 -0.365573 0.555570
-v 0.707107 -0.365573 0.707107
-v 0.555570 -0.365573 0.831470
-v 0.382683 -0.365573 0.923880
-v 0.195090 -0.365573 0.980785
-v 0.000000 -0.365573 1.000000
-v -0.195090 -0.365573 0.980785
-v -0.382683 -0.365573 0.923880
-v -0.555570 -0.365573 0.831470
-v -0.707107 -0.365573 0.707107
-v -0.831470 -0.365573 0.555570
-v -0.923880 -0.365573 0.382683
-v -0.980785 -0.365573 0.195090
-v -1.000000 -0.365573 0.000000
-v -0.980785 -0.365573 -0.195090
-v -0.923880 -0.365573 -0.382683
-v -0.831470 -0.365573 -0.555570
-v -0.707107 -0.365573 -0.707107
-v -0.555570 -0.365573 -0.831470
-v -0.382683 -0.365573 -0.923880
-v -0.195090 -0.365573 -0.980785
-v 0.000000 1.634427 0.000000
-vn 0.0878 0.4455 -0.8910
-vn 0.2599 0.4455 -0.8567
-vn 0.4220 0.4455 -0.7896
-vn 0.5680 0.4455 -0.6921
-vn 0.6921 0.4455 -0.5680
-vn 0.7896 0.4455 -0.4220
-vn 0.8567 0.4455 -0.2599
-vn 0.8910 0.4455 -0.0878
-vn 0.8910 0.4455 0.0878
-vn 0.8567 0.4455 0.2599
-vn 0.7896 0.4455 0.4220
-vn 0.6921 0.4455 0.5680
-vn 0.5680 0.4455 0.6921
-vn 0.4220 0.4455 0.7896
-vn 0.2599 0.4455 0.8567
-vn 0.0878 0.4455 0.8910
-vn -0.0878 0.4455 0.8910
-vn -0.2599 0.4455 0.8567
-vn -0.4220 0.4455 0.7896
-vn -0.5680 0.4455 0.6921
-vn -0.6921 0.4455 0.5680
-vn -0.7896 0.4455 0.4220
-vn -0.8567 0.4455 0.2599
-vn -0.8910 0.4455 0.0878
-vn -0.8910 0.4455 -0.0878
-vn -0.8567 0.4455 -0.2599
-vn -0.7896 0.4455 -0.4220
-vn -0.6921 0.4455 -0.5680
-vn -0.5680 0.4455 -0.6921
-vn -0.4220 0.4455 -0.7896
-vn -0.0000 -1.0000 -0.0000
-vn -0.2599 0.4455 -0.8567
-vn -0.0878 0.4455 -0.8910
-vt 0.250000 0.490000
-vt 0.250000 0.250000
-vt 0.296822 0.485388
-vt 0.341844 0.471731
-vt 0.383337 0.449553
-vt 0.419706 0.419706
-vt 0.449553 0.383337
-vt 0.471731 0.341844
-vt 0.485388 0.296822
-vt 0.490000 0.250000
-vt 0.485388 0.203178
-vt 0.471731 0.158156
-vt 0.449553 0.116663
-vt 0.419706 0.080294
-vt 0.383337 0.050447
-vt 0.341844 0.028269
-vt 0.296822 0.014612
-vt 0.250000 0.010000
-vt 0.203178 0.014612
-vt 0.158156 0.028269
-vt 0.116663 0.050447
-vt 0.080294 0.080294
-vt 0.050447 0.116663
-vt 0.028269 0.158156
-vt 0.014612 0.203178
-vt 0.010000 0.250000
-vt 0.014612 0.296822
-vt 0.028269 0.341844
-vt 0.050447 0.383337
-vt 0.080294 0.419706
-vt 0.116663 0.449553
-vt 0.158156 0.471731
-vt 0.750000 0.490000
-vt 0.796822 0.485388
-vt 0.841844 0.471731
-vt 0.883337 0.449553
-vt 0.919706 0.419706
-vt 0.949553 0.383337
-vt 0.971731 0.341844
-vt 0.985388 0.296822
-vt 0.990000 0.250000
-vt 0.985388 0.203178
-vt 0.971731 0.158156
-vt 0.949553 0.116663
-vt 0.919706 0.080294
-vt 0.883337 0.050447
-vt 0.841844 0.028269
-vt 0.796822 0.014612
-vt 0.750000 0.010000
-vt 0.703178 0.014612
-vt 0.658156 0.028269
-vt 0.616663 0.050447
-vt 0.580294 0.080294
-vt 0.550447 0.116663
-vt 0.528269 0.158156
-vt 0.514612 0.203178
-vt 0.510000 0.250000
-vt 0.514612 0.296822
-vt 0.528269 0.341844
-vt 0.550447 0.383337
-vt 0.580294 0.419706
-vt 0.616663 0.449553
-vt 0.658156 0.471731
-vt 0.703178 0.485388
-vt 0.203178 0.485388
-s 0
-usemtl Material.001
-f 1/1/1 33/2/1 2/3/1
-f 2/3/2 33/2/2 3/4/2
-f 3/4/3 33/2/3 4/5/3
-f 4/5/4 33/2/4 5/6/4
-f 5/6/5 33/2/5 6/7/5
-f 6/7/6 33/2/6 7/8/6
-f 7/8/7 33/2/7 8/9/7
-f 8/9/8 33/2/8 9/10/8
-f 9/10/9 33/2/9 10/11/9
-f 10/11/10 33/2/10 11/12/10
-f 11/12/11 33/2/11 12/13/11
-f 12/13/12 33/2/12 13/14/12
-f 13/14/13 33/2/13 14/15/13
-f 14/15/14 33/2/14 15/16/14
-f 15/16/15 33/2/15 16/17/15
-f 16/17/16 33/2/16 17/18/16
-f 17/18/17 33/2/17 18/19/17
-f 18/19/18 33/2/18 19/20/18
-f 19/20/19 33/2/19 20/21/19
-f 20/21/20 33/2/20 21/22/20
-f 21/22/21 33/2/21 22/23/21
-f 22/23/22 33/2/22 23/24/22
-f 23/24/23 33/2/23 24/25/23
-f 24/25/24 33/2/24 25/26/24
-f 25/26/25 33/2/25 26/27/25
-f 26/27/26 33/2/26 27/28/26
-f 27/28/27 33/2/27 28/29/27
-f 28/29/28 33/2/28 29/30/28
-f 29/30/29 33/2/29 30/31/29
-f 30/31/30 33/2/30 31/32/30
-f 1/33/31 2/34/31 3/35/31 4/36/31 5/37/31 6/38/31 7/39/31 8/40/31 9/41/31 10/42/31 11/43/31 12/44/31 13/45/31 14/46/31 15/47/31 16/48/31 17/49/31 18/50/31 19/51/31 20/52/31 21/53/31 22/54/31 23/55/31 24/56/31 25/57/31 26/58/31 27/59/31 28/60/31 29/61/31 30/62/31 31/63/31 32/64/31
-f 31/32/32 33/2/32 32/65/32
-f 32/65/33 33/2/33 1/1/33
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'None'
-# www.blender.org
-
-newmtl Material.001
-Ns 250.000000
-Ka 1.000000 1.000000 1.000000
-Kd 0.800000 0.661643 0.111813
-Ks 0.500000 0.500000 0.500000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 2
-)X"},{.name = "tree", .scene = R"X(# path to .obj file
-o models/tree.obj
-
-# path to .mtl file
-m models/tree.mtl
-
-# light positions
-l -1.0 -1.0 -1.0
-l -1.0 1.0 1.0
-l 1.0 1.0 1.0
-l 1.0 -1.0 1.0
-
-# camera position vector
-cp 0 0 -10
-# camera target vector (look at)
-ct 0.0 0.0 0.0
-# camera up vector
-cu 0.0 1.0 0.0
-)X",.obj = R"X(# Blender 3.6.0
-# www.blender.org
-mtllib tree.mtl
-o Tree_lp_11
-v -0.052475 -1.284741 0.137038
-v -0.153072 -1.280629 0.249966
-v -0.090626 -1.280111 0.386036
-v 0.054583 -1.283147 0.417629
-v 0.142838 -1.287068 0.297530
-v 0.100376 -1.288223 0.151115
-v 0.078688 -0.931034 0.145363
-v 0.063432 -0.874157 0.195763
-v 0.098151 -0.866016 0.266679
-v 0.152378 -0.922734 0.283766
-v 0.167634 -0.979611 0.233366
-v 0.132915 -0.987751 0.162450
-v 0.259035 -0.755803 0.038165
-v 0.228499 -0.720438 0.095612
-v 0.261892 -0.721459 0.159556
-v 0.330715 -0.745040 0.168874
-v 0.357986 -0.786212 0.113695
-v 0.319057 -0.795029 0.053597
-v 0.354873 -0.466491 -0.033995
-v 0.317914 -0.435754 0.016084
-v 0.345759 -0.422369 0.076042
-v 0.412953 -0.431368 0.089180
-v 0.446704 -0.470810 0.043096
-v 0.416741 -0.489943 -0.014224
-v 0.461062 -0.242410 -0.186525
-v 0.432967 -0.211350 -0.144376
-v 0.461849 -0.176180 -0.101325
-v 0.519320 -0.198840 -0.090363
-v 0.544640 -0.238044 -0.127141
-v 0.523061 -0.251788 -0.184324
-v 0.532991 0.000980 -0.330107
-v 0.494374 0.029270 -0.300993
-v 0.513216 0.061850 -0.258401
-v 0.568200 0.064550 -0.249796
-v 0.606216 0.046600 -0.286835
-v 0.587457 0.012590 -0.328330
-v 0.450482 0.232780 -0.544129
-v 0.419017 0.241170 -0.507671
-v 0.429636 0.272490 -0.467509
-v 0.481238 0.277430 -0.463152
-v 0.512365 0.270260 -0.500158
-v 0.497229 0.255330 -0.547638
-v 0.399985 0.521740 -0.554387
-v 0.373223 0.528690 -0.522455
-v 0.386047 0.541000 -0.484317
-v 0.427885 0.540830 -0.475662
-v 0.454164 0.527250 -0.505818
-v 0.441747 0.520530 -0.545454
-v -0.132999 -0.907085 0.238198
-v -0.155759 -0.959595 0.290371
-v -0.127446 -0.965163 0.364234
-v -0.071363 -0.910743 0.382427
-v -0.048603 -0.858233 0.330254
-v -0.076917 -0.852665 0.256390
-v -0.313891 -0.721919 0.335466
-v -0.354369 -0.748501 0.390897
-v -0.318725 -0.756023 0.454366
-v -0.255970 -0.724426 0.467898
-v -0.219822 -0.688887 0.414531
-v -0.247852 -0.697112 0.347432
-v -0.369165 -0.402208 0.357404
-v -0.408153 -0.417623 0.415316
-v -0.381857 -0.422043 0.477287
-v -0.312958 -0.409836 0.491891
-v -0.273953 -0.418515 0.432606
-v -0.300248 -0.415899 0.370532
-v -0.308732 -0.110440 0.381033
-v -0.343606 -0.119120 0.428147
-v -0.328627 -0.101940 0.487855
-v -0.266283 -0.112660 0.494128
-v -0.231540 -0.120330 0.446742
-v -0.246225 -0.100930 0.387643
-v -0.348996 0.176820 0.380980
-v -0.390333 0.166350 0.419364
-v -0.371347 0.162750 0.473900
-v -0.318115 0.175660 0.485464
-v -0.283285 0.203290 0.449193
-v -0.299599 0.199840 0.393789
-v -0.400133 -0.336689 0.379881
-v -0.313923 -0.376019 0.391545
-v -0.434707 -0.402266 0.365013
-v -0.349063 -0.449622 0.375883
-v -0.450992 -0.409962 0.438446
-v -0.367443 -0.457989 0.456442
-v -0.416418 -0.344384 0.453315
-v -0.332303 -0.384386 0.472104
-v -0.539095 -0.246222 0.341262
-v -0.590213 -0.285699 0.318865
-v -0.610893 -0.291007 0.383805
-v -0.572877 -0.236519 0.399894
-v -0.674064 -0.074480 0.331454
-v -0.710149 -0.119350 0.310224
-v -0.723338 -0.135970 0.367802
-v -0.687331 -0.091050 0.389032
-v -0.769876 -0.022830 0.318926
-v -0.810324 -0.060800 0.299720
-v -0.809920 -0.084000 0.353651
-v -0.782275 -0.036640 0.374624
-v -0.846285 0.066230 0.401821
-v -0.895731 0.045210 0.388657
-v -0.888589 0.007210 0.428209
-v -0.843099 0.033140 0.446036
-v -0.228227 -0.629407 0.379130
-v -0.287672 -0.703446 0.343194
-v -0.254328 -0.637775 0.455743
-v -0.317736 -0.714719 0.427379
-v -0.191518 -0.687086 0.471362
-v -0.249943 -0.771703 0.443959
-v -0.165417 -0.678719 0.394750
-v -0.219879 -0.760430 0.359774
-v -0.065000 -0.530065 0.422250
-v -0.089423 -0.527157 0.475943
-v -0.072812 -0.582573 0.487820
-v -0.048388 -0.585481 0.434127
-v 0.031214 -0.497599 0.494968
-v 0.002987 -0.492872 0.543705
-v 0.013373 -0.547965 0.550871
-v 0.056727 -0.543956 0.514832
-v 0.097366 -0.449346 0.559021
-v 0.063503 -0.445263 0.599567
-v 0.095342 -0.474982 0.629741
-v 0.123368 -0.486591 0.586299
-v 0.142008 -0.365153 0.558828
-v 0.121664 -0.348484 0.601532
-v 0.163447 -0.361865 0.625833
-v 0.185446 -0.373785 0.582366
-v 0.163962 -0.229404 0.524620
-v 0.146076 -0.234938 0.571937
-v 0.191164 -0.220502 0.590594
-v 0.207711 -0.241818 0.547452
-v 0.154687 -0.093690 0.521038
-v 0.140554 -0.112240 0.562508
-v 0.181029 -0.096550 0.581977
-v 0.194363 -0.112620 0.539230
-v -0.215729 -0.495410 0.488858
-v -0.235035 -0.541921 0.519990
-v -0.180345 -0.552638 0.539973
-v -0.161039 -0.506127 0.508841
-v -0.226412 -0.429734 0.602643
-v -0.244926 -0.476837 0.626376
-v -0.191809 -0.490196 0.637546
-v -0.175831 -0.438143 0.624903
-v -0.258399 -0.403101 0.704733
-v -0.274287 -0.451032 0.719829
-v -0.233356 -0.454698 0.752827
-v -0.213677 -0.410668 0.731572
-v -0.314679 -0.346995 0.757646
-v -0.344636 -0.368024 0.791739
-v -0.307754 -0.365999 0.825468
-v -0.277663 -0.345366 0.791250
-v -0.317157 -0.220011 0.760302
-v -0.347714 -0.236018 0.795358
-v -0.315146 -0.224371 0.830322
-v -0.281727 -0.220975 0.794399
-v -0.373280 -0.095840 0.776682
-v -0.390473 -0.129400 0.809776
-v -0.369858 -0.099550 0.844431
-v -0.336631 -0.109400 0.808151
-v 0.574800 -0.049210 -0.334066
-v 0.556824 -0.035310 -0.223293
-v 0.579319 -0.112540 -0.325433
-v 0.562471 -0.107230 -0.216182
-v 0.517074 -0.118620 -0.339389
-v 0.491558 -0.114130 -0.229590
-v 0.512555 -0.055290 -0.348023
-v 0.485911 -0.042200 -0.236701
-v 0.601564 -0.067620 -0.440411
-v 0.605398 -0.126070 -0.429232
-v 0.546197 -0.129450 -0.435530
-v 0.546079 -0.075440 -0.460808
-v 0.627901 -0.120880 -0.543668
-v 0.617475 -0.167460 -0.512163
-v 0.573833 -0.178430 -0.547459
-v 0.571131 -0.121390 -0.550577
-v 0.689322 -0.148470 -0.631837
-v 0.686041 -0.200630 -0.626519
-v 0.650352 -0.202780 -0.665012
-v 0.647504 -0.150340 -0.663583
-v 0.762143 -0.140220 -0.700824
-v 0.790282 -0.183890 -0.715082
-v 0.750426 -0.179980 -0.751119
-v 0.763472 -0.127750 -0.753219
-v 0.896624 -0.111150 -0.717408
-v 0.925974 -0.149360 -0.723768
-v 0.904398 -0.146130 -0.767189
-v 0.905387 -0.097700 -0.763269
-v 0.185614 0.053340 0.571291
-v -0.410729 0.034550 0.813641
-v 1.084660 0.816360 -0.306866
-v 0.687322 1.207390 -0.147703
-v 0.590952 0.642890 -0.057309
-v 0.806006 0.349860 -0.508968
-v 0.236455 0.452580 -0.474712
-v 0.163104 0.982560 -0.251438
-v 0.961936 1.263230 -0.655228
-v 1.035290 0.733250 -0.878499
-v 0.607439 1.072920 -1.072629
-v 0.511069 0.508420 -0.982239
-v 0.113734 0.899450 -0.823079
-v 0.392385 1.365950 -0.620973
-v -0.809040 0.937050 0.854069
-v -0.085171 0.889720 0.961057
-v -0.350264 1.326450 0.435070
-v -0.499437 0.285120 0.983719
-v 0.150683 0.271610 0.644849
-v 0.242877 0.915190 0.305765
-v -0.928367 0.991770 0.132654
-v -0.692512 0.373660 -0.183554
-v -1.020560 0.348190 0.471737
-v -0.427419 -0.063070 0.342432
-v 0.031357 0.326340 -0.076566
-v -0.278246 0.978260 -0.206216
-v -1.204430 0.458270 0.940395
-v -1.086490 0.713260 0.565598
-v -1.406190 0.373190 0.526321
-v -1.272750 0.016830 0.799458
-v -1.197030 -0.001010 0.337556
-v -1.081910 0.429410 0.193023
-v -0.755456 0.567080 0.863010
-v -0.870571 0.136660 1.007543
-v -0.546294 0.192880 0.674246
-v -0.865997 -0.147190 0.634969
-v -0.748055 0.107800 0.260171
-v -0.679736 0.549240 0.401108
-v 0.002607 0.120970 0.392162
-v 0.176198 0.313270 0.492694
-v 0.272727 0.111660 0.327597
-v 0.136490 -0.122520 0.389380
-v 0.392825 -0.080710 0.488192
-v 0.417366 0.188630 0.552043
-v -0.019698 0.203690 0.656512
-v -0.044239 -0.065650 0.592661
-v 0.100400 0.011320 0.817106
-v 0.196930 -0.190290 0.652010
-v 0.370520 0.002010 0.752542
-v 0.236637 0.245500 0.755324
-v 1.391920 -0.074170 -0.823019
-v 1.156900 -0.277343 -0.985749
-v 1.164490 0.067480 -1.049320
-v 1.225130 -0.326299 -0.645240
-v 0.894605 -0.340483 -0.761659
-v 0.857131 -0.097120 -1.011400
-v 1.237410 0.231630 -0.748099
-v 0.975122 0.168490 -0.524009
-v 1.274890 -0.011740 -0.498363
-v 0.967527 -0.176330 -0.460440
-v 0.740095 -0.034690 -0.686737
-v 0.906893 0.217450 -0.864519
-v 0.200384 0.927220 -0.180710
-v 0.454963 1.052920 0.056536
-v 0.304216 0.718790 0.106825
-v -0.052979 0.739140 0.012506
-v 0.045012 0.748610 0.369166
-v 0.358938 0.942540 0.396379
-v 0.190933 1.279780 -0.068863
-v -0.122992 1.085850 -0.096075
-v -0.068271 1.309590 0.193478
-v -0.219017 0.975460 0.243767
-v 0.035562 1.101170 0.481014
-v 0.288925 1.289250 0.287797
-v -0.036303 -0.974059 0.160229
-v -0.126129 -0.993867 0.255130
-v -0.071418 -0.995004 0.358253
-v -0.118249 -0.625920 0.413371
-v 0.048326 -0.979050 0.383298
-v 0.131858 -1.010241 0.284964
-v 0.085420 -1.006821 0.177663
-v -0.004828 -0.864506 0.222169
-v 0.032443 -0.866704 0.320408
-v -0.191764 -0.574684 0.396989
-v -0.225408 -0.578848 0.480698
-v -0.152244 -0.622844 0.487112
-v -0.144617 -0.535523 0.463483
-v -0.414722 0.035320 0.786495
-v -0.433194 0.013380 0.816956
-v -0.406593 0.033300 0.840775
-v 0.158185 0.036410 0.580375
-v 0.194016 0.027140 0.593120
-v -0.385257 0.045700 0.810066
-v 0.173995 0.051940 0.545868
-v 0.209998 0.044140 0.558805
-vn -0.7072 0.3531 -0.6126
-vn -0.5765 0.7945 0.1910
-vn -0.5764 0.7945 0.1910
-vn 0.1575 0.4199 0.8938
-vn 0.1575 0.4198 0.8938
-vn 0.7230 -0.3392 0.6018
-vn 0.6240 -0.7500 -0.2194
-vn -0.1249 -0.3938 -0.9107
-vn -0.8344 0.1437 -0.5320
-vn -0.8797 0.3396 0.3328
-vn -0.8798 0.3396 0.3327
-vn -0.0428 0.2565 0.9656
-vn -0.0428 0.2566 0.9656
-vn 0.8608 -0.0989 0.4992
-vn 0.8124 -0.3353 -0.4770
-vn 0.8124 -0.3353 -0.4771
-vn 0.0893 -0.2433 -0.9658
-vn -0.8070 -0.0084 -0.5904
-vn -0.8070 -0.0084 -0.5905
-vn -0.7961 0.5528 0.2463
-vn -0.0738 0.6056 0.7923
-vn 0.8270 0.0538 0.5596
-vn 0.8087 -0.5353 -0.2440
-vn 0.8086 -0.5353 -0.2440
-vn 0.0336 -0.5908 -0.8061
-vn 0.0337 -0.5908 -0.8061
-vn -0.8612 -0.1040 -0.4975
-vn -0.8612 -0.1040 -0.4974
-vn -0.8787 0.3969 0.2653
-vn 0.0383 0.5122 0.8580
-vn 0.8632 0.0918 0.4964
-vn 0.8629 0.0909 0.4971
-vn 0.9037 -0.3409 -0.2591
-vn -0.0399 -0.4705 -0.8815
-vn -0.0399 -0.4704 -0.8815
-vn -0.7140 -0.5949 -0.3691
-vn -0.7141 -0.5949 -0.3690
-vn -0.9204 0.0222 0.3902
-vn -0.9205 0.0222 0.3902
-vn -0.9204 0.0222 0.3903
-vn -0.1467 0.6697 0.7280
-vn -0.1468 0.6697 0.7280
-vn 0.6693 0.6403 0.3768
-vn 0.6694 0.6403 0.3768
-vn 0.9169 -0.0194 -0.3987
-vn 0.9169 -0.0194 -0.3986
-vn 0.1588 -0.6287 -0.7612
-vn 0.1589 -0.6287 -0.7612
-vn -0.7653 -0.1559 -0.6245
-vn -0.9288 -0.1301 0.3471
-vn -0.0886 0.0479 0.9949
-vn 0.7694 0.1849 0.6114
-vn 0.9152 0.1944 -0.3529
-vn -0.0533 -0.0447 -0.9976
-vn -0.6868 -0.3404 -0.6422
-vn -0.6642 -0.7203 0.2003
-vn 0.0463 -0.3593 0.9321
-vn 0.6660 0.3603 0.6532
-vn 0.6660 0.3603 0.6531
-vn 0.6098 0.7729 -0.1755
-vn 0.6098 0.7728 -0.1755
-vn -0.0870 0.3953 -0.9144
-vn -0.0870 0.3954 -0.9144
-vn -0.8149 -0.0902 -0.5726
-vn -0.8148 -0.0902 -0.5726
-vn -0.8648 -0.1952 0.4625
-vn -0.8648 -0.1952 0.4626
-vn -0.1888 -0.1027 0.9766
-vn 0.8376 0.1109 0.5349
-vn 0.8376 0.1109 0.5348
-vn 0.8952 0.1995 -0.3984
-vn 0.1438 0.0925 -0.9853
-vn -0.8364 0.2028 -0.5092
-vn -0.9082 0.1380 0.3952
-vn -0.2078 0.0023 0.9782
-vn -0.2077 0.0023 0.9782
-vn 0.8190 -0.1328 0.5583
-vn 0.8190 -0.1328 0.5582
-vn 0.9103 -0.1349 -0.3913
-vn 0.1910 0.0205 -0.9814
-vn 0.1910 0.0206 -0.9814
-vn -0.6647 -0.0933 -0.7413
-vn -0.9487 -0.1467 0.2802
-vn -0.0980 0.0123 0.9951
-vn 0.6772 0.1028 0.7286
-vn 0.9693 0.1564 -0.1895
-vn 0.0994 0.0380 -0.9943
-vn 0.1886 0.1175 -0.9750
-vn 0.1886 0.1174 -0.9750
-vn -0.4557 -0.8687 -0.1942
-vn -0.2552 -0.0835 0.9633
-vn 0.3876 0.9036 0.1822
-vn 0.2433 0.2481 -0.9377
-vn -0.4474 -0.8267 -0.3412
-vn -0.2710 -0.2251 0.9359
-vn 0.4119 0.8461 0.3383
-vn -0.1446 0.5650 -0.8123
-vn -0.1446 0.5649 -0.8123
-vn -0.8398 -0.5010 -0.2092
-vn 0.2174 -0.4985 0.8392
-vn 0.8438 0.4461 0.2985
-vn 0.8438 0.4461 0.2984
-vn -0.7284 0.6634 -0.1713
-vn -0.3095 -0.0927 0.9464
-vn 0.7758 -0.5995 0.1968
-vn 0.3567 0.1565 -0.9210
-vn 0.3567 0.1564 -0.9210
-vn -0.2131 0.9656 -0.1492
-vn -0.2130 0.9656 -0.1492
-vn -0.5904 -0.0039 0.8071
-vn 0.2499 -0.9540 0.1654
-vn 0.6061 0.0113 -0.7953
-vn 0.6061 0.0112 -0.7953
-vn -0.3604 0.8851 -0.2945
-vn -0.3604 0.8851 -0.2946
-vn -0.6779 -0.0323 0.7344
-vn 0.3891 -0.8417 0.3745
-vn 0.3891 -0.8417 0.3744
-vn 0.6970 0.0782 -0.7128
-vn 0.6970 0.0782 -0.7127
-vn -0.7269 0.4474 -0.5210
-vn -0.7269 0.4474 -0.5209
-vn -0.4143 0.2794 0.8662
-vn 0.7501 -0.4344 0.4987
-vn 0.4193 -0.2611 -0.8695
-vn -0.8970 0.0340 -0.4406
-vn -0.8970 0.0340 -0.4407
-vn -0.4079 0.2953 0.8640
-vn -0.4079 0.2953 0.8639
-vn 0.9163 -0.0820 0.3920
-vn 0.9163 -0.0819 0.3920
-vn 0.9163 -0.0820 0.3919
-vn 0.3793 -0.2833 -0.8808
-vn -0.9301 -0.0731 -0.3601
-vn -0.9300 -0.0731 -0.3601
-vn -0.3909 0.0320 0.9199
-vn 0.9452 0.1170 0.3047
-vn 0.9452 0.1171 0.3047
-vn 0.4645 0.0084 -0.8855
-vn -0.9439 0.2398 -0.2270
-vn -0.3319 -0.8181 0.4696
-vn 0.9420 -0.2231 0.2507
-vn 0.3263 0.8332 -0.4464
-vn 0.3264 0.8332 -0.4464
-vn -0.9212 0.1915 -0.3386
-vn -0.2769 -0.9419 0.1902
-vn 0.9050 -0.1848 0.3831
-vn 0.9051 -0.1848 0.3831
-vn 0.2319 0.9587 -0.1647
-vn 0.2318 0.9587 -0.1647
-vn -0.7077 0.0121 -0.7064
-vn -0.4474 -0.7606 0.4705
-vn 0.7113 0.0212 0.7026
-vn 0.4022 0.8004 -0.4446
-vn -0.7539 0.0004 -0.6570
-vn -0.7201 -0.0613 0.6912
-vn -0.7201 -0.0613 0.6911
-vn 0.7314 0.0148 0.6818
-vn 0.6712 0.0286 -0.7407
-vn -0.7336 -0.2481 -0.6327
-vn -0.6235 -0.3522 0.6980
-vn -0.6235 -0.3522 0.6981
-vn 0.7013 0.2312 0.6743
-vn 0.7014 0.2312 0.6743
-vn 0.6469 0.3796 -0.6614
-vn 0.9847 0.0920 0.1483
-vn 0.0852 -0.9945 0.0605
-vn -0.9704 -0.0981 -0.2208
-vn -0.0709 0.9886 -0.1332
-vn 0.9689 0.1000 0.2265
-vn 0.0640 -0.9874 0.1447
-vn -0.9582 -0.1047 -0.2661
-vn -0.0529 0.9802 -0.1909
-vn 0.9753 0.1015 0.1964
-vn 0.0094 -0.9152 0.4029
-vn -0.9753 -0.0953 -0.1991
-vn 0.0397 0.8921 -0.4501
-vn 0.0397 0.8921 -0.4500
-vn 0.8666 0.1316 0.4814
-vn 0.0533 -0.9704 0.2357
-vn -0.8426 -0.0691 -0.5341
-vn 0.0967 0.9779 -0.1852
-vn 0.6435 0.0375 0.7645
-vn 0.0348 -0.9887 -0.1459
-vn -0.6101 -0.0115 -0.7922
-vn -0.6101 -0.0116 -0.7922
-vn -0.1178 0.9883 0.0967
-vn 0.1218 -0.2362 0.9640
-vn 0.1948 -0.9662 -0.1687
-vn 0.1948 -0.9662 -0.1686
-vn -0.1005 -0.0149 -0.9948
-vn -0.1005 -0.0148 -0.9948
-vn -0.1867 0.9568 0.2230
-vn -0.1868 0.9568 0.2230
-vn -0.7422 0.0882 -0.6643
-vn -0.7422 0.0882 -0.6644
-vn -0.9062 0.0777 0.4156
-vn -0.2093 0.1054 0.9722
-vn -0.2093 0.1054 0.9721
-vn 0.8043 0.0830 0.5884
-vn 0.8043 0.0830 0.5883
-vn 0.9574 0.0771 -0.2783
-vn 0.0931 0.0693 -0.9932
-vn -0.3018 0.5334 -0.7902
-vn -0.3017 0.5334 -0.7902
-vn 0.0060 0.9998 0.0201
-vn 0.4544 0.4832 0.7484
-vn 0.7264 -0.1612 0.6681
-vn 0.7264 -0.1612 0.6682
-vn 0.4358 -0.8736 -0.2165
-vn 0.4358 -0.8736 -0.2164
-vn 0.0269 -0.3899 -0.9205
-vn -0.6928 -0.1905 -0.6955
-vn -0.6928 -0.1906 -0.6955
-vn -0.4395 -0.8700 0.2236
-vn -0.1213 -0.2001 0.9722
-vn -0.1213 -0.2001 0.9723
-vn 0.2787 0.4988 0.8207
-vn 0.1465 0.9886 -0.0335
-vn 0.1465 0.9886 -0.0334
-vn -0.2768 0.5320 -0.8002
-vn -0.8017 0.5190 -0.2964
-vn -0.1678 -0.1368 0.9763
-vn -0.1678 -0.1367 0.9763
-vn 0.6449 -0.6912 0.3261
-vn 0.6449 -0.6912 0.3262
-vn 0.2763 0.0906 -0.9568
-vn -0.2935 0.9380 -0.1843
-vn -0.2934 0.9380 -0.1843
-vn -0.1455 0.2703 0.9517
-vn -0.1455 0.2702 0.9517
-vn 0.4375 -0.8672 0.2379
-vn 0.2028 -0.0220 -0.9790
-vn -0.9535 0.1689 -0.2494
-vn -0.9535 0.1690 -0.2494
-vn -0.4137 -0.0601 0.9084
-vn 0.9302 -0.1354 0.3411
-vn 0.4423 0.0676 -0.8943
-vn -0.9209 0.1423 -0.3630
-vn -0.4428 -0.6457 0.6221
-vn 0.9022 0.0375 0.4298
-vn 0.2165 0.7664 -0.6048
-vn 0.2158 0.7668 -0.6046
-vn -0.7714 -0.2004 -0.6040
-vn -0.5613 -0.2082 0.8010
-vn 0.7481 0.2269 0.6236
-vn 0.5719 0.1892 -0.7982
-vn 0.5719 0.1891 -0.7982
-vn 0.0761 0.8957 0.4380
-vn 0.0762 0.8957 0.4380
-vn 0.0762 0.8958 0.4380
-vn 0.0761 0.8958 0.4380
-vn 0.0295 0.8902 0.4547
-vn 0.9094 -0.0522 -0.4127
-vn -0.6650 0.7360 0.1269
-vn -0.3964 0.9133 0.0934
-vn 0.9485 0.2882 -0.1313
-vn -0.3485 -0.1574 0.9240
-vn -0.7687 -0.5694 -0.2914
-vn -0.7687 -0.5694 -0.2913
-vn 0.7302 0.5932 0.3389
-vn 0.2899 0.1600 -0.9436
-vn -0.3440 -0.0314 0.9384
-vn -0.5381 -0.8175 -0.2050
-vn 0.4954 0.8457 0.1985
-vn 0.3015 0.0568 -0.9518
-vn 0.4301 0.0707 0.9000
-vn 0.5204 -0.5817 0.6252
-vn -0.1249 -0.8584 0.4975
-vn -0.6140 -0.3771 0.6934
-vn -0.2710 0.1971 0.9422
-vn 0.6140 0.3771 -0.6934
-vn 0.2710 -0.1971 -0.9422
-vn -0.4301 -0.0707 -0.9000
-vn -0.5204 0.5817 -0.6252
-vn 0.1249 0.8584 -0.4975
-vn 0.7123 0.5426 0.4451
-vn 0.8584 -0.5129 0.0004
-vn -0.1857 -0.9607 -0.2062
-vn -0.9770 -0.1819 0.1108
-vn -0.4221 0.7472 0.5134
-vn 0.9770 0.1819 -0.1108
-vn 0.4221 -0.7472 -0.5134
-vn -0.7123 -0.5426 -0.4451
-vn -0.8584 0.5129 -0.0004
-vn 0.1857 0.9607 0.2062
-vn -0.0469 0.7568 0.6520
-vn -0.1366 0.1304 0.9820
-vn 0.4407 -0.2698 0.8562
-vn 0.8872 0.1091 0.4484
-vn 0.5858 0.7436 0.3222
-vn -0.8872 -0.1091 -0.4484
-vn -0.5858 -0.7436 -0.3222
-vn 0.0469 -0.7568 -0.6520
-vn 0.1366 -0.1304 -0.9820
-vn -0.4407 0.2698 -0.8562
-vn -0.5541 0.8182 0.1537
-vn -0.6993 -0.1953 0.6877
-vn 0.2348 -0.8430 0.4841
-vn 0.9573 -0.2297 -0.1758
-vn 0.4697 0.7969 -0.3799
-vn -0.9573 0.2297 0.1758
-vn -0.4697 -0.7969 0.3799
-vn 0.5541 -0.8182 -0.1537
-vn 0.6993 0.1953 -0.6877
-vn -0.2348 0.8430 -0.4841
-vn -0.7235 0.6550 0.2180
-vn -0.8989 -0.0008 0.4382
-vn -0.8919 -0.4332 -0.1295
-vn -0.7122 -0.0447 -0.7005
-vn -0.6081 0.6278 -0.4858
-vn 0.7122 0.0447 0.7005
-vn 0.6081 -0.6278 0.4858
-vn 0.7235 -0.6550 -0.2180
-vn 0.8989 0.0008 -0.4382
-vn 0.8919 0.4332 0.1295
-vn -0.1108 0.8376 0.5350
-vn -0.3946 -0.2235 0.8913
-vn -0.3833 -0.9232 -0.0272
-vn -0.0925 -0.2946 -0.9511
-vn 0.0759 0.7936 -0.6037
-vn 0.0925 0.2946 0.9511
-vn -0.0759 -0.7936 0.6037
-vn 0.1108 -0.8376 -0.5350
-vn 0.3946 0.2235 -0.8913
-vn 0.3833 0.9232 0.0272
-vn -0.1717 0.5737 -0.8009
-vn -0.2347 -0.1180 -0.9649
-vn 0.3846 -0.4381 -0.8125
-vn 0.8305 0.0557 -0.5543
-vn 0.4866 0.6810 -0.5471
-vn -0.8305 -0.0557 0.5543
-vn -0.4866 -0.6810 0.5471
-vn 0.1717 -0.5737 0.8009
-vn 0.2347 0.1180 0.9649
-vn -0.3846 0.4381 0.8125
-vn -0.6358 0.7197 -0.2789
-vn -0.7378 -0.3994 -0.5442
-vn 0.2643 -0.9174 -0.2976
-vn 0.9857 -0.1183 0.1202
-vn 0.4293 0.8935 0.1318
-vn -0.9857 0.1183 -0.1202
-vn -0.4293 -0.8935 -0.1318
-vn 0.6358 -0.7197 0.2789
-vn 0.7378 0.3994 0.5442
-vn -0.2643 0.9174 0.2976
-vn 0.6480 -0.1519 -0.7463
-vn 0.7243 -0.6471 -0.2382
-vn 0.0988 -0.9820 -0.1610
-vn -0.3639 -0.6938 -0.6215
-vn -0.0245 -0.1807 -0.9832
-vn 0.3639 0.6938 0.6215
-vn 0.0245 0.1807 0.9832
-vn -0.6480 0.1519 0.7463
-vn -0.7243 0.6471 0.2382
-vn -0.0988 0.9820 0.1610
-vn 0.7493 0.4882 -0.4474
-vn 0.8727 -0.3130 0.3748
-vn -0.1393 -0.8550 0.4996
-vn -0.8881 -0.3886 -0.2454
-vn -0.3389 0.4415 -0.8308
-vn 0.8881 0.3886 0.2454
-vn 0.3389 -0.4415 0.8308
-vn -0.7493 -0.4882 0.4475
-vn -0.8727 0.3130 -0.3748
-vn 0.1393 0.8550 -0.4996
-vn 0.7220 -0.4096 -0.5577
-vn 0.1165 -0.7837 -0.6101
-vn -0.0688 -0.9966 0.0454
-vn 0.4223 -0.7541 0.5029
-vn 0.9110 -0.3914 0.1303
-vn -0.4223 0.7541 -0.5029
-vn -0.9110 0.3914 -0.1303
-vn -0.7220 0.4096 0.5576
-vn -0.1165 0.7837 0.6101
-vn 0.0687 0.9966 -0.0453
-vn 0.5869 0.2591 -0.7671
-vn -0.3928 -0.3461 -0.8520
-vn -0.6925 -0.6906 0.2086
-vn 0.1020 -0.2983 0.9490
-vn 0.8927 0.2886 0.3460
-vn -0.1020 0.2983 -0.9490
-vn -0.8927 -0.2886 -0.3460
-vn -0.5869 -0.2591 0.7671
-vn 0.3928 0.3461 0.8520
-vn 0.6925 0.6906 -0.2086
-vt 0.175435 0.163566
-vt 0.227393 0.163566
-vt 0.202202 0.288261
-vt 0.150245 0.289632
-vt 0.279351 0.163566
-vt 0.254160 0.285937
-vt 0.331308 0.163566
-vt 0.306118 0.289632
-vt 0.383266 0.163566
-vt 0.358075 0.288261
-vt 0.435223 0.163566
-vt 0.410033 0.285937
-vt 0.487181 0.163566
-vt 0.461990 0.289632
-vt 0.172788 0.435765
-vt 0.120830 0.437733
-vt 0.224745 0.434466
-vt 0.276703 0.437733
-vt 0.328660 0.435765
-vt 0.380618 0.434466
-vt 0.432576 0.437733
-vt 0.144204 0.574706
-vt 0.092247 0.576682
-vt 0.196162 0.579905
-vt 0.248120 0.576682
-vt 0.300077 0.574706
-vt 0.352035 0.579905
-vt 0.403993 0.576682
-vt 0.116520 0.717314
-vt 0.064563 0.714772
-vt 0.168478 0.716962
-vt 0.220436 0.714772
-vt 0.272393 0.717314
-vt 0.324351 0.716962
-vt 0.376309 0.714772
-vt 0.087492 0.861430
-vt 0.035535 0.861160
-vt 0.139450 0.865035
-vt 0.191408 0.861160
-vt 0.243365 0.861430
-vt 0.295323 0.865035
-vt 0.347280 0.861160
-vt 0.061958 0.988661
-vt 0.010000 0.990000
-vt 0.113915 0.989790
-vt 0.165873 0.990000
-vt 0.217831 0.988661
-vt 0.269788 0.989790
-vt 0.321746 0.990000
-vt 0.227375 0.163655
-vt 0.201632 0.292434
-vt 0.149675 0.290455
-vt 0.175418 0.163655
-vt 0.279333 0.163655
-vt 0.253590 0.288954
-vt 0.331290 0.163655
-vt 0.305548 0.290455
-vt 0.383248 0.163655
-vt 0.357505 0.292434
-vt 0.435206 0.163655
-vt 0.409463 0.288954
-vt 0.487163 0.163655
-vt 0.461421 0.290455
-vt 0.173259 0.433000
-vt 0.121302 0.437702
-vt 0.225217 0.432648
-vt 0.277175 0.437702
-vt 0.329132 0.433000
-vt 0.381090 0.432648
-vt 0.433048 0.437702
-vt 0.144368 0.572834
-vt 0.092410 0.576020
-vt 0.196326 0.579962
-vt 0.248283 0.576020
-vt 0.300241 0.572834
-vt 0.352199 0.579962
-vt 0.404156 0.576020
-vt 0.065625 0.709654
-vt 0.117582 0.713252
-vt 0.169540 0.711774
-vt 0.221498 0.709654
-vt 0.273455 0.713252
-vt 0.325413 0.711774
-vt 0.377370 0.709654
-vt 0.521660 0.295987
-vt 0.529215 0.333762
-vt 0.472124 0.333762
-vt 0.464568 0.295987
-vt 0.578752 0.295987
-vt 0.586307 0.333762
-vt 0.635843 0.295987
-vt 0.643398 0.333762
-vt 0.692935 0.295987
-vt 0.700490 0.333762
-vt 0.560793 0.489959
-vt 0.569502 0.534311
-vt 0.512411 0.531188
-vt 0.503702 0.489940
-vt 0.617885 0.489940
-vt 0.626594 0.531188
-vt 0.674977 0.489959
-vt 0.683685 0.534311
-vt 0.732068 0.489940
-vt 0.740777 0.531188
-vt 0.578416 0.577857
-vt 0.521325 0.576322
-vt 0.635508 0.576322
-vt 0.692599 0.577857
-vt 0.749691 0.576322
-vt 0.452228 0.586489
-vt 0.458819 0.619443
-vt 0.412457 0.619443
-vt 0.405866 0.586489
-vt 0.498591 0.586489
-vt 0.505182 0.619443
-vt 0.544953 0.586489
-vt 0.551544 0.619443
-vt 0.591316 0.586489
-vt 0.597907 0.619443
-vt 0.425806 0.686190
-vt 0.472169 0.686190
-vt 0.482260 0.736613
-vt 0.435897 0.733184
-vt 0.518531 0.686190
-vt 0.528622 0.733184
-vt 0.564894 0.686190
-vt 0.574985 0.736613
-vt 0.611256 0.686190
-vt 0.621347 0.733184
-vt 0.490959 0.777583
-vt 0.444596 0.779163
-vt 0.537321 0.779163
-vt 0.583684 0.777583
-vt 0.630046 0.779163
-vt 0.500113 0.824583
-vt 0.453751 0.823776
-vt 0.546476 0.823776
-vt 0.592838 0.824583
-vt 0.639201 0.823776
-vt 0.510271 0.875009
-vt 0.463908 0.879329
-vt 0.556633 0.879329
-vt 0.602996 0.875009
-vt 0.649358 0.879329
-vt 0.520698 0.924894
-vt 0.474336 0.930396
-vt 0.567061 0.930396
-vt 0.613423 0.924894
-vt 0.659786 0.930396
-vt 0.425483 0.684572
-vt 0.471845 0.684572
-vt 0.482139 0.735481
-vt 0.435777 0.733512
-vt 0.518207 0.684572
-vt 0.528502 0.733512
-vt 0.564570 0.684572
-vt 0.574864 0.735481
-vt 0.610932 0.684572
-vt 0.621227 0.733512
-vt 0.491103 0.778269
-vt 0.444741 0.779574
-vt 0.537466 0.779574
-vt 0.583828 0.778269
-vt 0.630191 0.779574
-vt 0.500215 0.824696
-vt 0.453852 0.824765
-vt 0.546577 0.824765
-vt 0.592940 0.824696
-vt 0.639302 0.824765
-vt 0.510036 0.874687
-vt 0.463673 0.876745
-vt 0.556398 0.876745
-vt 0.602761 0.874687
-vt 0.649123 0.876745
-vt 0.474026 0.929901
-vt 0.520388 0.922535
-vt 0.566751 0.929901
-vt 0.613113 0.922535
-vt 0.659476 0.929901
-vt 0.521713 0.023547
-vt 0.573561 0.023547
-vt 0.565551 0.063599
-vt 0.513703 0.063599
-vt 0.625410 0.023547
-vt 0.617399 0.063599
-vt 0.677258 0.023547
-vt 0.669248 0.063599
-vt 0.729106 0.023547
-vt 0.721096 0.063599
-vt 0.557452 0.103931
-vt 0.505604 0.101224
-vt 0.609301 0.101224
-vt 0.661149 0.103931
-vt 0.712997 0.101224
-vt 0.549303 0.138767
-vt 0.497455 0.144623
-vt 0.601152 0.144623
-vt 0.653000 0.138767
-vt 0.704849 0.144623
-vt 0.540382 0.187948
-vt 0.488534 0.189567
-vt 0.592230 0.189567
-vt 0.644079 0.187948
-vt 0.695927 0.189567
-vt 0.531090 0.238910
-vt 0.479241 0.230896
-vt 0.582938 0.230896
-vt 0.634786 0.238910
-vt 0.686635 0.230896
-vt 0.520932 0.289510
-vt 0.469084 0.283809
-vt 0.572781 0.283809
-vt 0.624629 0.289510
-vt 0.676477 0.283809
-vt 0.206149 0.010000
-vt 0.258644 0.010000
-vt 0.241328 0.102556
-vt 0.187637 0.102556
-vt 0.310384 0.010000
-vt 0.289964 0.102556
-vt 0.361159 0.010000
-vt 0.342201 0.102556
-vt 0.412970 0.010000
-vt 0.396386 0.102556
-vt 0.465546 0.010000
-vt 0.445489 0.102556
-vt 0.517894 0.010000
-vt 0.499383 0.102556
-vt 0.234079 0.130135
-vt 0.287171 0.124463
-vt 0.390700 0.126395
-vt 0.442621 0.126578
-vt 0.465536 0.643919
-vt 0.417192 0.642528
-vt 0.511448 0.642381
-vt 0.554412 0.643808
-vt 0.602642 0.642528
-vt 0.467727 0.663983
-vt 0.531276 0.982187
-vt 0.484913 0.986216
-vt 0.577638 0.981110
-vt 0.624001 0.985614
-vt 0.670363 0.986216
-vt 0.560168 0.662561
-vt 0.530881 0.979097
-vt 0.484518 0.983842
-vt 0.577243 0.982917
-vt 0.623606 0.984496
-vt 0.669968 0.983842
-vt 0.170651 0.081439
-vt 0.151488 0.062277
-vt 0.170651 0.062277
-vt 0.189813 0.062277
-vt 0.170651 0.043114
-vt 0.166540 0.017407
-vt 0.188605 0.010000
-vt 0.181276 0.024736
-vt 0.173947 0.039471
-vt 0.196012 0.032065
-vt 0.601738 0.408093
-vt 0.658830 0.412179
-vt 0.544646 0.412179
-vt 0.715921 0.408093
-vt 0.487555 0.408093
-vt 0.088423 0.846225
-vt 0.010000 0.846225
-vt 0.049211 0.990000
-vt 0.166845 0.846225
-vt 0.127634 0.990000
-vt 0.245268 0.846225
-vt 0.206057 0.990000
-vt 0.323691 0.846225
-vt 0.284480 0.990000
-vt 0.402114 0.846225
-vt 0.362902 0.990000
-vt 0.049211 0.702450
-vt 0.127634 0.702450
-vt 0.088423 0.558675
-vt 0.206057 0.702450
-vt 0.166845 0.558675
-vt 0.284480 0.702450
-vt 0.245268 0.558675
-vt 0.362902 0.702450
-vt 0.323691 0.558675
-vt 0.441325 0.702450
-vt 0.402114 0.558675
-vt 0.109188 0.373689
-vt 0.059594 0.555533
-vt 0.010000 0.373689
-vt 0.208375 0.373689
-vt 0.158782 0.555533
-vt 0.307564 0.373689
-vt 0.257969 0.555533
-vt 0.406751 0.373689
-vt 0.357157 0.555533
-vt 0.505939 0.373689
-vt 0.456345 0.555533
-vt 0.059594 0.191844
-vt 0.109188 0.010000
-vt 0.158782 0.191844
-vt 0.208375 0.010000
-vt 0.257969 0.191844
-vt 0.307564 0.010000
-vt 0.357157 0.191844
-vt 0.406751 0.010000
-vt 0.456345 0.191844
-vt 0.505939 0.010000
-vt 0.555533 0.191844
-vt 0.464198 0.872173
-vt 0.400837 0.872173
-vt 0.432518 0.988334
-vt 0.527559 0.872173
-vt 0.495878 0.988334
-vt 0.590920 0.872173
-vt 0.559239 0.988334
-vt 0.654281 0.872173
-vt 0.622601 0.988334
-vt 0.717642 0.872173
-vt 0.685962 0.988334
-vt 0.432518 0.756011
-vt 0.495878 0.756011
-vt 0.464198 0.639849
-vt 0.559239 0.756011
-vt 0.527559 0.639849
-vt 0.622601 0.756011
-vt 0.590920 0.639849
-vt 0.685962 0.756011
-vt 0.654281 0.639849
-vt 0.749323 0.756011
-vt 0.717642 0.639849
-vt 0.748090 0.583761
-vt 0.710500 0.583761
-vt 0.729295 0.652675
-vt 0.785679 0.583761
-vt 0.766884 0.652675
-vt 0.823268 0.583761
-vt 0.804473 0.652675
-vt 0.860858 0.583761
-vt 0.842063 0.652675
-vt 0.898447 0.583761
-vt 0.879652 0.652675
-vt 0.729295 0.514847
-vt 0.766884 0.514847
-vt 0.748090 0.445934
-vt 0.804473 0.514847
-vt 0.785679 0.445934
-vt 0.842063 0.514847
-vt 0.823268 0.445934
-vt 0.879652 0.514847
-vt 0.860858 0.445934
-vt 0.917241 0.514847
-vt 0.898447 0.445934
-vt 0.588077 0.268129
-vt 0.564357 0.355103
-vt 0.540636 0.268129
-vt 0.635517 0.268129
-vt 0.611797 0.355103
-vt 0.682958 0.268129
-vt 0.659238 0.355103
-vt 0.730399 0.268129
-vt 0.706678 0.355103
-vt 0.777839 0.268129
-vt 0.754119 0.355103
-vt 0.564357 0.181155
-vt 0.588077 0.094180
-vt 0.611797 0.181155
-vt 0.635517 0.094180
-vt 0.659238 0.181155
-vt 0.682958 0.094180
-vt 0.706678 0.181155
-vt 0.730399 0.094180
-vt 0.754119 0.181155
-vt 0.777839 0.094180
-vt 0.801559 0.181155
-vt 0.515525 0.543765
-vt 0.465475 0.543765
-vt 0.490500 0.635522
-vt 0.565574 0.543765
-vt 0.540550 0.635522
-vt 0.615624 0.543765
-vt 0.590599 0.635522
-vt 0.665673 0.543765
-vt 0.640649 0.635522
-vt 0.715723 0.543765
-vt 0.690698 0.635522
-vt 0.490500 0.452007
-vt 0.540550 0.452007
-vt 0.515525 0.360250
-vt 0.590599 0.452007
-vt 0.565574 0.360250
-vt 0.640649 0.452007
-vt 0.615624 0.360250
-vt 0.690698 0.452007
-vt 0.665673 0.360250
-vt 0.740748 0.452007
-vt 0.715723 0.360250
-s 0
-usemtl Bark
-f 7/1/1 8/2/1 14/3/1 13/4/1
-f 9/5/2 15/6/3 14/3/3 8/2/3
-f 10/7/4 16/8/5 15/6/5 9/5/4
-f 11/9/6 17/10/6 16/8/6 10/7/6
-f 11/9/7 12/11/7 18/12/7 17/10/7
-f 12/11/8 7/13/8 13/14/8 18/12/8
-f 13/4/9 14/3/9 20/15/9 19/16/9
-f 21/17/10 20/15/10 14/3/11 15/6/10
-f 16/8/12 22/18/12 21/17/13 15/6/12
-f 16/8/14 17/10/14 23/19/14 22/18/14
-f 17/10/15 18/12/16 24/20/15 23/19/15
-f 18/12/17 13/14/17 19/21/17 24/20/17
-f 20/15/18 26/22/19 25/23/18 19/16/18
-f 21/17/20 27/24/20 26/22/20 20/15/20
-f 21/17/21 22/18/21 28/25/21 27/24/21
-f 22/18/22 23/19/22 29/26/22 28/25/22
-f 24/20/23 30/27/23 29/26/24 23/19/24
-f 24/20/25 19/21/26 25/28/26 30/27/26
-f 26/22/27 32/29/27 31/30/27 25/23/28
-f 26/22/29 27/24/29 33/31/29 32/29/29
-f 28/25/30 34/32/30 33/31/30 27/24/30
-f 29/26/31 35/33/31 34/32/31 28/25/32
-f 29/26/33 30/27/33 36/34/33 35/33/33
-f 30/27/34 25/28/34 31/35/35 36/34/34
-f 31/30/36 32/29/36 38/36/36 37/37/37
-f 33/31/38 39/38/39 38/36/38 32/29/40
-f 34/32/41 40/39/42 39/38/41 33/31/42
-f 35/33/43 41/40/44 40/39/44 34/32/43
-f 36/34/45 42/41/46 41/40/45 35/33/45
-f 36/34/47 31/35/48 37/42/47 42/41/47
-f 37/37/49 38/36/49 44/43/49 43/44/49
-f 38/36/50 39/38/50 45/45/50 44/43/50
-f 39/38/51 40/39/51 46/46/51 45/45/51
-f 40/39/52 41/40/52 47/47/52 46/46/52
-f 42/41/53 48/48/53 47/47/53 41/40/53
-f 37/42/54 43/49/54 48/48/54 42/41/54
-f 50/50/55 56/51/55 55/52/55 49/53/55
-f 50/50/56 51/54/56 57/55/56 56/51/56
-f 51/54/57 52/56/57 58/57/57 57/55/57
-f 52/56/58 53/58/59 59/59/58 58/57/59
-f 54/60/60 60/61/60 59/59/61 53/58/60
-f 49/62/62 55/63/62 60/61/63 54/60/62
-f 62/64/64 61/65/64 55/52/64 56/51/65
-f 57/55/66 63/66/67 62/64/66 56/51/66
-f 63/66/68 57/55/68 58/57/68 64/67/68
-f 64/67/69 58/57/69 59/59/70 65/68/70
-f 60/61/71 66/69/71 65/68/71 59/59/71
-f 55/63/72 61/70/72 66/69/72 60/61/72
-f 62/64/73 68/71/73 67/72/73 61/65/73
-f 63/66/74 69/73/74 68/71/74 62/64/74
-f 63/66/75 64/67/75 70/74/76 69/73/76
-f 64/67/77 65/68/77 71/75/77 70/74/78
-f 66/69/79 72/76/79 71/75/79 65/68/79
-f 66/69/80 61/70/81 67/77/80 72/76/81
-f 73/78/82 67/72/82 68/71/82 74/79/82
-f 68/71/83 69/73/83 75/80/83 74/79/83
-f 70/74/84 76/81/84 75/80/84 69/73/84
-f 77/82/85 76/81/85 70/74/85 71/75/85
-f 71/75/86 72/76/86 78/83/86 77/82/86
-f 72/76/87 67/77/87 73/84/87 78/83/87
-f 82/85/88 81/86/89 79/87/88 80/88/89
-f 82/85/90 84/89/90 83/90/90 81/86/90
-f 84/89/91 86/91/91 85/92/91 83/90/91
-f 80/93/92 79/94/92 85/92/92 86/91/92
-f 92/95/93 96/96/93 95/97/93 91/98/93
-f 92/95/94 93/99/94 97/100/94 96/96/94
-f 94/101/95 98/102/95 97/100/95 93/99/95
-f 91/103/96 95/104/96 98/102/96 94/101/96
-f 96/96/97 100/105/98 99/106/97 95/97/97
-f 96/96/99 97/100/99 101/107/99 100/105/99
-f 97/100/100 98/102/100 102/108/100 101/107/100
-f 95/104/101 99/109/101 102/108/102 98/102/101
-f 106/110/103 105/111/103 103/112/103 104/113/103
-f 108/114/104 107/115/104 105/111/104 106/110/104
-f 108/114/105 110/116/105 109/117/105 107/115/105
-f 110/116/106 104/118/107 103/119/106 109/117/107
-f 111/120/108 112/121/108 116/122/109 115/123/108
-f 112/121/110 113/124/110 117/125/110 116/122/110
-f 114/126/111 118/127/111 117/125/111 113/124/111
-f 114/126/112 111/128/113 115/129/113 118/127/113
-f 115/123/114 116/122/115 120/130/115 119/131/114
-f 117/125/116 121/132/116 120/130/116 116/122/116
-f 117/125/117 118/127/118 122/133/117 121/132/117
-f 118/127/119 115/129/120 119/134/120 122/133/119
-f 124/135/121 123/136/122 119/131/121 120/130/122
-f 125/137/123 124/135/123 120/130/123 121/132/123
-f 125/137/124 121/132/124 122/133/124 126/138/124
-f 126/138/125 122/133/125 119/134/125 123/139/125
-f 123/136/126 124/135/126 128/140/126 127/141/127
-f 125/137/128 129/142/129 128/140/129 124/135/128
-f 129/142/130 125/137/131 126/138/130 130/143/132
-f 127/144/133 130/143/133 126/138/133 123/139/133
-f 127/141/134 128/140/135 132/145/134 131/146/135
-f 129/142/136 133/147/136 132/145/136 128/140/136
-f 130/143/137 134/148/137 133/147/138 129/142/137
-f 127/144/139 131/149/139 134/148/139 130/143/139
-f 135/150/140 136/151/140 140/152/140 139/153/140
-f 136/151/141 137/154/141 141/155/141 140/152/141
-f 138/156/142 142/157/142 141/155/142 137/154/142
-f 138/156/143 135/158/144 139/159/143 142/157/144
-f 139/153/145 140/152/145 144/160/145 143/161/145
-f 141/155/146 145/162/146 144/160/146 140/152/146
-f 141/155/147 142/157/148 146/163/148 145/162/147
-f 142/157/149 139/159/150 143/164/149 146/163/150
-f 144/160/151 148/165/151 147/166/151 143/161/151
-f 145/162/152 149/167/152 148/165/152 144/160/152
-f 145/162/153 146/163/153 150/168/153 149/167/153
-f 146/163/154 143/164/154 147/169/154 150/168/154
-f 152/170/155 151/171/155 147/166/155 148/165/155
-f 153/172/156 152/170/156 148/165/157 149/167/156
-f 153/172/158 149/167/158 150/168/158 154/173/158
-f 147/169/159 151/174/159 154/173/159 150/168/159
-f 155/175/160 151/171/160 152/170/160 156/176/160
-f 153/172/161 157/177/162 156/176/161 152/170/161
-f 153/172/163 154/173/164 158/178/164 157/177/163
-f 151/174/165 155/179/165 158/178/165 154/173/165
-f 160/180/166 162/181/166 161/182/166 159/183/166
-f 164/184/167 163/185/167 161/182/167 162/181/167
-f 166/186/168 165/187/168 163/185/168 164/184/168
-f 166/186/169 160/188/169 159/189/169 165/187/169
-f 159/183/170 161/182/170 168/190/170 167/191/170
-f 161/182/171 163/185/171 169/192/171 168/190/171
-f 165/187/172 170/193/172 169/192/172 163/185/172
-f 165/187/173 159/189/173 167/194/173 170/193/173
-f 167/191/174 168/190/174 172/195/174 171/196/174
-f 169/192/175 173/197/175 172/195/175 168/190/175
-f 169/192/176 170/193/176 174/198/176 173/197/176
-f 167/194/177 171/199/178 174/198/177 170/193/178
-f 172/195/179 176/200/179 175/201/179 171/196/179
-f 173/197/180 177/202/180 176/200/180 172/195/180
-f 173/197/181 174/198/181 178/203/181 177/202/181
-f 178/203/182 174/198/182 171/199/182 175/204/182
-f 176/200/183 180/205/183 179/206/183 175/201/183
-f 180/205/184 176/200/184 177/202/184 181/207/184
-f 178/203/185 182/208/185 181/207/186 177/202/186
-f 178/203/187 175/204/187 179/209/187 182/208/187
-f 180/205/188 184/210/188 183/211/188 179/206/188
-f 185/212/189 184/210/189 180/205/190 181/207/190
-f 181/207/191 182/208/192 186/213/191 185/212/192
-f 182/208/193 179/209/193 183/214/194 186/213/193
-f 1/215/195 2/216/195 262/217/195 261/218/196
-f 2/216/197 3/219/197 263/220/197 262/217/197
-f 4/221/198 265/222/199 263/220/198 3/219/199
-f 4/221/200 5/223/201 266/224/201 265/222/200
-f 6/225/202 267/226/202 266/224/202 5/223/202
-f 1/227/203 261/228/203 267/226/203 6/225/203
-f 261/218/204 268/229/204 8/2/204 7/1/205
-f 269/230/206 9/5/206 8/2/206 268/229/206
-f 265/222/207 10/7/207 9/5/207 269/230/207
-f 265/222/208 266/224/209 11/9/209 10/7/208
-f 266/224/210 267/226/211 12/11/210 11/9/211
-f 261/228/212 7/13/212 12/11/212 267/226/212
-f 261/218/213 262/217/213 50/50/213 49/53/214
-f 263/220/215 51/54/215 50/50/215 262/217/215
-f 52/56/216 51/54/217 263/220/216 265/222/216
-f 265/222/218 269/231/218 53/58/218 52/56/218
-f 268/232/219 54/60/220 53/58/220 269/231/219
-f 261/228/221 49/62/221 54/60/221 268/232/221
-f 271/233/222 270/234/222 103/112/222 105/111/222
-f 272/235/223 271/233/224 105/111/223 107/115/224
-f 264/236/225 272/235/225 107/115/225 109/117/226
-f 264/236/227 109/117/227 103/119/227 270/237/227
-f 111/120/228 270/234/228 273/238/228 112/121/229
-f 272/235/230 113/124/231 112/121/231 273/238/231
-f 272/235/232 264/236/232 114/126/232 113/124/232
-f 270/237/233 111/128/233 114/126/233 264/236/233
-f 131/146/234 132/145/234 277/239/235 280/240/235
-f 132/145/236 133/147/236 278/241/236 277/239/236
-f 134/148/237 281/242/237 278/241/237 133/147/237
-f 134/148/238 131/149/238 280/243/238 281/242/238
-f 270/234/239 271/233/239 136/151/239 135/150/239
-f 272/235/240 137/154/240 136/151/240 271/233/240
-f 272/235/241 273/244/241 138/156/241 137/154/241
-f 270/237/242 135/158/242 138/156/242 273/244/243
-f 156/176/244 275/245/244 274/246/244 155/175/244
-f 275/245/245 156/176/245 157/177/245 276/247/245
-f 158/178/246 279/248/246 276/247/246 157/177/246
-f 279/248/247 158/178/247 155/179/248 274/249/248
-f 277/250/249 278/251/250 187/252/251 280/253/252
-f 278/251/253 281/254/253 280/253/253
-f 278/251/254 280/253/254 187/252/254
-f 275/255/255 276/256/255 188/257/255 274/258/255
-f 276/256/256 279/259/256 274/258/256
-f 276/256/257 274/258/257 188/257/257
-f 93/99/258 89/260/258 90/261/258 94/101/258
-f 88/262/259 89/260/260 93/99/260 92/95/259
-f 91/103/261 94/101/261 90/261/261 87/263/261
-f 88/262/262 92/95/262 91/98/262 87/264/262
-f 83/90/263 85/92/263 90/261/263 89/260/263
-f 83/90/264 89/260/264 88/262/264 81/86/264
-f 79/94/265 87/263/265 90/261/265 85/92/265
-f 79/87/266 81/86/266 88/262/266 87/264/266
-usemtl Tree
-f 189/265/267 190/266/267 191/267/267
-f 192/268/268 189/265/268 191/269/268
-f 193/270/269 192/268/269 191/271/269
-f 194/272/270 193/270/270 191/273/270
-f 190/274/271 194/272/271 191/275/271
-f 195/276/272 196/277/272 197/278/272
-f 196/277/273 198/279/273 197/280/273
-f 198/279/274 199/281/274 197/282/274
-f 199/281/275 200/283/275 197/284/275
-f 200/283/276 195/285/276 197/286/276
-f 189/265/277 195/276/277 190/266/277
-f 192/268/278 196/277/278 189/265/278
-f 193/270/279 198/279/279 192/268/279
-f 194/272/280 199/281/280 193/270/280
-f 190/274/281 200/283/281 194/272/281
-f 195/276/282 189/265/282 196/277/282
-f 196/277/283 192/268/283 198/279/283
-f 198/279/284 193/270/284 199/281/284
-f 199/281/285 194/272/285 200/283/285
-f 200/283/286 190/274/286 195/285/286
-f 201/287/287 202/288/287 203/289/287
-f 204/290/288 202/291/288 201/287/288
-f 205/292/289 202/293/289 204/290/289
-f 206/294/290 202/295/290 205/292/290
-f 203/296/291 202/297/291 206/294/291
-f 207/298/292 208/299/292 209/300/292
-f 209/300/293 208/301/293 210/302/293
-f 210/302/294 208/303/294 211/304/294
-f 211/304/295 208/305/295 212/306/295
-f 212/306/296 208/307/296 207/308/296
-f 201/287/297 203/289/297 207/298/297
-f 204/290/298 201/287/298 209/300/298
-f 205/292/299 204/290/299 210/302/299
-f 206/294/300 205/292/300 211/304/300
-f 203/296/301 206/294/301 212/306/301
-f 207/298/302 209/300/302 201/287/302
-f 209/300/303 210/302/303 204/290/303
-f 210/302/304 211/304/304 205/292/304
-f 211/304/305 212/306/305 206/294/305
-f 212/306/306 207/308/306 203/296/306
-f 213/309/307 214/310/307 215/311/307
-f 216/312/308 213/309/308 215/313/308
-f 217/314/309 216/312/309 215/315/309
-f 218/316/310 217/314/310 215/317/310
-f 214/318/311 218/316/311 215/319/311
-f 219/320/312 220/321/312 221/322/312
-f 220/321/313 222/323/313 221/324/313
-f 222/323/314 223/325/314 221/326/314
-f 223/325/315 224/327/315 221/328/315
-f 224/327/316 219/329/316 221/330/316
-f 213/309/317 219/320/317 214/310/317
-f 216/312/318 220/321/318 213/309/318
-f 217/314/319 222/323/319 216/312/319
-f 218/316/320 223/325/320 217/314/320
-f 214/318/321 224/327/321 218/316/321
-f 219/320/322 213/309/322 220/321/322
-f 220/321/323 216/312/323 222/323/323
-f 222/323/324 217/314/324 223/325/324
-f 223/325/325 218/316/325 224/327/325
-f 224/327/326 214/318/326 219/329/326
-f 225/331/327 226/332/327 227/333/327
-f 228/334/328 225/331/328 227/335/328
-f 229/336/329 228/334/329 227/337/329
-f 230/338/330 229/336/330 227/339/330
-f 226/340/331 230/338/331 227/341/331
-f 231/342/332 232/343/332 233/344/332
-f 232/343/333 234/345/333 233/346/333
-f 234/345/334 235/347/334 233/348/334
-f 235/347/335 236/349/335 233/350/335
-f 236/349/336 231/351/336 233/352/336
-f 225/331/337 231/342/337 226/332/337
-f 228/334/338 232/343/338 225/331/338
-f 229/336/339 234/345/339 228/334/339
-f 230/338/340 235/347/340 229/336/340
-f 226/340/341 236/349/341 230/338/341
-f 231/342/342 225/331/342 232/343/342
-f 232/343/343 228/334/343 234/345/343
-f 234/345/344 229/336/344 235/347/344
-f 235/347/345 230/338/345 236/349/345
-f 236/349/346 226/340/346 231/351/346
-f 237/353/347 238/354/347 239/355/347
-f 240/356/348 238/357/348 237/353/348
-f 241/358/349 238/359/349 240/356/349
-f 242/360/350 238/361/350 241/358/350
-f 239/362/351 238/363/351 242/360/351
-f 243/364/352 244/365/352 245/366/352
-f 245/366/353 244/367/353 246/368/353
-f 246/368/354 244/369/354 247/370/354
-f 247/370/355 244/371/355 248/372/355
-f 248/372/356 244/373/356 243/374/356
-f 237/353/357 239/355/357 243/364/357
-f 240/356/358 237/353/358 245/366/358
-f 241/358/359 240/356/359 246/368/359
-f 242/360/360 241/358/360 247/370/360
-f 239/362/361 242/360/361 248/372/361
-f 243/364/362 245/366/362 237/353/362
-f 245/366/363 246/368/363 240/356/363
-f 246/368/364 247/370/364 241/358/364
-f 247/370/365 248/372/365 242/360/365
-f 248/372/366 243/374/366 239/362/366
-f 249/375/367 250/376/367 251/377/367
-f 252/378/368 249/375/368 251/379/368
-f 253/380/369 252/378/369 251/381/369
-f 254/382/370 253/380/370 251/383/370
-f 250/384/371 254/382/371 251/385/371
-f 255/386/372 256/387/372 257/388/372
-f 256/387/373 258/389/373 257/390/373
-f 258/389/374 259/391/374 257/392/374
-f 259/391/375 260/393/375 257/394/375
-f 260/393/376 255/395/376 257/396/376
-f 249/375/377 255/386/377 250/376/377
-f 252/378/378 256/387/378 249/375/378
-f 253/380/379 258/389/379 252/378/379
-f 254/382/380 259/391/380 253/380/380
-f 250/384/381 260/393/381 254/382/381
-f 255/386/382 249/375/382 256/387/382
-f 256/387/383 252/378/383 258/389/383
-f 258/389/384 253/380/384 259/391/384
-f 259/391/385 254/382/385 260/393/385
-f 260/393/386 250/384/386 255/395/386
-)X", .mtl = R"X(# Blender 3.6.0 MTL File: 'None'
-# www.blender.org
-
-newmtl Bark
-Ns 256.000031
-Ka 1.000000 1.000000 1.000000
-Kd 0.207595 0.138513 0.055181
-Ks 0.000000 0.000000 0.000000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 1
-
-newmtl Tree
-Ns 256.000031
-Ka 1.000000 1.000000 1.000000
-Kd 0.256861 0.440506 0.110769
-Ks 0.000000 0.000000 0.000000
-Ke 0.000000 0.000000 0.000000
-Ni 1.450000
-d 1.000000
-illum 1
-)X"},};
+constexpr dataset datasets[] = {
+    {2, "cone", cone_scene},
+    {2, "cube", cube_scene},
+    {2, "monkey", monkey_scene},
+    {2, "sphere", sphere_scene},
+    {2, "spheres", spheres_scene},
+    {2, "tree", tree_scene},
+};
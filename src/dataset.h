@@ -1,10 +1,12 @@
 #pragma once
 
+#include "scene.h"
+
+// generated by scenegen.py, the scene references const data in flash
 struct dataset {
+    uint32_t version;
     const char *name;
-    const char *scene;
-    const char *obj;
-    const char *mtl;
+    struct scene scene;
 };
 #define DATASETS_SIZE 6
 extern const dataset datasets[];
@@ -9,4 +9,7 @@
 #include <map>
 #include <vector>
 
-bool load_scene(dataset &dataset, scene &scene);
+// layout version of the datasets scenegen.py generates
+#define DATASET_VERSION 2
+
+bool load_scene(const dataset &dataset, scene &scene);
@@ -8,14 +8,20 @@
 #include "pico/stdlib.h"
 #include "pico/time.h"
 
+#include "binning.h"
 #include "debug.h"
 #include "loader.h"
 #include "pipeline.h"
+#include "profiler.h"
 #include "render.h"
 #include "dataset.h"
 
 #define COMMAND_MAX_SIZE 255
 #define DISPLAY_COUNT 2
+#define TILE_WIDTH 80
+#define TILE_HEIGHT 120
+// the datasets are sorted by name, the first one is not the default
+#define DEFAULT_DATASET "cube"
 
 struct display {
     uint16_t width;
@@ -54,23 +60,35 @@ std::vector<std::string> split(const std::string &s, const std::string &delimite
     return res;
 }
 
-static void set_pixel(display_t *display, point2 point, uint16_t color) {
-    GFX_drawPixel(display, point.x + display->width / 2, point.y + display->height / 2,
-                  color);
-}
-
 static struct state {
-    struct dataset dataset{};
+    const struct dataset *dataset;
     struct scene scene;
     m3::mat4 rotate[2];
     m3::mat4 scale;
     char command[COMMAND_MAX_SIZE]{};
     size_t commandSize{};
-    array<polygon> polygons[2];
+    vertex_buffer projected;
+    shading_cache shading;
+    face_scratch scratch;
+    polygon_store polygons[2];
+    pipeline_options options;
+    pipeline_stats stats[2];
+    tile_bins bins[2];
+    uint16_t tile[TILE_WIDTH * TILE_HEIGHT];
+    frame_profiler profiler;
 } state;
 
 static display_t displays[2];
 
+static const dataset *find_dataset(const std::string &name) {
+    for (size_t i = 0; i < DATASETS_SIZE; i++) {
+        if (datasets[i].name == name)
+            return &datasets[i];
+    }
+
+    return nullptr;
+}
+
 static void print_usage() {
     std::cout << "\nRaspberry Pi Pico 3D" << std::endl;
     std::cout << "Инструкция:\n" << std::endl;
@@ -86,7 +104,17 @@ static void print_usage() {
     std::cout << "camera scale <k>"
                  " -- Масштабирование камеры, где k - коэффициент масштабирования"
               << std::endl;
-    std::cout << "camera reset -- Сброс настроек камеры к значению по умолчанию\n" << std::endl;
+    std::cout << "camera reset -- Сброс настроек камеры к значению по умолчанию" << std::endl;
+    std::cout << "cull [on|off]"
+                 " -- Отсечение нелицевых граней замкнутых моделей, без аргумента"
+                 " выводит число отсеченных граней" << std::endl;
+    std::cout << "stats [reset]"
+                 " -- Счетчики отрисовки при сборке с WARNOCK_STATS, reset"
+                 " обнуляет их" << std::endl;
+    std::cout << "profile [reset|stream on|stream off]"
+                 " -- Время этапов кадра по дисплеям (мин/сред/макс, мкс) за"
+                 " последние кадры, stream выводит каждый кадр в формате CSV\n"
+              << std::endl;
 }
 
 static void execute_command() {
@@ -108,32 +136,21 @@ static void execute_command() {
             return;
         }
 
-        std::string model = tokens[1];
-        for (size_t i = 0; i < DATASETS_SIZE; i++) {
-            if (datasets[i].name == model) {
-                state.dataset = datasets[i];
-                state.scene.objects.clear();
-                state.scene.materials.clear();
-                state.scene.lights.clear();
-                if (!load_scene(state.dataset, state.scene)) {
-                    std::cout << "Ошибка при загрузке сцены " << state.dataset.name << std::endl;
-                    return;
-                }
-
-                size_t polygons_size = 0;
-                for (auto &object : state.scene.objects)
-                    polygons_size += object.faces.size();
+        const dataset *dataset = find_dataset(tokens[1]);
+        if (dataset == nullptr) {
+            std::cout << "Неправильное название сцены, проверьте список" << std::endl;
+            return;
+        }
 
-                for (size_t i = 0; i < DISPLAY_COUNT; i++) {
-                    delete[] state.polygons[i].data;
-                    state.polygons[i] = {new polygon[polygons_size], polygons_size};
-                }
-                std::cout << "Количество полигонов на сцене = " << polygons_size << std::endl;
-                std::cout << std::endl;
-                return;
-            }
+        state.dataset = dataset;
+        state.shading.invalidate();
+        if (!load_scene(*state.dataset, state.scene)) {
+            std::cout << "Ошибка при загрузке сцены " << state.dataset->name << std::endl;
+            return;
         }
-        std::cout << "Неправильное название сцены, проверьте список" << std::endl;
+
+        size_t polygons_size = count_polygons(state.scene);
+        std::cout << "Количество полигонов на сцене = " << polygons_size << std::endl;
     } else if (operation == "camera") {
         if (tokens.size() < 2) {
             std::cout << "invalid command arguments" << std::endl;
@@ -196,6 +213,49 @@ static void execute_command() {
             std::cout << "Неверное число аргументов" << std::endl;
             return;
         }
+    } else if (operation == "cull") {
+        if (tokens.size() == 2 && (tokens[1] == "on" || tokens[1] == "off")) {
+            state.options.cull_back_faces = tokens[1] == "on";
+        } else if (tokens.size() != 1) {
+            std::cout << "Неверное число аргументов" << std::endl;
+            return;
+        }
+
+        std::cout << "Отсечение нелицевых граней "
+                  << (state.options.cull_back_faces ? "включено" : "выключено")
+                  << ", отсечено граней " << state.stats[0].culled_faces
+                  << " и " << state.stats[1].culled_faces << std::endl;
+    } else if (operation == "stats") {
+#ifdef WARNOCK_STATS
+        if (tokens.size() == 2 && tokens[1] == "reset") {
+            reset_warnock_stats();
+            std::cout << "Счетчики сброшены" << std::endl;
+            return;
+        } else if (tokens.size() != 1) {
+            std::cout << "Неверное число аргументов" << std::endl;
+            return;
+        }
+
+        std::cout << "Счетчики отрисовки с последнего сброса" << std::endl;
+        std::cout << get_warnock_stats() << std::endl;
+#else
+        std::cout << "Счетчики отключены, прошивка собрана без WARNOCK_STATS"
+                  << std::endl;
+#endif
+    } else if (operation == "profile") {
+        if (tokens.size() == 2 && tokens[1] == "reset") {
+            state.profiler.reset();
+            std::cout << "Замеры сброшены" << std::endl;
+        } else if (tokens.size() == 3 && tokens[1] == "stream" &&
+                   (tokens[2] == "on" || tokens[2] == "off")) {
+            state.profiler.streaming = tokens[2] == "on";
+            if (state.profiler.streaming)
+                state.profiler.write_csv_header(std::cout);
+        } else if (tokens.size() == 1) {
+            std::cout << state.profiler << std::endl;
+        } else {
+            std::cout << "Неверное число аргументов" << std::endl;
+        }
     } else if (command == "help") {
         print_usage();
     } else {
@@ -265,31 +325,31 @@ int main() {
     LCD_initDisplay(&displays[1], 240, 240);
     LCD_setRotation(&displays[1], 2);
 
-    GFX_createFramebuf(&displays[0]);
-
-    state.dataset = datasets[0];
-    if (!load_scene(state.dataset, state.scene)) {
-        std::cout << "failed to load scene file " << state.dataset.name << std::endl;
+    state.dataset = find_dataset(DEFAULT_DATASET);
+    if (state.dataset == nullptr)
+        state.dataset = &datasets[0];
+    state.shading.invalidate();
+    if (!load_scene(*state.dataset, state.scene)) {
+        std::cout << "failed to load scene file " << state.dataset->name << std::endl;
         idle();
     }
 
-    size_t polygons_size = 0;
-    for (auto &object : state.scene.objects)
-        polygons_size += object.faces.size();
-
-    for (size_t i = 0; i < DISPLAY_COUNT; i++) {
-        state.polygons[i] = {new polygon[polygons_size], polygons_size};
-    }
+    size_t polygons_size = count_polygons(state.scene);
     std::cout << "Количество полигонов на сцене = " << polygons_size << std::endl;
 
     state.rotate[0] = m3::rotate_x(0) * m3::rotate_y(0) * m3::rotate_z(0);
     state.rotate[1] = m3::rotate_x(0) * m3::rotate_y(90 * 3.14f / 180) * m3::rotate_z(0);
     state.scale = m3::scale({2000, 2000, 2000});
 
+    // order the tiles of each display are rendered in
+    static const size_t tile_order[DISPLAY_COUNT][6] = {{0, 1, 2, 3, 4, 5},
+                                                         {1, 2, 3, 4, 5, 0}};
+
+    window screen = {{-displays[0].width / 2, -displays[0].height / 2},
+                     {displays[0].width / 2, displays[0].height / 2}};
+
     for (;;) {
         for (size_t i = 0; i < 2; i++) {
-            GFX_clearScreen(&displays[i]);
-
             m3::mat4 view = m3::look_at(
                 m3::transform_vector(state.rotate[i],
                                      state.scene.camera.position),
@@ -299,66 +359,49 @@ int main() {
             m3::mat4 perspective = m3::perspective(80, 1, 1.1f, 10.0f);
             m3::mat4 transform = state.scale * perspective * view;
 
-            for (auto &object : state.scene.objects) {
-                for (auto &vertex : object.vertices) {
-                    vertex = m3::transform_vector(transform, vertex);
+            {
+                scoped_timer timer(state.profiler, i, frame_stage::transform);
+                project_scene(state.scene, transform, screen, state.projected);
+            }
+
+            {
+                scoped_timer timer(state.profiler, i, frame_stage::polygons);
+                if (!scene_to_polygons(state.scene, state.projected,
+                                       state.shading, state.scratch,
+                                       state.polygons[i], state.options,
+                                       &state.stats[i])) {
+                    std::cout << "failed to preprocess objects" << std::endl;
+                    idle();
                 }
             }
 
-            if (!scene_to_polygons(state.scene, state.polygons[i])) {
-                std::cout << "failed to preprocess objects" << std::endl;
+            // each tile is rendered from the polygons overlapping it only
+            scoped_timer timer(state.profiler, i, frame_stage::binning);
+            if (!bin_polygons(state.polygons[i].view(), screen, TILE_WIDTH,
+                              TILE_HEIGHT, state.bins[i])) {
+                std::cout << "failed to bin polygons" << std::endl;
                 idle();
             }
+        }
 
-            transform = m3::inverse(transform);
-            for (auto &object : state.scene.objects) {
-                for (auto &vertex : object.vertices) {
-                    vertex = m3::transform_vector(transform, vertex);
+        for (size_t i = 0; i < 6; i++) {
+            for (size_t j = 0; j < 2; j++) {
+                window window = state.bins[j].tile(tile_order[j][i]);
+                tile_sink sink = {state.tile, window.begin, TILE_WIDTH};
+                {
+                    scoped_timer timer(state.profiler, j, frame_stage::render);
+                    warnock_render(sink, state.polygons[j].view(), window,
+                                   BLACK);
                 }
+
+                scoped_timer timer(state.profiler, j, frame_stage::flush);
+                LCD_WriteBitmap(&displays[j], window.begin.x + displays[j].width / 2,
+                                window.begin.y + displays[j].height / 2,
+                                TILE_WIDTH, TILE_HEIGHT, state.tile);
             }
         }
 
-        window window = {{-displays[0].width / 2, -displays[0].height / 2},
-                          {displays[0].width / 2, displays[0].height / 2}};
-        int16_t window_width = window.end.x - window.begin.x;
-        int16_t window_height = window.end.y - window.begin.y;
-
-        int16_t x_split1 = window.begin.x + (window_width / 3);
-        int16_t x_split2 = window.begin.x + (window_width / 3) * 2;
-        int16_t y_split = window.begin.y + (window_height / 2);
-
-        struct window windows[DISPLAY_COUNT][6] = {{
-                {{window.begin.x, window.begin.y}, {x_split1, y_split}, state.polygons[0]},
-                {{x_split1, window.begin.y}, {x_split2, y_split}, state.polygons[0]},
-                {{x_split2, window.begin.y}, {window.end.x, y_split}, state.polygons[0]},
-                {{window.begin.x, y_split}, {x_split1, window.end.y}, state.polygons[0]},
-                {{x_split1, y_split}, {x_split2, window.end.y}, state.polygons[0]},
-                {{x_split2, y_split}, {window.end.x, window.end.y}, state.polygons[0]}
-            }, {
-                {{x_split1, window.begin.y}, {x_split2, y_split}, state.polygons[1]},
-                {{x_split2, window.begin.y}, {window.end.x, y_split}, state.polygons[1]},
-                {{window.begin.x, y_split}, {x_split1, window.end.y}, state.polygons[1]},
-                {{x_split1, y_split}, {x_split2, window.end.y}, state.polygons[1]},
-                {{x_split2, y_split}, {window.end.x, window.end.y}, state.polygons[1]},
-                {{window.begin.x, window.begin.y}, {x_split1, y_split}, state.polygons[1]}
-            }
-        };
-
-//        for (size_t k = 50; k <= 500; k += 50) {
-//            uint32_t start = to_ms_since_boot(get_absolute_time());
-            for (size_t i = 0; i < 6; i++) {
-                for (size_t j = 0; j < 2; j++) {
-                    window = windows[j][i];
-//                    window.polygons.data = state.polygons[j].data;
-//                    window.polygons.size = k;
-                    warnock_render(&displays[j], window, BLACK, set_pixel);
-                    GFX_flush_block(&displays[j], window.begin.x + displays[j].width / 2,
-                                    window.begin.y + displays[j].height / 2, 80, 120);
-                }
-            }
-//            uint32_t end = to_ms_since_boot(get_absolute_time());
-//            std::cout << k << " " << end - start << std::endl;
-//        }
-//        return 1;
+        // the rows of a streamed frame go out here, between the timed stages
+        state.profiler.end_frame(std::cout);
     }
 }
@@ -1,6 +1,10 @@
 #include "mat4.h"
 #include "scalar.h"
 
+#if defined(__SSE2__)
+#include <xmmintrin.h>
+#endif
+
 namespace m3 {
 bool operator==(const mat4 &a, const mat4 &b) {
     for (int i = 0; i < 16; ++i) {
@@ -66,6 +70,115 @@ vec3 transform_vector(const mat4 &m, const vec3 &v) {
     return {a * one_over_w, b * one_over_w, c * one_over_w};
 }
 
+struct aos_points {
+    const vec3 *points;
+
+    inline vec3 operator()(size_t i) const {
+        return points[i];
+    }
+};
+
+struct soa_points {
+    const float *x;
+    const float *y;
+    const float *z;
+
+    inline vec3 operator()(size_t i) const {
+        return {x[i], y[i], z[i]};
+    }
+};
+
+struct int16_points {
+    const int16_t *points;
+
+    inline vec3 operator()(size_t i) const {
+        return {static_cast<float>(points[3 * i]),
+                static_cast<float>(points[3 * i + 1]),
+                static_cast<float>(points[3 * i + 2])};
+    }
+};
+
+// the same operations in the same order as transform_vector
+static inline void transform_point(const mat4 &m, const vec3 &v, float *x,
+                                   float *y, float *z, float *w, size_t i) {
+    float a = v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0] + m.m[3][0];
+    float b = v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1] + m.m[3][1];
+    float c = v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] + m.m[3][2];
+    float d = v.x * m.m[0][3] + v.y * m.m[1][3] + v.z * m.m[2][3] + m.m[3][3];
+
+    float one_over_w = 1.0f / d;
+    x[i] = a * one_over_w;
+    y[i] = b * one_over_w;
+    z[i] = c * one_over_w;
+    if (w != nullptr)
+        w[i] = d;
+}
+
+#if defined(__SSE2__)
+// one matrix column of four points
+static inline __m128 transform_column(const mat4 &m, int column, __m128 x,
+                                      __m128 y, __m128 z) {
+    __m128 result = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(m.m[0][column])),
+                               _mm_mul_ps(y, _mm_set1_ps(m.m[1][column])));
+    result = _mm_add_ps(result, _mm_mul_ps(z, _mm_set1_ps(m.m[2][column])));
+    return _mm_add_ps(result, _mm_set1_ps(m.m[3][column]));
+}
+#endif
+
+template <typename Points>
+static void transform_batch(const mat4 &m, const Points &points, size_t count,
+                            float *x, float *y, float *z, float *w) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        vec3 p0 = points(i), p1 = points(i + 1), p2 = points(i + 2),
+             p3 = points(i + 3);
+        __m128 in_x = _mm_setr_ps(p0.x, p1.x, p2.x, p3.x);
+        __m128 in_y = _mm_setr_ps(p0.y, p1.y, p2.y, p3.y);
+        __m128 in_z = _mm_setr_ps(p0.z, p1.z, p2.z, p3.z);
+
+        __m128 a = transform_column(m, 0, in_x, in_y, in_z);
+        __m128 b = transform_column(m, 1, in_x, in_y, in_z);
+        __m128 c = transform_column(m, 2, in_x, in_y, in_z);
+        __m128 d = transform_column(m, 3, in_x, in_y, in_z);
+
+        __m128 one_over_w = _mm_div_ps(_mm_set1_ps(1.0f), d);
+        _mm_storeu_ps(x + i, _mm_mul_ps(a, one_over_w));
+        _mm_storeu_ps(y + i, _mm_mul_ps(b, one_over_w));
+        _mm_storeu_ps(z + i, _mm_mul_ps(c, one_over_w));
+        if (w != nullptr)
+            _mm_storeu_ps(w + i, d);
+    }
+#else
+    // Cortex-M0+ has no FPU, unrolling saves the loop overhead around the
+    // float calls
+    for (; i + 4 <= count; i += 4) {
+        transform_point(m, points(i), x, y, z, w, i);
+        transform_point(m, points(i + 1), x, y, z, w, i + 1);
+        transform_point(m, points(i + 2), x, y, z, w, i + 2);
+        transform_point(m, points(i + 3), x, y, z, w, i + 3);
+    }
+#endif
+    for (; i < count; ++i)
+        transform_point(m, points(i), x, y, z, w, i);
+}
+
+void transform_points(const mat4 &m, const vec3 *points, size_t count,
+                      float *x, float *y, float *z, float *w) {
+    transform_batch(m, aos_points{points}, count, x, y, z, w);
+}
+
+void transform_points(const mat4 &m, const float *in_x, const float *in_y,
+                      const float *in_z, size_t count, float *x, float *y,
+                      float *z, float *w) {
+    transform_batch(m, soa_points{in_x, in_y, in_z}, count, x, y, z, w);
+}
+
+void transform_points(const mat4 &m, const int16_t *points, size_t count,
+                      float *x, float *y, float *z, float *w) {
+    transform_batch(m, int16_points{points}, count, x, y, z, w);
+}
+
 mat4 translate(const vec3 &v) {
     return {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, v.x, v.y, v.z, 1};
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "vec3.h"
 #include "vec4.h"
 
@@ -111,6 +114,19 @@ void invert(mat4 &m);
 
 vec3 transform_vector(const mat4 &m, const vec3 &v);
 
+// Batch versions of transform_vector for count points, the results after the
+// perspective divide are written to x, y and z, and the clip space w to w
+// unless it is null. The results are the same as of transform_vector.
+void transform_points(const mat4 &m, const vec3 *points, size_t count,
+                      float *x, float *y, float *z, float *w = nullptr);
+void transform_points(const mat4 &m, const float *in_x, const float *in_y,
+                      const float *in_z, size_t count, float *x, float *y,
+                      float *z, float *w = nullptr);
+// points are packed x, y, z triples of 16-bit integers, dequantization is
+// expected to be folded into the matrix
+void transform_points(const mat4 &m, const int16_t *points, size_t count,
+                      float *x, float *y, float *z, float *w = nullptr);
+
 mat4 translate(const vec3 &v);
 mat4 scale(const vec3 &v);
 mat4 rotate_x(float angle);
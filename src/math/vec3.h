@@ -13,11 +13,12 @@ struct vec3 {
         };
         float v[3];
     };
-    inline vec3() : x(0.0f), y(0.0f), z(0.0f) {
+    // constexpr, so vectors in the generated datasets stay in flash
+    constexpr vec3() : x(0.0f), y(0.0f), z(0.0f) {
     }
-    inline vec3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) {
+    constexpr vec3(float _x, float _y, float _z) : x(_x), y(_y), z(_z) {
     }
-    inline vec3(float s) : x(s), y(s), z(s) {
+    constexpr vec3(float s) : x(s), y(s), z(s) {
     }
     inline vec3(float *fv) : x(fv[0]), y(fv[1]), z(fv[2]) {
     }
@@ -0,0 +1,90 @@
+#include "binning.h"
+
+#include <algorithm>
+#include <limits>
+
+window tile_bins::tile(size_t index) {
+    int16_t column = static_cast<int16_t>(index % columns);
+    int16_t row = static_cast<int16_t>(index / columns);
+    point2 tile_begin = {
+        static_cast<int16_t>(begin.x + column * tile_width),
+        static_cast<int16_t>(begin.y + row * tile_height)};
+    point2 tile_end = {
+        std::min(end.x, static_cast<int16_t>(tile_begin.x + tile_width)),
+        std::min(end.y, static_cast<int16_t>(tile_begin.y + tile_height))};
+
+    return {tile_begin, tile_end,
+            {indices.data() + offsets[index],
+             offsets[index + 1] - offsets[index]}};
+}
+
+// tiles the range [min, max] overlaps on one axis, false if it misses the
+// screen
+static inline bool tile_range(int16_t min, int16_t max, int16_t begin,
+                              int16_t end, int16_t tile_size, int16_t count,
+                              int16_t &first, int16_t &last) {
+    if (max < begin || min > end - 1)
+        return false;
+
+    first = min <= begin ? 0 : (min - begin) / tile_size;
+    last = max >= end - 1 ? count - 1 : (max - begin) / tile_size;
+    return true;
+}
+
+// calls f(tile) for every tile the polygon overlaps
+template <typename F>
+static inline void for_each_tile(const tile_bins &bins, const bounds2 &bounds,
+                                 F f) {
+    int16_t first_column, last_column, first_row, last_row;
+    if (!tile_range(bounds.min.x, bounds.max.x, bins.begin.x, bins.end.x,
+                    bins.tile_width, bins.columns, first_column,
+                    last_column) ||
+        !tile_range(bounds.min.y, bounds.max.y, bins.begin.y, bins.end.y,
+                    bins.tile_height, bins.rows, first_row, last_row))
+        return;
+
+    for (int16_t row = first_row; row <= last_row; ++row) {
+        for (int16_t column = first_column; column <= last_column; ++column)
+            f(static_cast<size_t>(row) * bins.columns + column);
+    }
+}
+
+bool bin_polygons(const polygon_view &polygons, const window &screen,
+                  int16_t tile_width, int16_t tile_height, tile_bins &bins) {
+    if (polygons.size > std::numeric_limits<polygon_index>::max())
+        return false;
+
+    bins.begin = screen.begin;
+    bins.end = screen.end;
+    bins.tile_width = tile_width;
+    bins.tile_height = tile_height;
+    bins.columns = static_cast<int16_t>(
+        (screen.end.x - screen.begin.x + tile_width - 1) / tile_width);
+    bins.rows = static_cast<int16_t>(
+        (screen.end.y - screen.begin.y + tile_height - 1) / tile_height);
+
+    // counting sort: sizes go to offsets[tile + 1], the prefix sum turns them
+    // into list ends
+    bins.offsets.assign(bins.size() + 1, 0);
+    for (size_t i = 0; i < polygons.size; ++i) {
+        for_each_tile(bins, polygons.bounds[i],
+                      [&](size_t tile) { ++bins.offsets[tile + 1]; });
+    }
+
+    for (size_t tile = 0; tile < bins.size(); ++tile)
+        bins.offsets[tile + 1] += bins.offsets[tile];
+
+    // offsets[tile] is used as the fill cursor and ends at the start of the
+    // next list, the lists are shifted back after
+    bins.indices.resize(bins.offsets.back());
+    for (size_t i = 0; i < polygons.size; ++i) {
+        for_each_tile(bins, polygons.bounds[i], [&](size_t tile) {
+            bins.indices[bins.offsets[tile]++] = static_cast<polygon_index>(i);
+        });
+    }
+
+    for (size_t tile = bins.size(); tile > 0; --tile)
+        bins.offsets[tile] = bins.offsets[tile - 1];
+    bins.offsets[0] = 0;
+    return true;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include "common.h"
+
+// Polygon indices bucketed by the screen tiles their bounds overlap. The
+// lists of all tiles share one buffer: tile i owns indices[offsets[i]] up to
+// indices[offsets[i + 1]]. Tiles are numbered row by row, the last ones in a
+// row or column are cut by the screen border.
+struct tile_bins {
+    point2 begin;
+    point2 end;
+    int16_t tile_width;
+    int16_t tile_height;
+    int16_t columns;
+    int16_t rows;
+    std::vector<uint32_t> offsets;
+    std::vector<polygon_index> indices;
+
+    inline size_t size() const {
+        return static_cast<size_t>(columns) * rows;
+    }
+
+    // the window of the tile with its polygons, warnock_render reorders them
+    window tile(size_t index);
+};
+
+// Buckets the polygons into tiles of the screen once per frame, the vectors
+// keep their capacity between frames. A polygon goes to every tile its bounds
+// overlap, the same test check_relationship starts with, so each tile renders
+// exactly as it would from the full list. Polygons off the screen are dropped.
+// Returns false if the polygons do not fit polygon_index.
+bool bin_polygons(const polygon_view &polygons, const window &screen,
+                  int16_t tile_width, int16_t tile_height, tile_bins &bins);
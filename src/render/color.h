@@ -30,6 +30,11 @@ static inline color rgb565_to_rgb(const uint16_t hex) {
             static_cast<uint8_t>(((hex << 11) >> 11) << 3)};
 }
 
+static inline uint32_t rgb565_to_abgr8888(const uint16_t hex) {
+    color color = rgb565_to_rgb(hex);
+    return color.r | (color.g << 8) | (color.b << 16) | (0xFFu << 24);
+}
+
 static inline color material_color_to_rgb(const material_color color) {
     return {static_cast<uint8_t>(color.r), static_cast<uint8_t>(color.g),
             static_cast<uint8_t>(color.b)};
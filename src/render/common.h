@@ -6,29 +6,125 @@
 
 using point2 = m3::tvec2<int16_t>;
 
-struct line2 {
-    point2 begin;
-    point2 end;
+// line a * x + b * y + c = 0 through an edge, positive on the left side,
+// exact while coordinates stay within [-16383, 16383]
+struct edge2 {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+};
+
+// faces with more vertices are split into several polygons
+#define POLYGON_MAX_VERTICES 4
+
+// the depth kernels of depth.h use SSE2 where it is available, DEPTH_SCALAR
+// forces the scalar kernels the Pico runs, so they can be checked on x86
+#if defined(__SSE2__) && !defined(DEPTH_SCALAR)
+#define DEPTH_SSE2
+#endif
+
+// depth of the plane in the screen point (x, y) is dz_dx * x + dz_dy * y + z0,
+// the plane is normalized once, so depth tests do not divide. The SSE2 depth
+// kernels load a plane at once, the scalar ones keep it at 12 bytes.
+#if defined(DEPTH_SSE2)
+struct alignas(16) plane {
+#else
+struct plane {
+#endif
+    float dz_dx;
+    float dz_dy;
+    float z0;
+#if defined(DEPTH_SSE2)
+    // one plane is one SIMD load
+    float padding = 0;
+#endif
+};
+
+// both corners inclusive
+struct bounds2 {
+    point2 min;
+    point2 max;
+};
+
+struct polygon_ring {
+    point2 vertices[POLYGON_MAX_VERTICES];
+    // edges[i] goes from vertices[i] to the next vertex
+    edge2 edges[POLYGON_MAX_VERTICES];
+    uint8_t vertices_count;
+    bool convex;
 };
 
-struct polygon {
-    std::vector<point2> vertices;
-    uint16_t color;
-    float a, b, c, d;
+// polygon i is made of the i-th elements of the arrays, which are read by
+// different stages: bounds and rings by the classification, planes by the
+// depth tests, colors and ids only by the winners
+struct polygon_view {
+    const plane *planes;
+    const bounds2 *bounds;
+    const polygon_ring *rings;
+    const uint16_t *colors;
+    // index of the source face in the scene, breaks depth ties
+    const uint32_t *ids;
+    size_t size;
+};
+
+struct polygon_store {
+    std::vector<plane> planes;
+    std::vector<bounds2> bounds;
+    std::vector<polygon_ring> rings;
+    std::vector<uint16_t> colors;
+    std::vector<uint32_t> ids;
+
+    void resize(size_t size) {
+        planes.resize(size);
+        bounds.resize(size);
+        rings.resize(size);
+        colors.resize(size);
+        ids.resize(size);
+    }
+
+    size_t size() const {
+        return ids.size();
+    }
+
+    polygon_view view() const {
+        return {planes.data(), bounds.data(), rings.data(),
+                colors.data(), ids.data(),    ids.size()};
+    }
 };
 
 template <typename T>
 struct array {
     T *data;
     size_t size;
+
+    constexpr T *begin() const {
+        return data;
+    }
+
+    constexpr T *end() const {
+        return data + size;
+    }
+
+    constexpr T &operator[](size_t index) const {
+        return data[index];
+    }
 };
 
+// renderers partition indices instead of moving the polygons, 16 bits are
+// enough for the Pico, the desktop build defines WIDE_POLYGON_INDICES
+#ifdef WIDE_POLYGON_INDICES
+using polygon_index = uint32_t;
+#else
+using polygon_index = uint16_t;
+#endif
+
 struct window {
     // top left corner
     point2 begin;
     // bottom right corner
     point2 end;
-    array<polygon> polygons{};
+    // indices into the polygon view being rendered
+    array<polygon_index> polygons{};
 };
 
 std::vector<std::string> split(const std::string &s, const std::string &delimiter);
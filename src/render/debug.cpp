@@ -15,10 +15,8 @@ std::ostream &operator<<(std::ostream &os, const material &material) {
 }
 
 std::ostream &operator<<(std::ostream &os, const face &face) {
-    os << "face vertex indices: ";
-    for (size_t i = 0; i < face.vertex_indices.size(); i++)
-        os << face.vertex_indices[i] << ", ";
-    os << std::endl;
+    os << "face first index: " << face.first_index << std::endl;
+    os << "face vertices count: " << face.vertices_count << std::endl;
 
     os << "face normal index: " << face.normal_index << std::endl;
     os << "face material index: " << face.material_index;
@@ -28,33 +26,40 @@ std::ostream &operator<<(std::ostream &os, const face &face) {
 
 std::ostream &operator<<(std::ostream &os, const object &object) {
     os << "vertices:" << std::endl;
-    for (size_t i = 0; i < object.vertices.size(); i++)
-        os << object.vertices[i] << std::endl;
+    for (size_t i = 0; i < vertices_count(object); i++)
+        os << get_vertex(object, i) << std::endl;
 
     os << "normals:" << std::endl;
-    for (size_t i = 0; i < object.normals.size(); i++)
+    for (size_t i = 0; i < object.normals.size; i++)
         os << object.normals[i] << std::endl;
 
     os << "faces:" << std::endl;
-    for (size_t i = 0; i < object.faces.size(); i++)
-        os << object.faces[i] << std::endl << std::endl;
+    for (size_t i = 0; i < object.faces.size; i++) {
+        const face &face = object.faces[i];
+        os << face << std::endl;
+
+        os << "face vertex indices: ";
+        for (size_t j = 0; j < face.vertices_count; j++)
+            os << object.indices[face.first_index + j] << ", ";
+        os << std::endl << std::endl;
+    }
 
     return os;
 }
 
-std::ostream &operator<<(std::ostream &os, const polygon &polygon) {
+std::ostream &operator<<(std::ostream &os, const polygon_ring &ring) {
     os << "polygon vertices: ";
-    for (size_t i = 0; i < polygon.vertices.size(); i++)
-        os << polygon.vertices[i] << ", ";
-    os << std::endl;
-
-    os << "polygon plane factors: " << polygon.a << ", " << polygon.b << ", "
-       << polygon.c << ", " << polygon.d << std::endl;
-    os << "polygon color hex: " << std::hex << polygon.color << std::dec;
+    for (size_t i = 0; i < ring.vertices_count; i++)
+        os << ring.vertices[i] << ", ";
 
     return os;
 }
 
+std::ostream &operator<<(std::ostream &os, const plane &plane) {
+    return os << "polygon depth factors: " << plane.dz_dx << ", "
+              << plane.dz_dy << ", " << plane.z0;
+}
+
 std::ostream &operator<<(std::ostream &os, const window &window) {
     os << "window: ";
     os << window.begin << ", " << window.end << std::endl;
@@ -64,3 +69,39 @@ std::ostream &operator<<(std::ostream &os, const window &window) {
 
     return os;
 }
+
+std::ostream &operator<<(std::ostream &os, const warnock_stats &stats) {
+    os << "windows per depth:";
+    for (size_t i = 0; i < WARNOCK_STATS_DEPTHS; i++) {
+        if (stats.windows[i] != 0)
+            os << ' ' << i << ':' << stats.windows[i];
+    }
+    os << std::endl;
+
+    os << "relationships: disjoint " << stats.relationships[0]
+       << ", contained " << stats.relationships[1] << ", intersecting "
+       << stats.relationships[2] << ", surrounding " << stats.relationships[3]
+       << std::endl;
+    os << "cover polygon: hits " << stats.cover_hits << ", misses "
+       << stats.cover_misses << std::endl;
+    os << "pixel fills: " << stats.pixel_fills << std::endl;
+    os << "max stack size: " << stats.max_stack_size;
+
+    return os;
+}
+
+std::ostream &operator<<(std::ostream &os, const frame_profiler &profiler) {
+    os << "last " << profiler.sample_count() << " frames, min/avg/max us";
+    for (size_t i = 0; i < PROFILE_DISPLAYS; i++) {
+        os << std::endl << "display " << i << ":";
+        for (size_t j = 0; j < FRAME_STAGES; j++) {
+            auto stage = static_cast<frame_stage>(j);
+            stage_summary summary = profiler.summarize(i, stage);
+            os << std::endl
+               << "  " << stage_name(stage) << ' ' << summary.min_us << '/'
+               << summary.avg_us << '/' << summary.max_us;
+        }
+    }
+
+    return os;
+}
@@ -2,6 +2,8 @@
 
 #include "common.h"
 #include "object.h"
+#include "profiler.h"
+#include "stats.h"
 #include <iostream>
 
 std::ostream &operator<<(std::ostream &os, const point2 &point);
@@ -9,5 +11,8 @@ std::ostream &operator<<(std::ostream &os, const color &color);
 std::ostream &operator<<(std::ostream &os, const material &material);
 std::ostream &operator<<(std::ostream &os, const face &face);
 std::ostream &operator<<(std::ostream &os, const object &object);
-std::ostream &operator<<(std::ostream &os, const polygon &polygon);
+std::ostream &operator<<(std::ostream &os, const polygon_ring &ring);
+std::ostream &operator<<(std::ostream &os, const plane &plane);
 std::ostream &operator<<(std::ostream &os, const window &window);
+std::ostream &operator<<(std::ostream &os, const warnock_stats &stats);
+std::ostream &operator<<(std::ostream &os, const frame_profiler &profiler);
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstdint>
+
+#include "common.h"
+
+#if defined(DEPTH_SSE2)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#endif
+
+// Depth kernels of fill_pixel and find_cover_polygon. x86 builds evaluate
+// four polygons or four window corners per step with SSE2, other targets, the
+// Pico among them, and builds with DEPTH_SCALAR use the scalar loops. Every
+// path picks the same winners. There is no AVX2 path: most leaf windows hold
+// two to four polygons, which do not fill eight lanes, and the four corners
+// of a window are exactly one SSE2 vector.
+
+#if defined(DEPTH_SSE2)
+#define DEPTH_KERNELS "sse2"
+#else
+#define DEPTH_KERNELS "scalar"
+#endif
+
+static inline float get_z(const plane &plane, const point2 &point) {
+    return plane.dz_dx * (float)point.x + plane.dz_dy * (float)point.y +
+           plane.z0;
+}
+
+// depth test with a tie-break on polygon id, so the winner does not depend on
+// the order polygons were left in by the partitioning
+static inline bool is_closer(float z, uint32_t id, float z_max,
+                             uint32_t closest_id) {
+    return z > z_max || (z == z_max && id < closest_id);
+}
+
+#if defined(DEPTH_SSE2)
+
+#define DEPTH_LANES 4
+
+static inline __m128i select_si128(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static inline __m128 select_ps(__m128i mask, __m128 a, __m128 b) {
+    return _mm_castsi128_ps(
+        select_si128(mask, _mm_castps_si128(a), _mm_castps_si128(b)));
+}
+
+// lanes where (z, id) is closer than (z_max, id_max), ids fit in 31 bits
+static inline __m128i is_closer_ps(__m128 z, __m128i id, __m128 z_max,
+                                   __m128i id_max) {
+    __m128i greater = _mm_castps_si128(_mm_cmpgt_ps(z, z_max));
+    __m128i equal = _mm_castps_si128(_mm_cmpeq_ps(z, z_max));
+    return _mm_or_si128(greater,
+                        _mm_and_si128(equal, _mm_cmplt_epi32(id, id_max)));
+}
+
+// depth of one plane in four points
+static inline __m128 corner_depth(const plane &plane, __m128 x, __m128 y) {
+    __m128 factors = _mm_load_ps(&plane.dz_dx);
+    __m128 dz_dx = _mm_shuffle_ps(factors, factors, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 dz_dy = _mm_shuffle_ps(factors, factors, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 z0 = _mm_shuffle_ps(factors, factors, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(dz_dx, x), _mm_mul_ps(dz_dy, y)),
+                      z0);
+}
+
+// depth of polygons indices[0..4) in the point, four planes are transposed
+// into the dz_dx, dz_dy and z0 vectors
+static inline void depth_block(const polygon_view &polygons,
+                               const polygon_index *indices, __m128 x,
+                               __m128 y, __m128 &z, __m128i &id,
+                               __m128i &index) {
+    __m128 dz_dx = _mm_load_ps(&polygons.planes[indices[0]].dz_dx);
+    __m128 dz_dy = _mm_load_ps(&polygons.planes[indices[1]].dz_dx);
+    __m128 z0 = _mm_load_ps(&polygons.planes[indices[2]].dz_dx);
+    __m128 padding = _mm_load_ps(&polygons.planes[indices[3]].dz_dx);
+    _MM_TRANSPOSE4_PS(dz_dx, dz_dy, z0, padding);
+
+    z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dz_dx, x), _mm_mul_ps(dz_dy, y)), z0);
+    id = _mm_set_epi32(polygons.ids[indices[3]], polygons.ids[indices[2]],
+                       polygons.ids[indices[1]], polygons.ids[indices[0]]);
+    index = _mm_set_epi32(indices[3], indices[2], indices[1], indices[0]);
+}
+
+#endif
+
+static inline polygon_index closest_polygon_scalar(const polygon_view &polygons,
+                                                   const polygon_index *indices,
+                                                   size_t size,
+                                                   const point2 &point) {
+    polygon_index closest = indices[0];
+    float z_max = get_z(polygons.planes[closest], point);
+    for (size_t i = 1; i < size; ++i) {
+        polygon_index index = indices[i];
+        float z = get_z(polygons.planes[index], point);
+        if (is_closer(z, polygons.ids[index], z_max, polygons.ids[closest])) {
+            z_max = z;
+            closest = index;
+        }
+    }
+
+    return closest;
+}
+
+// index of the polygon closest to the viewer in the point, size must not be
+// zero
+static inline polygon_index closest_polygon(const polygon_view &polygons,
+                                            const polygon_index *indices,
+                                            size_t size, const point2 &point) {
+#if defined(DEPTH_LANES)
+    // most leaf windows see two to four polygons, the transposes do not pay
+    // off for a single block
+    if (size <= DEPTH_LANES)
+        return closest_polygon_scalar(polygons, indices, size, point);
+
+    // the last block is padded with the first polygon, a duplicate never
+    // changes the winner
+    polygon_index tail[DEPTH_LANES];
+    size_t blocks = (size + DEPTH_LANES - 1) / DEPTH_LANES;
+    size_t tail_size = size - (blocks - 1) * DEPTH_LANES;
+    for (size_t i = 0; i < DEPTH_LANES; ++i)
+        tail[i] = i < tail_size ? indices[(blocks - 1) * DEPTH_LANES + i]
+                                : indices[0];
+
+    __m128 x = _mm_set1_ps(point.x), y = _mm_set1_ps(point.y);
+    __m128 z_max;
+    __m128i id_max, closest;
+    depth_block(polygons, tail, x, y, z_max, id_max, closest);
+    for (size_t i = 0; i + 1 < blocks; ++i) {
+        __m128 z;
+        __m128i id, index;
+        depth_block(polygons, indices + i * DEPTH_LANES, x, y, z, id, index);
+
+        __m128i closer = is_closer_ps(z, id, z_max, id_max);
+        z_max = select_ps(closer, z, z_max);
+        id_max = select_si128(closer, id, id_max);
+        closest = select_si128(closer, index, closest);
+    }
+
+    alignas(16) float lane_z[DEPTH_LANES];
+    alignas(16) uint32_t lane_id[DEPTH_LANES], lane_closest[DEPTH_LANES];
+    _mm_store_ps(lane_z, z_max);
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane_id), id_max);
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane_closest), closest);
+
+    size_t best = 0;
+    for (size_t i = 1; i < DEPTH_LANES; ++i) {
+        if (is_closer(lane_z[i], lane_id[i], lane_z[best], lane_id[best]))
+            best = i;
+    }
+
+    return static_cast<polygon_index>(lane_closest[best]);
+#else
+    return closest_polygon_scalar(polygons, indices, size, point);
+#endif
+}
+
+// indices of the polygons closest to the viewer in each of the four corners,
+// size must not be zero
+static inline void closest_polygons(const polygon_view &polygons,
+                                    const polygon_index *indices, size_t size,
+                                    const point2 corners[4],
+                                    polygon_index closest[4]) {
+#if defined(DEPTH_SSE2)
+    // one polygon per step, the corners are the lanes
+    __m128 x = _mm_set_ps(corners[3].x, corners[2].x, corners[1].x,
+                          corners[0].x);
+    __m128 y = _mm_set_ps(corners[3].y, corners[2].y, corners[1].y,
+                          corners[0].y);
+
+    __m128 z_max = corner_depth(polygons.planes[indices[0]], x, y);
+    __m128i id_max = _mm_set1_epi32(polygons.ids[indices[0]]);
+    __m128i closest_index = _mm_set1_epi32(indices[0]);
+    for (size_t i = 1; i < size; ++i) {
+        polygon_index index = indices[i];
+        __m128 z = corner_depth(polygons.planes[index], x, y);
+        __m128i id = _mm_set1_epi32(polygons.ids[index]);
+
+        __m128i closer = is_closer_ps(z, id, z_max, id_max);
+        z_max = select_ps(closer, z, z_max);
+        id_max = select_si128(closer, id, id_max);
+        closest_index =
+            select_si128(closer, _mm_set1_epi32(index), closest_index);
+    }
+
+    alignas(16) uint32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), closest_index);
+    for (size_t i = 0; i < 4; ++i)
+        closest[i] = static_cast<polygon_index>(lanes[i]);
+#else
+    float z_max[4];
+    for (size_t i = 0; i < 4; ++i) {
+        closest[i] = indices[0];
+        z_max[i] = get_z(polygons.planes[indices[0]], corners[i]);
+    }
+
+    for (size_t i = 1; i < size; ++i) {
+        polygon_index index = indices[i];
+        const plane &plane = polygons.planes[index];
+        uint32_t id = polygons.ids[index];
+
+        for (size_t j = 0; j < 4; ++j) {
+            float z = get_z(plane, corners[j]);
+            if (is_closer(z, id, z_max[j], polygons.ids[closest[j]])) {
+                z_max[j] = z;
+                closest[j] = index;
+            }
+        }
+    }
+#endif
+}
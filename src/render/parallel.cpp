@@ -0,0 +1,351 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common.h"
+#include "parallel.h"
+#include "warnock.h"
+
+// indices per arena chunk, longer lists get a chunk of their own
+#define ARENA_CHUNK_SIZE (1 << 16)
+// failed searches for a task before an idle worker sleeps
+#define IDLE_SPINS 64
+
+// Bump allocator of index lists. Lists are never freed one by one, the arena
+// is reset by every render and its chunks are kept for the next one.
+class index_arena {
+public:
+    void reset() {
+        chunk = 0;
+        used = 0;
+    }
+
+    polygon_index *allocate(size_t size) {
+        while (chunk < chunks.size() && used + size > chunks[chunk].size()) {
+            ++chunk;
+            used = 0;
+        }
+        if (chunk == chunks.size())
+            chunks.emplace_back(std::max<size_t>(size, ARENA_CHUNK_SIZE));
+
+        polygon_index *data = chunks[chunk].data() + used;
+        used += size;
+        return data;
+    }
+
+    // frees the last allocation
+    void release(size_t size) {
+        used -= size;
+    }
+
+private:
+    // chunks are never resized, so the lists in them never move
+    std::vector<std::vector<polygon_index>> chunks;
+    size_t chunk = 0;
+    size_t used = 0;
+};
+
+// Windows to render, their index lists live in the arena of the worker that
+// split them and are only read once the window is pushed. The owner pushes
+// and pops at the back, other workers steal from the front.
+class task_deque {
+public:
+    void reset() {
+        tasks.clear();
+        head = 0;
+    }
+
+    void push(const window &window) {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(window);
+    }
+
+    bool pop(window &window) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (head == tasks.size())
+            return false;
+
+        window = tasks.back();
+        tasks.pop_back();
+        if (head == tasks.size())
+            reset();
+        return true;
+    }
+
+    bool steal(window &window) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (head == tasks.size())
+            return false;
+
+        window = tasks[head++];
+        if (head == tasks.size())
+            reset();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    // tasks before head were stolen, the storage is kept between renders
+    std::vector<window> tasks;
+    size_t head = 0;
+};
+
+struct worker_state {
+    task_deque tasks;
+    index_arena arena;
+};
+
+// kept between renders, so a frame allocates only when it needs more
+// memory than the frames before it. warnock_render_parallel is not reentrant.
+static std::deque<worker_state> workers;
+
+// Threads of workers 1 and up, started by the first render that needs them
+// and parked between renders. Parked threads and the idle workers of a
+// render wait on the same condition variable. Declared after workers, so the
+// threads are joined before the worker states are destroyed.
+class worker_pool {
+public:
+    std::mutex mutex;
+    std::condition_variable idle;
+    // workers waiting on idle
+    std::atomic<size_t> sleeping{0};
+
+    ~worker_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        idle.notify_all();
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    // runs job(context, worker) for workers 1 to workers_count - 1 on the
+    // pool threads, the caller runs worker 0 and then waits for the others
+    void start(size_t workers_count, void (*job)(void *, size_t),
+               void *context) {
+        while (threads.size() + 1 < workers_count)
+            threads.emplace_back(&worker_pool::park, this, threads.size() + 1);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->workers_count = workers_count;
+            this->job = job;
+            this->context = context;
+            running = workers_count - 1;
+            ++generation;
+        }
+        idle.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return running == 0; });
+    }
+
+private:
+    std::vector<std::thread> threads;
+    // bumped by every render, a parked thread runs each generation once
+    uint64_t generation = 0;
+    size_t workers_count = 0;
+    // pool threads of the current render that have not returned yet
+    size_t running = 0;
+    void (*job)(void *, size_t) = nullptr;
+    void *context = nullptr;
+    bool stopping = false;
+
+    void park(size_t worker) {
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            idle.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+
+            seen = generation;
+            if (worker >= workers_count)
+                continue;
+
+            lock.unlock();
+            job(context, worker);
+            lock.lock();
+            if (--running == 0)
+                idle.notify_all();
+        }
+    }
+};
+
+static worker_pool pool;
+
+template <typename Sink>
+struct render_context {
+    Sink &sink;
+    polygon_view polygons;
+    uint16_t bg_color;
+    size_t workers_count;
+    // windows pushed but not processed yet
+    std::atomic<size_t> pending;
+    // windows in the deques
+    std::atomic<size_t> queued;
+};
+
+static void wake_workers() {
+    if (pool.sleeping.load() == 0)
+        return;
+
+    // a worker holds the mutex between its last check and its wait, so
+    // taking it here cannot miss one
+    { std::lock_guard<std::mutex> lock(pool.mutex); }
+    pool.idle.notify_all();
+}
+
+template <typename Sink>
+static void split_task(render_context<Sink> &context, size_t worker,
+                       const window &window,
+                       const array<polygon_index> &visible) {
+    struct window parts[4];
+    size_t parts_count = split_window(window, parts);
+    context.pending.fetch_add(parts_count);
+    for (size_t i = 0; i < parts_count; ++i) {
+        parts[i].polygons = visible;
+        workers[worker].tasks.push(parts[i]);
+    }
+    context.queued.fetch_add(parts_count);
+    wake_workers();
+}
+
+template <typename Sink>
+static void process_task(render_context<Sink> &context, size_t worker,
+                         const window &window) {
+    // partition a private copy, siblings may be reading the list of the
+    // window. The copy stays allocated only if the window is split.
+    index_arena &arena = workers[worker].arena;
+    size_t size = window.polygons.size;
+    polygon_index *buffer = arena.allocate(size);
+    if (size != 0)
+        memcpy(buffer, window.polygons.data, size * sizeof(polygon_index));
+
+    size_t surrounding_cursor;
+    no_stats stats;
+    size_t disjoint_cursor = partition_polygons(
+        window, context.polygons, buffer, size, surrounding_cursor, stats);
+
+    array<polygon_index> visible = {buffer + disjoint_cursor,
+                                    size - disjoint_cursor};
+
+    uint16_t window_width = window.end.x - window.begin.x;
+    uint16_t window_height = window.end.y - window.begin.y;
+
+    bool split = false;
+    if (window_width == 1 && window_height == 1) {
+        if (visible.size == 0) {
+            context.sink.set_pixel(window.begin, context.bg_color);
+        } else {
+            fill_pixel(context.sink, window.begin, context.polygons,
+                       visible.data, visible.size);
+        }
+    } else if (surrounding_cursor != disjoint_cursor) {
+        split = true;
+    } else if (visible.size == 0) {
+        fill_window(context.sink, window, context.bg_color);
+    } else {
+        polygon_index cover;
+        if (find_cover_polygon(window, context.polygons, visible.data,
+                               visible.size, cover)) {
+            fill_window(context.sink, window, context.polygons.colors[cover]);
+        } else {
+            split = true;
+        }
+    }
+
+    if (split)
+        split_task(context, worker, window, visible);
+    else
+        arena.release(size);
+}
+
+template <typename Sink>
+static bool find_task(render_context<Sink> &context, size_t worker,
+                      window &window) {
+    bool found = workers[worker].tasks.pop(window);
+    for (size_t i = 1; !found && i < context.workers_count; ++i)
+        found = workers[(worker + i) % context.workers_count].tasks.steal(
+            window);
+
+    if (found)
+        context.queued.fetch_sub(1);
+    return found;
+}
+
+template <typename Sink>
+static void run_worker(render_context<Sink> &context, size_t worker) {
+    size_t spins = 0;
+    while (context.pending.load() > 0) {
+        window window;
+        if (find_task(context, worker, window)) {
+            spins = 0;
+            process_task(context, worker, window);
+            if (context.pending.fetch_sub(1) == 1)
+                wake_workers();
+            continue;
+        }
+
+        if (++spins < IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(pool.mutex);
+        pool.sleeping.fetch_add(1);
+        pool.idle.wait(lock, [&context] {
+            return context.queued.load() > 0 || context.pending.load() == 0;
+        });
+        pool.sleeping.fetch_sub(1);
+        spins = 0;
+    }
+}
+
+template <typename Sink>
+static void run_pool_worker(void *context, size_t worker) {
+    run_worker(*static_cast<render_context<Sink> *>(context), worker);
+}
+
+template <typename Sink>
+void warnock_render_parallel(Sink &sink, const polygon_view &polygons,
+                             const window &window, const uint16_t bg_color,
+                             size_t thread_count) {
+    if (thread_count == 0)
+        thread_count = 1;
+
+    while (workers.size() < thread_count)
+        workers.emplace_back();
+    for (size_t i = 0; i < thread_count; ++i) {
+        workers[i].tasks.reset();
+        workers[i].arena.reset();
+    }
+
+    // one window is pending and queued
+    render_context<Sink> context{
+        sink, polygons, bg_color, thread_count, {1}, {1}};
+
+    // the first window reads the list of the caller, which is never written
+    workers[0].tasks.push(window);
+
+    pool.start(thread_count, run_pool_worker<Sink>, &context);
+    run_worker(context, 0);
+    pool.wait();
+}
+
+template void warnock_render_parallel(rgb565_sink &, const polygon_view &,
+                                      const window &, uint16_t, size_t);
+template void warnock_render_parallel(abgr8888_sink &, const polygon_view &,
+                                      const window &, uint16_t, size_t);
+template void warnock_render_parallel(tile_sink &, const polygon_view &,
+                                      const window &, uint16_t, size_t);
+template void warnock_render_parallel(null_sink &, const polygon_view &,
+                                      const window &, uint16_t, size_t);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "common.h"
+#include "sink.h"
+
+// Renders the window on thread_count threads. Subdivided windows are
+// distributed through per-thread work-stealing deques, the output is the same
+// as the output of warnock_render. The index list of the window is left
+// untouched. The sink is written concurrently, but never twice for the same
+// point. The threads and their buffers are kept between calls, calls must not
+// overlap.
+template <typename Sink>
+void warnock_render_parallel(Sink &sink, const polygon_view &polygons,
+                             const window &window, uint16_t bg_color,
+                             size_t thread_count);
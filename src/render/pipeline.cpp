@@ -1,8 +1,11 @@
 #include "pipeline.h"
 #include "common.h"
 #include <cmath>
+#include <limits>
 #include <map>
 
+#define PLANE_EPSILON 1e-6f
+
 static void move_points(std::vector<m3::vec3> &points, const m3::vec3 &diff) {
     for (auto &point : points) {
         point.x += diff.x;
@@ -31,79 +34,189 @@ static inline float cos_angle(const m3::vec3 &vec1, const m3::vec3 &vec2) {
     return scalar_product(vec1, vec2) / (magnitude(vec1) * magnitude(vec2));
 }
 
-static bool solve_slae(std::vector<float> &res_column,
-                       std::vector<std::vector<float>> matrix,
-                       std::vector<float> free_factor_column) {
-    size_t rows_count = matrix.size();
-    size_t columns_count = matrix[0].size();
+// Newell's method: the normal of the plane is the sum of the edge
+// contributions, which is exact for planar faces and a least squares fit for
+// slightly non-planar ones. Returns false if the face is degenerate (its
+// vertices are collinear) or is seen edge-on, so depth can not be computed.
+bool compute_plane_equation(const std::vector<m3::vec3> &vertices,
+                            plane &plane) {
+    size_t size = vertices.size();
+    m3::vec3 normal;
+    m3::vec3 center;
+    float max_edge_sq = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const m3::vec3 &current = vertices[i];
+        const m3::vec3 &next = vertices[(i + 1) % size];
 
-    for (size_t k = 0; k < columns_count; k++) {
-        float max = abs(matrix[k][k]);
-        int row_index = k;
+        normal.x += (current.y - next.y) * (current.z + next.z);
+        normal.y += (current.z - next.z) * (current.x + next.x);
+        normal.z += (current.x - next.x) * (current.y + next.y);
+        center.add_(current);
+        max_edge_sq = std::fmax(max_edge_sq, m3::len_sq(next - current));
+    }
 
-        for (size_t i = k + 1; i < rows_count; i++) {
-            if (abs(matrix[i][k]) > max) {
-                max = abs(matrix[i][k]);
-                row_index = i;
-            }
-        }
+    // |normal| is twice the face area, compare it with the longest edge
+    float normal_len = m3::len(normal);
+    if (size < 3 || normal_len <= PLANE_EPSILON * max_edge_sq ||
+        std::fabs(normal.z) <= PLANE_EPSILON * normal_len) {
+        // never closer than any valid polygon
+        plane = {0, 0, -std::numeric_limits<float>::infinity()};
+        return false;
+    }
+
+    // solve normal.x * x + normal.y * y + normal.z * z + d = 0 for z
+    center = center / static_cast<float>(size);
+    float d = -m3::dot(normal, center);
+    float inv_z = -1 / normal.z;
+    plane = {normal.x * inv_z, normal.y * inv_z, d * inv_z};
+    return true;
+}
 
-        std::swap(matrix[k], matrix[row_index]);
-        std::swap(free_factor_column[k], free_factor_column[row_index]);
+// twice the signed area of the projected face, positive if it winds
+// counterclockwise on the screen
+static float signed_area(const std::vector<m3::vec3> &vertices) {
+    size_t size = vertices.size();
+    float area = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const m3::vec3 &current = vertices[i];
+        const m3::vec3 &next = vertices[(i + 1) % size];
+        area += current.x * next.y - next.x * current.y;
+    }
 
-        for (size_t i = k + 1; i < rows_count; i++) {
-            float c = matrix[i][k] / matrix[k][k];
+    return area;
+}
 
-            for (size_t j = k; j < columns_count; j++)
-                matrix[i][j] -= c * matrix[k][j];
+static inline m3::vec4 lerp(const m3::vec4 &a, const m3::vec4 &b, float t) {
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t,
+            a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t};
+}
 
-            free_factor_column[i] -= c * free_factor_column[k];
+// Sutherland-Hodgman against the plane w = -near_distance in clip space, the
+// kept vertices are divided by w the way transform_points does
+static void clip_near(const std::vector<m3::vec4> &vertices,
+                      float near_distance, std::vector<m3::vec3> &clipped) {
+    clipped.clear();
+    size_t size = vertices.size();
+    for (size_t i = 0; i < size; ++i) {
+        const m3::vec4 &current = vertices[i];
+        const m3::vec4 &next = vertices[(i + 1) % size];
+        bool current_inside = -current.w >= near_distance;
+        if (current_inside) {
+            float one_over_w = 1.0f / current.w;
+            clipped.push_back({current.x * one_over_w, current.y * one_over_w,
+                               current.z * one_over_w});
         }
-    }
+        if (current_inside == (-next.w >= near_distance))
+            continue;
 
-    if (abs(matrix[rows_count - 1][columns_count - 1]) <=
-        std::numeric_limits<float>::epsilon()) {
-        return false;
+        float t = (-near_distance - current.w) / (next.w - current.w);
+        m3::vec4 crossing = lerp(current, next, t);
+        float one_over_w = -1.0f / near_distance;
+        clipped.push_back({crossing.x * one_over_w, crossing.y * one_over_w,
+                           crossing.z * one_over_w});
     }
+}
 
-    for (int i = rows_count - 1; i >= 0; i--) {
-        float sum = 0;
-        for (size_t j = i + 1; j < columns_count; j++)
-            sum += matrix[i][j] * res_column[j];
+// keeps the part of the polygon where sign * vertex[axis] <= GUARD_BAND
+static void clip_guard_band_side(const std::vector<m3::vec3> &vertices,
+                                 int axis, float sign,
+                                 std::vector<m3::vec3> &clipped) {
+    clipped.clear();
+    size_t size = vertices.size();
+    for (size_t i = 0; i < size; ++i) {
+        const m3::vec3 &current = vertices[i];
+        const m3::vec3 &next = vertices[(i + 1) % size];
+        float current_distance = sign * current.v[axis] - GUARD_BAND;
+        float next_distance = sign * next.v[axis] - GUARD_BAND;
+        if (current_distance <= 0)
+            clipped.push_back(current);
+        if ((current_distance <= 0) != (next_distance <= 0)) {
+            float t = current_distance / (current_distance - next_distance);
+            clipped.push_back(m3::lerp(current, next, t));
+        }
+    }
+}
 
-        res_column[i] = (free_factor_column[i] - sum) / matrix[i][i];
+static bool is_inside_guard_band(const std::vector<m3::vec3> &vertices) {
+    for (auto &vertex : vertices) {
+        if (std::fabs(vertex.x) > GUARD_BAND ||
+            std::fabs(vertex.y) > GUARD_BAND)
+            return false;
     }
 
     return true;
 }
 
-static void compute_plane_equation(const std::vector<m3::vec3> &vertices,
-                                   polygon &polygon) {
-    polygon.a = polygon.b = polygon.c = 0;
-    polygon.d = 1000;
-    for (size_t i = 0; i < vertices.size() - 2; ++i) {
-        for (size_t j = i + 1; j < vertices.size() - 1; ++j) {
-            for (size_t k = j + 1; k < vertices.size(); ++k) {
-                std::vector<float> res(3, 0.);
-                std::vector<std::vector<float>> matrix = {
-                    {vertices[i].x, vertices[i].y, vertices[i].z},
-                    {vertices[j].x, vertices[j].y, vertices[j].z},
-                    {vertices[k].x, vertices[k].y, vertices[k].z}};
-                std::vector<float> free_factor_column(3, -polygon.d);
-
-                if (solve_slae(res, matrix, free_factor_column)) {
-                    polygon.a = res[0];
-                    polygon.b = res[1];
-                    polygon.c = res[2];
-                    break;
-                }
-            }
+// clips the polygon to the guard band square one side at a time
+static void clip_guard_band(std::vector<m3::vec3> &vertices,
+                            std::vector<m3::vec3> &scratch) {
+    for (int axis = 0; axis < 2 && vertices.size() >= 3; ++axis) {
+        clip_guard_band_side(vertices, axis, 1, scratch);
+        clip_guard_band_side(scratch, axis, -1, vertices);
+    }
+}
+
+static void compute_edges_and_bounds(polygon_ring &ring, bounds2 &bounds) {
+    size_t size = ring.vertices_count;
+    bounds.min = bounds.max = ring.vertices[0];
+    for (size_t i = 0; i < size; ++i) {
+        const point2 &begin = ring.vertices[i];
+        const point2 &end = ring.vertices[(i + 1) % size];
+
+        int32_t a = begin.y - end.y;
+        int32_t b = end.x - begin.x;
+        ring.edges[i] = {a, b, -(a * begin.x + b * begin.y)};
+
+        bounds.min.x = std::min(bounds.min.x, begin.x);
+        bounds.min.y = std::min(bounds.min.y, begin.y);
+        bounds.max.x = std::max(bounds.max.x, begin.x);
+        bounds.max.y = std::max(bounds.max.y, begin.y);
+    }
+}
+
+static inline int sign(int64_t value) {
+    return (value > 0) - (value < 0);
+}
+
+// convex if all turns have the same direction and the border goes around
+// once, which means the edge directions change sign at most twice on each
+// axis
+static bool is_convex(const polygon_ring &ring) {
+    size_t size = ring.vertices_count;
+    if (size <= 3)
+        return true;
+
+    int turn = 0;
+    int x_changes = 0, y_changes = 0;
+    int x_sign = 0, y_sign = 0;
+    for (size_t i = 0; i <= size; ++i) {
+        const edge2 &edge = ring.edges[i % size];
+        const edge2 &next = ring.edges[(i + 1) % size];
+
+        // edge direction is (b, -a)
+        int cross = sign(static_cast<int64_t>(next.a) * edge.b -
+                         static_cast<int64_t>(edge.a) * next.b);
+        if (cross != 0) {
+            if (turn != 0 && cross != turn)
+                return false;
+            turn = cross;
+        }
+
+        if (sign(edge.b) != 0) {
+            x_changes += x_sign != 0 && sign(edge.b) != x_sign;
+            x_sign = sign(edge.b);
+        }
+        if (sign(edge.a) != 0) {
+            y_changes += y_sign != 0 && sign(edge.a) != y_sign;
+            y_sign = sign(edge.a);
         }
     }
+
+    return x_changes <= 2 && y_changes <= 2;
 }
 
 static uint16_t material_to_rgb565(const material &material,
-                                   const std::vector<m3::vec3> &lights,
+                                   const array<const m3::vec3> &lights,
                                    const m3::vec3 &normal) {
     float light_percent = 0.0;
     for (auto &light : lights) {
@@ -129,28 +242,312 @@ static uint16_t material_to_rgb565(const material &material,
     return material_color_to_rgb565(color);
 }
 
-bool scene_to_polygons(const scene &scene, array<polygon> &polygons) {
-    size_t i = 0;
+// faces that do not fit into a polygon are split into a fan of polygons
+// around the first vertex, which is exact for convex faces
+static size_t count_face_polygons(size_t vertices_count) {
+    if (vertices_count <= POLYGON_MAX_VERTICES)
+        return 1;
+
+    size_t triangles = vertices_count - 2;
+    size_t triangles_per_polygon = POLYGON_MAX_VERTICES - 2;
+    return (triangles + triangles_per_polygon - 1) / triangles_per_polygon;
+}
+
+static inline void append_vertex(polygon_ring &ring, const m3::vec3 &vertex) {
+    ring.vertices[ring.vertices_count++] = {static_cast<int16_t>(vertex.x),
+                                            static_cast<int16_t>(vertex.y)};
+}
+
+// half space normal * point + d >= 0 of the object space
+struct view_plane {
+    m3::vec3 normal;
+    float d;
+    // length of the normal, the distance scale of the sphere test
+    float length;
+};
+
+// Planes of the part of the view that ends on the screen. The transform puts
+// the eye space z into w, which is negative in front of the camera, so
+// begin.x <= x / w <= end.x turns into begin.x * w - x >= 0 and
+// x - end.x * w >= 0, the last plane drops everything behind the camera.
+static void compute_view_planes(const m3::mat4 &transform,
+                                const window &screen, view_plane planes[5]) {
+    m3::vec4 rows[4];
+    for (size_t i = 0; i < 4; ++i)
+        rows[i] = {transform.m[0][i], transform.m[1][i], transform.m[2][i],
+                   transform.m[3][i]};
+
+    const m3::vec4 &x = rows[0], &y = rows[1], &w = rows[3];
+    float begin_x = screen.begin.x, begin_y = screen.begin.y;
+    float end_x = screen.end.x, end_y = screen.end.y;
+    m3::vec4 equations[5] = {
+        {begin_x * w.x - x.x, begin_x * w.y - x.y, begin_x * w.z - x.z,
+         begin_x * w.w - x.w},
+        {x.x - end_x * w.x, x.y - end_x * w.y, x.z - end_x * w.z,
+         x.w - end_x * w.w},
+        {begin_y * w.x - y.x, begin_y * w.y - y.y, begin_y * w.z - y.z,
+         begin_y * w.w - y.w},
+        {y.x - end_y * w.x, y.y - end_y * w.y, y.z - end_y * w.z,
+         y.w - end_y * w.w},
+        {-w.x, -w.y, -w.z, -w.w}};
+    for (size_t i = 0; i < 5; ++i) {
+        m3::vec3 normal = {equations[i].x, equations[i].y, equations[i].z};
+        planes[i] = {normal, equations[i].w, m3::len(normal)};
+    }
+}
+
+// the sphere rejects most objects, the box corner farthest along the normal
+// catches the rest of those entirely outside of the plane
+static bool is_outside(const view_plane &plane,
+                       const bounding_volume &bounds) {
+    float distance = m3::dot(plane.normal, bounds.center) + plane.d;
+    if (distance < -bounds.radius * plane.length)
+        return true;
+
+    m3::vec3 corner = {plane.normal.x >= 0 ? bounds.max.x : bounds.min.x,
+                       plane.normal.y >= 0 ? bounds.max.y : bounds.min.y,
+                       plane.normal.z >= 0 ? bounds.max.z : bounds.min.z};
+    return m3::dot(plane.normal, corner) + plane.d < 0;
+}
+
+static bool is_visible(const view_plane planes[5],
+                       const bounding_volume &bounds) {
+    for (size_t i = 0; i < 5; ++i) {
+        if (is_outside(planes[i], bounds))
+            return false;
+    }
+
+    return true;
+}
+
+void project_scene(const scene &scene, const m3::mat4 &transform,
+                   const window &screen, vertex_buffer &projected) {
+    view_plane planes[5];
+    compute_view_planes(transform, screen, planes);
+
+    projected.offsets.resize(scene.objects.size);
+    projected.visible.resize(scene.objects.size);
+    size_t count = 0;
+    for (size_t i = 0; i < scene.objects.size; ++i) {
+        projected.offsets[i] = count;
+        projected.visible[i] = is_visible(planes, scene.objects[i].bounds);
+        count += vertices_count(scene.objects[i]);
+    }
+
+    // the capacity is kept, the buffer is allocated in the first frame
+    projected.x.resize(count);
+    projected.y.resize(count);
+    projected.z.resize(count);
+    projected.w.resize(count);
+    projected.transform = transform;
+    for (size_t i = 0; i < scene.objects.size; ++i) {
+        const object &object = scene.objects[i];
+        if (!projected.visible[i])
+            continue;
+
+        float *x = projected.x.data() + projected.offsets[i];
+        float *y = projected.y.data() + projected.offsets[i];
+        float *z = projected.z.data() + projected.offsets[i];
+        float *w = projected.w.data() + projected.offsets[i];
+        if (object.vertices.size != 0) {
+            m3::transform_points(transform, object.vertices.data,
+                                 object.vertices.size, x, y, z, w);
+            continue;
+        }
+
+        // dequantization is applied first, as a part of the transform
+        m3::mat4 dequantized =
+            transform * m3::translate(object.offset) * m3::scale(object.scale);
+        m3::transform_points(dequantized, &object.quantized_vertices.data->x,
+                             object.quantized_vertices.size, x, y, z, w);
+    }
+}
+
+static bool same_lights(const std::vector<m3::vec3> &cached,
+                        const array<const m3::vec3> &lights) {
+    if (cached.size() != lights.size)
+        return false;
+
+    for (size_t i = 0; i < lights.size; ++i) {
+        if (cached[i].x != lights[i].x || cached[i].y != lights[i].y ||
+            cached[i].z != lights[i].z)
+            return false;
+    }
+
+    return true;
+}
+
+void update_shading(const scene &scene, shading_cache &shading) {
+    if (shading.valid && shading.objects.data == scene.objects.data &&
+        shading.objects.size == scene.objects.size &&
+        shading.materials.data == scene.materials.data &&
+        shading.materials.size == scene.materials.size &&
+        same_lights(shading.lights, scene.lights))
+        return;
+
+    shading.colors.clear();
+    for (auto const &object : scene.objects) {
+        for (auto &face : object.faces)
+            shading.colors.push_back(material_to_rgb565(
+                scene.materials[face.material_index], scene.lights,
+                object.normals[face.normal_index]));
+    }
+
+    shading.objects = scene.objects;
+    shading.materials = scene.materials;
+    shading.lights.assign(scene.lights.begin(), scene.lights.end());
+    shading.valid = true;
+}
+
+size_t count_polygons(const scene &scene) {
+    size_t count = 0;
     for (auto const &object : scene.objects) {
+        for (auto &face : object.faces)
+            count += count_face_polygons(face.vertices_count);
+    }
+
+    return count;
+}
+
+// gathers the screen vertices of the face, faces crossing the near plane are
+// clipped from the clip space vertices. Returns false if nothing is left.
+static bool gather_face(const object &object, const vertex_buffer &projected,
+                        size_t offset, const vertex_index *indices,
+                        size_t size, float near_distance,
+                        std::vector<m3::vec4> &clip_vertices,
+                        std::vector<m3::vec3> &vertices, bool &clipped) {
+    size_t behind = 0;
+    for (size_t i = 0; i < size; ++i)
+        behind += -projected.w[offset + indices[i]] < near_distance;
+
+    vertices.clear();
+    clipped = behind != 0;
+    if (behind == 0) {
+        for (size_t i = 0; i < size; ++i)
+            vertices.push_back(projected.at(offset + indices[i]));
+        return true;
+    }
+    if (behind == size)
+        return false;
+
+    // the divided vertices lost w, transform them again
+    clip_vertices.clear();
+    for (size_t i = 0; i < size; ++i) {
+        m3::vec3 vertex = get_vertex(object, indices[i]);
+        clip_vertices.push_back(projected.transform *
+                                m3::vec4(vertex.x, vertex.y, vertex.z, 1.0f));
+    }
+    clip_near(clip_vertices, near_distance, vertices);
+    return vertices.size() >= 3;
+}
+
+bool scene_to_polygons(const scene &scene, const vertex_buffer &projected,
+                       shading_cache &shading, face_scratch &scratch,
+                       polygon_store &polygons,
+                       const pipeline_options &options, pipeline_stats *stats,
+                       std::vector<size_t> *degenerate_faces) {
+    if (projected.offsets.size() != scene.objects.size)
+        return false;
+
+    update_shading(scene, shading);
+    polygons.resize(count_polygons(scene));
+
+    std::vector<m3::vec3> &vertices = scratch.vertices;
+
+    size_t i = 0;
+    size_t culled_objects = 0;
+    size_t culled_faces = 0;
+    size_t clipped_faces = 0;
+    uint32_t face_index = 0;
+    for (size_t object_index = 0; object_index < scene.objects.size;
+         ++object_index) {
+        const object &object = scene.objects[object_index];
+        if (!projected.visible[object_index]) {
+            ++culled_objects;
+            face_index += object.faces.size;
+            continue;
+        }
+
+        size_t offset = projected.offsets[object_index];
         for (auto &face : object.faces) {
-            std::vector<m3::vec3> vertices;
-            for (auto &index : face.vertex_indices)
-                vertices.push_back(object.vertices[index]);
-
-            polygon polygon;
-            for (auto &vertex : vertices) {
-                auto x = static_cast<int16_t>(vertex.x);
-                auto y = static_cast<int16_t>(vertex.y);
-                polygon.vertices.emplace_back(x, y);
+            const vertex_index *indices =
+                object.indices.data + face.first_index;
+            size_t size = face.vertices_count;
+            bool clipped;
+            bool kept = gather_face(object, projected, offset, indices, size,
+                                    options.near_distance,
+                                    scratch.clip_vertices, vertices, clipped);
+            if (!kept) {
+                ++clipped_faces;
+                ++face_index;
+                continue;
             }
 
-            material material = scene.materials[face.material_index];
-            polygon.color = material_to_rgb565(
-                material, scene.lights, object.normals[face.normal_index]);
-            compute_plane_equation(vertices, polygon);
-            polygons.data[i++] = polygon;
+            // the winding is checked before the plane fit and the shading,
+            // which culled faces skip, edge-on faces are left to the fit
+            if (options.cull_back_faces && signed_area(vertices) < 0) {
+                ++culled_faces;
+                ++face_index;
+                continue;
+            }
+
+            plane plane;
+            if (!compute_plane_equation(vertices, plane) &&
+                degenerate_faces != nullptr)
+                degenerate_faces->push_back(face_index);
+
+            // vertices far off the screen would overflow int16, the plane is
+            // fitted before, so depth is not affected
+            if (!is_inside_guard_band(vertices)) {
+                clipped = true;
+                clip_guard_band(vertices, scratch.clipped);
+            }
+            clipped_faces += clipped;
+            if (vertices.size() < 3) {
+                ++face_index;
+                continue;
+            }
+
+            uint16_t color = shading.colors[face_index];
+
+            // clipping may add vertices, so the store grows past the count
+            size = vertices.size();
+            size_t count = count_face_polygons(size);
+            if (i + count > polygons.size())
+                polygons.resize(std::max(i + count, polygons.size() * 3 / 2));
+            for (size_t j = 0; j < count; ++j, ++i) {
+                polygons.planes[i] = plane;
+                polygons.colors[i] = color;
+                polygons.ids[i] = face_index;
+
+                // the first vertex and the next ones of the fan
+                size_t begin = j * (POLYGON_MAX_VERTICES - 2) + 1;
+                size_t end = std::min(begin + POLYGON_MAX_VERTICES - 1, size);
+                polygon_ring &ring = polygons.rings[i];
+                ring.vertices_count = 0;
+                append_vertex(ring, vertices[0]);
+                for (size_t k = begin; k < end; ++k)
+                    append_vertex(ring, vertices[k]);
+
+                compute_edges_and_bounds(ring, polygons.bounds[i]);
+                ring.convex = is_convex(ring);
+            }
+
+            ++face_index;
         }
     }
 
+    polygons.resize(i);
+    // the renderers and the bins address polygons by polygon_index, which
+    // is 16 bits on the Pico
+    if (i > std::numeric_limits<polygon_index>::max())
+        return false;
+
+    if (stats != nullptr) {
+        stats->culled_objects = culled_objects;
+        stats->culled_faces = culled_faces;
+        stats->clipped_faces = clipped_faces;
+    }
+
     return true;
-}
\ No newline at end of file
+}
@@ -7,4 +7,106 @@
 #include <map>
 #include <vector>
 
-bool scene_to_polygons(const scene &scene, array<polygon> &polygons);
+// screen space vertices of all scene objects as a structure of arrays, the
+// vertices of object i start at offsets[i], the buffer is reused from frame
+// to frame. w is the clip space w, faces with vertices behind the near plane
+// are clipped again from the scene vertices and the transform. Vertices of
+// the objects not visible[i] are left unset.
+struct vertex_buffer {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> w;
+    std::vector<size_t> offsets;
+    std::vector<uint8_t> visible;
+    m3::mat4 transform;
+
+    inline m3::vec3 at(size_t index) const {
+        return {x[index], y[index], z[index]};
+    }
+};
+
+// Transforms the vertices of every object into the buffer, the scene is left
+// untouched. Objects whose bounds are off the screen or behind the camera
+// are marked invisible and not transformed, scene_to_polygons skips them.
+void project_scene(const scene &scene, const m3::mat4 &transform,
+                   const window &screen, vertex_buffer &projected);
+
+// RGB565 colors of the scene faces in the scene order. Shading depends on
+// the object normals, the materials and the lights only, none of which moves
+// with the camera, so the colors are kept from frame to frame. They are
+// computed again when the scene arrays or the light vectors change, edits of
+// the materials or normals in place need invalidate. A reloaded scene may get
+// the arrays of the previous one, so every scene load calls invalidate too.
+struct shading_cache {
+    std::vector<uint16_t> colors;
+    // the state the colors were computed for
+    array<const object> objects;
+    array<const material> materials;
+    std::vector<m3::vec3> lights;
+    bool valid = false;
+
+    void invalidate() {
+        valid = false;
+    }
+};
+
+// computes the face colors unless the cache already holds them for the scene
+void update_shading(const scene &scene, shading_cache &shading);
+
+// vertices of the face being built by scene_to_polygons, kept from frame to
+// frame so faces are gathered and clipped without allocations
+struct face_scratch {
+    std::vector<m3::vec4> clip_vertices;
+    std::vector<m3::vec3> vertices;
+    std::vector<m3::vec3> clipped;
+};
+
+// polygon vertices are clipped to |x|, |y| <= GUARD_BAND, which is wider than
+// any screen and keeps the edge functions of the rings in int32
+#define GUARD_BAND 8192
+
+// optional stages of scene_to_polygons
+struct pipeline_options {
+    // drops faces turned away from the camera, which is only invisible for
+    // closed meshes, open ones show their inside through the holes
+    bool cull_back_faces = false;
+    // faces are clipped to clip space w <= -near_distance, m3::perspective
+    // keeps the eye space z in w, which is minus the distance along the view
+    // direction for m3::look_at
+    float near_distance = 0.01f;
+};
+
+// what scene_to_polygons left out
+struct pipeline_stats {
+    // objects outside of the view
+    size_t culled_objects;
+    size_t culled_faces;
+    // faces cut or dropped by the near plane or the guard band
+    size_t clipped_faces;
+};
+
+// fits the depth plane of a projected face, returns false for faces that are
+// degenerate or seen edge-on, whose plane is never closer than another one
+bool compute_plane_equation(const std::vector<m3::vec3> &vertices,
+                            plane &plane);
+
+// number of polygons scene_to_polygons produces for the scene unless faces
+// are clipped, which may add vertices
+size_t count_polygons(const scene &scene);
+
+// Builds the polygons of the scene from its projected vertices. Faces are
+// clipped by the near plane in clip space and by the guard band on the
+// screen, so every polygon fits int16 coordinates. The store is resized to
+// the number of polygons kept. Polygon ids are face indices in the scene
+// order, culled and clipped faces included. Indices of the faces whose plane
+// could not be fitted are appended to degenerate_faces, such polygons are
+// never closer than the others. Colors are taken from the shading cache,
+// which is updated first. Returns false if the polygons do not fit
+// polygon_index.
+bool scene_to_polygons(const scene &scene, const vertex_buffer &projected,
+                       shading_cache &shading, face_scratch &scratch,
+                       polygon_store &polygons,
+                       const pipeline_options &options = {},
+                       pipeline_stats *stats = nullptr,
+                       std::vector<size_t> *degenerate_faces = nullptr);
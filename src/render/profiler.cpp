@@ -0,0 +1,82 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if PICO_ON_DEVICE
+#include "pico/time.h"
+#else
+#include <chrono>
+#endif
+
+static const char *stage_names[FRAME_STAGES] = {"transform", "polygons",
+                                                "binning", "render", "flush"};
+
+const char *stage_name(frame_stage stage) {
+    return stage_names[static_cast<size_t>(stage)];
+}
+
+uint64_t profile_clock_us() {
+#if PICO_ON_DEVICE
+    return time_us_64();
+#else
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+void frame_profiler::end_frame(std::ostream &os) {
+    size_t slot = frames % PROFILE_FRAMES;
+    for (size_t i = 0; i < PROFILE_DISPLAYS; ++i) {
+        for (size_t j = 0; j < FRAME_STAGES; ++j)
+            samples[i][j][slot] = current[i][j];
+    }
+
+    if (streaming) {
+        for (size_t i = 0; i < PROFILE_DISPLAYS; ++i) {
+            os << frames << "," << i;
+            for (size_t j = 0; j < FRAME_STAGES; ++j)
+                os << "," << current[i][j];
+            os << "\n";
+        }
+        os.flush();
+    }
+
+    memset(current, 0, sizeof(current));
+    ++frames;
+}
+
+void frame_profiler::reset() {
+    memset(current, 0, sizeof(current));
+    frames = 0;
+}
+
+size_t frame_profiler::sample_count() const {
+    return std::min<size_t>(frames, PROFILE_FRAMES);
+}
+
+stage_summary frame_profiler::summarize(size_t display,
+                                        frame_stage stage) const {
+    size_t count = sample_count();
+    if (count == 0)
+        return {0, 0, 0};
+
+    const uint32_t *times = samples[display][static_cast<size_t>(stage)];
+    stage_summary summary = {times[0], 0, times[0]};
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        summary.min_us = std::min(summary.min_us, times[i]);
+        summary.max_us = std::max(summary.max_us, times[i]);
+        total += times[i];
+    }
+    summary.avg_us = static_cast<uint32_t>(total / count);
+    return summary;
+}
+
+void frame_profiler::write_csv_header(std::ostream &os) const {
+    os << "frame,display";
+    for (size_t j = 0; j < FRAME_STAGES; ++j)
+        os << "," << stage_names[j] << "_us";
+    os << std::endl;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+// Timings of the stages of a frame. Stages are timed by scoped timers and
+// summed over the frame, end_frame stores the sums in a ring of the last
+// PROFILE_FRAMES frames, which the min/avg/max are computed over. The clock is
+// time_us_64 on the Pico and steady_clock on the host.
+
+#define PROFILE_DISPLAYS 2
+#define PROFILE_FRAMES 32
+
+// stages of a frame, in the order they run
+enum class frame_stage : uint8_t {
+    transform,
+    polygons,
+    binning,
+    render,
+    flush,
+};
+
+#define FRAME_STAGES 5
+
+const char *stage_name(frame_stage stage);
+
+// microseconds of a monotonic clock
+uint64_t profile_clock_us();
+
+struct stage_summary {
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+};
+
+struct frame_profiler {
+    // times of the frame being profiled
+    uint32_t current[PROFILE_DISPLAYS][FRAME_STAGES];
+    // times of the last frames, frames % PROFILE_FRAMES is the next slot
+    uint32_t samples[PROFILE_DISPLAYS][FRAME_STAGES][PROFILE_FRAMES];
+    uint32_t frames;
+    // every finished frame is written as CSV rows when set
+    bool streaming;
+
+    inline void add(size_t display, frame_stage stage, uint64_t us) {
+        current[display][static_cast<size_t>(stage)] +=
+            static_cast<uint32_t>(us);
+    }
+
+    void end_frame(std::ostream &os);
+    void reset();
+
+    // frames the summaries are computed over
+    size_t sample_count() const;
+    stage_summary summarize(size_t display, frame_stage stage) const;
+
+    void write_csv_header(std::ostream &os) const;
+};
+
+// adds the time from its construction to its destruction to the stage
+struct scoped_timer {
+    frame_profiler &profiler;
+    size_t display;
+    frame_stage stage;
+    uint64_t begin;
+
+    inline scoped_timer(frame_profiler &profiler, size_t display,
+                        frame_stage stage)
+        : profiler(profiler), display(display), stage(stage),
+          begin(profile_clock_us()) {
+    }
+
+    inline ~scoped_timer() {
+        profiler.add(display, stage, profile_clock_us() - begin);
+    }
+
+    scoped_timer(const scoped_timer &) = delete;
+    scoped_timer &operator=(const scoped_timer &) = delete;
+};
@@ -1,7 +1,20 @@
 #pragma once
 
 #include "common.h"
-#include "display.h"
+#include "sink.h"
+#include "stats.h"
 
-void warnock_render(display_t *display, const window &window, uint16_t bg_color,
-                    void set_pixel(display_t *, point2, uint16_t));
+// Renders the polygons listed by window.polygons, the list is reordered in
+// place. Sink is one of the pixel sinks from sink.h, the function is
+// instantiated for each of them in render.cpp. The window stack is static, so
+// the function is not reentrant, use warnock_render_parallel to render on
+// several threads.
+template <typename Sink>
+void warnock_render(Sink &sink, const polygon_view &polygons,
+                    const window &window, uint16_t bg_color);
+
+#ifdef WARNOCK_STATS
+// counters of all warnock_render calls since the last reset
+const warnock_stats &get_warnock_stats();
+void reset_warnock_stats();
+#endif
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "color.h"
+#include "common.h"
+
+// Pixel sinks receive the output of warnock_render. Every sink provides
+//     void set_pixel(point2 point, uint16_t color);
+//     void fill_span(point2 begin, int16_t length, uint16_t color);
+//     void fill_rect(point2 begin, point2 end, uint16_t color);
+// where points are in window coordinates (origin in the screen center),
+// spans are horizontal and rect end is exclusive.
+
+// row-major rgb565 framebuffer of the whole screen
+struct rgb565_sink {
+    uint16_t *pixels;
+    int16_t width;
+    int16_t height;
+
+    inline uint16_t *at(point2 point) const {
+        return pixels + (point.y + height / 2) * width + (point.x + width / 2);
+    }
+
+    inline void set_pixel(point2 point, uint16_t color) {
+        *at(point) = color;
+    }
+
+    inline void fill_span(point2 begin, int16_t length, uint16_t color) {
+        std::fill_n(at(begin), length, color);
+    }
+
+    inline void fill_rect(point2 begin, point2 end, uint16_t color) {
+        for (int16_t y = begin.y; y < end.y; ++y)
+            fill_span({begin.x, y}, end.x - begin.x, color);
+    }
+};
+
+// row-major abgr8888 framebuffer of the whole screen, the layout of
+// SDL_PIXELFORMAT_ABGR8888 textures
+struct abgr8888_sink {
+    uint32_t *pixels;
+    int16_t width;
+    int16_t height;
+
+    inline uint32_t *at(point2 point) const {
+        return pixels + (point.y + height / 2) * width + (point.x + width / 2);
+    }
+
+    inline void set_pixel(point2 point, uint16_t color) {
+        *at(point) = rgb565_to_abgr8888(color);
+    }
+
+    inline void fill_span(point2 begin, int16_t length, uint16_t color) {
+        std::fill_n(at(begin), length, rgb565_to_abgr8888(color));
+    }
+
+    inline void fill_rect(point2 begin, point2 end, uint16_t color) {
+        uint32_t abgr_color = rgb565_to_abgr8888(color);
+        for (int16_t y = begin.y; y < end.y; ++y)
+            std::fill_n(at({begin.x, y}), end.x - begin.x, abgr_color);
+    }
+};
+
+// row-major rgb565 buffer of a single tile starting at origin, the layout
+// LCD_WriteBitmap expects
+struct tile_sink {
+    uint16_t *pixels;
+    point2 origin;
+    int16_t width;
+
+    inline uint16_t *at(point2 point) const {
+        return pixels + (point.y - origin.y) * width + (point.x - origin.x);
+    }
+
+    inline void set_pixel(point2 point, uint16_t color) {
+        *at(point) = color;
+    }
+
+    inline void fill_span(point2 begin, int16_t length, uint16_t color) {
+        std::fill_n(at(begin), length, color);
+    }
+
+    inline void fill_rect(point2 begin, point2 end, uint16_t color) {
+        for (int16_t y = begin.y; y < end.y; ++y)
+            fill_span({begin.x, y}, end.x - begin.x, color);
+    }
+};
+
+// a write of a render, a pixel is a 1x1 rect
+struct sink_write {
+    point2 begin;
+    point2 end;
+    uint16_t color;
+};
+
+// records the writes of a render, replaying them into another sink times the
+// pixel fill apart from the subdivision
+struct recording_sink {
+    std::vector<sink_write> *writes;
+
+    inline void set_pixel(point2 point, uint16_t color) {
+        writes->push_back(
+            {point,
+             {static_cast<int16_t>(point.x + 1),
+              static_cast<int16_t>(point.y + 1)},
+             color});
+    }
+
+    inline void fill_span(point2 begin, int16_t length, uint16_t color) {
+        writes->push_back({begin,
+                           {static_cast<int16_t>(begin.x + length),
+                            static_cast<int16_t>(begin.y + 1)},
+                           color});
+    }
+
+    inline void fill_rect(point2 begin, point2 end, uint16_t color) {
+        writes->push_back({begin, end, color});
+    }
+};
+
+// writes the recorded output into the sink the way the render did
+template <typename Sink>
+inline void replay_writes(Sink &sink, const std::vector<sink_write> &writes) {
+    for (const sink_write &write : writes) {
+        if (write.end.x - write.begin.x == 1 &&
+            write.end.y - write.begin.y == 1)
+            sink.set_pixel(write.begin, write.color);
+        else
+            sink.fill_rect(write.begin, write.end, write.color);
+    }
+}
+
+// discards the output, measures the cost of subdivision alone
+struct null_sink {
+    inline void set_pixel(point2, uint16_t) {
+    }
+
+    inline void fill_span(point2, int16_t, uint16_t) {
+    }
+
+    inline void fill_rect(point2, point2, uint16_t) {
+    }
+};
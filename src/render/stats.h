@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Counters of warnock_render, compiled in when WARNOCK_STATS is defined.
+// The renderer is a template of the counters type: builds without the define
+// use no_stats, whose empty methods are inlined away, so the counters cost
+// nothing there. warnock_render_parallel never counts.
+
+// windows deeper than this are counted in the last depth
+#define WARNOCK_STATS_DEPTHS 32
+
+struct warnock_stats {
+    // windows visited per number of splits above them
+    uint32_t windows[WARNOCK_STATS_DEPTHS];
+    // polygons classified per relationship, in the order of the enum
+    uint32_t relationships[4];
+    uint32_t cover_hits;
+    uint32_t cover_misses;
+    // 1x1 leaf windows resolved by fill_pixel
+    uint32_t pixel_fills;
+    size_t max_stack_size;
+
+    inline void count_window(size_t depth) {
+        ++windows[depth < WARNOCK_STATS_DEPTHS ? depth
+                                               : WARNOCK_STATS_DEPTHS - 1];
+    }
+
+    inline void count_relationship(size_t relationship) {
+        ++relationships[relationship];
+    }
+
+    inline void count_cover(bool found) {
+        ++(found ? cover_hits : cover_misses);
+    }
+
+    inline void count_pixel_fill() {
+        ++pixel_fills;
+    }
+
+    inline void count_stack_size(size_t size) {
+        if (size > max_stack_size)
+            max_stack_size = size;
+    }
+};
+
+struct no_stats {
+    inline void count_window(size_t) {
+    }
+
+    inline void count_relationship(size_t) {
+    }
+
+    inline void count_cover(bool) {
+    }
+
+    inline void count_pixel_fill() {
+    }
+
+    inline void count_stack_size(size_t) {
+    }
+};
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+
+#include "common.h"
+#include "depth.h"
+#include "stats.h"
+
+// Warnock primitives shared by the serial and the parallel renderers
+
+enum class relationship {
+    disjoint,
+    contained,
+    intersecting,
+    surrounding
+};
+
+static inline int32_t eval_edge(const edge2 &edge, int16_t x, int16_t y) {
+    return edge.a * x + edge.b * y + edge.c;
+}
+
+// the point must not lie on the polygon border
+static inline bool is_inside_polygon(const point2 &point,
+                                     const polygon_ring &ring) {
+    size_t size = ring.vertices_count;
+    if (ring.convex) {
+        // inside if the point is on the same side of every edge
+        bool has_positive = false;
+        bool has_negative = false;
+        for (size_t i = 0; i < size; ++i) {
+            int32_t f = eval_edge(ring.edges[i], point.x, point.y);
+            has_positive |= f > 0;
+            has_negative |= f < 0;
+        }
+        return has_positive != has_negative;
+    }
+
+    // winding number, upward edges crossed on the left add one and downward
+    // edges crossed on the right subtract one
+    int winding = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const point2 &begin = ring.vertices[i];
+        const point2 &end = ring.vertices[(i + 1) % size];
+        int32_t f = eval_edge(ring.edges[i], point.x, point.y);
+        if (begin.y <= point.y) {
+            if (end.y > point.y && f > 0)
+                ++winding;
+        } else if (end.y <= point.y && f < 0) {
+            --winding;
+        }
+    }
+
+    return winding != 0;
+}
+
+// checks if the edge touches the closed rectangle: the bounding boxes must
+// overlap and the rectangle corners must not all lie on one side of the line
+static inline bool edge_touches_rect(const point2 &begin, const point2 &end,
+                                     const edge2 &edge, int16_t x_min,
+                                     int16_t x_max, int16_t y_min,
+                                     int16_t y_max) {
+    if (std::max(begin.x, end.x) < x_min || std::min(begin.x, end.x) > x_max ||
+        std::max(begin.y, end.y) < y_min || std::min(begin.y, end.y) > y_max)
+        return false;
+
+    int32_t f[4] = {
+        eval_edge(edge, x_min, y_min), eval_edge(edge, x_min, y_max),
+        eval_edge(edge, x_max, y_max), eval_edge(edge, x_max, y_min)};
+    bool all_positive = f[0] > 0 && f[1] > 0 && f[2] > 0 && f[3] > 0;
+    bool all_negative = f[0] < 0 && f[1] < 0 && f[2] < 0 && f[3] < 0;
+    return !all_positive && !all_negative;
+}
+
+// Warnock only tells disjoint and surrounding polygons from the rest, so an
+// edge lying inside the window is reported as intersecting as well
+static inline relationship check_relationship(const polygon_view &polygons,
+                                              size_t index,
+                                              const window &window) {
+    int16_t x_min = window.begin.x, x_max = window.end.x - 1;
+    int16_t y_min = window.begin.y, y_max = window.end.y - 1;
+
+    const bounds2 &bounds = polygons.bounds[index];
+    if (bounds.max.x < x_min || bounds.min.x > x_max ||
+        bounds.max.y < y_min || bounds.min.y > y_max)
+        return relationship::disjoint;
+
+    if (bounds.min.x >= x_min && bounds.max.x <= x_max &&
+        bounds.min.y >= y_min && bounds.max.y <= y_max)
+        return relationship::contained;
+
+    // the ring is only touched by polygons crossing the window border
+    const polygon_ring &ring = polygons.rings[index];
+    size_t size = ring.vertices_count;
+    for (size_t i = 0; i < size; ++i) {
+        if (edge_touches_rect(ring.vertices[i], ring.vertices[(i + 1) % size],
+                              ring.edges[i], x_min, x_max, y_min, y_max))
+            return relationship::intersecting;
+    }
+
+    // the polygon border does not enter the window
+    return is_inside_polygon({x_min, y_min}, ring)
+               ? relationship::surrounding
+               : relationship::disjoint;
+}
+
+// moves indices of disjoint polygons to the front and of surrounding ones to
+// the back of the range, returns the position of the first non-disjoint one
+// and sets surrounding_cursor to the position of the first surrounding one
+template <typename Stats>
+static inline size_t partition_polygons(const window &window,
+                                        const polygon_view &polygons,
+                                        polygon_index *indices, size_t size,
+                                        size_t &surrounding_cursor,
+                                        Stats &stats) {
+    size_t index = 0;
+    size_t disjoint_cursor = 0;
+    surrounding_cursor = size;
+    while (index < surrounding_cursor) {
+        relationship rel = check_relationship(polygons, indices[index], window);
+        stats.count_relationship(static_cast<size_t>(rel));
+
+        if (rel == relationship::disjoint) {
+            std::swap(indices[index++], indices[disjoint_cursor++]);
+        } else if (rel == relationship::surrounding) {
+            std::swap(indices[index], indices[--surrounding_cursor]);
+        } else {
+            ++index;
+        }
+    }
+
+    return disjoint_cursor;
+}
+
+template <typename Sink>
+static void fill_pixel(Sink &sink, const point2 &point,
+                       const polygon_view &polygons,
+                       const polygon_index *indices, size_t size) {
+    polygon_index closest = closest_polygon(polygons, indices, size, point);
+    sink.set_pixel(point, polygons.colors[closest]);
+}
+
+template <typename Sink>
+static inline void fill_window(Sink &sink, const window &window,
+                               const uint16_t color) {
+    sink.fill_rect(window.begin, window.end, color);
+}
+
+// looks for the polygon closest to the viewer in all four window corners,
+// returns false if there is no such polygon
+static bool find_cover_polygon(const window &window,
+                               const polygon_view &polygons,
+                               const polygon_index *indices, size_t size,
+                               polygon_index &cover) {
+    auto window_end_x = static_cast<int16_t>(window.end.x - 1);
+    auto window_end_y = static_cast<int16_t>(window.end.y - 1);
+
+    point2 window_vertices[4] = {{window.begin.x, window.begin.y},
+                                 {window.begin.x, window_end_y},
+                                 {window_end_x, window_end_y},
+                                 {window_end_x, window.begin.y}};
+
+    polygon_index closest[4];
+    closest_polygons(polygons, indices, size, window_vertices, closest);
+
+    // pieces of a split face share the id, the plane and the color
+    for (int i = 1; i < 4; ++i) {
+        if (polygons.ids[closest[i - 1]] != polygons.ids[closest[i]])
+            return false;
+    }
+
+    cover = closest[0];
+    return true;
+}
+
+// splits the window into quadrants (or halves for one pixel wide windows),
+// returns the number of parts written to the result
+static inline size_t split_window(const window &window,
+                                  struct window result[4]) {
+    int16_t x_split = window.begin.x + ((window.end.x - window.begin.x) / 2);
+    int16_t y_split = window.begin.y + ((window.end.y - window.begin.y) / 2);
+
+    int16_t window_width = window.end.x - window.begin.x;
+    int16_t window_height = window.end.y - window.begin.y;
+
+    if (window_width > 1 && window_height > 1) {
+        result[0] = {{window.begin.x, window.begin.y}, {x_split, y_split}};
+        result[1] = {{x_split, window.begin.y}, {window.end.x, y_split}};
+        result[2] = {{window.begin.x, y_split}, {x_split, window.end.y}};
+        result[3] = {{x_split, y_split}, {window.end.x, window.end.y}};
+        return 4;
+    } else if (window_width > 1) {
+        result[0] = {{window.begin.x, window.begin.y}, {x_split, window.end.y}};
+        result[1] = {{x_split, window.begin.y}, {window.end.x, window.end.y}};
+        return 2;
+    } else {
+        result[0] = {{window.begin.x, window.begin.y}, {window.end.x, y_split}};
+        result[1] = {{window.begin.x, y_split}, {window.end.x, window.end.y}};
+        return 2;
+    }
+}
@@ -1,16 +1,76 @@
 #pragma once
 
+#include <cstddef>
+
 #include "common.h"
 #include "math3d.h"
 
+// the binary assets store 16-bit vertex indices, the desktop build defines
+// WIDE_VERTEX_INDICES for larger OBJ files
+#ifdef WIDE_VERTEX_INDICES
+using vertex_index = uint32_t;
+#else
+using vertex_index = uint16_t;
+#endif
+
 struct face {
-    std::vector<size_t> vertex_indices;
-    size_t normal_index;
-    size_t material_index;
+    // vertex indices of the face are object.indices[first_index] and the
+    // next vertices_count - 1 ones
+    uint32_t first_index;
+    uint16_t vertices_count;
+    uint16_t material_index;
+    vertex_index normal_index;
+};
+
+// vertex = {x, y, z} * object.scale + object.offset
+struct quantized_vertex {
+    int16_t x;
+    int16_t y;
+    int16_t z;
 };
 
+// m3::transform_points reads the vertices as packed int16 triples
+static_assert(sizeof(quantized_vertex) == 3 * sizeof(int16_t));
+static_assert(offsetof(quantized_vertex, y) == sizeof(int16_t));
+static_assert(offsetof(quantized_vertex, z) == 2 * sizeof(int16_t));
+
+// bounds of the object vertices, the box and the sphere around its center,
+// they let whole objects be culled before their vertices are transformed
+struct bounding_volume {
+    m3::vec3 min;
+    m3::vec3 max;
+    m3::vec3 center;
+    float radius;
+};
+
+// Objects reference their data, which lives in flash for the generated
+// datasets and in a scene_storage for scenes parsed from text. Either
+// vertices or quantized_vertices is set.
 struct object {
-    std::vector<face> faces;
-    std::vector<m3::vec3> vertices;
-    std::vector<m3::vec3> normals;
+    array<const m3::vec3> vertices;
+    array<const quantized_vertex> quantized_vertices;
+    m3::vec3 scale;
+    m3::vec3 offset;
+    array<const m3::vec3> normals;
+    array<const face> faces;
+    array<const vertex_index> indices;
+    bounding_volume bounds;
 };
+
+constexpr size_t vertices_count(const object &object) {
+    return object.vertices.size + object.quantized_vertices.size;
+}
+
+inline m3::vec3 get_vertex(const object &object, size_t index) {
+    if (object.vertices.size != 0)
+        return object.vertices[index];
+
+    const quantized_vertex &vertex = object.quantized_vertices[index];
+    return {vertex.x * object.scale.x + object.offset.x,
+            vertex.y * object.scale.y + object.offset.y,
+            vertex.z * object.scale.z + object.offset.z};
+}
+
+// bounds of the vertices of the object, the generated datasets carry them
+// precomputed
+bounding_volume compute_bounds(const object &object);
@@ -0,0 +1,501 @@
+#include "parser.h"
+
+#include <algorithm>
+#include <charconv>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+// smallest part of an .obj file parsed by its own thread
+#define OBJ_CHUNK_MIN (1 << 20)
+
+// splits the text into lines and lines into tokens separated by spaces, tabs
+// and carriage returns
+struct tokenizer {
+    std::string_view text;
+    std::string_view line{};
+
+    // moves to the next line, returns false at the end of the text
+    bool next_line() {
+        if (text.empty())
+            return false;
+
+        size_t end = text.find('\n');
+        if (end == std::string_view::npos) {
+            line = text;
+            text = {};
+        } else {
+            line = text.substr(0, end);
+            text = text.substr(end + 1);
+        }
+
+        return true;
+    }
+
+    // takes the next token of the line, returns false if there is none
+    bool next(std::string_view &token) {
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) {
+            line = {};
+            return false;
+        }
+
+        size_t end = line.find_first_of(" \t\r", begin);
+        if (end == std::string_view::npos)
+            end = line.size();
+
+        token = line.substr(begin, end - begin);
+        line = line.substr(end);
+        return true;
+    }
+
+    // number of tokens left in the line
+    size_t count() const {
+        tokenizer copy = *this;
+        size_t count = 0;
+        for (std::string_view token; copy.next(token);)
+            ++count;
+        return count;
+    }
+};
+
+template <typename T>
+static bool parse_number(std::string_view token, T &value) {
+    const char *end = token.data() + token.size();
+    auto result = std::from_chars(token.data(), end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+// reads the rest of the line, which must be exactly three numbers
+static bool parse_vec3(tokenizer &tokens, m3::vec3 &vec) {
+    std::string_view token;
+    for (size_t i = 0; i < 3; ++i) {
+        if (!tokens.next(token) || !parse_number(token, vec.v[i]))
+            return false;
+    }
+
+    return !tokens.next(token);
+}
+
+// reads the rest of the line, which must be exactly one token
+static bool parse_name(tokenizer &tokens, std::string_view &name) {
+    std::string_view token;
+    return tokens.next(name) && !tokens.next(token);
+}
+
+bool parse_scene(std::string_view text, scene_storage &storage,
+                 camera &camera, scene_paths &paths) {
+    tokenizer tokens = {text};
+    while (tokens.next_line()) {
+        std::string_view keyword;
+        if (!tokens.next(keyword) || keyword[0] == '#')
+            continue;
+
+        bool valid = true;
+        if (keyword == "o") {
+            valid = parse_name(tokens, paths.object);
+        } else if (keyword == "m") {
+            valid = parse_name(tokens, paths.material);
+        } else if (keyword == "l") {
+            m3::vec3 light;
+            valid = parse_vec3(tokens, light);
+            storage.lights.push_back(light);
+        } else if (keyword == "cp") {
+            valid = parse_vec3(tokens, camera.position);
+        } else if (keyword == "ct") {
+            valid = parse_vec3(tokens, camera.target);
+        } else if (keyword == "cu") {
+            valid = parse_vec3(tokens, camera.up);
+        }
+
+        if (!valid) {
+            std::cout << "invalid scene file format" << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool parse_materials(std::string_view text, std::vector<material> &materials,
+                     material_map &material_names) {
+    material material = {};
+    std::string_view material_name;
+    float ns = 0;
+
+    size_t index = 0;
+    tokenizer tokens = {text};
+    while (tokens.next_line()) {
+        std::string_view keyword;
+        if (!tokens.next(keyword) || keyword[0] == '#')
+            continue;
+
+        bool valid = true;
+        if (keyword == "newmtl") {
+            if (!material_name.empty()) {
+                materials.push_back(
+                    {{material.color.r * ns, material.color.g * ns,
+                      material.color.b * ns}});
+                material_names.insert_or_assign(std::string(material_name),
+                                                index++);
+            }
+
+            valid = parse_name(tokens, material_name);
+        } else if (keyword == "Ns") {
+            std::string_view token;
+            valid = tokens.next(token) && parse_number(token, ns);
+        } else if (keyword == "Kd") {
+            m3::vec3 color;
+            valid = parse_vec3(tokens, color);
+            material.color = {color.x, color.y, color.z};
+        }
+
+        if (!valid) {
+            std::cout << "invalid material file format" << std::endl;
+            return false;
+        }
+    }
+
+    if (!material_name.empty()) {
+        materials.push_back({{material.color.r * ns, material.color.g * ns,
+                              material.color.b * ns}});
+        material_names.insert_or_assign(std::string(material_name), index);
+    }
+
+    if (materials.empty()) {
+        std::cout << "nothing to load from material file" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// parses a v/vt/vn token, returns false if the token is malformed and sets
+// has_normal to false if it is a bare vertex index
+static bool parse_face_vertex(std::string_view token, size_t &vertex,
+                              size_t &normal, bool &has_normal) {
+    size_t first = token.find('/');
+    has_normal = first != std::string_view::npos;
+    if (!has_normal)
+        return true;
+
+    size_t second = token.find('/', first + 1);
+    if (second == std::string_view::npos ||
+        token.find('/', second + 1) != std::string_view::npos)
+        return false;
+
+    return parse_number(token.substr(0, first), vertex) &&
+           parse_number(token.substr(second + 1), normal);
+}
+
+// A chunk of an .obj file does not know the vertices, normals and material
+// that come before it, so its faces keep file indices and are made relative
+// to their objects by join_chunks. Segments are the lines up to the next o
+// line, the first one continues the object of the previous chunk.
+struct obj_segment {
+    bool new_object;
+    size_t vertices_begin;
+    size_t normals_begin;
+    size_t faces_begin;
+    size_t indices_begin;
+};
+
+struct obj_face {
+    size_t first_index;
+    size_t vertices_count;
+    size_t normal;
+    // -1 until the first usemtl line of the chunk
+    long material;
+};
+
+struct obj_chunk {
+    std::string_view text;
+    std::vector<obj_segment> segments;
+    std::vector<m3::vec3> vertices;
+    std::vector<m3::vec3> normals;
+    std::vector<obj_face> faces;
+    std::vector<size_t> indices;
+    long material = -1;
+    std::string error;
+};
+
+// where the segment goes in the storage, filled by join_chunks
+struct obj_placement {
+    bool skip;
+    size_t vertices;
+    size_t normals;
+    size_t faces;
+    size_t indices;
+    size_t first_vertex;
+    size_t first_normal;
+    size_t object_indices;
+    size_t material;
+};
+
+// reserves the chunk vectors in one pass, face indices are counted as tokens
+// of the face lines
+static void reserve_chunk(obj_chunk &chunk) {
+    size_t vertices = 0, normals = 0, faces = 0, indices = 0;
+    tokenizer tokens = {chunk.text};
+    while (tokens.next_line()) {
+        std::string_view keyword;
+        if (!tokens.next(keyword))
+            continue;
+
+        vertices += keyword == "v";
+        normals += keyword == "vn";
+        if (keyword == "f") {
+            ++faces;
+            indices += tokens.count();
+        }
+    }
+
+    chunk.vertices.reserve(vertices);
+    chunk.normals.reserve(normals);
+    chunk.faces.reserve(faces);
+    chunk.indices.reserve(indices);
+}
+
+static void parse_chunk(const material_map &material_names,
+                        obj_chunk &chunk) {
+    reserve_chunk(chunk);
+    chunk.segments.push_back({false, 0, 0, 0, 0});
+
+    tokenizer tokens = {chunk.text};
+    while (tokens.next_line()) {
+        std::string_view keyword;
+        if (!tokens.next(keyword) || keyword[0] == '#')
+            continue;
+
+        bool valid = true;
+        if (keyword == "o") {
+            chunk.segments.push_back({true, chunk.vertices.size(),
+                                      chunk.normals.size(), chunk.faces.size(),
+                                      chunk.indices.size()});
+        } else if (keyword == "v") {
+            m3::vec3 vertex;
+            valid = parse_vec3(tokens, vertex);
+            chunk.vertices.push_back(vertex);
+        } else if (keyword == "vn") {
+            m3::vec3 normal;
+            valid = parse_vec3(tokens, normal);
+            chunk.normals.push_back(normal);
+        } else if (keyword == "f" && tokens.count() >= 3) {
+            // a face without normals gets the first normal of its object
+            obj_face face = {chunk.indices.size(), 0, std::string_view::npos,
+                             chunk.material};
+            for (std::string_view token; valid && tokens.next(token);) {
+                size_t vertex, normal;
+                bool has_normal;
+                valid = parse_face_vertex(token, vertex, normal, has_normal);
+                if (!valid || !has_normal)
+                    continue;
+
+                chunk.indices.push_back(vertex - 1);
+                face.normal = normal - 1;
+                ++face.vertices_count;
+            }
+
+            chunk.faces.push_back(face);
+        } else if (keyword == "usemtl") {
+            std::string_view name;
+            valid = parse_name(tokens, name);
+            auto it = material_names.find(name);
+            if (valid && it == material_names.end()) {
+                chunk.error = "material with name " + std::string(name) +
+                              " not found";
+                return;
+            }
+
+            if (valid)
+                chunk.material = static_cast<long>(it->second);
+        }
+
+        if (!valid) {
+            chunk.error = "invalid object file format";
+            return;
+        }
+    }
+}
+
+// the objects and their sizes are known once all chunks are parsed, the
+// segments are placed one after another from the end of the storage
+static void join_chunks(const std::vector<obj_chunk> &chunks,
+                        std::vector<std::vector<obj_placement>> &placements,
+                        scene_storage &storage) {
+    size_t vertices = storage.vertices.size();
+    size_t normals = storage.normals.size();
+    size_t faces = storage.faces.size();
+    size_t indices = storage.indices.size();
+
+    // file indices of the data before the chunk, the indices of the current
+    // object start at object_indices in the storage
+    size_t file_vertices = 0, file_normals = 0;
+    size_t first_vertex = 0, first_normal = 0, object_indices = 0;
+    size_t material = 0;
+    bool has_object = false;
+
+    placements.resize(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const obj_chunk &chunk = chunks[i];
+        placements[i].resize(chunk.segments.size());
+        for (size_t j = 0; j < chunk.segments.size(); ++j) {
+            const obj_segment &segment = chunk.segments[j];
+            bool last = j + 1 == chunk.segments.size();
+            const obj_segment end =
+                last ? obj_segment{false, chunk.vertices.size(),
+                                   chunk.normals.size(), chunk.faces.size(),
+                                   chunk.indices.size()}
+                     : chunk.segments[j + 1];
+
+            if (segment.new_object) {
+                has_object = true;
+                storage.objects.push_back({});
+                first_vertex = file_vertices + segment.vertices_begin;
+                first_normal = file_normals + segment.normals_begin;
+                object_indices = indices;
+            }
+
+            // data before the first object belongs to none
+            placements[i][j] = {!has_object,  vertices,       normals,
+                                faces,        indices,        first_vertex,
+                                first_normal, object_indices, material};
+            if (!has_object)
+                continue;
+
+            object &object = storage.objects.back();
+            size_t segment_vertices =
+                end.vertices_begin - segment.vertices_begin;
+            size_t segment_normals = end.normals_begin - segment.normals_begin;
+            size_t segment_faces = end.faces_begin - segment.faces_begin;
+            size_t segment_indices = end.indices_begin - segment.indices_begin;
+            object.vertices.size += segment_vertices;
+            object.normals.size += segment_normals;
+            object.faces.size += segment_faces;
+            object.indices.size += segment_indices;
+            vertices += segment_vertices;
+            normals += segment_normals;
+            faces += segment_faces;
+            indices += segment_indices;
+        }
+
+        file_vertices += chunk.vertices.size();
+        file_normals += chunk.normals.size();
+        if (chunk.material >= 0)
+            material = static_cast<size_t>(chunk.material);
+    }
+
+    storage.vertices.resize(vertices);
+    storage.normals.resize(normals);
+    storage.faces.resize(faces);
+    storage.indices.resize(indices);
+}
+
+// copies the chunk into the storage, the chunks write disjoint ranges
+static void fill_chunk(const obj_chunk &chunk,
+                       const std::vector<obj_placement> &placements,
+                       scene_storage &storage) {
+    for (size_t j = 0; j < chunk.segments.size(); ++j) {
+        const obj_segment &segment = chunk.segments[j];
+        const obj_placement &placement = placements[j];
+        if (placement.skip)
+            continue;
+
+        bool last = j + 1 == chunk.segments.size();
+        size_t vertices_end = last ? chunk.vertices.size()
+                                   : chunk.segments[j + 1].vertices_begin;
+        size_t normals_end = last ? chunk.normals.size()
+                                  : chunk.segments[j + 1].normals_begin;
+        size_t faces_end =
+            last ? chunk.faces.size() : chunk.segments[j + 1].faces_begin;
+        size_t indices_end =
+            last ? chunk.indices.size() : chunk.segments[j + 1].indices_begin;
+
+        std::copy(chunk.vertices.begin() + segment.vertices_begin,
+                  chunk.vertices.begin() + vertices_end,
+                  storage.vertices.begin() + placement.vertices);
+        std::copy(chunk.normals.begin() + segment.normals_begin,
+                  chunk.normals.begin() + normals_end,
+                  storage.normals.begin() + placement.normals);
+
+        for (size_t k = segment.indices_begin; k < indices_end; ++k) {
+            storage.indices[placement.indices + k - segment.indices_begin] =
+                static_cast<vertex_index>(chunk.indices[k] -
+                                          placement.first_vertex);
+        }
+
+        for (size_t k = segment.faces_begin; k < faces_end; ++k) {
+            const obj_face &face = chunk.faces[k];
+            size_t index =
+                placement.indices + face.first_index - segment.indices_begin;
+            size_t normal = face.normal == std::string_view::npos
+                                ? 0
+                                : face.normal - placement.first_normal;
+            size_t material = face.material >= 0
+                                  ? static_cast<size_t>(face.material)
+                                  : placement.material;
+
+            storage.faces[placement.faces + k - segment.faces_begin] = {
+                static_cast<uint32_t>(index - placement.object_indices),
+                static_cast<uint16_t>(face.vertices_count),
+                static_cast<uint16_t>(material),
+                static_cast<vertex_index>(normal)};
+        }
+    }
+}
+
+// splits the text into about count chunks at line ends
+static void split_chunks(std::string_view text, size_t count,
+                         std::vector<obj_chunk> &chunks) {
+    size_t begin = 0;
+    for (size_t i = 1; i <= count && begin < text.size(); ++i) {
+        size_t end = i == count ? text.size() : text.size() * i / count;
+        end = end < begin ? begin : end;
+        end = text.find('\n', end);
+        end = end == std::string_view::npos ? text.size() : end + 1;
+
+        chunks.push_back({});
+        chunks.back().text = text.substr(begin, end - begin);
+        begin = end;
+    }
+}
+
+bool parse_objects(std::string_view text, const material_map &material_names,
+                   scene_storage &storage, size_t threads) {
+    // chunks are not worth their threads on small files
+    size_t chunks_count =
+        std::max<size_t>(1, std::min(threads, text.size() / OBJ_CHUNK_MIN));
+
+    std::vector<obj_chunk> chunks;
+    split_chunks(text, chunks_count, chunks);
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i)
+        workers.emplace_back(parse_chunk, std::cref(material_names),
+                             std::ref(chunks[i]));
+    if (!chunks.empty())
+        parse_chunk(material_names, chunks[0]);
+    for (auto &worker : workers)
+        worker.join();
+    workers.clear();
+
+    for (auto &chunk : chunks) {
+        if (!chunk.error.empty()) {
+            std::cout << chunk.error << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<std::vector<obj_placement>> placements;
+    join_chunks(chunks, placements, storage);
+
+    for (size_t i = 1; i < chunks.size(); ++i)
+        workers.emplace_back(fill_chunk, std::cref(chunks[i]),
+                             std::cref(placements[i]), std::ref(storage));
+    if (!chunks.empty())
+        fill_chunk(chunks[0], placements[0], storage);
+    for (auto &worker : workers)
+        worker.join();
+
+    return true;
+}
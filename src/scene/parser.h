@@ -0,0 +1,31 @@
+#pragma once
+
+#include "object.h"
+#include "scene.h"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// material names are looked up by the string_view of a usemtl line
+using material_map = std::map<std::string, size_t, std::less<>>;
+
+// paths of the files a scene file refers to
+struct scene_paths {
+    std::string_view object;
+    std::string_view material;
+};
+
+// Parsers of the .scene, .mtl and .obj formats. They read the whole text from
+// a buffer (a file loaded in memory), tokens are views into it and numbers are
+// parsed in place, so there is no allocation per line. Results are appended to
+// the storage, link_scene makes a scene of it once all files are parsed.
+// Large .obj files are split at line ends and parsed by up to threads threads.
+bool parse_scene(std::string_view text, scene_storage &storage,
+                 camera &camera, scene_paths &paths);
+bool parse_materials(std::string_view text, std::vector<material> &materials,
+                     material_map &material_names);
+bool parse_objects(std::string_view text, const material_map &material_names,
+                   scene_storage &storage, size_t threads = 1);
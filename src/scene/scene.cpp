@@ -1 +1,50 @@
-#include "scene.h"
\ No newline at end of file
+#include "scene.h"
+
+#include <cmath>
+
+bounding_volume compute_bounds(const object &object) {
+    size_t count = vertices_count(object);
+    if (count == 0)
+        return {};
+
+    bounding_volume bounds;
+    bounds.min = bounds.max = get_vertex(object, 0);
+    for (size_t i = 1; i < count; ++i) {
+        m3::vec3 vertex = get_vertex(object, i);
+        bounds.min = {std::fmin(bounds.min.x, vertex.x),
+                      std::fmin(bounds.min.y, vertex.y),
+                      std::fmin(bounds.min.z, vertex.z)};
+        bounds.max = {std::fmax(bounds.max.x, vertex.x),
+                      std::fmax(bounds.max.y, vertex.y),
+                      std::fmax(bounds.max.z, vertex.z)};
+    }
+
+    // the sphere around the box center is tighter than the box diagonal
+    bounds.center = (bounds.min + bounds.max) * 0.5f;
+    float radius_sq = 0;
+    for (size_t i = 0; i < count; ++i)
+        radius_sq = std::fmax(
+            radius_sq, m3::len_sq(get_vertex(object, i) - bounds.center));
+    bounds.radius = std::sqrt(radius_sq);
+    return bounds;
+}
+
+void link_scene(scene_storage &storage, scene &scene) {
+    size_t vertices = 0, normals = 0, faces = 0, indices = 0;
+    for (auto &object : storage.objects) {
+        object.vertices.data = storage.vertices.data() + vertices;
+        object.normals.data = storage.normals.data() + normals;
+        object.faces.data = storage.faces.data() + faces;
+        object.indices.data = storage.indices.data() + indices;
+
+        vertices += object.vertices.size;
+        normals += object.normals.size;
+        faces += object.faces.size;
+        indices += object.indices.size;
+        object.bounds = compute_bounds(object);
+    }
+
+    scene.objects = {storage.objects.data(), storage.objects.size()};
+    scene.materials = {storage.materials.data(), storage.materials.size()};
+    scene.lights = {storage.lights.data(), storage.lights.size()};
+}
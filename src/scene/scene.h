@@ -11,9 +11,48 @@ struct camera {
     m3::vec3 up;
 };
 
+// views of the scene data, see object
 struct scene {
+    array<const object> objects;
+    array<const material> materials;
+    array<const m3::vec3> lights;
+    struct camera camera;
+};
+
+// checks that faces reference existing indices, normals and materials and
+// indices existing vertices, the generated datasets are checked at compile
+// time
+constexpr bool is_valid(const scene &scene) {
+    for (const object &object : scene.objects) {
+        for (const face &face : object.faces) {
+            if (face.first_index + face.vertices_count > object.indices.size ||
+                face.normal_index >= object.normals.size ||
+                face.material_index >= scene.materials.size)
+                return false;
+        }
+
+        for (vertex_index index : object.indices) {
+            if (index >= vertices_count(object))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// owns the data of a scene parsed from text, the views of the objects are
+// set by link_scene once the storage is filled
+struct scene_storage {
     std::vector<object> objects;
+    std::vector<m3::vec3> vertices;
+    std::vector<m3::vec3> normals;
+    std::vector<face> faces;
+    std::vector<vertex_index> indices;
     std::vector<material> materials;
     std::vector<m3::vec3> lights;
-    struct camera camera;
 };
+
+// points the views of the scene and of its objects into the storage and
+// computes the object bounds, the object arrays must hold the sizes of the
+// object data, stored in the storage object after object
+void link_scene(scene_storage &storage, scene &scene);